@@ -66,6 +66,14 @@ Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s)
       {
         return Spec_Agile_AEAD_AES256_GCM;
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        return Spec_Agile_AEAD_AES128_GCM;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return Spec_Agile_AEAD_AES256_GCM;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -75,93 +83,241 @@ Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s)
 }
 
 static EverCrypt_Error_error_code
-create_in_chacha20_poly1305(EverCrypt_AEAD_state_s **dst, uint8_t *k)
+encrypt_hacl_aes_gcm(
+  uint64_t *ctx,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
 {
-  uint8_t *ek = KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
-  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
-  EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
-  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_CHACHA20, .ek = ek });
-  memcpy(ek, k, (uint32_t)32U * sizeof (uint8_t));
-  dst[0U] = p;
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  Hacl_AES_Bitsliced_aes_gcm_encrypt(ctx, iv_len, iv, ad_len, ad, plain_len, plain, cipher, tag);
   return EverCrypt_Error_Success;
 }
 
 static EverCrypt_Error_error_code
-create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
+decrypt_hacl_aes_gcm(
+  uint64_t *ctx,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
 {
-  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
-  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
-  bool has_avx = EverCrypt_AutoConfig2_has_avx();
-  bool has_sse = EverCrypt_AutoConfig2_has_sse();
-  bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
-  #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (iv_len == (uint32_t)0U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  if (Hacl_AES_Bitsliced_aes_gcm_decrypt(ctx, iv_len, iv, ad_len, ad, cipher_len, dst, cipher, tag))
   {
-    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)480U, sizeof (uint8_t));
-    uint8_t *keys_b = ek;
-    uint8_t *hkeys_b = ek + (uint32_t)176U;
-    uint64_t scrut = aes128_key_expansion(k, keys_b);
-    uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
-    KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
-    EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
-    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES128, .ek = ek });
-    *dst = p;
     return EverCrypt_Error_Success;
   }
-  #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  return EverCrypt_Error_AuthenticationFailure;
 }
 
-static EverCrypt_Error_error_code
-create_in_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
+static Spec_Cipher_Expansion_impl impl_of_alg(Spec_Agile_AEAD_alg a)
 {
   bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
   bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
   bool has_avx = EverCrypt_AutoConfig2_has_avx();
   bool has_sse = EverCrypt_AutoConfig2_has_sse();
   bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
+  bool vale = false;
   #if EVERCRYPT_TARGETCONFIG_X64
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  vale = has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe;
+  #endif
+  switch (a)
   {
-    uint8_t *ek = KRML_HOST_CALLOC((uint32_t)544U, sizeof (uint8_t));
-    uint8_t *keys_b = ek;
-    uint8_t *hkeys_b = ek + (uint32_t)240U;
-    uint64_t scrut = aes256_key_expansion(k, keys_b);
-    uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
-    KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
-    EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
-    p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Vale_AES256, .ek = ek });
-    *dst = p;
-    return EverCrypt_Error_Success;
+    case Spec_Agile_AEAD_AES128_GCM:
+      {
+        if (vale)
+        {
+          return Spec_Cipher_Expansion_Vale_AES128;
+        }
+        return Spec_Cipher_Expansion_Hacl_AES128;
+      }
+    case Spec_Agile_AEAD_AES256_GCM:
+      {
+        if (vale)
+        {
+          return Spec_Cipher_Expansion_Vale_AES256;
+        }
+        return Spec_Cipher_Expansion_Hacl_AES256;
+      }
+    default:
+      {
+        return Spec_Cipher_Expansion_Hacl_CHACHA20;
+      }
   }
-  #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
 }
 
-EverCrypt_Error_error_code
-EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, uint8_t *k)
+#define VALE_AES128_EK_LEN ((uint32_t)480U)
+
+#define VALE_AES256_EK_LEN ((uint32_t)544U)
+
+#define CHACHA20_EK_LEN ((uint32_t)32U)
+
+#define HACL_AES_EK_LEN (Hacl_AES_Bitsliced_ctx_len * (uint32_t)sizeof (uint64_t))
+
+static uint32_t ek_len(Spec_Cipher_Expansion_impl impl)
+{
+  switch (impl)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        return VALE_AES128_EK_LEN;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        return VALE_AES256_EK_LEN;
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        return CHACHA20_EK_LEN;
+      }
+    default:
+      {
+        return HACL_AES_EK_LEN;
+      }
+  }
+}
+
+/*
+  Without AES-NI and PCLMULQDQ, AES-GCM falls back to the portable bitsliced
+  implementation; the expanded key is then a Hacl_AES_Bitsliced context.
+*/
+static void expand(Spec_Cipher_Expansion_impl impl, uint8_t *ek, uint8_t *k)
+{
+  switch (impl)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        uint8_t *keys_b = ek;
+        uint8_t *hkeys_b = ek + (uint32_t)176U;
+        uint64_t scrut = aes128_key_expansion(k, keys_b);
+        uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
+        #endif
+        break;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        #if EVERCRYPT_TARGETCONFIG_X64
+        uint8_t *keys_b = ek;
+        uint8_t *hkeys_b = ek + (uint32_t)240U;
+        uint64_t scrut = aes256_key_expansion(k, keys_b);
+        uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
+        #endif
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+      {
+        Hacl_AES_Bitsliced_aes128_gcm_init((uint64_t *)ek, k);
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        Hacl_AES_Bitsliced_aes256_gcm_init((uint64_t *)ek, k);
+        break;
+      }
+    default:
+      {
+        memcpy(ek, k, (uint32_t)32U * sizeof (uint8_t));
+      }
+  }
+}
+
+static bool is_supported_alg(Spec_Agile_AEAD_alg a)
 {
   switch (a)
   {
     case Spec_Agile_AEAD_AES128_GCM:
       {
-        return create_in_aes128_gcm(dst, k);
+        return true;
       }
     case Spec_Agile_AEAD_AES256_GCM:
       {
-        return create_in_aes256_gcm(dst, k);
+        return true;
       }
     case Spec_Agile_AEAD_CHACHA20_POLY1305:
       {
-        return create_in_chacha20_poly1305(dst, k);
+        return true;
       }
     default:
       {
-        return EverCrypt_Error_UnsupportedAlgorithm;
+        return false;
       }
   }
 }
 
+EverCrypt_Error_error_code
+EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, uint8_t *k)
+{
+  if (!is_supported_alg(a))
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  Spec_Cipher_Expansion_impl impl = impl_of_alg(a);
+  KRML_CHECK_SIZE(sizeof (uint8_t), ek_len(impl));
+  uint8_t *ek = KRML_HOST_CALLOC(ek_len(impl), sizeof (uint8_t));
+  expand(impl, ek, k);
+  KRML_CHECK_SIZE(sizeof (EverCrypt_AEAD_state_s), (uint32_t)1U);
+  EverCrypt_AEAD_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = impl, .ek = ek });
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
+/*
+  The state header takes the first AEAD_IN_PLACE_EK bytes of mem and the
+  expanded key the rest; every ek_len fits.
+*/
+#define AEAD_IN_PLACE_EK ((uint32_t)16U)
+
+_Static_assert(sizeof (EverCrypt_AEAD_state_s) <= AEAD_IN_PLACE_EK, "AEAD state header");
+
+_Static_assert(AEAD_IN_PLACE_EK % sizeof (uint64_t) == 0U, "AEAD key alignment");
+
+_Static_assert(AEAD_IN_PLACE_EK + VALE_AES128_EK_LEN <= EverCrypt_AEAD_state_len
+  && AEAD_IN_PLACE_EK + VALE_AES256_EK_LEN <= EverCrypt_AEAD_state_len
+  && AEAD_IN_PLACE_EK + CHACHA20_EK_LEN <= EverCrypt_AEAD_state_len
+  && AEAD_IN_PLACE_EK + HACL_AES_EK_LEN <= EverCrypt_AEAD_state_len,
+  "AEAD key in place");
+
+EverCrypt_Error_error_code
+EverCrypt_AEAD_init_in_place(
+  Spec_Agile_AEAD_alg a,
+  EverCrypt_AEAD_state_s **dst,
+  uint8_t *mem,
+  uint8_t *k
+)
+{
+  if (!is_supported_alg(a))
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  Spec_Cipher_Expansion_impl impl = impl_of_alg(a);
+  uint8_t *ek = mem + AEAD_IN_PLACE_EK;
+  memset(ek, 0U, ek_len(impl) * sizeof (uint8_t));
+  expand(impl, ek, k);
+  EverCrypt_AEAD_state_s *p = (EverCrypt_AEAD_state_s *)mem;
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = impl, .ek = ek });
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
 static EverCrypt_Error_error_code
 encrypt_aes128_gcm(
   EverCrypt_AEAD_state_s *s,
@@ -440,6 +596,20 @@ EverCrypt_AEAD_encrypt(
       {
         return encrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return
+          encrypt_hacl_aes_gcm((uint64_t *)ek,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            plain,
+            plain_len,
+            cipher,
+            tag);
+      }
     case Spec_Cipher_Expansion_Hacl_CHACHA20:
       {
         if (iv_len != (uint32_t)12U)
@@ -593,7 +763,12 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint64_t ctx[Hacl_AES_Bitsliced_ctx_len] = { 0U };
+  Hacl_AES_Bitsliced_aes128_gcm_init(ctx, k);
+  EverCrypt_Error_error_code
+  r = encrypt_hacl_aes_gcm(ctx, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  Lib_Memzero0_memzero(ctx, Hacl_AES_Bitsliced_ctx_len * sizeof (ctx[0U]));
+  return r;
 }
 
 EverCrypt_Error_error_code
@@ -732,7 +907,12 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
     return EverCrypt_Error_Success;
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint64_t ctx[Hacl_AES_Bitsliced_ctx_len] = { 0U };
+  Hacl_AES_Bitsliced_aes256_gcm_init(ctx, k);
+  EverCrypt_Error_error_code
+  r = encrypt_hacl_aes_gcm(ctx, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+  Lib_Memzero0_memzero(ctx, Hacl_AES_Bitsliced_ctx_len * sizeof (ctx[0U]));
+  return r;
 }
 
 EverCrypt_Error_error_code
@@ -1150,6 +1330,20 @@ EverCrypt_AEAD_decrypt(
       {
         return decrypt_aes256_gcm(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
       }
+    case Spec_Cipher_Expansion_Hacl_AES128:
+    case Spec_Cipher_Expansion_Hacl_AES256:
+      {
+        return
+          decrypt_hacl_aes_gcm((uint64_t *)scrut.ek,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            cipher,
+            cipher_len,
+            tag,
+            dst);
+      }
     case Spec_Cipher_Expansion_Hacl_CHACHA20:
       {
         return decrypt_chacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
@@ -1309,7 +1503,12 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint64_t ctx[Hacl_AES_Bitsliced_ctx_len] = { 0U };
+  Hacl_AES_Bitsliced_aes128_gcm_init(ctx, k);
+  EverCrypt_Error_error_code
+  r = decrypt_hacl_aes_gcm(ctx, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  Lib_Memzero0_memzero(ctx, Hacl_AES_Bitsliced_ctx_len * sizeof (ctx[0U]));
+  return r;
 }
 
 EverCrypt_Error_error_code
@@ -1459,7 +1658,12 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
     }
   }
   #endif
-  return EverCrypt_Error_UnsupportedAlgorithm;
+  uint64_t ctx[Hacl_AES_Bitsliced_ctx_len] = { 0U };
+  Hacl_AES_Bitsliced_aes256_gcm_init(ctx, k);
+  EverCrypt_Error_error_code
+  r = decrypt_hacl_aes_gcm(ctx, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  Lib_Memzero0_memzero(ctx, Hacl_AES_Bitsliced_ctx_len * sizeof (ctx[0U]));
+  return r;
 }
 
 EverCrypt_Error_error_code
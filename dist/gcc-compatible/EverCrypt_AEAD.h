@@ -39,6 +39,7 @@ extern "C" {
 
 #include "Hacl_Kremlib.h"
 #include "EverCrypt_Chacha20Poly1305.h"
+#include "Hacl_AES_Bitsliced.h"
 #include "Vale.h"
 #include "EverCrypt_AutoConfig2.h"
 #include "EverCrypt_Error.h"
@@ -59,6 +60,29 @@ Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s);
 EverCrypt_Error_error_code
 EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, uint8_t *k);
 
+/*
+  Size and alignment of the caller-provided storage for
+  EverCrypt_AEAD_init_in_place; they cover every algorithm and implementation.
+*/
+#define EverCrypt_AEAD_state_len ((uint32_t)1000U)
+
+#define EverCrypt_AEAD_state_align ((uint32_t)16U)
+
+/*
+  Same as EverCrypt_AEAD_create_in, but the state and expanded key are laid out
+  in mem, which must hold EverCrypt_AEAD_state_len bytes aligned on
+  EverCrypt_AEAD_state_align. Nothing is allocated: the resulting state must
+  not be passed to EverCrypt_AEAD_free, and the caller should wipe mem (e.g.
+  with Lib_Memzero0_memzero) once done with the key.
+*/
+EverCrypt_Error_error_code
+EverCrypt_AEAD_init_in_place(
+  Spec_Agile_AEAD_alg a,
+  EverCrypt_AEAD_state_s **dst,
+  uint8_t *mem,
+  uint8_t *k
+);
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_encrypt(
   EverCrypt_AEAD_state_s *s,
@@ -117,57 +117,20 @@ static Spec_Cipher_Expansion_impl vale_impl_of_alg(Spec_Agile_Cipher_cipher_alg
   }
 }
 
-EverCrypt_Error_error_code
-EverCrypt_CTR_create_in(
+/*
+  Picks the implementation of a for the current CPU. Shared by
+  EverCrypt_CTR_create_in and EverCrypt_CTR_init_in_place.
+*/
+static EverCrypt_Error_error_code
+impl_of_cipher_alg(
   Spec_Agile_Cipher_cipher_alg a,
-  EverCrypt_CTR_state_s **dst,
-  uint8_t *k,
-  uint8_t *iv,
   uint32_t iv_len,
-  uint32_t c
+  Spec_Cipher_Expansion_impl *dst
 )
 {
   switch (a)
   {
     case Spec_Agile_Cipher_AES128:
-      {
-        bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
-        bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
-        bool has_avx = EverCrypt_AutoConfig2_has_avx();
-        bool has_sse = EverCrypt_AutoConfig2_has_sse();
-        if (iv_len < (uint32_t)12U)
-        {
-          return EverCrypt_Error_InvalidIVLength;
-        }
-        #if EVERCRYPT_TARGETCONFIG_X64
-        if (has_aesni && has_pclmulqdq && has_avx && has_sse)
-        {
-          uint8_t *ek = KRML_HOST_CALLOC((uint32_t)304U, sizeof (uint8_t));
-          uint8_t *keys_b = ek;
-          uint8_t *hkeys_b = ek + (uint32_t)176U;
-          uint64_t scrut = aes128_key_expansion(k, keys_b);
-          uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
-          uint8_t *iv_ = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
-          memcpy(iv_, iv, iv_len * sizeof (uint8_t));
-          KRML_CHECK_SIZE(sizeof (EverCrypt_CTR_state_s), (uint32_t)1U);
-          EverCrypt_CTR_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_CTR_state_s));
-          p[0U]
-          =
-            (
-              (EverCrypt_CTR_state_s){
-                .i = vale_impl_of_alg(Spec_Cipher_Expansion_cipher_alg_of_impl(Spec_Cipher_Expansion_Vale_AES128)),
-                .iv = iv_,
-                .iv_len = iv_len,
-                .xkey = ek,
-                .ctr = c
-              }
-            );
-          *dst = p;
-          return EverCrypt_Error_Success;
-        }
-        #endif
-        return EverCrypt_Error_UnsupportedAlgorithm;
-      }
     case Spec_Agile_Cipher_AES256:
       {
         bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
@@ -181,27 +144,7 @@ EverCrypt_CTR_create_in(
         #if EVERCRYPT_TARGETCONFIG_X64
         if (has_aesni && has_pclmulqdq && has_avx && has_sse)
         {
-          uint8_t *ek = KRML_HOST_CALLOC((uint32_t)368U, sizeof (uint8_t));
-          uint8_t *keys_b = ek;
-          uint8_t *hkeys_b = ek + (uint32_t)240U;
-          uint64_t scrut = aes256_key_expansion(k, keys_b);
-          uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
-          uint8_t *iv_ = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
-          memcpy(iv_, iv, iv_len * sizeof (uint8_t));
-          KRML_CHECK_SIZE(sizeof (EverCrypt_CTR_state_s), (uint32_t)1U);
-          EverCrypt_CTR_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_CTR_state_s));
-          p[0U]
-          =
-            (
-              (EverCrypt_CTR_state_s){
-                .i = vale_impl_of_alg(Spec_Cipher_Expansion_cipher_alg_of_impl(Spec_Cipher_Expansion_Vale_AES256)),
-                .iv = iv_,
-                .iv_len = iv_len,
-                .xkey = ek,
-                .ctr = c
-              }
-            );
-          *dst = p;
+          *dst = vale_impl_of_alg(a);
           return EverCrypt_Error_Success;
         }
         #endif
@@ -209,7 +152,96 @@ EverCrypt_CTR_create_in(
       }
     case Spec_Agile_Cipher_CHACHA20:
       {
-        uint8_t *ek = KRML_HOST_CALLOC((uint32_t)32U, sizeof (uint8_t));
+        *dst = Spec_Cipher_Expansion_Hacl_CHACHA20;
+        return EverCrypt_Error_Success;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+#define VALE_AES128_EK_LEN ((uint32_t)304U)
+
+#define VALE_AES256_EK_LEN ((uint32_t)368U)
+
+#define CHACHA20_EK_LEN ((uint32_t)32U)
+
+EverCrypt_Error_error_code
+EverCrypt_CTR_create_in(
+  Spec_Agile_Cipher_cipher_alg a,
+  EverCrypt_CTR_state_s **dst,
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t c
+)
+{
+  Spec_Cipher_Expansion_impl i;
+  EverCrypt_Error_error_code r = impl_of_cipher_alg(a, iv_len, &i);
+  if (r != EverCrypt_Error_Success)
+  {
+    return r;
+  }
+  switch (i)
+  {
+    #if EVERCRYPT_TARGETCONFIG_X64
+    case Spec_Cipher_Expansion_Vale_AES128:
+      {
+        uint8_t *ek = KRML_HOST_CALLOC(VALE_AES128_EK_LEN, sizeof (uint8_t));
+        uint8_t *keys_b = ek;
+        uint8_t *hkeys_b = ek + (uint32_t)176U;
+        uint64_t scrut = aes128_key_expansion(k, keys_b);
+        uint64_t scrut0 = aes128_keyhash_init(keys_b, hkeys_b);
+        uint8_t *iv_ = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
+        memcpy(iv_, iv, iv_len * sizeof (uint8_t));
+        KRML_CHECK_SIZE(sizeof (EverCrypt_CTR_state_s), (uint32_t)1U);
+        EverCrypt_CTR_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_CTR_state_s));
+        p[0U]
+        =
+          (
+            (EverCrypt_CTR_state_s){
+              .i = i,
+              .iv = iv_,
+              .iv_len = iv_len,
+              .xkey = ek,
+              .ctr = c
+            }
+          );
+        *dst = p;
+        return EverCrypt_Error_Success;
+      }
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        uint8_t *ek = KRML_HOST_CALLOC(VALE_AES256_EK_LEN, sizeof (uint8_t));
+        uint8_t *keys_b = ek;
+        uint8_t *hkeys_b = ek + (uint32_t)240U;
+        uint64_t scrut = aes256_key_expansion(k, keys_b);
+        uint64_t scrut0 = aes256_keyhash_init(keys_b, hkeys_b);
+        uint8_t *iv_ = KRML_HOST_CALLOC((uint32_t)16U, sizeof (uint8_t));
+        memcpy(iv_, iv, iv_len * sizeof (uint8_t));
+        KRML_CHECK_SIZE(sizeof (EverCrypt_CTR_state_s), (uint32_t)1U);
+        EverCrypt_CTR_state_s *p = KRML_HOST_MALLOC(sizeof (EverCrypt_CTR_state_s));
+        p[0U]
+        =
+          (
+            (EverCrypt_CTR_state_s){
+              .i = i,
+              .iv = iv_,
+              .iv_len = iv_len,
+              .xkey = ek,
+              .ctr = c
+            }
+          );
+        *dst = p;
+        return EverCrypt_Error_Success;
+      }
+    #endif
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        uint8_t *ek = KRML_HOST_CALLOC(CHACHA20_EK_LEN, sizeof (uint8_t));
         memcpy(ek, k, (uint32_t)32U * sizeof (uint8_t));
         KRML_CHECK_SIZE(sizeof (uint8_t), iv_len);
         uint8_t *iv_ = KRML_HOST_CALLOC(iv_len, sizeof (uint8_t));
@@ -288,6 +320,58 @@ EverCrypt_CTR_init(
   *p = ((EverCrypt_CTR_state_s){ .i = i, .iv = iv_, .iv_len = iv_len, .xkey = ek, .ctr = c });
 }
 
+/*
+  mem holds the state header, an IV of at most CTR_IN_PLACE_IV_LEN bytes and
+  the expanded key (largest for AES-256); EverCrypt_CTR_init then fills them in.
+*/
+#define CTR_IN_PLACE_IV ((uint32_t)48U)
+
+#define CTR_IN_PLACE_IV_LEN ((uint32_t)16U)
+
+#define CTR_IN_PLACE_EK ((uint32_t)64U)
+
+_Static_assert(sizeof (EverCrypt_CTR_state_s) <= CTR_IN_PLACE_IV, "CTR state header");
+
+_Static_assert(CTR_IN_PLACE_IV + CTR_IN_PLACE_IV_LEN <= CTR_IN_PLACE_EK, "CTR IV in place");
+
+_Static_assert(CTR_IN_PLACE_EK % (uint32_t)16U == 0U, "CTR key alignment");
+
+_Static_assert(VALE_AES128_EK_LEN <= VALE_AES256_EK_LEN && CHACHA20_EK_LEN <= VALE_AES256_EK_LEN
+  && CTR_IN_PLACE_EK + VALE_AES256_EK_LEN <= EverCrypt_CTR_state_len,
+  "CTR key in place");
+
+EverCrypt_Error_error_code
+EverCrypt_CTR_init_in_place(
+  Spec_Agile_Cipher_cipher_alg a,
+  EverCrypt_CTR_state_s **dst,
+  uint8_t *mem,
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t c
+)
+{
+  if (iv_len > CTR_IN_PLACE_IV_LEN)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  Spec_Cipher_Expansion_impl i;
+  EverCrypt_Error_error_code r = impl_of_cipher_alg(a, iv_len, &i);
+  if (r != EverCrypt_Error_Success)
+  {
+    return r;
+  }
+  uint8_t *iv_ = mem + CTR_IN_PLACE_IV;
+  uint8_t *ek = mem + CTR_IN_PLACE_EK;
+  memset(iv_, 0U, CTR_IN_PLACE_IV_LEN * sizeof (uint8_t));
+  memset(ek, 0U, VALE_AES256_EK_LEN * sizeof (uint8_t));
+  EverCrypt_CTR_state_s *p = (EverCrypt_CTR_state_s *)mem;
+  p[0U] = ((EverCrypt_CTR_state_s){ .i = i, .iv = iv_, .iv_len = iv_len, .xkey = ek, .ctr = c });
+  EverCrypt_CTR_init(p, k, iv, iv_len, c);
+  *dst = p;
+  return EverCrypt_Error_Success;
+}
+
 void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src)
 {
   EverCrypt_CTR_state_s scrut = *p;
@@ -412,6 +496,146 @@ void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t
   }
 }
 
+/*
+  Runs of AES blocks are passed to the Vale kernel in one call, with the counter
+  block computed as in update_block. The kernel only increments the low 32 bits
+  of the counter block, so a run is split where those would wrap around.
+*/
+static void
+vale_gctr(
+  Spec_Cipher_Expansion_impl i,
+  uint8_t *ek,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t c,
+  uint32_t len,
+  uint8_t *dst,
+  uint8_t *src
+)
+{
+  #if EVERCRYPT_TARGETCONFIG_X64
+  uint8_t ctr_block[16U] = { 0U };
+  memcpy(ctr_block, iv, iv_len * sizeof (uint8_t));
+  FStar_UInt128_uint128 uu____0 = load128_be(ctr_block);
+  FStar_UInt128_uint128
+  ctr = FStar_UInt128_add_mod(uu____0, FStar_UInt128_uint64_to_uint128((uint64_t)c));
+  uint64_t before_wrap = (uint64_t)0x100000000U - (FStar_UInt128_uint128_to_uint64(ctr) & (uint64_t)0xffffffffU);
+  uint32_t num_blocks = len / (uint32_t)16U;
+  uint32_t rem = len % (uint32_t)16U;
+  uint64_t total_blocks = (uint64_t)num_blocks + (uint64_t)(rem != (uint32_t)0U);
+  if (total_blocks > before_wrap)
+  {
+    uint32_t len0 = (uint32_t)before_wrap * (uint32_t)16U;
+    vale_gctr(i, ek, iv, iv_len, c, len0, dst, src);
+    vale_gctr(i, ek, iv, iv_len, c + (uint32_t)before_wrap, len - len0, dst + len0, src + len0);
+    return;
+  }
+  store128_le(ctr_block, ctr);
+  uint8_t inout_b[16U] = { 0U };
+  uint32_t num_bytes_ = num_blocks * (uint32_t)16U;
+  memcpy(inout_b, src + num_bytes_, rem * sizeof (uint8_t));
+  if (i == Spec_Cipher_Expansion_Vale_AES128)
+  {
+    uint64_t
+    scrut =
+      gctr128_bytes(src,
+        (uint64_t)len,
+        dst,
+        inout_b,
+        ek,
+        ctr_block,
+        (uint64_t)num_blocks);
+  }
+  else
+  {
+    uint64_t
+    scrut =
+      gctr256_bytes(src,
+        (uint64_t)len,
+        dst,
+        inout_b,
+        ek,
+        ctr_block,
+        (uint64_t)num_blocks);
+  }
+  memcpy(dst + num_bytes_, inout_b, rem * sizeof (uint8_t));
+  #endif
+}
+
+/*
+  The vectorized ChaCha20 implementations process 4, 8 or 16 blocks at a time
+  and pad shorter inputs, so they are only picked for lengths that fill a
+  round.
+*/
+static void
+chacha20_encrypt(uint32_t len, uint8_t *dst, uint8_t *src, uint8_t *ek, uint8_t *iv, uint32_t c)
+{
+  bool avx512 = EverCrypt_AutoConfig2_has_avx512();
+  bool avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool avx = EverCrypt_AutoConfig2_has_avx();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx512 && len >= (uint32_t)1024U)
+  {
+    Hacl_Chacha20_Vec512_chacha20_encrypt_512(len, dst, src, ek, iv, c);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx2 && len >= (uint32_t)512U)
+  {
+    Hacl_Chacha20_Vec256_chacha20_encrypt_256(len, dst, src, ek, iv, c);
+    return;
+  }
+  #endif
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (avx && len >= (uint32_t)256U)
+  {
+    Hacl_Chacha20_Vec128_chacha20_encrypt_128(len, dst, src, ek, iv, c);
+    return;
+  }
+  #endif
+  Hacl_Chacha20_chacha20_encrypt(len, dst, src, ek, iv, c);
+}
+
+void
+EverCrypt_CTR_update_blocks(
+  EverCrypt_CTR_state_s *p,
+  uint8_t *dst,
+  uint8_t *src,
+  uint32_t len
+)
+{
+  EverCrypt_CTR_state_s scrut = *p;
+  Spec_Cipher_Expansion_impl i = scrut.i;
+  uint8_t *iv = scrut.iv;
+  uint32_t iv_len = scrut.iv_len;
+  uint8_t *ek = scrut.xkey;
+  uint32_t c0 = scrut.ctr;
+  switch (i)
+  {
+    case Spec_Cipher_Expansion_Vale_AES128:
+    case Spec_Cipher_Expansion_Vale_AES256:
+      {
+        vale_gctr(i, ek, iv, iv_len, c0, len, dst, src);
+        uint32_t c1 = c0 + (len + (uint32_t)15U) / (uint32_t)16U;
+        *p = ((EverCrypt_CTR_state_s){ .i = i, .iv = iv, .iv_len = iv_len, .xkey = ek, .ctr = c1 });
+        break;
+      }
+    case Spec_Cipher_Expansion_Hacl_CHACHA20:
+      {
+        chacha20_encrypt(len, dst, src, ek, iv, c0);
+        uint32_t c1 = c0 + (len + (uint32_t)63U) / (uint32_t)64U;
+        *p = ((EverCrypt_CTR_state_s){ .i = i, .iv = iv, .iv_len = iv_len, .xkey = ek, .ctr = c1 });
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
 void EverCrypt_CTR_free(EverCrypt_CTR_state_s *p)
 {
   EverCrypt_CTR_state_s scrut = *p;
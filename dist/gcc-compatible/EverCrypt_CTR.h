@@ -38,6 +38,9 @@ extern "C" {
 
 
 #include "Hacl_Chacha20.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20_Vec512.h"
 #include "Hacl_Kremlib.h"
 #include "Vale.h"
 #include "EverCrypt_AutoConfig2.h"
@@ -106,8 +109,49 @@ EverCrypt_CTR_init(
   uint32_t c
 );
 
+/*
+  Size and alignment of the caller-provided storage for
+  EverCrypt_CTR_init_in_place, valid for every cipher.
+*/
+#define EverCrypt_CTR_state_len ((uint32_t)432U)
+
+#define EverCrypt_CTR_state_align ((uint32_t)16U)
+
+/*
+  Same as EverCrypt_CTR_create_in, but the state, IV and expanded key are laid
+  out in mem (EverCrypt_CTR_state_len bytes aligned on EverCrypt_CTR_state_align)
+  and iv_len must not exceed 16. The state can be re-keyed with EverCrypt_CTR_init
+  as usual; it must not be passed to EverCrypt_CTR_free.
+*/
+EverCrypt_Error_error_code
+EverCrypt_CTR_init_in_place(
+  Spec_Agile_Cipher_cipher_alg a,
+  EverCrypt_CTR_state_s **dst,
+  uint8_t *mem,
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint32_t c
+);
+
 void EverCrypt_CTR_update_block(EverCrypt_CTR_state_s *p, uint8_t *dst, uint8_t *src);
 
+/*
+  Encrypts (or decrypts) len bytes of src into dst, starting at the current block
+  counter, and advances the counter past every block touched. The whole run goes
+  to a single multi-block kernel; the last block may be partial, in which case the
+  rest of its keystream is discarded, so a stream split across several calls must
+  use multiples of the block size (16 bytes for AES, 64 for ChaCha20) for all but
+  the last call. dst and src may be equal.
+*/
+void
+EverCrypt_CTR_update_blocks(
+  EverCrypt_CTR_state_s *p,
+  uint8_t *dst,
+  uint8_t *src,
+  uint32_t len
+);
+
 void EverCrypt_CTR_free(EverCrypt_CTR_state_s *p);
 
 #if defined(__cplusplus)
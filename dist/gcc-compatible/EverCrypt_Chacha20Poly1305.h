@@ -41,6 +41,7 @@ extern "C" {
 #include "Hacl_Chacha20Poly1305_128.h"
 #include "Hacl_Chacha20Poly1305_32.h"
 #include "Hacl_Chacha20Poly1305_256.h"
+#include "Hacl_Chacha20Poly1305_512.h"
 
 void
 EverCrypt_Chacha20Poly1305_aead_encrypt(
@@ -54,6 +55,11 @@ EverCrypt_Chacha20Poly1305_aead_encrypt(
   uint8_t *tag
 );
 
+/*
+  Returns 0 on success. On failure (1), m is zeroed on every machine: the
+  stitched AVX2 code produces the plaintext in the same pass as the tag, and
+  the other backends are made to behave the same.
+*/
 uint32_t
 EverCrypt_Chacha20Poly1305_aead_decrypt(
   uint8_t *k,
@@ -272,6 +272,96 @@ EverCrypt_DRBG_state_s *EverCrypt_DRBG_create(Spec_Hash_Definitions_hash_alg a)
   return buf;
 }
 
+/*
+  Layout of mem: the tagged state, then k and v (DRBG_IN_PLACE_KV_LEN bytes
+  each, the largest hash length), then the reseed counter.
+*/
+#define DRBG_IN_PLACE_K ((uint32_t)32U)
+
+#define DRBG_IN_PLACE_V ((uint32_t)96U)
+
+#define DRBG_IN_PLACE_CTR ((uint32_t)160U)
+
+#define DRBG_IN_PLACE_KV_LEN ((uint32_t)64U)
+
+_Static_assert(sizeof (EverCrypt_DRBG_state_s) <= DRBG_IN_PLACE_K, "DRBG state header");
+
+_Static_assert(DRBG_IN_PLACE_K + DRBG_IN_PLACE_KV_LEN <= DRBG_IN_PLACE_V, "DRBG k in place");
+
+_Static_assert(DRBG_IN_PLACE_V + DRBG_IN_PLACE_KV_LEN <= DRBG_IN_PLACE_CTR, "DRBG v in place");
+
+_Static_assert(DRBG_IN_PLACE_CTR % sizeof (uint32_t) == 0U, "DRBG reseed counter alignment");
+
+_Static_assert(DRBG_IN_PLACE_CTR + sizeof (uint32_t) <= EverCrypt_DRBG_state_len,
+  "DRBG reseed counter in place");
+
+EverCrypt_DRBG_state_s
+*EverCrypt_DRBG_init_in_place(Spec_Hash_Definitions_hash_alg a, uint8_t *mem)
+{
+  uint8_t *k = mem + DRBG_IN_PLACE_K;
+  uint8_t *v = mem + DRBG_IN_PLACE_V;
+  uint32_t *ctr = (uint32_t *)(mem + DRBG_IN_PLACE_CTR);
+  memset(k, 0U, DRBG_IN_PLACE_KV_LEN * sizeof (uint8_t));
+  memset(v, 0U, DRBG_IN_PLACE_KV_LEN * sizeof (uint8_t));
+  ctr[0U] = (uint32_t)1U;
+  EverCrypt_DRBG_state_s st;
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        st =
+          (
+            (EverCrypt_DRBG_state_s){
+              .tag = EverCrypt_DRBG_SHA1_s,
+              { .case_SHA1_s = { .k = k, .v = v, .reseed_counter = ctr } }
+            }
+          );
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        st =
+          (
+            (EverCrypt_DRBG_state_s){
+              .tag = EverCrypt_DRBG_SHA2_256_s,
+              { .case_SHA2_256_s = { .k = k, .v = v, .reseed_counter = ctr } }
+            }
+          );
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        st =
+          (
+            (EverCrypt_DRBG_state_s){
+              .tag = EverCrypt_DRBG_SHA2_384_s,
+              { .case_SHA2_384_s = { .k = k, .v = v, .reseed_counter = ctr } }
+            }
+          );
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        st =
+          (
+            (EverCrypt_DRBG_state_s){
+              .tag = EverCrypt_DRBG_SHA2_512_s,
+              { .case_SHA2_512_s = { .k = k, .v = v, .reseed_counter = ctr } }
+            }
+          );
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  EverCrypt_DRBG_state_s *p = (EverCrypt_DRBG_state_s *)mem;
+  p[0U] = st;
+  return p;
+}
+
 bool
 EverCrypt_DRBG_instantiate_sha1(
   EverCrypt_DRBG_state_s *st,
@@ -1126,19 +1216,22 @@ EverCrypt_DRBG_generate_sha1(
       }
     }
     uint8_t *output1 = output;
+    EverCrypt_HMAC_key_state hk;
+    EverCrypt_HMAC_key_state_init(&hk, Spec_Hash_Definitions_SHA1, k, (uint32_t)20U);
     uint32_t max = n / (uint32_t)20U;
     uint8_t *out = output1;
     for (uint32_t i = (uint32_t)0U; i < max; i++)
     {
-      EverCrypt_HMAC_compute_sha1(v, k, (uint32_t)20U, v, (uint32_t)20U);
+      EverCrypt_HMAC_key_state_compute(&hk, v, v, (uint32_t)20U);
       memcpy(out + i * (uint32_t)20U, v, (uint32_t)20U * sizeof (uint8_t));
     }
     if (max * (uint32_t)20U < n)
     {
       uint8_t *block = output1 + max * (uint32_t)20U;
-      EverCrypt_HMAC_compute_sha1(v, k, (uint32_t)20U, v, (uint32_t)20U);
+      EverCrypt_HMAC_key_state_compute(&hk, v, v, (uint32_t)20U);
       memcpy(block, v, (n - max * (uint32_t)20U) * sizeof (uint8_t));
     }
+    Lib_Memzero0_memzero(&hk, sizeof (hk));
     uint32_t input_len = (uint32_t)21U + additional_input_len;
     KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
     uint8_t input0[input_len];
@@ -1347,19 +1440,22 @@ EverCrypt_DRBG_generate_sha2_256(
       }
     }
     uint8_t *output1 = output;
+    EverCrypt_HMAC_key_state hk;
+    EverCrypt_HMAC_key_state_init(&hk, Spec_Hash_Definitions_SHA2_256, k, (uint32_t)32U);
     uint32_t max = n / (uint32_t)32U;
     uint8_t *out = output1;
     for (uint32_t i = (uint32_t)0U; i < max; i++)
     {
-      EverCrypt_HMAC_compute_sha2_256(v, k, (uint32_t)32U, v, (uint32_t)32U);
+      EverCrypt_HMAC_key_state_compute(&hk, v, v, (uint32_t)32U);
       memcpy(out + i * (uint32_t)32U, v, (uint32_t)32U * sizeof (uint8_t));
     }
     if (max * (uint32_t)32U < n)
     {
       uint8_t *block = output1 + max * (uint32_t)32U;
-      EverCrypt_HMAC_compute_sha2_256(v, k, (uint32_t)32U, v, (uint32_t)32U);
+      EverCrypt_HMAC_key_state_compute(&hk, v, v, (uint32_t)32U);
       memcpy(block, v, (n - max * (uint32_t)32U) * sizeof (uint8_t));
     }
+    Lib_Memzero0_memzero(&hk, sizeof (hk));
     uint32_t input_len = (uint32_t)33U + additional_input_len;
     KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
     uint8_t input0[input_len];
@@ -1568,19 +1664,22 @@ EverCrypt_DRBG_generate_sha2_384(
       }
     }
     uint8_t *output1 = output;
+    EverCrypt_HMAC_key_state hk;
+    EverCrypt_HMAC_key_state_init(&hk, Spec_Hash_Definitions_SHA2_384, k, (uint32_t)48U);
     uint32_t max = n / (uint32_t)48U;
     uint8_t *out = output1;
     for (uint32_t i = (uint32_t)0U; i < max; i++)
     {
-      EverCrypt_HMAC_compute_sha2_384(v, k, (uint32_t)48U, v, (uint32_t)48U);
+      EverCrypt_HMAC_key_state_compute(&hk, v, v, (uint32_t)48U);
       memcpy(out + i * (uint32_t)48U, v, (uint32_t)48U * sizeof (uint8_t));
     }
     if (max * (uint32_t)48U < n)
     {
       uint8_t *block = output1 + max * (uint32_t)48U;
-      EverCrypt_HMAC_compute_sha2_384(v, k, (uint32_t)48U, v, (uint32_t)48U);
+      EverCrypt_HMAC_key_state_compute(&hk, v, v, (uint32_t)48U);
       memcpy(block, v, (n - max * (uint32_t)48U) * sizeof (uint8_t));
     }
+    Lib_Memzero0_memzero(&hk, sizeof (hk));
     uint32_t input_len = (uint32_t)49U + additional_input_len;
     KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
     uint8_t input0[input_len];
@@ -1789,19 +1888,22 @@ EverCrypt_DRBG_generate_sha2_512(
       }
     }
     uint8_t *output1 = output;
+    EverCrypt_HMAC_key_state hk;
+    EverCrypt_HMAC_key_state_init(&hk, Spec_Hash_Definitions_SHA2_512, k, (uint32_t)64U);
     uint32_t max = n / (uint32_t)64U;
     uint8_t *out = output1;
     for (uint32_t i = (uint32_t)0U; i < max; i++)
     {
-      EverCrypt_HMAC_compute_sha2_512(v, k, (uint32_t)64U, v, (uint32_t)64U);
+      EverCrypt_HMAC_key_state_compute(&hk, v, v, (uint32_t)64U);
       memcpy(out + i * (uint32_t)64U, v, (uint32_t)64U * sizeof (uint8_t));
     }
     if (max * (uint32_t)64U < n)
     {
       uint8_t *block = output1 + max * (uint32_t)64U;
-      EverCrypt_HMAC_compute_sha2_512(v, k, (uint32_t)64U, v, (uint32_t)64U);
+      EverCrypt_HMAC_key_state_compute(&hk, v, v, (uint32_t)64U);
       memcpy(block, v, (n - max * (uint32_t)64U) * sizeof (uint8_t));
     }
+    Lib_Memzero0_memzero(&hk, sizeof (hk));
     uint32_t input_len = (uint32_t)65U + additional_input_len;
     KRML_CHECK_SIZE(sizeof (uint8_t), input_len);
     uint8_t input0[input_len];
@@ -2070,3 +2172,11 @@ void EverCrypt_DRBG_uninstantiate(EverCrypt_DRBG_state_s *st)
   KRML_HOST_EXIT(255U);
 }
 
+void EverCrypt_DRBG_uninstantiate_in_place(EverCrypt_DRBG_state_s *st)
+{
+  uint8_t *mem = (uint8_t *)st;
+  Lib_Memzero_clear_words_u8(DRBG_IN_PLACE_KV_LEN, mem + DRBG_IN_PLACE_K);
+  Lib_Memzero_clear_words_u8(DRBG_IN_PLACE_KV_LEN, mem + DRBG_IN_PLACE_V);
+  ((uint32_t *)(mem + DRBG_IN_PLACE_CTR))[0U] = (uint32_t)0U;
+}
+
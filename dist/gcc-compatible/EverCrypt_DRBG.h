@@ -116,6 +116,23 @@ EverCrypt_DRBG___proj__SHA2_512_s__item___0(
 
 EverCrypt_DRBG_state_s *EverCrypt_DRBG_create(Spec_Hash_Definitions_hash_alg a);
 
+/*
+  Size and alignment of the caller-provided storage for
+  EverCrypt_DRBG_init_in_place, valid for every hash algorithm.
+*/
+#define EverCrypt_DRBG_state_len ((uint32_t)168U)
+
+#define EverCrypt_DRBG_state_align ((uint32_t)8U)
+
+/*
+  Same as EverCrypt_DRBG_create, but the state lives in mem
+  (EverCrypt_DRBG_state_len bytes aligned on EverCrypt_DRBG_state_align). It is
+  instantiated and used as usual, and torn down with
+  EverCrypt_DRBG_uninstantiate_in_place rather than EverCrypt_DRBG_uninstantiate.
+*/
+EverCrypt_DRBG_state_s
+*EverCrypt_DRBG_init_in_place(Spec_Hash_Definitions_hash_alg a, uint8_t *mem);
+
 bool
 EverCrypt_DRBG_instantiate_sha1(
   EverCrypt_DRBG_state_s *st,
@@ -241,6 +258,12 @@ EverCrypt_DRBG_generate(
 
 void EverCrypt_DRBG_uninstantiate(EverCrypt_DRBG_state_s *st);
 
+/*
+  Zeroes the key, value and reseed counter of a state created with
+  EverCrypt_DRBG_init_in_place, without freeing anything.
+*/
+void EverCrypt_DRBG_uninstantiate_in_place(EverCrypt_DRBG_state_s *st);
+
 #if defined(__cplusplus)
 }
 #endif
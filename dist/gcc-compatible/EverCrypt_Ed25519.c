@@ -50,3 +50,16 @@ EverCrypt_Ed25519_sign_expanded(uint8_t *signature, uint8_t *ks, uint32_t len, u
   Hacl_Ed25519_sign_expanded(signature, ks, len, msg);
 }
 
+bool
+EverCrypt_Ed25519_verify_batch(
+  uint32_t n,
+  uint8_t **pub,
+  uint32_t *len,
+  uint8_t **msg,
+  uint8_t **signature,
+  bool *valid
+)
+{
+  return Hacl_Ed25519_verify_batch(n, pub, len, msg, signature, valid);
+}
+
@@ -50,6 +50,16 @@ void EverCrypt_Ed25519_expand_keys(uint8_t *ks, uint8_t *secret);
 void
 EverCrypt_Ed25519_sign_expanded(uint8_t *signature, uint8_t *ks, uint32_t len, uint8_t *msg);
 
+bool
+EverCrypt_Ed25519_verify_batch(
+  uint32_t n,
+  uint8_t **pub,
+  uint32_t *len,
+  uint8_t **msg,
+  uint8_t **signature,
+  bool *valid
+);
+
 #if defined(__cplusplus)
 }
 #endif
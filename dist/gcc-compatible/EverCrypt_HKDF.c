@@ -44,16 +44,18 @@ EverCrypt_HKDF_expand_sha1(
   uint8_t *tag = text;
   uint8_t *ctr = text + tlen + infolen;
   memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  EverCrypt_HMAC_key_state st;
+  EverCrypt_HMAC_key_state_init(&st, Spec_Hash_Definitions_SHA1, prk, prklen);
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
     ctr[0U] = (uint8_t)(i + (uint32_t)1U);
     if (i == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha1(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha1(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text, tlen + infolen + (uint32_t)1U);
     }
     memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
   }
@@ -62,15 +64,16 @@ EverCrypt_HKDF_expand_sha1(
     ctr[0U] = (uint8_t)(n + (uint32_t)1U);
     if (n == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha1(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha1(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text, tlen + infolen + (uint32_t)1U);
     }
     uint8_t *block = okm + n * tlen;
     memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
   }
+  Lib_Memzero0_memzero(&st, sizeof (st));
 }
 
 void
@@ -105,16 +108,18 @@ EverCrypt_HKDF_expand_sha2_256(
   uint8_t *tag = text;
   uint8_t *ctr = text + tlen + infolen;
   memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  EverCrypt_HMAC_key_state st;
+  EverCrypt_HMAC_key_state_init(&st, Spec_Hash_Definitions_SHA2_256, prk, prklen);
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
     ctr[0U] = (uint8_t)(i + (uint32_t)1U);
     if (i == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha2_256(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha2_256(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text, tlen + infolen + (uint32_t)1U);
     }
     memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
   }
@@ -123,15 +128,16 @@ EverCrypt_HKDF_expand_sha2_256(
     ctr[0U] = (uint8_t)(n + (uint32_t)1U);
     if (n == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha2_256(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha2_256(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text, tlen + infolen + (uint32_t)1U);
     }
     uint8_t *block = okm + n * tlen;
     memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
   }
+  Lib_Memzero0_memzero(&st, sizeof (st));
 }
 
 void
@@ -166,16 +172,18 @@ EverCrypt_HKDF_expand_sha2_384(
   uint8_t *tag = text;
   uint8_t *ctr = text + tlen + infolen;
   memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  EverCrypt_HMAC_key_state st;
+  EverCrypt_HMAC_key_state_init(&st, Spec_Hash_Definitions_SHA2_384, prk, prklen);
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
     ctr[0U] = (uint8_t)(i + (uint32_t)1U);
     if (i == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha2_384(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha2_384(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text, tlen + infolen + (uint32_t)1U);
     }
     memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
   }
@@ -184,15 +192,16 @@ EverCrypt_HKDF_expand_sha2_384(
     ctr[0U] = (uint8_t)(n + (uint32_t)1U);
     if (n == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha2_384(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha2_384(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text, tlen + infolen + (uint32_t)1U);
     }
     uint8_t *block = okm + n * tlen;
     memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
   }
+  Lib_Memzero0_memzero(&st, sizeof (st));
 }
 
 void
@@ -227,16 +236,18 @@ EverCrypt_HKDF_expand_sha2_512(
   uint8_t *tag = text;
   uint8_t *ctr = text + tlen + infolen;
   memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  EverCrypt_HMAC_key_state st;
+  EverCrypt_HMAC_key_state_init(&st, Spec_Hash_Definitions_SHA2_512, prk, prklen);
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
     ctr[0U] = (uint8_t)(i + (uint32_t)1U);
     if (i == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha2_512(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha2_512(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text, tlen + infolen + (uint32_t)1U);
     }
     memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
   }
@@ -245,15 +256,16 @@ EverCrypt_HKDF_expand_sha2_512(
     ctr[0U] = (uint8_t)(n + (uint32_t)1U);
     if (n == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_sha2_512(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_sha2_512(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text, tlen + infolen + (uint32_t)1U);
     }
     uint8_t *block = okm + n * tlen;
     memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
   }
+  Lib_Memzero0_memzero(&st, sizeof (st));
 }
 
 void
@@ -288,16 +300,18 @@ EverCrypt_HKDF_expand_blake2s(
   uint8_t *tag = text;
   uint8_t *ctr = text + tlen + infolen;
   memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  EverCrypt_HMAC_key_state st;
+  EverCrypt_HMAC_key_state_init(&st, Spec_Hash_Definitions_Blake2S, prk, prklen);
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
     ctr[0U] = (uint8_t)(i + (uint32_t)1U);
     if (i == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_blake2s(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_blake2s(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text, tlen + infolen + (uint32_t)1U);
     }
     memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
   }
@@ -306,15 +320,16 @@ EverCrypt_HKDF_expand_blake2s(
     ctr[0U] = (uint8_t)(n + (uint32_t)1U);
     if (n == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_blake2s(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_blake2s(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text, tlen + infolen + (uint32_t)1U);
     }
     uint8_t *block = okm + n * tlen;
     memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
   }
+  Lib_Memzero0_memzero(&st, sizeof (st));
 }
 
 void
@@ -349,16 +364,18 @@ EverCrypt_HKDF_expand_blake2b(
   uint8_t *tag = text;
   uint8_t *ctr = text + tlen + infolen;
   memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  EverCrypt_HMAC_key_state st;
+  EverCrypt_HMAC_key_state_init(&st, Spec_Hash_Definitions_Blake2B, prk, prklen);
   for (uint32_t i = (uint32_t)0U; i < n; i++)
   {
     ctr[0U] = (uint8_t)(i + (uint32_t)1U);
     if (i == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_blake2b(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_blake2b(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text, tlen + infolen + (uint32_t)1U);
     }
     memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
   }
@@ -367,15 +384,16 @@ EverCrypt_HKDF_expand_blake2b(
     ctr[0U] = (uint8_t)(n + (uint32_t)1U);
     if (n == (uint32_t)0U)
     {
-      EverCrypt_HMAC_compute_blake2b(tag, prk, prklen, text0, infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text0, infolen + (uint32_t)1U);
     }
     else
     {
-      EverCrypt_HMAC_compute_blake2b(tag, prk, prklen, text, tlen + infolen + (uint32_t)1U);
+      EverCrypt_HMAC_key_state_compute(&st, tag, text, tlen + infolen + (uint32_t)1U);
     }
     uint8_t *block = okm + n * tlen;
     memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
   }
+  Lib_Memzero0_memzero(&st, sizeof (st));
 }
 
 void
@@ -491,6 +509,453 @@ EverCrypt_HKDF_extract(
   }
 }
 
+/*
+  SHA2-256 HMAC over up to eight lanes. The pad midstates of every key are
+  obtained by compressing the ipad and opad blocks of all lanes together. The
+  full blocks of each message are hashed in place over all lanes, and only the
+  padded last one or two blocks are copied to a fixed-size buffer; all scratch
+  buffers are wiped before returning.
+*/
+
+static void
+key_states_sha2_256_many(
+  uint32_t n,
+  EverCrypt_HMAC_key_state *ks,
+  uint8_t **key,
+  uint32_t key_len
+)
+{
+  uint8_t opad[8U * 64U];
+  uint32_t *inner[8U];
+  uint32_t *outer[8U];
+  uint8_t *ipads[8U];
+  uint8_t *opads[8U];
+  for (uint32_t l = (uint32_t)0U; l < n; l++)
+  {
+    uint8_t key_block[64U] = { 0U };
+    if (key_len <= (uint32_t)64U)
+    {
+      memcpy(key_block, key[l], key_len * sizeof (uint8_t));
+    }
+    else
+    {
+      EverCrypt_Hash_hash_256(key[l], key_len, key_block);
+    }
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+    {
+      ks[l].ipad[i] = (uint8_t)0x36U ^ key_block[i];
+      opad[l * (uint32_t)64U + i] = (uint8_t)0x5cU ^ key_block[i];
+    }
+    Lib_Memzero0_memzero(key_block, (uint32_t)64U * sizeof (key_block[0U]));
+    ks[l].alg = Spec_Hash_Definitions_SHA2_256;
+    inner[l] = (uint32_t *)ks[l].inner;
+    outer[l] = (uint32_t *)ks[l].outer;
+    ipads[l] = ks[l].ipad;
+    opads[l] = opad + l * (uint32_t)64U;
+    Hacl_Hash_Core_SHA2_init_256(inner[l]);
+    Hacl_Hash_Core_SHA2_init_256(outer[l]);
+  }
+  EverCrypt_Hash_update_multi_256_many(n, inner, ipads, (uint32_t)1U);
+  EverCrypt_Hash_update_multi_256_many(n, outer, opads, (uint32_t)1U);
+  Lib_Memzero0_memzero(opad, (uint32_t)(8U * 64U) * sizeof (opad[0U]));
+}
+
+static void
+hmac_sha2_256_many(
+  uint32_t n,
+  EverCrypt_HMAC_key_state *ks,
+  uint8_t **data,
+  uint32_t data_len,
+  uint8_t **dst
+)
+{
+  uint32_t n_full = data_len / (uint32_t)64U;
+  uint32_t rem = data_len % (uint32_t)64U;
+  uint32_t n_last = (uint32_t)1U;
+  if (rem + (uint32_t)9U > (uint32_t)64U)
+  {
+    n_last = (uint32_t)2U;
+  }
+  uint8_t last[8U * 128U] = { 0U };
+  uint8_t outer_blocks[8U * 64U] = { 0U };
+  uint32_t st[8U * 8U] = { 0U };
+  uint32_t *sts[8U];
+  uint8_t *blocks[8U];
+  for (uint32_t l = (uint32_t)0U; l < n; l++)
+  {
+    sts[l] = st + l * (uint32_t)8U;
+    blocks[l] = data[l];
+    memcpy(sts[l], ks[l].inner, (uint32_t)8U * sizeof (uint32_t));
+  }
+  /* The full blocks are hashed in place; only the padded tail is copied. */
+  if (n_full > (uint32_t)0U)
+  {
+    EverCrypt_Hash_update_multi_256_many(n, sts, blocks, n_full);
+  }
+  for (uint32_t l = (uint32_t)0U; l < n; l++)
+  {
+    uint8_t *b = last + l * (uint32_t)128U;
+    memcpy(b, data[l] + n_full * (uint32_t)64U, rem * sizeof (uint8_t));
+    b[rem] = (uint8_t)0x80U;
+    store64_be(b + n_last * (uint32_t)64U - (uint32_t)8U,
+      ((uint64_t)data_len + (uint64_t)64U) << (uint32_t)3U);
+    blocks[l] = b;
+  }
+  EverCrypt_Hash_update_multi_256_many(n, sts, blocks, n_last);
+  for (uint32_t l = (uint32_t)0U; l < n; l++)
+  {
+    uint8_t *b = outer_blocks + l * (uint32_t)64U;
+    Hacl_Hash_Core_SHA2_finish_256(sts[l], b);
+    b[32U] = (uint8_t)0x80U;
+    store64_be(b + (uint32_t)56U, (uint64_t)(96U * 8U));
+    blocks[l] = b;
+    memcpy(sts[l], ks[l].outer, (uint32_t)8U * sizeof (uint32_t));
+  }
+  EverCrypt_Hash_update_multi_256_many(n, sts, blocks, (uint32_t)1U);
+  for (uint32_t l = (uint32_t)0U; l < n; l++)
+  {
+    Hacl_Hash_Core_SHA2_finish_256(sts[l], dst[l]);
+  }
+  Lib_Memzero0_memzero(last, (uint32_t)(8U * 128U) * sizeof (last[0U]));
+  Lib_Memzero0_memzero(outer_blocks, (uint32_t)(8U * 64U) * sizeof (outer_blocks[0U]));
+  Lib_Memzero0_memzero(st, (uint32_t)(8U * 8U) * sizeof (st[0U]));
+}
+
+static void
+expand_sha2_256_many(
+  uint32_t n,
+  uint8_t **okm,
+  uint8_t **prk,
+  uint32_t prklen,
+  uint8_t **info,
+  uint32_t infolen,
+  uint32_t len
+)
+{
+  uint32_t tlen = (uint32_t)32U;
+  uint32_t text_len = tlen + infolen + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)8U * text_len);
+  uint8_t text[(uint32_t)8U * text_len];
+  memset(text, 0U, (uint32_t)8U * text_len * sizeof (uint8_t));
+  EverCrypt_HMAC_key_state ks[8U];
+  uint8_t *texts[8U];
+  uint8_t *tags[8U];
+  key_states_sha2_256_many(n, ks, prk, prklen);
+  for (uint32_t l = (uint32_t)0U; l < n; l++)
+  {
+    tags[l] = text + l * text_len;
+    memcpy(tags[l] + tlen, info[l], infolen * sizeof (uint8_t));
+  }
+  for (uint32_t i = (uint32_t)0U; i * tlen < len; i++)
+  {
+    uint32_t t_len = tlen;
+    if (i == (uint32_t)0U)
+    {
+      t_len = (uint32_t)0U;
+    }
+    for (uint32_t l = (uint32_t)0U; l < n; l++)
+    {
+      tags[l][tlen + infolen] = (uint8_t)(i + (uint32_t)1U);
+      texts[l] = tags[l] + tlen - t_len;
+    }
+    hmac_sha2_256_many(n, ks, texts, t_len + infolen + (uint32_t)1U, tags);
+    uint32_t out_len = len - i * tlen;
+    if (out_len > tlen)
+    {
+      out_len = tlen;
+    }
+    for (uint32_t l = (uint32_t)0U; l < n; l++)
+    {
+      memcpy(okm[l] + i * tlen, tags[l], out_len * sizeof (uint8_t));
+    }
+  }
+  Lib_Memzero0_memzero(text, (uint32_t)8U * text_len * sizeof (text[0U]));
+  Lib_Memzero0_memzero(ks, sizeof (ks));
+}
+
+/*
+  The same for SHA2-384 and SHA2-512 (which differ only in their initial state
+  and in the length of the tag) over up to four lanes, with 128-byte blocks and
+  a 128-bit length in the padding.
+*/
+
+static void
+key_states_sha2_512_many(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  EverCrypt_HMAC_key_state *ks,
+  uint8_t **key,
+  uint32_t key_len
+)
+{
+  uint8_t opad[4U * 128U];
+  uint64_t *inner[4U];
+  uint64_t *outer[4U];
+  uint8_t *ipads[4U];
+  uint8_t *opads[4U];
+  for (uint32_t l = (uint32_t)0U; l < n; l++)
+  {
+    uint8_t key_block[128U] = { 0U };
+    if (key_len <= (uint32_t)128U)
+    {
+      memcpy(key_block, key[l], key_len * sizeof (uint8_t));
+    }
+    else if (a == Spec_Hash_Definitions_SHA2_384)
+    {
+      EverCrypt_Hash_hash_384(key[l], key_len, key_block);
+    }
+    else
+    {
+      EverCrypt_Hash_hash_512(key[l], key_len, key_block);
+    }
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)128U; i++)
+    {
+      ks[l].ipad[i] = (uint8_t)0x36U ^ key_block[i];
+      opad[l * (uint32_t)128U + i] = (uint8_t)0x5cU ^ key_block[i];
+    }
+    Lib_Memzero0_memzero(key_block, (uint32_t)128U * sizeof (key_block[0U]));
+    ks[l].alg = a;
+    inner[l] = ks[l].inner;
+    outer[l] = ks[l].outer;
+    ipads[l] = ks[l].ipad;
+    opads[l] = opad + l * (uint32_t)128U;
+    if (a == Spec_Hash_Definitions_SHA2_384)
+    {
+      Hacl_Hash_Core_SHA2_init_384(inner[l]);
+      Hacl_Hash_Core_SHA2_init_384(outer[l]);
+    }
+    else
+    {
+      Hacl_Hash_Core_SHA2_init_512(inner[l]);
+      Hacl_Hash_Core_SHA2_init_512(outer[l]);
+    }
+  }
+  EverCrypt_Hash_update_multi_512_many(n, inner, ipads, (uint32_t)1U);
+  EverCrypt_Hash_update_multi_512_many(n, outer, opads, (uint32_t)1U);
+  Lib_Memzero0_memzero(opad, (uint32_t)(4U * 128U) * sizeof (opad[0U]));
+}
+
+static void finish_sha2_512(Spec_Hash_Definitions_hash_alg a, uint64_t *s, uint8_t *dst)
+{
+  if (a == Spec_Hash_Definitions_SHA2_384)
+  {
+    Hacl_Hash_Core_SHA2_finish_384(s, dst);
+  }
+  else
+  {
+    Hacl_Hash_Core_SHA2_finish_512(s, dst);
+  }
+}
+
+static void
+hmac_sha2_512_many(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  EverCrypt_HMAC_key_state *ks,
+  uint8_t **data,
+  uint32_t data_len,
+  uint8_t **dst
+)
+{
+  uint32_t tlen = Hacl_Hash_Definitions_hash_len(a);
+  uint32_t n_full = data_len / (uint32_t)128U;
+  uint32_t rem = data_len % (uint32_t)128U;
+  uint32_t n_last = (uint32_t)1U;
+  if (rem + (uint32_t)17U > (uint32_t)128U)
+  {
+    n_last = (uint32_t)2U;
+  }
+  uint8_t last[4U * 256U] = { 0U };
+  uint8_t outer_blocks[4U * 128U] = { 0U };
+  uint64_t st[4U * 8U] = { 0U };
+  uint64_t *sts[4U];
+  uint8_t *blocks[4U];
+  for (uint32_t l = (uint32_t)0U; l < n; l++)
+  {
+    sts[l] = st + l * (uint32_t)8U;
+    blocks[l] = data[l];
+    memcpy(sts[l], ks[l].inner, (uint32_t)8U * sizeof (uint64_t));
+  }
+  /* The full blocks are hashed in place; only the padded tail is copied. */
+  if (n_full > (uint32_t)0U)
+  {
+    EverCrypt_Hash_update_multi_512_many(n, sts, blocks, n_full);
+  }
+  for (uint32_t l = (uint32_t)0U; l < n; l++)
+  {
+    uint8_t *b = last + l * (uint32_t)256U;
+    memcpy(b, data[l] + n_full * (uint32_t)128U, rem * sizeof (uint8_t));
+    b[rem] = (uint8_t)0x80U;
+    store64_be(b + n_last * (uint32_t)128U - (uint32_t)8U,
+      ((uint64_t)data_len + (uint64_t)128U) << (uint32_t)3U);
+    blocks[l] = b;
+  }
+  EverCrypt_Hash_update_multi_512_many(n, sts, blocks, n_last);
+  for (uint32_t l = (uint32_t)0U; l < n; l++)
+  {
+    uint8_t *b = outer_blocks + l * (uint32_t)128U;
+    finish_sha2_512(a, sts[l], b);
+    b[tlen] = (uint8_t)0x80U;
+    store64_be(b + (uint32_t)120U, (uint64_t)(tlen + (uint32_t)128U) << (uint32_t)3U);
+    blocks[l] = b;
+    memcpy(sts[l], ks[l].outer, (uint32_t)8U * sizeof (uint64_t));
+  }
+  EverCrypt_Hash_update_multi_512_many(n, sts, blocks, (uint32_t)1U);
+  for (uint32_t l = (uint32_t)0U; l < n; l++)
+  {
+    finish_sha2_512(a, sts[l], dst[l]);
+  }
+  Lib_Memzero0_memzero(last, (uint32_t)(4U * 256U) * sizeof (last[0U]));
+  Lib_Memzero0_memzero(outer_blocks, (uint32_t)(4U * 128U) * sizeof (outer_blocks[0U]));
+  Lib_Memzero0_memzero(st, (uint32_t)(4U * 8U) * sizeof (st[0U]));
+}
+
+static void
+expand_sha2_512_many(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **okm,
+  uint8_t **prk,
+  uint32_t prklen,
+  uint8_t **info,
+  uint32_t infolen,
+  uint32_t len
+)
+{
+  uint32_t tlen = Hacl_Hash_Definitions_hash_len(a);
+  uint32_t text_len = tlen + infolen + (uint32_t)1U;
+  KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)4U * text_len);
+  uint8_t text[(uint32_t)4U * text_len];
+  memset(text, 0U, (uint32_t)4U * text_len * sizeof (uint8_t));
+  EverCrypt_HMAC_key_state ks[4U];
+  uint8_t *texts[4U];
+  uint8_t *tags[4U];
+  key_states_sha2_512_many(a, n, ks, prk, prklen);
+  for (uint32_t l = (uint32_t)0U; l < n; l++)
+  {
+    tags[l] = text + l * text_len;
+    memcpy(tags[l] + tlen, info[l], infolen * sizeof (uint8_t));
+  }
+  for (uint32_t i = (uint32_t)0U; i * tlen < len; i++)
+  {
+    uint32_t t_len = tlen;
+    if (i == (uint32_t)0U)
+    {
+      t_len = (uint32_t)0U;
+    }
+    for (uint32_t l = (uint32_t)0U; l < n; l++)
+    {
+      tags[l][tlen + infolen] = (uint8_t)(i + (uint32_t)1U);
+      texts[l] = tags[l] + tlen - t_len;
+    }
+    hmac_sha2_512_many(a, n, ks, texts, t_len + infolen + (uint32_t)1U, tags);
+    uint32_t out_len = len - i * tlen;
+    if (out_len > tlen)
+    {
+      out_len = tlen;
+    }
+    for (uint32_t l = (uint32_t)0U; l < n; l++)
+    {
+      memcpy(okm[l] + i * tlen, tags[l], out_len * sizeof (uint8_t));
+    }
+  }
+  Lib_Memzero0_memzero(text, (uint32_t)4U * text_len * sizeof (text[0U]));
+  Lib_Memzero0_memzero(ks, sizeof (ks));
+}
+
+void
+EverCrypt_HKDF_expand_many(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **okm,
+  uint8_t **prk,
+  uint32_t prklen,
+  uint8_t **info,
+  uint32_t infolen,
+  uint32_t len
+)
+{
+  if (a == Spec_Hash_Definitions_SHA2_256)
+  {
+    for (uint32_t i = (uint32_t)0U; i < n; i = i + (uint32_t)8U)
+    {
+      uint32_t lanes = n - i;
+      if (lanes > (uint32_t)8U)
+      {
+        lanes = (uint32_t)8U;
+      }
+      expand_sha2_256_many(lanes, okm + i, prk + i, prklen, info + i, infolen, len);
+    }
+    return;
+  }
+  if (a == Spec_Hash_Definitions_SHA2_384 || a == Spec_Hash_Definitions_SHA2_512)
+  {
+    for (uint32_t i = (uint32_t)0U; i < n; i = i + (uint32_t)4U)
+    {
+      uint32_t lanes = n - i;
+      if (lanes > (uint32_t)4U)
+      {
+        lanes = (uint32_t)4U;
+      }
+      expand_sha2_512_many(a, lanes, okm + i, prk + i, prklen, info + i, infolen, len);
+    }
+    return;
+  }
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    EverCrypt_HKDF_expand(a, okm[i], prk[i], prklen, info[i], infolen, len);
+  }
+}
+
+void
+EverCrypt_HKDF_extract_many(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **prk,
+  uint8_t **salt,
+  uint32_t saltlen,
+  uint8_t **ikm,
+  uint32_t ikmlen
+)
+{
+  if (a == Spec_Hash_Definitions_SHA2_256)
+  {
+    EverCrypt_HMAC_key_state ks[8U];
+    for (uint32_t i = (uint32_t)0U; i < n; i = i + (uint32_t)8U)
+    {
+      uint32_t lanes = n - i;
+      if (lanes > (uint32_t)8U)
+      {
+        lanes = (uint32_t)8U;
+      }
+      key_states_sha2_256_many(lanes, ks, salt + i, saltlen);
+      hmac_sha2_256_many(lanes, ks, ikm + i, ikmlen, prk + i);
+    }
+    Lib_Memzero0_memzero(ks, sizeof (ks));
+    return;
+  }
+  if (a == Spec_Hash_Definitions_SHA2_384 || a == Spec_Hash_Definitions_SHA2_512)
+  {
+    EverCrypt_HMAC_key_state ks[4U];
+    for (uint32_t i = (uint32_t)0U; i < n; i = i + (uint32_t)4U)
+    {
+      uint32_t lanes = n - i;
+      if (lanes > (uint32_t)4U)
+      {
+        lanes = (uint32_t)4U;
+      }
+      key_states_sha2_512_many(a, lanes, ks, salt + i, saltlen);
+      hmac_sha2_512_many(a, lanes, ks, ikm + i, ikmlen, prk + i);
+    }
+    Lib_Memzero0_memzero(ks, sizeof (ks));
+    return;
+  }
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    EverCrypt_HKDF_extract(a, prk[i], salt[i], saltlen, ikm[i], ikmlen);
+  }
+}
+
 KRML_DEPRECATED("expand")
 
 void
@@ -175,6 +175,40 @@ EverCrypt_HKDF_extract(
   uint32_t ikmlen
 );
 
+/*
+Run n independent HKDF-Expand derivations: okm[i] gets len bytes derived from
+prk[i] and info[i]. All derivations share prklen, infolen and len, so that the
+SHA2-256 ones proceed in lockstep over EverCrypt_Hash_update_multi_256_many and
+the SHA2-384/512 ones over EverCrypt_Hash_update_multi_512_many; other
+algorithms derive one after the other.
+*/
+void
+EverCrypt_HKDF_expand_many(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **okm,
+  uint8_t **prk,
+  uint32_t prklen,
+  uint8_t **info,
+  uint32_t infolen,
+  uint32_t len
+);
+
+/*
+Run n independent HKDF-Extract computations, prk[i] from salt[i] and ikm[i],
+with the same lane layout as EverCrypt_HKDF_expand_many.
+*/
+void
+EverCrypt_HKDF_extract_many(
+  Spec_Hash_Definitions_hash_alg a,
+  uint32_t n,
+  uint8_t **prk,
+  uint8_t **salt,
+  uint32_t saltlen,
+  uint8_t **ikm,
+  uint32_t ikmlen
+);
+
 KRML_DEPRECATED("expand")
 
 void
@@ -217,7 +217,7 @@ EverCrypt_HMAC_compute_sha2_384(
   }
   else
   {
-    Hacl_Hash_SHA2_hash_384(key, key_len, nkey);
+    EverCrypt_Hash_hash_384(key, key_len, nkey);
   }
   KRML_CHECK_SIZE(sizeof (uint8_t), l);
   uint8_t ipad[l];
@@ -249,15 +249,15 @@ EverCrypt_HMAC_compute_sha2_384(
   Hacl_Hash_Core_SHA2_init_384(s);
   if (data_len == (uint32_t)0U)
   {
-    Hacl_Hash_SHA2_update_last_384(s,
+    EverCrypt_Hash_update_last_512(s,
       FStar_UInt128_uint64_to_uint128((uint64_t)0U),
       ipad,
       (uint32_t)128U);
   }
   else
   {
-    Hacl_Hash_SHA2_update_multi_384(s, ipad, (uint32_t)1U);
-    Hacl_Hash_SHA2_update_last_384(s,
+    EverCrypt_Hash_update_multi_512(s, ipad, (uint32_t)1U);
+    EverCrypt_Hash_update_last_512(s,
       FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
       data,
       data_len);
@@ -267,15 +267,15 @@ EverCrypt_HMAC_compute_sha2_384(
   Hacl_Hash_Core_SHA2_init_384(s);
   if ((uint32_t)48U == (uint32_t)0U)
   {
-    Hacl_Hash_SHA2_update_last_384(s,
+    EverCrypt_Hash_update_last_512(s,
       FStar_UInt128_uint64_to_uint128((uint64_t)0U),
       opad,
       (uint32_t)128U);
   }
   else
   {
-    Hacl_Hash_SHA2_update_multi_384(s, opad, (uint32_t)1U);
-    Hacl_Hash_SHA2_update_last_384(s,
+    EverCrypt_Hash_update_multi_512(s, opad, (uint32_t)1U);
+    EverCrypt_Hash_update_last_512(s,
       FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
       hash1,
       (uint32_t)48U);
@@ -312,7 +312,7 @@ EverCrypt_HMAC_compute_sha2_512(
   }
   else
   {
-    Hacl_Hash_SHA2_hash_512(key, key_len, nkey);
+    EverCrypt_Hash_hash_512(key, key_len, nkey);
   }
   KRML_CHECK_SIZE(sizeof (uint8_t), l);
   uint8_t ipad[l];
@@ -344,15 +344,15 @@ EverCrypt_HMAC_compute_sha2_512(
   Hacl_Hash_Core_SHA2_init_512(s);
   if (data_len == (uint32_t)0U)
   {
-    Hacl_Hash_SHA2_update_last_512(s,
+    EverCrypt_Hash_update_last_512(s,
       FStar_UInt128_uint64_to_uint128((uint64_t)0U),
       ipad,
       (uint32_t)128U);
   }
   else
   {
-    Hacl_Hash_SHA2_update_multi_512(s, ipad, (uint32_t)1U);
-    Hacl_Hash_SHA2_update_last_512(s,
+    EverCrypt_Hash_update_multi_512(s, ipad, (uint32_t)1U);
+    EverCrypt_Hash_update_last_512(s,
       FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
       data,
       data_len);
@@ -362,15 +362,15 @@ EverCrypt_HMAC_compute_sha2_512(
   Hacl_Hash_Core_SHA2_init_512(s);
   if ((uint32_t)64U == (uint32_t)0U)
   {
-    Hacl_Hash_SHA2_update_last_512(s,
+    EverCrypt_Hash_update_last_512(s,
       FStar_UInt128_uint64_to_uint128((uint64_t)0U),
       opad,
       (uint32_t)128U);
   }
   else
   {
-    Hacl_Hash_SHA2_update_multi_512(s, opad, (uint32_t)1U);
-    Hacl_Hash_SHA2_update_last_512(s,
+    EverCrypt_Hash_update_multi_512(s, opad, (uint32_t)1U);
+    EverCrypt_Hash_update_last_512(s,
       FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
       hash1,
       (uint32_t)64U);
@@ -848,3 +848,317 @@ EverCrypt_HMAC_compute(
   }
 }
 
+
+/*
+  HMAC with a fixed key: the ipad and opad blocks are compressed once in
+  EverCrypt_HMAC_key_state_init and each compute call starts from the saved
+  chaining values.
+*/
+
+static void blake2s_init_state(uint32_t *s)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    s[i] = Hacl_Impl_Blake2_Constants_ivTable_S[i];
+    s[(uint32_t)8U + i] = Hacl_Impl_Blake2_Constants_ivTable_S[i];
+  }
+  s[0U] = s[0U] ^ ((uint32_t)0x01010000U ^ (uint32_t)32U);
+}
+
+static void blake2b_init_state(uint64_t *s)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    s[i] = Hacl_Impl_Blake2_Constants_ivTable_B[i];
+    s[(uint32_t)8U + i] = Hacl_Impl_Blake2_Constants_ivTable_B[i];
+  }
+  s[0U] = s[0U] ^ ((uint64_t)0x01010000U ^ (uint64_t)64U);
+}
+
+static void
+hash_key(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t key_len, uint8_t *dst)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        Hacl_Hash_SHA1_legacy_hash(key, key_len, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        EverCrypt_Hash_hash_256(key, key_len, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        EverCrypt_Hash_hash_384(key, key_len, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        EverCrypt_Hash_hash_512(key, key_len, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_Blake2S:
+      {
+        Hacl_Hash_Blake2_hash_blake2s_32(key, key_len, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_Blake2B:
+      {
+        Hacl_Hash_Blake2_hash_blake2b_32(key, key_len, dst);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/* Sets s to the chaining value after one block b. */
+static void compress_block(Spec_Hash_Definitions_hash_alg a, uint64_t *s, uint8_t *b)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        Hacl_Hash_Core_SHA1_legacy_init((uint32_t *)s);
+        Hacl_Hash_SHA1_legacy_update_multi((uint32_t *)s, b, (uint32_t)1U);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        Hacl_Hash_Core_SHA2_init_256((uint32_t *)s);
+        EverCrypt_Hash_update_multi_256((uint32_t *)s, b, (uint32_t)1U);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        Hacl_Hash_Core_SHA2_init_384(s);
+        EverCrypt_Hash_update_multi_512(s, b, (uint32_t)1U);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        Hacl_Hash_Core_SHA2_init_512(s);
+        EverCrypt_Hash_update_multi_512(s, b, (uint32_t)1U);
+        break;
+      }
+    case Spec_Hash_Definitions_Blake2S:
+      {
+        blake2s_init_state((uint32_t *)s);
+        uint64_t
+        ev = Hacl_Hash_Blake2_update_multi_blake2s_32((uint32_t *)s, (uint64_t)0U, b, (uint32_t)1U);
+        break;
+      }
+    case Spec_Hash_Definitions_Blake2B:
+      {
+        blake2b_init_state(s);
+        FStar_UInt128_uint128
+        ev =
+          Hacl_Hash_Blake2_update_multi_blake2b_32(s,
+            FStar_UInt128_uint64_to_uint128((uint64_t)0U),
+            b,
+            (uint32_t)1U);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/*
+  Hashes data, starting from the chaining value s obtained after one block, into
+  dst. Blake2 only marks the last non-empty block as final, so an empty data is
+  handled by hashing the block b itself from the initial state instead.
+*/
+static void
+finish_from(
+  Spec_Hash_Definitions_hash_alg a,
+  uint64_t *s,
+  uint8_t *b,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *dst
+)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        Hacl_Hash_SHA1_legacy_update_last((uint32_t *)s, (uint64_t)(uint32_t)64U, data, data_len);
+        Hacl_Hash_Core_SHA1_legacy_finish((uint32_t *)s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        EverCrypt_Hash_update_last_256((uint32_t *)s, (uint64_t)(uint32_t)64U, data, data_len);
+        Hacl_Hash_Core_SHA2_finish_256((uint32_t *)s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        EverCrypt_Hash_update_last_512(s,
+          FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+          data,
+          data_len);
+        Hacl_Hash_Core_SHA2_finish_384(s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        EverCrypt_Hash_update_last_512(s,
+          FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+          data,
+          data_len);
+        Hacl_Hash_Core_SHA2_finish_512(s, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_Blake2S:
+      {
+        uint32_t *s1 = (uint32_t *)s;
+        uint64_t ev;
+        if (data_len == (uint32_t)0U)
+        {
+          blake2s_init_state(s1);
+          ev = Hacl_Hash_Blake2_update_last_blake2s_32(s1, (uint64_t)0U, (uint64_t)0U, b, (uint32_t)64U);
+        }
+        else
+        {
+          ev =
+            Hacl_Hash_Blake2_update_last_blake2s_32(s1,
+              (uint64_t)(uint32_t)64U,
+              (uint64_t)(uint32_t)64U,
+              data,
+              data_len);
+        }
+        Hacl_Hash_Core_Blake2_finish_blake2s_32(s1, ev, dst);
+        break;
+      }
+    case Spec_Hash_Definitions_Blake2B:
+      {
+        FStar_UInt128_uint128 ev;
+        if (data_len == (uint32_t)0U)
+        {
+          blake2b_init_state(s);
+          ev =
+            Hacl_Hash_Blake2_update_last_blake2b_32(s,
+              FStar_UInt128_uint64_to_uint128((uint64_t)0U),
+              FStar_UInt128_uint64_to_uint128((uint64_t)0U),
+              b,
+              (uint32_t)128U);
+        }
+        else
+        {
+          ev =
+            Hacl_Hash_Blake2_update_last_blake2b_32(s,
+              FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+              FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U),
+              data,
+              data_len);
+        }
+        Hacl_Hash_Core_Blake2_finish_blake2b_32(s, ev, dst);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+void
+EverCrypt_HMAC_key_state_init(
+  EverCrypt_HMAC_key_state *st,
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *key,
+  uint32_t key_len
+)
+{
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  uint8_t key_block[128U] = { 0U };
+  if (key_len <= l)
+  {
+    memcpy(key_block, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    hash_key(a, key, key_len, key_block);
+  }
+  uint8_t opad[128U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < l; i++)
+  {
+    st->ipad[i] = (uint8_t)0x36U ^ key_block[i];
+    opad[i] = (uint8_t)0x5cU ^ key_block[i];
+  }
+  st->alg = a;
+  compress_block(a, st->inner, st->ipad);
+  compress_block(a, st->outer, opad);
+  Lib_Memzero0_memzero(key_block, (uint32_t)128U * sizeof (key_block[0U]));
+  Lib_Memzero0_memzero(opad, (uint32_t)128U * sizeof (opad[0U]));
+}
+
+void
+EverCrypt_HMAC_key_state_compute(
+  EverCrypt_HMAC_key_state *st,
+  uint8_t *dst,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  Spec_Hash_Definitions_hash_alg a = st->alg;
+  uint32_t hash_len = Hacl_Hash_Definitions_hash_len(a);
+  uint64_t s[16U] = { 0U };
+  uint8_t hash1[64U] = { 0U };
+  memcpy(s, st->inner, (uint32_t)16U * sizeof (uint64_t));
+  finish_from(a, s, st->ipad, data, data_len, hash1);
+  memcpy(s, st->outer, (uint32_t)16U * sizeof (uint64_t));
+  finish_from(a, s, NULL, hash1, hash_len, dst);
+}
+
+EverCrypt_HMAC_state
+*EverCrypt_HMAC_create_in(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t key_len)
+{
+  EverCrypt_HMAC_state *st = KRML_HOST_MALLOC(sizeof (EverCrypt_HMAC_state));
+  st->inner = EverCrypt_Hash_Incremental_create_in(a);
+  st->key.alg = a;
+  EverCrypt_HMAC_init(st, key, key_len);
+  return st;
+}
+
+void EverCrypt_HMAC_init(EverCrypt_HMAC_state *st, uint8_t *key, uint32_t key_len)
+{
+  Spec_Hash_Definitions_hash_alg a = st->key.alg;
+  EverCrypt_HMAC_key_state_init(&st->key, a, key, key_len);
+  EverCrypt_Hash_Incremental_init(st->inner);
+  EverCrypt_Hash_Incremental_update(st->inner, st->key.ipad, Hacl_Hash_Definitions_block_len(a));
+}
+
+void EverCrypt_HMAC_update(EverCrypt_HMAC_state *st, uint8_t *data, uint32_t len)
+{
+  EverCrypt_Hash_Incremental_update(st->inner, data, len);
+}
+
+void EverCrypt_HMAC_finish(EverCrypt_HMAC_state *st, uint8_t *dst)
+{
+  Spec_Hash_Definitions_hash_alg a = st->key.alg;
+  uint64_t s[16U] = { 0U };
+  uint8_t hash1[64U] = { 0U };
+  EverCrypt_Hash_Incremental_finish(st->inner, hash1);
+  memcpy(s, st->key.outer, (uint32_t)16U * sizeof (uint64_t));
+  finish_from(a, s, NULL, hash1, Hacl_Hash_Definitions_hash_len(a), dst);
+}
+
+void EverCrypt_HMAC_free(EverCrypt_HMAC_state *st)
+{
+  EverCrypt_Hash_Incremental_free(st->inner);
+  Lib_Memzero0_memzero(&st->key, sizeof (st->key));
+  KRML_HOST_FREE(st);
+}
@@ -43,6 +43,7 @@ extern "C" {
 #include "Hacl_Hash.h"
 #include "Hacl_Spec.h"
 #include "EverCrypt_Hash.h"
+#include "Lib_Memzero0.h"
 
 void
 EverCrypt_HMAC_compute_sha1(
@@ -112,6 +113,76 @@ EverCrypt_HMAC_compute(
   uint32_t datalen
 );
 
+/*
+  An HMAC key with its ipad and opad blocks already compressed, so that each
+  MAC only costs the message blocks and one finalization. inner and outer hold
+  the hash chaining values (as 32-bit words for SHA-1, SHA2-256 and Blake2s);
+  ipad is kept for Blake2, whose empty-message case cannot start from inner.
+  This is key material: zero it with Lib_Memzero0_memzero once done.
+*/
+typedef struct EverCrypt_HMAC_key_state_s
+{
+  Spec_Hash_Definitions_hash_alg alg;
+  uint64_t inner[16U];
+  uint64_t outer[16U];
+  uint8_t ipad[128U];
+}
+EverCrypt_HMAC_key_state;
+
+void
+EverCrypt_HMAC_key_state_init(
+  EverCrypt_HMAC_key_state *st,
+  Spec_Hash_Definitions_hash_alg a,
+  uint8_t *key,
+  uint32_t key_len
+);
+
+/*
+  Same result as EverCrypt_HMAC_compute with the key given to
+  EverCrypt_HMAC_key_state_init.
+*/
+void
+EverCrypt_HMAC_key_state_compute(
+  EverCrypt_HMAC_key_state *st,
+  uint8_t *dst,
+  uint8_t *data,
+  uint32_t data_len
+);
+
+/*
+  Incremental HMAC over EverCrypt_Hash_Incremental, for messages that are not
+  in one contiguous buffer. The inner hash is a streaming hash that has already
+  absorbed the ipad block; the outer one resumes from key.outer in finish.
+*/
+typedef struct EverCrypt_HMAC_state_s
+{
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *inner;
+  EverCrypt_HMAC_key_state key;
+}
+EverCrypt_HMAC_state;
+
+/*
+  Allocates a state for algorithm a (one of EverCrypt_HMAC_is_supported_alg)
+  and keys it with EverCrypt_HMAC_init.
+*/
+EverCrypt_HMAC_state
+*EverCrypt_HMAC_create_in(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t key_len);
+
+/*
+  Starts a new message under key, keeping the algorithm of st.
+*/
+void EverCrypt_HMAC_init(EverCrypt_HMAC_state *st, uint8_t *key, uint32_t key_len);
+
+void EverCrypt_HMAC_update(EverCrypt_HMAC_state *st, uint8_t *data, uint32_t len);
+
+/*
+  Writes the tag of the data given so far to dst. The state is left unchanged,
+  so more data may follow.
+*/
+void EverCrypt_HMAC_finish(EverCrypt_HMAC_state *st, uint8_t *dst);
+
+void EverCrypt_HMAC_free(EverCrypt_HMAC_state *st);
+
 #if defined(__cplusplus)
 }
 #endif
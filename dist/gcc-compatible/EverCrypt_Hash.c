@@ -424,6 +424,129 @@ EverCrypt_Hash_state_s *EverCrypt_Hash_create(Spec_Hash_Definitions_hash_alg a)
   return EverCrypt_Hash_create_in(a);
 }
 
+/*
+  The tagged union takes the first HASH_IN_PLACE_STATE bytes of mem, followed
+  by the largest hash state (Blake2B, 16 64-bit words).
+*/
+#define HASH_IN_PLACE_STATE ((uint32_t)16U)
+
+#define HASH_IN_PLACE_STATE_LEN ((uint32_t)16U * (uint32_t)sizeof (uint64_t))
+
+_Static_assert(sizeof (EverCrypt_Hash_state_s) <= HASH_IN_PLACE_STATE, "hash state header");
+
+_Static_assert(HASH_IN_PLACE_STATE % sizeof (uint64_t) == 0U, "hash state alignment");
+
+_Static_assert(HASH_IN_PLACE_STATE + HASH_IN_PLACE_STATE_LEN <= EverCrypt_Hash_state_len,
+  "hash state in place");
+
+EverCrypt_Hash_state_s
+*EverCrypt_Hash_init_in_place(Spec_Hash_Definitions_hash_alg a, uint8_t *mem)
+{
+  uint8_t *buf = mem + HASH_IN_PLACE_STATE;
+  memset(buf, 0U, HASH_IN_PLACE_STATE_LEN * sizeof (uint8_t));
+  EverCrypt_Hash_state_s s;
+  switch (a)
+  {
+    case Spec_Hash_Definitions_MD5:
+      {
+        s =
+          (
+            (EverCrypt_Hash_state_s){
+              .tag = EverCrypt_Hash_MD5_s,
+              { .case_MD5_s = (uint32_t *)buf }
+            }
+          );
+        break;
+      }
+    case Spec_Hash_Definitions_SHA1:
+      {
+        s =
+          (
+            (EverCrypt_Hash_state_s){
+              .tag = EverCrypt_Hash_SHA1_s,
+              { .case_SHA1_s = (uint32_t *)buf }
+            }
+          );
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_224:
+      {
+        s =
+          (
+            (EverCrypt_Hash_state_s){
+              .tag = EverCrypt_Hash_SHA2_224_s,
+              { .case_SHA2_224_s = (uint32_t *)buf }
+            }
+          );
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        s =
+          (
+            (EverCrypt_Hash_state_s){
+              .tag = EverCrypt_Hash_SHA2_256_s,
+              { .case_SHA2_256_s = (uint32_t *)buf }
+            }
+          );
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_384:
+      {
+        s =
+          (
+            (EverCrypt_Hash_state_s){
+              .tag = EverCrypt_Hash_SHA2_384_s,
+              { .case_SHA2_384_s = (uint64_t *)buf }
+            }
+          );
+        break;
+      }
+    case Spec_Hash_Definitions_SHA2_512:
+      {
+        s =
+          (
+            (EverCrypt_Hash_state_s){
+              .tag = EverCrypt_Hash_SHA2_512_s,
+              { .case_SHA2_512_s = (uint64_t *)buf }
+            }
+          );
+        break;
+      }
+    case Spec_Hash_Definitions_Blake2S:
+      {
+        s =
+          (
+            (EverCrypt_Hash_state_s){
+              .tag = EverCrypt_Hash_Blake2S_s,
+              { .case_Blake2S_s = (uint32_t *)buf }
+            }
+          );
+        break;
+      }
+    case Spec_Hash_Definitions_Blake2B:
+      {
+        s =
+          (
+            (EverCrypt_Hash_state_s){
+              .tag = EverCrypt_Hash_Blake2B_s,
+              { .case_Blake2B_s = (uint64_t *)buf }
+            }
+          );
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+  EverCrypt_Hash_state_s *p = (EverCrypt_Hash_state_s *)mem;
+  p[0U] = s;
+  EverCrypt_Hash_init(p);
+  return p;
+}
+
 void EverCrypt_Hash_init(EverCrypt_Hash_state_s *s)
 {
   EverCrypt_Hash_state_s scrut = *s;
@@ -578,6 +701,82 @@ void EverCrypt_Hash_update_multi_256(uint32_t *s, uint8_t *blocks, uint32_t n)
   Hacl_Hash_SHA2_update_multi_256(s, blocks, n);
 }
 
+void
+EverCrypt_Hash_update_multi_256_many(
+  uint32_t n_states,
+  uint32_t **s,
+  uint8_t **blocks,
+  uint32_t n
+)
+{
+  bool has_shaext = EverCrypt_AutoConfig2_has_shaext();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  bool has_avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  uint32_t i = (uint32_t)0U;
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (!(has_shaext && has_sse))
+  {
+    if (has_avx2)
+    {
+      for (; i + (uint32_t)8U <= n_states; i = i + (uint32_t)8U)
+      {
+        Hacl_SHA2_Vec256_update_multi_256_8(s + i, blocks + i, n);
+      }
+    }
+    if (has_avx)
+    {
+      for (; i + (uint32_t)4U <= n_states; i = i + (uint32_t)4U)
+      {
+        Hacl_SHA2_Vec128_update_multi_256_4(s + i, blocks + i, n);
+      }
+    }
+  }
+  #endif
+  for (; i < n_states; i++)
+  {
+    EverCrypt_Hash_update_multi_256(s[i], blocks[i], n);
+  }
+}
+
+void EverCrypt_Hash_update_multi_512(uint64_t *s, uint8_t *blocks, uint32_t n)
+{
+  bool has_avx2 = EverCrypt_AutoConfig2_has_avx2();
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_avx2 && n >= (uint32_t)2U)
+  {
+    Hacl_SHA2_Vec256_update_multi_512(s, blocks, n);
+    return;
+  }
+  #endif
+  Hacl_Hash_SHA2_update_multi_512(s, blocks, n);
+}
+
+void
+EverCrypt_Hash_update_multi_512_many(
+  uint32_t n_states,
+  uint64_t **s,
+  uint8_t **blocks,
+  uint32_t n
+)
+{
+  bool has_avx2 = EverCrypt_AutoConfig2_has_avx2();
+  uint32_t i = (uint32_t)0U;
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_avx2)
+  {
+    for (; i + (uint32_t)4U <= n_states; i = i + (uint32_t)4U)
+    {
+      Hacl_SHA2_Vec256_update_multi_512_4(s + i, blocks + i, n);
+    }
+  }
+  #endif
+  for (; i < n_states; i++)
+  {
+    EverCrypt_Hash_update_multi_512(s[i], blocks[i], n);
+  }
+}
+
 void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t *block)
 {
   EverCrypt_Hash_state_s scrut = *s;
@@ -688,14 +887,14 @@ EverCrypt_Hash_update_multi2(
   {
     uint64_t *p1 = scrut.case_SHA2_384_s;
     uint32_t n = len / (uint32_t)128U;
-    Hacl_Hash_SHA2_update_multi_384(p1, blocks, n);
+    EverCrypt_Hash_update_multi_512(p1, blocks, n);
     return;
   }
   if (scrut.tag == EverCrypt_Hash_SHA2_512_s)
   {
     uint64_t *p1 = scrut.case_SHA2_512_s;
     uint32_t n = len / (uint32_t)128U;
-    Hacl_Hash_SHA2_update_multi_512(p1, blocks, n);
+    EverCrypt_Hash_update_multi_512(p1, blocks, n);
     return;
   }
   if (scrut.tag == EverCrypt_Hash_Blake2S_s)
@@ -763,6 +962,44 @@ EverCrypt_Hash_update_last_256(
   EverCrypt_Hash_update_multi_256(s, tmp, tmp_len / (uint32_t)64U);
 }
 
+void
+EverCrypt_Hash_update_last_512(
+  uint64_t *s,
+  FStar_UInt128_uint128 prev_len,
+  uint8_t *input,
+  uint32_t input_len
+)
+{
+  uint32_t blocks_n = input_len / (uint32_t)128U;
+  uint32_t blocks_len = blocks_n * (uint32_t)128U;
+  uint8_t *blocks = input;
+  uint32_t rest_len = input_len - blocks_len;
+  uint8_t *rest = input + blocks_len;
+  EverCrypt_Hash_update_multi_512(s, blocks, blocks_n);
+  FStar_UInt128_uint128
+  total_input_len =
+    FStar_UInt128_add(prev_len,
+      FStar_UInt128_uint64_to_uint128((uint64_t)input_len));
+  uint32_t
+  pad_len =
+    (uint32_t)1U
+    +
+      ((uint32_t)256U
+      -
+        ((uint32_t)17U
+        + (uint32_t)(FStar_UInt128_uint128_to_uint64(total_input_len) % (uint64_t)(uint32_t)128U)))
+      % (uint32_t)128U
+    + (uint32_t)16U;
+  uint32_t tmp_len = rest_len + pad_len;
+  uint8_t tmp_twoblocks[256U] = { 0U };
+  uint8_t *tmp = tmp_twoblocks;
+  uint8_t *tmp_rest = tmp;
+  uint8_t *tmp_pad = tmp + rest_len;
+  memcpy(tmp_rest, rest, rest_len * sizeof (uint8_t));
+  Hacl_Hash_Core_SHA2_pad_512(total_input_len, tmp_pad);
+  EverCrypt_Hash_update_multi_512(s, tmp, tmp_len / (uint32_t)128U);
+}
+
 void
 EverCrypt_Hash_update_last2(
   EverCrypt_Hash_state_s *s,
@@ -799,13 +1036,13 @@ EverCrypt_Hash_update_last2(
   if (scrut.tag == EverCrypt_Hash_SHA2_384_s)
   {
     uint64_t *p1 = scrut.case_SHA2_384_s;
-    Hacl_Hash_SHA2_update_last_384(p1, FStar_UInt128_uint64_to_uint128(prev_len), last, last_len);
+    EverCrypt_Hash_update_last_512(p1, FStar_UInt128_uint64_to_uint128(prev_len), last, last_len);
     return;
   }
   if (scrut.tag == EverCrypt_Hash_SHA2_512_s)
   {
     uint64_t *p1 = scrut.case_SHA2_512_s;
-    Hacl_Hash_SHA2_update_last_512(p1, FStar_UInt128_uint64_to_uint128(prev_len), last, last_len);
+    EverCrypt_Hash_update_last_512(p1, FStar_UInt128_uint64_to_uint128(prev_len), last, last_len);
     return;
   }
   if (scrut.tag == EverCrypt_Hash_Blake2S_s)
@@ -1177,6 +1414,168 @@ void EverCrypt_Hash_hash_256(uint8_t *input, uint32_t input_len, uint8_t *dst)
   Hacl_Hash_Core_SHA2_finish_256(s, dst);
 }
 
+void
+EverCrypt_Hash_hash_256_many(
+  uint32_t n_states,
+  uint8_t **dst,
+  uint8_t **input,
+  uint32_t input_len
+)
+{
+  bool has_shaext = EverCrypt_AutoConfig2_has_shaext();
+  bool has_sse = EverCrypt_AutoConfig2_has_sse();
+  bool has_avx2 = EverCrypt_AutoConfig2_has_avx2();
+  bool has_avx = EverCrypt_AutoConfig2_has_avx();
+  uint32_t i = (uint32_t)0U;
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (!(has_shaext && has_sse))
+  {
+    if (has_avx2)
+    {
+      for (; i + (uint32_t)8U <= n_states; i = i + (uint32_t)8U)
+      {
+        Hacl_SHA2_Vec256_sha256_8(dst + i, input_len, input + i);
+      }
+    }
+    if (has_avx)
+    {
+      for (; i + (uint32_t)4U <= n_states; i = i + (uint32_t)4U)
+      {
+        Hacl_SHA2_Vec128_sha256_4(dst + i, input_len, input + i);
+      }
+    }
+  }
+  #endif
+  for (; i < n_states; i++)
+  {
+    EverCrypt_Hash_hash_256(input[i], input_len, dst[i]);
+  }
+}
+
+void EverCrypt_Hash_hash_384(uint8_t *input, uint32_t input_len, uint8_t *dst)
+{
+  uint64_t
+  scrut[8U] =
+    {
+      (uint64_t)0xcbbb9d5dc1059ed8U, (uint64_t)0x629a292a367cd507U, (uint64_t)0x9159015a3070dd17U,
+      (uint64_t)0x152fecd8f70e5939U, (uint64_t)0x67332667ffc00b31U, (uint64_t)0x8eb44a8768581511U,
+      (uint64_t)0xdb0c2e0d64f98fa7U, (uint64_t)0x47b5481dbefa4fa4U
+    };
+  uint64_t *s = scrut;
+  uint32_t blocks_n0 = input_len / (uint32_t)128U;
+  uint32_t blocks_n1;
+  if (input_len % (uint32_t)128U == (uint32_t)0U && blocks_n0 > (uint32_t)0U)
+  {
+    blocks_n1 = blocks_n0 - (uint32_t)1U;
+  }
+  else
+  {
+    blocks_n1 = blocks_n0;
+  }
+  uint32_t blocks_len0 = blocks_n1 * (uint32_t)128U;
+  uint8_t *blocks0 = input;
+  uint32_t rest_len0 = input_len - blocks_len0;
+  uint8_t *rest0 = input + blocks_len0;
+  uint32_t blocks_n = blocks_n1;
+  uint32_t blocks_len = blocks_len0;
+  uint8_t *blocks = blocks0;
+  uint32_t rest_len = rest_len0;
+  uint8_t *rest = rest0;
+  EverCrypt_Hash_update_multi_512(s, blocks, blocks_n);
+  EverCrypt_Hash_update_last_512(s,
+    FStar_UInt128_uint64_to_uint128((uint64_t)blocks_len),
+    rest,
+    rest_len);
+  Hacl_Hash_Core_SHA2_finish_384(s, dst);
+}
+
+void EverCrypt_Hash_hash_512(uint8_t *input, uint32_t input_len, uint8_t *dst)
+{
+  uint64_t
+  scrut[8U] =
+    {
+      (uint64_t)0x6a09e667f3bcc908U, (uint64_t)0xbb67ae8584caa73bU, (uint64_t)0x3c6ef372fe94f82bU,
+      (uint64_t)0xa54ff53a5f1d36f1U, (uint64_t)0x510e527fade682d1U, (uint64_t)0x9b05688c2b3e6c1fU,
+      (uint64_t)0x1f83d9abfb41bd6bU, (uint64_t)0x5be0cd19137e2179U
+    };
+  uint64_t *s = scrut;
+  uint32_t blocks_n0 = input_len / (uint32_t)128U;
+  uint32_t blocks_n1;
+  if (input_len % (uint32_t)128U == (uint32_t)0U && blocks_n0 > (uint32_t)0U)
+  {
+    blocks_n1 = blocks_n0 - (uint32_t)1U;
+  }
+  else
+  {
+    blocks_n1 = blocks_n0;
+  }
+  uint32_t blocks_len0 = blocks_n1 * (uint32_t)128U;
+  uint8_t *blocks0 = input;
+  uint32_t rest_len0 = input_len - blocks_len0;
+  uint8_t *rest0 = input + blocks_len0;
+  uint32_t blocks_n = blocks_n1;
+  uint32_t blocks_len = blocks_len0;
+  uint8_t *blocks = blocks0;
+  uint32_t rest_len = rest_len0;
+  uint8_t *rest = rest0;
+  EverCrypt_Hash_update_multi_512(s, blocks, blocks_n);
+  EverCrypt_Hash_update_last_512(s,
+    FStar_UInt128_uint64_to_uint128((uint64_t)blocks_len),
+    rest,
+    rest_len);
+  Hacl_Hash_Core_SHA2_finish_512(s, dst);
+}
+
+void
+EverCrypt_Hash_hash_384_many(
+  uint32_t n_states,
+  uint8_t **dst,
+  uint8_t **input,
+  uint32_t input_len
+)
+{
+  bool has_avx2 = EverCrypt_AutoConfig2_has_avx2();
+  uint32_t i = (uint32_t)0U;
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_avx2)
+  {
+    for (; i + (uint32_t)4U <= n_states; i = i + (uint32_t)4U)
+    {
+      Hacl_SHA2_Vec256_sha384_4(dst + i, input_len, input + i);
+    }
+  }
+  #endif
+  for (; i < n_states; i++)
+  {
+    EverCrypt_Hash_hash_384(input[i], input_len, dst[i]);
+  }
+}
+
+void
+EverCrypt_Hash_hash_512_many(
+  uint32_t n_states,
+  uint8_t **dst,
+  uint8_t **input,
+  uint32_t input_len
+)
+{
+  bool has_avx2 = EverCrypt_AutoConfig2_has_avx2();
+  uint32_t i = (uint32_t)0U;
+  #if EVERCRYPT_TARGETCONFIG_X64
+  if (has_avx2)
+  {
+    for (; i + (uint32_t)4U <= n_states; i = i + (uint32_t)4U)
+    {
+      Hacl_SHA2_Vec256_sha512_4(dst + i, input_len, input + i);
+    }
+  }
+  #endif
+  for (; i < n_states; i++)
+  {
+    EverCrypt_Hash_hash_512(input[i], input_len, dst[i]);
+  }
+}
+
 void EverCrypt_Hash_hash_224(uint8_t *input, uint32_t input_len, uint8_t *dst)
 {
   uint32_t
@@ -1242,12 +1641,12 @@ EverCrypt_Hash_hash(
       }
     case Spec_Hash_Definitions_SHA2_384:
       {
-        Hacl_Hash_SHA2_hash_384(input, len, dst);
+        EverCrypt_Hash_hash_384(input, len, dst);
         break;
       }
     case Spec_Hash_Definitions_SHA2_512:
       {
-        Hacl_Hash_SHA2_hash_512(input, len, dst);
+        EverCrypt_Hash_hash_512(input, len, dst);
         break;
       }
     case Spec_Hash_Definitions_Blake2S:
@@ -1373,6 +1772,51 @@ Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
   return p;
 }
 
+/*
+  The streaming header is followed by a block buffer sized for the largest
+  block (SHA2-384/512 and Blake2B) and by an in-place EverCrypt_Hash state.
+*/
+#define INCREMENTAL_IN_PLACE_BUF ((uint32_t)32U)
+
+#define INCREMENTAL_IN_PLACE_BUF_LEN ((uint32_t)128U)
+
+#define INCREMENTAL_IN_PLACE_BLOCK_STATE ((uint32_t)160U)
+
+_Static_assert(sizeof (Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____)
+  <= INCREMENTAL_IN_PLACE_BUF,
+  "incremental hash state header");
+
+_Static_assert(INCREMENTAL_IN_PLACE_BUF + INCREMENTAL_IN_PLACE_BUF_LEN
+  <= INCREMENTAL_IN_PLACE_BLOCK_STATE,
+  "incremental hash block buffer in place");
+
+_Static_assert(INCREMENTAL_IN_PLACE_BLOCK_STATE % EverCrypt_Hash_state_align == 0U,
+  "incremental hash block state alignment");
+
+_Static_assert(INCREMENTAL_IN_PLACE_BLOCK_STATE + EverCrypt_Hash_state_len
+  <= EverCrypt_Hash_Incremental_state_len,
+  "incremental hash block state in place");
+
+Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
+*EverCrypt_Hash_Incremental_init_in_place(Spec_Hash_Definitions_hash_alg a, uint8_t *mem)
+{
+  uint8_t *buf = mem + INCREMENTAL_IN_PLACE_BUF;
+  memset(buf, 0U, INCREMENTAL_IN_PLACE_BUF_LEN * sizeof (uint8_t));
+  EverCrypt_Hash_state_s
+  *block_state = EverCrypt_Hash_init_in_place(a, mem + INCREMENTAL_IN_PLACE_BLOCK_STATE);
+  Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
+  *p = (Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *)mem;
+  p[0U] =
+    (
+      (Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+  return p;
+}
+
 void
 EverCrypt_Hash_Incremental_init(Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s)
 {
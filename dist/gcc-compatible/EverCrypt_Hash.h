@@ -41,6 +41,8 @@ extern "C" {
 #include "Hacl_Impl_Blake2_Constants.h"
 #include "Vale.h"
 #include "Hacl_Hash.h"
+#include "Hacl_SHA2_Vec256.h"
+#include "Hacl_SHA2_Vec128.h"
 #include "EverCrypt_AutoConfig2.h"
 #include "Hacl_Spec.h"
 
@@ -184,10 +186,60 @@ EverCrypt_Hash_state_s *EverCrypt_Hash_create_in(Spec_Hash_Definitions_hash_alg
 
 EverCrypt_Hash_state_s *EverCrypt_Hash_create(Spec_Hash_Definitions_hash_alg a);
 
+/*
+  Size and alignment of the caller-provided storage for
+  EverCrypt_Hash_init_in_place, valid for every algorithm.
+*/
+#define EverCrypt_Hash_state_len ((uint32_t)144U)
+
+#define EverCrypt_Hash_state_align ((uint32_t)8U)
+
+/*
+  Same as EverCrypt_Hash_create_in followed by EverCrypt_Hash_init, but the
+  state lives in mem (EverCrypt_Hash_state_len bytes aligned on
+  EverCrypt_Hash_state_align) instead of the heap. The result must not be passed
+  to EverCrypt_Hash_free.
+*/
+EverCrypt_Hash_state_s
+*EverCrypt_Hash_init_in_place(Spec_Hash_Definitions_hash_alg a, uint8_t *mem);
+
 void EverCrypt_Hash_init(EverCrypt_Hash_state_s *s);
 
 void EverCrypt_Hash_update_multi_256(uint32_t *s, uint8_t *blocks, uint32_t n);
 
+/*
+Process n blocks of 64 bytes for each of n_states independent SHA2-256 states.
+s[i] is updated with blocks[i]; every input must hold n * 64 bytes. When SHA
+extensions are not available, groups of eight (AVX2) or four (AVX) states are
+computed in parallel vector lanes.
+*/
+void
+EverCrypt_Hash_update_multi_256_many(
+  uint32_t n_states,
+  uint32_t **s,
+  uint8_t **blocks,
+  uint32_t n
+);
+
+/*
+Process n blocks of 128 bytes of SHA2-384 or SHA2-512 (the two share a
+compression function). With AVX2 and at least two blocks, the message schedule
+of four consecutive blocks is computed in vector lanes.
+*/
+void EverCrypt_Hash_update_multi_512(uint64_t *s, uint8_t *blocks, uint32_t n);
+
+/*
+Same as EverCrypt_Hash_update_multi_256_many, for SHA2-384/512 states; with
+AVX2, groups of four states are computed in parallel vector lanes.
+*/
+void
+EverCrypt_Hash_update_multi_512_many(
+  uint32_t n_states,
+  uint64_t **s,
+  uint8_t **blocks,
+  uint32_t n
+);
+
 void EverCrypt_Hash_update2(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t *block);
 
 KRML_DEPRECATED("Use update2 instead")
@@ -214,6 +266,14 @@ EverCrypt_Hash_update_last_256(
   uint32_t input_len1
 );
 
+void
+EverCrypt_Hash_update_last_512(
+  uint64_t *s,
+  FStar_UInt128_uint128 prev_len,
+  uint8_t *input,
+  uint32_t input_len
+);
+
 void
 EverCrypt_Hash_update_last2(
   EverCrypt_Hash_state_s *s,
@@ -234,6 +294,43 @@ void EverCrypt_Hash_copy(EverCrypt_Hash_state_s *s_src, EverCrypt_Hash_state_s *
 
 void EverCrypt_Hash_hash_256(uint8_t *input, uint32_t input_len, uint8_t *dst);
 
+/*
+Hash n_states independent inputs of the same length input_len with SHA2-256,
+writing the digest of input[i] to dst[i]. See
+EverCrypt_Hash_update_multi_256_many for how lanes are dispatched.
+*/
+void
+EverCrypt_Hash_hash_256_many(
+  uint32_t n_states,
+  uint8_t **dst,
+  uint8_t **input,
+  uint32_t input_len
+);
+
+void EverCrypt_Hash_hash_384(uint8_t *input, uint32_t input_len, uint8_t *dst);
+
+void EverCrypt_Hash_hash_512(uint8_t *input, uint32_t input_len, uint8_t *dst);
+
+/*
+Hash n_states independent inputs of the same length input_len with SHA2-384
+(resp. SHA2-512). See EverCrypt_Hash_update_multi_512_many.
+*/
+void
+EverCrypt_Hash_hash_384_many(
+  uint32_t n_states,
+  uint8_t **dst,
+  uint8_t **input,
+  uint32_t input_len
+);
+
+void
+EverCrypt_Hash_hash_512_many(
+  uint32_t n_states,
+  uint8_t **dst,
+  uint8_t **input,
+  uint32_t input_len
+);
+
 void EverCrypt_Hash_hash_224(uint8_t *input, uint32_t input_len, uint8_t *dst);
 
 void
@@ -259,6 +356,21 @@ Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____;
 Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
 *EverCrypt_Hash_Incremental_create_in(Spec_Hash_Definitions_hash_alg a);
 
+/*
+  Storage for EverCrypt_Hash_Incremental_init_in_place: the streaming state, a
+  block buffer and an EverCrypt_Hash state, for any algorithm.
+*/
+#define EverCrypt_Hash_Incremental_state_len ((uint32_t)304U)
+
+#define EverCrypt_Hash_Incremental_state_align ((uint32_t)8U)
+
+/*
+  Same as EverCrypt_Hash_Incremental_create_in, with everything laid out in
+  mem. The result must not be passed to EverCrypt_Hash_Incremental_free.
+*/
+Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____
+*EverCrypt_Hash_Incremental_init_in_place(Spec_Hash_Definitions_hash_alg a, uint8_t *mem);
+
 void
 EverCrypt_Hash_Incremental_init(Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *s);
 
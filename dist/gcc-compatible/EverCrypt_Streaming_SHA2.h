@@ -0,0 +1,88 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_Streaming_SHA2_H
+#define __EverCrypt_Streaming_SHA2_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Hacl_Hash.h"
+#include "Hacl_Streaming_SHA2.h"
+#include "EverCrypt_Hash.h"
+
+/*
+  SHA2-224 and SHA2-256 over the same streaming state as Hacl_Streaming_SHA2,
+  with blocks compressed by EverCrypt_Hash_update_multi_256, which uses the SHA
+  extensions when the CPU has them. States may be passed to either module.
+*/
+
+Hacl_Streaming_Functor_state_s___uint32_t____ *EverCrypt_Streaming_SHA2_create_in_224();
+
+void EverCrypt_Streaming_SHA2_init_224(Hacl_Streaming_Functor_state_s___uint32_t____ *s);
+
+void
+EverCrypt_Streaming_SHA2_update_224(
+  Hacl_Streaming_Functor_state_s___uint32_t____ *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+void
+EverCrypt_Streaming_SHA2_finish_224(Hacl_Streaming_Functor_state_s___uint32_t____ *p, uint8_t *dst);
+
+void EverCrypt_Streaming_SHA2_free_224(Hacl_Streaming_Functor_state_s___uint32_t____ *s);
+
+Hacl_Streaming_Functor_state_s___uint32_t____ *EverCrypt_Streaming_SHA2_create_in_256();
+
+void EverCrypt_Streaming_SHA2_init_256(Hacl_Streaming_Functor_state_s___uint32_t____ *s);
+
+void
+EverCrypt_Streaming_SHA2_update_256(
+  Hacl_Streaming_Functor_state_s___uint32_t____ *p,
+  uint8_t *data,
+  uint32_t len
+);
+
+void
+EverCrypt_Streaming_SHA2_finish_256(Hacl_Streaming_Functor_state_s___uint32_t____ *p, uint8_t *dst);
+
+void EverCrypt_Streaming_SHA2_free_256(Hacl_Streaming_Functor_state_s___uint32_t____ *s);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_Streaming_SHA2_H_DEFINED
+#endif
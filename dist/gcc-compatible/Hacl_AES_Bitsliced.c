@@ -0,0 +1,679 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_AES_Bitsliced.h"
+
+/*
+  Constant-time AES in the "ct64" bitsliced representation: four blocks are
+  processed at once as eight 64-bit words, word i holding bit i of every byte.
+  The S-box is the Boyar-Peralta circuit, so no memory access depends on
+  secret data. GHASH uses integer multiplications on spread-out bits, which
+  yields an exact carry-less product without table lookups.
+
+  The representation, ortho, shift_rows, mix_columns and bmul64 follow the
+  aes_ct64 and ghash_ctmul64 code of BearSSL (Thomas Pornin, MIT license).
+*/
+
+static void sbox(uint64_t *q)
+{
+  uint64_t x0 = q[7U];
+  uint64_t x1 = q[6U];
+  uint64_t x2 = q[5U];
+  uint64_t x3 = q[4U];
+  uint64_t x4 = q[3U];
+  uint64_t x5 = q[2U];
+  uint64_t x6 = q[1U];
+  uint64_t x7 = q[0U];
+  /* Top linear transformation */
+  uint64_t y14 = x3 ^ x5;
+  uint64_t y13 = x0 ^ x6;
+  uint64_t y9 = x0 ^ x3;
+  uint64_t y8 = x0 ^ x5;
+  uint64_t t0 = x1 ^ x2;
+  uint64_t y1 = t0 ^ x7;
+  uint64_t y4 = y1 ^ x3;
+  uint64_t y12 = y13 ^ y14;
+  uint64_t y2 = y1 ^ x0;
+  uint64_t y5 = y1 ^ x6;
+  uint64_t y3 = y5 ^ y8;
+  uint64_t t1 = x4 ^ y12;
+  uint64_t y15 = t1 ^ x5;
+  uint64_t y20 = t1 ^ x1;
+  uint64_t y6 = y15 ^ x7;
+  uint64_t y10 = y15 ^ t0;
+  uint64_t y11 = y20 ^ y9;
+  uint64_t y7 = x7 ^ y11;
+  uint64_t y17 = y10 ^ y11;
+  uint64_t y19 = y10 ^ y8;
+  uint64_t y16 = t0 ^ y11;
+  uint64_t y21 = y13 ^ y16;
+  uint64_t y18 = x0 ^ y16;
+  /* Non-linear section */
+  uint64_t t2 = y12 & y15;
+  uint64_t t3 = y3 & y6;
+  uint64_t t4 = t3 ^ t2;
+  uint64_t t5 = y4 & x7;
+  uint64_t t6 = t5 ^ t2;
+  uint64_t t7 = y13 & y16;
+  uint64_t t8 = y5 & y1;
+  uint64_t t9 = t8 ^ t7;
+  uint64_t t10 = y2 & y7;
+  uint64_t t11 = t10 ^ t7;
+  uint64_t t12 = y9 & y11;
+  uint64_t t13 = y14 & y17;
+  uint64_t t14 = t13 ^ t12;
+  uint64_t t15 = y8 & y10;
+  uint64_t t16 = t15 ^ t12;
+  uint64_t t17 = t4 ^ t14;
+  uint64_t t18 = t6 ^ t16;
+  uint64_t t19 = t9 ^ t14;
+  uint64_t t20 = t11 ^ t16;
+  uint64_t t21 = t17 ^ y20;
+  uint64_t t22 = t18 ^ y19;
+  uint64_t t23 = t19 ^ y21;
+  uint64_t t24 = t20 ^ y18;
+  uint64_t t25 = t21 ^ t22;
+  uint64_t t26 = t21 & t23;
+  uint64_t t27 = t24 ^ t26;
+  uint64_t t28 = t25 & t27;
+  uint64_t t29 = t28 ^ t22;
+  uint64_t t30 = t23 ^ t24;
+  uint64_t t31 = t22 ^ t26;
+  uint64_t t32 = t31 & t30;
+  uint64_t t33 = t32 ^ t24;
+  uint64_t t34 = t23 ^ t33;
+  uint64_t t35 = t27 ^ t33;
+  uint64_t t36 = t24 & t35;
+  uint64_t t37 = t36 ^ t34;
+  uint64_t t38 = t27 ^ t36;
+  uint64_t t39 = t29 & t38;
+  uint64_t t40 = t25 ^ t39;
+  uint64_t t41 = t40 ^ t37;
+  uint64_t t42 = t29 ^ t33;
+  uint64_t t43 = t29 ^ t40;
+  uint64_t t44 = t33 ^ t37;
+  uint64_t t45 = t42 ^ t41;
+  uint64_t z0 = t44 & y15;
+  uint64_t z1 = t37 & y6;
+  uint64_t z2 = t33 & x7;
+  uint64_t z3 = t43 & y16;
+  uint64_t z4 = t40 & y1;
+  uint64_t z5 = t29 & y7;
+  uint64_t z6 = t42 & y11;
+  uint64_t z7 = t45 & y17;
+  uint64_t z8 = t41 & y10;
+  uint64_t z9 = t44 & y12;
+  uint64_t z10 = t37 & y3;
+  uint64_t z11 = t33 & y4;
+  uint64_t z12 = t43 & y13;
+  uint64_t z13 = t40 & y5;
+  uint64_t z14 = t29 & y2;
+  uint64_t z15 = t42 & y9;
+  uint64_t z16 = t45 & y14;
+  uint64_t z17 = t41 & y8;
+  /* Bottom linear transformation */
+  uint64_t t46 = z15 ^ z16;
+  uint64_t t47 = z10 ^ z11;
+  uint64_t t48 = z5 ^ z13;
+  uint64_t t49 = z9 ^ z10;
+  uint64_t t50 = z2 ^ z12;
+  uint64_t t51 = z2 ^ z5;
+  uint64_t t52 = z7 ^ z8;
+  uint64_t t53 = z0 ^ z3;
+  uint64_t t54 = z6 ^ z7;
+  uint64_t t55 = z16 ^ z17;
+  uint64_t t56 = z12 ^ t48;
+  uint64_t t57 = t50 ^ t53;
+  uint64_t t58 = z4 ^ t46;
+  uint64_t t59 = z3 ^ t54;
+  uint64_t t60 = t46 ^ t57;
+  uint64_t t61 = z14 ^ t57;
+  uint64_t t62 = t52 ^ t58;
+  uint64_t t63 = t49 ^ t58;
+  uint64_t t64 = z4 ^ t59;
+  uint64_t t65 = t61 ^ t62;
+  uint64_t t66 = z1 ^ t63;
+  uint64_t s0 = t59 ^ t63;
+  uint64_t s6 = t56 ^ ~t62;
+  uint64_t s7 = t48 ^ ~t60;
+  uint64_t t67 = t64 ^ t65;
+  uint64_t s3 = t53 ^ t66;
+  uint64_t s4 = t51 ^ t66;
+  uint64_t s5 = t47 ^ t65;
+  uint64_t s1 = t64 ^ ~s3;
+  uint64_t s2 = t55 ^ ~t67;
+  q[7U] = s0;
+  q[6U] = s1;
+  q[5U] = s2;
+  q[4U] = s3;
+  q[3U] = s4;
+  q[2U] = s5;
+  q[1U] = s6;
+  q[0U] = s7;
+}
+
+static inline void swapn(uint64_t cl, uint64_t ch, uint32_t s, uint64_t *x, uint64_t *y)
+{
+  uint64_t a = x[0U];
+  uint64_t b = y[0U];
+  x[0U] = (a & cl) | (b & cl) << s;
+  y[0U] = (a & ch) >> s | (b & ch);
+}
+
+/* Converts between four interleaved blocks and the bitsliced form (an involution) */
+static void ortho(uint64_t *q)
+{
+  uint64_t m1l = (uint64_t)0x5555555555555555U;
+  uint64_t m1h = (uint64_t)0xAAAAAAAAAAAAAAAAU;
+  uint64_t m2l = (uint64_t)0x3333333333333333U;
+  uint64_t m2h = (uint64_t)0xCCCCCCCCCCCCCCCCU;
+  uint64_t m4l = (uint64_t)0x0F0F0F0F0F0F0F0FU;
+  uint64_t m4h = (uint64_t)0xF0F0F0F0F0F0F0F0U;
+  swapn(m1l, m1h, (uint32_t)1U, q, q + (uint32_t)1U);
+  swapn(m1l, m1h, (uint32_t)1U, q + (uint32_t)2U, q + (uint32_t)3U);
+  swapn(m1l, m1h, (uint32_t)1U, q + (uint32_t)4U, q + (uint32_t)5U);
+  swapn(m1l, m1h, (uint32_t)1U, q + (uint32_t)6U, q + (uint32_t)7U);
+  swapn(m2l, m2h, (uint32_t)2U, q, q + (uint32_t)2U);
+  swapn(m2l, m2h, (uint32_t)2U, q + (uint32_t)1U, q + (uint32_t)3U);
+  swapn(m2l, m2h, (uint32_t)2U, q + (uint32_t)4U, q + (uint32_t)6U);
+  swapn(m2l, m2h, (uint32_t)2U, q + (uint32_t)5U, q + (uint32_t)7U);
+  swapn(m4l, m4h, (uint32_t)4U, q, q + (uint32_t)4U);
+  swapn(m4l, m4h, (uint32_t)4U, q + (uint32_t)1U, q + (uint32_t)5U);
+  swapn(m4l, m4h, (uint32_t)4U, q + (uint32_t)2U, q + (uint32_t)6U);
+  swapn(m4l, m4h, (uint32_t)4U, q + (uint32_t)3U, q + (uint32_t)7U);
+}
+
+static inline uint64_t spread16(uint32_t w)
+{
+  uint64_t x = (uint64_t)w;
+  x = (x | x << (uint32_t)16U) & (uint64_t)0x0000FFFF0000FFFFU;
+  return (x | x << (uint32_t)8U) & (uint64_t)0x00FF00FF00FF00FFU;
+}
+
+static inline uint32_t unspread16(uint64_t x)
+{
+  uint64_t y = x & (uint64_t)0x00FF00FF00FF00FFU;
+  y = (y | y >> (uint32_t)8U) & (uint64_t)0x0000FFFF0000FFFFU;
+  return (uint32_t)y | (uint32_t)(y >> (uint32_t)16U);
+}
+
+static inline void interleave_in(uint64_t *q0, uint64_t *q1, uint32_t *w)
+{
+  q0[0U] = spread16(w[0U]) | spread16(w[2U]) << (uint32_t)8U;
+  q1[0U] = spread16(w[1U]) | spread16(w[3U]) << (uint32_t)8U;
+}
+
+static inline void interleave_out(uint32_t *w, uint64_t q0, uint64_t q1)
+{
+  w[0U] = unspread16(q0);
+  w[1U] = unspread16(q1);
+  w[2U] = unspread16(q0 >> (uint32_t)8U);
+  w[3U] = unspread16(q1 >> (uint32_t)8U);
+}
+
+static inline void add_round_key(uint64_t *q, uint64_t *sk)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    q[i] = q[i] ^ sk[i];
+  }
+}
+
+/* shift_rows and mix_columns: BearSSL's aes_ct64 ShiftRows and MixColumns */
+static inline void shift_rows(uint64_t *q)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint64_t x = q[i];
+    q[i] =
+      (x & (uint64_t)0x000000000000FFFFU)
+      | (x & (uint64_t)0x00000000FFF00000U) >> (uint32_t)4U
+      | (x & (uint64_t)0x00000000000F0000U) << (uint32_t)12U
+      | (x & (uint64_t)0x0000FF0000000000U) >> (uint32_t)8U
+      | (x & (uint64_t)0x000000FF00000000U) << (uint32_t)8U
+      | (x & (uint64_t)0xF000000000000000U) >> (uint32_t)12U
+      | (x & (uint64_t)0x0FFF000000000000U) << (uint32_t)4U;
+  }
+}
+
+static inline uint64_t rotr32(uint64_t x)
+{
+  return x << (uint32_t)32U | x >> (uint32_t)32U;
+}
+
+static inline void mix_columns(uint64_t *q)
+{
+  uint64_t r[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    r[i] = q[i] >> (uint32_t)16U | q[i] << (uint32_t)48U;
+  }
+  uint64_t q0 = q[0U];
+  uint64_t q1 = q[1U];
+  uint64_t q2 = q[2U];
+  uint64_t q3 = q[3U];
+  uint64_t q4 = q[4U];
+  uint64_t q5 = q[5U];
+  uint64_t q6 = q[6U];
+  uint64_t q7 = q[7U];
+  q[0U] = q7 ^ r[7U] ^ r[0U] ^ rotr32(q0 ^ r[0U]);
+  q[1U] = q0 ^ r[0U] ^ q7 ^ r[7U] ^ r[1U] ^ rotr32(q1 ^ r[1U]);
+  q[2U] = q1 ^ r[1U] ^ r[2U] ^ rotr32(q2 ^ r[2U]);
+  q[3U] = q2 ^ r[2U] ^ q7 ^ r[7U] ^ r[3U] ^ rotr32(q3 ^ r[3U]);
+  q[4U] = q3 ^ r[3U] ^ q7 ^ r[7U] ^ r[4U] ^ rotr32(q4 ^ r[4U]);
+  q[5U] = q4 ^ r[4U] ^ r[5U] ^ rotr32(q5 ^ r[5U]);
+  q[6U] = q5 ^ r[5U] ^ r[6U] ^ rotr32(q6 ^ r[6U]);
+  q[7U] = q6 ^ r[6U] ^ r[7U] ^ rotr32(q7 ^ r[7U]);
+}
+
+static inline uint32_t sub_word(uint32_t x)
+{
+  uint64_t q[8U] = { 0U };
+  q[0U] = (uint64_t)x;
+  ortho(q);
+  sbox(q);
+  ortho(q);
+  return (uint32_t)q[0U];
+}
+
+static const
+uint8_t rcon[10U] = { 0x01U, 0x02U, 0x04U, 0x08U, 0x10U, 0x20U, 0x40U, 0x80U, 0x1bU, 0x36U };
+
+/* Expands a 16- or 32-byte key into (nr + 1) bitsliced round keys of 8 words */
+static uint32_t key_expansion(uint64_t *skey, uint32_t key_len, uint8_t *key)
+{
+  uint32_t nr;
+  if (key_len == (uint32_t)16U)
+  {
+    nr = (uint32_t)10U;
+  }
+  else
+  {
+    nr = (uint32_t)14U;
+  }
+  uint32_t nk = key_len / (uint32_t)4U;
+  uint32_t nkf = (nr + (uint32_t)1U) * (uint32_t)4U;
+  uint32_t w[60U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < nk; i++)
+  {
+    w[i] = load32_le(key + i * (uint32_t)4U);
+  }
+  uint32_t tmp = w[nk - (uint32_t)1U];
+  uint32_t j = (uint32_t)0U;
+  uint32_t k = (uint32_t)0U;
+  for (uint32_t i = nk; i < nkf; i++)
+  {
+    if (j == (uint32_t)0U)
+    {
+      tmp = tmp << (uint32_t)24U | tmp >> (uint32_t)8U;
+      tmp = sub_word(tmp) ^ (uint32_t)rcon[k];
+    }
+    else if (nk > (uint32_t)6U && j == (uint32_t)4U)
+    {
+      tmp = sub_word(tmp);
+    }
+    tmp = tmp ^ w[i - nk];
+    w[i] = tmp;
+    j++;
+    if (j == nk)
+    {
+      j = (uint32_t)0U;
+      k++;
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i <= nr; i++)
+  {
+    uint64_t q[8U] = { 0U };
+    interleave_in(q, q + (uint32_t)4U, w + i * (uint32_t)4U);
+    q[1U] = q[0U];
+    q[2U] = q[0U];
+    q[3U] = q[0U];
+    q[5U] = q[4U];
+    q[6U] = q[4U];
+    q[7U] = q[4U];
+    ortho(q);
+    uint64_t c[2U] = { 0U };
+    c[0U] =
+      (q[0U] & (uint64_t)0x1111111111111111U)
+      | (q[1U] & (uint64_t)0x2222222222222222U)
+      | (q[2U] & (uint64_t)0x4444444444444444U)
+      | (q[3U] & (uint64_t)0x8888888888888888U);
+    c[1U] =
+      (q[4U] & (uint64_t)0x1111111111111111U)
+      | (q[5U] & (uint64_t)0x2222222222222222U)
+      | (q[6U] & (uint64_t)0x4444444444444444U)
+      | (q[7U] & (uint64_t)0x8888888888888888U);
+    for (uint32_t u = (uint32_t)0U; u < (uint32_t)2U; u++)
+    {
+      uint64_t x0 = c[u] & (uint64_t)0x1111111111111111U;
+      uint64_t x1 = (c[u] & (uint64_t)0x2222222222222222U) >> (uint32_t)1U;
+      uint64_t x2 = (c[u] & (uint64_t)0x4444444444444444U) >> (uint32_t)2U;
+      uint64_t x3 = (c[u] & (uint64_t)0x8888888888888888U) >> (uint32_t)3U;
+      uint64_t *sk = skey + i * (uint32_t)8U + u * (uint32_t)4U;
+      sk[0U] = (x0 << (uint32_t)4U) - x0;
+      sk[1U] = (x1 << (uint32_t)4U) - x1;
+      sk[2U] = (x2 << (uint32_t)4U) - x2;
+      sk[3U] = (x3 << (uint32_t)4U) - x3;
+    }
+  }
+  Lib_Memzero0_memzero(w, (uint32_t)60U * sizeof (w[0U]));
+  return nr;
+}
+
+static void encrypt_bitsliced(uint32_t nr, uint64_t *skey, uint64_t *q)
+{
+  add_round_key(q, skey);
+  for (uint32_t i = (uint32_t)1U; i < nr; i++)
+  {
+    sbox(q);
+    shift_rows(q);
+    mix_columns(q);
+    add_round_key(q, skey + i * (uint32_t)8U);
+  }
+  sbox(q);
+  shift_rows(q);
+  add_round_key(q, skey + nr * (uint32_t)8U);
+}
+
+/* Encrypts four blocks given as sixteen little-endian words, in place */
+static void encrypt4(uint64_t *ctx, uint32_t *w)
+{
+  uint64_t q[8U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    interleave_in(q + i, q + i + (uint32_t)4U, w + i * (uint32_t)4U);
+  }
+  ortho(q);
+  encrypt_bitsliced((uint32_t)ctx[0U], ctx + (uint32_t)1U, q);
+  ortho(q);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    interleave_out(w + i * (uint32_t)4U, q[i], q[i + (uint32_t)4U]);
+  }
+}
+
+static void encrypt_block(uint64_t *ctx, uint8_t *out, uint8_t *in)
+{
+  uint32_t w[16U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    w[i] = load32_le(in + i * (uint32_t)4U);
+  }
+  encrypt4(ctx, w);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    store32_le(out + i * (uint32_t)4U, w[i]);
+  }
+}
+
+/* Counter mode starting from the 16-byte block j with a 32-bit big-endian counter */
+static void ctr(uint64_t *ctx, uint8_t *j, uint32_t len, uint8_t *out, uint8_t *in)
+{
+  uint32_t iv0 = load32_le(j);
+  uint32_t iv1 = load32_le(j + (uint32_t)4U);
+  uint32_t iv2 = load32_le(j + (uint32_t)8U);
+  uint32_t c = load32_be(j + (uint32_t)12U);
+  uint32_t nb = (len + (uint32_t)63U) / (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint32_t w[16U] = { 0U };
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)4U; k++)
+    {
+      w[k * (uint32_t)4U] = iv0;
+      w[k * (uint32_t)4U + (uint32_t)1U] = iv1;
+      w[k * (uint32_t)4U + (uint32_t)2U] = iv2;
+      uint8_t cb[4U] = { 0U };
+      store32_be(cb, c + i * (uint32_t)4U + k);
+      w[k * (uint32_t)4U + (uint32_t)3U] = load32_le(cb);
+    }
+    encrypt4(ctx, w);
+    uint8_t ks[64U] = { 0U };
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)16U; k++)
+    {
+      store32_le(ks + k * (uint32_t)4U, w[k]);
+    }
+    uint32_t l = len - i * (uint32_t)64U;
+    if (l > (uint32_t)64U)
+    {
+      l = (uint32_t)64U;
+    }
+    for (uint32_t k = (uint32_t)0U; k < l; k++)
+    {
+      out[i * (uint32_t)64U + k] = in[i * (uint32_t)64U + k] ^ ks[k];
+    }
+  }
+}
+
+/* Carry-less 64x64 multiplication, low half. Spreading the operands over
+   every fourth bit keeps each integer carry out of the bits that are kept. */
+static inline uint64_t bmul64(uint64_t x, uint64_t y)
+{
+  uint64_t m0 = (uint64_t)0x1111111111111111U;
+  uint64_t m1 = (uint64_t)0x2222222222222222U;
+  uint64_t m2 = (uint64_t)0x4444444444444444U;
+  uint64_t m3 = (uint64_t)0x8888888888888888U;
+  uint64_t x0 = x & m0;
+  uint64_t x1 = x & m1;
+  uint64_t x2 = x & m2;
+  uint64_t x3 = x & m3;
+  uint64_t y0 = y & m0;
+  uint64_t y1 = y & m1;
+  uint64_t y2 = y & m2;
+  uint64_t y3 = y & m3;
+  uint64_t z0 = x0 * y0 ^ x1 * y3 ^ x2 * y2 ^ x3 * y1;
+  uint64_t z1 = x0 * y1 ^ x1 * y0 ^ x2 * y3 ^ x3 * y2;
+  uint64_t z2 = x0 * y2 ^ x1 * y1 ^ x2 * y0 ^ x3 * y3;
+  uint64_t z3 = x0 * y3 ^ x1 * y2 ^ x2 * y1 ^ x3 * y0;
+  return (z0 & m0) | (z1 & m1) | (z2 & m2) | (z3 & m3);
+}
+
+static inline uint64_t rev64(uint64_t x)
+{
+  x = (x & (uint64_t)0x5555555555555555U) << (uint32_t)1U
+    | (x >> (uint32_t)1U & (uint64_t)0x5555555555555555U);
+  x = (x & (uint64_t)0x3333333333333333U) << (uint32_t)2U
+    | (x >> (uint32_t)2U & (uint64_t)0x3333333333333333U);
+  x = (x & (uint64_t)0x0F0F0F0F0F0F0F0FU) << (uint32_t)4U
+    | (x >> (uint32_t)4U & (uint64_t)0x0F0F0F0F0F0F0F0FU);
+  x = (x & (uint64_t)0x00FF00FF00FF00FFU) << (uint32_t)8U
+    | (x >> (uint32_t)8U & (uint64_t)0x00FF00FF00FF00FFU);
+  x = (x & (uint64_t)0x0000FFFF0000FFFFU) << (uint32_t)16U
+    | (x >> (uint32_t)16U & (uint64_t)0x0000FFFF0000FFFFU);
+  return x << (uint32_t)32U | x >> (uint32_t)32U;
+}
+
+/* y = (y + x) * h in GF(2^128), with GCM's bit order; y and h are {hi; lo} */
+static void gf128_add_mul(uint64_t *y, uint64_t *h, uint64_t x1, uint64_t x0)
+{
+  uint64_t h1 = h[0U];
+  uint64_t h0 = h[1U];
+  uint64_t h0r = rev64(h0);
+  uint64_t h1r = rev64(h1);
+  uint64_t h2 = h0 ^ h1;
+  uint64_t h2r = h0r ^ h1r;
+  uint64_t y1 = y[0U] ^ x1;
+  uint64_t y0 = y[1U] ^ x0;
+  uint64_t y0r = rev64(y0);
+  uint64_t y1r = rev64(y1);
+  uint64_t y2 = y0 ^ y1;
+  uint64_t y2r = y0r ^ y1r;
+  uint64_t z0 = bmul64(y0, h0);
+  uint64_t z1 = bmul64(y1, h1);
+  uint64_t z2 = bmul64(y2, h2);
+  uint64_t z0h = bmul64(y0r, h0r);
+  uint64_t z1h = bmul64(y1r, h1r);
+  uint64_t z2h = bmul64(y2r, h2r);
+  z2 = z2 ^ z0 ^ z1;
+  z2h = z2h ^ z0h ^ z1h;
+  z0h = rev64(z0h) >> (uint32_t)1U;
+  z1h = rev64(z1h) >> (uint32_t)1U;
+  z2h = rev64(z2h) >> (uint32_t)1U;
+  uint64_t v0 = z0;
+  uint64_t v1 = z0h ^ z2;
+  uint64_t v2 = z1 ^ z2h;
+  uint64_t v3 = z1h;
+  v3 = v3 << (uint32_t)1U | v2 >> (uint32_t)63U;
+  v2 = v2 << (uint32_t)1U | v1 >> (uint32_t)63U;
+  v1 = v1 << (uint32_t)1U | v0 >> (uint32_t)63U;
+  v0 = v0 << (uint32_t)1U;
+  v2 = v2 ^ v0 ^ v0 >> (uint32_t)1U ^ v0 >> (uint32_t)2U ^ v0 >> (uint32_t)7U;
+  v1 = v1 ^ v0 << (uint32_t)63U ^ v0 << (uint32_t)62U ^ v0 << (uint32_t)57U;
+  v3 = v3 ^ v1 ^ v1 >> (uint32_t)1U ^ v1 >> (uint32_t)2U ^ v1 >> (uint32_t)7U;
+  v2 = v2 ^ v1 << (uint32_t)63U ^ v1 << (uint32_t)62U ^ v1 << (uint32_t)57U;
+  y[0U] = v3;
+  y[1U] = v2;
+}
+
+/* Absorbs text, zero-padded to a multiple of 16 bytes */
+static void ghash_padded(uint64_t *y, uint64_t *h, uint32_t len, uint8_t *text)
+{
+  uint32_t nb = len / (uint32_t)16U;
+  uint32_t rem = len % (uint32_t)16U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *b = text + i * (uint32_t)16U;
+    gf128_add_mul(y, h, load64_be(b), load64_be(b + (uint32_t)8U));
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t b[16U] = { 0U };
+    memcpy(b, text + nb * (uint32_t)16U, rem * sizeof (uint8_t));
+    gf128_add_mul(y, h, load64_be(b), load64_be(b + (uint32_t)8U));
+  }
+}
+
+static void init(uint64_t *ctx, uint32_t key_len, uint8_t *key)
+{
+  ctx[0U] = (uint64_t)key_expansion(ctx + (uint32_t)1U, key_len, key);
+  uint8_t zero[16U] = { 0U };
+  uint8_t h[16U] = { 0U };
+  encrypt_block(ctx, h, zero);
+  ctx[121U] = load64_be(h);
+  ctx[122U] = load64_be(h + (uint32_t)8U);
+  Lib_Memzero0_memzero(h, (uint32_t)16U * sizeof (h[0U]));
+}
+
+void Hacl_AES_Bitsliced_aes128_gcm_init(uint64_t *ctx, uint8_t *key)
+{
+  init(ctx, (uint32_t)16U, key);
+}
+
+void Hacl_AES_Bitsliced_aes256_gcm_init(uint64_t *ctx, uint8_t *key)
+{
+  init(ctx, (uint32_t)32U, key);
+}
+
+static void compute_j0(uint64_t *ctx, uint8_t *j0, uint32_t iv_len, uint8_t *iv)
+{
+  if (iv_len == (uint32_t)12U)
+  {
+    memcpy(j0, iv, (uint32_t)12U * sizeof (uint8_t));
+    store32_be(j0 + (uint32_t)12U, (uint32_t)1U);
+  }
+  else
+  {
+    uint64_t y[2U] = { 0U };
+    ghash_padded(y, ctx + (uint32_t)121U, iv_len, iv);
+    gf128_add_mul(y, ctx + (uint32_t)121U, (uint64_t)0U, (uint64_t)iv_len * (uint64_t)8U);
+    store64_be(j0, y[0U]);
+    store64_be(j0 + (uint32_t)8U, y[1U]);
+  }
+}
+
+static void
+compute_tag(
+  uint64_t *ctx,
+  uint8_t *j0,
+  uint32_t ad_len,
+  uint8_t *ad,
+  uint32_t len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  uint64_t *h = ctx + (uint32_t)121U;
+  uint64_t y[2U] = { 0U };
+  ghash_padded(y, h, ad_len, ad);
+  ghash_padded(y, h, len, cipher);
+  gf128_add_mul(y, h, (uint64_t)ad_len * (uint64_t)8U, (uint64_t)len * (uint64_t)8U);
+  uint8_t s[16U] = { 0U };
+  encrypt_block(ctx, s, j0);
+  store64_be(tag, load64_be(s) ^ y[0U]);
+  store64_be(tag + (uint32_t)8U, load64_be(s + (uint32_t)8U) ^ y[1U]);
+}
+
+void
+Hacl_AES_Bitsliced_aes_gcm_encrypt(
+  uint64_t *ctx,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint32_t ad_len,
+  uint8_t *ad,
+  uint32_t len,
+  uint8_t *plain,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  uint8_t j0[16U] = { 0U };
+  compute_j0(ctx, j0, iv_len, iv);
+  uint8_t j1[16U] = { 0U };
+  memcpy(j1, j0, (uint32_t)16U * sizeof (uint8_t));
+  store32_be(j1 + (uint32_t)12U, load32_be(j0 + (uint32_t)12U) + (uint32_t)1U);
+  ctr(ctx, j1, len, cipher, plain);
+  compute_tag(ctx, j0, ad_len, ad, len, cipher, tag);
+}
+
+bool
+Hacl_AES_Bitsliced_aes_gcm_decrypt(
+  uint64_t *ctx,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint32_t ad_len,
+  uint8_t *ad,
+  uint32_t len,
+  uint8_t *plain,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  uint8_t j0[16U] = { 0U };
+  compute_j0(ctx, j0, iv_len, iv);
+  uint8_t computed[16U] = { 0U };
+  compute_tag(ctx, j0, ad_len, ad, len, cipher, computed);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    res = FStar_UInt8_eq_mask(computed[i], tag[i]) & res;
+  }
+  if (res == (uint8_t)255U)
+  {
+    uint8_t j1[16U] = { 0U };
+    memcpy(j1, j0, (uint32_t)16U * sizeof (uint8_t));
+    store32_be(j1 + (uint32_t)12U, load32_be(j0 + (uint32_t)12U) + (uint32_t)1U);
+    ctr(ctx, j1, len, plain, cipher);
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,94 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_AES_Bitsliced_H
+#define __Hacl_AES_Bitsliced_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+#include "Hacl_Kremlib.h"
+#include "Lib_Memzero0.h"
+
+/*
+  Portable, constant-time AES-GCM for machines without AES-NI and PCLMULQDQ.
+
+  The context is an array of Hacl_AES_Bitsliced_ctx_len uint64_t: the number
+  of rounds, the bitsliced round keys and the GHASH key. It holds key material
+  and should be zeroed after use.
+*/
+#define Hacl_AES_Bitsliced_ctx_len ((uint32_t)123U)
+
+void Hacl_AES_Bitsliced_aes128_gcm_init(uint64_t *ctx, uint8_t *key);
+
+void Hacl_AES_Bitsliced_aes256_gcm_init(uint64_t *ctx, uint8_t *key);
+
+/*
+  iv_len must be non-zero; 12-byte IVs take the fast path of the standard.
+*/
+void
+Hacl_AES_Bitsliced_aes_gcm_encrypt(
+  uint64_t *ctx,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint32_t ad_len,
+  uint8_t *ad,
+  uint32_t len,
+  uint8_t *plain,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+/*
+  Checks the tag before decrypting: on failure, false is returned and plain
+  is left untouched.
+*/
+bool
+Hacl_AES_Bitsliced_aes_gcm_decrypt(
+  uint64_t *ctx,
+  uint32_t iv_len,
+  uint8_t *iv,
+  uint32_t ad_len,
+  uint8_t *ad,
+  uint32_t len,
+  uint8_t *plain,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AES_Bitsliced_H_DEFINED
+#endif
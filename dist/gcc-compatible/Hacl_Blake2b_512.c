@@ -0,0 +1,380 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Blake2b_512.h"
+
+/*
+  A Blake2b state is four rows of four 64-bit words, i.e. one vec256 per row.
+  In this implementation, each vec512 row holds the rows of two independent
+  Blake2b states, one per 256-bit half, so that two messages are hashed at
+  once with the same instruction stream as Hacl_Blake2b_256.
+*/
+
+static inline void
+blake2b_update_block(
+  Lib_IntVector_Intrinsics_vec512 *wv,
+  Lib_IntVector_Intrinsics_vec512 *hash,
+  bool flag,
+  FStar_UInt128_uint128 totlen,
+  uint8_t *d0,
+  uint8_t *d1
+)
+{
+  uint64_t m_w[32U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    m_w[i] = load64_le(d0 + i * (uint32_t)8U);
+    m_w[(uint32_t)16U + i] = load64_le(d1 + i * (uint32_t)8U);
+  }
+  Lib_IntVector_Intrinsics_vec512 mask = Lib_IntVector_Intrinsics_vec512_zero;
+  uint64_t wv_14;
+  if (flag)
+  {
+    wv_14 = (uint64_t)0xFFFFFFFFFFFFFFFFU;
+  }
+  else
+  {
+    wv_14 = (uint64_t)0U;
+  }
+  uint64_t wv_15 = (uint64_t)0U;
+  mask =
+    Lib_IntVector_Intrinsics_vec512_load64s(FStar_UInt128_uint128_to_uint64(totlen),
+      FStar_UInt128_uint128_to_uint64(FStar_UInt128_shift_right(totlen, (uint32_t)64U)),
+      wv_14,
+      wv_15,
+      FStar_UInt128_uint128_to_uint64(totlen),
+      FStar_UInt128_uint128_to_uint64(FStar_UInt128_shift_right(totlen, (uint32_t)64U)),
+      wv_14,
+      wv_15);
+  memcpy(wv, hash, (uint32_t)4U * (uint32_t)1U * sizeof (Lib_IntVector_Intrinsics_vec512));
+  Lib_IntVector_Intrinsics_vec512 *wv3 = wv + (uint32_t)3U * (uint32_t)1U;
+  wv3[0U] = Lib_IntVector_Intrinsics_vec512_xor(wv3[0U], mask);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)12U; i++)
+  {
+    uint32_t start_idx = i % (uint32_t)10U * (uint32_t)16U;
+    KRML_CHECK_SIZE(sizeof (Lib_IntVector_Intrinsics_vec512), (uint32_t)4U * (uint32_t)1U);
+    Lib_IntVector_Intrinsics_vec512 m_st[(uint32_t)4U * (uint32_t)1U];
+    for (uint32_t _i = 0U; _i < (uint32_t)4U * (uint32_t)1U; ++_i)
+      m_st[_i] = Lib_IntVector_Intrinsics_vec512_zero;
+    Lib_IntVector_Intrinsics_vec512 *r0 = m_st + (uint32_t)0U * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *r1 = m_st + (uint32_t)1U * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *r20 = m_st + (uint32_t)2U * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *r30 = m_st + (uint32_t)3U * (uint32_t)1U;
+    uint32_t s0 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx];
+    uint32_t s1 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)1U];
+    uint32_t s2 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)2U];
+    uint32_t s3 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)3U];
+    uint32_t s4 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)4U];
+    uint32_t s5 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)5U];
+    uint32_t s6 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)6U];
+    uint32_t s7 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)7U];
+    uint32_t s8 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)8U];
+    uint32_t s9 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)9U];
+    uint32_t s10 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)10U];
+    uint32_t s11 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)11U];
+    uint32_t s12 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)12U];
+    uint32_t s13 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)13U];
+    uint32_t s14 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)14U];
+    uint32_t s15 = Hacl_Impl_Blake2_Constants_sigmaTable[start_idx + (uint32_t)15U];
+    r0[0U] =
+      Lib_IntVector_Intrinsics_vec512_load64s(m_w[s0],
+        m_w[s2],
+        m_w[s4],
+        m_w[s6],
+        m_w[(uint32_t)16U + s0],
+        m_w[(uint32_t)16U + s2],
+        m_w[(uint32_t)16U + s4],
+        m_w[(uint32_t)16U + s6]);
+    r1[0U] =
+      Lib_IntVector_Intrinsics_vec512_load64s(m_w[s1],
+        m_w[s3],
+        m_w[s5],
+        m_w[s7],
+        m_w[(uint32_t)16U + s1],
+        m_w[(uint32_t)16U + s3],
+        m_w[(uint32_t)16U + s5],
+        m_w[(uint32_t)16U + s7]);
+    r20[0U] =
+      Lib_IntVector_Intrinsics_vec512_load64s(m_w[s8],
+        m_w[s10],
+        m_w[s12],
+        m_w[s14],
+        m_w[(uint32_t)16U + s8],
+        m_w[(uint32_t)16U + s10],
+        m_w[(uint32_t)16U + s12],
+        m_w[(uint32_t)16U + s14]);
+    r30[0U] =
+      Lib_IntVector_Intrinsics_vec512_load64s(m_w[s9],
+        m_w[s11],
+        m_w[s13],
+        m_w[s15],
+        m_w[(uint32_t)16U + s9],
+        m_w[(uint32_t)16U + s11],
+        m_w[(uint32_t)16U + s13],
+        m_w[(uint32_t)16U + s15]);
+    Lib_IntVector_Intrinsics_vec512 *x = m_st + (uint32_t)0U * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *y = m_st + (uint32_t)1U * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *z = m_st + (uint32_t)2U * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *w = m_st + (uint32_t)3U * (uint32_t)1U;
+    uint32_t a = (uint32_t)0U;
+    uint32_t b0 = (uint32_t)1U;
+    uint32_t c0 = (uint32_t)2U;
+    uint32_t d10 = (uint32_t)3U;
+    Lib_IntVector_Intrinsics_vec512 *wv_a0 = wv + a * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b0 = wv + b0 * (uint32_t)1U;
+    wv_a0[0U] = Lib_IntVector_Intrinsics_vec512_add64(wv_a0[0U], wv_b0[0U]);
+    wv_a0[0U] = Lib_IntVector_Intrinsics_vec512_add64(wv_a0[0U], x[0U]);
+    Lib_IntVector_Intrinsics_vec512 *wv_a1 = wv + d10 * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b1 = wv + a * (uint32_t)1U;
+    wv_a1[0U] = Lib_IntVector_Intrinsics_vec512_xor(wv_a1[0U], wv_b1[0U]);
+    wv_a1[0U] = Lib_IntVector_Intrinsics_vec512_rotate_right64(wv_a1[0U], (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec512 *wv_a2 = wv + c0 * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b2 = wv + d10 * (uint32_t)1U;
+    wv_a2[0U] = Lib_IntVector_Intrinsics_vec512_add64(wv_a2[0U], wv_b2[0U]);
+    Lib_IntVector_Intrinsics_vec512 *wv_a3 = wv + b0 * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b3 = wv + c0 * (uint32_t)1U;
+    wv_a3[0U] = Lib_IntVector_Intrinsics_vec512_xor(wv_a3[0U], wv_b3[0U]);
+    wv_a3[0U] = Lib_IntVector_Intrinsics_vec512_rotate_right64(wv_a3[0U], (uint32_t)24U);
+    Lib_IntVector_Intrinsics_vec512 *wv_a4 = wv + a * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b4 = wv + b0 * (uint32_t)1U;
+    wv_a4[0U] = Lib_IntVector_Intrinsics_vec512_add64(wv_a4[0U], wv_b4[0U]);
+    wv_a4[0U] = Lib_IntVector_Intrinsics_vec512_add64(wv_a4[0U], y[0U]);
+    Lib_IntVector_Intrinsics_vec512 *wv_a5 = wv + d10 * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b5 = wv + a * (uint32_t)1U;
+    wv_a5[0U] = Lib_IntVector_Intrinsics_vec512_xor(wv_a5[0U], wv_b5[0U]);
+    wv_a5[0U] = Lib_IntVector_Intrinsics_vec512_rotate_right64(wv_a5[0U], (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec512 *wv_a6 = wv + c0 * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b6 = wv + d10 * (uint32_t)1U;
+    wv_a6[0U] = Lib_IntVector_Intrinsics_vec512_add64(wv_a6[0U], wv_b6[0U]);
+    Lib_IntVector_Intrinsics_vec512 *wv_a7 = wv + b0 * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b7 = wv + c0 * (uint32_t)1U;
+    wv_a7[0U] = Lib_IntVector_Intrinsics_vec512_xor(wv_a7[0U], wv_b7[0U]);
+    wv_a7[0U] = Lib_IntVector_Intrinsics_vec512_rotate_right64(wv_a7[0U], (uint32_t)63U);
+    Lib_IntVector_Intrinsics_vec512 *r10 = wv + (uint32_t)1U * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *r21 = wv + (uint32_t)2U * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *r31 = wv + (uint32_t)3U * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 v00 = r10[0U];
+    Lib_IntVector_Intrinsics_vec512
+    v1 = Lib_IntVector_Intrinsics_vec512_rotate_right_lanes64(v00, (uint32_t)1U);
+    r10[0U] = v1;
+    Lib_IntVector_Intrinsics_vec512 v01 = r21[0U];
+    Lib_IntVector_Intrinsics_vec512
+    v10 = Lib_IntVector_Intrinsics_vec512_rotate_right_lanes64(v01, (uint32_t)2U);
+    r21[0U] = v10;
+    Lib_IntVector_Intrinsics_vec512 v02 = r31[0U];
+    Lib_IntVector_Intrinsics_vec512
+    v11 = Lib_IntVector_Intrinsics_vec512_rotate_right_lanes64(v02, (uint32_t)3U);
+    r31[0U] = v11;
+    uint32_t a0 = (uint32_t)0U;
+    uint32_t b = (uint32_t)1U;
+    uint32_t c = (uint32_t)2U;
+    uint32_t d1 = (uint32_t)3U;
+    Lib_IntVector_Intrinsics_vec512 *wv_a = wv + a0 * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b8 = wv + b * (uint32_t)1U;
+    wv_a[0U] = Lib_IntVector_Intrinsics_vec512_add64(wv_a[0U], wv_b8[0U]);
+    wv_a[0U] = Lib_IntVector_Intrinsics_vec512_add64(wv_a[0U], z[0U]);
+    Lib_IntVector_Intrinsics_vec512 *wv_a8 = wv + d1 * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b9 = wv + a0 * (uint32_t)1U;
+    wv_a8[0U] = Lib_IntVector_Intrinsics_vec512_xor(wv_a8[0U], wv_b9[0U]);
+    wv_a8[0U] = Lib_IntVector_Intrinsics_vec512_rotate_right64(wv_a8[0U], (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec512 *wv_a9 = wv + c * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b10 = wv + d1 * (uint32_t)1U;
+    wv_a9[0U] = Lib_IntVector_Intrinsics_vec512_add64(wv_a9[0U], wv_b10[0U]);
+    Lib_IntVector_Intrinsics_vec512 *wv_a10 = wv + b * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b11 = wv + c * (uint32_t)1U;
+    wv_a10[0U] = Lib_IntVector_Intrinsics_vec512_xor(wv_a10[0U], wv_b11[0U]);
+    wv_a10[0U] = Lib_IntVector_Intrinsics_vec512_rotate_right64(wv_a10[0U], (uint32_t)24U);
+    Lib_IntVector_Intrinsics_vec512 *wv_a11 = wv + a0 * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b12 = wv + b * (uint32_t)1U;
+    wv_a11[0U] = Lib_IntVector_Intrinsics_vec512_add64(wv_a11[0U], wv_b12[0U]);
+    wv_a11[0U] = Lib_IntVector_Intrinsics_vec512_add64(wv_a11[0U], w[0U]);
+    Lib_IntVector_Intrinsics_vec512 *wv_a12 = wv + d1 * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b13 = wv + a0 * (uint32_t)1U;
+    wv_a12[0U] = Lib_IntVector_Intrinsics_vec512_xor(wv_a12[0U], wv_b13[0U]);
+    wv_a12[0U] = Lib_IntVector_Intrinsics_vec512_rotate_right64(wv_a12[0U], (uint32_t)16U);
+    Lib_IntVector_Intrinsics_vec512 *wv_a13 = wv + c * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b14 = wv + d1 * (uint32_t)1U;
+    wv_a13[0U] = Lib_IntVector_Intrinsics_vec512_add64(wv_a13[0U], wv_b14[0U]);
+    Lib_IntVector_Intrinsics_vec512 *wv_a14 = wv + b * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *wv_b = wv + c * (uint32_t)1U;
+    wv_a14[0U] = Lib_IntVector_Intrinsics_vec512_xor(wv_a14[0U], wv_b[0U]);
+    wv_a14[0U] = Lib_IntVector_Intrinsics_vec512_rotate_right64(wv_a14[0U], (uint32_t)63U);
+    Lib_IntVector_Intrinsics_vec512 *r11 = wv + (uint32_t)1U * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *r2 = wv + (uint32_t)2U * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 *r3 = wv + (uint32_t)3U * (uint32_t)1U;
+    Lib_IntVector_Intrinsics_vec512 v0 = r11[0U];
+    Lib_IntVector_Intrinsics_vec512
+    v12 = Lib_IntVector_Intrinsics_vec512_rotate_right_lanes64(v0, (uint32_t)3U);
+    r11[0U] = v12;
+    Lib_IntVector_Intrinsics_vec512 v03 = r2[0U];
+    Lib_IntVector_Intrinsics_vec512
+    v13 = Lib_IntVector_Intrinsics_vec512_rotate_right_lanes64(v03, (uint32_t)2U);
+    r2[0U] = v13;
+    Lib_IntVector_Intrinsics_vec512 v04 = r3[0U];
+    Lib_IntVector_Intrinsics_vec512
+    v14 = Lib_IntVector_Intrinsics_vec512_rotate_right_lanes64(v04, (uint32_t)1U);
+    r3[0U] = v14;
+  }
+  Lib_IntVector_Intrinsics_vec512 *s0 = hash + (uint32_t)0U * (uint32_t)1U;
+  Lib_IntVector_Intrinsics_vec512 *s1 = hash + (uint32_t)1U * (uint32_t)1U;
+  Lib_IntVector_Intrinsics_vec512 *r0 = wv + (uint32_t)0U * (uint32_t)1U;
+  Lib_IntVector_Intrinsics_vec512 *r1 = wv + (uint32_t)1U * (uint32_t)1U;
+  Lib_IntVector_Intrinsics_vec512 *r2 = wv + (uint32_t)2U * (uint32_t)1U;
+  Lib_IntVector_Intrinsics_vec512 *r3 = wv + (uint32_t)3U * (uint32_t)1U;
+  s0[0U] = Lib_IntVector_Intrinsics_vec512_xor(s0[0U], r0[0U]);
+  s0[0U] = Lib_IntVector_Intrinsics_vec512_xor(s0[0U], r2[0U]);
+  s1[0U] = Lib_IntVector_Intrinsics_vec512_xor(s1[0U], r1[0U]);
+  s1[0U] = Lib_IntVector_Intrinsics_vec512_xor(s1[0U], r3[0U]);
+}
+
+static inline void
+blake2b_init_2(Lib_IntVector_Intrinsics_vec512 *wv, Lib_IntVector_Intrinsics_vec512 *hash, uint32_t kk, uint8_t *k, uint32_t nn)
+{
+  uint8_t b[128U] = { 0U };
+  Lib_IntVector_Intrinsics_vec512 *r0 = hash + (uint32_t)0U * (uint32_t)1U;
+  Lib_IntVector_Intrinsics_vec512 *r1 = hash + (uint32_t)1U * (uint32_t)1U;
+  Lib_IntVector_Intrinsics_vec512 *r2 = hash + (uint32_t)2U * (uint32_t)1U;
+  Lib_IntVector_Intrinsics_vec512 *r3 = hash + (uint32_t)3U * (uint32_t)1U;
+  uint64_t iv0 = Hacl_Impl_Blake2_Constants_ivTable_B[0U];
+  uint64_t iv1 = Hacl_Impl_Blake2_Constants_ivTable_B[1U];
+  uint64_t iv2 = Hacl_Impl_Blake2_Constants_ivTable_B[2U];
+  uint64_t iv3 = Hacl_Impl_Blake2_Constants_ivTable_B[3U];
+  uint64_t iv4 = Hacl_Impl_Blake2_Constants_ivTable_B[4U];
+  uint64_t iv5 = Hacl_Impl_Blake2_Constants_ivTable_B[5U];
+  uint64_t iv6 = Hacl_Impl_Blake2_Constants_ivTable_B[6U];
+  uint64_t iv7 = Hacl_Impl_Blake2_Constants_ivTable_B[7U];
+  r2[0U] = Lib_IntVector_Intrinsics_vec512_load64s(iv0, iv1, iv2, iv3, iv0, iv1, iv2, iv3);
+  r3[0U] = Lib_IntVector_Intrinsics_vec512_load64s(iv4, iv5, iv6, iv7, iv4, iv5, iv6, iv7);
+  uint64_t kk_shift_8 = (uint64_t)kk << (uint32_t)8U;
+  uint64_t iv0_ = iv0 ^ ((uint64_t)0x01010000U ^ (kk_shift_8 ^ (uint64_t)nn));
+  r0[0U] = Lib_IntVector_Intrinsics_vec512_load64s(iv0_, iv1, iv2, iv3, iv0_, iv1, iv2, iv3);
+  r1[0U] = Lib_IntVector_Intrinsics_vec512_load64s(iv4, iv5, iv6, iv7, iv4, iv5, iv6, iv7);
+  if (!(kk == (uint32_t)0U))
+  {
+    memcpy(b, k, kk * sizeof (uint8_t));
+    FStar_UInt128_uint128 totlen = FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U);
+    blake2b_update_block(wv, hash, false, totlen, b, b);
+  }
+  Lib_Memzero0_memzero(b, (uint32_t)128U * sizeof (b[0U]));
+}
+
+static inline void
+blake2b_update_blocks_2(
+  uint32_t len,
+  Lib_IntVector_Intrinsics_vec512 *wv,
+  Lib_IntVector_Intrinsics_vec512 *hash,
+  FStar_UInt128_uint128 prev,
+  uint8_t *d0,
+  uint8_t *d1
+)
+{
+  uint32_t nb0 = len / (uint32_t)128U;
+  uint32_t rem0 = len % (uint32_t)128U;
+  uint32_t nb;
+  uint32_t rem;
+  if (rem0 == (uint32_t)0U && nb0 > (uint32_t)0U)
+  {
+    nb = nb0 - (uint32_t)1U;
+    rem = (uint32_t)128U;
+  }
+  else
+  {
+    nb = nb0;
+    rem = rem0;
+  }
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    FStar_UInt128_uint128
+    totlen =
+      FStar_UInt128_add_mod(prev,
+        FStar_UInt128_uint64_to_uint128((uint64_t)((i + (uint32_t)1U) * (uint32_t)128U)));
+    blake2b_update_block(wv,
+      hash,
+      false,
+      totlen,
+      d0 + i * (uint32_t)128U,
+      d1 + i * (uint32_t)128U);
+  }
+  uint8_t b0[128U] = { 0U };
+  uint8_t b1[128U] = { 0U };
+  memcpy(b0, d0 + len - rem, rem * sizeof (uint8_t));
+  memcpy(b1, d1 + len - rem, rem * sizeof (uint8_t));
+  FStar_UInt128_uint128
+  totlen = FStar_UInt128_add_mod(prev, FStar_UInt128_uint64_to_uint128((uint64_t)len));
+  blake2b_update_block(wv, hash, true, totlen, b0, b1);
+  Lib_Memzero0_memzero(b0, (uint32_t)128U * sizeof (b0[0U]));
+  Lib_Memzero0_memzero(b1, (uint32_t)128U * sizeof (b1[0U]));
+}
+
+static inline void blake2b_finish_2(uint32_t nn, uint8_t **output, Lib_IntVector_Intrinsics_vec512 *hash)
+{
+  uint8_t b[128U] = { 0U };
+  Lib_IntVector_Intrinsics_vec512_store_le(b, hash[0U]);
+  Lib_IntVector_Intrinsics_vec512_store_le(b + (uint32_t)64U, hash[1U]);
+  /* b = row0 of state 0 | row0 of state 1 | row1 of state 0 | row1 of state 1 */
+  uint8_t out0[64U] = { 0U };
+  uint8_t out1[64U] = { 0U };
+  memcpy(out0, b, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(out0 + (uint32_t)32U, b + (uint32_t)64U, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(out1, b + (uint32_t)32U, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(out1 + (uint32_t)32U, b + (uint32_t)96U, (uint32_t)32U * sizeof (uint8_t));
+  memcpy(output[0U], out0, nn * sizeof (uint8_t));
+  memcpy(output[1U], out1, nn * sizeof (uint8_t));
+  Lib_Memzero0_memzero(b, (uint32_t)128U * sizeof (b[0U]));
+  Lib_Memzero0_memzero(out0, (uint32_t)64U * sizeof (out0[0U]));
+  Lib_Memzero0_memzero(out1, (uint32_t)64U * sizeof (out1[0U]));
+}
+
+void
+Hacl_Blake2b_512_blake2b_2(
+  uint32_t nn,
+  uint8_t **output,
+  uint32_t ll,
+  uint8_t **d,
+  uint32_t kk,
+  uint8_t *k
+)
+{
+  Lib_IntVector_Intrinsics_vec512 b[4U];
+  Lib_IntVector_Intrinsics_vec512 b1[4U];
+  for (uint32_t _i = 0U; _i < (uint32_t)4U; ++_i)
+  {
+    b[_i] = Lib_IntVector_Intrinsics_vec512_zero;
+    b1[_i] = Lib_IntVector_Intrinsics_vec512_zero;
+  }
+  FStar_UInt128_uint128 prev0;
+  if (kk == (uint32_t)0U)
+  {
+    prev0 = FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)0U);
+  }
+  else
+  {
+    prev0 = FStar_UInt128_uint64_to_uint128((uint64_t)(uint32_t)128U);
+  }
+  blake2b_init_2(b1, b, kk, k, nn);
+  blake2b_update_blocks_2(ll, b1, b, prev0, d[0U], d[1U]);
+  blake2b_finish_2(nn, output, b);
+  Lib_Memzero0_memzero(b1, (uint32_t)4U * sizeof (b1[0U]));
+  Lib_Memzero0_memzero(b, (uint32_t)4U * sizeof (b[0U]));
+}
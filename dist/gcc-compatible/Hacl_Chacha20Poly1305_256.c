@@ -24,6 +24,235 @@
 
 #include "Hacl_Chacha20Poly1305_256.h"
 
+static inline void
+poly1305_blocks4_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t nb, uint8_t *text1)
+{
+  Lib_IntVector_Intrinsics_vec256 *pre0 = ctx + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec256 *acc0 = ctx;
+  uint32_t bs = (uint32_t)64U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *block = text1 + i * bs;
+    Lib_IntVector_Intrinsics_vec256 e[5U];
+    for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
+      e[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+    Lib_IntVector_Intrinsics_vec256 lo = Lib_IntVector_Intrinsics_vec256_load_le(block);
+    Lib_IntVector_Intrinsics_vec256
+    hi = Lib_IntVector_Intrinsics_vec256_load_le(block + (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256
+    mask260 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
+    Lib_IntVector_Intrinsics_vec256
+    m0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(lo, hi);
+    Lib_IntVector_Intrinsics_vec256
+    m1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(lo, hi);
+    Lib_IntVector_Intrinsics_vec256
+    m2 = Lib_IntVector_Intrinsics_vec256_shift_right(m0, (uint32_t)48U);
+    Lib_IntVector_Intrinsics_vec256
+    m3 = Lib_IntVector_Intrinsics_vec256_shift_right(m1, (uint32_t)48U);
+    Lib_IntVector_Intrinsics_vec256
+    m4 = Lib_IntVector_Intrinsics_vec256_interleave_high64(m0, m1);
+    Lib_IntVector_Intrinsics_vec256
+    t010 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m0, m1);
+    Lib_IntVector_Intrinsics_vec256
+    t30 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m2, m3);
+    Lib_IntVector_Intrinsics_vec256
+    t20 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)4U);
+    Lib_IntVector_Intrinsics_vec256 o20 = Lib_IntVector_Intrinsics_vec256_and(t20, mask260);
+    Lib_IntVector_Intrinsics_vec256
+    t10 = Lib_IntVector_Intrinsics_vec256_shift_right64(t010, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 o10 = Lib_IntVector_Intrinsics_vec256_and(t10, mask260);
+    Lib_IntVector_Intrinsics_vec256 o5 = Lib_IntVector_Intrinsics_vec256_and(t010, mask260);
+    Lib_IntVector_Intrinsics_vec256
+    t31 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)30U);
+    Lib_IntVector_Intrinsics_vec256 o30 = Lib_IntVector_Intrinsics_vec256_and(t31, mask260);
+    Lib_IntVector_Intrinsics_vec256
+    o40 = Lib_IntVector_Intrinsics_vec256_shift_right64(m4, (uint32_t)40U);
+    Lib_IntVector_Intrinsics_vec256 o00 = o5;
+    Lib_IntVector_Intrinsics_vec256 o11 = o10;
+    Lib_IntVector_Intrinsics_vec256 o21 = o20;
+    Lib_IntVector_Intrinsics_vec256 o31 = o30;
+    Lib_IntVector_Intrinsics_vec256 o41 = o40;
+    e[0U] = o00;
+    e[1U] = o11;
+    e[2U] = o21;
+    e[3U] = o31;
+    e[4U] = o41;
+    uint64_t b = (uint64_t)0x1000000U;
+    Lib_IntVector_Intrinsics_vec256 mask = Lib_IntVector_Intrinsics_vec256_load64(b);
+    Lib_IntVector_Intrinsics_vec256 f4 = e[4U];
+    e[4U] = Lib_IntVector_Intrinsics_vec256_or(f4, mask);
+    Lib_IntVector_Intrinsics_vec256 *rn = pre0 + (uint32_t)10U;
+    Lib_IntVector_Intrinsics_vec256 *rn5 = pre0 + (uint32_t)15U;
+    Lib_IntVector_Intrinsics_vec256 r0 = rn[0U];
+    Lib_IntVector_Intrinsics_vec256 r1 = rn[1U];
+    Lib_IntVector_Intrinsics_vec256 r2 = rn[2U];
+    Lib_IntVector_Intrinsics_vec256 r3 = rn[3U];
+    Lib_IntVector_Intrinsics_vec256 r4 = rn[4U];
+    Lib_IntVector_Intrinsics_vec256 r51 = rn5[1U];
+    Lib_IntVector_Intrinsics_vec256 r52 = rn5[2U];
+    Lib_IntVector_Intrinsics_vec256 r53 = rn5[3U];
+    Lib_IntVector_Intrinsics_vec256 r54 = rn5[4U];
+    Lib_IntVector_Intrinsics_vec256 f10 = acc0[0U];
+    Lib_IntVector_Intrinsics_vec256 f110 = acc0[1U];
+    Lib_IntVector_Intrinsics_vec256 f120 = acc0[2U];
+    Lib_IntVector_Intrinsics_vec256 f130 = acc0[3U];
+    Lib_IntVector_Intrinsics_vec256 f140 = acc0[4U];
+    Lib_IntVector_Intrinsics_vec256 a0 = Lib_IntVector_Intrinsics_vec256_mul64(r0, f10);
+    Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_mul64(r1, f10);
+    Lib_IntVector_Intrinsics_vec256 a2 = Lib_IntVector_Intrinsics_vec256_mul64(r2, f10);
+    Lib_IntVector_Intrinsics_vec256 a3 = Lib_IntVector_Intrinsics_vec256_mul64(r3, f10);
+    Lib_IntVector_Intrinsics_vec256 a4 = Lib_IntVector_Intrinsics_vec256_mul64(r4, f10);
+    Lib_IntVector_Intrinsics_vec256
+    a01 =
+      Lib_IntVector_Intrinsics_vec256_add64(a0,
+        Lib_IntVector_Intrinsics_vec256_mul64(r54, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a11 =
+      Lib_IntVector_Intrinsics_vec256_add64(a1,
+        Lib_IntVector_Intrinsics_vec256_mul64(r0, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a21 =
+      Lib_IntVector_Intrinsics_vec256_add64(a2,
+        Lib_IntVector_Intrinsics_vec256_mul64(r1, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a31 =
+      Lib_IntVector_Intrinsics_vec256_add64(a3,
+        Lib_IntVector_Intrinsics_vec256_mul64(r2, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a41 =
+      Lib_IntVector_Intrinsics_vec256_add64(a4,
+        Lib_IntVector_Intrinsics_vec256_mul64(r3, f110));
+    Lib_IntVector_Intrinsics_vec256
+    a02 =
+      Lib_IntVector_Intrinsics_vec256_add64(a01,
+        Lib_IntVector_Intrinsics_vec256_mul64(r53, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a12 =
+      Lib_IntVector_Intrinsics_vec256_add64(a11,
+        Lib_IntVector_Intrinsics_vec256_mul64(r54, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a22 =
+      Lib_IntVector_Intrinsics_vec256_add64(a21,
+        Lib_IntVector_Intrinsics_vec256_mul64(r0, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a32 =
+      Lib_IntVector_Intrinsics_vec256_add64(a31,
+        Lib_IntVector_Intrinsics_vec256_mul64(r1, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a42 =
+      Lib_IntVector_Intrinsics_vec256_add64(a41,
+        Lib_IntVector_Intrinsics_vec256_mul64(r2, f120));
+    Lib_IntVector_Intrinsics_vec256
+    a03 =
+      Lib_IntVector_Intrinsics_vec256_add64(a02,
+        Lib_IntVector_Intrinsics_vec256_mul64(r52, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a13 =
+      Lib_IntVector_Intrinsics_vec256_add64(a12,
+        Lib_IntVector_Intrinsics_vec256_mul64(r53, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a23 =
+      Lib_IntVector_Intrinsics_vec256_add64(a22,
+        Lib_IntVector_Intrinsics_vec256_mul64(r54, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a33 =
+      Lib_IntVector_Intrinsics_vec256_add64(a32,
+        Lib_IntVector_Intrinsics_vec256_mul64(r0, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a43 =
+      Lib_IntVector_Intrinsics_vec256_add64(a42,
+        Lib_IntVector_Intrinsics_vec256_mul64(r1, f130));
+    Lib_IntVector_Intrinsics_vec256
+    a04 =
+      Lib_IntVector_Intrinsics_vec256_add64(a03,
+        Lib_IntVector_Intrinsics_vec256_mul64(r51, f140));
+    Lib_IntVector_Intrinsics_vec256
+    a14 =
+      Lib_IntVector_Intrinsics_vec256_add64(a13,
+        Lib_IntVector_Intrinsics_vec256_mul64(r52, f140));
+    Lib_IntVector_Intrinsics_vec256
+    a24 =
+      Lib_IntVector_Intrinsics_vec256_add64(a23,
+        Lib_IntVector_Intrinsics_vec256_mul64(r53, f140));
+    Lib_IntVector_Intrinsics_vec256
+    a34 =
+      Lib_IntVector_Intrinsics_vec256_add64(a33,
+        Lib_IntVector_Intrinsics_vec256_mul64(r54, f140));
+    Lib_IntVector_Intrinsics_vec256
+    a44 =
+      Lib_IntVector_Intrinsics_vec256_add64(a43,
+        Lib_IntVector_Intrinsics_vec256_mul64(r0, f140));
+    Lib_IntVector_Intrinsics_vec256 t01 = a04;
+    Lib_IntVector_Intrinsics_vec256 t1 = a14;
+    Lib_IntVector_Intrinsics_vec256 t2 = a24;
+    Lib_IntVector_Intrinsics_vec256 t3 = a34;
+    Lib_IntVector_Intrinsics_vec256 t4 = a44;
+    Lib_IntVector_Intrinsics_vec256
+    mask26 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
+    Lib_IntVector_Intrinsics_vec256
+    z0 = Lib_IntVector_Intrinsics_vec256_shift_right64(t01, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    z1 = Lib_IntVector_Intrinsics_vec256_shift_right64(t3, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_and(t01, mask26);
+    Lib_IntVector_Intrinsics_vec256 x3 = Lib_IntVector_Intrinsics_vec256_and(t3, mask26);
+    Lib_IntVector_Intrinsics_vec256 x1 = Lib_IntVector_Intrinsics_vec256_add64(t1, z0);
+    Lib_IntVector_Intrinsics_vec256 x4 = Lib_IntVector_Intrinsics_vec256_add64(t4, z1);
+    Lib_IntVector_Intrinsics_vec256
+    z01 = Lib_IntVector_Intrinsics_vec256_shift_right64(x1, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    z11 = Lib_IntVector_Intrinsics_vec256_shift_right64(x4, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    t = Lib_IntVector_Intrinsics_vec256_shift_left64(z11, (uint32_t)2U);
+    Lib_IntVector_Intrinsics_vec256 z12 = Lib_IntVector_Intrinsics_vec256_add64(z11, t);
+    Lib_IntVector_Intrinsics_vec256 x11 = Lib_IntVector_Intrinsics_vec256_and(x1, mask26);
+    Lib_IntVector_Intrinsics_vec256 x41 = Lib_IntVector_Intrinsics_vec256_and(x4, mask26);
+    Lib_IntVector_Intrinsics_vec256 x2 = Lib_IntVector_Intrinsics_vec256_add64(t2, z01);
+    Lib_IntVector_Intrinsics_vec256 x01 = Lib_IntVector_Intrinsics_vec256_add64(x0, z12);
+    Lib_IntVector_Intrinsics_vec256
+    z02 = Lib_IntVector_Intrinsics_vec256_shift_right64(x2, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256
+    z13 = Lib_IntVector_Intrinsics_vec256_shift_right64(x01, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 x21 = Lib_IntVector_Intrinsics_vec256_and(x2, mask26);
+    Lib_IntVector_Intrinsics_vec256 x02 = Lib_IntVector_Intrinsics_vec256_and(x01, mask26);
+    Lib_IntVector_Intrinsics_vec256 x31 = Lib_IntVector_Intrinsics_vec256_add64(x3, z02);
+    Lib_IntVector_Intrinsics_vec256 x12 = Lib_IntVector_Intrinsics_vec256_add64(x11, z13);
+    Lib_IntVector_Intrinsics_vec256
+    z03 = Lib_IntVector_Intrinsics_vec256_shift_right64(x31, (uint32_t)26U);
+    Lib_IntVector_Intrinsics_vec256 x32 = Lib_IntVector_Intrinsics_vec256_and(x31, mask26);
+    Lib_IntVector_Intrinsics_vec256 x42 = Lib_IntVector_Intrinsics_vec256_add64(x41, z03);
+    Lib_IntVector_Intrinsics_vec256 o01 = x02;
+    Lib_IntVector_Intrinsics_vec256 o12 = x12;
+    Lib_IntVector_Intrinsics_vec256 o22 = x21;
+    Lib_IntVector_Intrinsics_vec256 o32 = x32;
+    Lib_IntVector_Intrinsics_vec256 o42 = x42;
+    acc0[0U] = o01;
+    acc0[1U] = o12;
+    acc0[2U] = o22;
+    acc0[3U] = o32;
+    acc0[4U] = o42;
+    Lib_IntVector_Intrinsics_vec256 f100 = acc0[0U];
+    Lib_IntVector_Intrinsics_vec256 f11 = acc0[1U];
+    Lib_IntVector_Intrinsics_vec256 f12 = acc0[2U];
+    Lib_IntVector_Intrinsics_vec256 f13 = acc0[3U];
+    Lib_IntVector_Intrinsics_vec256 f14 = acc0[4U];
+    Lib_IntVector_Intrinsics_vec256 f20 = e[0U];
+    Lib_IntVector_Intrinsics_vec256 f21 = e[1U];
+    Lib_IntVector_Intrinsics_vec256 f22 = e[2U];
+    Lib_IntVector_Intrinsics_vec256 f23 = e[3U];
+    Lib_IntVector_Intrinsics_vec256 f24 = e[4U];
+    Lib_IntVector_Intrinsics_vec256 o0 = Lib_IntVector_Intrinsics_vec256_add64(f100, f20);
+    Lib_IntVector_Intrinsics_vec256 o1 = Lib_IntVector_Intrinsics_vec256_add64(f11, f21);
+    Lib_IntVector_Intrinsics_vec256 o2 = Lib_IntVector_Intrinsics_vec256_add64(f12, f22);
+    Lib_IntVector_Intrinsics_vec256 o3 = Lib_IntVector_Intrinsics_vec256_add64(f13, f23);
+    Lib_IntVector_Intrinsics_vec256 o4 = Lib_IntVector_Intrinsics_vec256_add64(f14, f24);
+    acc0[0U] = o0;
+    acc0[1U] = o1;
+    acc0[2U] = o2;
+    acc0[3U] = o3;
+    acc0[4U] = o4;
+  }
+}
+
 static inline void
 poly1305_padded_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t len, uint8_t *text)
 {
@@ -44,227 +273,7 @@ poly1305_padded_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t len, uint8_t
     uint32_t len1 = len0 - bs;
     uint8_t *text1 = t00 + bs;
     uint32_t nb = len1 / bs;
-    for (uint32_t i = (uint32_t)0U; i < nb; i++)
-    {
-      uint8_t *block = text1 + i * bs;
-      Lib_IntVector_Intrinsics_vec256 e[5U];
-      for (uint32_t _i = 0U; _i < (uint32_t)5U; ++_i)
-        e[_i] = Lib_IntVector_Intrinsics_vec256_zero;
-      Lib_IntVector_Intrinsics_vec256 lo = Lib_IntVector_Intrinsics_vec256_load_le(block);
-      Lib_IntVector_Intrinsics_vec256
-      hi = Lib_IntVector_Intrinsics_vec256_load_le(block + (uint32_t)32U);
-      Lib_IntVector_Intrinsics_vec256
-      mask260 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
-      Lib_IntVector_Intrinsics_vec256
-      m0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(lo, hi);
-      Lib_IntVector_Intrinsics_vec256
-      m1 = Lib_IntVector_Intrinsics_vec256_interleave_high128(lo, hi);
-      Lib_IntVector_Intrinsics_vec256
-      m2 = Lib_IntVector_Intrinsics_vec256_shift_right(m0, (uint32_t)48U);
-      Lib_IntVector_Intrinsics_vec256
-      m3 = Lib_IntVector_Intrinsics_vec256_shift_right(m1, (uint32_t)48U);
-      Lib_IntVector_Intrinsics_vec256
-      m4 = Lib_IntVector_Intrinsics_vec256_interleave_high64(m0, m1);
-      Lib_IntVector_Intrinsics_vec256
-      t010 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m0, m1);
-      Lib_IntVector_Intrinsics_vec256
-      t30 = Lib_IntVector_Intrinsics_vec256_interleave_low64(m2, m3);
-      Lib_IntVector_Intrinsics_vec256
-      t20 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)4U);
-      Lib_IntVector_Intrinsics_vec256 o20 = Lib_IntVector_Intrinsics_vec256_and(t20, mask260);
-      Lib_IntVector_Intrinsics_vec256
-      t10 = Lib_IntVector_Intrinsics_vec256_shift_right64(t010, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 o10 = Lib_IntVector_Intrinsics_vec256_and(t10, mask260);
-      Lib_IntVector_Intrinsics_vec256 o5 = Lib_IntVector_Intrinsics_vec256_and(t010, mask260);
-      Lib_IntVector_Intrinsics_vec256
-      t31 = Lib_IntVector_Intrinsics_vec256_shift_right64(t30, (uint32_t)30U);
-      Lib_IntVector_Intrinsics_vec256 o30 = Lib_IntVector_Intrinsics_vec256_and(t31, mask260);
-      Lib_IntVector_Intrinsics_vec256
-      o40 = Lib_IntVector_Intrinsics_vec256_shift_right64(m4, (uint32_t)40U);
-      Lib_IntVector_Intrinsics_vec256 o00 = o5;
-      Lib_IntVector_Intrinsics_vec256 o11 = o10;
-      Lib_IntVector_Intrinsics_vec256 o21 = o20;
-      Lib_IntVector_Intrinsics_vec256 o31 = o30;
-      Lib_IntVector_Intrinsics_vec256 o41 = o40;
-      e[0U] = o00;
-      e[1U] = o11;
-      e[2U] = o21;
-      e[3U] = o31;
-      e[4U] = o41;
-      uint64_t b = (uint64_t)0x1000000U;
-      Lib_IntVector_Intrinsics_vec256 mask = Lib_IntVector_Intrinsics_vec256_load64(b);
-      Lib_IntVector_Intrinsics_vec256 f4 = e[4U];
-      e[4U] = Lib_IntVector_Intrinsics_vec256_or(f4, mask);
-      Lib_IntVector_Intrinsics_vec256 *rn = pre0 + (uint32_t)10U;
-      Lib_IntVector_Intrinsics_vec256 *rn5 = pre0 + (uint32_t)15U;
-      Lib_IntVector_Intrinsics_vec256 r0 = rn[0U];
-      Lib_IntVector_Intrinsics_vec256 r1 = rn[1U];
-      Lib_IntVector_Intrinsics_vec256 r2 = rn[2U];
-      Lib_IntVector_Intrinsics_vec256 r3 = rn[3U];
-      Lib_IntVector_Intrinsics_vec256 r4 = rn[4U];
-      Lib_IntVector_Intrinsics_vec256 r51 = rn5[1U];
-      Lib_IntVector_Intrinsics_vec256 r52 = rn5[2U];
-      Lib_IntVector_Intrinsics_vec256 r53 = rn5[3U];
-      Lib_IntVector_Intrinsics_vec256 r54 = rn5[4U];
-      Lib_IntVector_Intrinsics_vec256 f10 = acc0[0U];
-      Lib_IntVector_Intrinsics_vec256 f110 = acc0[1U];
-      Lib_IntVector_Intrinsics_vec256 f120 = acc0[2U];
-      Lib_IntVector_Intrinsics_vec256 f130 = acc0[3U];
-      Lib_IntVector_Intrinsics_vec256 f140 = acc0[4U];
-      Lib_IntVector_Intrinsics_vec256 a0 = Lib_IntVector_Intrinsics_vec256_mul64(r0, f10);
-      Lib_IntVector_Intrinsics_vec256 a1 = Lib_IntVector_Intrinsics_vec256_mul64(r1, f10);
-      Lib_IntVector_Intrinsics_vec256 a2 = Lib_IntVector_Intrinsics_vec256_mul64(r2, f10);
-      Lib_IntVector_Intrinsics_vec256 a3 = Lib_IntVector_Intrinsics_vec256_mul64(r3, f10);
-      Lib_IntVector_Intrinsics_vec256 a4 = Lib_IntVector_Intrinsics_vec256_mul64(r4, f10);
-      Lib_IntVector_Intrinsics_vec256
-      a01 =
-        Lib_IntVector_Intrinsics_vec256_add64(a0,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a11 =
-        Lib_IntVector_Intrinsics_vec256_add64(a1,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a21 =
-        Lib_IntVector_Intrinsics_vec256_add64(a2,
-          Lib_IntVector_Intrinsics_vec256_mul64(r1, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a31 =
-        Lib_IntVector_Intrinsics_vec256_add64(a3,
-          Lib_IntVector_Intrinsics_vec256_mul64(r2, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a41 =
-        Lib_IntVector_Intrinsics_vec256_add64(a4,
-          Lib_IntVector_Intrinsics_vec256_mul64(r3, f110));
-      Lib_IntVector_Intrinsics_vec256
-      a02 =
-        Lib_IntVector_Intrinsics_vec256_add64(a01,
-          Lib_IntVector_Intrinsics_vec256_mul64(r53, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a12 =
-        Lib_IntVector_Intrinsics_vec256_add64(a11,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a22 =
-        Lib_IntVector_Intrinsics_vec256_add64(a21,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a32 =
-        Lib_IntVector_Intrinsics_vec256_add64(a31,
-          Lib_IntVector_Intrinsics_vec256_mul64(r1, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a42 =
-        Lib_IntVector_Intrinsics_vec256_add64(a41,
-          Lib_IntVector_Intrinsics_vec256_mul64(r2, f120));
-      Lib_IntVector_Intrinsics_vec256
-      a03 =
-        Lib_IntVector_Intrinsics_vec256_add64(a02,
-          Lib_IntVector_Intrinsics_vec256_mul64(r52, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a13 =
-        Lib_IntVector_Intrinsics_vec256_add64(a12,
-          Lib_IntVector_Intrinsics_vec256_mul64(r53, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a23 =
-        Lib_IntVector_Intrinsics_vec256_add64(a22,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a33 =
-        Lib_IntVector_Intrinsics_vec256_add64(a32,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a43 =
-        Lib_IntVector_Intrinsics_vec256_add64(a42,
-          Lib_IntVector_Intrinsics_vec256_mul64(r1, f130));
-      Lib_IntVector_Intrinsics_vec256
-      a04 =
-        Lib_IntVector_Intrinsics_vec256_add64(a03,
-          Lib_IntVector_Intrinsics_vec256_mul64(r51, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a14 =
-        Lib_IntVector_Intrinsics_vec256_add64(a13,
-          Lib_IntVector_Intrinsics_vec256_mul64(r52, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a24 =
-        Lib_IntVector_Intrinsics_vec256_add64(a23,
-          Lib_IntVector_Intrinsics_vec256_mul64(r53, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a34 =
-        Lib_IntVector_Intrinsics_vec256_add64(a33,
-          Lib_IntVector_Intrinsics_vec256_mul64(r54, f140));
-      Lib_IntVector_Intrinsics_vec256
-      a44 =
-        Lib_IntVector_Intrinsics_vec256_add64(a43,
-          Lib_IntVector_Intrinsics_vec256_mul64(r0, f140));
-      Lib_IntVector_Intrinsics_vec256 t01 = a04;
-      Lib_IntVector_Intrinsics_vec256 t1 = a14;
-      Lib_IntVector_Intrinsics_vec256 t2 = a24;
-      Lib_IntVector_Intrinsics_vec256 t3 = a34;
-      Lib_IntVector_Intrinsics_vec256 t4 = a44;
-      Lib_IntVector_Intrinsics_vec256
-      mask26 = Lib_IntVector_Intrinsics_vec256_load64((uint64_t)0x3ffffffU);
-      Lib_IntVector_Intrinsics_vec256
-      z0 = Lib_IntVector_Intrinsics_vec256_shift_right64(t01, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      z1 = Lib_IntVector_Intrinsics_vec256_shift_right64(t3, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_and(t01, mask26);
-      Lib_IntVector_Intrinsics_vec256 x3 = Lib_IntVector_Intrinsics_vec256_and(t3, mask26);
-      Lib_IntVector_Intrinsics_vec256 x1 = Lib_IntVector_Intrinsics_vec256_add64(t1, z0);
-      Lib_IntVector_Intrinsics_vec256 x4 = Lib_IntVector_Intrinsics_vec256_add64(t4, z1);
-      Lib_IntVector_Intrinsics_vec256
-      z01 = Lib_IntVector_Intrinsics_vec256_shift_right64(x1, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      z11 = Lib_IntVector_Intrinsics_vec256_shift_right64(x4, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      t = Lib_IntVector_Intrinsics_vec256_shift_left64(z11, (uint32_t)2U);
-      Lib_IntVector_Intrinsics_vec256 z12 = Lib_IntVector_Intrinsics_vec256_add64(z11, t);
-      Lib_IntVector_Intrinsics_vec256 x11 = Lib_IntVector_Intrinsics_vec256_and(x1, mask26);
-      Lib_IntVector_Intrinsics_vec256 x41 = Lib_IntVector_Intrinsics_vec256_and(x4, mask26);
-      Lib_IntVector_Intrinsics_vec256 x2 = Lib_IntVector_Intrinsics_vec256_add64(t2, z01);
-      Lib_IntVector_Intrinsics_vec256 x01 = Lib_IntVector_Intrinsics_vec256_add64(x0, z12);
-      Lib_IntVector_Intrinsics_vec256
-      z02 = Lib_IntVector_Intrinsics_vec256_shift_right64(x2, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256
-      z13 = Lib_IntVector_Intrinsics_vec256_shift_right64(x01, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 x21 = Lib_IntVector_Intrinsics_vec256_and(x2, mask26);
-      Lib_IntVector_Intrinsics_vec256 x02 = Lib_IntVector_Intrinsics_vec256_and(x01, mask26);
-      Lib_IntVector_Intrinsics_vec256 x31 = Lib_IntVector_Intrinsics_vec256_add64(x3, z02);
-      Lib_IntVector_Intrinsics_vec256 x12 = Lib_IntVector_Intrinsics_vec256_add64(x11, z13);
-      Lib_IntVector_Intrinsics_vec256
-      z03 = Lib_IntVector_Intrinsics_vec256_shift_right64(x31, (uint32_t)26U);
-      Lib_IntVector_Intrinsics_vec256 x32 = Lib_IntVector_Intrinsics_vec256_and(x31, mask26);
-      Lib_IntVector_Intrinsics_vec256 x42 = Lib_IntVector_Intrinsics_vec256_add64(x41, z03);
-      Lib_IntVector_Intrinsics_vec256 o01 = x02;
-      Lib_IntVector_Intrinsics_vec256 o12 = x12;
-      Lib_IntVector_Intrinsics_vec256 o22 = x21;
-      Lib_IntVector_Intrinsics_vec256 o32 = x32;
-      Lib_IntVector_Intrinsics_vec256 o42 = x42;
-      acc0[0U] = o01;
-      acc0[1U] = o12;
-      acc0[2U] = o22;
-      acc0[3U] = o32;
-      acc0[4U] = o42;
-      Lib_IntVector_Intrinsics_vec256 f100 = acc0[0U];
-      Lib_IntVector_Intrinsics_vec256 f11 = acc0[1U];
-      Lib_IntVector_Intrinsics_vec256 f12 = acc0[2U];
-      Lib_IntVector_Intrinsics_vec256 f13 = acc0[3U];
-      Lib_IntVector_Intrinsics_vec256 f14 = acc0[4U];
-      Lib_IntVector_Intrinsics_vec256 f20 = e[0U];
-      Lib_IntVector_Intrinsics_vec256 f21 = e[1U];
-      Lib_IntVector_Intrinsics_vec256 f22 = e[2U];
-      Lib_IntVector_Intrinsics_vec256 f23 = e[3U];
-      Lib_IntVector_Intrinsics_vec256 f24 = e[4U];
-      Lib_IntVector_Intrinsics_vec256 o0 = Lib_IntVector_Intrinsics_vec256_add64(f100, f20);
-      Lib_IntVector_Intrinsics_vec256 o1 = Lib_IntVector_Intrinsics_vec256_add64(f11, f21);
-      Lib_IntVector_Intrinsics_vec256 o2 = Lib_IntVector_Intrinsics_vec256_add64(f12, f22);
-      Lib_IntVector_Intrinsics_vec256 o3 = Lib_IntVector_Intrinsics_vec256_add64(f13, f23);
-      Lib_IntVector_Intrinsics_vec256 o4 = Lib_IntVector_Intrinsics_vec256_add64(f14, f24);
-      acc0[0U] = o0;
-      acc0[1U] = o1;
-      acc0[2U] = o2;
-      acc0[3U] = o3;
-      acc0[4U] = o4;
-    }
+    poly1305_blocks4_256(ctx, nb, text1);
     Hacl_Impl_Poly1305_Field32xN_256_fmul_r4_normalize(acc0, pre0);
   }
   uint32_t len1 = n * (uint32_t)16U - len0;
@@ -907,22 +916,9 @@ poly1305_padded_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t len, uint8_t
 }
 
 static inline void
-poly1305_do_256(
-  uint8_t *k,
-  uint32_t aadlen,
-  uint8_t *aad,
-  uint32_t mlen,
-  uint8_t *m,
-  uint8_t *out
-)
+poly1305_lengths_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint32_t aadlen, uint32_t mlen)
 {
-  Lib_IntVector_Intrinsics_vec256 ctx[25U];
-  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
-    ctx[_i] = Lib_IntVector_Intrinsics_vec256_zero;
   uint8_t block[16U] = { 0U };
-  Hacl_Poly1305_256_poly1305_init(ctx, k);
-  poly1305_padded_256(ctx, aadlen, aad);
-  poly1305_padded_256(ctx, mlen, m);
   store64_le(block, (uint64_t)aadlen);
   store64_le(block + (uint32_t)8U, (uint64_t)mlen);
   Lib_IntVector_Intrinsics_vec256 *pre = ctx + (uint32_t)5U;
@@ -1132,6 +1128,25 @@ poly1305_do_256(
   acc[2U] = o2;
   acc[3U] = o3;
   acc[4U] = o4;
+}
+
+static inline void
+poly1305_do_256(
+  uint8_t *k,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *out
+)
+{
+  Lib_IntVector_Intrinsics_vec256 ctx[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  Hacl_Poly1305_256_poly1305_init(ctx, k);
+  poly1305_padded_256(ctx, aadlen, aad);
+  poly1305_padded_256(ctx, mlen, m);
+  poly1305_lengths_256(ctx, aadlen, mlen);
   Hacl_Poly1305_256_poly1305_finish(out, k, ctx);
 }
 
@@ -1186,3 +1201,500 @@ Hacl_Chacha20Poly1305_256_aead_decrypt(
   return (uint32_t)1U;
 }
 
+
+static inline void double_round_256(Lib_IntVector_Intrinsics_vec256 *st)
+{
+  st[0U] = Lib_IntVector_Intrinsics_vec256_add32(st[0U], st[4U]);
+  Lib_IntVector_Intrinsics_vec256 std = Lib_IntVector_Intrinsics_vec256_xor(st[12U], st[0U]);
+  st[12U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std, (uint32_t)16U);
+  st[8U] = Lib_IntVector_Intrinsics_vec256_add32(st[8U], st[12U]);
+  Lib_IntVector_Intrinsics_vec256 std0 = Lib_IntVector_Intrinsics_vec256_xor(st[4U], st[8U]);
+  st[4U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std0, (uint32_t)12U);
+  st[0U] = Lib_IntVector_Intrinsics_vec256_add32(st[0U], st[4U]);
+  Lib_IntVector_Intrinsics_vec256 std1 = Lib_IntVector_Intrinsics_vec256_xor(st[12U], st[0U]);
+  st[12U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std1, (uint32_t)8U);
+  st[8U] = Lib_IntVector_Intrinsics_vec256_add32(st[8U], st[12U]);
+  Lib_IntVector_Intrinsics_vec256 std2 = Lib_IntVector_Intrinsics_vec256_xor(st[4U], st[8U]);
+  st[4U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std2, (uint32_t)7U);
+  st[1U] = Lib_IntVector_Intrinsics_vec256_add32(st[1U], st[5U]);
+  Lib_IntVector_Intrinsics_vec256 std3 = Lib_IntVector_Intrinsics_vec256_xor(st[13U], st[1U]);
+  st[13U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std3, (uint32_t)16U);
+  st[9U] = Lib_IntVector_Intrinsics_vec256_add32(st[9U], st[13U]);
+  Lib_IntVector_Intrinsics_vec256 std4 = Lib_IntVector_Intrinsics_vec256_xor(st[5U], st[9U]);
+  st[5U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std4, (uint32_t)12U);
+  st[1U] = Lib_IntVector_Intrinsics_vec256_add32(st[1U], st[5U]);
+  Lib_IntVector_Intrinsics_vec256 std5 = Lib_IntVector_Intrinsics_vec256_xor(st[13U], st[1U]);
+  st[13U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std5, (uint32_t)8U);
+  st[9U] = Lib_IntVector_Intrinsics_vec256_add32(st[9U], st[13U]);
+  Lib_IntVector_Intrinsics_vec256 std6 = Lib_IntVector_Intrinsics_vec256_xor(st[5U], st[9U]);
+  st[5U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std6, (uint32_t)7U);
+  st[2U] = Lib_IntVector_Intrinsics_vec256_add32(st[2U], st[6U]);
+  Lib_IntVector_Intrinsics_vec256 std7 = Lib_IntVector_Intrinsics_vec256_xor(st[14U], st[2U]);
+  st[14U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std7, (uint32_t)16U);
+  st[10U] = Lib_IntVector_Intrinsics_vec256_add32(st[10U], st[14U]);
+  Lib_IntVector_Intrinsics_vec256 std8 = Lib_IntVector_Intrinsics_vec256_xor(st[6U], st[10U]);
+  st[6U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std8, (uint32_t)12U);
+  st[2U] = Lib_IntVector_Intrinsics_vec256_add32(st[2U], st[6U]);
+  Lib_IntVector_Intrinsics_vec256 std9 = Lib_IntVector_Intrinsics_vec256_xor(st[14U], st[2U]);
+  st[14U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std9, (uint32_t)8U);
+  st[10U] = Lib_IntVector_Intrinsics_vec256_add32(st[10U], st[14U]);
+  Lib_IntVector_Intrinsics_vec256 std10 = Lib_IntVector_Intrinsics_vec256_xor(st[6U], st[10U]);
+  st[6U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std10, (uint32_t)7U);
+  st[3U] = Lib_IntVector_Intrinsics_vec256_add32(st[3U], st[7U]);
+  Lib_IntVector_Intrinsics_vec256 std11 = Lib_IntVector_Intrinsics_vec256_xor(st[15U], st[3U]);
+  st[15U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std11, (uint32_t)16U);
+  st[11U] = Lib_IntVector_Intrinsics_vec256_add32(st[11U], st[15U]);
+  Lib_IntVector_Intrinsics_vec256 std12 = Lib_IntVector_Intrinsics_vec256_xor(st[7U], st[11U]);
+  st[7U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std12, (uint32_t)12U);
+  st[3U] = Lib_IntVector_Intrinsics_vec256_add32(st[3U], st[7U]);
+  Lib_IntVector_Intrinsics_vec256 std13 = Lib_IntVector_Intrinsics_vec256_xor(st[15U], st[3U]);
+  st[15U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std13, (uint32_t)8U);
+  st[11U] = Lib_IntVector_Intrinsics_vec256_add32(st[11U], st[15U]);
+  Lib_IntVector_Intrinsics_vec256 std14 = Lib_IntVector_Intrinsics_vec256_xor(st[7U], st[11U]);
+  st[7U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std14, (uint32_t)7U);
+  st[0U] = Lib_IntVector_Intrinsics_vec256_add32(st[0U], st[5U]);
+  Lib_IntVector_Intrinsics_vec256 std15 = Lib_IntVector_Intrinsics_vec256_xor(st[15U], st[0U]);
+  st[15U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std15, (uint32_t)16U);
+  st[10U] = Lib_IntVector_Intrinsics_vec256_add32(st[10U], st[15U]);
+  Lib_IntVector_Intrinsics_vec256 std16 = Lib_IntVector_Intrinsics_vec256_xor(st[5U], st[10U]);
+  st[5U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std16, (uint32_t)12U);
+  st[0U] = Lib_IntVector_Intrinsics_vec256_add32(st[0U], st[5U]);
+  Lib_IntVector_Intrinsics_vec256 std17 = Lib_IntVector_Intrinsics_vec256_xor(st[15U], st[0U]);
+  st[15U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std17, (uint32_t)8U);
+  st[10U] = Lib_IntVector_Intrinsics_vec256_add32(st[10U], st[15U]);
+  Lib_IntVector_Intrinsics_vec256 std18 = Lib_IntVector_Intrinsics_vec256_xor(st[5U], st[10U]);
+  st[5U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std18, (uint32_t)7U);
+  st[1U] = Lib_IntVector_Intrinsics_vec256_add32(st[1U], st[6U]);
+  Lib_IntVector_Intrinsics_vec256 std19 = Lib_IntVector_Intrinsics_vec256_xor(st[12U], st[1U]);
+  st[12U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std19, (uint32_t)16U);
+  st[11U] = Lib_IntVector_Intrinsics_vec256_add32(st[11U], st[12U]);
+  Lib_IntVector_Intrinsics_vec256 std20 = Lib_IntVector_Intrinsics_vec256_xor(st[6U], st[11U]);
+  st[6U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std20, (uint32_t)12U);
+  st[1U] = Lib_IntVector_Intrinsics_vec256_add32(st[1U], st[6U]);
+  Lib_IntVector_Intrinsics_vec256 std21 = Lib_IntVector_Intrinsics_vec256_xor(st[12U], st[1U]);
+  st[12U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std21, (uint32_t)8U);
+  st[11U] = Lib_IntVector_Intrinsics_vec256_add32(st[11U], st[12U]);
+  Lib_IntVector_Intrinsics_vec256 std22 = Lib_IntVector_Intrinsics_vec256_xor(st[6U], st[11U]);
+  st[6U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std22, (uint32_t)7U);
+  st[2U] = Lib_IntVector_Intrinsics_vec256_add32(st[2U], st[7U]);
+  Lib_IntVector_Intrinsics_vec256 std23 = Lib_IntVector_Intrinsics_vec256_xor(st[13U], st[2U]);
+  st[13U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std23, (uint32_t)16U);
+  st[8U] = Lib_IntVector_Intrinsics_vec256_add32(st[8U], st[13U]);
+  Lib_IntVector_Intrinsics_vec256 std24 = Lib_IntVector_Intrinsics_vec256_xor(st[7U], st[8U]);
+  st[7U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std24, (uint32_t)12U);
+  st[2U] = Lib_IntVector_Intrinsics_vec256_add32(st[2U], st[7U]);
+  Lib_IntVector_Intrinsics_vec256 std25 = Lib_IntVector_Intrinsics_vec256_xor(st[13U], st[2U]);
+  st[13U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std25, (uint32_t)8U);
+  st[8U] = Lib_IntVector_Intrinsics_vec256_add32(st[8U], st[13U]);
+  Lib_IntVector_Intrinsics_vec256 std26 = Lib_IntVector_Intrinsics_vec256_xor(st[7U], st[8U]);
+  st[7U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std26, (uint32_t)7U);
+  st[3U] = Lib_IntVector_Intrinsics_vec256_add32(st[3U], st[4U]);
+  Lib_IntVector_Intrinsics_vec256 std27 = Lib_IntVector_Intrinsics_vec256_xor(st[14U], st[3U]);
+  st[14U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std27, (uint32_t)16U);
+  st[9U] = Lib_IntVector_Intrinsics_vec256_add32(st[9U], st[14U]);
+  Lib_IntVector_Intrinsics_vec256 std28 = Lib_IntVector_Intrinsics_vec256_xor(st[4U], st[9U]);
+  st[4U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std28, (uint32_t)12U);
+  st[3U] = Lib_IntVector_Intrinsics_vec256_add32(st[3U], st[4U]);
+  Lib_IntVector_Intrinsics_vec256 std29 = Lib_IntVector_Intrinsics_vec256_xor(st[14U], st[3U]);
+  st[14U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std29, (uint32_t)8U);
+  st[9U] = Lib_IntVector_Intrinsics_vec256_add32(st[9U], st[14U]);
+  Lib_IntVector_Intrinsics_vec256 std30 = Lib_IntVector_Intrinsics_vec256_xor(st[4U], st[9U]);
+  st[4U] = Lib_IntVector_Intrinsics_vec256_rotate_left32(std30, (uint32_t)7U);
+}
+
+static inline void
+chacha20_init_256(Lib_IntVector_Intrinsics_vec256 *ctx, uint8_t *k, uint8_t *n, uint32_t ctr)
+{
+  uint32_t ctx1[16U] = { 0U };
+  uint32_t *out = ctx1;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint32_t *os = out;
+    uint32_t x = Hacl_Impl_Chacha20_Vec_chacha20_constants[i];
+    os[i] = x;
+  }
+  uint32_t *text = ctx1 + (uint32_t)4U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint32_t *os = text;
+    uint8_t *bj = k + i * (uint32_t)4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;
+  }
+  ctx1[12U] = ctr;
+  uint32_t *uu____2 = ctx1 + (uint32_t)13U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)3U; i++)
+  {
+    uint32_t *os = uu____2;
+    uint8_t *bj = n + i * (uint32_t)4U;
+    uint32_t u = load32_le(bj);
+    uint32_t r = u;
+    uint32_t x = r;
+    os[i] = x;
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *os = ctx;
+    uint32_t x = ctx1[i];
+    Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_load32(x);
+    os[i] = x0;
+  }
+  Lib_IntVector_Intrinsics_vec256
+  ctr1 =
+    Lib_IntVector_Intrinsics_vec256_load32s((uint32_t)0U,
+      (uint32_t)1U,
+      (uint32_t)2U,
+      (uint32_t)3U,
+      (uint32_t)4U,
+      (uint32_t)5U,
+      (uint32_t)6U,
+      (uint32_t)7U);
+  Lib_IntVector_Intrinsics_vec256 c12 = ctx[12U];
+  ctx[12U] = Lib_IntVector_Intrinsics_vec256_add32(c12, ctr1);
+}
+
+static inline void
+chacha20_xor_block_256(uint8_t *out, uint8_t *text, Lib_IntVector_Intrinsics_vec256 *k)
+{
+  Lib_IntVector_Intrinsics_vec256 v00 = k[0U];
+  Lib_IntVector_Intrinsics_vec256 v16 = k[1U];
+  Lib_IntVector_Intrinsics_vec256 v20 = k[2U];
+  Lib_IntVector_Intrinsics_vec256 v30 = k[3U];
+  Lib_IntVector_Intrinsics_vec256 v40 = k[4U];
+  Lib_IntVector_Intrinsics_vec256 v50 = k[5U];
+  Lib_IntVector_Intrinsics_vec256 v60 = k[6U];
+  Lib_IntVector_Intrinsics_vec256 v70 = k[7U];
+  Lib_IntVector_Intrinsics_vec256
+  v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v00, v16);
+  Lib_IntVector_Intrinsics_vec256
+  v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v00, v16);
+  Lib_IntVector_Intrinsics_vec256
+  v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v20, v30);
+  Lib_IntVector_Intrinsics_vec256
+  v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v20, v30);
+  Lib_IntVector_Intrinsics_vec256
+  v4_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v40, v50);
+  Lib_IntVector_Intrinsics_vec256
+  v5_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v40, v50);
+  Lib_IntVector_Intrinsics_vec256
+  v6_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v60, v70);
+  Lib_IntVector_Intrinsics_vec256
+  v7_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v60, v70);
+  Lib_IntVector_Intrinsics_vec256
+  v0__ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v2_);
+  Lib_IntVector_Intrinsics_vec256
+  v1__ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v2_);
+  Lib_IntVector_Intrinsics_vec256
+  v2__ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_, v3_);
+  Lib_IntVector_Intrinsics_vec256
+  v3__ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_, v3_);
+  Lib_IntVector_Intrinsics_vec256
+  v4__ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_, v6_);
+  Lib_IntVector_Intrinsics_vec256
+  v5__ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_, v6_);
+  Lib_IntVector_Intrinsics_vec256
+  v6__ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_, v7_);
+  Lib_IntVector_Intrinsics_vec256
+  v7__ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_, v7_);
+  Lib_IntVector_Intrinsics_vec256
+  v0___ = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0__, v4__);
+  Lib_IntVector_Intrinsics_vec256
+  v1___ = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0__, v4__);
+  Lib_IntVector_Intrinsics_vec256
+  v2___ = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1__, v5__);
+  Lib_IntVector_Intrinsics_vec256
+  v3___ = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1__, v5__);
+  Lib_IntVector_Intrinsics_vec256
+  v4___ = Lib_IntVector_Intrinsics_vec256_interleave_low128(v2__, v6__);
+  Lib_IntVector_Intrinsics_vec256
+  v5___ = Lib_IntVector_Intrinsics_vec256_interleave_high128(v2__, v6__);
+  Lib_IntVector_Intrinsics_vec256
+  v6___ = Lib_IntVector_Intrinsics_vec256_interleave_low128(v3__, v7__);
+  Lib_IntVector_Intrinsics_vec256
+  v7___ = Lib_IntVector_Intrinsics_vec256_interleave_high128(v3__, v7__);
+  Lib_IntVector_Intrinsics_vec256 v0 = v0___;
+  Lib_IntVector_Intrinsics_vec256 v1 = v2___;
+  Lib_IntVector_Intrinsics_vec256 v2 = v4___;
+  Lib_IntVector_Intrinsics_vec256 v3 = v6___;
+  Lib_IntVector_Intrinsics_vec256 v4 = v1___;
+  Lib_IntVector_Intrinsics_vec256 v5 = v3___;
+  Lib_IntVector_Intrinsics_vec256 v6 = v5___;
+  Lib_IntVector_Intrinsics_vec256 v7 = v7___;
+  Lib_IntVector_Intrinsics_vec256 v01 = k[8U];
+  Lib_IntVector_Intrinsics_vec256 v110 = k[9U];
+  Lib_IntVector_Intrinsics_vec256 v21 = k[10U];
+  Lib_IntVector_Intrinsics_vec256 v31 = k[11U];
+  Lib_IntVector_Intrinsics_vec256 v41 = k[12U];
+  Lib_IntVector_Intrinsics_vec256 v51 = k[13U];
+  Lib_IntVector_Intrinsics_vec256 v61 = k[14U];
+  Lib_IntVector_Intrinsics_vec256 v71 = k[15U];
+  Lib_IntVector_Intrinsics_vec256
+  v0_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v01, v110);
+  Lib_IntVector_Intrinsics_vec256
+  v1_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v01, v110);
+  Lib_IntVector_Intrinsics_vec256
+  v2_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v21, v31);
+  Lib_IntVector_Intrinsics_vec256
+  v3_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v21, v31);
+  Lib_IntVector_Intrinsics_vec256
+  v4_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v41, v51);
+  Lib_IntVector_Intrinsics_vec256
+  v5_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v41, v51);
+  Lib_IntVector_Intrinsics_vec256
+  v6_0 = Lib_IntVector_Intrinsics_vec256_interleave_low32(v61, v71);
+  Lib_IntVector_Intrinsics_vec256
+  v7_0 = Lib_IntVector_Intrinsics_vec256_interleave_high32(v61, v71);
+  Lib_IntVector_Intrinsics_vec256
+  v0__0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_0, v2_0);
+  Lib_IntVector_Intrinsics_vec256
+  v1__0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_0, v2_0);
+  Lib_IntVector_Intrinsics_vec256
+  v2__0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_0, v3_0);
+  Lib_IntVector_Intrinsics_vec256
+  v3__0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_0, v3_0);
+  Lib_IntVector_Intrinsics_vec256
+  v4__0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_0, v6_0);
+  Lib_IntVector_Intrinsics_vec256
+  v5__0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_0, v6_0);
+  Lib_IntVector_Intrinsics_vec256
+  v6__0 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_0, v7_0);
+  Lib_IntVector_Intrinsics_vec256
+  v7__0 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_0, v7_0);
+  Lib_IntVector_Intrinsics_vec256
+  v0___0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0__0, v4__0);
+  Lib_IntVector_Intrinsics_vec256
+  v1___0 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0__0, v4__0);
+  Lib_IntVector_Intrinsics_vec256
+  v2___0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1__0, v5__0);
+  Lib_IntVector_Intrinsics_vec256
+  v3___0 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1__0, v5__0);
+  Lib_IntVector_Intrinsics_vec256
+  v4___0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v2__0, v6__0);
+  Lib_IntVector_Intrinsics_vec256
+  v5___0 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v2__0, v6__0);
+  Lib_IntVector_Intrinsics_vec256
+  v6___0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v3__0, v7__0);
+  Lib_IntVector_Intrinsics_vec256
+  v7___0 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v3__0, v7__0);
+  Lib_IntVector_Intrinsics_vec256 v8 = v0___0;
+  Lib_IntVector_Intrinsics_vec256 v9 = v2___0;
+  Lib_IntVector_Intrinsics_vec256 v10 = v4___0;
+  Lib_IntVector_Intrinsics_vec256 v11 = v6___0;
+  Lib_IntVector_Intrinsics_vec256 v12 = v1___0;
+  Lib_IntVector_Intrinsics_vec256 v13 = v3___0;
+  Lib_IntVector_Intrinsics_vec256 v14 = v5___0;
+  Lib_IntVector_Intrinsics_vec256 v15 = v7___0;
+  k[0U] = v0;
+  k[1U] = v8;
+  k[2U] = v1;
+  k[3U] = v9;
+  k[4U] = v2;
+  k[5U] = v10;
+  k[6U] = v3;
+  k[7U] = v11;
+  k[8U] = v4;
+  k[9U] = v12;
+  k[10U] = v5;
+  k[11U] = v13;
+  k[12U] = v6;
+  k[13U] = v14;
+  k[14U] = v7;
+  k[15U] = v15;
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)16U; i0++)
+  {
+    Lib_IntVector_Intrinsics_vec256
+    x = Lib_IntVector_Intrinsics_vec256_load_le(text + i0 * (uint32_t)32U);
+    Lib_IntVector_Intrinsics_vec256 y = Lib_IntVector_Intrinsics_vec256_xor(x, k[i0]);
+    Lib_IntVector_Intrinsics_vec256_store_le(out + i0 * (uint32_t)32U, y);
+  }
+}
+
+/*
+  One 512-byte chunk of ChaCha20 (eight blocks, one per lane) with nh <= 8
+  Poly1305 steps of 64 bytes from hash slotted between its double rounds: the
+  ChaCha20 rounds only use additions, rotations and shuffles, while Poly1305 is
+  bound by the multiplier, so the two instruction streams overlap well.
+*/
+static inline void
+chacha20_poly1305_chunk_256(
+  Lib_IntVector_Intrinsics_vec256 *ctx,
+  Lib_IntVector_Intrinsics_vec256 *st,
+  uint32_t i,
+  uint8_t *out,
+  uint8_t *text,
+  uint32_t nh,
+  uint8_t *hash
+)
+{
+  Lib_IntVector_Intrinsics_vec256 k[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    k[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  memcpy(k, st, (uint32_t)16U * sizeof (Lib_IntVector_Intrinsics_vec256));
+  uint32_t ctr_u32 = (uint32_t)8U * i;
+  Lib_IntVector_Intrinsics_vec256 cv = Lib_IntVector_Intrinsics_vec256_load32(ctr_u32);
+  k[12U] = Lib_IntVector_Intrinsics_vec256_add32(k[12U], cv);
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)10U; j++)
+  {
+    double_round_256(k);
+    if (j < nh)
+    {
+      poly1305_blocks4_256(ctx, (uint32_t)1U, hash + j * (uint32_t)64U);
+    }
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)16U; i0++)
+  {
+    Lib_IntVector_Intrinsics_vec256 *os = k;
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_add32(k[i0], st[i0]);
+    os[i0] = x;
+  }
+  k[12U] = Lib_IntVector_Intrinsics_vec256_add32(k[12U], cv);
+  chacha20_xor_block_256(out, text, k);
+}
+
+/*
+  Single pass over the message. On encryption, the ciphertext of chunk i - 1 is
+  absorbed while the keystream of chunk i is computed; on decryption, each
+  chunk of ciphertext is absorbed before it is overwritten, which keeps
+  in-place operation possible. The tail shorter than a chunk goes through the
+  two-pass code.
+*/
+static inline void
+poly1305_chacha20_stitched_256(
+  Lib_IntVector_Intrinsics_vec256 *ctx,
+  bool encrypt,
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text
+)
+{
+  Lib_IntVector_Intrinsics_vec256 *pre0 = ctx + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec256 *acc0 = ctx;
+  Lib_IntVector_Intrinsics_vec256 st[16U];
+  for (uint32_t _i = 0U; _i < (uint32_t)16U; ++_i)
+    st[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  chacha20_init_256(st, k, n, (uint32_t)1U);
+  uint32_t nc = len / (uint32_t)512U;
+  uint32_t len0 = nc * (uint32_t)512U;
+  for (uint32_t i = (uint32_t)0U; i < nc; i++)
+  {
+    uint8_t *o = out + i * (uint32_t)512U;
+    uint8_t *t = text + i * (uint32_t)512U;
+    if (encrypt)
+    {
+      if (i == (uint32_t)0U)
+      {
+        chacha20_poly1305_chunk_256(ctx, st, i, o, t, (uint32_t)0U, o);
+        Hacl_Impl_Poly1305_Field32xN_256_load_acc4(acc0, o);
+      }
+      else if (i == (uint32_t)1U)
+      {
+        chacha20_poly1305_chunk_256(ctx, st, i, o, t, (uint32_t)7U, out + (uint32_t)64U);
+      }
+      else
+      {
+        chacha20_poly1305_chunk_256(ctx, st, i, o, t, (uint32_t)8U, o - (uint32_t)512U);
+      }
+    }
+    else if (i == (uint32_t)0U)
+    {
+      Hacl_Impl_Poly1305_Field32xN_256_load_acc4(acc0, t);
+      chacha20_poly1305_chunk_256(ctx, st, i, o, t, (uint32_t)7U, t + (uint32_t)64U);
+    }
+    else
+    {
+      chacha20_poly1305_chunk_256(ctx, st, i, o, t, (uint32_t)8U, t);
+    }
+  }
+  if (encrypt && nc == (uint32_t)1U)
+  {
+    poly1305_blocks4_256(ctx, (uint32_t)7U, out + (uint32_t)64U);
+  }
+  else if (encrypt && nc > (uint32_t)1U)
+  {
+    poly1305_blocks4_256(ctx, (uint32_t)8U, out + len0 - (uint32_t)512U);
+  }
+  if (nc > (uint32_t)0U)
+  {
+    Hacl_Impl_Poly1305_Field32xN_256_fmul_r4_normalize(acc0, pre0);
+  }
+  uint32_t len1 = len - len0;
+  uint32_t ctr = (uint32_t)1U + len0 / (uint32_t)64U;
+  if (encrypt)
+  {
+    Hacl_Chacha20_Vec256_chacha20_encrypt_256(len1, out + len0, text + len0, k, n, ctr);
+    poly1305_padded_256(ctx, len1, out + len0);
+  }
+  else
+  {
+    poly1305_padded_256(ctx, len1, text + len0);
+    Hacl_Chacha20_Vec256_chacha20_encrypt_256(len1, out + len0, text + len0, k, n, ctr);
+  }
+}
+
+void
+Hacl_Chacha20Poly1305_256_aead_encrypt_stitched(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *mac
+)
+{
+  Lib_IntVector_Intrinsics_vec256 ctx[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Chacha20_Vec256_chacha20_encrypt_256((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
+  uint8_t *key = tmp;
+  Hacl_Poly1305_256_poly1305_init(ctx, key);
+  poly1305_padded_256(ctx, aadlen, aad);
+  poly1305_chacha20_stitched_256(ctx, true, k, n, mlen, cipher, m);
+  poly1305_lengths_256(ctx, aadlen, mlen);
+  Hacl_Poly1305_256_poly1305_finish(mac, key, ctx);
+}
+
+uint32_t
+Hacl_Chacha20Poly1305_256_aead_decrypt_stitched(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *mac
+)
+{
+  Lib_IntVector_Intrinsics_vec256 ctx[25U];
+  for (uint32_t _i = 0U; _i < (uint32_t)25U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  uint8_t computed_mac[16U] = { 0U };
+  uint8_t tmp[64U] = { 0U };
+  Hacl_Chacha20_Vec256_chacha20_encrypt_256((uint32_t)64U, tmp, tmp, k, n, (uint32_t)0U);
+  uint8_t *key = tmp;
+  Hacl_Poly1305_256_poly1305_init(ctx, key);
+  poly1305_padded_256(ctx, aadlen, aad);
+  poly1305_chacha20_stitched_256(ctx, false, k, n, mlen, m, cipher);
+  poly1305_lengths_256(ctx, aadlen, mlen);
+  Hacl_Poly1305_256_poly1305_finish(computed_mac, key, ctx);
+  uint8_t res = (uint8_t)255U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(computed_mac[i], mac[i]);
+    res = uu____0 & res;
+  }
+  uint8_t z = res;
+  if (z == (uint8_t)255U)
+  {
+    return (uint32_t)0U;
+  }
+  Lib_Memzero0_memzero(m, mlen * sizeof (m[0U]));
+  return (uint32_t)1U;
+}
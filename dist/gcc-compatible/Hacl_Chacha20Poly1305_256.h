@@ -38,6 +38,7 @@ extern "C" {
 
 
 #include "Hacl_Kremlib.h"
+#include "Lib_Memzero0.h"
 #include "Hacl_Chacha20_Vec256.h"
 #include "Hacl_Poly1305_256.h"
 
@@ -65,6 +66,39 @@ Hacl_Chacha20Poly1305_256_aead_decrypt(
   uint8_t *mac
 );
 
+/*
+  Same as aead_encrypt, but ChaCha20 and Poly1305 run over the message in a
+  single pass of 512-byte chunks.
+*/
+void
+Hacl_Chacha20Poly1305_256_aead_encrypt_stitched(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *mac
+);
+
+/*
+  Same as aead_decrypt, but each chunk of ciphertext is authenticated and
+  decrypted in a single pass. The plaintext is therefore written to m before
+  the tag is checked; if the check fails, m is zeroed and 1 is returned.
+*/
+uint32_t
+Hacl_Chacha20Poly1305_256_aead_decrypt_stitched(
+  uint8_t *k,
+  uint8_t *n,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *cipher,
+  uint8_t *mac
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -24,6 +24,8 @@
 
 #include "Hacl_Ed25519.h"
 
+#include "Hacl_Ed25519_PrecompTable.h"
+
 static void fsum(uint64_t *a, uint64_t *b)
 {
   Hacl_Impl_Curve25519_Field51_fadd(a, a, b);
@@ -514,34 +516,99 @@ void Hacl_Impl_Ed25519_Ladder_point_mul(uint64_t *result, uint8_t *scalar, uint6
   memcpy(result, nq, (uint32_t)20U * sizeof (uint64_t));
 }
 
+/*
+  Constant-time fixed-base multiplication: the scalar is recoded into 64 signed
+  radix-16 digits e_i in [-8, 8], so that
+    [a]B = sum e_i 16^i B = [16](sum_j [e_2j+1](256^j B)) + sum_j [e_2j](256^j B)
+  and each [e](256^j B) is read from the precomputed table by scanning the whole
+  row and conditionally negating, without secret-dependent branches or indices.
+*/
+static void recode_radix16(int8_t *e, uint8_t *a)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    e[(uint32_t)2U * i] = (int8_t)(a[i] & (uint8_t)15U);
+    e[(uint32_t)2U * i + (uint32_t)1U] = (int8_t)(a[i] >> (uint32_t)4U & (uint8_t)15U);
+  }
+  int8_t carry = (int8_t)0;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)63U; i++)
+  {
+    e[i] = (int8_t)(e[i] + carry);
+    carry = (int8_t)((e[i] + (int8_t)8) >> (uint32_t)4U);
+    e[i] = (int8_t)(e[i] - carry * (int8_t)16);
+  }
+  e[63U] = (int8_t)(e[63U] + carry);
+}
+
+static void precomp_basepoint_select(uint64_t *out, uint32_t row, int8_t b)
+{
+  uint64_t zero[5U] = { 0U };
+  uint64_t nx[5U] = { 0U };
+  uint64_t nt[5U] = { 0U };
+  uint32_t ub = (uint32_t)(int32_t)b;
+  uint32_t neg = ub >> (uint32_t)31U;
+  uint64_t babs = (uint64_t)((ub ^ ((uint32_t)0U - neg)) + neg);
+  uint64_t *x = out;
+  uint64_t *y = out + (uint32_t)5U;
+  uint64_t *z = out + (uint32_t)10U;
+  uint64_t *t = out + (uint32_t)15U;
+  memset(out, 0U, (uint32_t)20U * sizeof (uint64_t));
+  y[0U] = (uint64_t)1U;
+  z[0U] = (uint64_t)1U;
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+  {
+    uint64_t mask = FStar_UInt64_eq_mask(babs, (uint64_t)(j + (uint32_t)1U));
+    const
+    uint64_t
+    *e =
+      Hacl_Ed25519_PrecompTable_precomp_basepoint_table_radix16
+      + (row * (uint32_t)8U + j) * (uint32_t)15U;
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)5U; k++)
+    {
+      x[k] = x[k] ^ (mask & (x[k] ^ e[k]));
+      y[k] = y[k] ^ (mask & (y[k] ^ e[k + (uint32_t)5U]));
+      t[k] = t[k] ^ (mask & (t[k] ^ e[k + (uint32_t)10U]));
+    }
+  }
+  memcpy(nx, x, (uint32_t)5U * sizeof (uint64_t));
+  memcpy(nt, t, (uint32_t)5U * sizeof (uint64_t));
+  Hacl_Bignum25519_fdifference(nx, zero);
+  Hacl_Bignum25519_reduce_513(nx);
+  Hacl_Bignum25519_fdifference(nt, zero);
+  Hacl_Bignum25519_reduce_513(nt);
+  uint64_t nmask = (uint64_t)0U - (uint64_t)neg;
+  for (uint32_t k = (uint32_t)0U; k < (uint32_t)5U; k++)
+  {
+    x[k] = x[k] ^ (nmask & (x[k] ^ nx[k]));
+    t[k] = t[k] ^ (nmask & (t[k] ^ nt[k]));
+  }
+}
+
 static void point_mul_g(uint64_t *result, uint8_t *scalar)
 {
-  uint64_t g[20U] = { 0U };
-  uint64_t *gx = g;
-  uint64_t *gy = g + (uint32_t)5U;
-  uint64_t *gz = g + (uint32_t)10U;
-  uint64_t *gt = g + (uint32_t)15U;
-  gx[0U] = (uint64_t)0x00062d608f25d51aU;
-  gx[1U] = (uint64_t)0x000412a4b4f6592aU;
-  gx[2U] = (uint64_t)0x00075b7171a4b31dU;
-  gx[3U] = (uint64_t)0x0001ff60527118feU;
-  gx[4U] = (uint64_t)0x000216936d3cd6e5U;
-  gy[0U] = (uint64_t)0x0006666666666658U;
-  gy[1U] = (uint64_t)0x0004ccccccccccccU;
-  gy[2U] = (uint64_t)0x0001999999999999U;
-  gy[3U] = (uint64_t)0x0003333333333333U;
-  gy[4U] = (uint64_t)0x0006666666666666U;
-  gz[0U] = (uint64_t)1U;
-  gz[1U] = (uint64_t)0U;
-  gz[2U] = (uint64_t)0U;
-  gz[3U] = (uint64_t)0U;
-  gz[4U] = (uint64_t)0U;
-  gt[0U] = (uint64_t)0x00068ab3a5b7dda3U;
-  gt[1U] = (uint64_t)0x00000eea2a5eadbbU;
-  gt[2U] = (uint64_t)0x0002af8df483c27eU;
-  gt[3U] = (uint64_t)0x000332b375274732U;
-  gt[4U] = (uint64_t)0x00067875f0fd78b7U;
-  Hacl_Impl_Ed25519_Ladder_point_mul(result, scalar, g);
+  int8_t e[64U] = { 0U };
+  uint64_t pt[20U] = { 0U };
+  uint64_t tmp[20U] = { 0U };
+  recode_radix16(e, scalar);
+  memset(result, 0U, (uint32_t)20U * sizeof (uint64_t));
+  result[5U] = (uint64_t)1U;
+  result[10U] = (uint64_t)1U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    precomp_basepoint_select(pt, i, e[(uint32_t)2U * i + (uint32_t)1U]);
+    Hacl_Impl_Ed25519_PointAdd_point_add(tmp, result, pt);
+    memcpy(result, tmp, (uint32_t)20U * sizeof (uint64_t));
+  }
+  point_double(tmp, result);
+  point_double(result, tmp);
+  point_double(tmp, result);
+  point_double(result, tmp);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    precomp_basepoint_select(pt, i, e[(uint32_t)2U * i]);
+    Hacl_Impl_Ed25519_PointAdd_point_add(tmp, result, pt);
+    memcpy(result, tmp, (uint32_t)20U * sizeof (uint64_t));
+  }
 }
 
 void Hacl_Impl_Ed25519_PointCompress_point_compress(uint8_t *z, uint64_t *p)
@@ -2014,6 +2081,377 @@ bool Hacl_Impl_Ed25519_PointEqual_point_equal(uint64_t *p, uint64_t *q)
   return false;
 }
 
+static void point_negate(uint64_t *out, uint64_t *p)
+{
+  uint64_t zero[5U] = { 0U };
+  uint64_t *x = out;
+  uint64_t *t = out + (uint32_t)15U;
+  memcpy(out, p, (uint32_t)20U * sizeof (uint64_t));
+  Hacl_Bignum25519_fdifference(x, zero);
+  Hacl_Bignum25519_reduce_513(x);
+  Hacl_Bignum25519_fdifference(t, zero);
+  Hacl_Bignum25519_reduce_513(t);
+}
+
+static void point_identity(uint64_t *out)
+{
+  memset(out, 0U, (uint32_t)20U * sizeof (uint64_t));
+  out[5U] = (uint64_t)1U;
+  out[10U] = (uint64_t)1U;
+}
+
+static bool point_is_identity(uint64_t *p)
+{
+  uint64_t id[20U] = { 0U };
+  point_identity(id);
+  return Hacl_Impl_Ed25519_PointEqual_point_equal(p, id);
+}
+
+static void point_base(uint64_t *g)
+{
+  uint64_t *gx = g;
+  uint64_t *gy = g + (uint32_t)5U;
+  uint64_t *gz = g + (uint32_t)10U;
+  uint64_t *gt = g + (uint32_t)15U;
+  gx[0U] = (uint64_t)0x00062d608f25d51aU;
+  gx[1U] = (uint64_t)0x000412a4b4f6592aU;
+  gx[2U] = (uint64_t)0x00075b7171a4b31dU;
+  gx[3U] = (uint64_t)0x0001ff60527118feU;
+  gx[4U] = (uint64_t)0x000216936d3cd6e5U;
+  gy[0U] = (uint64_t)0x0006666666666658U;
+  gy[1U] = (uint64_t)0x0004ccccccccccccU;
+  gy[2U] = (uint64_t)0x0001999999999999U;
+  gy[3U] = (uint64_t)0x0003333333333333U;
+  gy[4U] = (uint64_t)0x0006666666666666U;
+  gz[0U] = (uint64_t)1U;
+  gz[1U] = (uint64_t)0U;
+  gz[2U] = (uint64_t)0U;
+  gz[3U] = (uint64_t)0U;
+  gz[4U] = (uint64_t)0U;
+  gt[0U] = (uint64_t)0x00068ab3a5b7dda3U;
+  gt[1U] = (uint64_t)0x00000eea2a5eadbbU;
+  gt[2U] = (uint64_t)0x0002af8df483c27eU;
+  gt[3U] = (uint64_t)0x000332b375274732U;
+  gt[4U] = (uint64_t)0x00067875f0fd78b7U;
+}
+
+/*
+  Variable-time multi-scalar multiplication, used for verification only: every
+  input (keys, signatures, batch coefficients) is public.
+
+  Scalars are recoded in width-w non-adjacent form: each digit is zero or odd and
+  in [-(2^(w-1) - 1), 2^(w-1) - 1], and there are on average 256/(w+1) non-zero
+  digits. Variable points use w = 5 with tables holding [1]P, [3]P, ..., [15]P;
+  the base point uses w = 8 with the static table of its odd multiples.
+  Negative digits subtract.
+*/
+static void precomp_odd_multiples(uint64_t *table, uint64_t *p)
+{
+  uint64_t p2[20U] = { 0U };
+  memcpy(table, p, (uint32_t)20U * sizeof (uint64_t));
+  point_double(p2, p);
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)8U; i++)
+  {
+    Hacl_Impl_Ed25519_PointAdd_point_add(table + i * (uint32_t)20U,
+      table + (i - (uint32_t)1U) * (uint32_t)20U,
+      p2);
+  }
+}
+
+static void slide(int8_t *r, uint8_t *a, uint32_t w)
+{
+  int32_t bound = ((int32_t)1 << (w - (uint32_t)1U)) - (int32_t)1;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
+  {
+    r[i] = (int8_t)((uint32_t)1U & (uint32_t)a[i >> (uint32_t)3U] >> (i & (uint32_t)7U));
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
+  {
+    if (r[i] != (int8_t)0)
+    {
+      for (uint32_t b = (uint32_t)1U; b <= w + (uint32_t)1U && i + b < (uint32_t)256U; b++)
+      {
+        if (r[i + b] != (int8_t)0)
+        {
+          int32_t ri = (int32_t)r[i];
+          int32_t rb = (int32_t)r[i + b] * ((int32_t)1 << b);
+          if (ri + rb <= bound)
+          {
+            r[i] = (int8_t)(ri + rb);
+            r[i + b] = (int8_t)0;
+          }
+          else if (ri - rb >= -bound)
+          {
+            r[i] = (int8_t)(ri - rb);
+            for (uint32_t k = i + b; k < (uint32_t)256U; k++)
+            {
+              if (r[k] == (int8_t)0)
+              {
+                r[k] = (int8_t)1;
+                break;
+              }
+              r[k] = (int8_t)0;
+            }
+          }
+          else
+          {
+            break;
+          }
+        }
+      }
+    }
+  }
+}
+
+static void point_add_digit(uint64_t *out, uint64_t *table, int8_t d)
+{
+  uint64_t tmp[20U] = { 0U };
+  if (d > (int8_t)0)
+  {
+    Hacl_Impl_Ed25519_PointAdd_point_add(tmp, out, table + (uint32_t)(d / (int8_t)2) * (uint32_t)20U);
+  }
+  else
+  {
+    uint64_t neg[20U] = { 0U };
+    point_negate(neg, table + (uint32_t)(-d / (int8_t)2) * (uint32_t)20U);
+    Hacl_Impl_Ed25519_PointAdd_point_add(tmp, out, neg);
+  }
+  memcpy(out, tmp, (uint32_t)20U * sizeof (uint64_t));
+}
+
+static void point_mul_multi_vartime(uint64_t *out, uint32_t n, uint64_t *tables, int8_t *nafs)
+{
+  uint64_t tmp[20U] = { 0U };
+  point_identity(out);
+  uint32_t top = (uint32_t)256U;
+  bool found = false;
+  while (!found && top > (uint32_t)0U)
+  {
+    top--;
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      found = found || nafs[j * (uint32_t)256U + top] != (int8_t)0;
+    }
+  }
+  if (!found)
+  {
+    return;
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 <= top; i0++)
+  {
+    uint32_t i = top - i0;
+    point_double(tmp, out);
+    memcpy(out, tmp, (uint32_t)20U * sizeof (uint64_t));
+    for (uint32_t j = (uint32_t)0U; j < n; j++)
+    {
+      int8_t d = nafs[j * (uint32_t)256U + i];
+      if (d != (int8_t)0)
+      {
+        point_add_digit(out, tables + j * (uint32_t)160U, d);
+      }
+    }
+  }
+}
+
+static void precomp_basepoint_odd(uint64_t *out, int8_t d)
+{
+  uint32_t j = d > (int8_t)0 ? (uint32_t)(d / (int8_t)2) : (uint32_t)(-d / (int8_t)2);
+  const uint64_t *e = Hacl_Ed25519_PrecompTable_precomp_basepoint_table_odd_w8 + j * (uint32_t)15U;
+  uint64_t *x = out;
+  uint64_t *y = out + (uint32_t)5U;
+  uint64_t *z = out + (uint32_t)10U;
+  uint64_t *t = out + (uint32_t)15U;
+  memcpy(x, e, (uint32_t)5U * sizeof (uint64_t));
+  memcpy(y, e + (uint32_t)5U, (uint32_t)5U * sizeof (uint64_t));
+  memset(z, 0U, (uint32_t)5U * sizeof (uint64_t));
+  z[0U] = (uint64_t)1U;
+  memcpy(t, e + (uint32_t)10U, (uint32_t)5U * sizeof (uint64_t));
+  if (d < (int8_t)0)
+  {
+    uint64_t zero[5U] = { 0U };
+    Hacl_Bignum25519_fdifference(x, zero);
+    Hacl_Bignum25519_reduce_513(x);
+    Hacl_Bignum25519_fdifference(t, zero);
+    Hacl_Bignum25519_reduce_513(t);
+  }
+}
+
+/*
+  [s_b]B + [s_q]Q in one pass of shared doublings (Straus), where table_q holds
+  the odd multiples of Q. Variable time: verification only.
+*/
+static void
+point_mul_double_g_vartime(uint64_t *out, uint8_t *s_b, uint8_t *s_q, uint64_t *table_q)
+{
+  int8_t naf_b[256U] = { 0U };
+  int8_t naf_q[256U] = { 0U };
+  uint64_t pt[20U] = { 0U };
+  uint64_t tmp[20U] = { 0U };
+  slide(naf_b, s_b, (uint32_t)8U);
+  slide(naf_q, s_q, (uint32_t)5U);
+  point_identity(out);
+  uint32_t top = (uint32_t)256U;
+  while (top > (uint32_t)0U && naf_b[top - (uint32_t)1U] == (int8_t)0
+    && naf_q[top - (uint32_t)1U] == (int8_t)0)
+  {
+    top--;
+  }
+  for (uint32_t i0 = (uint32_t)0U; i0 < top; i0++)
+  {
+    uint32_t i = top - (uint32_t)1U - i0;
+    point_double(tmp, out);
+    memcpy(out, tmp, (uint32_t)20U * sizeof (uint64_t));
+    if (naf_b[i] != (int8_t)0)
+    {
+      precomp_basepoint_odd(pt, naf_b[i]);
+      Hacl_Impl_Ed25519_PointAdd_point_add(tmp, out, pt);
+      memcpy(out, tmp, (uint32_t)20U * sizeof (uint64_t));
+    }
+    if (naf_q[i] != (int8_t)0)
+    {
+      point_add_digit(out, table_q, naf_q[i]);
+    }
+  }
+}
+
+/*
+  [8]([s]B - R - [h]A) == O, i.e. the cofactored verification equation of
+  RFC 8032, Section 5.1.7, for a single signature. The table holds the odd
+  multiples of -A; neg_r is -R.
+*/
+static bool verify_cofactored_single(uint64_t *table_neg_a, uint64_t *neg_r, uint8_t *s, uint8_t *h)
+{
+  uint64_t d[20U] = { 0U };
+  uint64_t tmp[20U] = { 0U };
+  point_mul_double_g_vartime(d, s, h, table_neg_a);
+  Hacl_Impl_Ed25519_PointAdd_point_add(tmp, d, neg_r);
+  point_double(d, tmp);
+  point_double(tmp, d);
+  point_double(d, tmp);
+  return point_is_identity(d);
+}
+
+#define BATCH_CHUNK ((uint32_t)16U)
+
+/*
+  Verifies up to BATCH_CHUNK signatures with a single multi-scalar
+  multiplication. With unpredictable 128-bit coefficients z_i, the equations
+  [8]([S_i]B - R_i - [h_i]A_i) == O all hold iff (except with probability 2^-128)
+    [8]([sum z_i S_i]B - sum [z_i]R_i - sum [z_i h_i]A_i) == O.
+  The coefficients are derived by hashing every signature, public key and h_i
+  of the chunk, so they cannot be known before the batch is fixed. If the
+  combined check fails, each signature is checked on its own to find the bad ones.
+*/
+static bool
+verify_batch_chunk(uint32_t n, uint8_t **pub, uint32_t *len, uint8_t **msg, uint8_t **signature, bool *valid)
+{
+  uint64_t tables[(2U * 16U + 1U) * 160U];
+  int8_t nafs[(2U * 16U + 1U) * 256U];
+  uint8_t transcript[16U * 128U];
+  uint8_t hs[16U * 32U];
+  uint32_t idx[16U];
+  uint64_t point[20U] = { 0U };
+  uint64_t q[20U] = { 0U };
+  uint64_t tmp[20U] = { 0U };
+  uint64_t zs[5U] = { 0U };
+  uint64_t acc[5U] = { 0U };
+  uint32_t m = (uint32_t)0U;
+  bool all = true;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint64_t s[5U] = { 0U };
+    bool b = Hacl_Impl_Ed25519_PointDecompress_point_decompress(point, pub[i]);
+    if (b)
+    {
+      point_negate(tmp, point);
+      precomp_odd_multiples(tables + ((uint32_t)1U + n + m) * (uint32_t)160U, tmp);
+      b = Hacl_Impl_Ed25519_PointDecompress_point_decompress(point, signature[i]);
+    }
+    if (b)
+    {
+      load_32_bytes(s, signature[i] + (uint32_t)32U);
+      b = !gte_q(s);
+    }
+    if (b)
+    {
+      uint64_t h[5U] = { 0U };
+      point_negate(tmp, point);
+      precomp_odd_multiples(tables + ((uint32_t)1U + m) * (uint32_t)160U, tmp);
+      sha512_modq_pre_pre2(h, signature[i], pub[i], len[i], msg[i]);
+      store_56(hs + m * (uint32_t)32U, h);
+      memcpy(transcript + m * (uint32_t)128U, signature[i], (uint32_t)64U * sizeof (uint8_t));
+      memcpy(transcript + m * (uint32_t)128U + (uint32_t)64U, pub[i], (uint32_t)32U * sizeof (uint8_t));
+      memcpy(transcript + m * (uint32_t)128U + (uint32_t)96U, hs + m * (uint32_t)32U,
+        (uint32_t)32U * sizeof (uint8_t));
+      idx[m] = i;
+      m++;
+    }
+    else
+    {
+      all = false;
+    }
+    valid[i] = b;
+  }
+  if (m == (uint32_t)0U)
+  {
+    return all;
+  }
+  /* The -A_i tables were laid out assuming all n signatures are well-formed. */
+  if (m < n)
+  {
+    memmove(tables + ((uint32_t)1U + m) * (uint32_t)160U,
+      tables + ((uint32_t)1U + n) * (uint32_t)160U,
+      m * (uint32_t)160U * sizeof (uint64_t));
+  }
+  point_base(point);
+  precomp_odd_multiples(tables, point);
+  uint8_t seed[68U] = { 0U };
+  Hacl_Hash_SHA2_hash_512(transcript, m * (uint32_t)128U, seed);
+  for (uint32_t j = (uint32_t)0U; j < m; j++)
+  {
+    uint8_t zh[64U] = { 0U };
+    uint8_t z[32U] = { 0U };
+    uint8_t zh_bytes[32U] = { 0U };
+    uint64_t zl[5U] = { 0U };
+    uint64_t h[5U] = { 0U };
+    uint64_t s[5U] = { 0U };
+    store32_le(seed + (uint32_t)64U, j);
+    Hacl_Hash_SHA2_hash_512(seed, (uint32_t)68U, zh);
+    memcpy(z, zh, (uint32_t)16U * sizeof (uint8_t));
+    load_32_bytes(zl, z);
+    load_32_bytes(h, hs + j * (uint32_t)32U);
+    load_32_bytes(s, signature[idx[j]] + (uint32_t)32U);
+    mul_modq(zs, zl, s);
+    add_modq(acc, acc, zs);
+    mul_modq(zs, zl, h);
+    store_56(zh_bytes, zs);
+    slide(nafs + ((uint32_t)1U + j) * (uint32_t)256U, z, (uint32_t)5U);
+    slide(nafs + ((uint32_t)1U + m + j) * (uint32_t)256U, zh_bytes, (uint32_t)5U);
+  }
+  uint8_t acc_bytes[32U] = { 0U };
+  store_56(acc_bytes, acc);
+  slide(nafs, acc_bytes, (uint32_t)5U);
+  point_mul_multi_vartime(q, (uint32_t)2U * m + (uint32_t)1U, tables, nafs);
+  point_double(tmp, q);
+  point_double(q, tmp);
+  point_double(tmp, q);
+  if (point_is_identity(tmp))
+  {
+    return all;
+  }
+  for (uint32_t j = (uint32_t)0U; j < m; j++)
+  {
+    bool b =
+      verify_cofactored_single(tables + ((uint32_t)1U + m + j) * (uint32_t)160U,
+        tables + ((uint32_t)1U + j) * (uint32_t)160U,
+        signature[idx[j]] + (uint32_t)32U,
+        hs + j * (uint32_t)32U);
+    valid[idx[j]] = b;
+    all = all && b;
+  }
+  return all;
+}
+
 void Hacl_Ed25519_sign(uint8_t *signature, uint8_t *priv, uint32_t len, uint8_t *msg)
 {
   uint8_t tmp_bytes[352U] = { 0U };
@@ -2059,14 +2497,14 @@ bool Hacl_Ed25519_verify(uint8_t *pub, uint32_t len, uint8_t *msg, uint8_t *sign
         sha512_modq_pre_pre2(r_2, rs1, pub, len, msg);
         store_56(tmp_, r_2);
         uint8_t *uu____0 = signature + (uint32_t)32U;
-        uint64_t tmp1[60U] = { 0U };
-        uint64_t *hA = tmp1;
-        uint64_t *rhA = tmp1 + (uint32_t)20U;
-        uint64_t *sB = tmp1 + (uint32_t)40U;
-        point_mul_g(sB, uu____0);
-        Hacl_Impl_Ed25519_Ladder_point_mul(hA, tmp_, a_1);
-        Hacl_Impl_Ed25519_PointAdd_point_add(rhA, r_1, hA);
-        bool b1 = Hacl_Impl_Ed25519_PointEqual_point_equal(sB, rhA);
+        uint64_t tmp1[200U] = { 0U };
+        uint64_t *sBmhA = tmp1;
+        uint64_t *neg_a = tmp1 + (uint32_t)20U;
+        uint64_t *table_neg_a = tmp1 + (uint32_t)40U;
+        point_negate(neg_a, a_1);
+        precomp_odd_multiples(table_neg_a, neg_a);
+        point_mul_double_g_vartime(sBmhA, uu____0, tmp_, table_neg_a);
+        bool b1 = Hacl_Impl_Ed25519_PointEqual_point_equal(sBmhA, r_1);
         bool b10 = b1;
         res = b10;
       }
@@ -2113,3 +2551,23 @@ void Hacl_Ed25519_sign_expanded(uint8_t *signature, uint8_t *ks, uint32_t len, u
   memcpy(signature + (uint32_t)32U, s_, (uint32_t)32U * sizeof (uint8_t));
 }
 
+bool
+Hacl_Ed25519_verify_batch(
+  uint32_t n,
+  uint8_t **pub,
+  uint32_t *len,
+  uint8_t **msg,
+  uint8_t **signature,
+  bool *valid
+)
+{
+  bool res = true;
+  for (uint32_t i = (uint32_t)0U; i < n; i = i + BATCH_CHUNK)
+  {
+    uint32_t k = n - i < BATCH_CHUNK ? n - i : BATCH_CHUNK;
+    bool b = verify_batch_chunk(k, pub + i, len + i, msg + i, signature + i, valid + i);
+    res = res && b;
+  }
+  return res;
+}
+
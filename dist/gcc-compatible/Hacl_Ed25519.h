@@ -71,6 +71,43 @@ void Hacl_Ed25519_expand_keys(uint8_t *ks, uint8_t *priv);
 
 void Hacl_Ed25519_sign_expanded(uint8_t *signature, uint8_t *ks, uint32_t len, uint8_t *msg);
 
+/*
+  Verifies n signatures at once: the i-th signature is signature[i] (64 bytes),
+  over msg[i] (len[i] bytes), for public key pub[i] (32 bytes).
+
+  On return, valid[i] holds the verdict for the i-th signature, and the
+  function returns true iff all n signatures are valid.
+
+  Signatures are checked in groups of 16 with one random linear combination
+  and a single variable-time multi-scalar multiplication; when a group fails,
+  its signatures are checked one by one.
+
+  The verdicts follow the cofactored equation [8][S]B = [8]R + [8][k]A of
+  RFC 8032, Section 5.1.7, and so differ from the cofactorless
+  Hacl_Ed25519_verify on purpose: a signature whose residual [S]B - R - [k]A
+  is a nonzero point of small order (which requires R or A to carry a
+  small-order component, so honest signers never produce one) is accepted
+  here and rejected there. A cofactorless batch equation cannot be made to
+  agree either, since a random coefficient cancels such a residual with
+  probability up to 1/2. Neither function rejects small-order keys or R
+  outright; tests/ed25519-batch-test.c pins down both behaviours.
+
+  The 128-bit coefficients are not drawn from an RNG but derived by hashing
+  every R, S, A and k of the group (k binds the message). They are only known
+  once the whole group is fixed, so forging a passing group with an invalid
+  signature still needs about 2^128 hash evaluations; verification is then
+  also deterministic and needs no entropy source.
+*/
+bool
+Hacl_Ed25519_verify_batch(
+  uint32_t n,
+  uint8_t **pub,
+  uint32_t *len,
+  uint8_t **msg,
+  uint8_t **signature,
+  bool *valid
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,1666 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Ed25519_PrecompTable_H
+#define __Hacl_Ed25519_PrecompTable_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+
+/*
+  [j * 256^i]B for i = 0..31 and j = 1..8, in affine coordinates (x, y, xy) with
+  fully reduced 51-bit limbs: 15 words per entry, 8 entries per row.
+*/
+static const
+uint64_t
+Hacl_Ed25519_PrecompTable_precomp_basepoint_table_radix16[3840U] =
+  {
+    (uint64_t)0x00062d608f25d51aU, (uint64_t)0x000412a4b4f6592aU, (uint64_t)0x00075b7171a4b31dU,
+    (uint64_t)0x0001ff60527118feU, (uint64_t)0x000216936d3cd6e5U, (uint64_t)0x0006666666666658U,
+    (uint64_t)0x0004ccccccccccccU, (uint64_t)0x0001999999999999U, (uint64_t)0x0003333333333333U,
+    (uint64_t)0x0006666666666666U, (uint64_t)0x00068ab3a5b7dda3U, (uint64_t)0x00000eea2a5eadbbU,
+    (uint64_t)0x0002af8df483c27eU, (uint64_t)0x000332b375274732U, (uint64_t)0x00067875f0fd78b7U,
+    (uint64_t)0x0005a14e2843ce0eU, (uint64_t)0x0000a2baf48bf078U, (uint64_t)0x0000cf9eb0203639U,
+    (uint64_t)0x0002361e821dbe8cU, (uint64_t)0x00036ab384c9f5a0U, (uint64_t)0x000746ae6af8a3c9U,
+    (uint64_t)0x00022c870a2ac1cbU, (uint64_t)0x0006887d5a5ce43dU, (uint64_t)0x0004e10ed12f7464U,
+    (uint64_t)0x0002260cdf309232U, (uint64_t)0x00023f556d69b401U, (uint64_t)0x0001383ee48056e3U,
+    (uint64_t)0x00040ed04d75e6b3U, (uint64_t)0x00046e0ef2af8439U, (uint64_t)0x0002498a7850b2f6U,
+    (uint64_t)0x0002485fd3f8e25cU, (uint64_t)0x0003302c4910d58cU, (uint64_t)0x00036b20e98d0e60U,
+    (uint64_t)0x0007a48ffa573a1fU, (uint64_t)0x00067ae9c4a22928U, (uint64_t)0x0003684878f5b4d4U,
+    (uint64_t)0x0002ece480608058U, (uint64_t)0x00009a7bde7c5bb0U, (uint64_t)0x0004d5d09350c730U,
+    (uint64_t)0x0001267b1d177ee6U, (uint64_t)0x000108fa78b3a41aU, (uint64_t)0x00017f62df8959bfU,
+    (uint64_t)0x0006e4549d709cd6U, (uint64_t)0x00028875f79bc1d6U, (uint64_t)0x0002a4d025cb1dd9U,
+    (uint64_t)0x0002a657c4c9f870U, (uint64_t)0x00003279c2a8e927U, (uint64_t)0x0000d483e469ce7bU,
+    (uint64_t)0x0000a34192ea5c3dU, (uint64_t)0x000203da8db56cffU, (uint64_t)0x0000ab61ca32112fU,
+    (uint64_t)0x00065d45e1fe1be7U, (uint64_t)0x000355c5b133c8a0U, (uint64_t)0x0002f0a3875c42c0U,
+    (uint64_t)0x00047d0e827cb159U, (uint64_t)0x000722f6728a1358U, (uint64_t)0x0003d6dba0f94bf1U,
+    (uint64_t)0x0001f0a581c6578cU, (uint64_t)0x000306390a5d3563U, (uint64_t)0x00022783cd8d8732U,
+    (uint64_t)0x00009cc0322ef233U, (uint64_t)0x000727c37c34b228U, (uint64_t)0x0004b6977970a067U,
+    (uint64_t)0x00043dfe77be7be8U, (uint64_t)0x00049fda73eade35U, (uint64_t)0x00021f83d676c8edU,
+    (uint64_t)0x00015128616ba21aU, (uint64_t)0x0006491998c4a0bbU, (uint64_t)0x000737f016370a44U,
+    (uint64_t)0x0005f4825b298feaU, (uint64_t)0x000150bcf3e801d0U, (uint64_t)0x0000a00124d7ec83U,
+    (uint64_t)0x0004db1fe6bee53aU, (uint64_t)0x0006a618b0752843U, (uint64_t)0x000745c562c9c593U,
+    (uint64_t)0x0002741a7dcbf23dU, (uint64_t)0x00004d8f6884ef07U, (uint64_t)0x000428a6fa879666U,
+    (uint64_t)0x00000e315756606eU, (uint64_t)0x0004c9797ba7a456U, (uint64_t)0x00027ad0f9497ef4U,
+    (uint64_t)0x0000d289ad6c183aU, (uint64_t)0x00053df5dfe505f0U, (uint64_t)0x0004508edb84d3feU,
+    (uint64_t)0x000054de3fc2886dU, (uint64_t)0x0006d6c8b44ef1d2U, (uint64_t)0x00028f8fb91378f9U,
+    (uint64_t)0x00079f73102ebe48U, (uint64_t)0x000027c142ad4ca7U, (uint64_t)0x0003c32efd109aa6U,
+    (uint64_t)0x0005981af50e4107U, (uint64_t)0x0006777e39d2ab0aU, (uint64_t)0x000476041e0fa027U,
+    (uint64_t)0x0006a774f1f70ca5U, (uint64_t)0x00014568685fcf4bU, (uint64_t)0x0004c4b59f4062b8U,
+    (uint64_t)0x0000def57e47a258U, (uint64_t)0x0004dab507c220adU, (uint64_t)0x000297c3e732346eU,
+    (uint64_t)0x00031c563e32b47dU, (uint64_t)0x000545565587ed1bU, (uint64_t)0x000543d3549c8217U,
+    (uint64_t)0x000756ead14a518cU, (uint64_t)0x00070dcdf416e2c4U, (uint64_t)0x000119e77b11d165U,
+    (uint64_t)0x0007fdbc08a584c8U, (uint64_t)0x0007700d31732770U, (uint64_t)0x00013b3e4faceb19U,
+    (uint64_t)0x0000db214316ae7cU, (uint64_t)0x0006742e15f97d77U, (uint64_t)0x00075ba9fc37b9b4U,
+    (uint64_t)0x00078c43dc9263c5U, (uint64_t)0x00022bce3e05e0f3U, (uint64_t)0x0001bcb756b784b3U,
+    (uint64_t)0x00021d30600c9e57U, (uint64_t)0x0006f41ad41a51bfU, (uint64_t)0x0005a689857eadf7U,
+    (uint64_t)0x0002cf664d17c339U, (uint64_t)0x0005708b04614d9cU, (uint64_t)0x0002c4f59ecedf7eU,
+    (uint64_t)0x0000bcdd0cc2a556U, (uint64_t)0x000776ac2aeda417U, (uint64_t)0x000241512752d5e3U,
+    (uint64_t)0x00065ff374e5e093U, (uint64_t)0x0005e7e07ed4e1deU, (uint64_t)0x00042031566cf6c7U,
+    (uint64_t)0x00035824fb3501c2U, (uint64_t)0x00074c9839f46cf6U, (uint64_t)0x00013cb5faf5d540U,
+    (uint64_t)0x0000f55755c51f10U, (uint64_t)0x000365fc2857a27eU, (uint64_t)0x0000c67e5bfbeb5eU,
+    (uint64_t)0x00053a86b67936b6U, (uint64_t)0x00033d215a262b04U, (uint64_t)0x00063e8ae2c1ead5U,
+    (uint64_t)0x0001333c82cd340aU, (uint64_t)0x000366072c3a4a81U, (uint64_t)0x0001c3509887bff6U,
+    (uint64_t)0x0002399998fcf77dU, (uint64_t)0x0002eecbf81b3d08U, (uint64_t)0x0004f764008b93e8U,
+    (uint64_t)0x0001093cdc0e9713U, (uint64_t)0x00028466d9213535U, (uint64_t)0x00013e20996cdba0U,
+    (uint64_t)0x00054d2dc2da1378U, (uint64_t)0x000522be2496053aU, (uint64_t)0x000765bc6fd72749U,
+    (uint64_t)0x000118733aa74460U, (uint64_t)0x0001e7789e2b953aU, (uint64_t)0x000752941df7a968U,
+    (uint64_t)0x0006cef314cc93bbU, (uint64_t)0x000554a7aa3728acU, (uint64_t)0x00073636f95fab74U,
+    (uint64_t)0x00071452d53d8c3cU, (uint64_t)0x00070b225147463bU, (uint64_t)0x00067392b18d9c02U,
+    (uint64_t)0x000009bb22c14b73U, (uint64_t)0x000535826851e4d0U, (uint64_t)0x000200e1303393fcU,
+    (uint64_t)0x000244980ded32ffU, (uint64_t)0x0006afe18eca4bf4U, (uint64_t)0x000602cb44b77956U,
+    (uint64_t)0x00020dcf3889df68U, (uint64_t)0x0006d30f3dedd7c0U, (uint64_t)0x000075c542741675U,
+    (uint64_t)0x0001c7d55b4a2b68U, (uint64_t)0x000089655c23b22aU, (uint64_t)0x00032ecdeaf3c51fU,
+    (uint64_t)0x000682c8563e5b64U, (uint64_t)0x0006b113a52f9f3fU, (uint64_t)0x00054359f327c13dU,
+    (uint64_t)0x00069eaf32d8b212U, (uint64_t)0x0005467018a59657U, (uint64_t)0x00073c975c6d0c02U,
+    (uint64_t)0x0001aeb017159697U, (uint64_t)0x0003c3e94b3a3facU, (uint64_t)0x0002ccd21ea35241U,
+    (uint64_t)0x0006c78dddc2e59bU, (uint64_t)0x00036d2ae0442c71U, (uint64_t)0x00066cb63a6e6c7cU,
+    (uint64_t)0x0002fde6e9a95bd2U, (uint64_t)0x000507fcc850e338U, (uint64_t)0x00064101647815fbU,
+    (uint64_t)0x0000bcd6b508ee9cU, (uint64_t)0x000661b75757abbcU, (uint64_t)0x000597e42a7b09beU,
+    (uint64_t)0x0002fadb6255c92fU, (uint64_t)0x000601f01f443255U, (uint64_t)0x00058978670117a7U,
+    (uint64_t)0x00005da1ae1b5d4bU, (uint64_t)0x0005ee00d9cd9f73U, (uint64_t)0x00013aaa1f36bd93U,
+    (uint64_t)0x000330207ec4e730U, (uint64_t)0x00027c157104cbb8U, (uint64_t)0x000519beaf530bc7U,
+    (uint64_t)0x00023c8ab6490615U, (uint64_t)0x00055862840685fdU, (uint64_t)0x000196f4f8b2bf5aU,
+    (uint64_t)0x0007f59da5a6f110U, (uint64_t)0x000603ba4adc34a9U, (uint64_t)0x00022a95c0e658bcU,
+    (uint64_t)0x0000da5e6f535025U, (uint64_t)0x00011b1432f122f8U, (uint64_t)0x00066c87d66a3570U,
+    (uint64_t)0x0001fdbaf2c3482cU, (uint64_t)0x00067887503d5f1bU, (uint64_t)0x000421680e2c21e1U,
+    (uint64_t)0x0004b0d895cfc0f8U, (uint64_t)0x00066564e8b18189U, (uint64_t)0x000629fa3ac3078eU,
+    (uint64_t)0x000540310b391d99U, (uint64_t)0x00037a2582d266d3U, (uint64_t)0x0003e78cc3af5aa1U,
+    (uint64_t)0x0001d22e8f0ad79dU, (uint64_t)0x0003d718e644bf2dU, (uint64_t)0x00063bf5a23600f9U,
+    (uint64_t)0x0000efe3ee501511U, (uint64_t)0x00008aa2497e40abU, (uint64_t)0x00020a179144089dU,
+    (uint64_t)0x000320d055dbba3fU, (uint64_t)0x000067099540a656U, (uint64_t)0x0003eec9958b0c58U,
+    (uint64_t)0x000192110f13a743U, (uint64_t)0x0007d383c5d267d0U, (uint64_t)0x0000e52bc37ff3fdU,
+    (uint64_t)0x0002bcfbbd1317f7U, (uint64_t)0x00052622b668bd9aU, (uint64_t)0x000318a0f6120abfU,
+    (uint64_t)0x0001c5daa0fa88feU, (uint64_t)0x0003c1ae7527612dU, (uint64_t)0x000015a20711364eU,
+    (uint64_t)0x00016c5865588a24U, (uint64_t)0x000517e43e99fd7aU, (uint64_t)0x0002bf5bc308b642U,
+    (uint64_t)0x000051c91c3f9d7eU, (uint64_t)0x0007b066bece2184U, (uint64_t)0x0002a57f92c42568U,
+    (uint64_t)0x0002a85941a787b1U, (uint64_t)0x00029e44311e8f82U, (uint64_t)0x0000daa1438fdd28U,
+    (uint64_t)0x0005678a8411a565U, (uint64_t)0x00068f4d089a33d3U, (uint64_t)0x00001f35528e7f84U,
+    (uint64_t)0x00000997aa0fbce5U, (uint64_t)0x0005de7faa2ee4e7U, (uint64_t)0x0005e4cef854ec36U,
+    (uint64_t)0x00011203adfedbf0U, (uint64_t)0x00050cb64b03a2f0U, (uint64_t)0x00070555c754c935U,
+    (uint64_t)0x0002c9f23641e1c2U, (uint64_t)0x00032c178a3d4aa1U, (uint64_t)0x0004894ca1aab2e6U,
+    (uint64_t)0x0007ea31aedea51cU, (uint64_t)0x00044276483e390dU, (uint64_t)0x0001e35c1316b640U,
+    (uint64_t)0x000411b172d04f27U, (uint64_t)0x0007d0291282a4e2U, (uint64_t)0x0000474754cb61d1U,
+    (uint64_t)0x00029b991b31b014U, (uint64_t)0x00074e337a01c13bU, (uint64_t)0x00066796114e25f1U,
+    (uint64_t)0x00035c4a7658439cU, (uint64_t)0x0003cd667ecbba17U, (uint64_t)0x00057cb767fd5eddU,
+    (uint64_t)0x00008648f02b3a4dU, (uint64_t)0x00052c87b4b311cfU, (uint64_t)0x000173e079bb48baU,
+    (uint64_t)0x0005f2251be4a1bdU, (uint64_t)0x00058b581d945a8dU, (uint64_t)0x00050076a3f864d7U,
+    (uint64_t)0x00014e4390d7c290U, (uint64_t)0x0007c926f3dd69bbU, (uint64_t)0x0007ff2072205381U,
+    (uint64_t)0x00017950cbd3d0b7U, (uint64_t)0x00073ce78c748a87U, (uint64_t)0x0005e13a0a0cb2caU,
+    (uint64_t)0x0007a7f77532928fU, (uint64_t)0x00058381c33ab994U, (uint64_t)0x0007637f1cb1e5fcU,
+    (uint64_t)0x00033c172e606062U, (uint64_t)0x00066cd87ae85547U, (uint64_t)0x0007aae0a6e28abbU,
+    (uint64_t)0x0004604552facc80U, (uint64_t)0x0003018448ffe42eU, (uint64_t)0x0000ef5ed13f5f0bU,
+    (uint64_t)0x0007475464f29434U, (uint64_t)0x00015744114800e6U, (uint64_t)0x000496e91cff5d55U,
+    (uint64_t)0x00042af416580a11U, (uint64_t)0x0006a6fbd51efa6aU, (uint64_t)0x000206b27616d671U,
+    (uint64_t)0x0007ca58789eaf3dU, (uint64_t)0x0005e1c2b7874585U, (uint64_t)0x000615be7c088b0eU,
+    (uint64_t)0x00016f5f8529f55fU, (uint64_t)0x00027228c0c839c2U, (uint64_t)0x000673aed26d706bU,
+    (uint64_t)0x0002aee5b39ea2fdU, (uint64_t)0x0005a176b2bce933U, (uint64_t)0x000653efe2ea6c90U,
+    (uint64_t)0x0005532a8f320ca8U, (uint64_t)0x0001bf5987794688U, (uint64_t)0x00075dd2cb15d929U,
+    (uint64_t)0x0005affba5f75d88U, (uint64_t)0x000455d905f52d04U, (uint64_t)0x000460470fe6a8b5U,
+    (uint64_t)0x000594d8050a8caeU, (uint64_t)0x00031e44ec7bbe6eU, (uint64_t)0x000395b4de113dd8U,
+    (uint64_t)0x000033dbf271d5fcU, (uint64_t)0x0006f0ce50a3817dU, (uint64_t)0x000398e2405b459fU,
+    (uint64_t)0x0000f32156bd7ac4U, (uint64_t)0x000563c1ca0296ceU, (uint64_t)0x00001314a3c06ce1U,
+    (uint64_t)0x0004643dca20439aU, (uint64_t)0x0003c0923d355e4cU, (uint64_t)0x0001b6ad9d5c1952U,
+    (uint64_t)0x0000b9bfb82f8d48U, (uint64_t)0x000584e7f2a5e367U, (uint64_t)0x0000fe4e547c1381U,
+    (uint64_t)0x0001d81ecbb2c45fU, (uint64_t)0x0003a6e210cd1cc8U, (uint64_t)0x0007f4091979ede0U,
+    (uint64_t)0x0002e5327982a30dU, (uint64_t)0x000257c90b8df0e8U, (uint64_t)0x0007655c2fcd0fc7U,
+    (uint64_t)0x0004861fb552d5fcU, (uint64_t)0x0004825d267c852dU, (uint64_t)0x00000276f25e64b1U,
+    (uint64_t)0x000657c725de8fceU, (uint64_t)0x0005ad57b534cccdU, (uint64_t)0x00078821744738bfU,
+    (uint64_t)0x0005ea70641cec63U, (uint64_t)0x0007783d619f52f8U, (uint64_t)0x0005cfc4600c5c4dU,
+    (uint64_t)0x00034201b0471600U, (uint64_t)0x0007a7aff5114eb0U, (uint64_t)0x0004ff41a1091eccU,
+    (uint64_t)0x0007b87c33701d60U, (uint64_t)0x0006ea66aad8faf4U, (uint64_t)0x0001efd79b351b86U,
+    (uint64_t)0x0005435537abd786U, (uint64_t)0x000631b68dd0b077U, (uint64_t)0x00006d4ffaede82cU,
+    (uint64_t)0x0004e0c5f69a9634U, (uint64_t)0x0003d5a981c48062U, (uint64_t)0x0003c6ca588dc26aU,
+    (uint64_t)0x0002aa4d9961ce97U, (uint64_t)0x000243eb188de73aU, (uint64_t)0x0007b25b1f4ce2f6U,
+    (uint64_t)0x0000821039f4b055U, (uint64_t)0x0002c893328b6fbcU, (uint64_t)0x00016c00f5bd05bfU,
+    (uint64_t)0x0003779298951f45U, (uint64_t)0x0001089e775b3f98U, (uint64_t)0x0004bcb86a15e4dcU,
+    (uint64_t)0x0007bde0969b12c3U, (uint64_t)0x0000275592385f1dU, (uint64_t)0x00047f8fa73cd9a1U,
+    (uint64_t)0x0000cf27d8d43a77U, (uint64_t)0x0001bbb953ae543dU, (uint64_t)0x0005095bb5e76a58U,
+    (uint64_t)0x000013358e63b00aU, (uint64_t)0x0000af367956af63U, (uint64_t)0x0001bd2f2ba408c5U,
+    (uint64_t)0x00001c96d4c55026U, (uint64_t)0x00025ac2c8f76a44U, (uint64_t)0x0001d9b846e94567U,
+    (uint64_t)0x00021108d900134dU, (uint64_t)0x000190d2c605c7afU, (uint64_t)0x000227606de89978U,
+    (uint64_t)0x00020b9b6aaf6f8fU, (uint64_t)0x0005eb00b32efe6eU, (uint64_t)0x0004f6109bb8d7dbU,
+    (uint64_t)0x0007074fbae70d33U, (uint64_t)0x0002d8b40fbd51bbU, (uint64_t)0x00056c6d5f96c2c7U,
+    (uint64_t)0x0005ad320a09a2faU, (uint64_t)0x0002b760154fc5ceU, (uint64_t)0x00063696afc20c02U,
+    (uint64_t)0x00056d440a9c495fU, (uint64_t)0x00068b3b5d8a7ecbU, (uint64_t)0x0001701b9a08901fU,
+    (uint64_t)0x0007dc81af96fed4U, (uint64_t)0x00060c53f3fb22e0U, (uint64_t)0x0004c4757a160430U,
+    (uint64_t)0x0001b2bd2a8d9f2aU, (uint64_t)0x0005137080fab145U, (uint64_t)0x0000a00274f89820U,
+    (uint64_t)0x00023f36e811b9d8U, (uint64_t)0x00011e3a7b995828U, (uint64_t)0x000675ed453cf48fU,
+    (uint64_t)0x000279d550726c46U, (uint64_t)0x0004535c89311d60U, (uint64_t)0x0007bf9008d63661U,
+    (uint64_t)0x0002b081ed92ef54U, (uint64_t)0x000201ab24dcb4cfU, (uint64_t)0x000470d551051ec8U,
+    (uint64_t)0x00069dd3661ba84bU, (uint64_t)0x000479b938c463d8U, (uint64_t)0x00049e7dd1f8a50dU,
+    (uint64_t)0x0006f9746e0e0364U, (uint64_t)0x0000328a0865cb2bU, (uint64_t)0x000753a822295546U,
+    (uint64_t)0x000492c69c5bdb6bU, (uint64_t)0x00070eb718b5e477U, (uint64_t)0x00065212db5be90bU,
+    (uint64_t)0x00069c3c2449cc31U, (uint64_t)0x00067dbc33418bbcU, (uint64_t)0x0007b056093af396U,
+    (uint64_t)0x0001072363ca2f8dU, (uint64_t)0x0001ea88943327a9U, (uint64_t)0x0001982cfe4973e5U,
+    (uint64_t)0x00038436fdf8589aU, (uint64_t)0x00077f71f1a14956U, (uint64_t)0x00011fe538475b39U,
+    (uint64_t)0x0001c4f8360bd73cU, (uint64_t)0x0000b8041409a633U, (uint64_t)0x0001ce557a72a788U,
+    (uint64_t)0x000249b3ebdd1011U, (uint64_t)0x00012f437b17b475U, (uint64_t)0x0007173f5d884de5U,
+    (uint64_t)0x000586375e7b19c4U, (uint64_t)0x00069f0b68125b9aU, (uint64_t)0x00037a47dc3669d6U,
+    (uint64_t)0x0002ec78aa467a8dU, (uint64_t)0x00078cb7f911386bU, (uint64_t)0x0003a3487665627dU,
+    (uint64_t)0x0000d2a89a19c281U, (uint64_t)0x00019491957c0200U, (uint64_t)0x0005f3d6003062adU,
+    (uint64_t)0x0003edb5aeb1f1c6U, (uint64_t)0x0007bd15a3e2bac2U, (uint64_t)0x0003d3e549f6c4ccU,
+    (uint64_t)0x00055ffa5112f8ebU, (uint64_t)0x0002a063fd4ce313U, (uint64_t)0x00027e3d4f7f2a35U,
+    (uint64_t)0x0002166846366960U, (uint64_t)0x00034d9729a3945dU, (uint64_t)0x0003cf404c6279b1U,
+    (uint64_t)0x00066c9cec06e1b6U, (uint64_t)0x000385a1c1f00554U, (uint64_t)0x0001275a30aa7728U,
+    (uint64_t)0x00065efef05bd03dU, (uint64_t)0x00013dda03194fd0U, (uint64_t)0x0006747301b7f7f5U,
+    (uint64_t)0x0003843f078a3173U, (uint64_t)0x00032e845d8c7ff1U, (uint64_t)0x0001ffbd466cadacU,
+    (uint64_t)0x00030403c96f4e4cU, (uint64_t)0x0000f2fcc2114b1cU, (uint64_t)0x0007219fd127c222U,
+    (uint64_t)0x0001414193b15434U, (uint64_t)0x000271b64006d3d0U, (uint64_t)0x000045df50bdd7d9U,
+    (uint64_t)0x0007207dbd956650U, (uint64_t)0x0007600ec14fbcb9U, (uint64_t)0x0000e17e3247881cU,
+    (uint64_t)0x0006e0746310b9c0U, (uint64_t)0x000030f02644f45dU, (uint64_t)0x0007860d4d4d2a40U,
+    (uint64_t)0x000173d1dbdd7b98U, (uint64_t)0x0005aed7e7ea0f4fU, (uint64_t)0x00048121f27758f0U,
+    (uint64_t)0x0004e9bd19448479U, (uint64_t)0x000515054dd8188aU, (uint64_t)0x00017c89c7550e6eU,
+    (uint64_t)0x0003dc59effd00eeU, (uint64_t)0x00029ea44a50a4b4U, (uint64_t)0x00055f63af509005U,
+    (uint64_t)0x0003f2e713bc33d3U, (uint64_t)0x0005aac918c2b1b0U, (uint64_t)0x0005465deda5e88cU,
+    (uint64_t)0x0006c775ac8ab2edU, (uint64_t)0x00052966d7e75326U, (uint64_t)0x00030bc2394d7728U,
+    (uint64_t)0x0006a165894871eaU, (uint64_t)0x0005f0f88de506b2U, (uint64_t)0x0006ad4ec136213fU,
+    (uint64_t)0x000797a46abc0cbbU, (uint64_t)0x00020e5bcde5b262U, (uint64_t)0x0000ca003cb02070U,
+    (uint64_t)0x000462eed5ea13b4U, (uint64_t)0x0004d1e116d13615U, (uint64_t)0x00061efb10c9b91aU,
+    (uint64_t)0x00076bd149709e89U, (uint64_t)0x0004023e310fa12dU, (uint64_t)0x0002db2e6289aa5aU,
+    (uint64_t)0x0006d415be49d4e3U, (uint64_t)0x000248db5682ed71U, (uint64_t)0x0001dc7ba9000caeU,
+    (uint64_t)0x0000b9e21607af00U, (uint64_t)0x0004617ff4f77abaU, (uint64_t)0x0007a979779ff7faU,
+    (uint64_t)0x0002148248127d15U, (uint64_t)0x000658297a8659a8U, (uint64_t)0x0003e38bb230a985U,
+    (uint64_t)0x0003eedf71ca2292U, (uint64_t)0x0004b5bae5a77a86U, (uint64_t)0x0003b8de209a77cbU,
+    (uint64_t)0x0004af7181f41b24U, (uint64_t)0x00019d0bb2dabb2eU, (uint64_t)0x000090cc3ad22c07U,
+    (uint64_t)0x000739476e0b3847U, (uint64_t)0x0003e04a58ec63f8U, (uint64_t)0x00049886fc039f4eU,
+    (uint64_t)0x00072644b443e4a6U, (uint64_t)0x0005c6fbbeafb010U, (uint64_t)0x0000e40895ab3ae5U,
+    (uint64_t)0x00067e5a18ecc8f9U, (uint64_t)0x0000f8e7374be3e2U, (uint64_t)0x00020b53c6b986aeU,
+    (uint64_t)0x000278281c2d3accU, (uint64_t)0x00028e01e9eebe62U, (uint64_t)0x000682a0a58a68c1U,
+    (uint64_t)0x0006d36c8bc54f6eU, (uint64_t)0x0005c412374e86d3U, (uint64_t)0x00014db149d3e0d5U,
+    (uint64_t)0x00034a3ef2080894U, (uint64_t)0x00001a664f9bdbe3U, (uint64_t)0x00050e898f4410b9U,
+    (uint64_t)0x00003891d92af558U, (uint64_t)0x000510a4698251c0U, (uint64_t)0x0002d139c373b6eeU,
+    (uint64_t)0x00033f232869fcdfU, (uint64_t)0x0003be66e4877f0bU, (uint64_t)0x0002a26341ac8b54U,
+    (uint64_t)0x000789f0837fe7b6U, (uint64_t)0x00033bfa90cc1b9dU, (uint64_t)0x0005824fb2da81d9U,
+    (uint64_t)0x00003a5e21302873U, (uint64_t)0x000405f4b7d2b3bcU, (uint64_t)0x000572cfd2fff884U,
+    (uint64_t)0x00053b120db6327cU, (uint64_t)0x000155c029d95cabU, (uint64_t)0x0000a35c7db915d2U,
+    (uint64_t)0x00065d0832d6eb84U, (uint64_t)0x00053e0ac979473dU, (uint64_t)0x00046dae663fdc68U,
+    (uint64_t)0x00070b4a1110cc99U, (uint64_t)0x00077b444058d29eU, (uint64_t)0x00029aecabcdb38aU,
+    (uint64_t)0x00064388b7fb4166U, (uint64_t)0x0006759a4f961d6aU, (uint64_t)0x00043f61ecf8af35U,
+    (uint64_t)0x0004c0b7c2cc6794U, (uint64_t)0x000000db52c40468U, (uint64_t)0x000263d92c8908b0U,
+    (uint64_t)0x0007e6c7c2dca5f4U, (uint64_t)0x0005c433c7226b49U, (uint64_t)0x000534aa6c709c4cU,
+    (uint64_t)0x00041912f8d4f5ccU, (uint64_t)0x000398016e32b8a2U, (uint64_t)0x00065404dba63722U,
+    (uint64_t)0x000434a9ade80267U, (uint64_t)0x0001b8f55022be1aU, (uint64_t)0x0001339dd7aa521dU,
+    (uint64_t)0x0000f3c3b487024aU, (uint64_t)0x00056bec70310915U, (uint64_t)0x00066b33ec86fb32U,
+    (uint64_t)0x00060d9f59056a25U, (uint64_t)0x0005c4301739f91dU, (uint64_t)0x0004666e532b5a79U,
+    (uint64_t)0x0006ab2ddd075077U, (uint64_t)0x0007e484bad1600cU, (uint64_t)0x00014a6bf4cf32e5U,
+    (uint64_t)0x00050382a526b5e6U, (uint64_t)0x00032df147b9286cU, (uint64_t)0x0006eb24d5673c2dU,
+    (uint64_t)0x0003d6530a7c82bcU, (uint64_t)0x0004f6bd651a0841U, (uint64_t)0x0000a7158c176b82U,
+    (uint64_t)0x00033ed6f9d40bd0U, (uint64_t)0x0004bbefbdc2c608U, (uint64_t)0x00063f6849538107U,
+    (uint64_t)0x000420e11412a081U, (uint64_t)0x0000f9d3deb0d51fU, (uint64_t)0x0006e4bce8e72ee6U,
+    (uint64_t)0x0006eb85cc89c0c2U, (uint64_t)0x00077c70029190e4U, (uint64_t)0x0004142f892544adU,
+    (uint64_t)0x000399a4c7024240U, (uint64_t)0x0005dac7acd41b67U, (uint64_t)0x0001e8df616d6e54U,
+    (uint64_t)0x0000222bc0b9efc6U, (uint64_t)0x000386b66e0e23c1U, (uint64_t)0x0003da69124805eaU,
+    (uint64_t)0x0006814de0caac58U, (uint64_t)0x000444929347c2deU, (uint64_t)0x00042aff2e1d6245U,
+    (uint64_t)0x000181af64b48423U, (uint64_t)0x000695f23ff0e456U, (uint64_t)0x0005eb22d1928f3eU,
+    (uint64_t)0x00077785ec5cbbdaU, (uint64_t)0x0004690b8284e8a9U, (uint64_t)0x0001b4407c48eacaU,
+    (uint64_t)0x0002e02a7762575bU, (uint64_t)0x0006f6b2e2755896U, (uint64_t)0x00076a162d1abff7U,
+    (uint64_t)0x000490fa3b4710e5U, (uint64_t)0x0001eacdfd56a61fU, (uint64_t)0x0006cb20ee9c3beeU,
+    (uint64_t)0x000549ca19bd017fU, (uint64_t)0x0000f6c3a96e0032U, (uint64_t)0x0000479be167635aU,
+    (uint64_t)0x0004d2f58f2713efU, (uint64_t)0x00010893b9457875U, (uint64_t)0x00033a81c525ac74U,
+    (uint64_t)0x0003d4e97e286378U, (uint64_t)0x0004e485e1daff38U, (uint64_t)0x000527a746002890U,
+    (uint64_t)0x00051c8d4c76f176U, (uint64_t)0x00004310b39066deU, (uint64_t)0x00028b2ebb173415U,
+    (uint64_t)0x00069fade6abb440U, (uint64_t)0x00055551d6694d28U, (uint64_t)0x0006317458822a73U,
+    (uint64_t)0x000692628efb5e89U, (uint64_t)0x0003b13c71c2a90bU, (uint64_t)0x0005be180d16dc54U,
+    (uint64_t)0x0005f0004a4c2c86U, (uint64_t)0x00023f4d0a9bdc16U, (uint64_t)0x0003d95dd4133c97U,
+    (uint64_t)0x00014890a7ab2481U, (uint64_t)0x0004ba7562e7208aU, (uint64_t)0x0004b9091e470f22U,
+    (uint64_t)0x00043809ef3818c1U, (uint64_t)0x0006ef5f3a007fecU, (uint64_t)0x0005124d8bf03ce2U,
+    (uint64_t)0x000320f5fd1d642bU, (uint64_t)0x000298630e9dbbe6U, (uint64_t)0x00054627423f3186U,
+    (uint64_t)0x0006bc3fb34ab459U, (uint64_t)0x0007983fccb8fdffU, (uint64_t)0x000163226a436855U,
+    (uint64_t)0x0004aaf356b5777bU, (uint64_t)0x0002e94120f7867bU, (uint64_t)0x0006661493ab8ed7U,
+    (uint64_t)0x0003c0fcdb8f1b0cU, (uint64_t)0x0001d87c4e9b20d8U, (uint64_t)0x000234f6214e9262U,
+    (uint64_t)0x000694396c46d896U, (uint64_t)0x0000f7a5029fbe0dU, (uint64_t)0x0004ac845e2b5904U,
+    (uint64_t)0x0006c091e388a820U, (uint64_t)0x00006a3044f1576dU, (uint64_t)0x00069bae0ea4a2caU,
+    (uint64_t)0x00002a112c8ba6d4U, (uint64_t)0x000184b48cb45500U, (uint64_t)0x00024dba26e77c33U,
+    (uint64_t)0x0004707f5e8a7fc6U, (uint64_t)0x000603bdcd99e697U, (uint64_t)0x0001d4eeb0613411U,
+    (uint64_t)0x0003ee0e07a03dc3U, (uint64_t)0x00004e3d85fb1c87U, (uint64_t)0x00000fccecd2b73dU,
+    (uint64_t)0x0001ec19981a14b9U, (uint64_t)0x0006bf8c0b3a434aU, (uint64_t)0x00041cf3c80d1ba5U,
+    (uint64_t)0x00062364b859c113U, (uint64_t)0x0002a53f9591e9b0U, (uint64_t)0x0006861d4b0ffd5aU,
+    (uint64_t)0x0007f8ec47a30758U, (uint64_t)0x0005d17bc7ae6348U, (uint64_t)0x0007f1ed5765a23dU,
+    (uint64_t)0x000614aa29e2f0b9U, (uint64_t)0x00067865bd10140eU, (uint64_t)0x00017b0b1984d6eaU,
+    (uint64_t)0x00053daa8c1f0668U, (uint64_t)0x0006fc078b3ece5dU, (uint64_t)0x00046bbc9edf9999U,
+    (uint64_t)0x000284f8519822d4U, (uint64_t)0x000773955883eed9U, (uint64_t)0x00076244798c6270U,
+    (uint64_t)0x000747ad656376ceU, (uint64_t)0x00014a7699747e90U, (uint64_t)0x0001cda466130882U,
+    (uint64_t)0x000364aa3e07070dU, (uint64_t)0x0002d86e1368ab54U, (uint64_t)0x00014429f04394f2U,
+    (uint64_t)0x000353c3eee86778U, (uint64_t)0x000797e122085254U, (uint64_t)0x00005dcb2acc4850U,
+    (uint64_t)0x0000b2538616310bU, (uint64_t)0x000278b9b2f84b25U, (uint64_t)0x0001adbf057e54a4U,
+    (uint64_t)0x0001fb426070d50fU, (uint64_t)0x000228a4a3cdf9b3U, (uint64_t)0x000342f399de1a30U,
+    (uint64_t)0x00004369a69769d1U, (uint64_t)0x0000d259eb635c91U, (uint64_t)0x0003966e2502aaa9U,
+    (uint64_t)0x0000aaba846341f8U, (uint64_t)0x0005260385be8429U, (uint64_t)0x0004164a69a476bdU,
+    (uint64_t)0x0004c7f153c9ce4cU, (uint64_t)0x000440c6a3b8e442U, (uint64_t)0x00018e8239f60811U,
+    (uint64_t)0x0003d894f1c3c8b5U, (uint64_t)0x0005f63423c3e178U, (uint64_t)0x0000e7c04e05509dU,
+    (uint64_t)0x0000bdaf9c85e5e9U, (uint64_t)0x0004e103a76fab14U, (uint64_t)0x0005228fdb597f48U,
+    (uint64_t)0x0000e3c0fb135c34U, (uint64_t)0x0006d3644b0a856fU, (uint64_t)0x0000f096724dfe05U,
+    (uint64_t)0x0002841310cb74e9U, (uint64_t)0x0005a04ae1195edfU, (uint64_t)0x00031f9712c5e8b9U,
+    (uint64_t)0x0005ba933287dfd0U, (uint64_t)0x00029a0971654be4U, (uint64_t)0x00066676743f3af8U,
+    (uint64_t)0x000676667092118aU, (uint64_t)0x00042d3860af76b1U, (uint64_t)0x0001182ca41f6c5eU,
+    (uint64_t)0x0001aa49ae2734f6U, (uint64_t)0x00045206bc977d0dU, (uint64_t)0x0003c714137c974fU,
+    (uint64_t)0x000799fbc504fd52U, (uint64_t)0x0000685c319f7d1cU, (uint64_t)0x0003dd367b6677bcU,
+    (uint64_t)0x0004a2cde61767c0U, (uint64_t)0x00052a837bc7a7bcU, (uint64_t)0x000691478a411196U,
+    (uint64_t)0x00022c6a8f5b56dfU, (uint64_t)0x0002a6321814d453U, (uint64_t)0x0001272a42f91f9bU,
+    (uint64_t)0x00050d6460185d89U, (uint64_t)0x000107b74acdb012U, (uint64_t)0x00061abba8e471b4U,
+    (uint64_t)0x00023270f5447242U, (uint64_t)0x0007a21d2357bdfdU, (uint64_t)0x0007d1965c77671fU,
+    (uint64_t)0x0001e64086f3cd53U, (uint64_t)0x000348b97ad2a847U, (uint64_t)0x0001a4c92d172080U,
+    (uint64_t)0x0005e3a31057d882U, (uint64_t)0x0003f30ee695b236U, (uint64_t)0x000055dbc0478370U,
+    (uint64_t)0x00009eada30f7501U, (uint64_t)0x0001823128308168U, (uint64_t)0x00072aaab207d757U,
+    (uint64_t)0x000414231531dd52U, (uint64_t)0x000764617391058fU, (uint64_t)0x00004c54348ee07cU,
+    (uint64_t)0x0004d57770c3157cU, (uint64_t)0x00072705c5a46a13U, (uint64_t)0x00068a3708fe7912U,
+    (uint64_t)0x000278966b88fccaU, (uint64_t)0x000015f79b907161U, (uint64_t)0x000746d3bdfe36d9U,
+    (uint64_t)0x00016164ba51661fU, (uint64_t)0x0004fbfdbab00559U, (uint64_t)0x000265662d061c93U,
+    (uint64_t)0x0004e01fa312f480U, (uint64_t)0x0006ff073bb00eafU, (uint64_t)0x000672d2a989fc1bU,
+    (uint64_t)0x00068ffb955a83a0U, (uint64_t)0x0003cb9885777938U, (uint64_t)0x0006baed3382a74dU,
+    (uint64_t)0x00000e670fa94a30U, (uint64_t)0x00046f8434c68cfeU, (uint64_t)0x0004047938508e64U,
+    (uint64_t)0x0005307d306de6e4U, (uint64_t)0x00057f9f30ef1846U, (uint64_t)0x0004bb6196df0d69U,
+    (uint64_t)0x0005096e630652e3U, (uint64_t)0x0000ebc38c54fd6aU, (uint64_t)0x0003f23886763ce2U,
+    (uint64_t)0x00049eb1af02c58fU, (uint64_t)0x000282149b6f6856U, (uint64_t)0x00007ed9f18eeeabU,
+    (uint64_t)0x00004b3a1d9f2ef4U, (uint64_t)0x0002bffe721fe54bU, (uint64_t)0x0007b8a10d45dd14U,
+    (uint64_t)0x0003a91e1fff0ce2U, (uint64_t)0x00061f7cea74ef44U, (uint64_t)0x0006aea2a856fa0eU,
+    (uint64_t)0x000185647241a6acU, (uint64_t)0x0001dfa014c2f526U, (uint64_t)0x0004e2b92c1faa0cU,
+    (uint64_t)0x00059a456a15db2bU, (uint64_t)0x00014c053b040dfeU, (uint64_t)0x0000eb9cd0eed3c0U,
+    (uint64_t)0x0001f8ef9fc8fe85U, (uint64_t)0x0005673222a1e56eU, (uint64_t)0x00039bcbf3e94e33U,
+    (uint64_t)0x0007ec77091bc605U, (uint64_t)0x0003f42495822383U, (uint64_t)0x0001e3bac426f911U,
+    (uint64_t)0x0002a1f1bd257e82U, (uint64_t)0x0001c1a5d09f6c20U, (uint64_t)0x00048fc0507690a9U,
+    (uint64_t)0x000743240d99fd8bU, (uint64_t)0x00009f4fac3d7fcdU, (uint64_t)0x0006acd80f4e86b9U,
+    (uint64_t)0x000023e152fe96ebU, (uint64_t)0x0006518baedfba8eU, (uint64_t)0x000674b4a4f04a46U,
+    (uint64_t)0x0002239e6860b4f3U, (uint64_t)0x0000ca1d534c759aU, (uint64_t)0x0001d108fdfdb2beU,
+    (uint64_t)0x00007388f7538996U, (uint64_t)0x00007bca976c72c5U, (uint64_t)0x00057aa3241160baU,
+    (uint64_t)0x00005b2a72d22ff1U, (uint64_t)0x00027d0377ec46f0U, (uint64_t)0x0007de8b6c2630d9U,
+    (uint64_t)0x0005c77bb5d37d53U, (uint64_t)0x00018c108d565a62U, (uint64_t)0x000488bfbbe1f5a9U,
+    (uint64_t)0x0003aca7117c6198U, (uint64_t)0x00078ad307ea1d91U, (uint64_t)0x000055e212791a2dU,
+    (uint64_t)0x0002f1d7a2ea683cU, (uint64_t)0x0005011ef683123eU, (uint64_t)0x0001283fe95fe601U,
+    (uint64_t)0x000601b077b6cb16U, (uint64_t)0x00076cb6b24ae3b4U, (uint64_t)0x00006e228726ebd9U,
+    (uint64_t)0x0002406e0ddac8fcU, (uint64_t)0x00055e8daed3e58bU, (uint64_t)0x00003d178feb4f27U,
+    (uint64_t)0x00021058e60e49dbU, (uint64_t)0x000546efb6bb4a4fU, (uint64_t)0x0000731f39e284f9U,
+    (uint64_t)0x0006c67dbeed9192U, (uint64_t)0x0003b75696730dc8U, (uint64_t)0x00046016166deaa9U,
+    (uint64_t)0x000151888330ec1eU, (uint64_t)0x000000005becfa2dU, (uint64_t)0x0004e7f7cfcf532aU,
+    (uint64_t)0x00034d031744cd2dU, (uint64_t)0x000146254758179bU, (uint64_t)0x0005731e56b6f739U,
+    (uint64_t)0x00005b4f28e9ae5eU, (uint64_t)0x0002f91383a4c25eU, (uint64_t)0x0000e843c13fb394U,
+    (uint64_t)0x000031eebdf40de4U, (uint64_t)0x000295b0c2597da2U, (uint64_t)0x00042f0cc8de40bfU,
+    (uint64_t)0x000600d242cbf639U, (uint64_t)0x00071dd75fe35761U, (uint64_t)0x0001533e9f88a411U,
+    (uint64_t)0x0003775efc03676dU, (uint64_t)0x000172d57e053ab6U, (uint64_t)0x00071a1bc333df57U,
+    (uint64_t)0x00039674a4532078U, (uint64_t)0x00064f036287034fU, (uint64_t)0x0003ba3e77409488U,
+    (uint64_t)0x0006a99bc552d193U, (uint64_t)0x000486151c8cefa2U, (uint64_t)0x00054b7045971642U,
+    (uint64_t)0x00071e0320587090U, (uint64_t)0x000638ab1379164cU, (uint64_t)0x0002320b7928b7aeU,
+    (uint64_t)0x000730b85c0a6979U, (uint64_t)0x000300d6b0bd6734U, (uint64_t)0x0004a7bf5c55fc81U,
+    (uint64_t)0x000531e97e1c57b8U, (uint64_t)0x0006f2af4fea65f7U, (uint64_t)0x0004863f8215c1e3U,
+    (uint64_t)0x00040ca073d03431U, (uint64_t)0x00045c14f2aa29f6U, (uint64_t)0x0001b442f65d18b4U,
+    (uint64_t)0x00016008e95533a5U, (uint64_t)0x000107e6cbe0e7b1U, (uint64_t)0x00019c5a9c3bddeaU,
+    (uint64_t)0x0003b7ed36905232U, (uint64_t)0x0004e227f866e886U, (uint64_t)0x00026e92fe50d60fU,
+    (uint64_t)0x0006b46c251a6794U, (uint64_t)0x0000ceb59a95601dU, (uint64_t)0x0003582b61615a85U,
+    (uint64_t)0x0006f604bf141f32U, (uint64_t)0x000415753f2693e5U, (uint64_t)0x000676bc22136673U,
+    (uint64_t)0x0001a781b6de1c34U, (uint64_t)0x00075ddb29fb2429U, (uint64_t)0x0003ae6942942869U,
+    (uint64_t)0x0007a4ef3a1b0b45U, (uint64_t)0x00065d4a43dabe3cU, (uint64_t)0x00035071f8ce9984U,
+    (uint64_t)0x000181168cbec8f9U, (uint64_t)0x0006190b02fed2c7U, (uint64_t)0x000349140f0bed60U,
+    (uint64_t)0x0006141335703b29U, (uint64_t)0x00042545a6a59885U, (uint64_t)0x000315672c2eb507U,
+    (uint64_t)0x000341e3cd307f73U, (uint64_t)0x0002cb8182c4a75bU, (uint64_t)0x00005edecf5134ddU,
+    (uint64_t)0x000706406cdbd1ceU, (uint64_t)0x0006f77cd5e9c03aU, (uint64_t)0x0002f7ebd2c0f379U,
+    (uint64_t)0x0003fc958e272ff1U, (uint64_t)0x0001d35be483e063U, (uint64_t)0x0000a2d533a5de8dU,
+    (uint64_t)0x0006cf68a8476ff2U, (uint64_t)0x000730dca3a6c583U, (uint64_t)0x0005996a3a3fe7e7U,
+    (uint64_t)0x000143d193ccfb02U, (uint64_t)0x00060fba0618ab41U, (uint64_t)0x0007645080245d2fU,
+    (uint64_t)0x000799d71734d711U, (uint64_t)0x0001b4ce449fd612U, (uint64_t)0x0007ff4231bd14d7U,
+    (uint64_t)0x00050fee504978daU, (uint64_t)0x0004a76a3f64184eU, (uint64_t)0x0003e6fb7578d61eU,
+    (uint64_t)0x000176243bf95955U, (uint64_t)0x0002dbb3a80252a7U, (uint64_t)0x0003aac54a8c82beU,
+    (uint64_t)0x00078f89e18cfa41U, (uint64_t)0x0002abedf1e4b904U, (uint64_t)0x0001d4bdb6577be1U,
+    (uint64_t)0x0007437ea227158bU, (uint64_t)0x0007e97763970e96U, (uint64_t)0x00007ca1146b6217U,
+    (uint64_t)0x0005b4b15b0dcf3aU, (uint64_t)0x000513b0ff4a4e31U, (uint64_t)0x000747c600c8b746U,
+    (uint64_t)0x0000e85b4c08f01eU, (uint64_t)0x000055dd63945053U, (uint64_t)0x000405ccafceeafaU,
+    (uint64_t)0x0007f497501028abU, (uint64_t)0x00048d11b66b928eU, (uint64_t)0x0000239371214f23U,
+    (uint64_t)0x00052a0b25764cb8U, (uint64_t)0x00076bb5eda60567U, (uint64_t)0x00011ebd9a6336e8U,
+    (uint64_t)0x0004fdb604eb7a63U, (uint64_t)0x0000208622a2f72fU, (uint64_t)0x00049cba531169f5U,
+    (uint64_t)0x0006403c323153c3U, (uint64_t)0x0003ed1677f04f91U, (uint64_t)0x000682556c3bb6eeU,
+    (uint64_t)0x00014467120e8a31U, (uint64_t)0x0003cd1e140aa179U, (uint64_t)0x0000f041ceb99950U,
+    (uint64_t)0x00033767c28a68a1U, (uint64_t)0x0000113bbda0667bU, (uint64_t)0x0000f638ca79d2e9U,
+    (uint64_t)0x000711e441703a02U, (uint64_t)0x0007ca9f9cd5846aU, (uint64_t)0x00027ddb2c8b5f35U,
+    (uint64_t)0x0005a8bb39d06710U, (uint64_t)0x0006c1262e3f8a43U, (uint64_t)0x00006f0d269c007fU,
+    (uint64_t)0x0002d8bda0274fe9U, (uint64_t)0x0005880aa13c7ec2U, (uint64_t)0x000145cd46a84513U,
+    (uint64_t)0x000193841cf1e0f5U, (uint64_t)0x0001299d9bbc1909U, (uint64_t)0x00071629c472bf67U,
+    (uint64_t)0x00032c7f6728296cU, (uint64_t)0x00005164a2d3a866U, (uint64_t)0x000677401a6f8778U,
+    (uint64_t)0x00036b8ff4eda202U, (uint64_t)0x0007daa346bd67c1U, (uint64_t)0x0002822a5801e36dU,
+    (uint64_t)0x0004eaea25b067daU, (uint64_t)0x0006222bd88bf2dfU, (uint64_t)0x0006fa5782e45313U,
+    (uint64_t)0x000117520560d1e3U, (uint64_t)0x00006df13d5042d8U, (uint64_t)0x000012eeb5ed7693U,
+    (uint64_t)0x0000325bb42ea4edU, (uint64_t)0x000592e9b6740859U, (uint64_t)0x0001d39897f0c5bfU,
+    (uint64_t)0x0000251580ec2af8U, (uint64_t)0x00070563ccc07320U, (uint64_t)0x000628b09e2c7d3aU,
+    (uint64_t)0x0002aa2d8bdba597U, (uint64_t)0x000337727e412228U, (uint64_t)0x000682a0453a101bU,
+    (uint64_t)0x000262572fd31592U, (uint64_t)0x000023bc7abc84cbU, (uint64_t)0x000511df0f29c9eeU,
+    (uint64_t)0x0001e58c41b9ddb0U, (uint64_t)0x0005c81ba413e52eU, (uint64_t)0x00058a64a8101b8eU,
+    (uint64_t)0x0004d2b97a739eceU, (uint64_t)0x000320ab2c14539aU, (uint64_t)0x000137b00f01661fU,
+    (uint64_t)0x0005b6edcf358ad2U, (uint64_t)0x0004243cb28d0446U, (uint64_t)0x0002be24dbdd7a46U,
+    (uint64_t)0x0007640e33263467U, (uint64_t)0x0004d99d421b1000U, (uint64_t)0x000229877cb2a32aU,
+    (uint64_t)0x000020e2cd45a4e5U, (uint64_t)0x000132a065edb5c4U, (uint64_t)0x0005fa3e1dd7de2fU,
+    (uint64_t)0x0003863fd1d4b30cU, (uint64_t)0x0007973f46ce42c3U, (uint64_t)0x0003c03b16b5bdc2U,
+    (uint64_t)0x000534ef70a3532fU, (uint64_t)0x00025b0e72ecf407U, (uint64_t)0x0005e9b86d31f29eU,
+    (uint64_t)0x000717e3d7ee0972U, (uint64_t)0x0002d2ea94ab733aU, (uint64_t)0x00013de9f98824e0U,
+    (uint64_t)0x000633fbbd39d169U, (uint64_t)0x0002de1deb9e1897U, (uint64_t)0x0001cb211e5ff1a1U,
+    (uint64_t)0x000252cc055229dbU, (uint64_t)0x0006d5066cf7137bU, (uint64_t)0x000347115219a417U,
+    (uint64_t)0x00068445d52b6b96U, (uint64_t)0x0002e0615fe54802U, (uint64_t)0x0003e441d5f1ad5fU,
+    (uint64_t)0x00054bb8cd82a0a8U, (uint64_t)0x0000ead868ab7c70U, (uint64_t)0x00037519f2944719U,
+    (uint64_t)0x000239bc7c2a540bU, (uint64_t)0x0007330e4f203f15U, (uint64_t)0x000609142e130e7fU,
+    (uint64_t)0x0002429c7b04c2cdU, (uint64_t)0x0001f7334164ea0eU, (uint64_t)0x0002e82a3d8f00c4U,
+    (uint64_t)0x00049a3fac10ad3aU, (uint64_t)0x00035ff8f7cdb086U, (uint64_t)0x00049cbaa6ce8b8aU,
+    (uint64_t)0x0002fbfc351521f8U, (uint64_t)0x0006ed81ad386d5cU, (uint64_t)0x000782aa34f434a9U,
+    (uint64_t)0x00050e1cc6871155U, (uint64_t)0x000289b38c30e3d7U, (uint64_t)0x0000a98bfd31710bU,
+    (uint64_t)0x0006dec6dcfff0edU, (uint64_t)0x0004a8cc50bd6ec3U, (uint64_t)0x000330c0a7ed1b12U,
+    (uint64_t)0x0002120a622e0213U, (uint64_t)0x0004928e70b4255eU, (uint64_t)0x00020ca395004af1U,
+    (uint64_t)0x000137b5a74383cdU, (uint64_t)0x0006c6365c17f4bbU, (uint64_t)0x0001499e5494c782U,
+    (uint64_t)0x00054c171a7d6061U, (uint64_t)0x0002a7b2382370ccU, (uint64_t)0x0004b4641905002bU,
+    (uint64_t)0x0001c5703a9d3d1aU, (uint64_t)0x0002125c8b8f0450U, (uint64_t)0x00068a693333f97eU,
+    (uint64_t)0x0004db1dc8b06120U, (uint64_t)0x0001547ff45b5efeU, (uint64_t)0x000397f5db80e233U,
+    (uint64_t)0x00044c675bd887d1U, (uint64_t)0x000309183c31e772U, (uint64_t)0x0001f3aa0d1e7794U,
+    (uint64_t)0x0002965c1800a0dfU, (uint64_t)0x00068b818a50b31dU, (uint64_t)0x0000e4dfed398826U,
+    (uint64_t)0x0002a6b5bb8ee8e5U, (uint64_t)0x0005b63d0e5a1659U, (uint64_t)0x00035914773a6ba9U,
+    (uint64_t)0x0001e8b233ec0076U, (uint64_t)0x000795099c995b42U, (uint64_t)0x000350ab19851e94U,
+    (uint64_t)0x0004657c36d323bfU, (uint64_t)0x00014e89c4af4304U, (uint64_t)0x00076724d74dba8eU,
+    (uint64_t)0x0003e8be859362a9U, (uint64_t)0x000285b6b601c94eU, (uint64_t)0x000277aacb4ea942U,
+    (uint64_t)0x0006a71a039dbb31U, (uint64_t)0x0006b66159ac8702U, (uint64_t)0x00061a22c8ca96c5U,
+    (uint64_t)0x0000644c063cebfdU, (uint64_t)0x000110cae7398c22U, (uint64_t)0x000282724d9d2eacU,
+    (uint64_t)0x00019dd4bef38efdU, (uint64_t)0x00000356e7c4fdc3U, (uint64_t)0x0006cce9df96746aU,
+    (uint64_t)0x000231226afcf26fU, (uint64_t)0x0000e6a709a55008U, (uint64_t)0x000667fbacce0dc3U,
+    (uint64_t)0x0003ce90b2f23e9fU, (uint64_t)0x0006c6fba067cc9bU, (uint64_t)0x0005a6d491d9c150U,
+    (uint64_t)0x0002d93a15d07e01U, (uint64_t)0x0001f6a1fd8cc0e0U, (uint64_t)0x0000865869605e19U,
+    (uint64_t)0x0003859d2657a634U, (uint64_t)0x0002a19102ea1749U, (uint64_t)0x0004d4d98e077c3aU,
+    (uint64_t)0x000779964401ee86U, (uint64_t)0x00063a6ddb180345U, (uint64_t)0x0005678db00bad68U,
+    (uint64_t)0x0004ecad44b3ff9eU, (uint64_t)0x0003dd942354571eU, (uint64_t)0x0000b0009de53ceeU,
+    (uint64_t)0x00035cbbfd4f326cU, (uint64_t)0x0003ee294ccc91b7U, (uint64_t)0x000353e636b68de4U,
+    (uint64_t)0x000502fd3833e7f6U, (uint64_t)0x0006f0a87af6e0f4U, (uint64_t)0x0001248c6c6e36c6U,
+    (uint64_t)0x0003c99a44d7cc01U, (uint64_t)0x00021f30757f285dU, (uint64_t)0x00013ee5e5b52174U,
+    (uint64_t)0x0006b60138135059U, (uint64_t)0x0007cba818f0a0c8U, (uint64_t)0x000119e553f5d8a3U,
+    (uint64_t)0x0006f59b8911d495U, (uint64_t)0x00030ec7963d2395U, (uint64_t)0x000277e75c04a57fU,
+    (uint64_t)0x0006af0a0fcd15f4U, (uint64_t)0x0005d8829faa2d69U, (uint64_t)0x00059b2d11d2184cU,
+    (uint64_t)0x0006192b3a4edb35U, (uint64_t)0x000398c8c8c8e8daU, (uint64_t)0x0005ef111a7459caU,
+    (uint64_t)0x000743e76b873eedU, (uint64_t)0x0007da788d05038fU, (uint64_t)0x000132d6dfd110e8U,
+    (uint64_t)0x0007fc5e88a596b4U, (uint64_t)0x00025850d4b94340U, (uint64_t)0x000337829774ea07U,
+    (uint64_t)0x0007aa4baa035b01U, (uint64_t)0x0006a9c59d10e369U, (uint64_t)0x0006a01ead173188U,
+    (uint64_t)0x0003134a847a0564U, (uint64_t)0x00026d734dd61ed8U, (uint64_t)0x0001d5d36768c9adU,
+    (uint64_t)0x0006841d9eb25d62U, (uint64_t)0x0001f90c7ef4610dU, (uint64_t)0x0001a1c8ce3a2f7bU,
+    (uint64_t)0x0006c5088246078fU, (uint64_t)0x00025f03d3f7fef3U, (uint64_t)0x00055cbd09e1e658U,
+    (uint64_t)0x00063344ccbe4169U, (uint64_t)0x0007c14da9611f84U, (uint64_t)0x000535a758351a36U,
+    (uint64_t)0x0006a07769f19f8fU, (uint64_t)0x00039918ae86d2ddU, (uint64_t)0x0005b58e9a13a3ccU,
+    (uint64_t)0x00059fd686603f08U, (uint64_t)0x0005ae148dbd3c5eU, (uint64_t)0x000768558f36db1aU,
+    (uint64_t)0x00048da4f4ae0be3U, (uint64_t)0x0003d22b58c663eaU, (uint64_t)0x0002b63fb03b0eb2U,
+    (uint64_t)0x00073e96f8ef32e8U, (uint64_t)0x00045daaf6a02597U, (uint64_t)0x00039399ec5ff106U,
+    (uint64_t)0x0007240c7e82ba83U, (uint64_t)0x0003bad00a4ed035U, (uint64_t)0x00066b25aeb67183U,
+    (uint64_t)0x0007837743c8e4c2U, (uint64_t)0x0004b9b4513da086U, (uint64_t)0x00017d0a611501ebU,
+    (uint64_t)0x00045e86f1900608U, (uint64_t)0x0001fbe96f3948ecU, (uint64_t)0x0006f302c3bdfd3dU,
+    (uint64_t)0x000799f280c2de8dU, (uint64_t)0x0006e6c09db77eedU, (uint64_t)0x0000eceb9c916f07U,
+    (uint64_t)0x00049ea727e1b83cU, (uint64_t)0x0006273e2eeb6666U, (uint64_t)0x000171f72b4fc831U,
+    (uint64_t)0x0005640b667ac2d7U, (uint64_t)0x0002c01148e1f3e4U, (uint64_t)0x00051c425711432aU,
+    (uint64_t)0x0006c182e4447f6fU, (uint64_t)0x0002b27cc4cc22e9U, (uint64_t)0x0007f4eec076f3b8U,
+    (uint64_t)0x00009339d2475746U, (uint64_t)0x00064fafff9a96a0U, (uint64_t)0x00064bc3ddbb71e1U,
+    (uint64_t)0x000401aa64372298U, (uint64_t)0x0000a8728e5d7851U, (uint64_t)0x0007d41cded490c8U,
+    (uint64_t)0x000612647ee1199dU, (uint64_t)0x0004195596834dfeU, (uint64_t)0x00038151f531081cU,
+    (uint64_t)0x0007ef39552f5076U, (uint64_t)0x0002c8f1e0cf253dU, (uint64_t)0x0000b5f94d24808fU,
+    (uint64_t)0x00056b1d1d6e8785U, (uint64_t)0x0005aefaf367ab15U, (uint64_t)0x00076ef0d6c063d5U,
+    (uint64_t)0x000633092dd34e07U, (uint64_t)0x00049ce7d7c1ba41U, (uint64_t)0x0002b7a22c02deabU,
+    (uint64_t)0x0000d4941a46bd55U, (uint64_t)0x00047ac42e7c5948U, (uint64_t)0x00009bb58f7a8924U,
+    (uint64_t)0x0006a3da0c80785eU, (uint64_t)0x00006ba5d3ceca93U, (uint64_t)0x000075f50ae5fe8bU,
+    (uint64_t)0x00028a6c1d1356c1U, (uint64_t)0x0004637d0c8db427U, (uint64_t)0x0000710c2f2b88baU,
+    (uint64_t)0x000331ebb992a859U, (uint64_t)0x000059a89c85de81U, (uint64_t)0x00075614a27f57dbU,
+    (uint64_t)0x0001d2b7be4610f4U, (uint64_t)0x00007af44ecbd9daU, (uint64_t)0x0000f3d96a079370U,
+    (uint64_t)0x00029a10cebd576fU, (uint64_t)0x000608de273a9f6aU, (uint64_t)0x0006d841f67144faU,
+    (uint64_t)0x0001f09d66e26b18U, (uint64_t)0x0005eaa723731e58U, (uint64_t)0x00040d589897d941U,
+    (uint64_t)0x0003b31d0113f98dU, (uint64_t)0x0004ceecee1b44a8U, (uint64_t)0x000563b7af463258U,
+    (uint64_t)0x0002e04fb6ecdb7eU, (uint64_t)0x000720002f0a3d51U, (uint64_t)0x00041a571f633073U,
+    (uint64_t)0x0003a3011634d581U, (uint64_t)0x0006f27d928a5d52U, (uint64_t)0x0002d7e560b44606U,
+    (uint64_t)0x00031f977b27d505U, (uint64_t)0x00008d1e75a33bf3U, (uint64_t)0x0007b5ccae42cf1aU,
+    (uint64_t)0x0004da0b6b78872eU, (uint64_t)0x000449c557409d64U, (uint64_t)0x000520f54e1ec44eU,
+    (uint64_t)0x00047dd939350f06U, (uint64_t)0x000434b14fbeb6f9U, (uint64_t)0x0002db91535249cdU,
+    (uint64_t)0x0003dcb0cbf75061U, (uint64_t)0x00057c401033942dU, (uint64_t)0x000302853df2cba5U,
+    (uint64_t)0x00043f0dfd1da83eU, (uint64_t)0x00004113b0ddf4e1U, (uint64_t)0x00053381c4548146U,
+    (uint64_t)0x0006514dd84675fbU, (uint64_t)0x0004b55df555ef78U, (uint64_t)0x00066e8cdcd6194dU,
+    (uint64_t)0x0005ab028755a609U, (uint64_t)0x00003cb9a10526f5U, (uint64_t)0x0005a95174bf6017U,
+    (uint64_t)0x0002faebe97416b3U, (uint64_t)0x000027445acc6496U, (uint64_t)0x0006782f693655e9U,
+    (uint64_t)0x0006a8cd5b9861b0U, (uint64_t)0x000578cccecb3c25U, (uint64_t)0x000348119c5c585eU,
+    (uint64_t)0x0005aa1c6d51c96fU, (uint64_t)0x0005dc4287f214beU, (uint64_t)0x00013b82b3f59239U,
+    (uint64_t)0x00050514de60f291U, (uint64_t)0x0000b2fcb60a19e6U, (uint64_t)0x000144a1f33239dcU,
+    (uint64_t)0x0000f2bf6f1878bdU, (uint64_t)0x00077897a0d0d4d1U, (uint64_t)0x0001c336bb5a6349U,
+    (uint64_t)0x0006301b568e9c61U, (uint64_t)0x0001767ba9159506U, (uint64_t)0x00057df5fa7ac109U,
+    (uint64_t)0x000214b365c4017eU, (uint64_t)0x000765dd92ee632bU, (uint64_t)0x0002b763e30bf6e3U,
+    (uint64_t)0x0000028dd62ec76eU, (uint64_t)0x00000b1d7e690987U, (uint64_t)0x0006c62c01be597eU,
+    (uint64_t)0x00038a7726f51b21U, (uint64_t)0x0006d187e11aedfdU, (uint64_t)0x0000464f0c1ce745U,
+    (uint64_t)0x0002ac3a1782fc5cU, (uint64_t)0x0004f978c41c144bU, (uint64_t)0x000620513ea91bfcU,
+    (uint64_t)0x0003607198a1819dU, (uint64_t)0x00010f47c2129fd3U, (uint64_t)0x00000a02acd47d87U,
+    (uint64_t)0x0002715b707968c5U, (uint64_t)0x000495a74165e473U, (uint64_t)0x00016affe7f532c6U,
+    (uint64_t)0x0004d99764529a1fU, (uint64_t)0x000553a4cdea2103U, (uint64_t)0x0003a5dfe90cce4eU,
+    (uint64_t)0x000475ba8c2ecdb1U, (uint64_t)0x0004db4418f87f77U, (uint64_t)0x000513e93e82a813U,
+    (uint64_t)0x0001bb59f9403d75U, (uint64_t)0x00007b71eb1db3dfU, (uint64_t)0x000540312aa76437U,
+    (uint64_t)0x0005140b9860c78eU, (uint64_t)0x00033a1308112a6cU, (uint64_t)0x00069766b0bf7e89U,
+    (uint64_t)0x0001918274226d47U, (uint64_t)0x0004d45c52d519cbU, (uint64_t)0x0000fe52219a0caeU,
+    (uint64_t)0x00031dda40465406U, (uint64_t)0x000650beb1c1a888U, (uint64_t)0x000123a5c9259b42U,
+    (uint64_t)0x0006c6ccb8df73b6U, (uint64_t)0x0006e1a9bb685adaU, (uint64_t)0x00039e6aca5e83e8U,
+    (uint64_t)0x0006a3e7c5796320U, (uint64_t)0x0005007541e92105U, (uint64_t)0x000546cf963e1f5fU,
+    (uint64_t)0x00031ef82c7b281aU, (uint64_t)0x0000f393dba889fdU, (uint64_t)0x0001fe546e404461U,
+    (uint64_t)0x0003354b7213155dU, (uint64_t)0x0006d454e42d3aa6U, (uint64_t)0x00013efddc558a2aU,
+    (uint64_t)0x00048f4c0dd3ae27U, (uint64_t)0x0001f15ca78fbd46U, (uint64_t)0x0006d058c362496fU,
+    (uint64_t)0x00066413f5ffbad1U, (uint64_t)0x0000b216ceec26c5U, (uint64_t)0x0007aa2a5312bac3U,
+    (uint64_t)0x0005d14aaf0335aeU, (uint64_t)0x0004e245bb0a1d80U, (uint64_t)0x0000c79262bd1fc8U,
+    (uint64_t)0x000563053b0dec55U, (uint64_t)0x0006b7e7fe7e3222U, (uint64_t)0x0005099deb290a51U,
+    (uint64_t)0x0007f3db2e46de32U, (uint64_t)0x0003a4fb628f12b0U, (uint64_t)0x00069755a4fb685cU,
+    (uint64_t)0x00062dfd0af81ce5U, (uint64_t)0x0005682fae1ebeafU, (uint64_t)0x0005574666fbf845U,
+    (uint64_t)0x0002b64be05f9894U, (uint64_t)0x00069d98b5ecc35dU, (uint64_t)0x000481f8259f4e8eU,
+    (uint64_t)0x0003702a9aa1c5aaU, (uint64_t)0x00023fa52f3a4a9aU, (uint64_t)0x000355a270651d92U,
+    (uint64_t)0x0003e26d487fbfe3U, (uint64_t)0x00051d536d8afbbfU, (uint64_t)0x00006f48eafebc18U,
+    (uint64_t)0x00071e6450da9ce3U, (uint64_t)0x0005959108dacc6dU, (uint64_t)0x0005854c9f58054aU,
+    (uint64_t)0x00076ad49dd4b6d9U, (uint64_t)0x0007b3c20580ee15U, (uint64_t)0x0001c0cc9b92b446U,
+    (uint64_t)0x00003acfba0e3c49U, (uint64_t)0x00062a8a839f4566U, (uint64_t)0x00048b613555bf3bU,
+    (uint64_t)0x0001182aa75d12e8U, (uint64_t)0x00018044a657f4efU, (uint64_t)0x0001e14e88e58f4bU,
+    (uint64_t)0x0003d45d6c61b8a0U, (uint64_t)0x000008b31465ba1bU, (uint64_t)0x00002af6b660fe67U,
+    (uint64_t)0x000795f0095038a9U, (uint64_t)0x0002d524f77c957bU, (uint64_t)0x000145a41a23df0dU,
+    (uint64_t)0x0005144ba1ee3347U, (uint64_t)0x000338d704ba14abU, (uint64_t)0x000790cd10cc448aU,
+    (uint64_t)0x0004d146bf59d4bfU, (uint64_t)0x0005ff031a9e8f4aU, (uint64_t)0x00027f6f65c163f9U,
+    (uint64_t)0x0006aedfe81ae652U, (uint64_t)0x00009bae0494b6b8U, (uint64_t)0x0005582075728af7U,
+    (uint64_t)0x00067c7ce2874df5U, (uint64_t)0x0003cb55b5673259U, (uint64_t)0x000019b53291712bU,
+    (uint64_t)0x00024dc0e3139b3cU, (uint64_t)0x000338f72b3aae0aU, (uint64_t)0x00075ecf07c0c77dU,
+    (uint64_t)0x00030dccb2500e7eU, (uint64_t)0x0007bda84b6e34cdU, (uint64_t)0x0006884bf3c2b2beU,
+    (uint64_t)0x0001f988f46d271fU, (uint64_t)0x0004e1c036204e12U, (uint64_t)0x000561736f1bb1c8U,
+    (uint64_t)0x0003e4af4fa1a4e7U, (uint64_t)0x000093da4cbc39cdU, (uint64_t)0x00053151564827ecU,
+    (uint64_t)0x0006a5908d961f00U, (uint64_t)0x00068512b3bc9322U, (uint64_t)0x0000c7707ae616b2U,
+    (uint64_t)0x000065f13e8ce8b4U, (uint64_t)0x0003bc8eb8780eb0U, (uint64_t)0x0004357ac2eb50feU,
+    (uint64_t)0x0002db65174136b3U, (uint64_t)0x000781add46ba081U, (uint64_t)0x0000a50b0787eacdU,
+    (uint64_t)0x000238301afa0ea1U, (uint64_t)0x0002ec3414992964U, (uint64_t)0x00033c31999aba40U,
+    (uint64_t)0x0007ba81c7c73674U, (uint64_t)0x00060583c9cb93f0U, (uint64_t)0x00051662ae1e2a53U,
+    (uint64_t)0x0002ecb17530e69eU, (uint64_t)0x0007799847a8a270U, (uint64_t)0x00015720dc40f8ddU,
+    (uint64_t)0x0005e1d36cc21d76U, (uint64_t)0x00011f994a867b01U, (uint64_t)0x00070c567bd1568aU,
+    (uint64_t)0x0002520ab77d56f3U, (uint64_t)0x0000aa1c5c41aa31U, (uint64_t)0x0000a4e157873e5bU,
+    (uint64_t)0x000226534ec05356U, (uint64_t)0x0001216d39000ebeU, (uint64_t)0x0000f4fa151fd1d4U,
+    (uint64_t)0x000334c93c7047cfU, (uint64_t)0x0000c93b40ed2f43U, (uint64_t)0x0001deb821d55c89U,
+    (uint64_t)0x000374132be82d97U, (uint64_t)0x000625c4973427faU, (uint64_t)0x00077e8270d2b056U,
+    (uint64_t)0x00063d7c03dfb1a9U, (uint64_t)0x000692b60e7ac998U, (uint64_t)0x0001ce35e30d78b5U,
+    (uint64_t)0x0007f0362dedb022U, (uint64_t)0x0004f58fd7218c8cU, (uint64_t)0x0004160a0bb8284aU,
+    (uint64_t)0x0003f301cb4c06e8U, (uint64_t)0x0003cbe5d79f358cU, (uint64_t)0x0006dd1a92e82034U,
+    (uint64_t)0x0000c1d093c5ed2dU, (uint64_t)0x0002f9b316b3b557U, (uint64_t)0x0001731c87ed1911U,
+    (uint64_t)0x0002aaa635d3e22cU, (uint64_t)0x0003c085e0b9d040U, (uint64_t)0x000706958b0f90a6U,
+    (uint64_t)0x0006cc9b195f148aU, (uint64_t)0x0004576b3a357fd3U, (uint64_t)0x0006f33204b9f2baU,
+    (uint64_t)0x00008e2ff8552d6fU, (uint64_t)0x000644dbbd47631eU, (uint64_t)0x00079ae397fbd745U,
+    (uint64_t)0x00079d24a3240869U, (uint64_t)0x0007fe8906b455e9U, (uint64_t)0x0000b97b336976d3U,
+    (uint64_t)0x0003ad6534ddce08U, (uint64_t)0x000128fb06357743U, (uint64_t)0x0002818101d89bf5U,
+    (uint64_t)0x0001300ff9d28f13U, (uint64_t)0x0001824581edecdeU, (uint64_t)0x00007c07f152c58fU,
+    (uint64_t)0x000566be162abb24U, (uint64_t)0x0007da48c4660f60U, (uint64_t)0x0001d90390cbd518U,
+    (uint64_t)0x00045ceb3b5775d0U, (uint64_t)0x00071709f92a0ac2U, (uint64_t)0x0002a7d6afd28c7aU,
+    (uint64_t)0x00064b6d414a0a90U, (uint64_t)0x00051f4ff8c599b1U, (uint64_t)0x000406b0d7863ac1U,
+    (uint64_t)0x000700fa97a36ff0U, (uint64_t)0x00014bbad2c4ba01U, (uint64_t)0x0000f9fb7ccd771cU,
+    (uint64_t)0x00035ac9588d46e4U, (uint64_t)0x0003720708d6c911U, (uint64_t)0x0002b202ee9611fbU,
+    (uint64_t)0x0000959bfc3200c5U, (uint64_t)0x0001757dc4a338d9U, (uint64_t)0x0004da02f54da58fU,
+    (uint64_t)0x00029b6a71bf9741U, (uint64_t)0x0001dccd7f1e7d8eU, (uint64_t)0x000149a0be95a5b0U,
+    (uint64_t)0x00031fb1e040b0ecU, (uint64_t)0x000568de690133caU, (uint64_t)0x0005b123773039e8U,
+    (uint64_t)0x0007e9ae87c7a37fU, (uint64_t)0x00003996d0e96eb9U, (uint64_t)0x000323a0ee6e219dU,
+    (uint64_t)0x0004c48220992e8eU, (uint64_t)0x0007dbc4170a98efU, (uint64_t)0x0000490c233d200dU,
+    (uint64_t)0x000278c99ed09838U, (uint64_t)0x0001fbc3bdd9dc86U, (uint64_t)0x0004090f6ebf75e7U,
+    (uint64_t)0x000206c8b59f5785U, (uint64_t)0x0004df5e07e8f3f6U, (uint64_t)0x0005f659be6ec6a7U,
+    (uint64_t)0x0003193a84b2d27cU, (uint64_t)0x0004f2f4b477f6caU, (uint64_t)0x0000269d9359e934U,
+    (uint64_t)0x0004b847999e4a90U, (uint64_t)0x0004118b05ab8e14U, (uint64_t)0x00021cd0b6990453U,
+    (uint64_t)0x00013115f873b8a8U, (uint64_t)0x0007361dbbb4a6a6U, (uint64_t)0x0005de82b4cb21faU,
+    (uint64_t)0x00002507ccd64a55U, (uint64_t)0x00078a18d4b37b64U, (uint64_t)0x000602c6bf1bc222U,
+    (uint64_t)0x00030cc4663403daU, (uint64_t)0x00061f36a4978dceU, (uint64_t)0x00048df3d3a54a05U,
+    (uint64_t)0x00010ef7a35c4feeU, (uint64_t)0x0003342c4717d552U, (uint64_t)0x0005c6a85b6937c5U,
+    (uint64_t)0x0000cd0dcc3f9493U, (uint64_t)0x0001f7499c735fa9U, (uint64_t)0x00029b46aa6678fdU,
+    (uint64_t)0x00050676cdf00c93U, (uint64_t)0x0002b47afd50b8bbU, (uint64_t)0x0006e87341ba7247U,
+    (uint64_t)0x0000411974b578a0U, (uint64_t)0x0007ee4de1829600U, (uint64_t)0x0002d3c40a10b4a4U,
+    (uint64_t)0x00030fb8f1eccccbU, (uint64_t)0x000283e91bedd33fU, (uint64_t)0x0002235667e8bf41U,
+    (uint64_t)0x0007685498387eddU, (uint64_t)0x000282a400973b64U, (uint64_t)0x00062dd27aa84686U,
+    (uint64_t)0x00023c1862a18feaU, (uint64_t)0x00031aff366b3a83U, (uint64_t)0x000549acae4ff00dU,
+    (uint64_t)0x0005a8a95d8ceddbU, (uint64_t)0x0004bded88f6988aU, (uint64_t)0x00053b47817f7390U,
+    (uint64_t)0x00043a187ebc4d1bU, (uint64_t)0x000585f14a833db9U, (uint64_t)0x0007cfc2fe7c8d4eU,
+    (uint64_t)0x00029d9ed297dbd3U, (uint64_t)0x0001d030c6eca418U, (uint64_t)0x0007c356254aecceU,
+    (uint64_t)0x000106a1f2de6054U, (uint64_t)0x0007aaf48f59f15cU, (uint64_t)0x0001896bf1a58d6eU,
+    (uint64_t)0x00011d1c1269b58dU, (uint64_t)0x000798b78e2a3c2bU, (uint64_t)0x0001c61b0a4e31dfU,
+    (uint64_t)0x0002765ba6a9e766U, (uint64_t)0x000086d5b16ac088U, (uint64_t)0x0003194de2e85fbaU,
+    (uint64_t)0x000706e16ece3444U, (uint64_t)0x000510dbf955a7d1U, (uint64_t)0x0003e86b7756eccdU,
+    (uint64_t)0x0005979baa2329b4U, (uint64_t)0x00019a93ef8737a9U, (uint64_t)0x00046e5644cdd17dU,
+    (uint64_t)0x0001aae72fc62ac4U, (uint64_t)0x0000336498fbd2b4U, (uint64_t)0x00008a7c5dd5cbd8U,
+    (uint64_t)0x00025ffe91b3543cU, (uint64_t)0x00026c427ebf83f5U, (uint64_t)0x000673f2258e1bcbU,
+    (uint64_t)0x000653338b616279U, (uint64_t)0x000718dd49593f4bU, (uint64_t)0x0005e7c15c7bdd1eU,
+    (uint64_t)0x000040921f0d3724U, (uint64_t)0x00021c89d7c8cf85U, (uint64_t)0x0002dfe0c21696c0U,
+    (uint64_t)0x0003a45d29424d9aU, (uint64_t)0x00077229b1550dedU, (uint64_t)0x00048807bcdb7f49U,
+    (uint64_t)0x00019eac75c6e662U, (uint64_t)0x0003396978bfc50bU, (uint64_t)0x0000ca4ac8073393U,
+    (uint64_t)0x000794fbb7b5763aU, (uint64_t)0x00041f332d14fab1U, (uint64_t)0x00013ee5ce9adfc8U,
+    (uint64_t)0x0005ccf1359113c1U, (uint64_t)0x000730edb0eb0649U, (uint64_t)0x000702e81737ef11U,
+    (uint64_t)0x00024014668a61ecU, (uint64_t)0x00025cd14e2b9c26U, (uint64_t)0x0005c6b84dc5ed5aU,
+    (uint64_t)0x000748aa01d5a90fU, (uint64_t)0x00079743464cc509U, (uint64_t)0x00026c605e0047a9U,
+    (uint64_t)0x000609348312c42bU, (uint64_t)0x0001924416956ea2U, (uint64_t)0x0001fb8adaf021deU,
+    (uint64_t)0x0003304d5919b716U, (uint64_t)0x0003ae233f1f6dccU, (uint64_t)0x0006e9037db7f74bU,
+    (uint64_t)0x0000c8e28127b7dcU, (uint64_t)0x00007c2c14e41f85U, (uint64_t)0x000243784111782aU,
+    (uint64_t)0x00040193b41abdb3U, (uint64_t)0x0005f56376f7186dU, (uint64_t)0x000543fd67342dedU,
+    (uint64_t)0x0002ff28ce974493U, (uint64_t)0x0006937edeb88807U, (uint64_t)0x00036263ee101dafU,
+    (uint64_t)0x0006a4f62b81c676U, (uint64_t)0x0002898ffaab663eU, (uint64_t)0x0003bc46f335163dU,
+    (uint64_t)0x00069f49f6d8de96U, (uint64_t)0x00064d155f984e83U, (uint64_t)0x00023bf3aceb5e5cU,
+    (uint64_t)0x000094f3b96ab6c9U, (uint64_t)0x00046e0b1dbc48d2U, (uint64_t)0x00018ad36309efa0U,
+    (uint64_t)0x0004214c0c701979U, (uint64_t)0x0003e838aa567ceaU, (uint64_t)0x0003537a8c91eeebU,
+    (uint64_t)0x0006d2e98c19a76aU, (uint64_t)0x0007097054a99d7fU, (uint64_t)0x00049d1cf2973b62U,
+    (uint64_t)0x0003d7b6d0bb4e8dU, (uint64_t)0x00059de4b2305d8bU, (uint64_t)0x0007e2f9f1dbe4d5U,
+    (uint64_t)0x0004b382e4dd288eU, (uint64_t)0x0007b29b90c5af84U, (uint64_t)0x0004c227f0d32316U,
+    (uint64_t)0x0004078b0875ce14U, (uint64_t)0x0003ff69c641eebfU, (uint64_t)0x000549ae14a1f12fU,
+    (uint64_t)0x0003f8f145c40bc2U, (uint64_t)0x0001881cf88a2479U, (uint64_t)0x00056531dfed4c46U,
+    (uint64_t)0x00014f12016bf75aU, (uint64_t)0x000648f2908e182aU, (uint64_t)0x00005f335dc5b006U,
+    (uint64_t)0x0000882eaeac87b3U, (uint64_t)0x00034e2ddf511570U, (uint64_t)0x0003ac585c1fd926U,
+    (uint64_t)0x000741f0b87a4071U, (uint64_t)0x0003361a39b5ff0cU, (uint64_t)0x00038bbbaac7ba29U,
+    (uint64_t)0x0001bdaea88b78ebU, (uint64_t)0x0003fa9cb6a6dfe4U, (uint64_t)0x0003cf1f30103d3dU,
+    (uint64_t)0x0006df170acf388bU, (uint64_t)0x00029d0691074eddU, (uint64_t)0x0001bfbbb0b5ccc2U,
+    (uint64_t)0x0001b303eaac5b05U, (uint64_t)0x0004d791447cb32fU, (uint64_t)0x00058b15e1815afeU,
+    (uint64_t)0x0004a7e15c91a795U, (uint64_t)0x00055eaf5fea101cU, (uint64_t)0x000632fc1e0e6d82U,
+    (uint64_t)0x000565caf3ff6523U, (uint64_t)0x000213481073d8a9U, (uint64_t)0x00063f189534493aU,
+    (uint64_t)0x000644f4f10c2a13U, (uint64_t)0x000365fd747a90e7U, (uint64_t)0x0000a09245f7cbe5U,
+    (uint64_t)0x00073e92b6f00499U, (uint64_t)0x00007ca44025bb30U, (uint64_t)0x00017be9e863ebbaU,
+    (uint64_t)0x00012093400eeab6U, (uint64_t)0x0000eb508c2d46afU, (uint64_t)0x0001a7b5bddfe5b4U,
+    (uint64_t)0x0005f8663b12868eU, (uint64_t)0x0005726e2adc5bbdU, (uint64_t)0x00057d966b0ee8cfU,
+    (uint64_t)0x00021b35279a24fdU, (uint64_t)0x0003be197a1262a5U, (uint64_t)0x000782c4877c786bU,
+    (uint64_t)0x00079735f155fd92U, (uint64_t)0x00030f24bbba4be5U, (uint64_t)0x00022dc1aeffa9efU,
+    (uint64_t)0x0001e72e1c8150dcU, (uint64_t)0x000262061299dbaaU, (uint64_t)0x000519995d0c8177U,
+    (uint64_t)0x0007c6b674fd1963U, (uint64_t)0x0003d72f92ba5324U, (uint64_t)0x0002606b6ff7387dU,
+    (uint64_t)0x0007d0a2401f886fU, (uint64_t)0x0002fab7584f9ebaU, (uint64_t)0x0001da2698c7f981U,
+    (uint64_t)0x000531652ca579ebU, (uint64_t)0x0002c8dd914863b9U, (uint64_t)0x0002246d7a27ad58U,
+    (uint64_t)0x00027b70248f415fU, (uint64_t)0x00073c1ff6c5290eU, (uint64_t)0x0005aef91950bc60U,
+    (uint64_t)0x000754f622235617U, (uint64_t)0x000773127b360383U, (uint64_t)0x00077c85c2671ce5U,
+    (uint64_t)0x00069fedfe165cc8U, (uint64_t)0x000154f3e97ecac4U, (uint64_t)0x0003761e3297fa14U,
+    (uint64_t)0x00012aac61a7674cU, (uint64_t)0x0004cb56bd83d7bbU, (uint64_t)0x0004a7fa15a03865U,
+    (uint64_t)0x00061370d89d71f6U, (uint64_t)0x00066a2ba9357a94U, (uint64_t)0x00048a29adec0d4fU,
+    (uint64_t)0x0005d1f6fb463251U, (uint64_t)0x00079e2ed8660ad9U, (uint64_t)0x0005b69da44e189bU,
+    (uint64_t)0x00042f2d70bc34feU, (uint64_t)0x000269bc6168b537U, (uint64_t)0x0002f554ee36c10aU,
+    (uint64_t)0x0001d364fc3a757bU, (uint64_t)0x00026b33493bafc5U, (uint64_t)0x000416cd4a9ed2fdU,
+    (uint64_t)0x0001428d0b57e1d5U, (uint64_t)0x0004339fa86a2324U, (uint64_t)0x0005fe8a63a34b0eU,
+    (uint64_t)0x000553b7a27e2b14U, (uint64_t)0x00044205c101d9feU, (uint64_t)0x00048b05df5dccbaU,
+    (uint64_t)0x0006d07cc3462baeU, (uint64_t)0x00000bf15e84849dU, (uint64_t)0x00072b86554f4523U,
+    (uint64_t)0x00018ddba2455778U, (uint64_t)0x00006a2af02f7dacU, (uint64_t)0x0004dcb635e79d0bU,
+    (uint64_t)0x00064e9736c701ebU, (uint64_t)0x0004f74581abf576U, (uint64_t)0x00029bfef3795591U,
+    (uint64_t)0x00072b1cc6e98276U, (uint64_t)0x00062332ee4f8ee5U, (uint64_t)0x00074bc89fb8ef65U,
+    (uint64_t)0x0006b25369243fb4U, (uint64_t)0x0005e7ca6c2b5a08U, (uint64_t)0x0007cfbf3517a3f8U,
+    (uint64_t)0x0003e1bfb3c0218cU, (uint64_t)0x0000d3dc0daa12e8U, (uint64_t)0x0003992e6be0b7e4U,
+    (uint64_t)0x00078d0ffdc532feU, (uint64_t)0x0006422166d53332U, (uint64_t)0x0006b4c0d91dcf57U,
+    (uint64_t)0x0002396aef810769U, (uint64_t)0x0003272ba4e64da3U, (uint64_t)0x0005df47a5a5db18U,
+    (uint64_t)0x0006e6a42ff580c8U, (uint64_t)0x00033287cd3c57f3U, (uint64_t)0x00046fea1c371cdeU,
+    (uint64_t)0x0001eac66533d582U, (uint64_t)0x0004b3dd317dc0d6U, (uint64_t)0x00044d98937f95fbU,
+    (uint64_t)0x00070f3e2be18824U, (uint64_t)0x0007dca6a6e7b2b3U, (uint64_t)0x00060cb1a6504b48U,
+    (uint64_t)0x0000713ed3813e50U, (uint64_t)0x00036d03e28c21faU, (uint64_t)0x00067ec78897c972U,
+    (uint64_t)0x0004d15140c88b2fU, (uint64_t)0x000054553c816355U, (uint64_t)0x0006fe5decbc6485U,
+    (uint64_t)0x0007a79e9fb6abfbU, (uint64_t)0x0007b9e0081b2e20U, (uint64_t)0x0003f1fcc42b858cU,
+    (uint64_t)0x0002f098844f3d15U, (uint64_t)0x0007e5f69a1be8e8U, (uint64_t)0x0004a6902b81b7f9U,
+    (uint64_t)0x000093854716ef97U, (uint64_t)0x0006f6b57e400f15U, (uint64_t)0x0006af23bf13fe34U,
+    (uint64_t)0x00040a70989fcce3U, (uint64_t)0x0006630f507a1d7cU, (uint64_t)0x0003b80b63b1d3e2U,
+    (uint64_t)0x00064d47a7c2e55bU, (uint64_t)0x0003c06252c62301U, (uint64_t)0x0003531bc0abc846U,
+    (uint64_t)0x00057ac3e1e537e1U, (uint64_t)0x0001c70927aa306eU, (uint64_t)0x0005654a077444f0U,
+    (uint64_t)0x00024dcdd6382196U, (uint64_t)0x0006d36009a3a1c3U, (uint64_t)0x00019f2ae05d7a61U,
+    (uint64_t)0x0002e259ec780da0U, (uint64_t)0x0000c542f4cb893dU, (uint64_t)0x0001f237c749902eU,
+    (uint64_t)0x0004ae0d47bec2eeU, (uint64_t)0x0004daa47b6d570cU, (uint64_t)0x0001241a6e46e774U,
+    (uint64_t)0x00014989f13c72ecU, (uint64_t)0x0003937f6987889cU, (uint64_t)0x00030225657ad7feU,
+    (uint64_t)0x0007541db44db135U, (uint64_t)0x0001e22f8e8551eaU, (uint64_t)0x000117e4d3609883U,
+    (uint64_t)0x000665de1adb5d80U, (uint64_t)0x0006ab19361681c7U, (uint64_t)0x00004786c1529cc3U,
+    (uint64_t)0x000121fd5fd0c3abU, (uint64_t)0x000165b168a61530U, (uint64_t)0x0003be5e0df7208aU,
+    (uint64_t)0x00071c062fcb9b5bU, (uint64_t)0x0005964763b529b7U, (uint64_t)0x0006a243e5c6fd01U,
+    (uint64_t)0x000062a41118f91aU, (uint64_t)0x0000e4448cc3464cU, (uint64_t)0x0005aab3a49c1610U,
+    (uint64_t)0x0003c20812138b8fU, (uint64_t)0x0006237e93647e5eU, (uint64_t)0x0005165245f5b2fbU,
+    (uint64_t)0x000560ada6d8f2ebU, (uint64_t)0x0000c39412f9561cU, (uint64_t)0x0007862aec0bca41U,
+    (uint64_t)0x000438c3caf8e404U, (uint64_t)0x0004e46d8c498822U, (uint64_t)0x0001d970cbe58918U,
+    (uint64_t)0x000157bc8b6af02dU, (uint64_t)0x00050585711b59f6U, (uint64_t)0x000027639bb44bc3U,
+    (uint64_t)0x00015e2fa8742940U, (uint64_t)0x0007b727de748f3fU, (uint64_t)0x000221a66ab0c4cfU,
+    (uint64_t)0x000148f99690bb8fU, (uint64_t)0x0007ecfa6b215265U, (uint64_t)0x00037da46c4720c6U,
+    (uint64_t)0x0007dbe06b7d4c79U, (uint64_t)0x0001081f39b60620U, (uint64_t)0x00057f2abdbf300cU,
+    (uint64_t)0x00010958b5cdaf36U, (uint64_t)0x00054f14b851a6beU, (uint64_t)0x000401fc18eff580U,
+    (uint64_t)0x0002b09d8d578e28U, (uint64_t)0x00075d9ef0d6a641U, (uint64_t)0x0004f731b6407452U,
+    (uint64_t)0x000071359b6e6424U, (uint64_t)0x0006c664206679cfU, (uint64_t)0x00022c56e66dcfc4U,
+    (uint64_t)0x0006a7f6a6e7b496U, (uint64_t)0x0004da4821314574U, (uint64_t)0x00070759a40a6e65U,
+    (uint64_t)0x0006cdc3e94d7e42U, (uint64_t)0x00036adb918af2d7U, (uint64_t)0x0001690294de49d1U,
+    (uint64_t)0x000314016034673dU, (uint64_t)0x00017bf6701aef73U, (uint64_t)0x0005e0da0cd2d24dU,
+    (uint64_t)0x00038034c6b548c7U, (uint64_t)0x000439f71a0d5572U, (uint64_t)0x00010616d6cef8e9U,
+    (uint64_t)0x0005a1bd156d734cU, (uint64_t)0x000300c481626b89U, (uint64_t)0x0000607fad6c71e2U,
+    (uint64_t)0x0004ed332aeca1aaU, (uint64_t)0x00022423cb8e8212U, (uint64_t)0x000223156f08cdb4U,
+    (uint64_t)0x0004fe3a3da44163U, (uint64_t)0x00033a7bcd15cf1eU, (uint64_t)0x0004c75b1cfb5bbbU,
+    (uint64_t)0x000627dcf9be9be7U, (uint64_t)0x000158b82405747fU, (uint64_t)0x0005f1fd7400d8deU,
+    (uint64_t)0x0001e443263a7ecdU, (uint64_t)0x00056106b700df9eU, (uint64_t)0x00066ec04859b42eU,
+    (uint64_t)0x0001bafd72fc5b92U, (uint64_t)0x00043c72af94dfbeU, (uint64_t)0x000350af500fa4fdU,
+    (uint64_t)0x00029f1926edec90U, (uint64_t)0x00032beb4e36411fU, (uint64_t)0x00001fc9e7901786U,
+    (uint64_t)0x00077a0725ad54a2U, (uint64_t)0x0003684d67a69b10U, (uint64_t)0x0004281e5cd0730dU,
+    (uint64_t)0x000425a36157c40bU, (uint64_t)0x0005cc7474c2127bU, (uint64_t)0x0001c03850cda86aU,
+    (uint64_t)0x0006ee01b252b7a9U, (uint64_t)0x000508e65ca67598U, (uint64_t)0x0005698b7e0062efU,
+    (uint64_t)0x000104dcab320bb4U, (uint64_t)0x00032ea163c42aaaU, (uint64_t)0x0000ae44e8d5ce26U,
+    (uint64_t)0x0004e0bb7524f3ffU, (uint64_t)0x00004230253b946fU, (uint64_t)0x000558741d1e5afcU,
+    (uint64_t)0x0002e7d2ef71f4d2U, (uint64_t)0x0007bd5e98b5e4ecU, (uint64_t)0x0001cf3726858122U,
+    (uint64_t)0x00004db9dd92f8d9U, (uint64_t)0x0000334af45d936aU, (uint64_t)0x0007e966dcb661b9U,
+    (uint64_t)0x00079899e7910541U, (uint64_t)0x00035a64a089f906U, (uint64_t)0x0005dc5794033b13U,
+    (uint64_t)0x00033c62b35f9f4fU, (uint64_t)0x000763ca1ca9ea10U, (uint64_t)0x0007328952fd0e0bU,
+    (uint64_t)0x000336f7f1a11b08U, (uint64_t)0x00065f711807e588U, (uint64_t)0x000616d7f9d9637aU,
+    (uint64_t)0x00027a164e67fa6aU, (uint64_t)0x000052357e95fd6bU, (uint64_t)0x00069112a118ad5fU,
+    (uint64_t)0x000066f79ccc68c4U, (uint64_t)0x000194b14e70e84bU, (uint64_t)0x0000bd3b7d9c53c5U,
+    (uint64_t)0x0007e18472bbfd67U, (uint64_t)0x00059b2995d25c76U, (uint64_t)0x00044d6deeeca512U,
+    (uint64_t)0x0002a4052f89d69aU, (uint64_t)0x000649357afed0a3U, (uint64_t)0x000458a2dac848a9U,
+    (uint64_t)0x000123f4425ee350U, (uint64_t)0x000115b217ea5058U, (uint64_t)0x00004137e9279f1aU,
+    (uint64_t)0x0004f53cd9217a50U, (uint64_t)0x00076434fad97c1bU, (uint64_t)0x0003a3cde89779beU,
+    (uint64_t)0x0000d6e86f3a086bU, (uint64_t)0x00002833aa49e326U, (uint64_t)0x0000a016265371f7U,
+    (uint64_t)0x0002d45f9e70d625U, (uint64_t)0x00076a896974bf81U, (uint64_t)0x0002289c3bda5c99U,
+    (uint64_t)0x0004a0b1d181a9aaU, (uint64_t)0x0002b698a3a2fda3U, (uint64_t)0x00007f3967193c8cU,
+    (uint64_t)0x00022ae5f667f08dU, (uint64_t)0x0001e90739a6bbf8U, (uint64_t)0x0005f82287b7869cU,
+    (uint64_t)0x00005566279a9314U, (uint64_t)0x00035a7f8324bc4aU, (uint64_t)0x000165289fe924ecU,
+    (uint64_t)0x00043299d9738472U, (uint64_t)0x00033fa160bd0c08U, (uint64_t)0x00020d603755d35dU,
+    (uint64_t)0x000450c442bf68f5U, (uint64_t)0x0005b782496b15a5U, (uint64_t)0x0006435675cc362dU,
+    (uint64_t)0x000691589756d7c0U, (uint64_t)0x00060c77d3e9e13bU, (uint64_t)0x000782f1750e1a0eU,
+    (uint64_t)0x00054745dfbae079U, (uint64_t)0x00063b06e648bf7aU, (uint64_t)0x0000249be08bae16U,
+    (uint64_t)0x0006e11a18488b8dU, (uint64_t)0x00075361fff589eeU, (uint64_t)0x0000df8d967ea85bU,
+    (uint64_t)0x0001b17d88ed9954U, (uint64_t)0x00058c5961a52582U, (uint64_t)0x000349612b4b1c83U,
+    (uint64_t)0x0005f62cc80cb364U, (uint64_t)0x00030ec527e5fb90U, (uint64_t)0x0006771b61006b51U,
+    (uint64_t)0x000047ae60b7e824U, (uint64_t)0x0001385ce47cbf90U, (uint64_t)0x000538a682639a17U,
+    (uint64_t)0x0001964a969cc270U, (uint64_t)0x0004c27afff3c45fU, (uint64_t)0x0002bd114bf5a66bU,
+    (uint64_t)0x0003ca349893cb77U, (uint64_t)0x00030a70ea4342f8U, (uint64_t)0x00043ecaf88f5b13U,
+    (uint64_t)0x0005f2c99e6526dcU, (uint64_t)0x000731c946f1338aU, (uint64_t)0x00004ccc75b53d3cU,
+    (uint64_t)0x0006492da851e192U, (uint64_t)0x000017ea70ab0003U, (uint64_t)0x00005a164fd0bf46U,
+    (uint64_t)0x0007d1b43224e085U, (uint64_t)0x000651f7f44d3f9dU, (uint64_t)0x0001f5bb93da54b1U,
+    (uint64_t)0x00057bd040abfbc8U, (uint64_t)0x000786be30733efdU, (uint64_t)0x00030712c63e2736U,
+    (uint64_t)0x0007d673ad37c9d5U, (uint64_t)0x0003f4211ca9f022U, (uint64_t)0x00042d9a138766eaU,
+    (uint64_t)0x000653a5f772f349U, (uint64_t)0x0004e817719f64c8U, (uint64_t)0x0002aaf757adc018U,
+    (uint64_t)0x00074f63b25b13b9U, (uint64_t)0x00074586c8334d2dU, (uint64_t)0x00012c73ed34d313U,
+    (uint64_t)0x0005ca89f193c7c7U, (uint64_t)0x000190eadb296624U, (uint64_t)0x000613c26eba92ebU,
+    (uint64_t)0x00028e517e9d52c5U, (uint64_t)0x00009c186afb8339U, (uint64_t)0x00049a357f7b062fU,
+    (uint64_t)0x000577daa9fe2346U, (uint64_t)0x00061928780aa0a9U, (uint64_t)0x0001a9c9a34ad8a4U,
+    (uint64_t)0x0006137b0746027bU, (uint64_t)0x000562410e8ef362U, (uint64_t)0x00007e7115a47163U,
+    (uint64_t)0x00063082b8bba0edU, (uint64_t)0x0006c576f02a36f1U, (uint64_t)0x000572c78d37f263U,
+    (uint64_t)0x000022f04c2eaa13U, (uint64_t)0x00057d69a3366d97U, (uint64_t)0x00072376731a9341U,
+    (uint64_t)0x000499efc4abc0adU, (uint64_t)0x00021fee4804968aU, (uint64_t)0x0000d3e930901700U,
+    (uint64_t)0x0007512e5846260cU, (uint64_t)0x0002160ce6f694d9U, (uint64_t)0x00028ea0b62ed0a8U,
+    (uint64_t)0x000500b7740072cbU, (uint64_t)0x0000a584e1b381f8U, (uint64_t)0x0002dc40f2fe1bb0U,
+    (uint64_t)0x0007a252afa919c4U, (uint64_t)0x0007f8344713f782U, (uint64_t)0x000198588f68c188U,
+    (uint64_t)0x0001e3a2b12d4f17U, (uint64_t)0x0004b2e7932aa923U, (uint64_t)0x00022727a3b68433U,
+    (uint64_t)0x0000415c09f01b2eU, (uint64_t)0x0004a2e1f96eee4eU, (uint64_t)0x0004b832ac846fc4U,
+    (uint64_t)0x00022e66b4cc889aU, (uint64_t)0x00077c36a3708a79U, (uint64_t)0x00062dc64a88c45fU,
+    (uint64_t)0x0006c3f24822e185U, (uint64_t)0x0000b2d34c797678U, (uint64_t)0x0006b7b48f082a56U,
+    (uint64_t)0x000320892791968aU, (uint64_t)0x000130d94db67890U, (uint64_t)0x0002ddebaccef8ddU,
+    (uint64_t)0x0001449ec0ec3464U, (uint64_t)0x00054da0a6d415e8U, (uint64_t)0x00027490d51894c3U,
+    (uint64_t)0x0003a33578cadec3U, (uint64_t)0x0005dbd3bf95494dU, (uint64_t)0x0004e1c737e25b77U,
+    (uint64_t)0x00054f6f73f1826fU, (uint64_t)0x000264aae68d0b38U, (uint64_t)0x0005d8431e6c6054U,
+    (uint64_t)0x00056f5f77776e9fU, (uint64_t)0x0004643a2e2f2569U, (uint64_t)0x0000611669774e72U,
+    (uint64_t)0x0006e17d81aef50eU, (uint64_t)0x00060a92020f5168U, (uint64_t)0x0005844f533bb02bU,
+    (uint64_t)0x0000badc76ed5685U, (uint64_t)0x00035fa4ebc2326eU, (uint64_t)0x0005dc73aed63804U,
+    (uint64_t)0x0001e078f96abefcU, (uint64_t)0x0004b3702044575dU, (uint64_t)0x000027acd289b820U,
+    (uint64_t)0x0001f5f99c524904U, (uint64_t)0x000581aabf8db72cU, (uint64_t)0x00017a97a13d4072U,
+    (uint64_t)0x00054333c50acf33U, (uint64_t)0x000271da3c1535e8U, (uint64_t)0x00050808b29d87a9U,
+    (uint64_t)0x000011653cf3c08eU, (uint64_t)0x0000ee45253cfdc0U, (uint64_t)0x0001d1cecdf260f8U,
+    (uint64_t)0x0007136e1146b3dfU, (uint64_t)0x00059e3baac9c516U, (uint64_t)0x00025223e30d62b6U,
+    (uint64_t)0x0005b57250cc032fU, (uint64_t)0x00077fe8a5d490afU, (uint64_t)0x0005c5afa5f50246U,
+    (uint64_t)0x0007c146a8b74daeU, (uint64_t)0x00048636448ab327U, (uint64_t)0x00018b45600199caU,
+    (uint64_t)0x0003c530f01e039fU, (uint64_t)0x000566861b52ad2cU, (uint64_t)0x000752b00120dfc5U,
+    (uint64_t)0x00073bad60eb6373U, (uint64_t)0x00040fc2927931ffU, (uint64_t)0x00025a2c58c77260U,
+    (uint64_t)0x0007fd3a6196e3d6U, (uint64_t)0x000284949203f37dU, (uint64_t)0x000476c5437b216cU,
+    (uint64_t)0x000706c3c52af457U, (uint64_t)0x0007b8d2c823baafU, (uint64_t)0x00014483f8af0c85U,
+    (uint64_t)0x0003291ef9e8bb29U, (uint64_t)0x0007868197c6d14fU, (uint64_t)0x0007cdc4f68ad9e1U,
+    (uint64_t)0x0001c45a557b3624U, (uint64_t)0x000243e17f2697b6U, (uint64_t)0x0005193306c619f8U,
+    (uint64_t)0x00052ca05f976318U, (uint64_t)0x00061a001a75b2f3U, (uint64_t)0x0005247683ea1bdcU,
+    (uint64_t)0x00051c3cd099c188U, (uint64_t)0x00073201e27df68bU, (uint64_t)0x0003731a5654bcdaU,
+    (uint64_t)0x000679c6f128856fU, (uint64_t)0x0005fa2b1dfec51bU, (uint64_t)0x00009b7d23a1682eU,
+    (uint64_t)0x000217e84f70ad28U, (uint64_t)0x00014b5cbd03592eU, (uint64_t)0x00045eb26f10d929U,
+    (uint64_t)0x0003f81faa56dc38U, (uint64_t)0x00079648b1b75f99U, (uint64_t)0x000398a8defa7801U,
+    (uint64_t)0x000594ba852306a8U, (uint64_t)0x0004d5b971c1fdc1U, (uint64_t)0x00059fa62b248848U,
+    (uint64_t)0x0002c70bc7009528U, (uint64_t)0x000063ed4991c551U, (uint64_t)0x0001696a5aa08d84U,
+    (uint64_t)0x00064cd2d131eacbU, (uint64_t)0x0003780a1d4b6b5aU, (uint64_t)0x00015fea238825feU,
+    (uint64_t)0x0002cca59dedb077U, (uint64_t)0x00003bcee6378c63U, (uint64_t)0x0002c65b7e4f9b48U,
+    (uint64_t)0x0003aa8dc131e632U, (uint64_t)0x000061e216a70b5fU, (uint64_t)0x0006de776b42af80U,
+    (uint64_t)0x000162b5d5bdf418U, (uint64_t)0x0003ff30994d6a3aU, (uint64_t)0x0000671d58200407U,
+    (uint64_t)0x0006668a7b47fdfbU, (uint64_t)0x0006fdf04c85cf33U, (uint64_t)0x0004261b63dbb087U,
+    (uint64_t)0x00002c3501eebe18U, (uint64_t)0x0001f878c9bb777aU, (uint64_t)0x0001553da8e44755U,
+    (uint64_t)0x00069c15c3b56684U, (uint64_t)0x0002fd62e7176fabU, (uint64_t)0x0006fa0d18c49562U,
+    (uint64_t)0x00059479937cae12U, (uint64_t)0x0001347979dbcdc4U, (uint64_t)0x0004f87f8d2d6662U,
+    (uint64_t)0x00037ac81a8ace57U, (uint64_t)0x0002f7aa336b752aU, (uint64_t)0x0000659e12450355U,
+    (uint64_t)0x0005571a8e1c47ffU, (uint64_t)0x00033ab17ab47cbeU, (uint64_t)0x00074678e2fb0c24U,
+    (uint64_t)0x00052b1f350c7eaeU, (uint64_t)0x00058458308ef6c0U, (uint64_t)0x000626fc2bb1c02eU,
+    (uint64_t)0x00064d7ddcd0c1faU, (uint64_t)0x00008c25c9d513a0U, (uint64_t)0x0005bc4b24a96867U,
+    (uint64_t)0x000259d664d2b336U, (uint64_t)0x00029edb737d6b6cU, (uint64_t)0x000348b34e92504fU,
+    (uint64_t)0x0004a5a9867c7d3aU, (uint64_t)0x0000ae6be2f31c97U, (uint64_t)0x000123678f80408dU,
+    (uint64_t)0x0003ff13e0665cb0U, (uint64_t)0x000294f79a7ca0ecU, (uint64_t)0x000401440d01f5e6U,
+    (uint64_t)0x0000afc7b8ce2b99U, (uint64_t)0x000333f8eef2b1f7U, (uint64_t)0x0007f4107b4c7b5aU,
+    (uint64_t)0x000650ff8676ce10U, (uint64_t)0x0007b888c25eca86U, (uint64_t)0x0007d51b6b254d8cU,
+    (uint64_t)0x000131883d8fc4caU, (uint64_t)0x00035495a3d912e4U, (uint64_t)0x0004a2321ff009c2U,
+    (uint64_t)0x000280aacd6385d5U, (uint64_t)0x00059fd85f0a9f8dU, (uint64_t)0x0000c03c46e2dff7U,
+    (uint64_t)0x000622afd443ec39U, (uint64_t)0x000423d5404492f3U, (uint64_t)0x0004239477208a1bU,
+    (uint64_t)0x000251f6c0eb46adU, (uint64_t)0x0007b10e1d26d95fU, (uint64_t)0x0006817ca6919549U,
+    (uint64_t)0x0001a4913e350c0bU, (uint64_t)0x00040ac9fda7c686U, (uint64_t)0x00019ee4a0633fecU,
+    (uint64_t)0x00036663875e8dd1U, (uint64_t)0x0004e8a91edf58a4U, (uint64_t)0x0002913d9526ec6cU,
+    (uint64_t)0x000739cd949695b3U, (uint64_t)0x000028507c07998aU, (uint64_t)0x00057d9ebf8c914aU,
+    (uint64_t)0x0005a949c163cac7U, (uint64_t)0x00064c9b4fcaa8a6U, (uint64_t)0x00077ab0cbdd401cU,
+    (uint64_t)0x00079d5908cdac3aU, (uint64_t)0x00008e60479f7f51U, (uint64_t)0x0006e1fa4b22fa46U,
+    (uint64_t)0x0002ecf74cff92dfU, (uint64_t)0x00017e42186f9f12U, (uint64_t)0x0006e6d908adfa77U,
+    (uint64_t)0x0001b2b6c48c2eeaU, (uint64_t)0x00028f0f792833c8U, (uint64_t)0x00074137e0a79a43U,
+    (uint64_t)0x0005b18fa591cadeU, (uint64_t)0x0004c3bc9aab89ddU, (uint64_t)0x0000d0f6b8d10c3eU,
+    (uint64_t)0x000778185eed3f91U, (uint64_t)0x0000089181a58467U, (uint64_t)0x0003475a3ba7efa0U,
+    (uint64_t)0x000625d74f2bac1bU, (uint64_t)0x0002b556bbc070b5U, (uint64_t)0x000184e1d7174d6fU,
+    (uint64_t)0x000665dfb2162f1bU, (uint64_t)0x000303e86cfc66d6U, (uint64_t)0x0006c497006ed9b4U,
+    (uint64_t)0x0007ba01332807ebU, (uint64_t)0x0000f3cadc018c2cU, (uint64_t)0x0005f48a8b4c4768U,
+    (uint64_t)0x0004c710a53d128eU, (uint64_t)0x0006abe689eb3600U, (uint64_t)0x00058366c2ab7fc9U,
+    (uint64_t)0x00004444af406f1aU, (uint64_t)0x000083da01b1e876U, (uint64_t)0x000707fa3974642fU,
+    (uint64_t)0x0007027c48ae62f9U, (uint64_t)0x0003f5c47b490be4U, (uint64_t)0x000132fef32c3bb0U,
+    (uint64_t)0x000408b75547e0eeU, (uint64_t)0x0000e72d53aa36a1U, (uint64_t)0x00010a6945f95a08U,
+    (uint64_t)0x000537ce98e07428U, (uint64_t)0x000020eb873b0fd8U, (uint64_t)0x0007677ab4ecad6bU,
+    (uint64_t)0x0001001554fc9ae9U, (uint64_t)0x00045c599ecd05e9U, (uint64_t)0x0005ed1f70065a08U,
+    (uint64_t)0x00018fc98dc1aeb0U, (uint64_t)0x00040f375deeef57U, (uint64_t)0x0004ff89abd6a0f2U,
+    (uint64_t)0x00059222a5f1802eU, (uint64_t)0x0001e2b1d5578437U, (uint64_t)0x0005a06716d6b801U,
+    (uint64_t)0x000634f48b1c3722U, (uint64_t)0x00027c4a2cbddcdcU, (uint64_t)0x000469331b639ffaU,
+    (uint64_t)0x00041c6747ff756aU, (uint64_t)0x00066f1efc5aca5eU, (uint64_t)0x000721b7d41dd01bU,
+    (uint64_t)0x0004a13209b9bf80U, (uint64_t)0x0003bc157b813d96U, (uint64_t)0x0006c387efacf3deU,
+    (uint64_t)0x0004dd30a8b4f85dU, (uint64_t)0x00023b195a74a719U, (uint64_t)0x0005cb5244c6cbe3U,
+    (uint64_t)0x000325411da52b82U, (uint64_t)0x000614118e22068cU, (uint64_t)0x00051229478dd419U,
+    (uint64_t)0x000176a8ef02360cU, (uint64_t)0x0005521417ea968fU, (uint64_t)0x00076115c6cb99d4U,
+    (uint64_t)0x00063ebe5283599fU, (uint64_t)0x0007ffe019722993U, (uint64_t)0x0006b4a1cce303f7U,
+    (uint64_t)0x000204ca468545d1U, (uint64_t)0x0006c6a640a0f9c4U, (uint64_t)0x00057fc742e19edbU,
+    (uint64_t)0x00012e2aef773c8aU, (uint64_t)0x0001842ec3c8d6fdU, (uint64_t)0x0003cc4861ad5071U,
+    (uint64_t)0x0001d842a007882bU, (uint64_t)0x000233475488522fU, (uint64_t)0x00056b97a812b288U,
+    (uint64_t)0x0004b7bc1f58e553U, (uint64_t)0x0007597adf006ac4U, (uint64_t)0x00038a9f01dca3caU,
+    (uint64_t)0x00037e8d773be2a4U, (uint64_t)0x00065a51e2aec609U, (uint64_t)0x0001d72b27e9ee13U,
+    (uint64_t)0x0002a8b02d22be1cU, (uint64_t)0x0005baa71c0629f8U, (uint64_t)0x0007c131b100a061U,
+    (uint64_t)0x0007037bcd22844cU, (uint64_t)0x000471b3dc4be217U, (uint64_t)0x0006a69cf343bc94U,
+    (uint64_t)0x000696cd252f3afcU, (uint64_t)0x000318ac05007ad4U, (uint64_t)0x0003aac8823222a2U,
+    (uint64_t)0x0001a3859eafe3aaU, (uint64_t)0x000766da90b03c67U, (uint64_t)0x0004139a3a954bbdU,
+    (uint64_t)0x0006bf5a299dfb3fU, (uint64_t)0x000619a7c8248798U, (uint64_t)0x0006a38c51002e89U,
+    (uint64_t)0x0000492498bccf13U, (uint64_t)0x0002dc27769df231U, (uint64_t)0x000718c9556422ecU,
+    (uint64_t)0x0003fccb0d152c96U, (uint64_t)0x0000992ba098058eU, (uint64_t)0x000521be0be8427dU,
+    (uint64_t)0x0004d5af7f7c5351U, (uint64_t)0x0001b76bf6bdb257U, (uint64_t)0x0006761efd0c3948U,
+    (uint64_t)0x0005e84e4ea6cae0U, (uint64_t)0x0007c0fbb51669a1U, (uint64_t)0x000718798b9f1069U,
+    (uint64_t)0x000502f67ac28825U, (uint64_t)0x0001eb427b959a4aU, (uint64_t)0x0003e180dbdf5523U,
+    (uint64_t)0x0002646638863a38U, (uint64_t)0x0000eec95786aae3U, (uint64_t)0x000640721e47d66dU,
+    (uint64_t)0x0004f4d8ef3f3fb1U, (uint64_t)0x000560ca0c14167fU, (uint64_t)0x0000902c55c148a4U,
+    (uint64_t)0x0007e60c3caffc12U, (uint64_t)0x00013aea1849989fU, (uint64_t)0x0000c101c2b81f44U,
+    (uint64_t)0x0004820c00aaa326U, (uint64_t)0x00049795c19cb5b2U, (uint64_t)0x0005b87deedff90dU,
+    (uint64_t)0x0000884949c8ca12U, (uint64_t)0x0007dd4f765a027eU, (uint64_t)0x00015cf50eb4a496U,
+    (uint64_t)0x00025d216199ac4bU, (uint64_t)0x000100a56c3e63b0U, (uint64_t)0x0002260a9cbdfb5eU,
+    (uint64_t)0x00004341a5f3da1aU, (uint64_t)0x0000dd4e3cefdf85U, (uint64_t)0x0001034cbb3164efU,
+    (uint64_t)0x0001e6a23789d9f6U, (uint64_t)0x0001cd96ef237b21U, (uint64_t)0x00004a5ccd60dbe3U,
+    (uint64_t)0x00018e26ce7de1e3U, (uint64_t)0x00005f3b62d047daU, (uint64_t)0x0005afcbbb9327afU,
+    (uint64_t)0x0007a626aeb91efcU, (uint64_t)0x0001dda75a4ca750U, (uint64_t)0x00077e45bd12177dU,
+    (uint64_t)0x0006233d9f3c7b1aU, (uint64_t)0x00005604ea5dd5c4U, (uint64_t)0x0006e769cd81a091U,
+    (uint64_t)0x0005810897a24a18U, (uint64_t)0x0007d07e19989065U, (uint64_t)0x0003ed6d325437b1U,
+    (uint64_t)0x00062b3325404c7dU, (uint64_t)0x000275d04f2b3510U, (uint64_t)0x00062e5a06b8b93bU,
+    (uint64_t)0x0002347386f0587fU, (uint64_t)0x0005218f6a9a707cU, (uint64_t)0x00075e5316ef56cdU,
+    (uint64_t)0x00057dd6527da326U, (uint64_t)0x000137c301aa4eebU, (uint64_t)0x0005b2038466db08U,
+    (uint64_t)0x00018838c156af50U, (uint64_t)0x000246f9615799a5U, (uint64_t)0x0004dfc3c993e8afU,
+    (uint64_t)0x0005a501bb5309c5U, (uint64_t)0x0001a75986e32bc5U, (uint64_t)0x0007614d69097315U,
+    (uint64_t)0x00045c3cca33a9b8U, (uint64_t)0x0005dc17a1192ddfU, (uint64_t)0x0006f21cad653d78U,
+    (uint64_t)0x000385731096c7d0U, (uint64_t)0x000487b74578e2b3U, (uint64_t)0x000090717cbfe980U,
+    (uint64_t)0x00068538e31bee79U, (uint64_t)0x000639f1d4b39be1U, (uint64_t)0x00070d539b3960ceU,
+    (uint64_t)0x0004879ec602fd75U, (uint64_t)0x00005379a90dca8aU, (uint64_t)0x0005fb9b0051910cU,
+    (uint64_t)0x00042e7d31374f84U, (uint64_t)0x0006ed6540f0f5b7U, (uint64_t)0x0000d5d53bad7ff0U,
+    (uint64_t)0x00039d0c8555ef53U, (uint64_t)0x0003c3b6a92efb1bU, (uint64_t)0x000460396d94b23bU,
+    (uint64_t)0x0006c763503cfdd5U, (uint64_t)0x000514aa5015721dU, (uint64_t)0x000583d89174c05cU,
+    (uint64_t)0x000126d49709e40cU, (uint64_t)0x00074f6271dda548U, (uint64_t)0x000054645a74df59U,
+    (uint64_t)0x0002af69c87b26ebU, (uint64_t)0x0002eef1181154a0U, (uint64_t)0x00030c7cce660084U,
+    (uint64_t)0x0003883000762536U, (uint64_t)0x00058d8af1db21feU, (uint64_t)0x00040c920c3a655cU,
+    (uint64_t)0x0002cd4c1a16f7fdU, (uint64_t)0x0004962227254243U, (uint64_t)0x00041925fd7ce64fU,
+    (uint64_t)0x0004393bf3f965fbU, (uint64_t)0x00063f4f071176fdU, (uint64_t)0x0006730d561b7734U,
+    (uint64_t)0x0000b370634de2b0U, (uint64_t)0x000714d5e69e0071U, (uint64_t)0x0005acdb88bba00bU,
+    (uint64_t)0x000478d6b7fd4a85U, (uint64_t)0x00029c11e1973ec7U, (uint64_t)0x000284468a4a7e91U,
+    (uint64_t)0x00054ca8847818fdU, (uint64_t)0x00062e9cb4cb2dcfU, (uint64_t)0x00070544ba129867U,
+    (uint64_t)0x0001aeb58a790994U, (uint64_t)0x0002201bfeff7515U, (uint64_t)0x0002fde64c624ba4U,
+    (uint64_t)0x0007be5f903e40eeU, (uint64_t)0x0006e8a9d9a1f04aU, (uint64_t)0x0004050b8fd8b2faU,
+    (uint64_t)0x0002af4f8c0bfb03U, (uint64_t)0x0006c890063b1743U, (uint64_t)0x0001e9f9667e2276U,
+    (uint64_t)0x00058041a1f70529U, (uint64_t)0x0005411d31d96f03U, (uint64_t)0x00005b5181462933U,
+    (uint64_t)0x00069e8a4550bbb3U, (uint64_t)0x00055bc5555266d1U, (uint64_t)0x00009571894ea475U,
+    (uint64_t)0x0003285919343bbfU, (uint64_t)0x00013e4b9507e542U, (uint64_t)0x0002d4bb274a03d8U,
+    (uint64_t)0x00022d5abfbda6dbU, (uint64_t)0x0002a96fb7475a56U, (uint64_t)0x0003853cbd45cda5U,
+    (uint64_t)0x00079cf2e8f8e6b9U, (uint64_t)0x000444cca031d743U, (uint64_t)0x0004330aaebadeffU,
+    (uint64_t)0x0001c6046ce2d3a1U, (uint64_t)0x0000599c55e84480U, (uint64_t)0x0001059bc969038bU,
+    (uint64_t)0x00011de45b556055U, (uint64_t)0x0004ce13eb73a98eU, (uint64_t)0x0000cb8a80b26a16U,
+    (uint64_t)0x000583d2954f6724U, (uint64_t)0x0003cde77866cc73U, (uint64_t)0x0007437e967a18f7U,
+    (uint64_t)0x000656c9df8ab52aU, (uint64_t)0x00074d4b5f93c801U, (uint64_t)0x000263b8fb42db69U,
+    (uint64_t)0x00079f2b3d77f3f4U, (uint64_t)0x0002a84b4b9ccfcaU, (uint64_t)0x0005e5d0832c9459U,
+    (uint64_t)0x0002f99b1500f926U, (uint64_t)0x00032daff8575fefU, (uint64_t)0x000273f1c9748beeU,
+    (uint64_t)0x0003945652014031U, (uint64_t)0x00031dca5551450bU, (uint64_t)0x0002aad73634142bU,
+    (uint64_t)0x0005fbc3dbd51c17U, (uint64_t)0x000543d84cb04fb2U, (uint64_t)0x00032ba4de59ef20U,
+    (uint64_t)0x000293485d85cdd2U, (uint64_t)0x0000ac9d611bd0b7U, (uint64_t)0x00024f349ec1c78cU,
+    (uint64_t)0x0000358fdc5b63edU, (uint64_t)0x0007264a03982220U, (uint64_t)0x0003bbe31ab4fcb8U,
+    (uint64_t)0x0003803239a9578aU, (uint64_t)0x0001361e4d03539eU, (uint64_t)0x000045a56cc3f4b7U,
+    (uint64_t)0x0000e1fb4f605ea1U, (uint64_t)0x00068129eaa3ed4eU, (uint64_t)0x0000060718d8ce56U,
+    (uint64_t)0x00025a521392830cU, (uint64_t)0x00002ac4c0386a42U, (uint64_t)0x00074860d7de3877U,
+    (uint64_t)0x0004aa9ff50e9e00U, (uint64_t)0x000487eddffd0cc3U, (uint64_t)0x0002f23583d97f83U,
+    (uint64_t)0x00001a36c19fc30eU, (uint64_t)0x0005551a500be480U, (uint64_t)0x000636985d007050U,
+    (uint64_t)0x00059c2be51d679dU, (uint64_t)0x0002349ed6864d33U, (uint64_t)0x000234e14931e343U,
+    (uint64_t)0x0003a6db62a039e9U, (uint64_t)0x0007947312005e76U, (uint64_t)0x0000b93d668de230U,
+    (uint64_t)0x00074f0a829607a2U, (uint64_t)0x0002d2dd667a240fU, (uint64_t)0x0000791506554dd1U,
+    (uint64_t)0x00022b97071b6eddU, (uint64_t)0x0006fc323592bbf4U, (uint64_t)0x00042913dd36a31cU,
+    (uint64_t)0x000377bd9db79c5dU, (uint64_t)0x00000c4b30e63981U, (uint64_t)0x0004b76b2079ba8cU,
+    (uint64_t)0x00025d24e32a5d8dU, (uint64_t)0x000702584d356bf5U, (uint64_t)0x0004c799521ae006U,
+    (uint64_t)0x000283d3ac2cc513U, (uint64_t)0x000014a0bee52f90U, (uint64_t)0x00075bd156187ed8U,
+    (uint64_t)0x0005cdb2e84c8617U, (uint64_t)0x0002816f8430d466U, (uint64_t)0x0001b17e74b47f1eU,
+    (uint64_t)0x0000cc956b4309f1U, (uint64_t)0x000319ab821d177cU, (uint64_t)0x00051c1a92648778U,
+    (uint64_t)0x0005452c4b45430eU, (uint64_t)0x0004039e4bb35752U, (uint64_t)0x00043d10ed4a847dU,
+    (uint64_t)0x0000f3a80964e003U, (uint64_t)0x000435d9272dbac6U, (uint64_t)0x000464a3c75fd0d8U,
+    (uint64_t)0x00046a6fba4bbef3U, (uint64_t)0x0007f7379b4035b8U, (uint64_t)0x000582fec791fd1eU,
+    (uint64_t)0x0002d67d8ac3c282U, (uint64_t)0x0001caeba6f06a2cU, (uint64_t)0x00056a7be98d85b8U,
+    (uint64_t)0x000018d77ab3a72cU, (uint64_t)0x0000977146a47b06U, (uint64_t)0x0002bba507e77aa1U,
+    (uint64_t)0x00065fcdc11e7ea7U, (uint64_t)0x0006f393ba689749U, (uint64_t)0x00053abe60e56f32U,
+    (uint64_t)0x0003453c96232737U, (uint64_t)0x0003d9c16193ea5bU, (uint64_t)0x0002176013a4fcc3U,
+    (uint64_t)0x0000f5d51935a5c7U, (uint64_t)0x00004a699191958aU, (uint64_t)0x000374259f1ae7a4U,
+    (uint64_t)0x00077a6462756390U, (uint64_t)0x000060c2952bf5adU, (uint64_t)0x00004b4205427f5bU,
+    (uint64_t)0x000636039548e695U, (uint64_t)0x00007ef77cacb315U, (uint64_t)0x000124bbe329edd8U,
+    (uint64_t)0x00010ef5d4944825U, (uint64_t)0x0000db40cfce84b6U, (uint64_t)0x0001f3c964781cfdU,
+    (uint64_t)0x000197fada71d8c4U, (uint64_t)0x0006ce479e17af52U, (uint64_t)0x0006db3fc3417d36U,
+    (uint64_t)0x000537b4701f0c00U, (uint64_t)0x00022b2dd12588b4U, (uint64_t)0x0001d947e640b8d6U,
+    (uint64_t)0x0004aa8b50afee60U, (uint64_t)0x0005d41698923f4eU, (uint64_t)0x00064780eef8bc11U,
+    (uint64_t)0x00064fba820ef8a6U, (uint64_t)0x00060a63f7922bb8U, (uint64_t)0x0001745f6d6f5785U,
+    (uint64_t)0x0002d92794a28e9fU, (uint64_t)0x0003a9406d690b66U, (uint64_t)0x00010a8a9ffa469bU,
+    (uint64_t)0x0000d7c767e1e086U, (uint64_t)0x000642ef970f976dU, (uint64_t)0x000035d5103f2785U,
+    (uint64_t)0x000489c13fdc9fe9U, (uint64_t)0x0007f2183c84ee88U, (uint64_t)0x0007d337b8f29d2bU,
+    (uint64_t)0x00040b31bfca128eU, (uint64_t)0x0000cc495fe64bc4U, (uint64_t)0x000606036e75198bU,
+    (uint64_t)0x00027c71834ded4bU, (uint64_t)0x00050deae783c8a3U, (uint64_t)0x0003bf7f6069f334U,
+    (uint64_t)0x00042138e7b6cab9U, (uint64_t)0x000464e4dbb7e189U, (uint64_t)0x000153c4db078639U,
+    (uint64_t)0x0001c441fd6d5b5cU, (uint64_t)0x000083c104268acdU, (uint64_t)0x0003d0ac8da66332U,
+    (uint64_t)0x0004570a141e648aU, (uint64_t)0x0001803372cb9b5aU, (uint64_t)0x000423f8c22efd9dU,
+    (uint64_t)0x000084ebd46a86edU, (uint64_t)0x0007efb45d3a2851U, (uint64_t)0x000018acd0c28cdaU,
+    (uint64_t)0x0003b4643a86ca5dU, (uint64_t)0x0005c7e2dde4895fU, (uint64_t)0x0007ab433848e34eU,
+    (uint64_t)0x0000fe1198b11a1bU, (uint64_t)0x00016b61e8ac6200U, (uint64_t)0x000114bd44f6ac84U,
+    (uint64_t)0x0006074058795c06U, (uint64_t)0x0005d1eaf5ca51ceU, (uint64_t)0x000437eeafeefe29U,
+    (uint64_t)0x0006918f2c983218U, (uint64_t)0x00079e7d519e0255U, (uint64_t)0x0006cbb5a79176e4U,
+    (uint64_t)0x0006290b675e8c23U, (uint64_t)0x0005d5225a5e2235U, (uint64_t)0x0006bc4e5de7b1b9U,
+    (uint64_t)0x0003304ef028177dU, (uint64_t)0x00056eafbb1ad6acU, (uint64_t)0x0006c69a454931b5U,
+    (uint64_t)0x0007ec9e5494feecU, (uint64_t)0x0001a128ca0e3484U, (uint64_t)0x0001dda2fbc04a39U,
+    (uint64_t)0x000683602f169a70U, (uint64_t)0x0004790972a8ffe7U, (uint64_t)0x0000ab9bfbedf022U,
+    (uint64_t)0x0002c3cd228bac21U, (uint64_t)0x00075bd7af0bdd33U, (uint64_t)0x00042505d6feaeb6U,
+    (uint64_t)0x0007d8493ed22c62U, (uint64_t)0x0006db3c0d1a1f27U, (uint64_t)0x0006ba7775d04f62U,
+    (uint64_t)0x0005f25b171aeeeeU, (uint64_t)0x0004713b58f4d261U, (uint64_t)0x0006d9f89747f807U,
+    (uint64_t)0x00007b499ecb9b1bU, (uint64_t)0x0006100faa8dbbe4U, (uint64_t)0x000145934997b839U,
+    (uint64_t)0x000471b9cc9e8582U, (uint64_t)0x0007a9d8806c2c83U, (uint64_t)0x00057ad664a77ea9U,
+    (uint64_t)0x00031d729a2e5760U, (uint64_t)0x00011184866b0dcdU, (uint64_t)0x000621aa263918e5U,
+    (uint64_t)0x000304995ab111a8U, (uint64_t)0x0006fde98f557e33U, (uint64_t)0x0003f94a48002c8bU,
+    (uint64_t)0x00022b7caa4d30ebU, (uint64_t)0x00027380949796c7U, (uint64_t)0x0000055cf42209e1U,
+    (uint64_t)0x0006994510fbdad7U, (uint64_t)0x0007085430611bf2U, (uint64_t)0x00028f3a485ecef5U,
+    (uint64_t)0x00073205d7a748e7U, (uint64_t)0x0007cef1244339b0U, (uint64_t)0x0003c86b1f74ef30U,
+    (uint64_t)0x00007c406ee8b4d5U, (uint64_t)0x00063523e0ec80f6U, (uint64_t)0x000351753f66f657U,
+    (uint64_t)0x0007defd1a2bfc27U, (uint64_t)0x00073d4d9f5b9708U, (uint64_t)0x0007c7fcc669e516U,
+    (uint64_t)0x000566599c6e6d42U, (uint64_t)0x000340dc5ac83e94U, (uint64_t)0x000705432ef8d351U,
+    (uint64_t)0x000256e14cee7d41U, (uint64_t)0x0006384331e497c9U, (uint64_t)0x000750d2955b3177U,
+    (uint64_t)0x0007b0f693890621U, (uint64_t)0x0002763a46b78f53U, (uint64_t)0x0000109cb575a611U,
+    (uint64_t)0x000743a6a211a8a9U, (uint64_t)0x0002642651606a17U, (uint64_t)0x0006efee68a8553bU,
+    (uint64_t)0x00030981d95b51e5U, (uint64_t)0x0005c3370c184b6fU, (uint64_t)0x0006d7269a0ad07eU,
+    (uint64_t)0x0003272066270fceU, (uint64_t)0x000446ac441625b7U, (uint64_t)0x0002002e9ad522eeU,
+    (uint64_t)0x000292a52d9e9332U, (uint64_t)0x0005c324ca268214U, (uint64_t)0x0002d3ed16ae3a37U,
+    (uint64_t)0x0000564333fcb486U, (uint64_t)0x00061d2ce2338a0eU, (uint64_t)0x0002fe5b430cbe27U,
+    (uint64_t)0x000709f014389c99U, (uint64_t)0x0006e87f6da81f17U, (uint64_t)0x00068bd2434ed7c8U,
+    (uint64_t)0x00055b78a638645eU, (uint64_t)0x0000f9df8eef9562U, (uint64_t)0x0002674eb33be730U,
+    (uint64_t)0x00000e86052ddbb3U, (uint64_t)0x0003d3210ad427b9U, (uint64_t)0x0007f21ba8dbad29U,
+    (uint64_t)0x00042ddc05b73970U, (uint64_t)0x00052b9dff864991U, (uint64_t)0x0003193d8834bda7U,
+    (uint64_t)0x00037dbe599cd6ebU, (uint64_t)0x0007c573ad249584U, (uint64_t)0x0006afb9ba912798U,
+    (uint64_t)0x00042d25a9abdca2U, (uint64_t)0x0007dce106606bf5U, (uint64_t)0x0004e96cf0da57f9U,
+    (uint64_t)0x000416ca8e4102e9U, (uint64_t)0x000705bd9027e77dU, (uint64_t)0x0006cd670c1bfec2U,
+    (uint64_t)0x00073c0591ca3c1aU, (uint64_t)0x0006b529073fc221U, (uint64_t)0x0001d0ca65236a11U,
+    (uint64_t)0x0001417fa0628ebcU, (uint64_t)0x0002140e4ba65833U, (uint64_t)0x0005335fd8491ac4U,
+    (uint64_t)0x000659254d4e1667U, (uint64_t)0x0006a76673fb4e07U, (uint64_t)0x0004b41a2671f969U,
+    (uint64_t)0x0006109a9afceb6aU, (uint64_t)0x0003ad4783875b79U, (uint64_t)0x0006b12516f11baaU,
+    (uint64_t)0x0007fbf83e0920f1U, (uint64_t)0x00004892cfff7f94U, (uint64_t)0x0006ca461a543130U,
+    (uint64_t)0x000178387c5978dcU, (uint64_t)0x00068fe3bafa05d6U, (uint64_t)0x00009ad3d1928e08U,
+    (uint64_t)0x0003ae2aa25e2555U, (uint64_t)0x0005c188dde15ed8U, (uint64_t)0x0003089ef25d6896U,
+    (uint64_t)0x0005ca4a72d4e1e7U, (uint64_t)0x0001986a5506e3abU, (uint64_t)0x0002bfc1ba4bfb99U,
+    (uint64_t)0x0006098a9f1048b4U, (uint64_t)0x0006ee160f5e1f4eU, (uint64_t)0x000098ae114a020fU,
+    (uint64_t)0x000458dd27aee251U, (uint64_t)0x00060c497780d40cU, (uint64_t)0x000040c7086cb1d4U,
+    (uint64_t)0x0003aede616bee67U, (uint64_t)0x00041d5d5cbe96c9U, (uint64_t)0x00010427b6510476U,
+    (uint64_t)0x00022fa44ee0eb50U, (uint64_t)0x000301c5ade24705U, (uint64_t)0x000193a9c19b16a4U,
+    (uint64_t)0x00070db2ca405f4cU, (uint64_t)0x00073fe73844395aU, (uint64_t)0x00068203f466ea10U,
+    (uint64_t)0x00014d528a5f7598U, (uint64_t)0x0005d859b80803a1U, (uint64_t)0x00008cbc81e7f544U,
+    (uint64_t)0x0001dacfa9ef2851U, (uint64_t)0x0007d7225dafd9c4U, (uint64_t)0x0005b18d4eebfb4eU,
+    (uint64_t)0x00045fe5df3dbc33U, (uint64_t)0x000431f1a5dccdbcU, (uint64_t)0x00057fd4977b16eeU,
+    (uint64_t)0x00063e030388d50aU, (uint64_t)0x00047689b7199d9fU, (uint64_t)0x0004473240470af6U,
+    (uint64_t)0x0000aaa265615fd6U, (uint64_t)0x00039df009dd14e9U, (uint64_t)0x0002e2823213d484U,
+    (uint64_t)0x00061904a63f000fU, (uint64_t)0x0001bd716fe62caaU, (uint64_t)0x00014c5a5e251f84U,
+    (uint64_t)0x0003dfd95553c0fdU, (uint64_t)0x000480d816072eb6U, (uint64_t)0x000684a8cd33137eU,
+    (uint64_t)0x0005886d75ece3caU, (uint64_t)0x0006654b005abc5eU, (uint64_t)0x0001dabf39c3ada4U,
+    (uint64_t)0x000552d0f1d6bda4U, (uint64_t)0x00029f4e5b9c675fU, (uint64_t)0x00050c1e7bb68929U,
+    (uint64_t)0x000731f3c382d066U, (uint64_t)0x0005954b8c17982aU, (uint64_t)0x0007be59978e85b5U,
+    (uint64_t)0x00033f7e95221da8U, (uint64_t)0x0004e0a7caf97d67U, (uint64_t)0x0007d63278c8fd1dU,
+    (uint64_t)0x00061125b15491dcU, (uint64_t)0x000148a7d88b200dU, (uint64_t)0x0002dfead4e889b4U,
+    (uint64_t)0x0006aa628cb3c563U, (uint64_t)0x00020f683e3e00abU, (uint64_t)0x000201e3231a2df0U,
+    (uint64_t)0x0004f4f0b1a20843U, (uint64_t)0x00024320ce9a185dU, (uint64_t)0x0001607a82cb7418U,
+    (uint64_t)0x000767446415985fU, (uint64_t)0x000113a780508ae4U, (uint64_t)0x00071e22f24aa305U,
+    (uint64_t)0x00033f84ff1f58e9U, (uint64_t)0x0004ad261c396392U, (uint64_t)0x0003e17c51f865d6U,
+    (uint64_t)0x00054ebc546e84feU, (uint64_t)0x000130130d18b59cU, (uint64_t)0x0001894bc50376ffU,
+    (uint64_t)0x0002b38e0b200e13U, (uint64_t)0x0007f9196a244767U, (uint64_t)0x0003a295aaecee77U,
+    (uint64_t)0x00029c224fb2db0aU, (uint64_t)0x0005cfcc804b5636U, (uint64_t)0x0004daa371dc3b5cU,
+    (uint64_t)0x000245b2050b5d52U, (uint64_t)0x000239ac84c87c2fU, (uint64_t)0x0005594399156930U,
+    (uint64_t)0x000038d46484879bU, (uint64_t)0x0002976e11fab93fU, (uint64_t)0x0007d53cbbd946f5U,
+    (uint64_t)0x0001bfe5c9fdf184U, (uint64_t)0x00036c2e3fa23db3U, (uint64_t)0x00013ce53eeb864dU,
+    (uint64_t)0x0004e4f0eeaf8fbcU, (uint64_t)0x0003bc3ac9f0bc22U, (uint64_t)0x00069ac3e8c9a214U,
+    (uint64_t)0x0000c5c488542844U, (uint64_t)0x00036b8f43d81685U, (uint64_t)0x0006656aa9137ae5U,
+    (uint64_t)0x0001b16ac3306b17U, (uint64_t)0x0005fa99c8159b38U, (uint64_t)0x0004fcfa1f7f8382U,
+    (uint64_t)0x000482ac0bf80638U, (uint64_t)0x00051efc120572f8U, (uint64_t)0x0002419a0021b2aeU,
+    (uint64_t)0x000278fc16937ba3U, (uint64_t)0x000378e98824a6bcU, (uint64_t)0x00023fd4b8eeb48eU,
+    (uint64_t)0x00068ea7a15c0376U, (uint64_t)0x0001ee4b123a88a0U, (uint64_t)0x000698dc36b7307fU,
+    (uint64_t)0x000114214780d621U, (uint64_t)0x00059fd157be00a9U, (uint64_t)0x000045eaf2ac0d10U,
+    (uint64_t)0x0002c235eb610b2eU, (uint64_t)0x00079e6ada8ee73aU, (uint64_t)0x00043beea412351aU,
+    (uint64_t)0x0002817b94e68325U, (uint64_t)0x00047920a1d5d236U, (uint64_t)0x000064962364b5a2U,
+    (uint64_t)0x00008acb90b0b095U, (uint64_t)0x0000ea2c846a535aU, (uint64_t)0x00071b5a8b0d031bU,
+    (uint64_t)0x0003e7a622de4972U, (uint64_t)0x0006f860e94280ccU, (uint64_t)0x00008ddd60bb5089U,
+    (uint64_t)0x0003b82a8337b05fU, (uint64_t)0x000298ad5efd8f96U, (uint64_t)0x00063408aadfa799U,
+    (uint64_t)0x0006b044c3ba8848U, (uint64_t)0x000343a5a91bd506U, (uint64_t)0x0003cdde28b0d964U,
+    (uint64_t)0x00077dbcd25c5f3dU, (uint64_t)0x000088a44da541ceU, (uint64_t)0x00071a9b1b77101aU,
+    (uint64_t)0x000748c3b6d6a4ebU, (uint64_t)0x000561d2c1d673a0U, (uint64_t)0x0005d2d4cf747afeU,
+    (uint64_t)0x00046e1b7a1bc33cU, (uint64_t)0x000733b3b1b799a4U, (uint64_t)0x000135ee3bb51984U,
+    (uint64_t)0x0002dac09925d762U, (uint64_t)0x0000d72c3f3b533fU, (uint64_t)0x0002efd85f1c7133U,
+    (uint64_t)0x00049d463afbf4c3U, (uint64_t)0x0007aa95b26d208bU, (uint64_t)0x00024d703f5ab01cU,
+    (uint64_t)0x000033c6e4ad2af6U, (uint64_t)0x00073dfbca7e8058U, (uint64_t)0x0000a61f4acb4073U,
+    (uint64_t)0x000063dc8371bd9dU, (uint64_t)0x00070231a092565fU, (uint64_t)0x00010642c985a6c2U,
+    (uint64_t)0x0004aa22eddc348cU, (uint64_t)0x0007d48d59716dabU, (uint64_t)0x0005cb2953e0a5d6U,
+    (uint64_t)0x0001df8dc634575bU, (uint64_t)0x0000a15b45f63107U, (uint64_t)0x0003045dd03e226bU,
+    (uint64_t)0x000383766cf6ffb4U, (uint64_t)0x0003e5b2d56e549bU, (uint64_t)0x0005448b030c625dU,
+    (uint64_t)0x0002dbd3eb171523U, (uint64_t)0x000595723e002bc2U, (uint64_t)0x00052c6fb6b33904U,
+    (uint64_t)0x000344b30bedde16U, (uint64_t)0x000140b6f1e4bad4U, (uint64_t)0x00002d77b6bfce11U,
+    (uint64_t)0x00014bb469e30449U, (uint64_t)0x00035d50f849c2c1U, (uint64_t)0x0007a9ee1395876cU,
+    (uint64_t)0x000444eb3598ccafU, (uint64_t)0x0004b8fbeb124cbdU, (uint64_t)0x0005fc76b816dc24U,
+    (uint64_t)0x0001e74a83a69dd8U, (uint64_t)0x0002a435836410fbU, (uint64_t)0x00030a00d3edde95U,
+    (uint64_t)0x000652250ab38365U, (uint64_t)0x0003a020ea8eaa8aU, (uint64_t)0x000458f7fd3d3e51U,
+    (uint64_t)0x0003dc086535d721U, (uint64_t)0x00034bd49edfa2ddU, (uint64_t)0x0002217edfd34c25U,
+    (uint64_t)0x000340c1c16cf1a3U, (uint64_t)0x0001b5323bacf59dU, (uint64_t)0x00072f1bc4be26f7U,
+    (uint64_t)0x00073feaa96bbe61U, (uint64_t)0x00017db9c8f437a8U, (uint64_t)0x000627a48d281b6cU,
+    (uint64_t)0x0007e7ad719e4786U, (uint64_t)0x000422b5fa79c32eU, (uint64_t)0x000362b4a8723182U,
+    (uint64_t)0x00028e8a83744eb5U, (uint64_t)0x000442affcde176bU, (uint64_t)0x0002968dd2043343U,
+    (uint64_t)0x0006b0d71cc909b2U, (uint64_t)0x00070d99008ffcb5U, (uint64_t)0x0006c54e726c32b9U,
+    (uint64_t)0x00044283befd1791U, (uint64_t)0x00067e09c40e60edU, (uint64_t)0x0002c997194d7c90U,
+    (uint64_t)0x00056b125243a069U, (uint64_t)0x00076258a82248f1U, (uint64_t)0x0002a05aea316ca8U,
+    (uint64_t)0x00052360c81e6f37U, (uint64_t)0x0007ae136b92181eU, (uint64_t)0x0002bf17b9d14788U,
+    (uint64_t)0x0003abc449a3d1a4U, (uint64_t)0x0000a2263753947eU, (uint64_t)0x0007dfc5b0b50798U,
+    (uint64_t)0x00004dfc6e993065U, (uint64_t)0x0007b50476b0a337U, (uint64_t)0x00012a1e8baa33ccU,
+    (uint64_t)0x000243b17bebcaf6U, (uint64_t)0x0003c6188ed37727U, (uint64_t)0x0006a1284ec80951U,
+    (uint64_t)0x0002448c3ec7026fU, (uint64_t)0x0002053d66c73bfdU, (uint64_t)0x00002bdd1bd082a1U,
+    (uint64_t)0x0006dd4c1ae4b145U, (uint64_t)0x000533f5e1101c3bU, (uint64_t)0x0006868a751465a0U,
+    (uint64_t)0x0001b2660f617607U, (uint64_t)0x000508bd980fc724U, (uint64_t)0x0004d510c8a68608U,
+    (uint64_t)0x000665aa2f30af09U, (uint64_t)0x0000a9fcf41f6ef7U, (uint64_t)0x0002e6c384daf9ddU,
+    (uint64_t)0x00072bb2da4493f1U, (uint64_t)0x00064d5b063161bcU, (uint64_t)0x0001d4691dbcdad5U,
+    (uint64_t)0x000732fb4faed167U, (uint64_t)0x000107cad2e01c24U, (uint64_t)0x0000d6938aff729aU,
+    (uint64_t)0x00027197db446e19U, (uint64_t)0x0006db52acb6b175U, (uint64_t)0x0003e4d21b936593U,
+    (uint64_t)0x0002d644c7dad28dU, (uint64_t)0x00043703afa4db6fU, (uint64_t)0x0001f85df5ea777bU,
+    (uint64_t)0x00073e16c6821b8eU, (uint64_t)0x0001bc7af1e38185U, (uint64_t)0x0002f65900314833U,
+    (uint64_t)0x00024c6364e1f95eU, (uint64_t)0x00057701247409f8U, (uint64_t)0x000797bd2f77c3bcU,
+    (uint64_t)0x00061d909d855661U, (uint64_t)0x000045216636c2c7U, (uint64_t)0x0006cadbcfdf0a37U,
+    (uint64_t)0x00047c3ef66ee3c8U, (uint64_t)0x000522665b326f25U, (uint64_t)0x0001a340b8054b8fU,
+    (uint64_t)0x0001938218028354U, (uint64_t)0x0006bb1b54fa00f3U, (uint64_t)0x0006e28f67cbea25U,
+    (uint64_t)0x0004b5e9141aad35U, (uint64_t)0x00006bce245f8c25U, (uint64_t)0x0004955188a3c065U,
+    (uint64_t)0x000161bd0f1292dfU, (uint64_t)0x0001d521630b2506U, (uint64_t)0x0006d06495669788U,
+    (uint64_t)0x0003d26989cdd0f6U, (uint64_t)0x000365eb8eb94b17U, (uint64_t)0x000018452cd8dbe9U,
+    (uint64_t)0x0000d790b46bf270U, (uint64_t)0x00078813093349c2U, (uint64_t)0x0007a9f6260e653aU,
+    (uint64_t)0x000589041b29662fU, (uint64_t)0x0001d6fbadddcfd7U, (uint64_t)0x0001fff2d032c3bcU,
+    (uint64_t)0x0002f7b21e1d64e1U, (uint64_t)0x0007665908aaf444U, (uint64_t)0x0003a00e4b704ca1U,
+    (uint64_t)0x00071715f4826e10U, (uint64_t)0x00040ad025948864U, (uint64_t)0x0002a3670bfc0327U,
+    (uint64_t)0x0004ed18a7c50da4U, (uint64_t)0x00054343b9ec13bbU, (uint64_t)0x00015437f0d48d06U,
+    (uint64_t)0x000366c6c241874bU, (uint64_t)0x0006e66e4600d1c1U, (uint64_t)0x0006bb9cf0f2d4dbU,
+    (uint64_t)0x0005954e6c16d4f7U, (uint64_t)0x0007ca457221ebb3U, (uint64_t)0x00069398c394d173U,
+    (uint64_t)0x000554841a79f99dU, (uint64_t)0x0000a09b36eb5a04U, (uint64_t)0x0002eb0fa35ed926U,
+    (uint64_t)0x00049a86e7641e74U, (uint64_t)0x0003b54cf41b3a7bU, (uint64_t)0x000085125b7595d7U,
+    (uint64_t)0x0003aa47fd60fa31U, (uint64_t)0x0003b1cc6b04c053U, (uint64_t)0x00013e65c5705fc4U,
+    (uint64_t)0x0007f81640bc9a65U, (uint64_t)0x0006ac534fc04217U, (uint64_t)0x0003bd5dfb4b4648U,
+    (uint64_t)0x0004d5451113735eU, (uint64_t)0x0002574dcfa41233U, (uint64_t)0x00055926182e858bU,
+    (uint64_t)0x0006b540645ad45fU, (uint64_t)0x0001c71ce37638e6U, (uint64_t)0x0000fee129e406cbU,
+    (uint64_t)0x0007e88f52e59c7dU, (uint64_t)0x0002833edf503460U, (uint64_t)0x000166921edd6bcdU,
+    (uint64_t)0x0007880cc1c2003bU, (uint64_t)0x00030eaefc5832acU, (uint64_t)0x000007bb8bc02f05U,
+    (uint64_t)0x00010ee994d38e57U, (uint64_t)0x0000c32dd003212eU, (uint64_t)0x00079030a4774645U,
+    (uint64_t)0x00039e7f74cbc8d6U, (uint64_t)0x00008d90a5963263U, (uint64_t)0x00070b3f944839e5U,
+    (uint64_t)0x0007bec4bd417c4aU, (uint64_t)0x0003c607a84c1df2U, (uint64_t)0x00079a86ba3cea68U,
+    (uint64_t)0x00042e6340c19d4eU, (uint64_t)0x00076fb861261f82U, (uint64_t)0x00051d11c25d5a44U,
+    (uint64_t)0x00034518ad109941U, (uint64_t)0x00003c6c9e37345dU, (uint64_t)0x0007081214e622b1U,
+    (uint64_t)0x00060ece5ba974a8U, (uint64_t)0x000179f8768deed4U, (uint64_t)0x0000727055e32e57U,
+    (uint64_t)0x0002f417ffbe2da0U, (uint64_t)0x0004d4c71c738621U, (uint64_t)0x0005bbdfc4e85ff1U,
+    (uint64_t)0x0006331ffc9c6eb0U, (uint64_t)0x000089b6cd02000bU, (uint64_t)0x000016f13e8ceb88U,
+    (uint64_t)0x0004f9b762547cf1U, (uint64_t)0x00072995f90f2f92U, (uint64_t)0x0007ec5a1c6f7e88U,
+    (uint64_t)0x00066ef7206aa36dU, (uint64_t)0x000478374da76d28U, (uint64_t)0x0005344ef62175f4U,
+    (uint64_t)0x00078f681d66e834U, (uint64_t)0x0001fda3b879848dU, (uint64_t)0x0000d2c585f51161U,
+    (uint64_t)0x0006b2d6fc2c9fdbU, (uint64_t)0x0005b0e0cf4a45c3U, (uint64_t)0x0001de41b4adca18U,
+    (uint64_t)0x0006b07c3d5aa1a3U, (uint64_t)0x000079e9d5b60917U, (uint64_t)0x0001381c04c78797U,
+    (uint64_t)0x00079470b8eb0720U, (uint64_t)0x0002fe8895900193U, (uint64_t)0x0005229893654a28U,
+    (uint64_t)0x00016512951d2240U, (uint64_t)0x0001b9bb33b94e2aU, (uint64_t)0x000471701c32b888U,
+    (uint64_t)0x0007201f9f3e4791U, (uint64_t)0x00009c9665f45f28U, (uint64_t)0x00018a2cd789580bU,
+    (uint64_t)0x0000319170c5cbebU, (uint64_t)0x00045dfa1901b262U, (uint64_t)0x0004f5a78e09bfa1U,
+    (uint64_t)0x00061a937098bfc8U, (uint64_t)0x0005e9ac4ab2f4a3U, (uint64_t)0x0006c32be5b51babU,
+    (uint64_t)0x0001fcce7a160521U, (uint64_t)0x0003879392f3c991U, (uint64_t)0x0001e65e9799a94dU,
+    (uint64_t)0x000505f00fa8aee0U, (uint64_t)0x00006ddebed72a48U, (uint64_t)0x00045d47b79da83bU,
+    (uint64_t)0x00067c366538c980U, (uint64_t)0x00075e2f5b863d40U, (uint64_t)0x0004c143172068caU,
+    (uint64_t)0x0004b53d220ddbf6U, (uint64_t)0x00073c503e062ea2U, (uint64_t)0x0006684612a688deU,
+    (uint64_t)0x000054bc44a9da83U, (uint64_t)0x0002e5c4ef1a1273U, (uint64_t)0x0003dc4dfb54008bU,
+    (uint64_t)0x000196ffe806a2f9U, (uint64_t)0x00013a653b912bfaU, (uint64_t)0x0001cb2e2eaa3a54U,
+    (uint64_t)0x0005c1731365512aU, (uint64_t)0x00053c542e8e408cU, (uint64_t)0x00008e571f36624eU,
+    (uint64_t)0x00044a6ce3831e3aU, (uint64_t)0x0002147a6c5ddfddU, (uint64_t)0x0007a288f7dc1bdbU,
+    (uint64_t)0x00041f5395c68f4bU, (uint64_t)0x00021527553fa46dU, (uint64_t)0x000449133ccc4daeU,
+    (uint64_t)0x00020ad573c8d918U, (uint64_t)0x0000e2606a00097aU, (uint64_t)0x000150dbc87749c3U,
+    (uint64_t)0x00010772f531215aU, (uint64_t)0x0004ed926dacae76U, (uint64_t)0x00078e59c7d6a1e8U,
+    (uint64_t)0x0002dda446c4a628U, (uint64_t)0x0005323f588ad35dU, (uint64_t)0x0006234537298972U,
+    (uint64_t)0x0007b77f428399fdU, (uint64_t)0x00000214cb090c49U, (uint64_t)0x00066ec4f3b562daU,
+    (uint64_t)0x0007f2867bef24ceU, (uint64_t)0x000710efab9d0ee1U, (uint64_t)0x0001ca33cabfbcb4U,
+    (uint64_t)0x0000b725aadb7597U, (uint64_t)0x0004c6c9a0e8a4efU, (uint64_t)0x00074fd1c286ea25U,
+    (uint64_t)0x00002cd1ab9507d6U, (uint64_t)0x0002e4153317b496U, (uint64_t)0x00044139df386b6cU,
+    (uint64_t)0x00026d5711ee5a1eU, (uint64_t)0x0005abb79c0fde35U, (uint64_t)0x0005907a27bbca26U,
+    (uint64_t)0x0005933ae4579161U, (uint64_t)0x0006befe0e507701U, (uint64_t)0x0007537838147422U,
+    (uint64_t)0x00055142c59d25f5U, (uint64_t)0x0001105332feb39dU, (uint64_t)0x0005a3b10bc1a673U,
+    (uint64_t)0x0002fef4bf5b0200U, (uint64_t)0x0006a73b1e2a603eU, (uint64_t)0x00043f6ebcfaffcdU,
+    (uint64_t)0x0007d7801e33722bU, (uint64_t)0x00041d7ad7f6053aU, (uint64_t)0x00028882b8c39aa5U,
+    (uint64_t)0x0006ea5ccc1efdb4U, (uint64_t)0x0006b40e7b7d3aaaU, (uint64_t)0x0002ed80f45ab6d0U,
+    (uint64_t)0x0001fc8596940ff7U, (uint64_t)0x0007a1f8de11d710U, (uint64_t)0x00073db626767879U,
+    (uint64_t)0x0005224fa7c36d4eU, (uint64_t)0x0006fee2cfd444c8U, (uint64_t)0x0001c4a8061b718fU,
+    (uint64_t)0x000798676199ae1cU, (uint64_t)0x000728a71912cf9fU, (uint64_t)0x000123d52809448cU,
+    (uint64_t)0x000358c8b09e71f9U, (uint64_t)0x00064d5f1f4bfd7aU, (uint64_t)0x000507b16eb4e0d1U,
+    (uint64_t)0x0004ce95d59305cdU, (uint64_t)0x0003326f0aab6e52U, (uint64_t)0x0004e7f20bc2b131U,
+    (uint64_t)0x0004bc3e54dc55b8U, (uint64_t)0x0005060e1db16a64U, (uint64_t)0x0005ed6fa57f0d44U,
+    (uint64_t)0x000544cb218af30cU, (uint64_t)0x000348d6ce5b8f28U, (uint64_t)0x000316d36d34d1d9U,
+    (uint64_t)0x0001985a3b2895e8U, (uint64_t)0x0005ca076f131f17U, (uint64_t)0x00044971a4ebf223U,
+    (uint64_t)0x000717a30b3a1a67U, (uint64_t)0x000533a8b44436d8U, (uint64_t)0x0000441bc8bdcf71U,
+    (uint64_t)0x000314d831f8052dU, (uint64_t)0x00005a95bdbf4473U, (uint64_t)0x000161fc5e8eecebU,
+    (uint64_t)0x000451683a613716U, (uint64_t)0x00038db78ff1b047U, (uint64_t)0x0003de3ac6441cf3U,
+    (uint64_t)0x0004d77227507e92U, (uint64_t)0x000086b032cd3ac1U, (uint64_t)0x00018aa9b22cd652U,
+    (uint64_t)0x0001b6798a8e3743U, (uint64_t)0x000599ba21b65ffbU, (uint64_t)0x000250c48865a9e2U,
+    (uint64_t)0x0000288bedc7777fU, (uint64_t)0x000737db77525f28U, (uint64_t)0x000615b3cbf29f9fU,
+    (uint64_t)0x00007f59b350f668U, (uint64_t)0x000315c7ec09c488U, (uint64_t)0x00077b82b784940aU,
+    (uint64_t)0x00025b1912c493d2U, (uint64_t)0x00044e6d968654d0U, (uint64_t)0x00065d3b1c67481eU,
+    (uint64_t)0x000723d42c9bfadbU, (uint64_t)0x0004c0ed8c71458cU, (uint64_t)0x00014f480f093d20U,
+    (uint64_t)0x0004a3b8b2f69410U, (uint64_t)0x0003328bc121616aU, (uint64_t)0x000333cdfafac039U,
+    (uint64_t)0x000232736ed2f8e8U, (uint64_t)0x0005319c6317adcaU, (uint64_t)0x00065939f2fa7808U,
+    (uint64_t)0x0002bbf3f26c21b5U, (uint64_t)0x0007f32b5f405db1U, (uint64_t)0x00079e8dbb6f6071U,
+    (uint64_t)0x0005199bc11bff31U, (uint64_t)0x0006aa290ba1ea39U, (uint64_t)0x00052e3fbc9dca56U,
+    (uint64_t)0x00076fc37c90a733U, (uint64_t)0x000542ee4cf414a2U, (uint64_t)0x0007077a0c518dfbU,
+    (uint64_t)0x0000f9bd192096b8U, (uint64_t)0x0003646a62ad82bdU, (uint64_t)0x0003b8f97c6bccacU,
+    (uint64_t)0x000671efba0b8111U, (uint64_t)0x0004032a1b6883a9U, (uint64_t)0x0004f474a6b9d6e3U,
+    (uint64_t)0x00024dd06031fdaaU, (uint64_t)0x0000a317e4b38b2aU, (uint64_t)0x000723df163376a4U,
+    (uint64_t)0x0000b19cd35f74d9U, (uint64_t)0x000076c5c5bcac72U, (uint64_t)0x000421e4b4b514c2U,
+    (uint64_t)0x0003143712372646U, (uint64_t)0x0005066f24482e5eU, (uint64_t)0x000715c90f9b9e3eU,
+    (uint64_t)0x0005bb5858157a21U, (uint64_t)0x00065a10ff6a067cU, (uint64_t)0x000669777c684d1bU,
+    (uint64_t)0x000213883cbaabd4U, (uint64_t)0x0005fbb31ae52c4dU, (uint64_t)0x00065f0e5e478f14U,
+    (uint64_t)0x0003607014f6a64eU, (uint64_t)0x0001ed4f0d4ed2c6U, (uint64_t)0x00018298a22c6bf6U,
+    (uint64_t)0x00028b06939ac749U, (uint64_t)0x00040aecd9d24195U, (uint64_t)0x00024394e3f3b716U,
+    (uint64_t)0x00052a980a61b29cU, (uint64_t)0x00016cb5953ddaf4U, (uint64_t)0x00061772fb88782bU,
+    (uint64_t)0x00029a2bd34e07acU, (uint64_t)0x0003c0c1e7beb87aU, (uint64_t)0x0000b50d6384bd2fU,
+    (uint64_t)0x000698d273c97e14U, (uint64_t)0x0000bc65cffcd268U, (uint64_t)0x000318c91622aa37U,
+    (uint64_t)0x00074e826b2f1347U, (uint64_t)0x0003e242a23dd94eU, (uint64_t)0x0006cdbd4e18ed9fU,
+    (uint64_t)0x00052cf7bbecde42U, (uint64_t)0x0000c4d1cae2dca9U, (uint64_t)0x0003a488c40b771aU,
+    (uint64_t)0x000748fe1a825c77U, (uint64_t)0x00021514a7862c84U, (uint64_t)0x00034c40dc979953U,
+    (uint64_t)0x000052999cbd4a7aU, (uint64_t)0x000579ac4b521848U, (uint64_t)0x0002b413d28a281dU,
+    (uint64_t)0x00060c9f45a12b5cU, (uint64_t)0x0003f1dd08f82872U, (uint64_t)0x00057e772b88cc31U,
+    (uint64_t)0x00062bfb93d6971cU, (uint64_t)0x0001c0980b1c3325U, (uint64_t)0x0003e203a0927754U,
+    (uint64_t)0x0005d686e2df38faU, (uint64_t)0x000787a7756ab550U, (uint64_t)0x0000445bd53058b9U,
+    (uint64_t)0x00019eaf801c2154U, (uint64_t)0x0001be0322c74e42U, (uint64_t)0x00053201cb48f8a9U,
+    (uint64_t)0x00042e4f4ad023a1U, (uint64_t)0x00061eee376f0dc8U, (uint64_t)0x00017efbf8b38931U,
+    (uint64_t)0x0003251e4b970675U, (uint64_t)0x000517806e2abde0U, (uint64_t)0x000629fa3a1464e3U,
+    (uint64_t)0x0001f2abf8d3ed6eU, (uint64_t)0x0004cad2bbbb2831U, (uint64_t)0x0003c99140b4a150U,
+    (uint64_t)0x0000f14bcceff186U, (uint64_t)0x00066a23d657c527U, (uint64_t)0x0002d1acf2194ccfU,
+    (uint64_t)0x0007114d8a25906cU, (uint64_t)0x0004caf6d59c324aU, (uint64_t)0x000390d2cfa230c3U,
+    (uint64_t)0x000601e8430d6319U, (uint64_t)0x0003d12191c75243U, (uint64_t)0x00044e5e9acdfe83U,
+    (uint64_t)0x00030c658bfb78b8U, (uint64_t)0x0007ad78f301fee4U, (uint64_t)0x0003c5e4cda71e2bU,
+    (uint64_t)0x000467965880e34cU, (uint64_t)0x0000d9fc7e9e4f36U, (uint64_t)0x0005293e1510e25eU,
+    (uint64_t)0x0007b555bfa2bc47U, (uint64_t)0x0005dbfe61ffd5c2U, (uint64_t)0x00013dd2778b6c11U,
+    (uint64_t)0x00044c0c6d90670aU, (uint64_t)0x0002abd4f7bcd819U, (uint64_t)0x000688466d633631U,
+    (uint64_t)0x00029e0221d8a5ddU, (uint64_t)0x00053b1cdfe23ed5U, (uint64_t)0x0000af01f575fb05U,
+    (uint64_t)0x000685209f8b0e47U, (uint64_t)0x0001b94022899de8U, (uint64_t)0x0000725c6ab995e8U,
+    (uint64_t)0x0005ca6df45ad963U, (uint64_t)0x0002ec86a5d5f373U, (uint64_t)0x00074658c955ef7aU,
+    (uint64_t)0x0004bb8db4c45551U, (uint64_t)0x0004245dd12f621cU, (uint64_t)0x0004ce669e485beeU,
+    (uint64_t)0x00049581c869b64cU, (uint64_t)0x0000879d26924672U, (uint64_t)0x00008a70dd68f436U,
+    (uint64_t)0x0006e15a6732d550U, (uint64_t)0x0001074ff0267662U, (uint64_t)0x0001efc7e6d5b022U,
+    (uint64_t)0x0000168c1b4274f6U, (uint64_t)0x00025dc041f50b06U, (uint64_t)0x0007614491ed2682U,
+    (uint64_t)0x000299be0decb680U, (uint64_t)0x00026cf566ba49ffU, (uint64_t)0x00076d195c2798eeU,
+    (uint64_t)0x000524546781cec2U, (uint64_t)0x0002ad0a0b1ea1f6U, (uint64_t)0x00072cdb0f5241f7U,
+    (uint64_t)0x00062b362a42fe33U, (uint64_t)0x000039916b8c86c5U, (uint64_t)0x0007a09e842055aaU,
+    (uint64_t)0x0004ac79473c72abU, (uint64_t)0x0003e63c4ae42121U, (uint64_t)0x000680caa79c9678U,
+    (uint64_t)0x0003808f9630a055U, (uint64_t)0x0007b6eb04996f05U, (uint64_t)0x0004464642b82cd2U,
+    (uint64_t)0x0003599286aac87eU, (uint64_t)0x0003c232529483e8U, (uint64_t)0x00006366c466c9a3U,
+    (uint64_t)0x00079fe2de6f62baU, (uint64_t)0x0002b9bb2d49e4f4U, (uint64_t)0x0007231c6668b931U,
+    (uint64_t)0x000287be2808049fU, (uint64_t)0x0001b3fbc705101bU, (uint64_t)0x000518bbed8b8f93U,
+    (uint64_t)0x0004ea28835980c6U, (uint64_t)0x0001eade2fa113b1U, (uint64_t)0x0003ae0a699920a0U,
+    (uint64_t)0x0000b6f00c89ce14U, (uint64_t)0x0001550d0d521e72U, (uint64_t)0x00053254be46b6c0U,
+    (uint64_t)0x0006cc8d8212e6ccU, (uint64_t)0x0004751a911b11e4U, (uint64_t)0x000295d0471399baU,
+    (uint64_t)0x00035b4f1cf85c19U, (uint64_t)0x0001931a42a79935U, (uint64_t)0x0001d502ac295870U,
+    (uint64_t)0x00017508ad074a91U, (uint64_t)0x0000cdf8765489f8U, (uint64_t)0x00059ead4b3ac4f9U,
+    (uint64_t)0x0006ebb635a42a04U, (uint64_t)0x00031ddffcb76711U, (uint64_t)0x000736f0fdfa8836U,
+    (uint64_t)0x0002ba0a110e80edU, (uint64_t)0x0005901cb92128e2U, (uint64_t)0x0006938d00bb08cbU,
+    (uint64_t)0x000221c9b9a258e4U, (uint64_t)0x0002f18301cb23d6U, (uint64_t)0x0003fcc1df2263c2U,
+    (uint64_t)0x0003a9691492e47aU, (uint64_t)0x0000604b4b2b0c9dU, (uint64_t)0x0005075eca6a23baU,
+    (uint64_t)0x0005d57ccf82cd76U, (uint64_t)0x000191ac38152a73U, (uint64_t)0x000527db82fb2d30U,
+    (uint64_t)0x000298d4ffa67db4U, (uint64_t)0x0004af6009911d4fU, (uint64_t)0x0001a6e40365167cU,
+    (uint64_t)0x0002746419610dfdU, (uint64_t)0x000153e95df1a57aU, (uint64_t)0x000022bf1f6cf605U,
+    (uint64_t)0x0001ea69bf6f0ee1U, (uint64_t)0x0007ef2931f0190aU, (uint64_t)0x000080a30905d02aU,
+    (uint64_t)0x0002b8d51e4bc042U, (uint64_t)0x0003ca1c517dfac4U, (uint64_t)0x0003d4b830fd200fU,
+    (uint64_t)0x0007a92bd11bba55U, (uint64_t)0x0006c23a2371bcd6U, (uint64_t)0x00035bcff65a49e6U,
+    (uint64_t)0x0002fbfd0c597d5fU, (uint64_t)0x0001ed4bfcc333a7U, (uint64_t)0x0003506e47909a5fU,
+    (uint64_t)0x0004d66972f03198U, (uint64_t)0x0000286327e683fcU, (uint64_t)0x0001d118b8849c47U,
+    (uint64_t)0x00073d969f556be7U, (uint64_t)0x00033eac59de6037U, (uint64_t)0x000255e3d531c012U,
+    (uint64_t)0x000688883dd7d2bcU, (uint64_t)0x000131534f09ff2dU, (uint64_t)0x00063f3615389d11U,
+    (uint64_t)0x0003683fcba71031U, (uint64_t)0x000202c546ccb866U, (uint64_t)0x00007e7b4570962dU,
+    (uint64_t)0x000715e4d1647212U, (uint64_t)0x0003a4ba693d760aU, (uint64_t)0x0007961ef3ecbb5dU,
+    (uint64_t)0x0000241543ff2f21U, (uint64_t)0x00008a085d8ae874U, (uint64_t)0x00017e8ba6de5d32U,
+    (uint64_t)0x000438b99022fc52U, (uint64_t)0x000423c9a1f4d50eU, (uint64_t)0x00023a5096d52e41U,
+    (uint64_t)0x00076a86a9de64d9U, (uint64_t)0x0006bcb921c38224U, (uint64_t)0x00064b52040fc598U,
+    (uint64_t)0x0006ac0f0ebd57beU, (uint64_t)0x00020575ae346ecbU, (uint64_t)0x0005775567b00914U,
+    (uint64_t)0x000659a612e62254U, (uint64_t)0x0006b265507695b3U, (uint64_t)0x00032951a7d46b30U,
+    (uint64_t)0x0005f0454eaf5f3cU, (uint64_t)0x00075600ae647758U, (uint64_t)0x0005fee54e8a8f33U,
+    (uint64_t)0x0003f7f093597aceU, (uint64_t)0x0005802e669e434bU, (uint64_t)0x0004c30a012877cfU,
+    (uint64_t)0x000219a698b0a420U, (uint64_t)0x00079267db8cc90fU, (uint64_t)0x0007eb2b724d0599U,
+    (uint64_t)0x00003c41cb05dc3fU, (uint64_t)0x0004732705808479U, (uint64_t)0x00071ccb4fe555a3U,
+    (uint64_t)0x00066f2e8dea7d5fU, (uint64_t)0x00075d942c04210dU, (uint64_t)0x0005c4874e35ab2dU,
+    (uint64_t)0x0005a8f4848cf2ecU, (uint64_t)0x00045cc72fce38feU, (uint64_t)0x00009e47ebf162bbU,
+    (uint64_t)0x000696cc14856cdcU, (uint64_t)0x0001588c9993c204U, (uint64_t)0x000310b07abc62b0U,
+    (uint64_t)0x0007dd0ce1a13228U, (uint64_t)0x0004db508b69bfe2U, (uint64_t)0x0006875393b8686cU,
+    (uint64_t)0x0000a57b885fae14U, (uint64_t)0x00048bd176421bf2U, (uint64_t)0x0006483f528f0c5cU,
+    (uint64_t)0x0006bb56ad0c8d30U, (uint64_t)0x0006d12e0dd1cd8bU, (uint64_t)0x0004a3028f70bd8eU,
+    (uint64_t)0x0006fb588ceb49a4U, (uint64_t)0x000015e96e043c83U, (uint64_t)0x0003c01505c1b392U,
+    (uint64_t)0x0000d5c9e4b74fdeU, (uint64_t)0x00066fd9da4da844U, (uint64_t)0x00036bcc17efb8baU,
+    (uint64_t)0x00067c9966e620bbU, (uint64_t)0x0002e8b510b2d23fU, (uint64_t)0x0003211cabda755bU,
+    (uint64_t)0x00039f2d199b0017U, (uint64_t)0x000689cd6da39047U, (uint64_t)0x00004ee67cfea426U,
+    (uint64_t)0x00044f62eac8c288U, (uint64_t)0x0007d04264e36e88U, (uint64_t)0x0003319ae930f866U,
+    (uint64_t)0x0002b7f27fb1bc34U, (uint64_t)0x00068ccfeaf09e3cU, (uint64_t)0x00013fce3bbcbc54U,
+    (uint64_t)0x0006cc9f269424b8U, (uint64_t)0x000622632f5cf734U, (uint64_t)0x00041b729f82a329U,
+    (uint64_t)0x00010c6c2b8eaa2dU, (uint64_t)0x0006bed58531e5ceU, (uint64_t)0x0003770c16884960U,
+    (uint64_t)0x0003fba21f5fd594U, (uint64_t)0x0005a41f0680fc3dU, (uint64_t)0x00060684b418c206U,
+    (uint64_t)0x0000d78588e79b4aU, (uint64_t)0x00016c1556c9a2bcU, (uint64_t)0x000335745ef14f36U,
+    (uint64_t)0x0003d719e23ae502U, (uint64_t)0x0005ced6e016ce4fU, (uint64_t)0x0007c48f0cd6f5f4U,
+    (uint64_t)0x00023e38cd5158b0U, (uint64_t)0x0004c62395a6a828U, (uint64_t)0x00046c4d62fbe1c3U,
+    (uint64_t)0x00079e89f4bc2231U, (uint64_t)0x0003fec90ae2a81fU, (uint64_t)0x00029b8d1dc2095bU,
+    (uint64_t)0x00011af2b10518f5U, (uint64_t)0x0001b54232605b64U, (uint64_t)0x00063b6355b3ae8cU,
+    (uint64_t)0x0000634abcb5fe74U, (uint64_t)0x0001723bcb3e1d15U, (uint64_t)0x000689807682b3eaU,
+    (uint64_t)0x000769004a1eaadcU, (uint64_t)0x0001faf5e2abddd7U, (uint64_t)0x000591a01cc06d86U,
+    (uint64_t)0x0005d4ba682e08ebU, (uint64_t)0x00068fd67e2023deU, (uint64_t)0x0002e9ed9bc7b243U,
+    (uint64_t)0x0007f1df90e7267bU, (uint64_t)0x000157278332427aU, (uint64_t)0x00020cae63fed27aU,
+    (uint64_t)0x00070fe618e77933U, (uint64_t)0x00009554f402b26aU, (uint64_t)0x00057a55d0c13effU,
+    (uint64_t)0x0005807222ada534U, (uint64_t)0x000456bdf4c7423eU, (uint64_t)0x00050b42c46c2997U,
+    (uint64_t)0x0002e6936b85381bU, (uint64_t)0x0001d18e01e71f42U, (uint64_t)0x00043e15d81bc772U,
+    (uint64_t)0x000579782c36c68eU, (uint64_t)0x0003e5303a1908edU, (uint64_t)0x000223ca96fd7b4bU,
+    (uint64_t)0x0003cbb225620e5fU, (uint64_t)0x0001edb635aaf657U, (uint64_t)0x00005dacf0f0de7cU,
+    (uint64_t)0x0006a339f4412193U, (uint64_t)0x00050756eb9eb0a5U, (uint64_t)0x0001767916351622U,
+    (uint64_t)0x0001089da2b5dd8bU, (uint64_t)0x0002269a46cdf0aaU, (uint64_t)0x00068f85514c514eU,
+    (uint64_t)0x0007083ffbf804f6U, (uint64_t)0x0000b87e873a8780U, (uint64_t)0x0003f90dc508ececU,
+    (uint64_t)0x000489cf3771fa99U, (uint64_t)0x0007104537cc4644U, (uint64_t)0x0003e2bd1ee75986U,
+    (uint64_t)0x00017237036bf469U, (uint64_t)0x0007531eb776369dU, (uint64_t)0x00066a9b0dab2743U,
+    (uint64_t)0x0003804bb683be22U, (uint64_t)0x0003733debc4886dU, (uint64_t)0x00000cee3497f2a2U,
+    (uint64_t)0x0005bb4af39f15caU, (uint64_t)0x00066e632db15cc9U, (uint64_t)0x0002d6a6134af084U,
+    (uint64_t)0x00038fdec0e8d27fU, (uint64_t)0x0001239e9bd979b5U, (uint64_t)0x000660c87ff50378U,
+    (uint64_t)0x000534e3c9c194ccU, (uint64_t)0x00004ddf8800db95U, (uint64_t)0x000087757b94c4a7U,
+    (uint64_t)0x0001ee594a87a541U, (uint64_t)0x0006e1e26ab17c47U, (uint64_t)0x0007a4def7f4f0ccU,
+    (uint64_t)0x000309b7ada7ee07U, (uint64_t)0x00043cb957e9c921U, (uint64_t)0x0003cd9f56bf9b98U,
+    (uint64_t)0x00002d3dc9be3f67U, (uint64_t)0x0007511066c0e121U, (uint64_t)0x0006a33ba386fcd5U,
+    (uint64_t)0x000626dee17f6147U, (uint64_t)0x00029c02ddc3696eU, (uint64_t)0x00065e544247c46dU,
+    (uint64_t)0x000604df365b8391U, (uint64_t)0x0003a94bd5bcbc2fU, (uint64_t)0x000619fac8d6ace9U,
+    (uint64_t)0x00049513fcb27238U, (uint64_t)0x000185cdb43c881fU, (uint64_t)0x0003bcd60e9533cbU,
+    (uint64_t)0x0001d26ae8619807U, (uint64_t)0x0000e30b7aa4a930U, (uint64_t)0x0002b51a914548d7U,
+    (uint64_t)0x0005c88c2fe4868cU, (uint64_t)0x000668d5960c0b43U, (uint64_t)0x0006246e53791b03U,
+    (uint64_t)0x000110a12b1b2af5U, (uint64_t)0x000045378ad74e89U, (uint64_t)0x000058f49e437341U,
+    (uint64_t)0x0007a66f757c2190U, (uint64_t)0x00013d7c92bd0558U, (uint64_t)0x00046d4010b9a2afU,
+    (uint64_t)0x00050fa079405f35U, (uint64_t)0x000400a8cd97a6fcU, (uint64_t)0x0005f3e6d4330674U,
+    (uint64_t)0x0002d8352e175264U, (uint64_t)0x000601e11692d66cU, (uint64_t)0x00004aa7039c9423U,
+    (uint64_t)0x000107f06a461a90U, (uint64_t)0x000158af2b748828U, (uint64_t)0x0002530bd1561746U,
+    (uint64_t)0x000519a6f2a4a98eU, (uint64_t)0x0004ebbb5934b808U, (uint64_t)0x00040ebebae7fd41U,
+    (uint64_t)0x000627e7cd734b03U, (uint64_t)0x0007dc5669f01dddU, (uint64_t)0x0002cb0b0cafa1e3U,
+    (uint64_t)0x0003d720fe91031aU, (uint64_t)0x000067e8ed1ec00aU, (uint64_t)0x000797150adf0663U,
+    (uint64_t)0x000522d70389e30fU, (uint64_t)0x0005b3d1b69953f2U, (uint64_t)0x00041d648637fe5dU,
+    (uint64_t)0x0003227c2f1681f7U, (uint64_t)0x0005089c58085e74U, (uint64_t)0x000186248653d88bU,
+    (uint64_t)0x0001d8641f402a45U, (uint64_t)0x000250d1eeb72e55U, (uint64_t)0x000020cb7d3d5b98U,
+    (uint64_t)0x00050cab959cb2b6U, (uint64_t)0x00030b59df367e13U, (uint64_t)0x00044c9fa894c6d2U,
+    (uint64_t)0x00001d73bb2b6a8eU, (uint64_t)0x0001dd0759ea2ed3U, (uint64_t)0x00039c2a209ade34U,
+    (uint64_t)0x000140abde7555f6U, (uint64_t)0x0004ad61ed9ff36bU, (uint64_t)0x0007923661b7033aU,
+    (uint64_t)0x0001ca1d9b3e7636U, (uint64_t)0x0007d5f6473e7c2fU, (uint64_t)0x0001179993df2540U,
+    (uint64_t)0x0002aef6937c200cU, (uint64_t)0x0005418fd61513e1U, (uint64_t)0x00017312d93ebeacU,
+    (uint64_t)0x0003c49c73bc2ba8U, (uint64_t)0x00074f00b58a53f6U, (uint64_t)0x0002bbf59bc314c4U,
+    (uint64_t)0x00017bda068eb061U, (uint64_t)0x00020a0e33fcf9d5U, (uint64_t)0x0005e228e1b1e1abU,
+    (uint64_t)0x00024e97e3f868a1U, (uint64_t)0x000621f1173b4625U, (uint64_t)0x000507b0c7fb94ceU,
+    (uint64_t)0x00029e4c0eedfc23U, (uint64_t)0x0005dde3f530354cU, (uint64_t)0x000484800427a7c8U,
+    (uint64_t)0x00026e9045f15da5U, (uint64_t)0x00033841231904d2U, (uint64_t)0x00079b14e162e6f5U,
+    (uint64_t)0x000759527498e0c4U, (uint64_t)0x00066a81ef8b10e8U, (uint64_t)0x0002c5c7978b126dU,
+    (uint64_t)0x0007122ca7a7e681U, (uint64_t)0x00040d8d008623a1U, (uint64_t)0x00041294922881baU,
+    (uint64_t)0x0007f4fbb4aa85b4U, (uint64_t)0x0000c579767ffb50U, (uint64_t)0x00008213dfcd1205U,
+    (uint64_t)0x00068281deb8486dU, (uint64_t)0x0003d5a995a523d9U, (uint64_t)0x0004b566edf58220U,
+    (uint64_t)0x00055894c276321dU, (uint64_t)0x0007ad74afff357dU, (uint64_t)0x0000d3a9a539d392U,
+    (uint64_t)0x000706663d330b1dU, (uint64_t)0x000133a22f640de1U, (uint64_t)0x00065cc9588f9859U,
+    (uint64_t)0x00045a43b2a1c67eU, (uint64_t)0x00053b020b63f8adU, (uint64_t)0x000790215a917ebaU,
+    (uint64_t)0x00021b23789b5bc2U, (uint64_t)0x000313614bf29107U, (uint64_t)0x0003ffd8454db8aeU,
+    (uint64_t)0x0000400166213ee3U, (uint64_t)0x0000761affb1e0d4U, (uint64_t)0x0006a170812fe6b0U,
+    (uint64_t)0x0000e5988f808725U, (uint64_t)0x0006b25da56d2916U, (uint64_t)0x00029dbe21081636U,
+    (uint64_t)0x0003a6d110e60701U, (uint64_t)0x00016b9b1b499715U, (uint64_t)0x0004ff57aba1c1f5U,
+    (uint64_t)0x000385b66acef2fbU, (uint64_t)0x000435281d6122c2U, (uint64_t)0x0005d6c9bb1ec4a5U,
+    (uint64_t)0x0003d525e99d4787U, (uint64_t)0x0000b4f0bbef08fcU, (uint64_t)0x000469e57d31e97aU,
+    (uint64_t)0x0006ce5014595179U, (uint64_t)0x00028bd38d44030dU, (uint64_t)0x00041d6d78d5bbfcU,
+    (uint64_t)0x000748889556933aU, (uint64_t)0x0002e666d3fb606dU, (uint64_t)0x0001b99d69e273e6U,
+    (uint64_t)0x000552dd7405c418U, (uint64_t)0x00035f5b89a6dbe4U, (uint64_t)0x0006851f5995c8f8U,
+    (uint64_t)0x000412fc66d6f9e4U, (uint64_t)0x0007ae43f5941e7bU, (uint64_t)0x0006cc234a1107dcU,
+    (uint64_t)0x0007dce55f7be126U, (uint64_t)0x00044884d4f42fa7U, (uint64_t)0x0006d7c5f63f008cU,
+    (uint64_t)0x0007baea0cbda388U, (uint64_t)0x0000ec8fe27a51e6U, (uint64_t)0x00052cefab3d11d3U,
+    (uint64_t)0x000570264f87b63dU, (uint64_t)0x000701ecf073e3f9U, (uint64_t)0x00053fbb3adc6fb0U,
+    (uint64_t)0x0003de83daf93d8aU, (uint64_t)0x000791aa0e554129U, (uint64_t)0x0006a23907baf00dU,
+    (uint64_t)0x0003295c90831a9cU, (uint64_t)0x000663e9b22448c5U, (uint64_t)0x00014ae37c7970d0U,
+    (uint64_t)0x00027eb68d4e5bfdU, (uint64_t)0x00022d2099ddf370U, (uint64_t)0x0006d54a83bffd49U,
+    (uint64_t)0x00066b6f17af0bbcU, (uint64_t)0x000190bb443a02d3U, (uint64_t)0x0006f417484861c0U,
+    (uint64_t)0x000645fd45aa2313U, (uint64_t)0x00022edc528f83cbU, (uint64_t)0x0000aee0c0fa981dU,
+    (uint64_t)0x0005a601f5562397U, (uint64_t)0x00024c246b2456daU, (uint64_t)0x0006519c7abc393cU,
+    (uint64_t)0x0002fbe77b018afcU, (uint64_t)0x00056c474318798aU, (uint64_t)0x00047f03cc04f3dcU,
+    (uint64_t)0x0005db6c768a89e5U, (uint64_t)0x0005cb33ae4b6149U, (uint64_t)0x0003eb8df0618d8dU,
+    (uint64_t)0x0003d2fa46d0edf1U, (uint64_t)0x000393fb3d0b216dU, (uint64_t)0x000776f56c0960ceU,
+    (uint64_t)0x000298f2c7500482U, (uint64_t)0x000016d7bdafdcbaU, (uint64_t)0x0002ed28bde9f7cbU,
+    (uint64_t)0x0004e2107bc67440U, (uint64_t)0x0004d19e16c81fe1U, (uint64_t)0x0006ab74970cb7f4U,
+    (uint64_t)0x000614fc7f5308e3U, (uint64_t)0x0000f885f239268eU, (uint64_t)0x00051637af036999U,
+    (uint64_t)0x00069d00957c9907U, (uint64_t)0x0002660e070fd1e1U, (uint64_t)0x0006793524f516a2U,
+    (uint64_t)0x0005777daf72d122U, (uint64_t)0x00030d3831392a57U, (uint64_t)0x0005cc64cff559b9U,
+    (uint64_t)0x00064453c75f705dU, (uint64_t)0x0005800bb22610feU, (uint64_t)0x00040e73ee010047U,
+    (uint64_t)0x00050e644a29bc85U, (uint64_t)0x000658955f472291U, (uint64_t)0x0002545234028e4cU,
+    (uint64_t)0x00046d3baa2e2872U, (uint64_t)0x00015bfdb99cddddU, (uint64_t)0x0007c10011013479U,
+    (uint64_t)0x00073d7b00d6838cU, (uint64_t)0x000372af3f3d7ba3U, (uint64_t)0x0005fe45b35dbf2eU,
+    (uint64_t)0x0002f823d692b6e4U, (uint64_t)0x00018b612324ccfbU, (uint64_t)0x0003d75788f5a8bfU,
+    (uint64_t)0x0006c1a1a3b440aaU, (uint64_t)0x0002cf4d85d1d3c5U, (uint64_t)0x00063ee89401b498U,
+    (uint64_t)0x0004b6dafa36309cU, (uint64_t)0x0005cdfc76d8c498U, (uint64_t)0x0002766f17b412b6U,
+    (uint64_t)0x0000be288bb8c62bU, (uint64_t)0x0000ebd14fb32a68U, (uint64_t)0x00074b32dd64306fU,
+    (uint64_t)0x0007b2eca0b600c4U, (uint64_t)0x0007cc0e78963ab0U, (uint64_t)0x000184246ccec92fU,
+    (uint64_t)0x0003b54e750110bbU, (uint64_t)0x0006e847af3ae326U, (uint64_t)0x000199f7a2182148U,
+    (uint64_t)0x0001bd722e8edc1bU, (uint64_t)0x0006eed3a0e99d47U, (uint64_t)0x00034de4aad941b2U,
+    (uint64_t)0x000362ea253baea2U, (uint64_t)0x00004438a7c1156fU, (uint64_t)0x0005450a615813baU,
+    (uint64_t)0x00068fa854ea3797U, (uint64_t)0x00009b968038e14aU, (uint64_t)0x00027ed44b7ad467U,
+    (uint64_t)0x0002deb9216f73e9U, (uint64_t)0x0004620632fd6fa4U, (uint64_t)0x00063facdf1b87aaU,
+    (uint64_t)0x0007073220ef2c21U, (uint64_t)0x0001edff13d99073U, (uint64_t)0x00020617c243adf8U,
+    (uint64_t)0x0002e319b0d53c9cU, (uint64_t)0x0000274999d321e3U, (uint64_t)0x000131536578d28cU,
+    (uint64_t)0x0002e42eb00cbc19U, (uint64_t)0x0004c98f03983180U, (uint64_t)0x000114ba79bd01ebU,
+    (uint64_t)0x0003879f2c9bbdf0U, (uint64_t)0x00024c51112c9655U, (uint64_t)0x000017c80741add0U,
+    (uint64_t)0x0001132c34ff961fU, (uint64_t)0x000677d0b1215964U, (uint64_t)0x0002be5f787a79c2U,
+    (uint64_t)0x0006a044a47b984bU, (uint64_t)0x0005830f025f1078U, (uint64_t)0x000717e25793d41eU,
+    (uint64_t)0x0000406aa79573bcU, (uint64_t)0x0000c0795b6cacbeU, (uint64_t)0x0001fff337239217U,
+    (uint64_t)0x00067d451752c243U, (uint64_t)0x000133e47f92480bU, (uint64_t)0x0005e16ced41ff62U,
+    (uint64_t)0x00011ec3f2ddabc7U, (uint64_t)0x000084089dba2c67U, (uint64_t)0x0007ccd179cfce91U,
+    (uint64_t)0x0004e15da1d9062bU, (uint64_t)0x000538d34783da3eU, (uint64_t)0x00036301e04c4cacU,
+    (uint64_t)0x0004e4d4cf168b8bU, (uint64_t)0x00019929124ab577U, (uint64_t)0x000175a69ca1fb69U,
+    (uint64_t)0x000088480e6c0fa9U, (uint64_t)0x00041079e654284fU, (uint64_t)0x0004060f4dccca41U,
+    (uint64_t)0x00052c0cbef541feU, (uint64_t)0x0001919dd037f7f0U, (uint64_t)0x00046c95f539afaeU,
+    (uint64_t)0x00079a2fafff96a5U, (uint64_t)0x000590caa3a860bbU, (uint64_t)0x00064ab933fc626aU,
+    (uint64_t)0x0003720f2c76158fU, (uint64_t)0x00054598b784e873U, (uint64_t)0x0001658af745782bU,
+    (uint64_t)0x0005929eccd5cb86U, (uint64_t)0x000633198a5af64eU, (uint64_t)0x00040de64a7b0c18U,
+    (uint64_t)0x0007a060f97789b8U, (uint64_t)0x00030a09a3c7b09cU, (uint64_t)0x00073b47904223a0U,
+    (uint64_t)0x0000888e9e9da049U, (uint64_t)0x00030eda28e403f4U, (uint64_t)0x00027d41a639ac6bU,
+    (uint64_t)0x0007b21047331706U, (uint64_t)0x00041991129c809dU, (uint64_t)0x00040316e927f1b8U,
+    (uint64_t)0x00028737a1738914U, (uint64_t)0x000345db23b9ef4dU, (uint64_t)0x000673c301d3b59cU,
+    (uint64_t)0x0000bddf846fee99U, (uint64_t)0x0000849c9e6da66dU, (uint64_t)0x00060ab0555edde9U,
+    (uint64_t)0x00001a85cb49843bU, (uint64_t)0x000313c5ea495ceaU, (uint64_t)0x0001c96497d7a016U,
+    (uint64_t)0x00009f4dcbc5ae50U, (uint64_t)0x0005a0c66de39ef7U, (uint64_t)0x0003f84d9b86cb39U,
+    (uint64_t)0x0005f0d5cf58fd2aU, (uint64_t)0x00065c28aa2d1993U, (uint64_t)0x0007d767b87e11e7U,
+    (uint64_t)0x0005cd31fd1e41bfU, (uint64_t)0x00059b5fd0d0b914U, (uint64_t)0x000340e41ce5965bU,
+    (uint64_t)0x00066ef688d92dc4U, (uint64_t)0x0001deb18e4d05b2U, (uint64_t)0x00020912f604fd5fU,
+    (uint64_t)0x00042b3fcd320750U, (uint64_t)0x00002a01c840d23cU, (uint64_t)0x000220cb51fa5db5U,
+    (uint64_t)0x0004ac1d5c8cb78eU, (uint64_t)0x00010862f0c3836dU, (uint64_t)0x00007ca3d95f5debU,
+    (uint64_t)0x00042905ccbf2747U, (uint64_t)0x0004ab664f3492fcU, (uint64_t)0x0005f2104dbe6c22U,
+    (uint64_t)0x000086057c2be1f3U, (uint64_t)0x0007d1f695a95270U, (uint64_t)0x000747bf37f43265U,
+    (uint64_t)0x000220899a34967fU, (uint64_t)0x0001e0990d03bcf6U, (uint64_t)0x000245e680d6459dU,
+    (uint64_t)0x0000e68b9542be95U, (uint64_t)0x00058a109a328a66U, (uint64_t)0x0002f5296014db3eU,
+    (uint64_t)0x0000ea9350f1881fU, (uint64_t)0x000097da145ad9c1U, (uint64_t)0x0005065ee1575abfU,
+    (uint64_t)0x0003a70f66e81394U, (uint64_t)0x0007ea568c2acdfeU, (uint64_t)0x00004162601f4748U,
+    (uint64_t)0x0003d3fb9791b943U, (uint64_t)0x0003d4aae98c1e45U, (uint64_t)0x0001b7a57195d8e8U,
+    (uint64_t)0x0004622b7eac6924U, (uint64_t)0x0001cb7a40c1d8d4U, (uint64_t)0x0006dbaec67ef776U,
+    (uint64_t)0x0002493599c90707U, (uint64_t)0x000733b30c4de9a5U, (uint64_t)0x00008e9020d152b0U,
+    (uint64_t)0x0002835019689be9U, (uint64_t)0x00041f9a96aec874U, (uint64_t)0x0003d04dd051341fU,
+    (uint64_t)0x0007feac979bfac7U, (uint64_t)0x0003568e249fb3d5U, (uint64_t)0x000013108548efa2U,
+    (uint64_t)0x0007946d7c7220e7U, (uint64_t)0x00065e3c6a888a4bU, (uint64_t)0x00024ab83d18dac2U,
+    (uint64_t)0x0006d8bcb74eb874U, (uint64_t)0x00003dec05fa937aU, (uint64_t)0x0004271cc6375515U,
+    (uint64_t)0x0000949949e28da3U, (uint64_t)0x00056bf0e5189623U, (uint64_t)0x00017ab48894ff72U,
+    (uint64_t)0x00015949f784d847U, (uint64_t)0x0001e510afad0049U, (uint64_t)0x00000e7730c1d7b1U,
+    (uint64_t)0x000402be75347c23U, (uint64_t)0x00038a03b8b74596U, (uint64_t)0x00070d685f68f859U
+  };
+
+/*
+  [2j + 1]B for j = 0..63, the odd multiples used by the width-8 NAF in
+  verification, in the same (x, y, xy) format.
+*/
+static const
+uint64_t
+Hacl_Ed25519_PrecompTable_precomp_basepoint_table_odd_w8[960U] =
+  {
+    (uint64_t)0x00062d608f25d51aU, (uint64_t)0x000412a4b4f6592aU, (uint64_t)0x00075b7171a4b31dU,
+    (uint64_t)0x0001ff60527118feU, (uint64_t)0x000216936d3cd6e5U, (uint64_t)0x0006666666666658U,
+    (uint64_t)0x0004ccccccccccccU, (uint64_t)0x0001999999999999U, (uint64_t)0x0003333333333333U,
+    (uint64_t)0x0006666666666666U, (uint64_t)0x00068ab3a5b7dda3U, (uint64_t)0x00000eea2a5eadbbU,
+    (uint64_t)0x0002af8df483c27eU, (uint64_t)0x000332b375274732U, (uint64_t)0x00067875f0fd78b7U,
+    (uint64_t)0x0002485fd3f8e25cU, (uint64_t)0x0003302c4910d58cU, (uint64_t)0x00036b20e98d0e60U,
+    (uint64_t)0x0007a48ffa573a1fU, (uint64_t)0x00067ae9c4a22928U, (uint64_t)0x0003684878f5b4d4U,
+    (uint64_t)0x0002ece480608058U, (uint64_t)0x00009a7bde7c5bb0U, (uint64_t)0x0004d5d09350c730U,
+    (uint64_t)0x0001267b1d177ee6U, (uint64_t)0x000108fa78b3a41aU, (uint64_t)0x00017f62df8959bfU,
+    (uint64_t)0x0006e4549d709cd6U, (uint64_t)0x00028875f79bc1d6U, (uint64_t)0x0002a4d025cb1dd9U,
+    (uint64_t)0x00009cc0322ef233U, (uint64_t)0x000727c37c34b228U, (uint64_t)0x0004b6977970a067U,
+    (uint64_t)0x00043dfe77be7be8U, (uint64_t)0x00049fda73eade35U, (uint64_t)0x00021f83d676c8edU,
+    (uint64_t)0x00015128616ba21aU, (uint64_t)0x0006491998c4a0bbU, (uint64_t)0x000737f016370a44U,
+    (uint64_t)0x0005f4825b298feaU, (uint64_t)0x000150bcf3e801d0U, (uint64_t)0x0000a00124d7ec83U,
+    (uint64_t)0x0004db1fe6bee53aU, (uint64_t)0x0006a618b0752843U, (uint64_t)0x000745c562c9c593U,
+    (uint64_t)0x0005981af50e4107U, (uint64_t)0x0006777e39d2ab0aU, (uint64_t)0x000476041e0fa027U,
+    (uint64_t)0x0006a774f1f70ca5U, (uint64_t)0x00014568685fcf4bU, (uint64_t)0x0004c4b59f4062b8U,
+    (uint64_t)0x0000def57e47a258U, (uint64_t)0x0004dab507c220adU, (uint64_t)0x000297c3e732346eU,
+    (uint64_t)0x00031c563e32b47dU, (uint64_t)0x000545565587ed1bU, (uint64_t)0x000543d3549c8217U,
+    (uint64_t)0x000756ead14a518cU, (uint64_t)0x00070dcdf416e2c4U, (uint64_t)0x000119e77b11d165U,
+    (uint64_t)0x000023065185715cU, (uint64_t)0x000385c9c0529a7cU, (uint64_t)0x0006508ae21b6039U,
+    (uint64_t)0x0000b28df99b7037U, (uint64_t)0x000357cc970c8007U, (uint64_t)0x000644845522f1c0U,
+    (uint64_t)0x0002646dc88618e9U, (uint64_t)0x0003cb4bf47de240U, (uint64_t)0x0006fa595f7e74abU,
+    (uint64_t)0x0007f3d23c2c2dd0U, (uint64_t)0x0003386f88b2f465U, (uint64_t)0x00041eee064fcb87U,
+    (uint64_t)0x00051f35d05ecf52U, (uint64_t)0x0005fcedb33b56fbU, (uint64_t)0x0005c70fc48ea87cU,
+    (uint64_t)0x0007d2c1207cf3cbU, (uint64_t)0x000658b27aaa5fe5U, (uint64_t)0x0001c490e34e0696U,
+    (uint64_t)0x00020bdb6783c6ebU, (uint64_t)0x00014e528b1154beU, (uint64_t)0x00072dc36a033713U,
+    (uint64_t)0x000387938b1a8611U, (uint64_t)0x0003fc3f38496164U, (uint64_t)0x0005cbad37be71a0U,
+    (uint64_t)0x0002d9082313f21aU, (uint64_t)0x0005cf2edb5beed4U, (uint64_t)0x0003bc31f906fd70U,
+    (uint64_t)0x00005ab6fd640007U, (uint64_t)0x0004511ce5535f79U, (uint64_t)0x0005ae6a565800f2U,
+    (uint64_t)0x0000e073b7c05fedU, (uint64_t)0x000511a456f706f0U, (uint64_t)0x0000b4c13e210f8fU,
+    (uint64_t)0x0003666d99d6f814U, (uint64_t)0x000107427e0d5f36U, (uint64_t)0x0007e1aeea401f80U,
+    (uint64_t)0x0006451344e470fdU, (uint64_t)0x00036a26e0dd033eU, (uint64_t)0x0005ba3c23301169U,
+    (uint64_t)0x00012dbb00ded538U, (uint64_t)0x0004dccde8de2f53U, (uint64_t)0x00023d65d1df8a45U,
+    (uint64_t)0x0005588ce16c52a9U, (uint64_t)0x00023062e06eb0e6U, (uint64_t)0x000412806b917be6U,
+    (uint64_t)0x00017f3e66a18dc1U, (uint64_t)0x00068ee03139720cU, (uint64_t)0x000481067b658c4dU,
+    (uint64_t)0x00021aee2d637caeU, (uint64_t)0x0004f162deaec2ecU, (uint64_t)0x00054cc4ad2e5cdfU,
+    (uint64_t)0x000314335354328dU, (uint64_t)0x00034a4cc6b396bcU, (uint64_t)0x00017aa8b17b80b2U,
+    (uint64_t)0x00012cbfb2d04ff2U, (uint64_t)0x00057f335c92bf29U, (uint64_t)0x0001fc815cbea281U,
+    (uint64_t)0x0005d8378be98edaU, (uint64_t)0x000248d5927e9120U, (uint64_t)0x0005e33f00e36b77U,
+    (uint64_t)0x00017853a876df6aU, (uint64_t)0x000370b44169b8abU, (uint64_t)0x0003f5ca46365261U,
+    (uint64_t)0x000374dc283a0f51U, (uint64_t)0x0007dc52d5a7db81U, (uint64_t)0x0004fe9bec97be04U,
+    (uint64_t)0x000647669f2039adU, (uint64_t)0x0002467edc5ec621U, (uint64_t)0x00077cf9256122e6U,
+    (uint64_t)0x0006f6d2bca60003U, (uint64_t)0x0003b596c3b3053fU, (uint64_t)0x0004417537ed1fb7U,
+    (uint64_t)0x0001dbac02dcff6aU, (uint64_t)0x000253a2ac865570U, (uint64_t)0x00025031aba502c0U,
+    (uint64_t)0x00011a3a04a94472U, (uint64_t)0x0004a608d2dce9efU, (uint64_t)0x00058ee706c38a06U,
+    (uint64_t)0x000638117460a06bU, (uint64_t)0x0001d81f74a5ba45U, (uint64_t)0x00066102691d55b9U,
+    (uint64_t)0x000047e86be6107fU, (uint64_t)0x00075973d0b860c2U, (uint64_t)0x0001a3913e2ddb6eU,
+    (uint64_t)0x0003f185a93d95a4U, (uint64_t)0x00040427c5001131U, (uint64_t)0x0004a37ca6aa5178U,
+    (uint64_t)0x000453fbe507cc27U, (uint64_t)0x00006f3fd2467682U, (uint64_t)0x00066fd9c161a725U,
+    (uint64_t)0x00063e7ef9365716U, (uint64_t)0x0003bbc7a0e7988bU, (uint64_t)0x0001d507b7c94b2cU,
+    (uint64_t)0x000743cac2c47ceaU, (uint64_t)0x0006f0ac78e5eb90U, (uint64_t)0x00066051336d289eU,
+    (uint64_t)0x0000b8fb14addff8U, (uint64_t)0x0003e330d6b81b57U, (uint64_t)0x000572f991f2eefaU,
+    (uint64_t)0x0006628d116b7975U, (uint64_t)0x0003f0b078fc0a26U, (uint64_t)0x0003042e7e1aa93dU,
+    (uint64_t)0x0006e7e56d0ffce7U, (uint64_t)0x0001704eee838b66U, (uint64_t)0x000471fb40987791U,
+    (uint64_t)0x000798b2d2e14d95U, (uint64_t)0x0000bb36f985956aU, (uint64_t)0x0000a8e46f2be47cU,
+    (uint64_t)0x0005ab12c8af0291U, (uint64_t)0x0002188ac423c67dU, (uint64_t)0x000579782b33c0eeU,
+    (uint64_t)0x0003f4926d356cc7U, (uint64_t)0x00011b9414109decU, (uint64_t)0x0003cd26fb4d11feU,
+    (uint64_t)0x00023240c559c57bU, (uint64_t)0x0000fdc89f9d12dbU, (uint64_t)0x0007411c616236bcU,
+    (uint64_t)0x0004160dd48c981aU, (uint64_t)0x00053580a228db95U, (uint64_t)0x000494b54f636077U,
+    (uint64_t)0x0001362c36353455U, (uint64_t)0x0005d97045b80d63U, (uint64_t)0x0002e1e43f2a6154U,
+    (uint64_t)0x000758049c259b86U, (uint64_t)0x000794241471ed9cU, (uint64_t)0x0002bc68d311dcd0U,
+    (uint64_t)0x0001507e6f12246cU, (uint64_t)0x0003ba3e764b5e68U, (uint64_t)0x00053903bb97468cU,
+    (uint64_t)0x00071e918c03cdfcU, (uint64_t)0x0000f270b57a6218U, (uint64_t)0x0004b17b69eb6bd2U,
+    (uint64_t)0x0006d7b3298eb9dbU, (uint64_t)0x0004fc647ae378b3U, (uint64_t)0x000484e314e6003cU,
+    (uint64_t)0x00011d8f5a7f8079U, (uint64_t)0x0006c1543a9ce52cU, (uint64_t)0x00041eeea4ea22d0U,
+    (uint64_t)0x00062ed11e2e0290U, (uint64_t)0x000163bc180c22dfU, (uint64_t)0x0001498677501939U,
+    (uint64_t)0x00035f000709b75cU, (uint64_t)0x00002953d8e32883U, (uint64_t)0x0003a2c0ca5cbb35U,
+    (uint64_t)0x000631107a6ba83fU, (uint64_t)0x0002d774fa728050U, (uint64_t)0x000365b131cce157U,
+    (uint64_t)0x00066ac51bb93766U, (uint64_t)0x000230de42f41ddeU, (uint64_t)0x000337ed9cc25beaU,
+    (uint64_t)0x000663b5db0f7a5dU, (uint64_t)0x00016c34753cf3b6U, (uint64_t)0x0002b38f68e242c9U,
+    (uint64_t)0x0006d075bf1c81dcU, (uint64_t)0x00039a32a30f3eb1U, (uint64_t)0x000203715d67c491U,
+    (uint64_t)0x0005e68b04626dbaU, (uint64_t)0x000401177200f05aU, (uint64_t)0x0000e4d0d7ce5000U,
+    (uint64_t)0x0004d4c54675dc1fU, (uint64_t)0x000558acfa92d128U, (uint64_t)0x000107215c854b23U,
+    (uint64_t)0x0002f3639c43bf13U, (uint64_t)0x0002d6c1130ed133U, (uint64_t)0x0001dc74666facd2U,
+    (uint64_t)0x0000e4658efac0e9U, (uint64_t)0x000324be23ff2b1cU, (uint64_t)0x0005645455e134d6U,
+    (uint64_t)0x00018face19fe673U, (uint64_t)0x00038085391a0e28U, (uint64_t)0x000431944a19e62aU,
+    (uint64_t)0x00040cd3db232ab9U, (uint64_t)0x0007eb086cc38919U, (uint64_t)0x00024dab1a71a55bU,
+    (uint64_t)0x00042918001a829fU, (uint64_t)0x00052629d89d6076U, (uint64_t)0x00038360ad400d86U,
+    (uint64_t)0x00024e085750534dU, (uint64_t)0x00046109213da288U, (uint64_t)0x0001d832bc1670ddU,
+    (uint64_t)0x000153eeb75a32a1U, (uint64_t)0x000694b23ee33d22U, (uint64_t)0x0000185d0d3c9156U,
+    (uint64_t)0x0001affddddecd24U, (uint64_t)0x0005e3573b049d61U, (uint64_t)0x0006e21a85892871U,
+    (uint64_t)0x0005219b366facacU, (uint64_t)0x00070683f0cef309U, (uint64_t)0x0004ed0882ea9cc1U,
+    (uint64_t)0x00054bc665420c78U, (uint64_t)0x00016889c88cea3bU, (uint64_t)0x00076fd9a9f0d136U,
+    (uint64_t)0x0005e60338a701f1U, (uint64_t)0x00023e55f21446d7U, (uint64_t)0x00064f20e09f4af1U,
+    (uint64_t)0x0004e5b28270f6ebU, (uint64_t)0x0000772661791a8eU, (uint64_t)0x00028d5fceb34bd7U,
+    (uint64_t)0x00002fee07235ec0U, (uint64_t)0x0007ed068b25b82cU, (uint64_t)0x0007b1db6a21b7d3U,
+    (uint64_t)0x0007f2874d038772U, (uint64_t)0x000691895475c37dU, (uint64_t)0x00066653826a32abU,
+    (uint64_t)0x00001da83a187da8U, (uint64_t)0x0004c643ad2709baU, (uint64_t)0x00052a681266a47dU,
+    (uint64_t)0x00015892f4b4159aU, (uint64_t)0x0001b1af17c37f60U, (uint64_t)0x000001c84c65d03bU,
+    (uint64_t)0x000151c6a14a0aa3U, (uint64_t)0x0007e296a2b5bc07U, (uint64_t)0x00042aad31521101U,
+    (uint64_t)0x0007b343088db932U, (uint64_t)0x00005ca3370e7516U, (uint64_t)0x00023611834c6903U,
+    (uint64_t)0x0005dc1239dcc023U, (uint64_t)0x000192e1a412fdeeU, (uint64_t)0x00013bcb373f87afU,
+    (uint64_t)0x0006f407fc537b95U, (uint64_t)0x00018fcee019d84aU, (uint64_t)0x0005f0cb020d5cc3U,
+    (uint64_t)0x000709772349ee3bU, (uint64_t)0x000772c8defe9df4U, (uint64_t)0x00032a375ad5f1aeU,
+    (uint64_t)0x0000211f095ab9c3U, (uint64_t)0x0006783260dd0f83U, (uint64_t)0x0002d4f2d762ceacU,
+    (uint64_t)0x0005eb6de53cdc69U, (uint64_t)0x000624cb312b698bU, (uint64_t)0x0005d0e5200bd8a3U,
+    (uint64_t)0x0002177d4d6c3272U, (uint64_t)0x00068890ed88a7dbU, (uint64_t)0x0003e3c9b98d64dcU,
+    (uint64_t)0x0005b3336b2751e9U, (uint64_t)0x00055793aa0222e8U, (uint64_t)0x000358452f60ba2dU,
+    (uint64_t)0x000149ee37906584U, (uint64_t)0x0004b9700fda440eU, (uint64_t)0x0003e32cc8618b44U,
+    (uint64_t)0x00011a31a051b5f9U, (uint64_t)0x0005278e09b02436U, (uint64_t)0x0001f3f2dd7a51f8U,
+    (uint64_t)0x0001480d9a5bf27aU, (uint64_t)0x0001ddf6ece608feU, (uint64_t)0x00052b52112ea94eU,
+    (uint64_t)0x0005048da5d3089aU, (uint64_t)0x00073ecd3e5a851eU, (uint64_t)0x0003a4e7294b6914U,
+    (uint64_t)0x0005e2dc58e9a48aU, (uint64_t)0x00002594a910f33dU, (uint64_t)0x000038688f495c36U,
+    (uint64_t)0x0003cd245933f80eU, (uint64_t)0x000250b51cadb19fU, (uint64_t)0x0002cdadf05da1a6U,
+    (uint64_t)0x0005625f48c0e101U, (uint64_t)0x0003357b0262dc11U, (uint64_t)0x0002507af250638bU,
+    (uint64_t)0x0007e0301847dd8eU, (uint64_t)0x000396b384f3d61cU, (uint64_t)0x000261107e7ad644U,
+    (uint64_t)0x0001714c95106fc0U, (uint64_t)0x00069ea998633183U, (uint64_t)0x00065124b15d6139U,
+    (uint64_t)0x0007223e5f7b66d1U, (uint64_t)0x0007f8a3afb74473U, (uint64_t)0x00056794f99d1b14U,
+    (uint64_t)0x00033741f951d026U, (uint64_t)0x0002680ac69cf0c9U, (uint64_t)0x0002e0677353c70dU,
+    (uint64_t)0x0004ffe7890fbd50U, (uint64_t)0x00002e2e1b792d2dU, (uint64_t)0x0000377a39dea672U,
+    (uint64_t)0x0003bfd9c6baf256U, (uint64_t)0x00053cc3dca34102U, (uint64_t)0x00037d23ececbbe1U,
+    (uint64_t)0x0001411ec941481cU, (uint64_t)0x0005756a866117d7U, (uint64_t)0x0006be34fa6f2346U,
+    (uint64_t)0x0002592a3aafce64U, (uint64_t)0x0001523837c2d716U, (uint64_t)0x0003a69f1bcfc1c2U,
+    (uint64_t)0x000706d09d269474U, (uint64_t)0x00063c07f97014b5U, (uint64_t)0x00036517fc908a70U,
+    (uint64_t)0x00037fc889cc1368U, (uint64_t)0x00002ada87b8aa17U, (uint64_t)0x0007ff3517621a41U,
+    (uint64_t)0x00076bbd94e9f566U, (uint64_t)0x00034705fe600f5aU, (uint64_t)0x0002e158dbe3b01eU,
+    (uint64_t)0x0000ec401ba959e8U, (uint64_t)0x000264f990be8e69U, (uint64_t)0x000287fde64749a9U,
+    (uint64_t)0x000299153c141a89U, (uint64_t)0x0002d276a889d46aU, (uint64_t)0x0005b508d4ffecbdU,
+    (uint64_t)0x00039b22aeaeb968U, (uint64_t)0x00068e6ce44ed65cU, (uint64_t)0x0001822eb03d3b54U,
+    (uint64_t)0x0001c336b8504618U, (uint64_t)0x00014160c3f02319U, (uint64_t)0x0005e4ae8cc2853eU,
+    (uint64_t)0x00040dcc8fe74b58U, (uint64_t)0x0005969255bd0891U, (uint64_t)0x00021575bbb4d7a4U,
+    (uint64_t)0x0007c9563153ad94U, (uint64_t)0x0007ec451f4d5551U, (uint64_t)0x0001e150958c9a8bU,
+    (uint64_t)0x000680a805fa0ae9U, (uint64_t)0x0003aef5c8008dbdU, (uint64_t)0x00004346970d9be8U,
+    (uint64_t)0x0000f56d107e42dfU, (uint64_t)0x00077aa71bd3f905U, (uint64_t)0x00050db591778c21U,
+    (uint64_t)0x0002456c59918ecbU, (uint64_t)0x00042c763fa93352U, (uint64_t)0x00010922cde409d4U,
+    (uint64_t)0x00069ea296f8a5edU, (uint64_t)0x00027d1d57fa8808U, (uint64_t)0x00009c7a1dff09c3U,
+    (uint64_t)0x0005b7155b3b15c0U, (uint64_t)0x00053fd8e6234c7fU, (uint64_t)0x0003ef4f41482785U,
+    (uint64_t)0x0000a42f1c0f4c5dU, (uint64_t)0x0003b0f9dc4062c9U, (uint64_t)0x0005bc7e7d9280daU,
+    (uint64_t)0x0001bac024ab8c00U, (uint64_t)0x00034d57d246a17cU, (uint64_t)0x000203614db4c547U,
+    (uint64_t)0x000187ad703d9b8aU, (uint64_t)0x0005d87d59155505U, (uint64_t)0x0006f39612a6e85eU,
+    (uint64_t)0x000790a276ece7aaU, (uint64_t)0x0000811d14bfdfdcU, (uint64_t)0x000746b68306376eU,
+    (uint64_t)0x0004082b2408e188U, (uint64_t)0x00015257a95ab68bU, (uint64_t)0x000706f8763be926U,
+    (uint64_t)0x00042bea70d46f3eU, (uint64_t)0x0000758e51e81332U, (uint64_t)0x0002a2de1b93cb50U,
+    (uint64_t)0x00000e509f7850ebU, (uint64_t)0x000141231a0feca8U, (uint64_t)0x00006ed6a79fb4c3U,
+    (uint64_t)0x00003d905d527a4aU, (uint64_t)0x000233871cbba0a6U, (uint64_t)0x000552a399b40314U,
+    (uint64_t)0x0006587832814bf8U, (uint64_t)0x0004de090761b863U, (uint64_t)0x0006057b9772baa8U,
+    (uint64_t)0x0000313cc794d19eU, (uint64_t)0x0001f9fb7fef8f5cU, (uint64_t)0x0000e70cc518704fU,
+    (uint64_t)0x0005eef0efd10536U, (uint64_t)0x000079019d237bcfU, (uint64_t)0x0000c9fe10ac5d91U,
+    (uint64_t)0x0001bb5d3b5fcc86U, (uint64_t)0x00005e69749deed8U, (uint64_t)0x0007b42c369ac06aU,
+    (uint64_t)0x000676bfb4fc4817U, (uint64_t)0x00046e815daae1e7U, (uint64_t)0x0006adf83bcf726bU,
+    (uint64_t)0x0002aab557702b75U, (uint64_t)0x0001d45517858ce4U, (uint64_t)0x000044f0d4c5c699U,
+    (uint64_t)0x000270c09d60bd07U, (uint64_t)0x0006628fb1b86f04U, (uint64_t)0x00065826052f7bbbU,
+    (uint64_t)0x0000b5a9d8fe8b7cU, (uint64_t)0x00040bc9f10663afU, (uint64_t)0x0003b9e4ca0afd00U,
+    (uint64_t)0x000055bf03462e7cU, (uint64_t)0x00034e8283ff73e9U, (uint64_t)0x0007bbb9318495c3U,
+    (uint64_t)0x000639324b0eeafcU, (uint64_t)0x000567afe79c6e03U, (uint64_t)0x00067ac751c841b1U,
+    (uint64_t)0x000185570f7af720U, (uint64_t)0x0004285edbe9117fU, (uint64_t)0x0007173eae04bdbdU,
+    (uint64_t)0x0001fdb1b70fbdb8U, (uint64_t)0x0005308ad42c32a8U, (uint64_t)0x0005e79605306427U,
+    (uint64_t)0x000503aa6104a682U, (uint64_t)0x0007b451d87b7b35U, (uint64_t)0x0006d4cc073d052fU,
+    (uint64_t)0x0004809ba361df91U, (uint64_t)0x0004587d21ffc4baU, (uint64_t)0x0001f4082e0455a5U,
+    (uint64_t)0x000480351f8687d6U, (uint64_t)0x00011b2372e07d43U, (uint64_t)0x0006d4aef3e95b40U,
+    (uint64_t)0x0003c81cd8db5ecdU, (uint64_t)0x0003ef830cbeff9bU, (uint64_t)0x00047553dc8ee4c8U,
+    (uint64_t)0x0002481ddac47325U, (uint64_t)0x000054bbe5cd2faaU, (uint64_t)0x00010b543a3b4f76U,
+    (uint64_t)0x00062349ff5d8dbdU, (uint64_t)0x0000ed129cf5e85dU, (uint64_t)0x00022f4ba4bb2215U,
+    (uint64_t)0x00063c2ede271c07U, (uint64_t)0x0004d0ed6e1db602U, (uint64_t)0x0007223d44476a62U,
+    (uint64_t)0x0002fa9830822c1aU, (uint64_t)0x00007c5fa8c91d54U, (uint64_t)0x0003624a44d041f8U,
+    (uint64_t)0x0005b0665a9349cfU, (uint64_t)0x000649a996e6d4d3U, (uint64_t)0x00064cd1acedee9cU,
+    (uint64_t)0x000206da48eb9912U, (uint64_t)0x000148d706baa183U, (uint64_t)0x0004aea4950d672fU,
+    (uint64_t)0x0001648311b942feU, (uint64_t)0x0005182f16609f9eU, (uint64_t)0x000529be8eb485b7U,
+    (uint64_t)0x0007fc27e8cf7f8cU, (uint64_t)0x0004cf43b0c22f92U, (uint64_t)0x0004b4959d9c3ac5U,
+    (uint64_t)0x00022c8be73f9d56U, (uint64_t)0x00070444e80a6974U, (uint64_t)0x0005629d3d7f9ad2U,
+    (uint64_t)0x000682868f6603aeU, (uint64_t)0x0003a95596d97770U, (uint64_t)0x0004161a34c98fd7U,
+    (uint64_t)0x000414f2ff07680bU, (uint64_t)0x000779aeb04da64fU, (uint64_t)0x0003d4187d253a30U,
+    (uint64_t)0x00015a80cdcc0331U, (uint64_t)0x000747fa8c0f0d02U, (uint64_t)0x0000874f075f5e8cU,
+    (uint64_t)0x0006680e59550d33U, (uint64_t)0x0004f609255c08bbU, (uint64_t)0x000216a2e847090bU,
+    (uint64_t)0x0001d831cbb76ce1U, (uint64_t)0x00057e1b3fb67e93U, (uint64_t)0x00050637bb16be21U,
+    (uint64_t)0x000481e549b42904U, (uint64_t)0x0002d265d3fe1c88U, (uint64_t)0x0002e60a84210b3cU,
+    (uint64_t)0x0004c4562b460bf6U, (uint64_t)0x000466bd29a87e55U, (uint64_t)0x000551104a43095aU,
+    (uint64_t)0x00008376fb0663d3U, (uint64_t)0x00067f96cc1061ddU, (uint64_t)0x000268e794db69ecU,
+    (uint64_t)0x0006fbe6aba96768U, (uint64_t)0x0007793adb64bf15U, (uint64_t)0x00048cfd55b628f4U,
+    (uint64_t)0x00010ed5babb9385U, (uint64_t)0x0001197d56bd614cU, (uint64_t)0x0006638ba8616b20U,
+    (uint64_t)0x0003592c01f9f2b5U, (uint64_t)0x000642cb15498d8cU, (uint64_t)0x0004b239abeaeb3eU,
+    (uint64_t)0x00047ff4dc3b27beU, (uint64_t)0x000464fa85b24265U, (uint64_t)0x0002d119a605f70aU,
+    (uint64_t)0x00021b5ca5020a9eU, (uint64_t)0x00018ca77a2c3d14U, (uint64_t)0x00066cbc4247ba0aU,
+    (uint64_t)0x0000222b83b5a36cU, (uint64_t)0x0003a92995f59e54U, (uint64_t)0x0006231758c43d13U,
+    (uint64_t)0x00020f68c6e79befU, (uint64_t)0x000575b5207576c4U, (uint64_t)0x00004351174e59f8U,
+    (uint64_t)0x0006e841150ce36bU, (uint64_t)0x00038e576301ff6cU, (uint64_t)0x0000389eeb60eac0U,
+    (uint64_t)0x000662d33f46d89fU, (uint64_t)0x0000d2442706c9bbU, (uint64_t)0x00024a96940beed2U,
+    (uint64_t)0x000458fe689e31a2U, (uint64_t)0x0002b7b38a165294U, (uint64_t)0x0004f9e398b3110bU,
+    (uint64_t)0x0005d3df9a647935U, (uint64_t)0x0007ad3662317803U, (uint64_t)0x000250df0cb741d8U,
+    (uint64_t)0x00052678641780dbU, (uint64_t)0x0003c74f19591accU, (uint64_t)0x0001e429fc5707b0U,
+    (uint64_t)0x0000d0779119e684U, (uint64_t)0x000372bec78d7501U, (uint64_t)0x0006c97abdb538e8U,
+    (uint64_t)0x0002c555119df6cfU, (uint64_t)0x0003a8303211db4dU, (uint64_t)0x000309769f161003U,
+    (uint64_t)0x00032e9e47cf2f48U, (uint64_t)0x000518030cb981d2U, (uint64_t)0x0000b2e6f28c6148U,
+    (uint64_t)0x0002f9e999668e86U, (uint64_t)0x000422ef1fc3dd62U, (uint64_t)0x0007fbe85454d956U,
+    (uint64_t)0x00023ca9ec4d1c77U, (uint64_t)0x000333d6263e998dU, (uint64_t)0x000057759efee7ecU,
+    (uint64_t)0x00075b2d7f71a705U, (uint64_t)0x0001aa3756aabcc3U, (uint64_t)0x0005be03a49159aeU,
+    (uint64_t)0x00008eb012ddc7b7U, (uint64_t)0x0004d1f18f09b75aU, (uint64_t)0x0006b75a4d7c070bU,
+    (uint64_t)0x00042333e27831adU, (uint64_t)0x0005248180ebc809U, (uint64_t)0x000650e99570621aU,
+    (uint64_t)0x0000c9898e3227ceU, (uint64_t)0x00066d29e5d2a65dU, (uint64_t)0x00004a62d3684e33U,
+    (uint64_t)0x0007975ac0537dc5U, (uint64_t)0x00049dda5cbcfba9U, (uint64_t)0x00021afab7eeba46U,
+    (uint64_t)0x0001ac86251b7101U, (uint64_t)0x00038db16447d79dU, (uint64_t)0x0000a0f714f96daaU,
+    (uint64_t)0x0000bbe550afe9deU, (uint64_t)0x00016ee9f7c5ce61U, (uint64_t)0x000096743175388bU,
+    (uint64_t)0x0001c48ccaed60ecU, (uint64_t)0x000206b44d20fddeU, (uint64_t)0x00002950de17e9ccU,
+    (uint64_t)0x00027b787e39f272U, (uint64_t)0x00026480108da889U, (uint64_t)0x0007ade2d06a404dU,
+    (uint64_t)0x000676b273212fb7U, (uint64_t)0x00058fad5e4315cfU, (uint64_t)0x0001aa63a547669eU,
+    (uint64_t)0x0006ef7c85d730ceU, (uint64_t)0x000176b78984cddfU, (uint64_t)0x00043f777db85852U,
+    (uint64_t)0x0004ecfd838b0c22U, (uint64_t)0x000784884aab614dU, (uint64_t)0x0001f9b3715093d5U,
+    (uint64_t)0x0007b5b93eda7744U, (uint64_t)0x00021742f577c701U, (uint64_t)0x00046477248bc3fcU,
+    (uint64_t)0x00040a11d3490cb6U, (uint64_t)0x000588027dd624ecU, (uint64_t)0x00057ea0e4a71ce9U,
+    (uint64_t)0x0002d3e9d38bb0f6U, (uint64_t)0x00069f0213d1c80aU, (uint64_t)0x00031af154ba9635U,
+    (uint64_t)0x0003deb9c4bd7294U, (uint64_t)0x000042d154bf7b4aU, (uint64_t)0x0002de120a71fc90U,
+    (uint64_t)0x0000bd94bb1ff430U, (uint64_t)0x0002e88329fb70c9U, (uint64_t)0x0004fcfbf74f1a38U,
+    (uint64_t)0x00042d1831323e27U, (uint64_t)0x00015eb884d1bb80U, (uint64_t)0x00016ca7d667a6edU,
+    (uint64_t)0x0001f8188b26f96fU, (uint64_t)0x0000ed0eda6573fcU, (uint64_t)0x00063a01f5ae7054U,
+    (uint64_t)0x00016490c154e108U, (uint64_t)0x000152aa1adc6ea2U, (uint64_t)0x000048110d2fd61dU,
+    (uint64_t)0x0005468343db1358U, (uint64_t)0x0001f8d28dd4f286U, (uint64_t)0x0005a9c43da98bb8U,
+    (uint64_t)0x0001227288d6136aU, (uint64_t)0x00048e7e6f0b1858U, (uint64_t)0x0007037a0babfea2U,
+    (uint64_t)0x0001ce82e2360367U, (uint64_t)0x00005739dc41d103U, (uint64_t)0x00059e03f52c6b96U,
+    (uint64_t)0x00010dc7202995faU, (uint64_t)0x000310b2129859d1U, (uint64_t)0x0007180d571f3d3dU,
+    (uint64_t)0x00006362e248e5e5U, (uint64_t)0x0000fb3c4a8dedc8U, (uint64_t)0x0004230a27942c72U,
+    (uint64_t)0x0003b74d741ab5faU, (uint64_t)0x000613eb914c0150U, (uint64_t)0x000149e920b97353U,
+    (uint64_t)0x0001945100e2ad79U, (uint64_t)0x0005f48068bbc329U, (uint64_t)0x00077a550c592a09U,
+    (uint64_t)0x0003edbaafcd8c41U, (uint64_t)0x000372de96e93ed8U, (uint64_t)0x000107e7efa316f8U,
+    (uint64_t)0x00032706e3f36478U, (uint64_t)0x00047d0fb2a87946U, (uint64_t)0x0006df1fdaf7b562U,
+    (uint64_t)0x0007f8e193cb03a9U, (uint64_t)0x00029160912248d9U, (uint64_t)0x0003fde42875dea3U,
+    (uint64_t)0x000085a59f1d202fU, (uint64_t)0x00027bf43826bf03U, (uint64_t)0x000467037514f2eaU,
+    (uint64_t)0x0002db615f4f69a9U, (uint64_t)0x0005e0b0eaa961a7U, (uint64_t)0x00011a7df457ce7eU,
+    (uint64_t)0x00016a24d749cc1dU, (uint64_t)0x0000f4d5153e9a29U, (uint64_t)0x0006bacb1f20c130U,
+    (uint64_t)0x00056230fb0c2b41U, (uint64_t)0x000750aaafd58ac7U, (uint64_t)0x0000639572e01bdcU,
+    (uint64_t)0x0007714f57a675c2U, (uint64_t)0x0000107ffb3d11beU, (uint64_t)0x0006d7d6b876f649U,
+    (uint64_t)0x0005f56a0bdeece1U, (uint64_t)0x000769a6a59746d7U, (uint64_t)0x000748335ec5da25U,
+    (uint64_t)0x00020843e57bf6a0U, (uint64_t)0x00077d15866bda23U, (uint64_t)0x00020e2c855dbee1U,
+    (uint64_t)0x00022dc1267cfb2bU, (uint64_t)0x0002fecae053b13bU, (uint64_t)0x0003b9579f9b29e8U,
+    (uint64_t)0x000780157bea4c4dU, (uint64_t)0x000097b35a90ac7cU, (uint64_t)0x0000077f066a9ea2U,
+    (uint64_t)0x0007f0b158c7224dU, (uint64_t)0x0006cb091d3bec77U, (uint64_t)0x00068a22736e50bdU,
+    (uint64_t)0x00020ca10ce92ea0U, (uint64_t)0x000795734ee4fcc2U, (uint64_t)0x000376f7100669b5U,
+    (uint64_t)0x00007c10909d49afU, (uint64_t)0x00058d285debc392U, (uint64_t)0x00013e9ce973cc83U,
+    (uint64_t)0x000756420ab5c711U, (uint64_t)0x00027ee06554f6a3U, (uint64_t)0x00005ddb0818d746U,
+    (uint64_t)0x000745cd0385ed48U, (uint64_t)0x0000f27bedb99383U, (uint64_t)0x0003793198bc4c4cU,
+    (uint64_t)0x00066896aefbcf46U, (uint64_t)0x0007ba5207e8d2b1U, (uint64_t)0x0001025c6a67f167U,
+    (uint64_t)0x000562d75ac88ec1U, (uint64_t)0x000644d12fc5e7fcU, (uint64_t)0x0004b572175216dcU,
+    (uint64_t)0x0007f51f8a413991U, (uint64_t)0x0005bdebb6b4bb84U, (uint64_t)0x00000b9740927f52U,
+    (uint64_t)0x000173450789fcd4U, (uint64_t)0x0006bfe5a984463dU, (uint64_t)0x00072f0e8c8db050U,
+    (uint64_t)0x0001e97289d7289aU, (uint64_t)0x00029042b8b396fdU, (uint64_t)0x0006f42d1c40d5e5U,
+    (uint64_t)0x00010679fd6c1110U, (uint64_t)0x0005dad0ea2d7ea4U, (uint64_t)0x0002b47f3143a5e8U,
+    (uint64_t)0x0004f46a79a8fae4U, (uint64_t)0x0005deca767ef17bU, (uint64_t)0x00019d67898aa396U,
+    (uint64_t)0x00064393c4f92a4bU, (uint64_t)0x0006805bccc1f395U, (uint64_t)0x000380384044cc4eU,
+    (uint64_t)0x0004ddf2207da12fU, (uint64_t)0x0005ef380f6cd654U, (uint64_t)0x0002814739c8d92fU,
+    (uint64_t)0x0006410307b13d12U, (uint64_t)0x0007f6460c2c6905U, (uint64_t)0x0004e5f035a58983U,
+    (uint64_t)0x00054a689d9d2848U, (uint64_t)0x0000a17508e5b4b3U, (uint64_t)0x000725f2b3427f1cU,
+    (uint64_t)0x0002e81bd4a5f7c9U, (uint64_t)0x000296dcb24cb318U, (uint64_t)0x0003e1dd8b060f7bU,
+    (uint64_t)0x0003caf2eb7b32daU, (uint64_t)0x00056af32b25f342U, (uint64_t)0x00039c19fd5b9478U,
+    (uint64_t)0x0000b17dc85a4acfU, (uint64_t)0x000529b40066f882U, (uint64_t)0x00027964d8393582U,
+    (uint64_t)0x0001b3e5ffb9b495U, (uint64_t)0x00062ac3f61cc4afU, (uint64_t)0x00030c5bad4740fdU,
+    (uint64_t)0x00061c1a6cf1b93fU, (uint64_t)0x00005b6f79e2bfbcU, (uint64_t)0x000037f051aaec40U,
+    (uint64_t)0x0006ff4a7c7112daU, (uint64_t)0x000408a3f1af2e77U, (uint64_t)0x0000fbcc0954e1c8U,
+    (uint64_t)0x0003e094c281116dU, (uint64_t)0x00041238bb254773U, (uint64_t)0x0002d43cf3e3c927U,
+    (uint64_t)0x0004f01ec38854c1U, (uint64_t)0x0006a1fb1668d299U, (uint64_t)0x0002189188d6a438U,
+    (uint64_t)0x00029f25cd28c862U, (uint64_t)0x0006e9407a083377U, (uint64_t)0x0001f3721d5a7831U,
+    (uint64_t)0x000790b8fafbbf07U, (uint64_t)0x0001c1532743cc49U, (uint64_t)0x000314b1241df110U,
+    (uint64_t)0x0006e4a41f053e2fU, (uint64_t)0x00007d2d9234970cU, (uint64_t)0x0004511f703f2295U,
+    (uint64_t)0x0000cddcf0634ac9U, (uint64_t)0x0005bb9ebfee898eU, (uint64_t)0x0000571f03dc91cfU,
+    (uint64_t)0x0006ac2190030c21U, (uint64_t)0x0003ff2b5daaa417U, (uint64_t)0x0000a453722962c9U,
+    (uint64_t)0x000489a9a623ecb3U, (uint64_t)0x0007a6a71f2a2a39U, (uint64_t)0x0006a8917ad98392U,
+    (uint64_t)0x0005d93d58452873U, (uint64_t)0x0000d1f5262d12f2U, (uint64_t)0x000221f9037b7c46U,
+    (uint64_t)0x00011905544cdcdbU, (uint64_t)0x0002982d55300208U, (uint64_t)0x00026e980dc349b6U,
+    (uint64_t)0x000084bdc4ebb654U, (uint64_t)0x000516ab693b2a45U, (uint64_t)0x000431265687535fU,
+    (uint64_t)0x000215e16ca44797U, (uint64_t)0x0004de8802a6dec8U, (uint64_t)0x0004441cae1598e9U,
+    (uint64_t)0x00064c0628064c4fU, (uint64_t)0x0005642bf4c75b0fU, (uint64_t)0x000759ee3cd9be57U,
+    (uint64_t)0x0002a8d0e7b42d1aU, (uint64_t)0x00034687dd6b47b5U, (uint64_t)0x000595a7971c47f8U,
+    (uint64_t)0x000709b6944adb13U, (uint64_t)0x0001d8649515cb49U, (uint64_t)0x0006c26c1bb7fb6cU,
+    (uint64_t)0x000695f4bf87f97eU, (uint64_t)0x000370446bced57cU, (uint64_t)0x00021d1f4f6198b6U,
+    (uint64_t)0x0005b21e2f2978f3U, (uint64_t)0x0004083c2e827437U, (uint64_t)0x0007ba30a9399cd3U,
+    (uint64_t)0x0003c2473577ebc5U, (uint64_t)0x0006c41cb943907fU, (uint64_t)0x000171d8d681ab45U,
+    (uint64_t)0x00013a23ee724a97U, (uint64_t)0x0007baa036a14ce4U, (uint64_t)0x00072f7ff4df17abU,
+    (uint64_t)0x0003c9ce6de026deU, (uint64_t)0x0005460df4d60714U, (uint64_t)0x000416d71b9abcd8U,
+    (uint64_t)0x00067332e739739bU, (uint64_t)0x0004d2e02ecc0c09U, (uint64_t)0x00065a9243e9a558U,
+    (uint64_t)0x00069dfc7004263cU, (uint64_t)0x00038bb4cf5474e5U, (uint64_t)0x0006a94853984d2fU,
+    (uint64_t)0x0001e8ed2b668b61U, (uint64_t)0x0001becd03d9d80bU, (uint64_t)0x000208b54aebd496U,
+    (uint64_t)0x00075486598125bbU, (uint64_t)0x000389a5689efd02U, (uint64_t)0x000348eafabd7b67U,
+    (uint64_t)0x0007a1650ad034bdU, (uint64_t)0x00024623476f0af9U, (uint64_t)0x0001849b8c042687U,
+    (uint64_t)0x000384565d975265U, (uint64_t)0x0004ffcebddf7685U, (uint64_t)0x0007188ca6e6f369U,
+    (uint64_t)0x0006aebe4a1a22d9U, (uint64_t)0x000705c8ae4f1e03U, (uint64_t)0x0007bcfe8bb6a6b2U,
+    (uint64_t)0x0003e37fc5e076e8U, (uint64_t)0x0001166546ace9a3U, (uint64_t)0x00028bdae94f16c1U,
+    (uint64_t)0x0000de6a651dd538U, (uint64_t)0x000503d780f925b4U, (uint64_t)0x0004ec5fe52ca445U,
+    (uint64_t)0x0005420988bdd612U, (uint64_t)0x00064e507a02bfd8U, (uint64_t)0x0007ab2d1caa03a4U,
+    (uint64_t)0x00040a0fb08bdd2bU, (uint64_t)0x0003eeb8d9640922U, (uint64_t)0x00031ed08857db09U,
+    (uint64_t)0x000513ac992d72b4U, (uint64_t)0x0007493a9c6166adU, (uint64_t)0x0007bc2becea4534U,
+    (uint64_t)0x0002899011e485fdU, (uint64_t)0x0007ca0e25981190U, (uint64_t)0x0000aaec80320e9fU,
+    (uint64_t)0x0006f894a654bf0eU, (uint64_t)0x000677020d13df5dU, (uint64_t)0x00041a8f3376f011U,
+    (uint64_t)0x0005f711851152ddU, (uint64_t)0x00047f3bd11324f6U, (uint64_t)0x00060e4285c492beU,
+    (uint64_t)0x0006461cf8eac300U, (uint64_t)0x000453aaa478b8bbU, (uint64_t)0x00035f993046fe46U,
+    (uint64_t)0x0007e05db9b3ff88U, (uint64_t)0x0001d712f0d1de7eU, (uint64_t)0x00025cab1d3f605dU,
+    (uint64_t)0x0006b3fb9542da6eU, (uint64_t)0x00061f2990200cd2U, (uint64_t)0x0004e1825367e1f1U,
+    (uint64_t)0x000587b3e55c5e0fU, (uint64_t)0x000474e73512bc9fU, (uint64_t)0x0000b45a0e1750a5U,
+    (uint64_t)0x0002e816b2b00af5U, (uint64_t)0x0004a6d22703a704U, (uint64_t)0x0000d8cccf61776dU,
+    (uint64_t)0x0004bbdf6233750dU, (uint64_t)0x0003fe96d8dea1eaU, (uint64_t)0x0000228bcc728f8bU,
+    (uint64_t)0x0004c58d7a8c6dedU, (uint64_t)0x000795e9f69bf873U, (uint64_t)0x00064f72584d5d19U,
+    (uint64_t)0x00005cf1e45220d8U, (uint64_t)0x000423a7ac23c2c2U, (uint64_t)0x00026e271016b418U,
+    (uint64_t)0x0002f283ba368eb5U, (uint64_t)0x0007098b36099d4fU, (uint64_t)0x00016605caa40e47U,
+    (uint64_t)0x0004b9226bbcc4b2U, (uint64_t)0x0003e22af70a5480U, (uint64_t)0x0002b5b6519a2968U,
+    (uint64_t)0x00046d98507b7c52U, (uint64_t)0x0006eef607752d66U, (uint64_t)0x00046f50cbe288cfU,
+    (uint64_t)0x000689d8b7cda23bU, (uint64_t)0x00045806fe512f61U, (uint64_t)0x0007971267618ca9U,
+    (uint64_t)0x0000f31d8d5e9837U, (uint64_t)0x0004ac5283ff8ec7U, (uint64_t)0x00017b031d3e5587U,
+    (uint64_t)0x0001a302bc065a10U, (uint64_t)0x000325a63fec6e86U, (uint64_t)0x0001f06e2ee3f100U,
+    (uint64_t)0x0006aabd9d17f843U, (uint64_t)0x00061a6ba2ca42d9U, (uint64_t)0x000325579b63721dU,
+    (uint64_t)0x000425437a7910a5U, (uint64_t)0x00042a32acb80954U, (uint64_t)0x00022f5148ad12e7U,
+    (uint64_t)0x00063d805f5a79f8U, (uint64_t)0x000199507e152816U, (uint64_t)0x00066b7b32817519U,
+    (uint64_t)0x00027b81ee55c900U, (uint64_t)0x000590e934f3ebceU, (uint64_t)0x0006f20c04f509dbU,
+    (uint64_t)0x0006c8621e8cb414U, (uint64_t)0x00068d737430b109U, (uint64_t)0x0001e3bf3f485a30U,
+    (uint64_t)0x0002b744182fc8e2U, (uint64_t)0x00003d963eeae485U, (uint64_t)0x00047a9ec1e7e183U,
+    (uint64_t)0x0005e4990c67d57dU, (uint64_t)0x00003f6752348267U, (uint64_t)0x000256c631cb8ce9U,
+    (uint64_t)0x00074b75cc839a94U, (uint64_t)0x000602ce8d1e424dU, (uint64_t)0x000647b1aee599e0U,
+    (uint64_t)0x00065c18a8f2e9b0U, (uint64_t)0x00057667ac242f32U, (uint64_t)0x00008596a58821d7U,
+    (uint64_t)0x00052d6b93a58ae9U, (uint64_t)0x00023fdb62fcfe42U, (uint64_t)0x0002237826816665U,
+    (uint64_t)0x0007bda262c5881eU, (uint64_t)0x0000f04da69e0202U, (uint64_t)0x00011070c800b8c4U,
+    (uint64_t)0x0000fd5bc07068dfU, (uint64_t)0x00077afe1ba00d96U, (uint64_t)0x00067ea37474800cU,
+    (uint64_t)0x0001fbc1c9cd03c4U, (uint64_t)0x000557e493cef8feU, (uint64_t)0x0001982593dac0a4U,
+    (uint64_t)0x00055cce97a79475U, (uint64_t)0x0000c9ba5c65b4fcU, (uint64_t)0x00041d7a80b34727U,
+    (uint64_t)0x00068cbc671a9cfeU, (uint64_t)0x000066ecdd013654U, (uint64_t)0x000644eccef80642U,
+    (uint64_t)0x0007686333357f88U, (uint64_t)0x000797899e488353U, (uint64_t)0x0005ce424b8909ccU,
+    (uint64_t)0x00008cd124cb7f30U, (uint64_t)0x00043985e7a1ad72U, (uint64_t)0x0004259ff3307b83U,
+    (uint64_t)0x0005dd70a33ff94aU, (uint64_t)0x0007e6e320b1beb0U, (uint64_t)0x0002700aae7eca6eU,
+    (uint64_t)0x0001199f051877a8U, (uint64_t)0x0005d0d59b2a8504U, (uint64_t)0x00048ea70d558697U,
+    (uint64_t)0x0003e68379f77cddU, (uint64_t)0x000375448487300dU, (uint64_t)0x0004fadfff712a83U,
+    (uint64_t)0x00032887273eabc1U, (uint64_t)0x000735b64bb87260U, (uint64_t)0x000287bc1a2bce2cU,
+    (uint64_t)0x00015e23befaeefaU, (uint64_t)0x0002167297b0c304U, (uint64_t)0x0005121b7e5b2c88U,
+    (uint64_t)0x000384aaaee3ca7bU, (uint64_t)0x000325052953d265U, (uint64_t)0x0004b171655a5142U,
+    (uint64_t)0x00017e6e8e2fcb2eU, (uint64_t)0x000585732799aa14U, (uint64_t)0x000169ea362ca1ebU
+  };
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Ed25519_PrecompTable_H_DEFINED
+#endif
@@ -38,6 +38,7 @@ extern "C" {
 
 
 #include "Hacl_Kremlib.h"
+#include "Lib_Memzero0.h"
 #include "Hacl_Hash.h"
 #include "Hacl_Chacha20Poly1305_128.h"
 #include "Hacl_HKDF.h"
@@ -86,6 +87,147 @@ Hacl_HPKE_Curve51_CP128_SHA512_openBase(
   uint8_t *output
 );
 
+/*
+  Same as openBase, with the receiver public key pkR supplied by the caller.
+*/
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA512_openBase_pk(
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint8_t *pkR,
+  uint32_t mlen,
+  uint8_t *m,
+  uint32_t infolen,
+  uint8_t *info,
+  uint8_t *output
+);
+
+/*
+  A base-mode encryption context: the derived AEAD key and base nonce, the
+  sequence number of the next message, and the exporter secret. Set up once per
+  session, it seals or opens any number of messages without redoing the DH and
+  key schedule; the nonce of message i is the base nonce XOR i.
+*/
+typedef struct Hacl_HPKE_Curve51_CP128_SHA512_context_s
+{
+  uint8_t key[32U];
+  uint8_t nonce[12U];
+  uint64_t seq;
+  uint8_t exporter_secret[64U];
+}
+Hacl_HPKE_Curve51_CP128_SHA512_context;
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA512_setupBaseI_context(
+  Hacl_HPKE_Curve51_CP128_SHA512_context *o_ctx,
+  uint8_t *o_pkE,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA512_setupBaseR_context(
+  Hacl_HPKE_Curve51_CP128_SHA512_context *o_ctx,
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/*
+  Receiver-side setup for a long-term key pair whose public key pkR was
+  computed once (and must match skR): unlike setupBaseR, no scalar
+  multiplication is spent re-deriving it, leaving the single DH with pkE.
+*/
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA512_setupBaseR_pk(
+  uint8_t *o_key_aead,
+  uint8_t *o_nonce_aead,
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA512_setupBaseR_context_pk(
+  Hacl_HPKE_Curve51_CP128_SHA512_context *o_ctx,
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/*
+  Sets up n receiver contexts, one per encapsulated key pkE[i], all for the
+  same key pair and info. o_res[i] gets the result of context i (0 on success)
+  and the return value is their bitwise or.
+*/
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA512_setupBaseR_many(
+  uint32_t n,
+  Hacl_HPKE_Curve51_CP128_SHA512_context *o_ctx,
+  uint32_t *o_res,
+  uint8_t **pkE,
+  uint8_t *skR,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/*
+  Encrypts plainlen bytes of plain under the next nonce, writing the ciphertext
+  followed by the 16-byte tag to output. Returns 1 (and writes nothing) once the
+  sequence number is exhausted, 0 otherwise.
+*/
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA512_context_seal(
+  Hacl_HPKE_Curve51_CP128_SHA512_context *ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *output
+);
+
+/*
+  Decrypts cipherlen bytes (ciphertext and tag) into cipherlen - 16 bytes of
+  output. Returns 0 on success; the sequence number only advances then.
+*/
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA512_context_open(
+  Hacl_HPKE_Curve51_CP128_SHA512_context *ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t cipherlen,
+  uint8_t *cipher,
+  uint8_t *output
+);
+
+/*
+  Derives len bytes bound to the session and to exporter_context, by expanding
+  the exporter secret. Returns 1 (and writes nothing) if len exceeds 255 * 64,
+  0 otherwise.
+*/
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA512_context_export(
+  Hacl_HPKE_Curve51_CP128_SHA512_context *ctx,
+  uint32_t exporter_contextlen,
+  uint8_t *exporter_context,
+  uint32_t len,
+  uint8_t *output
+);
+
+/*
+  Zeroes the key, base nonce, sequence number and exporter secret of ctx; call it
+  once the context is no longer needed.
+*/
+void Hacl_HPKE_Curve51_CP128_SHA512_context_wipe(Hacl_HPKE_Curve51_CP128_SHA512_context *ctx);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -24,18 +24,8 @@
 
 #include "Hacl_HPKE_Curve51_CP256_SHA256.h"
 
-uint32_t
-Hacl_HPKE_Curve51_CP256_SHA256_setupBaseI(
-  uint8_t *o_pkE,
-  uint8_t *o_k,
-  uint8_t *o_n,
-  uint8_t *skE,
-  uint8_t *pkR,
-  uint32_t infolen,
-  uint8_t *info
-)
+static uint32_t encap(uint8_t *o_pkE, uint8_t *zz, uint8_t *skE, uint8_t *pkR)
 {
-  uint8_t zz[32U] = { 0U };
   uint8_t *o_pkE_ = o_pkE;
   uint8_t *o_zz_ = zz;
   Hacl_Curve25519_51_secret_to_public(o_pkE_, skE);
@@ -61,92 +51,11 @@ Hacl_HPKE_Curve51_CP256_SHA256_setupBaseI(
   }
   uint32_t res2 = res;
   uint32_t res3 = res1 | res2;
-  uint8_t default_psk[32U] = { 0U };
-  uint8_t default_pkI[32U] = { 0U };
-  uint32_t
-  context_len = (uint32_t)7U + (uint32_t)3U * (uint32_t)32U + (uint32_t)2U * (uint32_t)32U;
-  KRML_CHECK_SIZE(sizeof (uint8_t), context_len);
-  uint8_t context[context_len];
-  memset(context, 0U, context_len * sizeof (uint8_t));
-  uint8_t
-  label_key[8U] =
-    {
-      (uint8_t)0x68U, (uint8_t)0x70U, (uint8_t)0x6bU, (uint8_t)0x65U, (uint8_t)0x20U, (uint8_t)0x6bU,
-      (uint8_t)0x65U, (uint8_t)0x79U
-    };
-  uint8_t
-  label_nonce[10U] =
-    {
-      (uint8_t)0x68U, (uint8_t)0x70U, (uint8_t)0x6bU, (uint8_t)0x65U, (uint8_t)0x20U, (uint8_t)0x6eU,
-      (uint8_t)0x6fU, (uint8_t)0x6eU, (uint8_t)0x63U, (uint8_t)0x65U
-    };
-  KRML_CHECK_SIZE(sizeof (uint8_t), (uint32_t)10U + context_len);
-  uint8_t tmp[(uint32_t)10U + context_len];
-  memset(tmp, 0U, ((uint32_t)10U + context_len) * sizeof (uint8_t));
-  uint8_t secret[32U] = { 0U };
-  uint8_t *info_hash = tmp;
-  uint8_t *pskID_hash = tmp + (uint32_t)32U;
-  Hacl_Hash_SHA2_hash_256(info, infolen, info_hash);
-  uint8_t *empty_b = info;
-  Hacl_Hash_SHA2_hash_256(empty_b, (uint32_t)0U, pskID_hash);
-  context[0U] = (uint8_t)0U;
-  uint8_t *uu____2 = context + (uint32_t)1U;
-  uint8_t *uu____3 = uu____2;
-  uu____3[0U] = (uint8_t)0U;
-  uu____3[1U] = (uint8_t)2U;
-  uint8_t *uu____4 = uu____2 + (uint32_t)2U;
-  uu____4[0U] = (uint8_t)0U;
-  uu____4[1U] = (uint8_t)1U;
-  uint8_t *uu____5 = uu____2 + (uint32_t)4U;
-  uu____5[0U] = (uint8_t)0U;
-  uu____5[1U] = (uint8_t)3U;
-  memcpy(context + (uint32_t)7U, o_pkE, (uint32_t)32U * sizeof (uint8_t));
-  memcpy(context + (uint32_t)7U + (uint32_t)32U, pkR, (uint32_t)32U * sizeof (uint8_t));
-  memcpy(context + (uint32_t)7U + (uint32_t)32U + (uint32_t)32U,
-    default_pkI,
-    (uint32_t)32U * sizeof (uint8_t));
-  uint8_t *pskhash_b = context + (uint32_t)7U + (uint32_t)32U + (uint32_t)32U + (uint32_t)32U;
-  memcpy(pskhash_b, pskID_hash, (uint32_t)32U * sizeof (uint8_t));
-  uint8_t
-  *output_info =
-    context
-    + (uint32_t)7U + (uint32_t)32U + (uint32_t)32U + (uint32_t)32U + (uint32_t)32U;
-  memcpy(output_info, info_hash, (uint32_t)32U * sizeof (uint8_t));
-  Hacl_HKDF_extract_sha2_256(secret, default_psk, (uint32_t)32U, zz, (uint32_t)32U);
-  uint8_t *info_key = tmp + (uint32_t)2U;
-  memcpy(info_key, label_key, (uint32_t)8U * sizeof (uint8_t));
-  memcpy(info_key + (uint32_t)8U, context, context_len * sizeof (uint8_t));
-  Hacl_HKDF_expand_sha2_256(o_k,
-    secret,
-    (uint32_t)32U,
-    info_key,
-    (uint32_t)8U + context_len,
-    (uint32_t)32U);
-  memcpy(tmp, label_nonce, (uint32_t)10U * sizeof (uint8_t));
-  Hacl_HKDF_expand_sha2_256(o_n,
-    secret,
-    (uint32_t)32U,
-    tmp,
-    (uint32_t)10U + context_len,
-    (uint32_t)12U);
   return res3;
 }
 
-uint32_t
-Hacl_HPKE_Curve51_CP256_SHA256_setupBaseR(
-  uint8_t *o_key_aead,
-  uint8_t *o_nonce_aead,
-  uint8_t *pkE,
-  uint8_t *skR,
-  uint32_t infolen,
-  uint8_t *info
-)
+static uint32_t decap(uint8_t *zz, uint8_t *pkE, uint8_t *skR)
 {
-  uint8_t pkR[32U] = { 0U };
-  uint8_t *pkR_ = pkR;
-  uint8_t zz[32U] = { 0U };
-  Hacl_Curve25519_51_secret_to_public(pkR_, skR);
-  uint32_t res1 = (uint32_t)0U;
   uint8_t *o_pkR_ = zz;
   uint8_t *uu____0 = pkE;
   uint8_t zeros[32U] = { 0U };
@@ -169,6 +78,26 @@ Hacl_HPKE_Curve51_CP256_SHA256_setupBaseR(
   }
   uint32_t res2 = res;
   uint32_t res20 = res2;
+  return res20;
+}
+
+/*
+  Key schedule of the base mode. When o_exp is not NULL, it also receives the
+  exporter secret, expanded from the same secret and context under the label
+  "hpke exp".
+*/
+static void
+key_schedule(
+  uint8_t *o_k,
+  uint8_t *o_n,
+  uint8_t *o_exp,
+  uint8_t *zz,
+  uint8_t *pkE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
   uint8_t default_psk[32U] = { 0U };
   uint8_t default_pkI[32U] = { 0U };
   uint32_t
@@ -224,19 +153,71 @@ Hacl_HPKE_Curve51_CP256_SHA256_setupBaseR(
   uint8_t *info_key = tmp + (uint32_t)2U;
   memcpy(info_key, label_key, (uint32_t)8U * sizeof (uint8_t));
   memcpy(info_key + (uint32_t)8U, context, context_len * sizeof (uint8_t));
-  Hacl_HKDF_expand_sha2_256(o_key_aead,
+  Hacl_HKDF_expand_sha2_256(o_k,
     secret,
     (uint32_t)32U,
     info_key,
     (uint32_t)8U + context_len,
     (uint32_t)32U);
   memcpy(tmp, label_nonce, (uint32_t)10U * sizeof (uint8_t));
-  Hacl_HKDF_expand_sha2_256(o_nonce_aead,
+  Hacl_HKDF_expand_sha2_256(o_n,
     secret,
     (uint32_t)32U,
     tmp,
     (uint32_t)10U + context_len,
     (uint32_t)12U);
+  if (o_exp != NULL)
+  {
+    uint8_t
+    label_exp[8U] =
+      {
+        (uint8_t)0x68U, (uint8_t)0x70U, (uint8_t)0x6bU, (uint8_t)0x65U, (uint8_t)0x20U, (uint8_t)0x65U,
+        (uint8_t)0x78U, (uint8_t)0x70U
+      };
+    memcpy(info_key, label_exp, (uint32_t)8U * sizeof (uint8_t));
+    Hacl_HKDF_expand_sha2_256(o_exp,
+      secret,
+      (uint32_t)32U,
+      info_key,
+      (uint32_t)8U + context_len,
+      (uint32_t)32U);
+  }
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP256_SHA256_setupBaseI(
+  uint8_t *o_pkE,
+  uint8_t *o_k,
+  uint8_t *o_n,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  uint8_t zz[32U] = { 0U };
+  uint32_t res = encap(o_pkE, zz, skE, pkR);
+  key_schedule(o_k, o_n, NULL, zz, o_pkE, pkR, infolen, info);
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP256_SHA256_setupBaseR(
+  uint8_t *o_key_aead,
+  uint8_t *o_nonce_aead,
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  uint8_t pkR[32U] = { 0U };
+  uint8_t *pkR_ = pkR;
+  Hacl_Curve25519_51_secret_to_public(pkR_, skR);
+  uint32_t res1 = (uint32_t)0U;
+  uint8_t zz[32U] = { 0U };
+  uint32_t res20 = decap(zz, pkE, skR);
+  key_schedule(o_key_aead, o_nonce_aead, NULL, zz, pkE, pkR, infolen, info);
   return res1 | res20;
 }
 
@@ -294,3 +275,224 @@ Hacl_HPKE_Curve51_CP256_SHA256_openBase(
   return z;
 }
 
+uint32_t
+Hacl_HPKE_Curve51_CP256_SHA256_openBase_pk(
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint8_t *pkR,
+  uint32_t mlen,
+  uint8_t *m,
+  uint32_t infolen,
+  uint8_t *info,
+  uint8_t *output
+)
+{
+  uint8_t k[32U] = { 0U };
+  uint8_t n[12U] = { 0U };
+  uint8_t *pkE1 = m;
+  uint32_t clen = mlen - (uint32_t)32U;
+  uint8_t *c = m + (uint32_t)32U;
+  uint32_t res1 = Hacl_HPKE_Curve51_CP256_SHA256_setupBaseR_pk(k, n, pkE1, skR, pkR, infolen, info);
+  uint32_t
+  res2 =
+    Hacl_Chacha20Poly1305_256_aead_decrypt(k,
+      n,
+      infolen,
+      info,
+      clen - (uint32_t)16U,
+      output,
+      c,
+      c + clen - (uint32_t)16U);
+  return res1 | res2;
+}
+
+static void context_nonce(Hacl_HPKE_Curve51_CP256_SHA256_context *ctx, uint8_t *o_n)
+{
+  uint8_t seq[8U] = { 0U };
+  store64_be(seq, ctx->seq);
+  memcpy(o_n, ctx->nonce, (uint32_t)12U * sizeof (uint8_t));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    o_n[(uint32_t)4U + i] = o_n[(uint32_t)4U + i] ^ seq[i];
+  }
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP256_SHA256_setupBaseI_context(
+  Hacl_HPKE_Curve51_CP256_SHA256_context *o_ctx,
+  uint8_t *o_pkE,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  uint8_t zz[32U] = { 0U };
+  uint32_t res = encap(o_pkE, zz, skE, pkR);
+  key_schedule(o_ctx->key, o_ctx->nonce, o_ctx->exporter_secret, zz, o_pkE, pkR, infolen, info);
+  o_ctx->seq = (uint64_t)0U;
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP256_SHA256_setupBaseR_context(
+  Hacl_HPKE_Curve51_CP256_SHA256_context *o_ctx,
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  uint8_t pkR[32U] = { 0U };
+  uint8_t *pkR_ = pkR;
+  Hacl_Curve25519_51_secret_to_public(pkR_, skR);
+  uint32_t res1 = (uint32_t)0U;
+  uint8_t zz[32U] = { 0U };
+  uint32_t res20 = decap(zz, pkE, skR);
+  key_schedule(o_ctx->key, o_ctx->nonce, o_ctx->exporter_secret, zz, pkE, pkR, infolen, info);
+  o_ctx->seq = (uint64_t)0U;
+  return res1 | res20;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP256_SHA256_setupBaseR_pk(
+  uint8_t *o_key_aead,
+  uint8_t *o_nonce_aead,
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  uint8_t zz[32U] = { 0U };
+  uint32_t res = decap(zz, pkE, skR);
+  key_schedule(o_key_aead, o_nonce_aead, NULL, zz, pkE, pkR, infolen, info);
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP256_SHA256_setupBaseR_context_pk(
+  Hacl_HPKE_Curve51_CP256_SHA256_context *o_ctx,
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  uint8_t zz[32U] = { 0U };
+  uint32_t res = decap(zz, pkE, skR);
+  key_schedule(o_ctx->key, o_ctx->nonce, o_ctx->exporter_secret, zz, pkE, pkR, infolen, info);
+  o_ctx->seq = (uint64_t)0U;
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP256_SHA256_setupBaseR_many(
+  uint32_t n,
+  Hacl_HPKE_Curve51_CP256_SHA256_context *o_ctx,
+  uint32_t *o_res,
+  uint8_t **pkE,
+  uint8_t *skR,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  uint32_t res = (uint32_t)0U;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    o_res[i] = Hacl_HPKE_Curve51_CP256_SHA256_setupBaseR_context_pk(o_ctx + i, pkE[i], skR, pkR, infolen, info);
+    res = res | o_res[i];
+  }
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP256_SHA256_context_seal(
+  Hacl_HPKE_Curve51_CP256_SHA256_context *ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *output
+)
+{
+  if (ctx->seq == (uint64_t)0xffffffffffffffffU)
+  {
+    return (uint32_t)1U;
+  }
+  uint8_t n[12U] = { 0U };
+  context_nonce(ctx, n);
+  Hacl_Chacha20Poly1305_256_aead_encrypt(ctx->key,
+    n,
+    aadlen,
+    aad,
+    plainlen,
+    plain,
+    output,
+    output + plainlen);
+  ctx->seq = ctx->seq + (uint64_t)1U;
+  return (uint32_t)0U;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP256_SHA256_context_open(
+  Hacl_HPKE_Curve51_CP256_SHA256_context *ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t cipherlen,
+  uint8_t *cipher,
+  uint8_t *output
+)
+{
+  if (cipherlen < (uint32_t)16U || ctx->seq == (uint64_t)0xffffffffffffffffU)
+  {
+    return (uint32_t)1U;
+  }
+  uint8_t n[12U] = { 0U };
+  context_nonce(ctx, n);
+  uint32_t
+  res =
+    Hacl_Chacha20Poly1305_256_aead_decrypt(ctx->key,
+      n,
+      aadlen,
+      aad,
+      cipherlen - (uint32_t)16U,
+      output,
+      cipher,
+      cipher + cipherlen - (uint32_t)16U);
+  if (res == (uint32_t)0U)
+  {
+    ctx->seq = ctx->seq + (uint64_t)1U;
+  }
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP256_SHA256_context_export(
+  Hacl_HPKE_Curve51_CP256_SHA256_context *ctx,
+  uint32_t exporter_contextlen,
+  uint8_t *exporter_context,
+  uint32_t len,
+  uint8_t *output
+)
+{
+  if (len > (uint32_t)255U * (uint32_t)32U)
+  {
+    return (uint32_t)1U;
+  }
+  Hacl_HKDF_expand_sha2_256(output,
+    ctx->exporter_secret,
+    (uint32_t)32U,
+    exporter_context,
+    exporter_contextlen,
+    len);
+  return (uint32_t)0U;
+}
+
+void Hacl_HPKE_Curve51_CP256_SHA256_context_wipe(Hacl_HPKE_Curve51_CP256_SHA256_context *ctx)
+{
+  Lib_Memzero0_memzero(ctx, sizeof (ctx[0U]));
+}
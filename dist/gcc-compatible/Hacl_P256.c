@@ -24,6 +24,8 @@
 
 #include "Hacl_P256.h"
 
+#include "Hacl_P256_PrecompTable.h"
+
 static uint64_t isZero_uint64_CT(uint64_t *f)
 {
   uint64_t a0 = f[0U];
@@ -1462,6 +1464,76 @@ static void normX(uint64_t *p, uint64_t *result, uint64_t *tempBuffer)
   montgomery_multiplication_buffer_by_one(z2f, result);
 }
 
+/*
+  Normalizes n <= 16 points at once with Montgomery's simultaneous inversion:
+  a single exponent for the whole batch, instead of two per point in norm, plus
+  a few multiplications per point. Points at infinity take part with z = 1 and
+  are masked out afterwards, so the function stays constant time, and their
+  result is (0, 0, 0) as with norm.
+*/
+static void norm_many(uint32_t n, uint64_t *p, uint64_t *resultPoint)
+{
+  uint64_t prefix[64U] = { 0U };
+  uint64_t zs[64U] = { 0U };
+  uint64_t tempBuffer[20U] = { 0U };
+  uint64_t inv[4U] = { 0U };
+  uint64_t zinv[4U] = { 0U };
+  uint64_t z2f[4U] = { 0U };
+  uint64_t z3f[4U] = { 0U };
+  uint64_t zeroBuffer[4U] = { 0U };
+  uint64_t oneDomain[4U] = { 0U };
+  oneDomain[0U] = (uint64_t)1U;
+  oneDomain[1U] = (uint64_t)18446744069414584320U;
+  oneDomain[2U] = (uint64_t)18446744073709551615U;
+  oneDomain[3U] = (uint64_t)4294967294U;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint64_t *zi = zs + i * (uint32_t)4U;
+    uint64_t bit = Hacl_Impl_P256_Core_isPointAtInfinityPrivate(p + i * (uint32_t)12U);
+    memcpy(zi, p + i * (uint32_t)12U + (uint32_t)8U, (uint32_t)4U * sizeof (uint64_t));
+    copy_conditional(zi, oneDomain, bit);
+    if (i == (uint32_t)0U)
+    {
+      memcpy(prefix, zi, (uint32_t)4U * sizeof (uint64_t));
+    }
+    else
+    {
+      montgomery_multiplication_buffer(prefix + (i - (uint32_t)1U) * (uint32_t)4U,
+        zi,
+        prefix + i * (uint32_t)4U);
+    }
+  }
+  exponent(prefix + (n - (uint32_t)1U) * (uint32_t)4U, inv, tempBuffer);
+  for (uint32_t i0 = (uint32_t)0U; i0 < n; i0++)
+  {
+    uint32_t i = n - (uint32_t)1U - i0;
+    uint64_t *pi = p + i * (uint32_t)12U;
+    uint64_t *resultX = resultPoint + i * (uint32_t)12U;
+    uint64_t *resultY = resultPoint + i * (uint32_t)12U + (uint32_t)4U;
+    uint64_t *resultZ = resultPoint + i * (uint32_t)12U + (uint32_t)8U;
+    if (i == (uint32_t)0U)
+    {
+      memcpy(zinv, inv, (uint32_t)4U * sizeof (uint64_t));
+    }
+    else
+    {
+      montgomery_multiplication_buffer(inv, prefix + (i - (uint32_t)1U) * (uint32_t)4U, zinv);
+      montgomery_multiplication_buffer(inv, zs + i * (uint32_t)4U, inv);
+    }
+    montgomery_square_buffer(zinv, z2f);
+    montgomery_multiplication_buffer(z2f, zinv, z3f);
+    montgomery_multiplication_buffer(pi, z2f, z2f);
+    montgomery_multiplication_buffer(pi + (uint32_t)4U, z3f, z3f);
+    uint64_t bit = Hacl_Impl_P256_Core_isPointAtInfinityPrivate(pi);
+    montgomery_multiplication_buffer_by_one(z2f, resultX);
+    montgomery_multiplication_buffer_by_one(z3f, resultY);
+    uploadOneImpl(resultZ);
+    copy_conditional(resultX, zeroBuffer, bit);
+    copy_conditional(resultY, zeroBuffer, bit);
+    copy_conditional(resultZ, zeroBuffer, bit);
+  }
+}
+
 static void zero_buffer(uint64_t *p)
 {
   p[0U] = (uint64_t)0U;
@@ -1525,22 +1597,6 @@ scalarMultiplicationC(
   norm(q, result, buff);
 }
 
-static void uploadBasePoint(uint64_t *p)
-{
-  p[0U] = (uint64_t)8784043285714375740U;
-  p[1U] = (uint64_t)8483257759279461889U;
-  p[2U] = (uint64_t)8789745728267363600U;
-  p[3U] = (uint64_t)1770019616739251654U;
-  p[4U] = (uint64_t)15992936863339206154U;
-  p[5U] = (uint64_t)10037038012062884956U;
-  p[6U] = (uint64_t)15197544864945402661U;
-  p[7U] = (uint64_t)9615747158586711429U;
-  p[8U] = (uint64_t)1U;
-  p[9U] = (uint64_t)18446744069414584320U;
-  p[10U] = (uint64_t)18446744073709551615U;
-  p[11U] = (uint64_t)4294967294U;
-}
-
 static void
 scalarMultiplicationWithoutNorm(
   uint64_t *p,
@@ -1567,46 +1623,93 @@ scalarMultiplicationWithoutNorm(
   copy_point(q, result);
 }
 
+/*
+  Constant-time fixed-base multiplication. The big-endian scalar is recoded into
+  65 signed radix-16 digits e_i in [-8, 8] (the last one is the final carry, 0 or
+  1), and [k]G = sum [e_i](16^i G) is accumulated from the precomputed table
+  without any doubling. Every lookup scans its whole row with masks and
+  negates with a mask.
+
+  The partial sum before step i is strictly smaller than 16^i in absolute value,
+  so it never equals [e_i](16^i G) and point_add never meets the doubling case.
+*/
+static void recode_radix16(int8_t *e, uint8_t *scalar)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)32U; i++)
+  {
+    uint8_t b = scalar[(uint32_t)31U - i];
+    e[(uint32_t)2U * i] = (int8_t)(b & (uint8_t)15U);
+    e[(uint32_t)2U * i + (uint32_t)1U] = (int8_t)(b >> (uint32_t)4U);
+  }
+  int8_t carry = (int8_t)0;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)64U; i++)
+  {
+    e[i] = (int8_t)(e[i] + carry);
+    carry = (int8_t)((e[i] + (int8_t)8) >> (uint32_t)4U);
+    e[i] = (int8_t)(e[i] - carry * (int8_t)16);
+  }
+  e[64U] = carry;
+}
+
+static void precomp_basepoint_select(uint64_t *out, uint32_t row, int8_t b)
+{
+  uint64_t zero[4U] = { 0U };
+  uint64_t ny[4U] = { 0U };
+  uint32_t ub = (uint32_t)(int32_t)b;
+  uint32_t neg = ub >> (uint32_t)31U;
+  uint64_t babs = (uint64_t)((ub ^ ((uint32_t)0U - neg)) + neg);
+  uint64_t *x = out;
+  uint64_t *y = out + (uint32_t)4U;
+  uint64_t *z = out + (uint32_t)8U;
+  zero_buffer(out);
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+  {
+    uint64_t mask = FStar_UInt64_eq_mask(babs, (uint64_t)(j + (uint32_t)1U));
+    const
+    uint64_t
+    *e = Hacl_P256_PrecompTable_precomp_basepoint_table_radix16 + (row * (uint32_t)8U + j) * (uint32_t)8U;
+    for (uint32_t k = (uint32_t)0U; k < (uint32_t)4U; k++)
+    {
+      x[k] = x[k] ^ (mask & (x[k] ^ e[k]));
+      y[k] = y[k] ^ (mask & (y[k] ^ e[k + (uint32_t)4U]));
+    }
+  }
+  uint64_t nonzero = ~FStar_UInt64_eq_mask(babs, (uint64_t)0U);
+  z[0U] = (uint64_t)1U & nonzero;
+  z[1U] = (uint64_t)18446744069414584320U & nonzero;
+  z[2U] = (uint64_t)18446744073709551615U & nonzero;
+  z[3U] = (uint64_t)4294967294U & nonzero;
+  p256_sub(zero, y, ny);
+  copy_conditional(y, ny, (uint64_t)0U - (uint64_t)neg);
+}
+
+static void point_mul_g_comb(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
+{
+  int8_t e[65U] = { 0U };
+  uint64_t pt[12U] = { 0U };
+  recode_radix16(e, scalar);
+  zero_buffer(result);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)65U; i++)
+  {
+    precomp_basepoint_select(pt, i, e[i]);
+    point_add(result, pt, result, tempBuffer);
+  }
+}
+
 void
 Hacl_Impl_P256_Core_secretToPublic(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
 {
-  uint64_t basePoint[12U] = { 0U };
-  uploadBasePoint(basePoint);
   uint64_t *q = tempBuffer;
   uint64_t *buff = tempBuffer + (uint32_t)12U;
-  zero_buffer(q);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
-  {
-    uint32_t bit0 = (uint32_t)255U - i;
-    uint64_t
-    bit =
-      (uint64_t)(scalar[(uint32_t)31U - bit0 / (uint32_t)8U] >> bit0 % (uint32_t)8U & (uint8_t)1U);
-    cswap(bit, q, basePoint);
-    point_add(q, basePoint, basePoint, buff);
-    point_double(q, q, buff);
-    cswap(bit, q, basePoint);
-  }
+  point_mul_g_comb(q, scalar, buff);
   norm(q, result, buff);
 }
 
 static void secretToPublicWithoutNorm(uint64_t *result, uint8_t *scalar, uint64_t *tempBuffer)
 {
-  uint64_t basePoint[12U] = { 0U };
-  uploadBasePoint(basePoint);
   uint64_t *q = tempBuffer;
   uint64_t *buff = tempBuffer + (uint32_t)12U;
-  zero_buffer(q);
-  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
-  {
-    uint32_t bit0 = (uint32_t)255U - i;
-    uint64_t
-    bit =
-      (uint64_t)(scalar[(uint32_t)31U - bit0 / (uint32_t)8U] >> bit0 % (uint32_t)8U & (uint8_t)1U);
-    cswap(bit, q, basePoint);
-    point_add(q, basePoint, basePoint, buff);
-    point_double(q, q, buff);
-    cswap(bit, q, basePoint);
-  }
+  point_mul_g_comb(q, scalar, buff);
   copy_point(q, result);
 }
 
@@ -1972,6 +2075,63 @@ uint64_t Hacl_Impl_P256_DH__ecp256dh_r(uint64_t *result, uint64_t *pubKey, uint8
   return (uint64_t)18446744073709551615U;
 }
 
+/*
+  ecp256dh_r for n <= 16 independent (pubKey, scalar) pairs, normalizing all the
+  results with a single inversion.
+*/
+static bool
+ecp256dh_r_many_(uint32_t n, uint8_t **result, uint8_t **pubKey, uint8_t **scalar, bool *success)
+{
+  uint64_t tempBuffer[100U] = { 0U };
+  uint64_t points[192U] = { 0U };
+  uint64_t normed[192U] = { 0U };
+  uint32_t idx[16U] = { 0U };
+  uint32_t m = (uint32_t)0U;
+  bool all = true;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint64_t publicKeyAsFelem[8U] = { 0U };
+    uint64_t publicKeyBuffer[12U] = { 0U };
+    Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(pubKey[i], publicKeyAsFelem);
+    Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(pubKey[i] + (uint32_t)32U,
+      publicKeyAsFelem + (uint32_t)4U);
+    bufferToJac(publicKeyAsFelem, publicKeyBuffer);
+    if (verifyQValidCurvePoint(publicKeyBuffer, tempBuffer))
+    {
+      scalarMultiplicationWithoutNorm(publicKeyBuffer,
+        points + m * (uint32_t)12U,
+        scalar[i],
+        tempBuffer);
+      idx[m] = i;
+      m++;
+    }
+    else
+    {
+      memset(result[i], 0U, (uint32_t)64U * sizeof (uint8_t));
+      success[i] = false;
+      all = false;
+    }
+  }
+  if (m == (uint32_t)0U)
+  {
+    return all;
+  }
+  norm_many(m, points, normed);
+  for (uint32_t j = (uint32_t)0U; j < m; j++)
+  {
+    uint64_t *resultX = normed + j * (uint32_t)12U;
+    uint64_t *resultY = normed + j * (uint32_t)12U + (uint32_t)4U;
+    uint64_t flag = Hacl_Impl_P256_Core_isPointAtInfinityPrivate(normed + j * (uint32_t)12U);
+    Hacl_Impl_P256_LowLevel_changeEndian(resultX);
+    Hacl_Impl_P256_LowLevel_changeEndian(resultY);
+    Hacl_Impl_P256_LowLevel_toUint8(resultX, result[idx[j]]);
+    Hacl_Impl_P256_LowLevel_toUint8(resultY, result[idx[j]] + (uint32_t)32U);
+    success[idx[j]] = flag == (uint64_t)0U;
+    all = all && success[idx[j]];
+  }
+  return all;
+}
+
 static inline void cswap0(uint64_t bit, uint64_t *p1, uint64_t *p2)
 {
   uint64_t mask = (uint64_t)0U - bit;
@@ -2058,112 +2218,196 @@ static bool compare_felem_bool(uint64_t *a, uint64_t *b)
 }
 
 /*
-   The input of the function is considered to be public,
-thus this code is not secret independent with respect to the operations done over the input.
+   The inputs of the functions below are considered to be public,
+thus this code is not secret independent with respect to the operations done over them.
 */
-static bool
-ecdsa_verification_(
-  Spec_ECDSA_hash_alg_ecdsa alg,
-  uint64_t *pubKey,
-  uint64_t *r,
-  uint64_t *s,
-  uint32_t mLen,
-  uint8_t *m
-)
-{
-  uint64_t tempBufferU64[120U] = { 0U };
-  uint64_t *publicKeyBuffer = tempBufferU64;
-  uint64_t *hashAsFelem = tempBufferU64 + (uint32_t)12U;
-  uint64_t *tempBuffer = tempBufferU64 + (uint32_t)16U;
-  uint64_t *xBuffer = tempBufferU64 + (uint32_t)116U;
-  bufferToJac(pubKey, publicKeyBuffer);
-  bool publicKeyCorrect = verifyQValidCurvePoint(publicKeyBuffer, tempBuffer);
-  if (publicKeyCorrect == false)
+static bool point_equal_public(uint64_t *p, uint64_t *q)
+{
+  uint64_t tmp[24U] = { 0U };
+  uint64_t *z1Square = tmp;
+  uint64_t *z2Square = tmp + (uint32_t)4U;
+  uint64_t *a = tmp + (uint32_t)8U;
+  uint64_t *b = tmp + (uint32_t)12U;
+  uint64_t *z1Cube = tmp + (uint32_t)16U;
+  uint64_t *z2Cube = tmp + (uint32_t)20U;
+  montgomery_square_buffer(p + (uint32_t)8U, z1Square);
+  montgomery_square_buffer(q + (uint32_t)8U, z2Square);
+  montgomery_multiplication_buffer(p, z2Square, a);
+  montgomery_multiplication_buffer(q, z1Square, b);
+  if (!compare_felem_bool(a, b))
   {
     return false;
   }
-  bool isRCorrect = isMoreThanZeroLessThanOrderMinusOne(r);
-  bool isSCorrect = isMoreThanZeroLessThanOrderMinusOne(s);
-  bool step1 = isRCorrect && isSCorrect;
-  if (step1 == false)
+  montgomery_multiplication_buffer(z1Square, p + (uint32_t)8U, z1Cube);
+  montgomery_multiplication_buffer(z2Square, q + (uint32_t)8U, z2Cube);
+  montgomery_multiplication_buffer(p + (uint32_t)4U, z2Cube, a);
+  montgomery_multiplication_buffer(q + (uint32_t)4U, z1Cube, b);
+  return compare_felem_bool(a, b);
+}
+
+/* point_add, falling back to point_double when both inputs are the same point. */
+static void point_add_public(uint64_t *p, uint64_t *q, uint64_t *result, uint64_t *tempBuffer)
+{
+  uint64_t pc[12U] = { 0U };
+  bool notInfinity = !isPointAtInfinityPublic(p) && !isPointAtInfinityPublic(q);
+  copy_point(p, pc);
+  point_add(p, q, result, tempBuffer);
+  if (notInfinity && isPointAtInfinityPublic(result) && point_equal_public(pc, q))
   {
-    return false;
+    point_double(pc, result, tempBuffer);
   }
-  uint8_t tempBufferU8[64U] = { 0U };
-  uint8_t *bufferU1 = tempBufferU8;
-  uint8_t *bufferU2 = tempBufferU8 + (uint32_t)32U;
-  uint32_t sz;
-  if (alg.tag == Spec_ECDSA_NoHash)
+}
+
+/*
+  Scalars are recoded in width-w non-adjacent form, from their 64-bit limbs:
+  digits are zero or odd, in [-(2^(w-1) - 1), 2^(w-1) - 1], with on average
+  256/(w+1) of them non-zero. One extra digit takes the final carry.
+*/
+static void slide(int8_t *r, uint64_t *scalar, uint32_t w)
+{
+  int32_t bound = ((int32_t)1 << (w - (uint32_t)1U)) - (int32_t)1;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)256U; i++)
   {
-    sz = mLen;
+    r[i] = (int8_t)((uint64_t)1U & scalar[i / (uint32_t)64U] >> i % (uint32_t)64U);
   }
-  else if (alg.tag == Spec_ECDSA_Hash)
+  r[256U] = (int8_t)0;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)257U; i++)
   {
-    Spec_Hash_Definitions_hash_alg a = alg._0;
-    switch (a)
+    if (r[i] != (int8_t)0)
     {
-      case Spec_Hash_Definitions_MD5:
+      for (uint32_t b = (uint32_t)1U; b <= w + (uint32_t)1U && i + b < (uint32_t)257U; b++)
+      {
+        if (r[i + b] != (int8_t)0)
         {
-          sz = (uint32_t)16U;
-          break;
-        }
-      case Spec_Hash_Definitions_SHA1:
-        {
-          sz = (uint32_t)20U;
-          break;
-        }
-      case Spec_Hash_Definitions_SHA2_224:
-        {
-          sz = (uint32_t)28U;
-          break;
-        }
-      case Spec_Hash_Definitions_SHA2_256:
-        {
-          sz = (uint32_t)32U;
-          break;
-        }
-      case Spec_Hash_Definitions_SHA2_384:
-        {
-          sz = (uint32_t)48U;
-          break;
-        }
-      case Spec_Hash_Definitions_SHA2_512:
-        {
-          sz = (uint32_t)64U;
-          break;
-        }
-      case Spec_Hash_Definitions_Blake2S:
-        {
-          sz = (uint32_t)32U;
-          break;
-        }
-      case Spec_Hash_Definitions_Blake2B:
-        {
-          sz = (uint32_t)64U;
-          break;
-        }
-      default:
-        {
-          KRML_HOST_EPRINTF("KreMLin incomplete match at %s:%d\n", __FILE__, __LINE__);
-          KRML_HOST_EXIT(253U);
+          int32_t ri = (int32_t)r[i];
+          int32_t rb = (int32_t)r[i + b] * ((int32_t)1 << b);
+          if (ri + rb <= bound)
+          {
+            r[i] = (int8_t)(ri + rb);
+            r[i + b] = (int8_t)0;
+          }
+          else if (ri - rb >= -bound)
+          {
+            r[i] = (int8_t)(ri - rb);
+            for (uint32_t k = i + b; k < (uint32_t)257U; k++)
+            {
+              if (r[k] == (int8_t)0)
+              {
+                r[k] = (int8_t)1;
+                break;
+              }
+              r[k] = (int8_t)0;
+            }
+          }
+          else
+          {
+            break;
+          }
         }
+      }
     }
   }
-  else
+}
+
+static void point_negate_public(uint64_t *p, uint64_t *result)
+{
+  uint64_t zero[4U] = { 0U };
+  memcpy(result, p, (uint32_t)4U * sizeof (uint64_t));
+  p256_sub(zero, p + (uint32_t)4U, result + (uint32_t)4U);
+  memcpy(result + (uint32_t)8U, p + (uint32_t)8U, (uint32_t)4U * sizeof (uint64_t));
+}
+
+/*
+  [u1]G + [u2]Q in one pass of shared doublings (Straus): u1 uses a width-7 NAF
+  against the static odd multiples of G, u2 a width-5 NAF against [1]Q, [3]Q, ...,
+  [15]Q. Q is in the Montgomery domain; the result is not normalized.
+*/
+static void
+point_mul_double_g_public(
+  uint64_t *result,
+  uint64_t *u1,
+  uint64_t *u2,
+  uint64_t *q,
+  uint64_t *tempBuffer
+)
+{
+  uint64_t tableQ[96U] = { 0U };
+  uint64_t q2[12U] = { 0U };
+  uint64_t pt[12U] = { 0U };
+  int8_t naf1[257U] = { 0U };
+  int8_t naf2[257U] = { 0U };
+  copy_point(q, tableQ);
+  point_double(q, q2, tempBuffer);
+  for (uint32_t i = (uint32_t)1U; i < (uint32_t)8U; i++)
   {
-    sz = KRML_EABORT(uint32_t, "unreachable (pattern matches are exhaustive in F*)");
+    point_add_public(tableQ + (i - (uint32_t)1U) * (uint32_t)12U,
+      q2,
+      tableQ + i * (uint32_t)12U,
+      tempBuffer);
   }
-  KRML_CHECK_SIZE(sizeof (uint8_t), sz);
-  uint8_t mHash[sz];
-  memset(mHash, 0U, sz * sizeof (uint8_t));
-  if (alg.tag == Spec_ECDSA_NoHash)
+  slide(naf1, u1, (uint32_t)7U);
+  slide(naf2, u2, (uint32_t)5U);
+  zero_buffer(result);
+  uint32_t top = (uint32_t)257U;
+  while (top > (uint32_t)0U && naf1[top - (uint32_t)1U] == (int8_t)0
+    && naf2[top - (uint32_t)1U] == (int8_t)0)
   {
-    memcpy(mHash, m, sz * sizeof (uint8_t));
+    top--;
   }
-  else if (alg.tag == Spec_ECDSA_Hash)
+  for (uint32_t i0 = (uint32_t)0U; i0 < top; i0++)
   {
-    Spec_Hash_Definitions_hash_alg a = alg._0;
-    switch (a)
+    uint32_t i = top - (uint32_t)1U - i0;
+    point_double(result, result, tempBuffer);
+    int8_t d1 = naf1[i];
+    if (d1 != (int8_t)0)
+    {
+      uint32_t j = d1 > (int8_t)0 ? (uint32_t)(d1 / (int8_t)2) : (uint32_t)(-d1 / (int8_t)2);
+      const uint64_t *e = Hacl_P256_PrecompTable_precomp_basepoint_table_odd_w7 + j * (uint32_t)8U;
+      memcpy(pt, e, (uint32_t)8U * sizeof (uint64_t));
+      pt[8U] = (uint64_t)1U;
+      pt[9U] = (uint64_t)18446744069414584320U;
+      pt[10U] = (uint64_t)18446744073709551615U;
+      pt[11U] = (uint64_t)4294967294U;
+      if (d1 < (int8_t)0)
+      {
+        point_negate_public(pt, pt);
+      }
+      point_add_public(result, pt, result, tempBuffer);
+    }
+    int8_t d2 = naf2[i];
+    if (d2 != (int8_t)0)
+    {
+      uint32_t j = d2 > (int8_t)0 ? (uint32_t)(d2 / (int8_t)2) : (uint32_t)(-d2 / (int8_t)2);
+      if (d2 < (int8_t)0)
+      {
+        point_negate_public(tableQ + j * (uint32_t)12U, pt);
+      }
+      else
+      {
+        copy_point(tableQ + j * (uint32_t)12U, pt);
+      }
+      point_add_public(result, pt, result, tempBuffer);
+    }
+  }
+}
+
+/*
+  Hashes m with alg (or takes its first 32 bytes for NoHash) and reduces the
+  result modulo the order, as ECDSA verification expects.
+*/
+static void
+ecdsa_hash_as_felem(
+  Spec_ECDSA_hash_alg_ecdsa alg,
+  uint32_t mLen,
+  uint8_t *m,
+  uint64_t *hashAsFelem
+)
+{
+  uint8_t mHash[64U] = { 0U };
+  uint8_t *cutHash = m;
+  if (alg.tag == Spec_ECDSA_Hash)
+  {
+    switch (alg._0)
     {
       case Spec_Hash_Definitions_SHA2_256:
         {
@@ -2186,18 +2430,45 @@ ecdsa_verification_(
           KRML_HOST_EXIT(253U);
         }
     }
+    cutHash = mHash;
   }
-  else
-  {
-    KRML_HOST_EPRINTF("KreMLin abort at %s:%d\n%s\n",
-      __FILE__,
-      __LINE__,
-      "unreachable (pattern matches are exhaustive in F*)");
-    KRML_HOST_EXIT(255U);
-  }
-  uint8_t *cutHash = mHash;
   Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(cutHash, hashAsFelem);
   reduction_prime_2prime_order(hashAsFelem, hashAsFelem);
+}
+
+/*
+   The input of the function is considered to be public,
+thus this code is not secret independent with respect to the operations done over the input.
+*/
+static bool
+ecdsa_verification_(
+  Spec_ECDSA_hash_alg_ecdsa alg,
+  uint64_t *pubKey,
+  uint64_t *r,
+  uint64_t *s,
+  uint32_t mLen,
+  uint8_t *m
+)
+{
+  uint64_t tempBufferU64[120U] = { 0U };
+  uint64_t *publicKeyBuffer = tempBufferU64;
+  uint64_t *hashAsFelem = tempBufferU64 + (uint32_t)12U;
+  uint64_t *tempBuffer = tempBufferU64 + (uint32_t)16U;
+  uint64_t *xBuffer = tempBufferU64 + (uint32_t)116U;
+  bufferToJac(pubKey, publicKeyBuffer);
+  bool publicKeyCorrect = verifyQValidCurvePoint(publicKeyBuffer, tempBuffer);
+  if (publicKeyCorrect == false)
+  {
+    return false;
+  }
+  bool isRCorrect = isMoreThanZeroLessThanOrderMinusOne(r);
+  bool isSCorrect = isMoreThanZeroLessThanOrderMinusOne(s);
+  bool step1 = isRCorrect && isSCorrect;
+  if (step1 == false)
+  {
+    return false;
+  }
+  ecdsa_hash_as_felem(alg, mLen, m, hashAsFelem);
   uint64_t tempBuffer1[12U] = { 0U };
   uint64_t *inverseS = tempBuffer1;
   uint64_t *u1 = tempBuffer1 + (uint32_t)4U;
@@ -2206,46 +2477,11 @@ ecdsa_verification_(
   montgomery_ladder_exponent(inverseS);
   multPowerPartial(inverseS, hashAsFelem, u1);
   multPowerPartial(inverseS, r, u2);
-  Hacl_Impl_P256_LowLevel_changeEndian(u1);
-  Hacl_Impl_P256_LowLevel_changeEndian(u2);
-  Hacl_Impl_P256_LowLevel_toUint8(u1, bufferU1);
-  Hacl_Impl_P256_LowLevel_toUint8(u2, bufferU2);
   uint64_t pointSum[12U] = { 0U };
-  uint64_t points[24U] = { 0U };
+  uint64_t publicKeyDomain[12U] = { 0U };
   uint64_t *buff = tempBuffer + (uint32_t)12U;
-  uint64_t *pointU1G = points;
-  uint64_t *pointU2Q0 = points + (uint32_t)12U;
-  secretToPublicWithoutNorm(pointU1G, bufferU1, tempBuffer);
-  scalarMultiplicationWithoutNorm(publicKeyBuffer, pointU2Q0, bufferU2, tempBuffer);
-  uint64_t *pointU1G0 = points;
-  uint64_t *pointU2Q = points + (uint32_t)12U;
-  uint64_t tmp[112U] = { 0U };
-  uint64_t *tmpForNorm = tmp;
-  uint64_t *result0Norm = tmp + (uint32_t)88U;
-  uint64_t *result1Norm = tmp + (uint32_t)100U;
-  uint64_t *pointU1G1 = points;
-  uint64_t *pointU2Q1 = points + (uint32_t)12U;
-  norm(pointU1G1, result0Norm, tmpForNorm);
-  norm(pointU2Q1, result1Norm, tmpForNorm);
-  uint64_t *x0 = result0Norm;
-  uint64_t *y0 = result0Norm + (uint32_t)4U;
-  uint64_t *z0 = result0Norm + (uint32_t)8U;
-  uint64_t *x1 = result1Norm;
-  uint64_t *y1 = result1Norm + (uint32_t)4U;
-  uint64_t *z1 = result1Norm + (uint32_t)8U;
-  bool xEqual = compare_felem_bool(x0, x1);
-  bool yEqual = compare_felem_bool(y0, y1);
-  bool zEqual = compare_felem_bool(z0, z1);
-  bool equalX = xEqual && yEqual && zEqual;
-  bool equalX0 = equalX;
-  if (equalX0)
-  {
-    point_double(pointU1G0, pointSum, buff);
-  }
-  else
-  {
-    point_add(pointU1G0, pointU2Q, pointSum, buff);
-  }
+  pointToDomain(publicKeyBuffer, publicKeyDomain);
+  point_mul_double_g_public(pointSum, u1, u2, publicKeyDomain, buff);
   norm(pointSum, pointSum, buff);
   bool resultIsPAI = isPointAtInfinityPublic(pointSum);
   uint64_t *xCoordinateSum = pointSum;
@@ -2261,6 +2497,123 @@ ecdsa_verification_(
   return result;
 }
 
+/*
+   The input of the function is considered to be public,
+thus this code is not secret independent with respect to the operations done over the input.
+
+  ecdsa_verification_ for n <= 16 signatures. The inverses of all s share a
+  single exponentiation modulo the order, and the final points share a single
+  inversion modulo p (Montgomery's simultaneous-inversion trick).
+*/
+static bool
+ecdsa_verification_many_(
+  Spec_ECDSA_hash_alg_ecdsa alg,
+  uint32_t n,
+  uint32_t *mLen,
+  uint8_t **m,
+  uint8_t **pubKey,
+  uint8_t **r,
+  uint8_t **s,
+  bool *valid
+)
+{
+  uint64_t tempBuffer[100U] = { 0U };
+  uint64_t qs[192U] = { 0U };
+  uint64_t sums[192U] = { 0U };
+  uint64_t normed[192U] = { 0U };
+  uint64_t rs[64U] = { 0U };
+  uint64_t hs[64U] = { 0U };
+  uint64_t ts[64U] = { 0U };
+  uint64_t prefix[64U] = { 0U };
+  uint32_t idx[16U] = { 0U };
+  uint32_t k = (uint32_t)0U;
+  bool all = true;
+  for (uint32_t i = (uint32_t)0U; i < n; i++)
+  {
+    uint64_t publicKeyAsFelem[8U] = { 0U };
+    uint64_t publicKeyBuffer[12U] = { 0U };
+    uint64_t sAsFelem[4U] = { 0U };
+    uint64_t *rAsFelem = rs + k * (uint32_t)4U;
+    Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(pubKey[i], publicKeyAsFelem);
+    Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(pubKey[i] + (uint32_t)32U,
+      publicKeyAsFelem + (uint32_t)4U);
+    Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(r[i], rAsFelem);
+    Hacl_Impl_P256_LowLevel_toUint64ChangeEndian(s[i], sAsFelem);
+    bufferToJac(publicKeyAsFelem, publicKeyBuffer);
+    bool
+    ok =
+      verifyQValidCurvePoint(publicKeyBuffer, tempBuffer)
+      && isMoreThanZeroLessThanOrderMinusOne(rAsFelem)
+      && isMoreThanZeroLessThanOrderMinusOne(sAsFelem);
+    valid[i] = ok;
+    if (!ok)
+    {
+      all = false;
+    }
+    else
+    {
+      uint64_t *t = ts + k * (uint32_t)4U;
+      pointToDomain(publicKeyBuffer, qs + k * (uint32_t)12U);
+      ecdsa_hash_as_felem(alg, mLen[i], m[i], hs + k * (uint32_t)4U);
+      fromDomainImpl(sAsFelem, t);
+      if (k == (uint32_t)0U)
+      {
+        memcpy(prefix, t, (uint32_t)4U * sizeof (uint64_t));
+      }
+      else
+      {
+        montgomery_multiplication_ecdsa_module(prefix + (k - (uint32_t)1U) * (uint32_t)4U,
+          t,
+          prefix + k * (uint32_t)4U);
+      }
+      idx[k] = i;
+      k++;
+    }
+  }
+  if (k == (uint32_t)0U)
+  {
+    return all;
+  }
+  uint64_t inv[4U] = { 0U };
+  memcpy(inv, prefix + (k - (uint32_t)1U) * (uint32_t)4U, (uint32_t)4U * sizeof (uint64_t));
+  montgomery_ladder_exponent(inv);
+  for (uint32_t j0 = (uint32_t)0U; j0 < k; j0++)
+  {
+    uint32_t j = k - (uint32_t)1U - j0;
+    uint64_t inverseS[4U] = { 0U };
+    uint64_t u1[4U] = { 0U };
+    uint64_t u2[4U] = { 0U };
+    if (j == (uint32_t)0U)
+    {
+      memcpy(inverseS, inv, (uint32_t)4U * sizeof (uint64_t));
+    }
+    else
+    {
+      montgomery_multiplication_ecdsa_module(inv, prefix + (j - (uint32_t)1U) * (uint32_t)4U, inverseS);
+      montgomery_multiplication_ecdsa_module(inv, ts + j * (uint32_t)4U, inv);
+    }
+    multPowerPartial(inverseS, hs + j * (uint32_t)4U, u1);
+    multPowerPartial(inverseS, rs + j * (uint32_t)4U, u2);
+    point_mul_double_g_public(sums + j * (uint32_t)12U,
+      u1,
+      u2,
+      qs + j * (uint32_t)12U,
+      tempBuffer + (uint32_t)12U);
+  }
+  norm_many(k, sums, normed);
+  for (uint32_t j = (uint32_t)0U; j < k; j++)
+  {
+    uint64_t xBuffer[4U] = { 0U };
+    bool resultIsPAI = isPointAtInfinityPublic(normed + j * (uint32_t)12U);
+    memcpy(xBuffer, normed + j * (uint32_t)12U, (uint32_t)4U * sizeof (uint64_t));
+    reduction_prime_2prime_order(xBuffer, xBuffer);
+    bool ok = !resultIsPAI && compare_felem_bool(xBuffer, rs + j * (uint32_t)4U);
+    valid[idx[j]] = ok;
+    all = all && ok;
+  }
+  return all;
+}
+
 static uint64_t
 ecdsa_signature_core(
   Spec_ECDSA_hash_alg_ecdsa alg,
@@ -2822,6 +3175,104 @@ Hacl_P256_ecdsa_verif_without_hash(
   return result;
 }
 
+static bool
+ecdsa_verification_many(
+  Spec_ECDSA_hash_alg_ecdsa alg,
+  uint32_t n,
+  uint32_t *mLen,
+  uint8_t **m,
+  uint8_t **pubKey,
+  uint8_t **r,
+  uint8_t **s,
+  bool *valid
+)
+{
+  bool all = true;
+  for (uint32_t i = (uint32_t)0U; i < n; i = i + (uint32_t)16U)
+  {
+    uint32_t k = n - i < (uint32_t)16U ? n - i : (uint32_t)16U;
+    bool ok = ecdsa_verification_many_(alg, k, mLen + i, m + i, pubKey + i, r + i, s + i, valid + i);
+    all = all && ok;
+  }
+  return all;
+}
+
+/*
+ ecdsa_verif_p256_sha2 for n signatures: valid[i] is set to the result for (m[i], pubKey[i], r[i], s[i]).
+  
+ Output: bool, where true stands for all n signatures being correct.
+*/
+bool
+Hacl_P256_ecdsa_verif_p256_sha2_many(
+  uint32_t n,
+  uint32_t *mLen,
+  uint8_t **m,
+  uint8_t **pubKey,
+  uint8_t **r,
+  uint8_t **s,
+  bool *valid
+)
+{
+  return ecdsa_verification_many(((Spec_ECDSA_hash_alg_ecdsa){ .tag = Spec_ECDSA_Hash, ._0 = Spec_Hash_Definitions_SHA2_256 }), n, mLen, m, pubKey, r, s, valid);
+}
+
+/*
+ ecdsa_verif_p256_sha384 for n signatures: valid[i] is set to the result for (m[i], pubKey[i], r[i], s[i]).
+  
+ Output: bool, where true stands for all n signatures being correct.
+*/
+bool
+Hacl_P256_ecdsa_verif_p256_sha384_many(
+  uint32_t n,
+  uint32_t *mLen,
+  uint8_t **m,
+  uint8_t **pubKey,
+  uint8_t **r,
+  uint8_t **s,
+  bool *valid
+)
+{
+  return ecdsa_verification_many(((Spec_ECDSA_hash_alg_ecdsa){ .tag = Spec_ECDSA_Hash, ._0 = Spec_Hash_Definitions_SHA2_384 }), n, mLen, m, pubKey, r, s, valid);
+}
+
+/*
+ ecdsa_verif_p256_sha512 for n signatures: valid[i] is set to the result for (m[i], pubKey[i], r[i], s[i]).
+  
+ Output: bool, where true stands for all n signatures being correct.
+*/
+bool
+Hacl_P256_ecdsa_verif_p256_sha512_many(
+  uint32_t n,
+  uint32_t *mLen,
+  uint8_t **m,
+  uint8_t **pubKey,
+  uint8_t **r,
+  uint8_t **s,
+  bool *valid
+)
+{
+  return ecdsa_verification_many(((Spec_ECDSA_hash_alg_ecdsa){ .tag = Spec_ECDSA_Hash, ._0 = Spec_Hash_Definitions_SHA2_512 }), n, mLen, m, pubKey, r, s, valid);
+}
+
+/*
+ ecdsa_verif_without_hash for n signatures: valid[i] is set to the result for (m[i], pubKey[i], r[i], s[i]).
+  
+ Output: bool, where true stands for all n signatures being correct.
+*/
+bool
+Hacl_P256_ecdsa_verif_without_hash_many(
+  uint32_t n,
+  uint32_t *mLen,
+  uint8_t **m,
+  uint8_t **pubKey,
+  uint8_t **r,
+  uint8_t **s,
+  bool *valid
+)
+{
+  return ecdsa_verification_many(((Spec_ECDSA_hash_alg_ecdsa){ .tag = Spec_ECDSA_NoHash }), n, mLen, m, pubKey, r, s, valid);
+}
+
 /*
  Public key verification function. 
   
@@ -3009,6 +3460,31 @@ bool Hacl_P256_ecp256dh_r(uint8_t *result, uint8_t *pubKey, uint8_t *scalar)
   return flag == (uint64_t)0U;
 }
 
+/*
+ ecp256dh_r for n independent (pubKey[i], scalar[i]) pairs; success[i] is set to the result for result[i].
+ The final conversions to affine coordinates are shared across the batch, at the cost of one field inversion.
+  
+ Output: bool, where true stands for all n key agreements being correct.
+*/
+bool
+Hacl_P256_ecp256dh_r_many(
+  uint32_t n,
+  uint8_t **result,
+  uint8_t **pubKey,
+  uint8_t **scalar,
+  bool *success
+)
+{
+  bool all = true;
+  for (uint32_t i = (uint32_t)0U; i < n; i = i + (uint32_t)16U)
+  {
+    uint32_t k = n - i < (uint32_t)16U ? n - i : (uint32_t)16U;
+    bool ok = ecp256dh_r_many_(k, result + i, pubKey + i, scalar + i, success + i);
+    all = all && ok;
+  }
+  return all;
+}
+
 /*
  Input: scalar: uint8[32].
   
@@ -219,6 +219,70 @@ Hacl_P256_ecdsa_verif_without_hash(
   uint8_t *s
 );
 
+/*
+ ecdsa_verif_p256_sha2 for n signatures: valid[i] is set to the result for (m[i], pubKey[i], r[i], s[i]).
+  
+ Output: bool, where true stands for all n signatures being correct.
+*/
+bool
+Hacl_P256_ecdsa_verif_p256_sha2_many(
+  uint32_t n,
+  uint32_t *mLen,
+  uint8_t **m,
+  uint8_t **pubKey,
+  uint8_t **r,
+  uint8_t **s,
+  bool *valid
+);
+
+/*
+ ecdsa_verif_p256_sha384 for n signatures: valid[i] is set to the result for (m[i], pubKey[i], r[i], s[i]).
+  
+ Output: bool, where true stands for all n signatures being correct.
+*/
+bool
+Hacl_P256_ecdsa_verif_p256_sha384_many(
+  uint32_t n,
+  uint32_t *mLen,
+  uint8_t **m,
+  uint8_t **pubKey,
+  uint8_t **r,
+  uint8_t **s,
+  bool *valid
+);
+
+/*
+ ecdsa_verif_p256_sha512 for n signatures: valid[i] is set to the result for (m[i], pubKey[i], r[i], s[i]).
+  
+ Output: bool, where true stands for all n signatures being correct.
+*/
+bool
+Hacl_P256_ecdsa_verif_p256_sha512_many(
+  uint32_t n,
+  uint32_t *mLen,
+  uint8_t **m,
+  uint8_t **pubKey,
+  uint8_t **r,
+  uint8_t **s,
+  bool *valid
+);
+
+/*
+ ecdsa_verif_without_hash for n signatures: valid[i] is set to the result for (m[i], pubKey[i], r[i], s[i]).
+  
+ Output: bool, where true stands for all n signatures being correct.
+*/
+bool
+Hacl_P256_ecdsa_verif_without_hash_many(
+  uint32_t n,
+  uint32_t *mLen,
+  uint8_t **m,
+  uint8_t **pubKey,
+  uint8_t **r,
+  uint8_t **s,
+  bool *valid
+);
+
 /*
  Public key verification function. 
   
@@ -302,6 +366,21 @@ bool Hacl_P256_ecp256dh_i(uint8_t *result, uint8_t *scalar);
 */
 bool Hacl_P256_ecp256dh_r(uint8_t *result, uint8_t *pubKey, uint8_t *scalar);
 
+/*
+ ecp256dh_r for n independent (pubKey[i], scalar[i]) pairs; success[i] is set to the result for result[i].
+ The final conversions to affine coordinates are shared across the batch, at the cost of one field inversion.
+  
+ Output: bool, where true stands for all n key agreements being correct.
+*/
+bool
+Hacl_P256_ecp256dh_r_many(
+  uint32_t n,
+  uint8_t **result,
+  uint8_t **pubKey,
+  uint8_t **scalar,
+  bool *success
+);
+
 /*
  Input: scalar: uint8[32].
   
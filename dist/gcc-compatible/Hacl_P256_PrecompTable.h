@@ -0,0 +1,1541 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_P256_PrecompTable_H
+#define __Hacl_P256_PrecompTable_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include "evercrypt_targetconfig.h"
+#include "libintvector.h"
+#include "kremlin/internal/types.h"
+#include "kremlin/lowstar_endianness.h"
+#include <string.h>
+#include "kremlin/internal/target.h"
+
+
+
+/*
+  [j * 16^i]G for i = 0..64 and j = 1..8, in affine coordinates (x, y) in the
+  Montgomery domain: 8 words per entry, 8 entries per row. Row 64 only takes
+  the final carry of the signed recoding.
+*/
+static const
+uint64_t
+Hacl_P256_PrecompTable_precomp_basepoint_table_radix16[4160U] =
+  {
+    (uint64_t)0x79e730d418a9143cU, (uint64_t)0x75ba95fc5fedb601U, (uint64_t)0x79fb732b77622510U,
+    (uint64_t)0x18905f76a53755c6U, (uint64_t)0xddf25357ce95560aU, (uint64_t)0x8b4ab8e4ba19e45cU,
+    (uint64_t)0xd2e88688dd21f325U, (uint64_t)0x8571ff1825885d85U, (uint64_t)0x850046d410ddd64dU,
+    (uint64_t)0xaa6ae3c1a433827dU, (uint64_t)0x732205038d1490d9U, (uint64_t)0xf6bb32e43dcf3a3bU,
+    (uint64_t)0x2f3648d361bee1a5U, (uint64_t)0x152cd7cbeb236ff8U, (uint64_t)0x19a8fb0e92042dbeU,
+    (uint64_t)0x78c577510a5b8a3bU, (uint64_t)0xffac3f904eebc127U, (uint64_t)0xb027f84a087d81fbU,
+    (uint64_t)0x66ad77dd87cbbc98U, (uint64_t)0x26936a3fb6ff747eU, (uint64_t)0xb04c5c1fc983a7ebU,
+    (uint64_t)0x583e47ad0861fe1aU, (uint64_t)0x788208311a2ee98eU, (uint64_t)0xd5f06a29e587cc07U,
+    (uint64_t)0x74b0b50d46918dccU, (uint64_t)0x4650a6edc623c173U, (uint64_t)0x0cdaacace8100af2U,
+    (uint64_t)0x577362f541b0176bU, (uint64_t)0x2d96f24ce4cbaba6U, (uint64_t)0x17628471fad6f447U,
+    (uint64_t)0x6b6c36dee5ddd22eU, (uint64_t)0x84b14c394c5ab863U, (uint64_t)0xbe1b8aaec45c61f5U,
+    (uint64_t)0x90ec649a94b9537dU, (uint64_t)0x941cb5aad076c20cU, (uint64_t)0xc9079605890523c8U,
+    (uint64_t)0xeb309b4ae7ba4f10U, (uint64_t)0x73c568efe5eb882bU, (uint64_t)0x3540a9877e7a1f68U,
+    (uint64_t)0x73a076bb2dd1e916U, (uint64_t)0x403947373e77664aU, (uint64_t)0x55ae744f346cee3eU,
+    (uint64_t)0xd50a961a5b17a3adU, (uint64_t)0x13074b5954213673U, (uint64_t)0x93d36220d377e44bU,
+    (uint64_t)0x299c2b53adff14b5U, (uint64_t)0xf424d44cef639f11U, (uint64_t)0xa4c9916d4a07f75fU,
+    (uint64_t)0x0746354ea0173b4fU, (uint64_t)0x2bd20213d23c00f7U, (uint64_t)0xf43eaab50c23bb08U,
+    (uint64_t)0x13ba5119c3123e03U, (uint64_t)0x2847d0303f5b9d4dU, (uint64_t)0x6742f2f25da67bddU,
+    (uint64_t)0xef933bdc77c94195U, (uint64_t)0xeaedd9156e240867U, (uint64_t)0x27f14cd19499a78fU,
+    (uint64_t)0x462ab5c56f9b3455U, (uint64_t)0x8f90f02af02cfc6bU, (uint64_t)0xb763891eb265230dU,
+    (uint64_t)0xf59da3a9532d4977U, (uint64_t)0x21e3327dcf9eba15U, (uint64_t)0x123c7b84be60bbf0U,
+    (uint64_t)0x56ec12f27706df76U, (uint64_t)0x808b0b650bc6fb80U, (uint64_t)0x5882e0753ffe2e6bU,
+    (uint64_t)0xd5ef2f7c2c83f549U, (uint64_t)0x54d63c809103b723U, (uint64_t)0xf2f11bd652a23f9bU,
+    (uint64_t)0x3670c3194b0b6587U, (uint64_t)0x55c4623bb1580e9eU, (uint64_t)0x64edf7b201efe220U,
+    (uint64_t)0xd8c5fccfc5e3a3d8U, (uint64_t)0xbefd904c4079dfbfU, (uint64_t)0xbc6d6a58fead0197U,
+    (uint64_t)0x39227077695532a4U, (uint64_t)0x09e23e6ddbef42f5U, (uint64_t)0x7e449b64480a9908U,
+    (uint64_t)0x7b969c1aad9a2e40U, (uint64_t)0x6231d7929591c2a4U, (uint64_t)0x6b34413077adc612U,
+    (uint64_t)0xa7496529bbd803a0U, (uint64_t)0x1a1baaa76d8805bdU, (uint64_t)0xc8403902470343adU,
+    (uint64_t)0x39f59f66175adff1U, (uint64_t)0x0b26d7fbb7d8c5b7U, (uint64_t)0xa875f5ce529d75e3U,
+    (uint64_t)0x85efc7e941325cc2U, (uint64_t)0xdb6d96f305968b80U, (uint64_t)0x380a0913089f73b9U,
+    (uint64_t)0x7da70b83c2c61e01U, (uint64_t)0x95fb8394569b38c7U, (uint64_t)0x9a3c651280edfe2fU,
+    (uint64_t)0x8f726bb98faeaf82U, (uint64_t)0x8010a4a078424bf8U, (uint64_t)0x296720440e844970U,
+    (uint64_t)0x492bdc0752b3e584U, (uint64_t)0x35ff9aa8b5f86a2cU, (uint64_t)0x2074213db27de573U,
+    (uint64_t)0xc0bfffc45263832aU, (uint64_t)0x2429c22a1d49c605U, (uint64_t)0x1b037d75b320ebfbU,
+    (uint64_t)0x52b6a1739220f428U, (uint64_t)0x2995919ca4cd2660U, (uint64_t)0x802b8d2333e12b70U,
+    (uint64_t)0x6d490a4b19dd329bU, (uint64_t)0x14f356cc6abc354dU, (uint64_t)0x11eddf7fd0a0da0dU,
+    (uint64_t)0x1e208328d87fd1d8U, (uint64_t)0xfd2f4f8cfd025813U, (uint64_t)0x03b48cc47c29bca2U,
+    (uint64_t)0x3f2a78b3241a2b71U, (uint64_t)0x6a9505760a99cbcaU, (uint64_t)0x94e258f604a428f2U,
+    (uint64_t)0x45ab5a4d7832ba0cU, (uint64_t)0x71704d008938c167U, (uint64_t)0xdb97ab0ef88b8b70U,
+    (uint64_t)0x56feb92ec00eb207U, (uint64_t)0xe70352687d367d80U, (uint64_t)0x65000c24c7973a41U,
+    (uint64_t)0x63c5cb817a2ad62aU, (uint64_t)0x7ef2b6b9ac62ff54U, (uint64_t)0x3749bba4b3ad9db5U,
+    (uint64_t)0xad311f2c46d5a617U, (uint64_t)0xb77a8087c2ff3b6dU, (uint64_t)0xb46feaf3367834ffU,
+    (uint64_t)0xf8aa266d75d6b138U, (uint64_t)0xfa38d320ec008188U, (uint64_t)0x486d8ffa696946fcU,
+    (uint64_t)0x50fbc6d8b9cba56dU, (uint64_t)0x7e3d423e90f35a15U, (uint64_t)0x7c3da195c0dd962cU,
+    (uint64_t)0xe673fdb03cfd5d8bU, (uint64_t)0x0704b7c2889dfca5U, (uint64_t)0xf6ce581ff52305aaU,
+    (uint64_t)0x399d49eb914d5e53U, (uint64_t)0x44e3811039949296U, (uint64_t)0x5b63827b361db1b5U,
+    (uint64_t)0x3e5323ed206eaff5U, (uint64_t)0x942370d2c21f4290U, (uint64_t)0xf2caaf2ee0d985a1U,
+    (uint64_t)0x192cc64b7239846dU, (uint64_t)0x7c0b8f47ae6312f8U, (uint64_t)0x7dc61f9196620108U,
+    (uint64_t)0x35d6a53eed4c3717U, (uint64_t)0x9f8240cf3d0ed2a3U, (uint64_t)0x8c0d4d05e5543aa5U,
+    (uint64_t)0x45d5bbfbdd33b4b4U, (uint64_t)0xfa04cc73137fd28eU, (uint64_t)0x862ac6efc73b3ffdU,
+    (uint64_t)0x403ff9f531f51ef2U, (uint64_t)0x34d5e0fcbc73f5a2U, (uint64_t)0x4f7081e144cc3addU,
+    (uint64_t)0xd5ffa1d687be82cfU, (uint64_t)0x89890b6c0edd6472U, (uint64_t)0xada26e1a3ed17863U,
+    (uint64_t)0x276f271563483caaU, (uint64_t)0xe6924cd92f6077fdU, (uint64_t)0x05a7fe980a466e3cU,
+    (uint64_t)0xf1c794b0b1902d1fU, (uint64_t)0x33b2385c08369a90U, (uint64_t)0x2990c59b190eb4f8U,
+    (uint64_t)0x819a6145c68eac80U, (uint64_t)0x7a786d622ec4a014U, (uint64_t)0x33faadbe20ac3a8dU,
+    (uint64_t)0x31a217815aba2d30U, (uint64_t)0x209d2742dba4f565U, (uint64_t)0xdb2ce9e355aa0fbbU,
+    (uint64_t)0xb3156bf38bd7aff1U, (uint64_t)0x1b5ee4cb1d81b146U, (uint64_t)0x7ba1ac41d628a915U,
+    (uint64_t)0x8f3a8f9cfd89699eU, (uint64_t)0x7329b9c9a0748be7U, (uint64_t)0x1d391c95a92e621fU,
+    (uint64_t)0xe51e6b214d10a837U, (uint64_t)0xd255f53a4947b435U, (uint64_t)0x0c4a58d474a86108U,
+    (uint64_t)0xf8048a8fee4c5d90U, (uint64_t)0xe3c7c924e86d4c80U, (uint64_t)0x28c889de056a1e60U,
+    (uint64_t)0x57e2662eb214a040U, (uint64_t)0xe8c48e9837e10347U, (uint64_t)0x8774286280ac748aU,
+    (uint64_t)0xf1c24022186b06f2U, (uint64_t)0x3d2b24b9eb7926b8U, (uint64_t)0xbff88cb3cdbe5509U,
+    (uint64_t)0xd0f399afe4dd640bU, (uint64_t)0x3c5fe1302f76ed45U, (uint64_t)0x6f3562f43764fb3dU,
+    (uint64_t)0x7b5af3183151b62dU, (uint64_t)0xd5bd0bc7d79ce5f3U, (uint64_t)0xfdaf6b20ec66890fU,
+    (uint64_t)0x6772b0e5ab4b35a2U, (uint64_t)0x1d8b6001f5eeaacfU, (uint64_t)0x728f7ce4795b9580U,
+    (uint64_t)0x4a20ed2a41fb81daU, (uint64_t)0x9f685cd44fec01e6U, (uint64_t)0x3ed7ddcca7ff50adU,
+    (uint64_t)0x460fd2640c2d97fdU, (uint64_t)0x3a241426eb82f4f9U, (uint64_t)0x80009862d5d721d5U,
+    (uint64_t)0x0c3357a35bd3a182U, (uint64_t)0x27f3a83b7aa2cda4U, (uint64_t)0xb58ae74ef6f83085U,
+    (uint64_t)0x2a911a812e6dad6bU, (uint64_t)0xde286051f43d6c5bU, (uint64_t)0x4bdccc41f996c4d8U,
+    (uint64_t)0xe7312ec00ae1e24eU, (uint64_t)0x6faf68feaae6ee70U, (uint64_t)0x78f4cc155602b0c9U,
+    (uint64_t)0x7e3321a86e94052aU, (uint64_t)0x2fb3a0d6734d5d80U, (uint64_t)0xf3b98f3bb25a43baU,
+    (uint64_t)0x30bf803119ee2951U, (uint64_t)0x7ffee43321b0612aU, (uint64_t)0x12f775e42eb821d0U,
+    (uint64_t)0xf8d112e76e6485b3U, (uint64_t)0x4d3e24db771c52f8U, (uint64_t)0x48e3ee41684a2f6dU,
+    (uint64_t)0x7161957d21d95551U, (uint64_t)0x19631283cdb12a6cU, (uint64_t)0xbf3fa8822e50e164U,
+    (uint64_t)0xf6254b633166cc73U, (uint64_t)0x3aefa7aeaee8cc38U, (uint64_t)0x46f7008037a929a9U,
+    (uint64_t)0x65601a8e19fec6bdU, (uint64_t)0x537f5edc12ab8b62U, (uint64_t)0xe497cd955e5990cfU,
+    (uint64_t)0x2fcd387f9aa5b2f9U, (uint64_t)0xe5faa3ff67b78fe8U, (uint64_t)0x1bcf538d295d5e30U,
+    (uint64_t)0x3a573239a813a7ecU, (uint64_t)0xe9f5286bd17c2409U, (uint64_t)0x2c4e479363264d9bU,
+    (uint64_t)0x177042b117f6880fU, (uint64_t)0x39b7e2c84ce1ee43U, (uint64_t)0xcec8e722d096f4a9U,
+    (uint64_t)0x6861aecbbed5e697U, (uint64_t)0xc2d153f06c231911U, (uint64_t)0xcc2f42b82890537aU,
+    (uint64_t)0x33e2cb51d0a917b4U, (uint64_t)0xc2cfa3f34899f931U, (uint64_t)0xb2c94f4be9a2f6b6U,
+    (uint64_t)0x9707b1817ca162b7U, (uint64_t)0xb602a172d5f8b10dU, (uint64_t)0xfd3078354fd4542aU,
+    (uint64_t)0xeef226dddd996992U, (uint64_t)0x221fa989eb0a15e1U, (uint64_t)0x79b0fe623b36f9fdU,
+    (uint64_t)0x26543b23fde19fc0U, (uint64_t)0x136e64a0958482efU, (uint64_t)0x23f637719b095825U,
+    (uint64_t)0x14cfd596b6a1142eU, (uint64_t)0x5ea6aac6335aac0bU, (uint64_t)0x86a0e8bdf3081dd5U,
+    (uint64_t)0x5fb89d79003dc12aU, (uint64_t)0x0f0165fce3779ee3U, (uint64_t)0xe00e7f9dbd495d9eU,
+    (uint64_t)0x1fa4efa220284e7aU, (uint64_t)0x4564bade47ac6219U, (uint64_t)0x90e6312ac4708e8eU,
+    (uint64_t)0x4f5725fba71e9adfU, (uint64_t)0xe95f55ae3d684b9fU, (uint64_t)0x47f7ccb11e94b415U,
+    (uint64_t)0x3617890361a341c1U, (uint64_t)0x3604dc600cfd6142U, (uint64_t)0x022295eb8533316cU,
+    (uint64_t)0x3dbde4ac44af2922U, (uint64_t)0x898afc5d1c7eef69U, (uint64_t)0x58896805d14f4fa1U,
+    (uint64_t)0x05002160203c21caU, (uint64_t)0x6f0d1f3040ef730bU, (uint64_t)0xbd9b8b1dbe7a2af3U,
+    (uint64_t)0xec51caa94fb74a72U, (uint64_t)0xb9937a4b63879697U, (uint64_t)0x7c9a9d20ec2687d5U,
+    (uint64_t)0x1773e44f6ef5f014U, (uint64_t)0x8abcf412e90c6900U, (uint64_t)0x387bd0228142161eU,
+    (uint64_t)0x50393755fcb6ff2aU, (uint64_t)0xfabf770977f7195aU, (uint64_t)0x8ec86167adeb838fU,
+    (uint64_t)0xea1285a8bb4f012dU, (uint64_t)0xd68835039a3eab3fU, (uint64_t)0xee5d24f8309004c2U,
+    (uint64_t)0xa96e4b7613ffe95eU, (uint64_t)0x0cdffe12bd223ea4U, (uint64_t)0x8f5c2ee5b6739a53U,
+    (uint64_t)0x3d61333959145a65U, (uint64_t)0xcd9bc368fa406337U, (uint64_t)0x82d11be32d8a52a0U,
+    (uint64_t)0xf6877b2797a1c590U, (uint64_t)0x837a819bf5cbdb25U, (uint64_t)0x2a4fd1d8de090249U,
+    (uint64_t)0x622a7de774990e5fU, (uint64_t)0x840fa5a07945511bU, (uint64_t)0xe58e90b36b0cf82eU,
+    (uint64_t)0x6438d2462615b5e7U, (uint64_t)0x07b1f8fc669c145aU, (uint64_t)0xb0d8b2da36f1e1cbU,
+    (uint64_t)0x54d5dadbd9184c4dU, (uint64_t)0x3dbb18d5f93d9976U, (uint64_t)0x0a3e0f56d1147d47U,
+    (uint64_t)0x2afa8c8da0a48609U, (uint64_t)0x26e08c07e3533d77U, (uint64_t)0xd7222e6a2e341c99U,
+    (uint64_t)0x9d60ec3d8d2dc4edU, (uint64_t)0xbdfe0d8f7c476cf8U, (uint64_t)0x1fe59ab61d056605U,
+    (uint64_t)0xa9ea9df686a8551fU, (uint64_t)0x8489941e47fb8d8cU, (uint64_t)0xfeb874eb4a7f1b10U,
+    (uint64_t)0xed406aa9bd763802U, (uint64_t)0xc21486a065303da1U, (uint64_t)0x61ae291ec7e62ec4U,
+    (uint64_t)0x622a0492df99333eU, (uint64_t)0x7fd80c9dbb7a8ee0U, (uint64_t)0xdc2ed3bc6c01aedbU,
+    (uint64_t)0x35c35a1208be74ecU, (uint64_t)0xd540cb1a469f671fU, (uint64_t)0xa7a8746a584c5e20U,
+    (uint64_t)0x267e4ea1b9dc7035U, (uint64_t)0x593a15cfb9548c9bU, (uint64_t)0x5e6e21354bd012f3U,
+    (uint64_t)0xdf31cc6a8c8f936eU, (uint64_t)0x8af84d04b5c241dcU, (uint64_t)0x63990a6f345efb86U,
+    (uint64_t)0x6fef4e61b9b962cbU, (uint64_t)0xf6368f0925722608U, (uint64_t)0x131260db131cf5c6U,
+    (uint64_t)0x40eb353bfab4f7acU, (uint64_t)0x85c7888037eee829U, (uint64_t)0x4c1581ffc3bdf24eU,
+    (uint64_t)0x5bff75cbf5c3c5a8U, (uint64_t)0x35e8c83fa14e6f40U, (uint64_t)0xb81d1c0f0295e0caU,
+    (uint64_t)0xf2efe23d442a8ad1U, (uint64_t)0xc3816a7d06b9c164U, (uint64_t)0xa9df2d8bdc0aa5e5U,
+    (uint64_t)0x191ae46f120a8e65U, (uint64_t)0x83667f8700611c5bU, (uint64_t)0x83171ed7ff109948U,
+    (uint64_t)0x33a2ecf8ca695952U, (uint64_t)0xfa4a73eef48d1a13U, (uint64_t)0xfcde7cc8f43a730fU,
+    (uint64_t)0xe89b6f3c33ab590eU, (uint64_t)0xc823f529ad03240bU, (uint64_t)0x82b79afe98bea5dbU,
+    (uint64_t)0x568f2856962fe5deU, (uint64_t)0x0c590adb60c591f3U, (uint64_t)0x1fc74a144a28a858U,
+    (uint64_t)0x3b662498b3203f4cU, (uint64_t)0x48fc4ed082dd1b6aU, (uint64_t)0x5783a13867b703afU,
+    (uint64_t)0x2463cb9a005d6aaaU, (uint64_t)0xd31ec55c706ecd43U, (uint64_t)0x9f8ed33f8e9a7641U,
+    (uint64_t)0x625453ed098d9e7aU, (uint64_t)0xa3beade4ec887493U, (uint64_t)0x442b80505a795566U,
+    (uint64_t)0x91e3cf0d6c39765aU, (uint64_t)0xa2db3acdac3cca0bU, (uint64_t)0x288f2f08cb953b50U,
+    (uint64_t)0x2414582ccf43cf1aU, (uint64_t)0x8dec8bbc60eee9a8U, (uint64_t)0x54c79f02729aa042U,
+    (uint64_t)0xd81cd5ec6532f5d5U, (uint64_t)0xa672303acf82e15fU, (uint64_t)0x46df582d3bfab839U,
+    (uint64_t)0x92474e042f8adadeU, (uint64_t)0x36a7766a147a1bc3U, (uint64_t)0xb6940f540dc0f979U,
+    (uint64_t)0x44738ef2f2759f25U, (uint64_t)0x9dd95789a719f4c6U, (uint64_t)0x2859b7f40750c345U,
+    (uint64_t)0x5e788bf2b22180d5U, (uint64_t)0x376aafa8719c0563U, (uint64_t)0xcd8ad2dcbc5fc79fU,
+    (uint64_t)0x303fdb9fcb750cd3U, (uint64_t)0x14ff052f4418b08eU, (uint64_t)0xf75084cf3e2d6520U,
+    (uint64_t)0x7ebdf0f8144ed509U, (uint64_t)0xf43bf0f2d3f25b98U, (uint64_t)0x86ad71cfa354d837U,
+    (uint64_t)0xd9d0c8c4868af75dU, (uint64_t)0xd7325cff45c8c7eaU, (uint64_t)0xab471996cc81ecb0U,
+    (uint64_t)0xff5d55f3611824edU, (uint64_t)0xbe3145411977a0eeU, (uint64_t)0x5085c4c5722038c6U,
+    (uint64_t)0x2d5335bff94bb495U, (uint64_t)0x894ad8a6c8e2a082U, (uint64_t)0x540234b22c11bb37U,
+    (uint64_t)0x2d0366dded4c74a3U, (uint64_t)0xf9a968daeec5f25dU, (uint64_t)0x3660106867b63142U,
+    (uint64_t)0x07cd6d2c68d7b6d4U, (uint64_t)0xa8f74f090c842942U, (uint64_t)0xe27514047768b1eeU,
+    (uint64_t)0x4b5f7e89fe62aee4U, (uint64_t)0xd1e059b21994ef20U, (uint64_t)0x2a653b69638ae318U,
+    (uint64_t)0x70d5eb582f699010U, (uint64_t)0x279739f709f5f84aU, (uint64_t)0x5da4663c8b799336U,
+    (uint64_t)0xfdfdf14d203c37ebU, (uint64_t)0x32d8a9dca1dbfb2dU, (uint64_t)0xab40cff077d48f9bU,
+    (uint64_t)0xf2369f0b879fbbedU, (uint64_t)0x0ff0ae86da9d1869U, (uint64_t)0x5251d75956766f45U,
+    (uint64_t)0x4984d8c02be8d0fcU, (uint64_t)0x7ecc95a6d21008f0U, (uint64_t)0x29bd54a03a1a1c49U,
+    (uint64_t)0xab9828c5d26c50f3U, (uint64_t)0x32c0087c51d0d251U, (uint64_t)0xf61790abfbaf50a5U,
+    (uint64_t)0xdf55e76b684e0750U, (uint64_t)0xec516da7f176b005U, (uint64_t)0x575553bb7a2dddc7U,
+    (uint64_t)0x37c87ca3553afa73U, (uint64_t)0x315f3ffc4d55c251U, (uint64_t)0xe846442aaf3e5d35U,
+    (uint64_t)0x61b911496495ff28U, (uint64_t)0x47feeb6662b5f3afU, (uint64_t)0xcefab5610abb3734U,
+    (uint64_t)0x449de60e19f35cb1U, (uint64_t)0x39f8db14157f0eb9U, (uint64_t)0xffaecc5b3c61bfd6U,
+    (uint64_t)0xa5a4d41d41216703U, (uint64_t)0x7f8fabed224e1cc2U, (uint64_t)0x0d5a8186871ad953U,
+    (uint64_t)0x4bdf3a4956f90823U, (uint64_t)0xba0f5080741d777bU, (uint64_t)0x091d71c3f38bf760U,
+    (uint64_t)0x9633d50f9b625b02U, (uint64_t)0x03ecb743b8c9de61U, (uint64_t)0xb47512545de74720U,
+    (uint64_t)0x9f9defc974ce1cb2U, (uint64_t)0x774a4f6a00bd32efU, (uint64_t)0x190d8ea601799a52U,
+    (uint64_t)0xa20cec41b86d2952U, (uint64_t)0x3062ffb27fff2a7cU, (uint64_t)0x741b32e579f19d37U,
+    (uint64_t)0xf80d81814eb57d47U, (uint64_t)0x7a2d0ed416aef06bU, (uint64_t)0x09735fb01cecb588U,
+    (uint64_t)0x1641caaac6061f5bU, (uint64_t)0x7f99824f20151427U, (uint64_t)0x206828b692430206U,
+    (uint64_t)0xaa9097d7e1112357U, (uint64_t)0xacf9a2f209e414ecU, (uint64_t)0xdbdac9da27915356U,
+    (uint64_t)0x7e0734b7001efee3U, (uint64_t)0x54fab5bbd2b288e2U, (uint64_t)0x4c630fc4f62dd09cU,
+    (uint64_t)0x8537107a1ac2703bU, (uint64_t)0xb49258d86bc857b5U, (uint64_t)0x57df14debcdaccd1U,
+    (uint64_t)0x24ab68d7c4ae8529U, (uint64_t)0x7ed8b5d4734e59d0U, (uint64_t)0x5f8740c8c495cc80U,
+    (uint64_t)0x84aedd5a291db9b3U, (uint64_t)0x80b360f84fb995beU, (uint64_t)0xae915f5d5fa067d1U,
+    (uint64_t)0x4134b57f9668960cU, (uint64_t)0xbd3656d6a48edaacU, (uint64_t)0xdac1e3e4fc1d7436U,
+    (uint64_t)0x674ff869d81fbb26U, (uint64_t)0x449ed3ecb26c33d4U, (uint64_t)0x85138705d94203e8U,
+    (uint64_t)0xccde538bbeeb6f4aU, (uint64_t)0x55d5c68da61a76faU, (uint64_t)0x598b441dca1554dcU,
+    (uint64_t)0xd39923b9773b279cU, (uint64_t)0x33331d3c36bf9efcU, (uint64_t)0x2d4c848e298de399U,
+    (uint64_t)0xcfdb8e77a1a27f56U, (uint64_t)0x94c855ea57b8ab70U, (uint64_t)0xdcdb9dae6f7879baU,
+    (uint64_t)0x7bdff8c2019f2a59U, (uint64_t)0xb3ce5bb3cb4fbc74U, (uint64_t)0xea907f688a9173ddU,
+    (uint64_t)0x6cd3d0d395a75439U, (uint64_t)0x92ecc4d6efed021cU, (uint64_t)0x09a9f9b06a77339aU,
+    (uint64_t)0x87ca6b157188c64aU, (uint64_t)0x10c2996844899158U, (uint64_t)0x5859a229ed6e82efU,
+    (uint64_t)0x16f338e365ebaf4eU, (uint64_t)0x0cd313875ead67aeU, (uint64_t)0x1c73d22854ef0bb4U,
+    (uint64_t)0x4cb5513174a5c8c7U, (uint64_t)0x01cd29707f69ad6aU, (uint64_t)0xa04d00dde966f87eU,
+    (uint64_t)0xd96fe4470b7b0321U, (uint64_t)0x342ac06e88fbd381U, (uint64_t)0x02cd4a845c35a493U,
+    (uint64_t)0xe8fa89de54f1bbcdU, (uint64_t)0x341d63672575ed4cU, (uint64_t)0xebe357fbd238202bU,
+    (uint64_t)0x600b4d1aa984ead9U, (uint64_t)0xc35c9f4452436ea0U, (uint64_t)0x96fe0a39a370751bU,
+    (uint64_t)0x4c4f07367f636a38U, (uint64_t)0x9f943fb70e76d5cbU, (uint64_t)0xb03510baa8b68b8bU,
+    (uint64_t)0xc246780a9ed07a1fU, (uint64_t)0x3c0514156d549fc2U, (uint64_t)0xc2953f31607781caU,
+    (uint64_t)0x955e2c69d8d95413U, (uint64_t)0xb300fadc7bd282e3U, (uint64_t)0x202886024147519aU,
+    (uint64_t)0xd0981eac26b372f0U, (uint64_t)0xa9d4a7caa785ebc8U, (uint64_t)0xd953c50ddbdf58e9U,
+    (uint64_t)0x9d6361ccfd590f8fU, (uint64_t)0x72e9626b44e6c917U, (uint64_t)0x7fd9611022eb64cfU,
+    (uint64_t)0x863ebb7e9eb288f3U, (uint64_t)0x877b7cf5678a31b0U, (uint64_t)0xd50301ae3998b620U,
+    (uint64_t)0x734257c5c00fb396U, (uint64_t)0xf9fb18a004e672a6U, (uint64_t)0xff8bd8ebe8758851U,
+    (uint64_t)0x1e64e4c65d99ba44U, (uint64_t)0x4b8eaedf7dfd93b7U, (uint64_t)0xba2f2a9804e76b8cU,
+    (uint64_t)0xa18f07e0e90fb21eU, (uint64_t)0x00fd2b80bba7fca1U, (uint64_t)0x20387f2795cd67b5U,
+    (uint64_t)0x5b89a4e7d39707f7U, (uint64_t)0x8f83ad3f894407ceU, (uint64_t)0xa0025b946c226132U,
+    (uint64_t)0xc79563c7f906c13bU, (uint64_t)0x5f548f314e7bb025U, (uint64_t)0x0ee6d3a7c35d8794U,
+    (uint64_t)0x042e65580356bae5U, (uint64_t)0x9f59698d643322fdU, (uint64_t)0x9379ae1550a61967U,
+    (uint64_t)0x64b9ae62fcc9981eU, (uint64_t)0xaed3d6316d2934c6U, (uint64_t)0x2454b3025e4e65ebU,
+    (uint64_t)0xab09f647f9950428U, (uint64_t)0xc1b3d3d331b85f09U, (uint64_t)0x0f45354aa88ae64aU,
+    (uint64_t)0xa8b626d32fec50fdU, (uint64_t)0x1bdcfbd4e828834fU, (uint64_t)0xe45a2866cd522539U,
+    (uint64_t)0xfa9d4732810f7ab3U, (uint64_t)0xd8c1d6b4c905f293U, (uint64_t)0x10ac80473461b597U,
+    (uint64_t)0xe2c815366d91cd2cU, (uint64_t)0x40a2beeadaa3f0e4U, (uint64_t)0xfb167a592441e083U,
+    (uint64_t)0x004675e9e9240347U, (uint64_t)0x7848aaff840e446eU, (uint64_t)0x9f9f258fea308f72U,
+    (uint64_t)0x50f12899639bfad9U, (uint64_t)0x0939ae63205c0af6U, (uint64_t)0xbbb175146fc627e2U,
+    (uint64_t)0xa0569bc591573a51U, (uint64_t)0xa7016d9e358243d5U, (uint64_t)0x0dac0c56ac1d6692U,
+    (uint64_t)0x993833b5da590d5fU, (uint64_t)0xa8067803de817491U, (uint64_t)0x65b4f2124dbf75d0U,
+    (uint64_t)0xcc960232ccf80cfbU, (uint64_t)0xb2083a1222248accU, (uint64_t)0x1f6ec0ef3264e366U,
+    (uint64_t)0x5659b7045afdee28U, (uint64_t)0x7a823a40e6430bb5U, (uint64_t)0x24592a04e1900a79U,
+    (uint64_t)0xcde09d4ac9ee6576U, (uint64_t)0x52b6463f4b5ea54aU, (uint64_t)0x1efe9ed3d3ca65a7U,
+    (uint64_t)0xe27a6dbe305406ddU, (uint64_t)0x8eb7dc7fdd5d1957U, (uint64_t)0xf54a6876387d4d8fU,
+    (uint64_t)0x9c479409c7762de4U, (uint64_t)0xbe4d5b5d99b30778U, (uint64_t)0x25380c566e793682U,
+    (uint64_t)0x602d37f3dac740e3U, (uint64_t)0x140deabe1566e4aeU, (uint64_t)0xeaee6126c49a861eU,
+    (uint64_t)0x024f3b65e14f0d06U, (uint64_t)0x51a3f1e8c69bfc17U, (uint64_t)0xc3c3a8e9a7686381U,
+    (uint64_t)0x3400752cb103d4c8U, (uint64_t)0x02bc46139218b36bU, (uint64_t)0xc67f75eb7651504aU,
+    (uint64_t)0xd6848b56d02aebfaU, (uint64_t)0x958381db1782269bU, (uint64_t)0xae34bf792597e550U,
+    (uint64_t)0xbb5c60645f385153U, (uint64_t)0x6f0e96afe3088048U, (uint64_t)0xbf6a021577884456U,
+    (uint64_t)0xb3b5688c69310ea7U, (uint64_t)0x17c9429504fad2deU, (uint64_t)0xe020f0e517896d4dU,
+    (uint64_t)0xcca4428dbbe5a1a9U, (uint64_t)0x8187fd5f3126bd67U, (uint64_t)0x0036973a48105826U,
+    (uint64_t)0xa39b6663b8bd61a0U, (uint64_t)0x6d42deef2d65a808U, (uint64_t)0x4969044f94636b19U,
+    (uint64_t)0xf611ee47dd5d564cU, (uint64_t)0x7b2f3a49d2873077U, (uint64_t)0x03b0d8dd0f82b214U,
+    (uint64_t)0x460c34f9f103cbc6U, (uint64_t)0xf32e5c0318d79e19U, (uint64_t)0x8b8888baa84117f8U,
+    (uint64_t)0x8f3c37dcc0722677U, (uint64_t)0x10d21be91c1c0f27U, (uint64_t)0xd47c8468e0f7a0c6U,
+    (uint64_t)0x9bf02213adecc0e0U, (uint64_t)0x97554160b7fe7b6eU, (uint64_t)0x7d16189a400a3fb2U,
+    (uint64_t)0xd73e9beae328ca1eU, (uint64_t)0x0dd04b97e793d8ccU, (uint64_t)0xa9c83c9b506db8ccU,
+    (uint64_t)0x5cd47aaecf38814cU, (uint64_t)0x26fc430db64b45e6U, (uint64_t)0x079b5499d818ea84U,
+    (uint64_t)0x03b5d21ae0ac2941U, (uint64_t)0x279b0254c2d31937U, (uint64_t)0x3307c052cac992d0U,
+    (uint64_t)0x6aa7cb92efa8b1f3U, (uint64_t)0x5a1825800d37c7a5U, (uint64_t)0x13380c37342d5422U,
+    (uint64_t)0x92ac2d66d5d2ef92U, (uint64_t)0x035a70c9030c63c6U, (uint64_t)0x5109b78571ba1861U,
+    (uint64_t)0x48b22d5cd0c8f93dU, (uint64_t)0xe8fa84a78633bb93U, (uint64_t)0x53fba6ba5aebbd08U,
+    (uint64_t)0x7ff27df3e5eea7d8U, (uint64_t)0x521c879668ca7158U, (uint64_t)0xb9d5133bce6f1a05U,
+    (uint64_t)0x2d50cd53fd0ebee4U, (uint64_t)0x889f6d65533ef217U, (uint64_t)0x7158c7e4c3ca2e87U,
+    (uint64_t)0xfb670dfbdc2b4167U, (uint64_t)0x75910a01844c257fU, (uint64_t)0xf336bf07cf88577dU,
+    (uint64_t)0x22245250e45e2aceU, (uint64_t)0x2ed92e8d7ca23d85U, (uint64_t)0x29f8be4c2b812f58U,
+    (uint64_t)0xfbb9b2452133ffd9U, (uint64_t)0x39a8b2f1830f1a20U, (uint64_t)0x484bc97dd5a1f52aU,
+    (uint64_t)0xd6aebf56a40eddf8U, (uint64_t)0x32257acb76ccdac6U, (uint64_t)0xaf4d36ec1586ff27U,
+    (uint64_t)0x8eaa8863f8de7dd1U, (uint64_t)0x0045d5cf88647c16U, (uint64_t)0xc51e414351facc61U,
+    (uint64_t)0xbaf2647de68a25bcU, (uint64_t)0x8f5271a00ff872edU, (uint64_t)0x8f32ef993d2d9659U,
+    (uint64_t)0xca12488c7593cbd4U, (uint64_t)0xed266c5d02b82fabU, (uint64_t)0x0a2f78ad14eb3f16U,
+    (uint64_t)0xc34049484d47afe3U, (uint64_t)0xa6f3d574c005979dU, (uint64_t)0xc2072b426a40e350U,
+    (uint64_t)0xfca5c1568de2ecf9U, (uint64_t)0xa8c8bf5ba515344eU, (uint64_t)0x97aee555114df14aU,
+    (uint64_t)0xd4374a4dfdc5ec6bU, (uint64_t)0x754cc28f2ca85418U, (uint64_t)0x71cb9e27d3c41f78U,
+    (uint64_t)0x09c1670209470496U, (uint64_t)0xa489a5edebd23815U, (uint64_t)0xc4dde4648edd4398U,
+    (uint64_t)0x3ca7b94a80111696U, (uint64_t)0x3c385d682ad636a4U, (uint64_t)0x6702702508dc5f1eU,
+    (uint64_t)0x0c1965deafa21943U, (uint64_t)0x18666e16610be69eU, (uint64_t)0x6792fd350369c8e1U,
+    (uint64_t)0x9271aa62b9dc843bU, (uint64_t)0x8711a4b14d02e2abU, (uint64_t)0x02b2a3e27ee1a383U,
+    (uint64_t)0xb226e35f0e2b379bU, (uint64_t)0x3d3de39cd652ab25U, (uint64_t)0xaca6d4c93b560106U,
+    (uint64_t)0xeced0cf4c95bd877U, (uint64_t)0x45beb4ca2a604b3bU, (uint64_t)0x56f651843a616762U,
+    (uint64_t)0xf52f5a70978b806eU, (uint64_t)0x7aa3978711dc4480U, (uint64_t)0xe13fac2a0e01fabcU,
+    (uint64_t)0x7c6ee8a5237d99f9U, (uint64_t)0x251384ee05211ffeU, (uint64_t)0x4ff6976d1bc9d3ebU,
+    (uint64_t)0x8910507903605c39U, (uint64_t)0xf0843d9ea142c96cU, (uint64_t)0xf374493416923684U,
+    (uint64_t)0x732caa2ffa0a2893U, (uint64_t)0xb2e8c27061160170U, (uint64_t)0xc32788cc437fbaa3U,
+    (uint64_t)0x39cd818ea6eda3acU, (uint64_t)0xe2e942399e2b2e07U, (uint64_t)0x8df275455922ac1cU,
+    (uint64_t)0xa7b3ef5ca52b3f63U, (uint64_t)0x8e77b21471de57c4U, (uint64_t)0x31682c10834c008bU,
+    (uint64_t)0xc76824f04bd55d31U, (uint64_t)0xb6d1c08617b61c71U, (uint64_t)0x31db0903c2a5089dU,
+    (uint64_t)0x9c092172184e5d3fU, (uint64_t)0x5ace5035ea6c3997U, (uint64_t)0x54259aaac2610befU,
+    (uint64_t)0xef18bb3f3c80dd39U, (uint64_t)0x6910b95b5fc3fa39U, (uint64_t)0xfce2f51043e09aeeU,
+    (uint64_t)0xced56c9fa7675665U, (uint64_t)0x10e265acd872db61U, (uint64_t)0x6982812eae9fce69U,
+    (uint64_t)0xca2eb690768fccfcU, (uint64_t)0xf402d37db835b362U, (uint64_t)0x0efac0d0e2fdfcceU,
+    (uint64_t)0xefc9cdefb638d990U, (uint64_t)0x2af12b72d1669a8bU, (uint64_t)0x33c536bc5774ccbdU,
+    (uint64_t)0x30b21909fb34870eU, (uint64_t)0xc38fa2f77df25acaU, (uint64_t)0xb8fa3d931341ed7aU,
+    (uint64_t)0x4223272ca7b59d49U, (uint64_t)0x3dcb194783b8c4a4U, (uint64_t)0x4e413c01ed1302e4U,
+    (uint64_t)0x6d999127e17e44ceU, (uint64_t)0xee86bf7533b3adfbU, (uint64_t)0xf6902fe625aa96caU,
+    (uint64_t)0xb73540e4e5aae47dU, (uint64_t)0x7bfc5e75b2c69dbcU, (uint64_t)0x3aa77a2903c3da6cU,
+    (uint64_t)0xde0df03cca910271U, (uint64_t)0xcbd5ca4a7806dc55U, (uint64_t)0xe1ca58076db476cbU,
+    (uint64_t)0xfde15d625f37a31eU, (uint64_t)0xf49af520f41af416U, (uint64_t)0x96c5c5b17d342db5U,
+    (uint64_t)0xcc50ef6c872b4a60U, (uint64_t)0xab2a34a44613521bU, (uint64_t)0x39c5c190983e15d1U,
+    (uint64_t)0x61dde5df59905512U, (uint64_t)0xe417f6219f2275f3U, (uint64_t)0x0750c8b6451d894bU,
+    (uint64_t)0x75b04ab978b0bdaaU, (uint64_t)0x3bfd9fd4458589bdU, (uint64_t)0xc792e02adb22b94bU,
+    (uint64_t)0x993d8ae9a1eaa45bU, (uint64_t)0x8aad6cd3cd1e1c63U, (uint64_t)0x89529ca7c5ce688aU,
+    (uint64_t)0x2ccee3aae572a253U, (uint64_t)0xe02b643802a21efbU, (uint64_t)0xa7091b6ec9430358U,
+    (uint64_t)0x06d1b1fa9d7db504U, (uint64_t)0xaafcbfabaf95894cU, (uint64_t)0x7b9bdc07276b2241U,
+    (uint64_t)0xeaf983625bdda48bU, (uint64_t)0x5977faf2a3fcb4dfU, (uint64_t)0xbed042ef052c4b5bU,
+    (uint64_t)0x9fe87f71067591f0U, (uint64_t)0xc89c73ca22f24ec7U, (uint64_t)0x7d37fa9ee64a9f1bU,
+    (uint64_t)0xcc7a64880a750c0fU, (uint64_t)0x39bacfe34e548e83U, (uint64_t)0x3d418c760c110f05U,
+    (uint64_t)0x3e4daa4cb1f11588U, (uint64_t)0x2733e7b55ffc69ffU, (uint64_t)0x46f147bc92053127U,
+    (uint64_t)0x885b2434d722df94U, (uint64_t)0x6a444f65e6fc6b7cU, (uint64_t)0x7a1a465ac3f16ea8U,
+    (uint64_t)0x115a461db2f1d11cU, (uint64_t)0x4767dd956c68a172U, (uint64_t)0x3392f2ebd13a4698U,
+    (uint64_t)0xc7a99ccde526cdc7U, (uint64_t)0x8e537fdc22292b81U, (uint64_t)0x76d8cf69a6d39198U,
+    (uint64_t)0xffc5ff432446852dU, (uint64_t)0x6d0b16f4bdaedfbdU, (uint64_t)0x23fd326086746cedU,
+    (uint64_t)0x8bfb1d2fff4b3e17U, (uint64_t)0xc7f2ec2d019c14c8U, (uint64_t)0x3e0832f245104b0dU,
+    (uint64_t)0x5f00dafbadea2b7eU, (uint64_t)0x29e5cf6699fbfb0fU, (uint64_t)0x264f972361827cdaU,
+    (uint64_t)0x97b14f7ea90567e6U, (uint64_t)0x513257b7b6ae5cb7U, (uint64_t)0x85454a3c9f10903dU,
+    (uint64_t)0xd8d2c9ad69bc3724U, (uint64_t)0x38da93246b29cb44U, (uint64_t)0xb540a21d77c8cbacU,
+    (uint64_t)0x9bbfe43501918e42U, (uint64_t)0xfffa707a56c3614eU, (uint64_t)0x6eb1a2f3e30bc27fU,
+    (uint64_t)0xe5f0c05ab0836511U, (uint64_t)0x4d741bbf4965ab0eU, (uint64_t)0xfeec41ca83464bbdU,
+    (uint64_t)0x1aca705f99d0b09fU, (uint64_t)0xc5d6cc56f42da5faU, (uint64_t)0x49964eddcc52b931U,
+    (uint64_t)0x8ae59615c884d8d8U, (uint64_t)0x0ce4e3f1d4e353b7U, (uint64_t)0x062d8a14ef46b0a0U,
+    (uint64_t)0x6408d5ab574b73fdU, (uint64_t)0xbc41d1c9d3273ffdU, (uint64_t)0x3538e1e76be77800U,
+    (uint64_t)0x71fe8b37c5655031U, (uint64_t)0x1cd916216b9b331aU, (uint64_t)0xad825d0bbb388f73U,
+    (uint64_t)0xf634b57b39f8868aU, (uint64_t)0xe27f4fd475cc69afU, (uint64_t)0xa47e58cbd0d5496eU,
+    (uint64_t)0x8a26793fd323e07fU, (uint64_t)0xc61a9b72fa30f349U, (uint64_t)0x94c9d9c9b696d134U,
+    (uint64_t)0x792beca85880a6d1U, (uint64_t)0xbdcc4645af039995U, (uint64_t)0x56c2e05b1cb76219U,
+    (uint64_t)0x0ec0bf9171567e7eU, (uint64_t)0xe7076f8661c4c910U, (uint64_t)0xd67b085bbabc04d9U,
+    (uint64_t)0x9fb904595e93a96aU, (uint64_t)0x7526c1eafbdc249aU, (uint64_t)0x0d44d367ecdd0bb7U,
+    (uint64_t)0x953999179dc0d695U, (uint64_t)0x83f49167ceca9754U, (uint64_t)0x426d2cf64b7939a0U,
+    (uint64_t)0x2555e355723fd0bfU, (uint64_t)0xa96e6d06c4f144e2U, (uint64_t)0x4768a8dd87880e61U,
+    (uint64_t)0x15543815e508e4d5U, (uint64_t)0x09d7e772b1b65e15U, (uint64_t)0x63439dd6ac302fa0U,
+    (uint64_t)0x859d3145983c38b5U, (uint64_t)0xb14f176c637abc8bU, (uint64_t)0x2793fb9dcaff7be6U,
+    (uint64_t)0xebe5a55f35a66a5aU, (uint64_t)0x7cec1dcd9f87dc59U, (uint64_t)0x7c595cd3fbdbf560U,
+    (uint64_t)0x5b543b2226eb3257U, (uint64_t)0x69080646c4c935fdU, (uint64_t)0x6aac688eadd70482U,
+    (uint64_t)0x708de92a7b4a4e8aU, (uint64_t)0x75b6dd73758a6eefU, (uint64_t)0xea4bf352725b3c43U,
+    (uint64_t)0x10041f2c87912868U, (uint64_t)0xb1b1be95ef09297aU, (uint64_t)0x19ae23c5a9f3860aU,
+    (uint64_t)0xc4f0f839515dcf4bU, (uint64_t)0xb93452381d531696U, (uint64_t)0x57201c0088cdde69U,
+    (uint64_t)0xdde922519a86afc7U, (uint64_t)0xe3043895bd35cea8U, (uint64_t)0x7608c1e18555970dU,
+    (uint64_t)0x8267dfa92535935eU, (uint64_t)0xd4c60a57322ea38bU, (uint64_t)0xe0bf7977804ef8b5U,
+    (uint64_t)0xd730049f16a66e91U, (uint64_t)0xe97f2820fa1b0e0dU, (uint64_t)0x4131e003304c28eaU,
+    (uint64_t)0x820ab732526bac62U, (uint64_t)0xb2ac9ef928714423U, (uint64_t)0x54ecfffaadb10cb2U,
+    (uint64_t)0x8781476ef886a4ccU, (uint64_t)0x4b2c87b5db2f8d49U, (uint64_t)0x6ada1d4286d2e0f8U,
+    (uint64_t)0xe59201220e8a9fd5U, (uint64_t)0x02c936af708c1b49U, (uint64_t)0x60f30fee2b4bfaffU,
+    (uint64_t)0x6637ad06858e6a61U, (uint64_t)0xce4c77673fd374d0U, (uint64_t)0x39d54b2d7188defbU,
+    (uint64_t)0xa8c9d250f56a6b66U, (uint64_t)0x0e6ec0965f520698U, (uint64_t)0x640631fe44f7b8d9U,
+    (uint64_t)0x92fd34fca35a68b9U, (uint64_t)0x9c5a4b664d40cf4eU, (uint64_t)0x949454bf80b6783dU,
+    (uint64_t)0x80e701fe3a320a10U, (uint64_t)0x8d1a564a1a0a39b2U, (uint64_t)0x1436d53d320587dbU,
+    (uint64_t)0x6233ea68c094dbb5U, (uint64_t)0xb77d062ed968d410U, (uint64_t)0x3e719bbc58b3002dU,
+    (uint64_t)0x68e7dd3d3dc49d58U, (uint64_t)0x8d825740013a5e58U, (uint64_t)0x213117473c9e3c1bU,
+    (uint64_t)0x0cb0a2a77c99b6abU, (uint64_t)0x5c48a3b3c2f888f2U, (uint64_t)0xc7913e91991724f3U,
+    (uint64_t)0x5eda799c39cbd686U, (uint64_t)0xddb595c763d4fc1eU, (uint64_t)0x6b63b80bac4fed54U,
+    (uint64_t)0x6ea0fc697e5fb516U, (uint64_t)0x737708bad0f1c964U, (uint64_t)0x9628745f11a92ca5U,
+    (uint64_t)0x61f379589a86967aU, (uint64_t)0x9af39b2caa665072U, (uint64_t)0x78322fa4efd324efU,
+    (uint64_t)0x3d153394c327bd31U, (uint64_t)0x81d5f2713129dab0U, (uint64_t)0xc72e0c42f48027f5U,
+    (uint64_t)0xaa40cdbc8536e717U, (uint64_t)0xf45a657a2d369d0fU, (uint64_t)0xb03bbfc4ea7f74e6U,
+    (uint64_t)0x46a8c4180d738dedU, (uint64_t)0x6f1a5bb0e0de5729U, (uint64_t)0xf10230b98ba81675U,
+    (uint64_t)0x32c6f30c112b33d4U, (uint64_t)0x7559129dd8fffb62U, (uint64_t)0x6a281b47b459bf05U,
+    (uint64_t)0x77c1bd3afa3b6776U, (uint64_t)0x0709b3807829973aU, (uint64_t)0x8c26b232a3326505U,
+    (uint64_t)0x38d69272ee1d41bfU, (uint64_t)0x0459453effe32afaU, (uint64_t)0xce8143ad7cb3ea87U,
+    (uint64_t)0x932ec1fa7e6ab666U, (uint64_t)0x6cd2d23022286264U, (uint64_t)0x459a46fe6736f8edU,
+    (uint64_t)0x50bf0d009eca85bbU, (uint64_t)0x0b825852877a21ecU, (uint64_t)0x300414a70f537a94U,
+    (uint64_t)0x3f1cba4021a9a6a2U, (uint64_t)0x50824eee76943c00U, (uint64_t)0xa0dbfcecf83cba5dU,
+    (uint64_t)0xf953814893b4f3c0U, (uint64_t)0x6174416248f24dd7U, (uint64_t)0x5322d64de4fb09ddU,
+    (uint64_t)0x574473843d9325f3U, (uint64_t)0xa9bef2d0f371cb84U, (uint64_t)0x77d2188ba61e36c5U,
+    (uint64_t)0xbbd6a7d7c602df72U, (uint64_t)0xba3aa9028f61bc0bU, (uint64_t)0xf49085ed6ed0b6a1U,
+    (uint64_t)0x8bc625d6ae6e8298U, (uint64_t)0x832b0b1da2e9c01dU, (uint64_t)0xa337c447f1f0ced1U,
+    (uint64_t)0x800cc7939492dd2bU, (uint64_t)0x4b93151dbea08efaU, (uint64_t)0x820cf3f8de0a741eU,
+    (uint64_t)0xff1982dc1c0f7d13U, (uint64_t)0xef92196084dde6caU, (uint64_t)0x1ad7d97245f96ee3U,
+    (uint64_t)0x319c8dbe29dea0c7U, (uint64_t)0xd3ea38717b82b99bU, (uint64_t)0x75922d4d470eb624U,
+    (uint64_t)0x8f66ec543b95d466U, (uint64_t)0x66e673ccbee1e346U, (uint64_t)0x6afe67c4b5f2b89aU,
+    (uint64_t)0x3de9c1e6290e5cd3U, (uint64_t)0x8c278bb6310a2adaU, (uint64_t)0x420fa3840bdb323bU,
+    (uint64_t)0x646f96796424c49bU, (uint64_t)0xf888dfe867c241c9U, (uint64_t)0xe12d4b9324f68b49U,
+    (uint64_t)0x9a6b62d8a571df20U, (uint64_t)0x81b4b26d179483cbU, (uint64_t)0x666f96329511fae2U,
+    (uint64_t)0xd281b3e4d53aa51fU, (uint64_t)0x7f96a7657f3dbd16U, (uint64_t)0x8553d37c051af62bU,
+    (uint64_t)0xe9a998eb0bf94496U, (uint64_t)0xe0844f9fb0d59aa1U, (uint64_t)0x983fd558e6afb813U,
+    (uint64_t)0x9670c0ca65d69804U, (uint64_t)0x732b22de6ea5ff2dU, (uint64_t)0xd7640ba95fd8623bU,
+    (uint64_t)0x9f619163a6351782U, (uint64_t)0xf167b4e0bdefdd4fU, (uint64_t)0x69958465f366e401U,
+    (uint64_t)0x5aa368aba73bbec0U, (uint64_t)0x121487097b240c21U, (uint64_t)0x378c323318969006U,
+    (uint64_t)0xcb4d73cee1fe53d1U, (uint64_t)0x5f50a80e130c4361U, (uint64_t)0xd67f59517ef5212bU,
+    (uint64_t)0x332f81088cad38c0U, (uint64_t)0x471b7e906bd68ae2U, (uint64_t)0x56ac3fb20d8e27a3U,
+    (uint64_t)0xb54660db136b4b0dU, (uint64_t)0x123a1e11a6fd8de4U, (uint64_t)0x44dbffeaa37799efU,
+    (uint64_t)0x4540b977ce6ac17cU, (uint64_t)0x495173a8af60acefU, (uint64_t)0xeb4437434573eab0U,
+    (uint64_t)0x11570dfbd1ac6031U, (uint64_t)0xf7d9b45b44dd9afdU, (uint64_t)0xb8066add22067231U,
+    (uint64_t)0x15f92ad8f8a3f0b4U, (uint64_t)0x9e0e4899e0ace2a2U, (uint64_t)0xbdcd0aadfab38b80U,
+    (uint64_t)0x46506ae917020052U, (uint64_t)0x429a69f78fca399dU, (uint64_t)0xfe9e27d20207bb63U,
+    (uint64_t)0xec655ed68788f582U, (uint64_t)0xa426d748adb75f6eU, (uint64_t)0x18695c02ca81c66dU,
+    (uint64_t)0x84fb8d27a531d425U, (uint64_t)0x3a3a8956deff48baU, (uint64_t)0xaf1d0d56766d2247U,
+    (uint64_t)0x5a059565352c4b5cU, (uint64_t)0x49261531590bc3e2U, (uint64_t)0x809f7521f66f9f5fU,
+    (uint64_t)0x2baef6bfc70a4a9bU, (uint64_t)0xe7e6fa6509ed3561U, (uint64_t)0x11370233984b230cU,
+    (uint64_t)0x2151659bd04cdc69U, (uint64_t)0xbdb83c63f007d416U, (uint64_t)0x9ebb284d391c2a82U,
+    (uint64_t)0xbcdd4863158308e8U, (uint64_t)0x006f16ec83f1edcaU, (uint64_t)0xa13e2c37695dc6c8U,
+    (uint64_t)0x2ab756f04a057a87U, (uint64_t)0xa8765500a6b48f98U, (uint64_t)0x4252face68651c44U,
+    (uint64_t)0xa52b540be1765e02U, (uint64_t)0x4f922fc516a0d2bbU, (uint64_t)0x0d5cc16c1a623499U,
+    (uint64_t)0x9241cf3a57c62c8bU, (uint64_t)0x2f5e6961fd1b667fU, (uint64_t)0x5c15c70bf5a01797U,
+    (uint64_t)0x3d20b44d60956192U, (uint64_t)0x04911b37071fdb52U, (uint64_t)0xf648f9168d6f0f7bU,
+    (uint64_t)0x027cc8b8fac61d9aU, (uint64_t)0x7d25e062e3c6fe8aU, (uint64_t)0xe08805bfe5bff503U,
+    (uint64_t)0x13271e6c6ff632f7U, (uint64_t)0x55dca6c0232f76a5U, (uint64_t)0x8957c32d701ef426U,
+    (uint64_t)0xee728bcba10a5178U, (uint64_t)0x5ea60411b62c5173U, (uint64_t)0x4090914bb5def996U,
+    (uint64_t)0x1cb69c83233dd1e7U, (uint64_t)0xc1e9c1d39b3d5e76U, (uint64_t)0x1f3338edfccf6012U,
+    (uint64_t)0xb1e95d0d2f5378a8U, (uint64_t)0xacf4c2c72f00cd21U, (uint64_t)0x6e984240eb5fe290U,
+    (uint64_t)0xd66c038d248088aeU, (uint64_t)0x9ad5462bb4d8bc50U, (uint64_t)0x181c0b16a9195770U,
+    (uint64_t)0xebd4fe1c78412a68U, (uint64_t)0xae0341bcc0dff48cU, (uint64_t)0xb6bc45cf7003e866U,
+    (uint64_t)0xf11a6dea8a24a41bU, (uint64_t)0x5407151ad04c24c2U, (uint64_t)0x62c9d27dda5b7b68U,
+    (uint64_t)0xd4992b30614c0900U, (uint64_t)0xda98d121bd00c24bU, (uint64_t)0x7f534dc87ec4bfa1U,
+    (uint64_t)0x4a5ff67437dc34bcU, (uint64_t)0x68c196b81d7ea1d7U, (uint64_t)0x38cf289380a6d208U,
+    (uint64_t)0xfd56cd09e3cbbd6eU, (uint64_t)0xec72e27e4205a5b6U, (uint64_t)0x32865719a8afd30bU,
+    (uint64_t)0x867983288a826dceU, (uint64_t)0xdf04e891c4a8fbe0U, (uint64_t)0xbb6b6e1bebf56ad3U,
+    (uint64_t)0x0a695b11471f1ff0U, (uint64_t)0xd76c3389be15baf0U, (uint64_t)0x018edb95be96c43eU,
+    (uint64_t)0xf2beaaf490794158U, (uint64_t)0xe8b97932b88756ddU, (uint64_t)0xed4e8652f17e3e61U,
+    (uint64_t)0xc2dd14993ee1c4a4U, (uint64_t)0xc0aaee17597f8c0eU, (uint64_t)0x15c4edb96c168af3U,
+    (uint64_t)0x6563c7bfb39ae875U, (uint64_t)0xadfadb6f20adb436U, (uint64_t)0xad55e8c99a042ac0U,
+    (uint64_t)0x0a50b12e523b8bf6U, (uint64_t)0x8009eb5b8f910c1bU, (uint64_t)0xf535af824a167588U,
+    (uint64_t)0x0f835f9cfb2a2abdU, (uint64_t)0xf59b29312afceb62U, (uint64_t)0xc797df2a169d383fU,
+    (uint64_t)0xeb3f5fb066ac02b0U, (uint64_t)0x029d4c6fdaa2d0caU, (uint64_t)0x58af2010f5b343bcU,
+    (uint64_t)0x0f2e400af2f142feU, (uint64_t)0x3483bfdea85f4bdfU, (uint64_t)0xf0b1d09303bfeaa9U,
+    (uint64_t)0x2ea01b95c7081603U, (uint64_t)0xe943e4c93dba1097U, (uint64_t)0x47be92adb438f3a6U,
+    (uint64_t)0x00bb7742e5bf6636U, (uint64_t)0xb674481b7bfe7178U, (uint64_t)0x4e1debae65405868U,
+    (uint64_t)0x061b2821c48c867dU, (uint64_t)0x69c15b35513b30eaU, (uint64_t)0x3b4a166636871088U,
+    (uint64_t)0xe5e29f5d1220b1ffU, (uint64_t)0x4b82bb35233d9f4dU, (uint64_t)0x4e07633318cdc675U,
+    (uint64_t)0x3a63c39731815e69U, (uint64_t)0x6df9cbd6dcdd2802U, (uint64_t)0x4c47ed4a15b4f6afU,
+    (uint64_t)0x62009d826ac0f978U, (uint64_t)0x664d80d28b898fc7U, (uint64_t)0x72f1eeda2c17c91fU,
+    (uint64_t)0x9e84d3bc7aae6609U, (uint64_t)0x58c7c19528376895U, (uint64_t)0x0d53f5c7a3e6fcedU,
+    (uint64_t)0xe8cbbdd5f45fbdebU, (uint64_t)0xf85c01df13339a70U, (uint64_t)0x0ff71880142ceb81U,
+    (uint64_t)0x4c4e8774bd70437aU, (uint64_t)0x5fb32891ba0bda6aU, (uint64_t)0x1cdbebd2f18bd26eU,
+    (uint64_t)0x2f9526f103a9d522U, (uint64_t)0xa752c905a8271d7eU, (uint64_t)0x4735dfa558e5810bU,
+    (uint64_t)0xe18a44ee5d925aebU, (uint64_t)0x9708697f13c8a853U, (uint64_t)0x8377d540bfcc9a0bU,
+    (uint64_t)0x7b27e01ce574d403U, (uint64_t)0x3d3d180ccf60a8a6U, (uint64_t)0xe48ef152f1c298bfU,
+    (uint64_t)0x313a2e8c0aeaa3c0U, (uint64_t)0x89f46d9eabe85b0aU, (uint64_t)0xd2889ebd2da97d3aU,
+    (uint64_t)0x9484026a103f8cbaU, (uint64_t)0x52159f8a87d83b5fU, (uint64_t)0xdb2220d6b1ef0295U,
+    (uint64_t)0xbda0746e03c01acfU, (uint64_t)0x4f97b2a714419fe3U, (uint64_t)0xccbf7ac2c880e5caU,
+    (uint64_t)0x8299dbee8d11c450U, (uint64_t)0xbb27d11b0f77a6bfU, (uint64_t)0xc601630b5edce793U,
+    (uint64_t)0xdb73b9fb79e7f8eaU, (uint64_t)0xe448bba7f4367288U, (uint64_t)0xf5b6416fb035571bU,
+    (uint64_t)0x981b8f5da48891a2U, (uint64_t)0x40ce305192c4d684U, (uint64_t)0x8b04d7257612efcdU,
+    (uint64_t)0xb9dcda366f9cae20U, (uint64_t)0x0edc4d24f058856cU, (uint64_t)0x64f2e6bf85427900U,
+    (uint64_t)0x3de81295dc09dfeaU, (uint64_t)0xd41b4487379bf26cU, (uint64_t)0x50b62c6d6df135a9U,
+    (uint64_t)0x0db2fb5ed005832aU, (uint64_t)0x5f5efd3b91042e4fU, (uint64_t)0x8c4ffdc6ed70f8caU,
+    (uint64_t)0xe4645d0bb52da9ccU, (uint64_t)0x9596f58bc9001d1fU, (uint64_t)0x52c8f0bc4e117205U,
+    (uint64_t)0xfd4aa0d2e398a084U, (uint64_t)0x815bfe3a104f49deU, (uint64_t)0x54eb3acce548b37bU,
+    (uint64_t)0xb38e754284d40549U, (uint64_t)0x8c3daa517b341b4fU, (uint64_t)0x2f6928ec690bf7faU,
+    (uint64_t)0x0496b32386ce6c41U, (uint64_t)0x01be1c5510adadcdU, (uint64_t)0xc04e67e74bb5faf9U,
+    (uint64_t)0x3cbaf678e15c9985U, (uint64_t)0x524d226ad7ab9a2dU, (uint64_t)0x9c00090d7dfae958U,
+    (uint64_t)0x0ba5f5398751d8c2U, (uint64_t)0x8afcbcdd3ab8262dU, (uint64_t)0x57392729e99d043bU,
+    (uint64_t)0xef51263baebc943aU, (uint64_t)0x9feace9320862935U, (uint64_t)0x639efc03b06c817bU,
+    (uint64_t)0xe839be7d341d81dcU, (uint64_t)0xcddb688932148379U, (uint64_t)0xda6211a1f7026eadU,
+    (uint64_t)0xf3b2575ff4d1cc5eU, (uint64_t)0x40cfc8f6a7a73ae6U, (uint64_t)0x83879a5e61d5b483U,
+    (uint64_t)0xc5acb1ed41a50ebcU, (uint64_t)0x59a60cc83c07d8faU, (uint64_t)0xdec98d4ac3b81990U,
+    (uint64_t)0x1cb837229e0cc8feU, (uint64_t)0xfe0b0491d2b427b9U, (uint64_t)0x0f2386ace983a66cU,
+    (uint64_t)0x930c4d1eb3291213U, (uint64_t)0xa2f82b2e59a62ae4U, (uint64_t)0x77233853f93e89e3U,
+    (uint64_t)0x7f8063ac11777c7fU, (uint64_t)0x604ac97c59371000U, (uint64_t)0xe1c48c707f759c18U,
+    (uint64_t)0x3f62ecc5a5db6b65U, (uint64_t)0x0a78b17338a21495U, (uint64_t)0x6be1819dbcc8ad94U,
+    (uint64_t)0x70dc04f6d89c3400U, (uint64_t)0x462557b4a6b4840aU, (uint64_t)0x544c6ade60bd21c0U,
+    (uint64_t)0x36e607cf02ff6072U, (uint64_t)0xa47d2ca98ad98cdcU, (uint64_t)0xbf471d1ef5f56609U,
+    (uint64_t)0xbcf86623f264ada0U, (uint64_t)0xb70c0687aa9e5cb6U, (uint64_t)0xc98124f217401c6cU,
+    (uint64_t)0x8189635fd4a61435U, (uint64_t)0xd28fb8afa9d98ea6U, (uint64_t)0x439530b665c7322dU,
+    (uint64_t)0xcf12cc01b3c1b3fbU, (uint64_t)0xc70b01860172f685U, (uint64_t)0xb915ee221b58391dU,
+    (uint64_t)0x9afdf03ba317db24U, (uint64_t)0x87dec65917b8ffc4U, (uint64_t)0x7f46597be4d3d050U,
+    (uint64_t)0x80a1c1ed006500e7U, (uint64_t)0x3e22a7b397acf4ecU, (uint64_t)0x0426c4005ea8b640U,
+    (uint64_t)0x5e3295a64e969285U, (uint64_t)0x22aabc59a6a45670U, (uint64_t)0xb929714c5f5942bcU,
+    (uint64_t)0x9a6168bdfa3182edU, (uint64_t)0x2216a665104152baU, (uint64_t)0x46908d03b6926368U,
+    (uint64_t)0xa9f5d8745a1251fbU, (uint64_t)0x967747a8c72725c7U, (uint64_t)0x195c33e531ffe89eU,
+    (uint64_t)0x609d210fe964935eU, (uint64_t)0xcafd6ca82fe12227U, (uint64_t)0xaf9b5b960426469dU,
+    (uint64_t)0x2e9ee04c5693183cU, (uint64_t)0x1084a333c8146fefU, (uint64_t)0xce06b88210395755U,
+    (uint64_t)0x117ce6345ec1df80U, (uint64_t)0xfefae513eff55e96U, (uint64_t)0xcf36cba6fd7fed1eU,
+    (uint64_t)0x7340eca9a40ebf88U, (uint64_t)0xe6ec1bcfb3d37e12U, (uint64_t)0xca51b64e86bbf9ffU,
+    (uint64_t)0x4e0dbb588b40e05eU, (uint64_t)0x96649933aed1d1f7U, (uint64_t)0x566eaff350563090U,
+    (uint64_t)0x345057f0ad2e39cfU, (uint64_t)0x148ff65b1f832124U, (uint64_t)0x042e89d4cf94cf0dU,
+    (uint64_t)0x319bec84520c58b3U, (uint64_t)0x2a2676265361aa0dU, (uint64_t)0xc86fa3028fbc87adU,
+    (uint64_t)0x359d7b9c7ea2ee34U, (uint64_t)0x3fd0d94c09cc3a71U, (uint64_t)0xbb53c31c3a1ea37aU,
+    (uint64_t)0x533425facf818c87U, (uint64_t)0x7cd199c3810156e0U, (uint64_t)0x0ea020e430c16448U,
+    (uint64_t)0xe557ba094a642542U, (uint64_t)0xe657e7e79465f5eaU, (uint64_t)0xfc83d2ab5c8b06d5U,
+    (uint64_t)0xb1a785a2fe4eac46U, (uint64_t)0xb99315bc846f7779U, (uint64_t)0xcf31d816ef9ea505U,
+    (uint64_t)0x2391fe6a15d7dc85U, (uint64_t)0x2f132b04b4016b33U, (uint64_t)0x29547fe3181cb4c7U,
+    (uint64_t)0xdb66d8a6650155a1U, (uint64_t)0x59cd0e8b593d070fU, (uint64_t)0x437575165255625dU,
+    (uint64_t)0x551fdda75b7a0399U, (uint64_t)0x7bb6e6b02dec1eebU, (uint64_t)0x729bb662334c0922U,
+    (uint64_t)0x3df631df0cf41b79U, (uint64_t)0x01abf3c578f32402U, (uint64_t)0xfcb4666c9cd33c88U,
+    (uint64_t)0x6b66d7e1adc1696fU, (uint64_t)0x98ebe5930acd72d0U, (uint64_t)0x65f24550cc1b7435U,
+    (uint64_t)0xce231393b4b9a5ecU, (uint64_t)0x234a22d4db067df9U, (uint64_t)0x98dda095caff9b00U,
+    (uint64_t)0x1bbc75a06100c9c1U, (uint64_t)0x1560a9c8939cf695U, (uint64_t)0xe4050f1cf1c367caU,
+    (uint64_t)0x9bc85a9bc90fbc7dU, (uint64_t)0xa373c4a2e1a11032U, (uint64_t)0xb64232b7ad0393a9U,
+    (uint64_t)0xf5577eb0167dad29U, (uint64_t)0x1604f30194b78ab2U, (uint64_t)0x0baa94afe829348bU,
+    (uint64_t)0x77fbd8dd41654342U, (uint64_t)0x31f14802fcf0a7fdU, (uint64_t)0x42fd07895488b01eU,
+    (uint64_t)0x71d78d6d9952b498U, (uint64_t)0x8eb572d907ac5201U, (uint64_t)0xe0a2a44c4d194a88U,
+    (uint64_t)0xd2b63fd9ba017e66U, (uint64_t)0x78efc6c8f888aefcU, (uint64_t)0xb76f6bda4a881a11U,
+    (uint64_t)0xa2f7932c68af43eeU, (uint64_t)0x5502468e703d00bdU, (uint64_t)0xe5dc978f2fb061f5U,
+    (uint64_t)0xc9a1904a28c815adU, (uint64_t)0xd3af538d470c56a4U, (uint64_t)0x159abc5f193d8cedU,
+    (uint64_t)0x2a37245f20108ef3U, (uint64_t)0xfa17081e223f7178U, (uint64_t)0x1fe2a9b2b4b4b67cU,
+    (uint64_t)0xc1d10df0e8020604U, (uint64_t)0x9d64abfcbc8058d8U, (uint64_t)0x8943b9b2712a0fbbU,
+    (uint64_t)0x90eed9143b3def04U, (uint64_t)0x85ab3aa24ce775ffU, (uint64_t)0x605fd4ca7bbc9040U,
+    (uint64_t)0x8b34a564e2c75dfbU, (uint64_t)0x5c18acf88e2f7d90U, (uint64_t)0xfdbf33d777be32cdU,
+    (uint64_t)0x0a085cd7d2eb5ee9U, (uint64_t)0x2d702cfbb3201115U, (uint64_t)0xb6e0ebdb85c88ce8U,
+    (uint64_t)0x23a3ce3c1e01d617U, (uint64_t)0x3041618e567333acU, (uint64_t)0x9dd0fd8f157edb6bU,
+    (uint64_t)0xb2b2610798fa7aaaU, (uint64_t)0x41209ee4f073aa4eU, (uint64_t)0xf1570359f2d6b19bU,
+    (uint64_t)0xcbe6868cfc577cafU, (uint64_t)0x186c4bdc32c04dd3U, (uint64_t)0xa6c35faecfeee397U,
+    (uint64_t)0xb4a1b312f086c0cfU, (uint64_t)0xe0a5ccc6d9461fe2U, (uint64_t)0x516ff3a36fa6110cU,
+    (uint64_t)0x74fb1eb1fb93561fU, (uint64_t)0x6c0c90478457522bU, (uint64_t)0xcfd321046bb8bdc6U,
+    (uint64_t)0x2d6884a2cc80ad57U, (uint64_t)0x7c27fc3586a9b637U, (uint64_t)0x3461baedadf4e8cdU,
+    (uint64_t)0x1d56251a617242f0U, (uint64_t)0xb84011a9431dd80eU, (uint64_t)0xeb7c7cca73306cd9U,
+    (uint64_t)0x20fadd29d1b3b730U, (uint64_t)0x83858b5bfe37b3d3U, (uint64_t)0xbf4cd193b6251d5cU,
+    (uint64_t)0x1cca1fd31352d952U, (uint64_t)0xc66157a490fbc051U, (uint64_t)0x7990a63889b98636U,
+    (uint64_t)0xe5aa692a87dec0e1U, (uint64_t)0x010ded8df7b39d00U, (uint64_t)0x7b1b80c854cfa0b5U,
+    (uint64_t)0x66beb876a0f8ea28U, (uint64_t)0x50d7f5313476cd0eU, (uint64_t)0xa63d0e65b08d3949U,
+    (uint64_t)0x1a09eea953479fc6U, (uint64_t)0x82ae9891f499e742U, (uint64_t)0xab58b9105ca7d866U,
+    (uint64_t)0x582967e23adb3b34U, (uint64_t)0x89ae4447cceac0bcU, (uint64_t)0x919c667c7bf56af5U,
+    (uint64_t)0x9aec17b160f5dcd7U, (uint64_t)0xec697b9fddcaadbcU, (uint64_t)0x0b98f341463467f5U,
+    (uint64_t)0xb187f1f7a967132fU, (uint64_t)0x90fe7a1d214aeb18U, (uint64_t)0x1506af3c741432f7U,
+    (uint64_t)0xbb5565f9e591a0c4U, (uint64_t)0x10d41a77b44f1bc3U, (uint64_t)0xa09d65e4a84bde96U,
+    (uint64_t)0x42f060d8f20a6a1cU, (uint64_t)0x652a3bfdf27f9ce7U, (uint64_t)0xb6bdb65c3b3d739fU,
+    (uint64_t)0xeb5ddcb6ec7fae9fU, (uint64_t)0x995f2714efb66e5aU, (uint64_t)0xdee95d8e69445d52U,
+    (uint64_t)0x1b6c2d4609e27620U, (uint64_t)0x32621c318129d716U, (uint64_t)0xb03909f10958c1aaU,
+    (uint64_t)0x8c468ef91af4af63U, (uint64_t)0x162c429ffba5cdf6U, (uint64_t)0x2f682343753b9371U,
+    (uint64_t)0x29cab45a5f1f9cd7U, (uint64_t)0x571623abb245db96U, (uint64_t)0xc507db093fd79999U,
+    (uint64_t)0x4e2ef652af036c32U, (uint64_t)0x86f0cc7805018e5cU, (uint64_t)0xc10a73d4ab8be350U,
+    (uint64_t)0x6519b3977e826327U, (uint64_t)0xe8cb5eef9c053df7U, (uint64_t)0x8de25b37b300ea6fU,
+    (uint64_t)0xdb03fa92c849cffbU, (uint64_t)0x242e43a7e84169bbU, (uint64_t)0xe4fa51f4dd6f958eU,
+    (uint64_t)0x6925a77ff4445a8dU, (uint64_t)0xe6e72a50e90d8949U, (uint64_t)0xc66648e32b1f6390U,
+    (uint64_t)0xb2ab1957173e460cU, (uint64_t)0x1bbbce7530704590U, (uint64_t)0xc0a90dbddb1c7162U,
+    (uint64_t)0x505e399e15cdd65dU, (uint64_t)0x68434dcb57797ab7U, (uint64_t)0x60ad35ba6a2ca8e8U,
+    (uint64_t)0x4bfdb1e0de3336c1U, (uint64_t)0xbbef99ebd8b39015U, (uint64_t)0x6c3b96f31711ebecU,
+    (uint64_t)0x2da40f1fce98fdc4U, (uint64_t)0xb99774d357b4411fU, (uint64_t)0x87c8bdf415b65bb6U,
+    (uint64_t)0xda3a89e3c2eef12dU, (uint64_t)0xde95bb9b3c7471f3U, (uint64_t)0x600f225bd812c594U,
+    (uint64_t)0x54907c5d2b75a56bU, (uint64_t)0xa80d1db6f79588c0U, (uint64_t)0xfa52fc69b55768ccU,
+    (uint64_t)0x0b4df1ae7f54438aU, (uint64_t)0x0cadd1a7f9b46a4fU, (uint64_t)0xb40ea6b31803dd6fU,
+    (uint64_t)0x488e4fa555eaae35U, (uint64_t)0x9f047d55382e4e16U, (uint64_t)0xc9b5b7e02f6e0c98U,
+    (uint64_t)0xc12738b67c4a658aU, (uint64_t)0xb3c4763940e72182U, (uint64_t)0x3b77be468798e44fU,
+    (uint64_t)0xdc047df217a7f85fU, (uint64_t)0x2439d4c55e59d92dU, (uint64_t)0xcedca475e8e64d8dU,
+    (uint64_t)0xa724cd0d87ca9b16U, (uint64_t)0x35e4fd59a5540dfeU, (uint64_t)0x4b7d0e0683a7337bU,
+    (uint64_t)0x1e3416d4ffecf249U, (uint64_t)0x24840eff66a2b71fU, (uint64_t)0xd0d9a50ab37cc26dU,
+    (uint64_t)0xe21981506fe28ef7U, (uint64_t)0x3cc5ef1623324c7fU, (uint64_t)0x220f3455769b5263U,
+    (uint64_t)0xe2ade2f1a10bf475U, (uint64_t)0x9894344f3a29467aU, (uint64_t)0xde81e949c51eba6dU,
+    (uint64_t)0xdaea066ba5e5c2f2U, (uint64_t)0x3fc8a61408c8c7b3U, (uint64_t)0x7adff88f06d0de9fU,
+    (uint64_t)0xbbc11cf53b75ce0aU, (uint64_t)0x9fbb7accfbbc87d5U, (uint64_t)0xa1458e267badfde2U,
+    (uint64_t)0x03b6c8c7dacddb7dU, (uint64_t)0x92ed50047e1edcadU, (uint64_t)0xa0e46c2f54080633U,
+    (uint64_t)0xcd37663d46dec1ceU, (uint64_t)0x396984c5f365b7ccU, (uint64_t)0x294e3a2ae79bb95dU,
+    (uint64_t)0x9aa17d7727b1d3c1U, (uint64_t)0x3ffd3cfae49440f5U, (uint64_t)0x041c93e3abb830d1U,
+    (uint64_t)0x2ad235325c2c5270U, (uint64_t)0xaefd1be2ee4b259dU, (uint64_t)0x3ef267771eadd857U,
+    (uint64_t)0x2af8f7039b0d7d86U, (uint64_t)0x80f5af2d7b7e6f20U, (uint64_t)0xb5fa1d3ccec8e295U,
+    (uint64_t)0xe73f3902f68f09f6U, (uint64_t)0x26679d11399f9cf3U, (uint64_t)0x78e7a48e1e3c4394U,
+    (uint64_t)0x08722dea0d98daf1U, (uint64_t)0x37e7ed5880030ea3U, (uint64_t)0xf3731ad43c8aae72U,
+    (uint64_t)0x7878be95ac729695U, (uint64_t)0x6a643affbbc28352U, (uint64_t)0xef8b801b78759b61U,
+    (uint64_t)0x1cb43668e039c256U, (uint64_t)0x5f26fb8b7c17fd5dU, (uint64_t)0xeee426af79aa062bU,
+    (uint64_t)0x072002d0d78fbf04U, (uint64_t)0x4c9ca237e84fb7e3U, (uint64_t)0xb401d8a10c82133dU,
+    (uint64_t)0xaaa525926d7e4181U, (uint64_t)0xe943083373dbb152U, (uint64_t)0xf92dda31be24319aU,
+    (uint64_t)0x03f7d28be095a8e7U, (uint64_t)0xa52fe84098782185U, (uint64_t)0x276ddafe29c24dbcU,
+    (uint64_t)0x80cd54961d7a64ebU, (uint64_t)0xe43608897f1dbe42U, (uint64_t)0x2f81a8778438d2d5U,
+    (uint64_t)0x7e4d52a885169036U, (uint64_t)0x7b15fd9d615faa8fU, (uint64_t)0x8fa1eb40968554edU,
+    (uint64_t)0x7bb4447e7aa44882U, (uint64_t)0x2bb2d0d1029fff32U, (uint64_t)0x075e2a646caa6d2fU,
+    (uint64_t)0x8eb879de22e7351bU, (uint64_t)0xbcd5624e9a506c62U, (uint64_t)0x218eaef0a87e24dcU,
+    (uint64_t)0x1fe647d83d30a2c5U, (uint64_t)0x0857f77ef78a81dcU, (uint64_t)0x11d5a334131a4a9bU,
+    (uint64_t)0xc0a94af929d393f5U, (uint64_t)0xbc3a5c0bdaa6ec1aU, (uint64_t)0xba9fe49388d2d7edU,
+    (uint64_t)0xbb4335b4bb614797U, (uint64_t)0x991c4d6872f83533U, (uint64_t)0x77b868cee978a1d3U,
+    (uint64_t)0xe3a68b337ab92d04U, (uint64_t)0x5102979487a5b862U, (uint64_t)0x5f0606c33a61d41dU,
+    (uint64_t)0x2814be276f9326f1U, (uint64_t)0x2f521c14c6fe3c2eU, (uint64_t)0x17464d7dacdf7351U,
+    (uint64_t)0x10f5f9d3777f7e44U, (uint64_t)0x1fd84ce43d34a2e3U, (uint64_t)0xee3759ceb43b5d61U,
+    (uint64_t)0x895bc78c619186c7U, (uint64_t)0xf19c3809cbb9725aU, (uint64_t)0xc0be21aade744b1fU,
+    (uint64_t)0xa7d222b060f8056bU, (uint64_t)0x74be6157b23efe11U, (uint64_t)0x6fab2b4f0cd68253U,
+    (uint64_t)0xb6e33878a4d32282U, (uint64_t)0xe36e029d48020ae7U, (uint64_t)0xe05847fb37a9b750U,
+    (uint64_t)0xf876812cb29e3819U, (uint64_t)0x84ad138ed23a17f0U, (uint64_t)0x6d7b4480f0b3950eU,
+    (uint64_t)0xdfa8aef42fd67ae0U, (uint64_t)0x8d3eea2452333af6U, (uint64_t)0x2101a522b99a72cbU,
+    (uint64_t)0x06de6e6787618016U, (uint64_t)0x5ff8c7cde6f3653eU, (uint64_t)0x0a821ab5c7a6754aU,
+    (uint64_t)0x7e3fa52b7cb0b5a2U, (uint64_t)0xa7fb121cc9048790U, (uint64_t)0x1a72502006ce053aU,
+    (uint64_t)0xb490a31f04e929b0U, (uint64_t)0xb06b1244c5f95cd8U, (uint64_t)0xda8c8af0f4ab95f4U,
+    (uint64_t)0x1bae59c2b9e5836dU, (uint64_t)0x07d51e7e3acffffcU, (uint64_t)0x01e15e6ac2ccbcdaU,
+    (uint64_t)0x3bc1923f8528c3e0U, (uint64_t)0x43324577a49fead4U, (uint64_t)0x61a1b8842aa7a711U,
+    (uint64_t)0x4fe7ee31b0e63d34U, (uint64_t)0xf4600572a9e54fabU, (uint64_t)0xc0493334d5e7b5a4U,
+    (uint64_t)0x8589fb9206d54831U, (uint64_t)0xaa70f5cc6583553aU, (uint64_t)0x0879094ae25649e5U,
+    (uint64_t)0xcc90450710044652U, (uint64_t)0xebb0696d02541c4fU, (uint64_t)0x758c1a3ea2dee7a6U,
+    (uint64_t)0xdcde2f3c734b2284U, (uint64_t)0xaba445d24eaba6adU, (uint64_t)0x35aaf66876cee0a7U,
+    (uint64_t)0x7e0b04a9e5aa049aU, (uint64_t)0xe74083ad91103e84U, (uint64_t)0xbeb183ce40afecc3U,
+    (uint64_t)0x6b89de9fea043f7aU, (uint64_t)0xb99f0e0399375235U, (uint64_t)0x7614c847b9917970U,
+    (uint64_t)0xfec93ce9524ec067U, (uint64_t)0xe40e7bf89b122520U, (uint64_t)0xb5670631ee4c4774U,
+    (uint64_t)0x6f03847a3b04914cU, (uint64_t)0xc96e9429dc9dd226U, (uint64_t)0x43489b6c8c57c1f8U,
+    (uint64_t)0x0e299d23fe67ba66U, (uint64_t)0x9145076093cf2f34U, (uint64_t)0xf45b5ea997fcf913U,
+    (uint64_t)0x5be008438bd7dddaU, (uint64_t)0x358c3e05d53ff04dU, (uint64_t)0xbf7ccdc35de91ef7U,
+    (uint64_t)0xad684dbfb69ec1a0U, (uint64_t)0x367e7cf2801fd997U, (uint64_t)0x46ffd227cc2338fbU,
+    (uint64_t)0x89ff6fa990e26153U, (uint64_t)0xbe570779331a0076U, (uint64_t)0x43d241c506e1f3afU,
+    (uint64_t)0xfdcdb97dde9b62a3U, (uint64_t)0x6a06e984a0ae30eaU, (uint64_t)0xc9bf16804fbddf7dU,
+    (uint64_t)0x170471a2d36163c4U, (uint64_t)0xff5ba8ae3113655eU, (uint64_t)0xfa2c6e2b57b83180U,
+    (uint64_t)0x1c48271977e0eabeU, (uint64_t)0xf9f3c555337fea97U, (uint64_t)0x340f7022a42581cbU,
+    (uint64_t)0xe1de0bc218f710e3U, (uint64_t)0xee640adef62e5aa8U, (uint64_t)0x16b2389149428940U,
+    (uint64_t)0x361619e455950cc3U, (uint64_t)0xc71d665c56b66bb8U, (uint64_t)0xea034b34afac6d84U,
+    (uint64_t)0xa987f832e5e4c7e3U, (uint64_t)0xa07427727a79a6a7U, (uint64_t)0x56e5d017e26d6c23U,
+    (uint64_t)0x7e50b97638167e10U, (uint64_t)0xaa6c81efe88aa84eU, (uint64_t)0x0ca1f3b7b0dc8595U,
+    (uint64_t)0x27de46089f1d9f2eU, (uint64_t)0x1af3bf39badd82a7U, (uint64_t)0x79356a7965862448U,
+    (uint64_t)0xc0602345f5f9a052U, (uint64_t)0x1a8b0f89139a42f9U, (uint64_t)0xb53eee42844d40fcU,
+    (uint64_t)0x93b0bfe54e5b6368U, (uint64_t)0x0f893a5dc8de610bU, (uint64_t)0xe8c515fb67e223ceU,
+    (uint64_t)0x7774bfa64ead6dc5U, (uint64_t)0x89d20f95925c728fU, (uint64_t)0x7a1e0966098583ceU,
+    (uint64_t)0xa2eedb9493f2a7d7U, (uint64_t)0x1b2820974c304d4aU, (uint64_t)0x0842e3dac077282dU,
+    (uint64_t)0xa1010e9d74cd06ffU, (uint64_t)0x9c17c7dfaca3eeacU, (uint64_t)0x74c86cd38063aa2bU,
+    (uint64_t)0x8595c4b3734614ffU, (uint64_t)0xa3de00ca990f62ccU, (uint64_t)0xd9bed213ca0c3be5U,
+    (uint64_t)0x7886078adf8ce9f5U, (uint64_t)0xddb27ce35cd44444U, (uint64_t)0x5a3097befc15aa1eU,
+    (uint64_t)0x40d12548b54b0745U, (uint64_t)0x5bad4706519a5f12U, (uint64_t)0xed03f717a439dee6U,
+    (uint64_t)0x0794bb6c4a02c499U, (uint64_t)0xf725083dcffe71d2U, (uint64_t)0x2cad75190f3adcafU,
+    (uint64_t)0x7f68ea1c43729310U, (uint64_t)0x9c7c581d26ee8382U, (uint64_t)0xcf17dcc5359d638eU,
+    (uint64_t)0xee8273abb728ae3dU, (uint64_t)0x1d112926f821f047U, (uint64_t)0x1149847750491a74U,
+    (uint64_t)0x687fa761fde0dfb9U, (uint64_t)0x2c2580227ea435abU, (uint64_t)0x6b8bdb9491ce7e3fU,
+    (uint64_t)0x9c806d8af7f91d0fU, (uint64_t)0x3b61b0f1a82a5728U, (uint64_t)0x4640032d94d76754U,
+    (uint64_t)0x273eb5de47d834c6U, (uint64_t)0x2988abf77b4e4d53U, (uint64_t)0xb7ce66bfde401777U,
+    (uint64_t)0x9fba6b32715071b3U, (uint64_t)0x82413c24ad3a1a98U, (uint64_t)0x75537b7e3cc8ac85U,
+    (uint64_t)0x8d725f57dd02753bU, (uint64_t)0xfd05ff64b737df2fU, (uint64_t)0x55fe8712f6d2531dU,
+    (uint64_t)0x57ce04a96ab6b01cU, (uint64_t)0x69a02a897cd93724U, (uint64_t)0x4f82ac35cf86699bU,
+    (uint64_t)0x8242d3ad9cb4b232U, (uint64_t)0x69c435269be47be0U, (uint64_t)0x323b7dd8cb28fea1U,
+    (uint64_t)0xfa5538ba3a6c67e5U, (uint64_t)0xef921d701d378e46U, (uint64_t)0xf92961fc3c4b880eU,
+    (uint64_t)0x3f6f914e98940a67U, (uint64_t)0xa990eb0afef0ff39U, (uint64_t)0xa6c2920ff0eeff9cU,
+    (uint64_t)0xb23a03a553fb2b56U, (uint64_t)0x6ce141e74e057f78U, (uint64_t)0x796525c389e490d9U,
+    (uint64_t)0x0bc95725a31a7e75U, (uint64_t)0x1ec567911220fd06U, (uint64_t)0x716e3a3c408b0bd6U,
+    (uint64_t)0x31cd6bf7e8ebeba9U, (uint64_t)0xa7326ca6bee6b670U, (uint64_t)0x20d3c982cf7d62d2U,
+    (uint64_t)0x1f36e29d23ba8150U, (uint64_t)0x48ae0bf092763f9eU, (uint64_t)0x7a527e6b1d3a7007U,
+    (uint64_t)0xb4a89097581a85e3U, (uint64_t)0x1f1a520fdc158be5U, (uint64_t)0xf98db37d167d726eU,
+    (uint64_t)0x8802786e1113e862U, (uint64_t)0xefb2149e36f09ab0U, (uint64_t)0x03f163ca4a10bb5bU,
+    (uint64_t)0xd029704506e20998U, (uint64_t)0x56f0af001b5a3babU, (uint64_t)0x7af4cfec70880e0dU,
+    (uint64_t)0x7332a66fbe3d913fU, (uint64_t)0x32e6c84a7eceb4bdU, (uint64_t)0xedc4a79a9c228f55U,
+    (uint64_t)0xf6e894d1f4c6b6ecU, (uint64_t)0x526b082718b3cd9bU, (uint64_t)0x73f952a812117fbfU,
+    (uint64_t)0x2be864b011945bf5U, (uint64_t)0x86f18ea542099b64U, (uint64_t)0x2770b28a07548ce2U,
+    (uint64_t)0x97390f28295c1c9cU, (uint64_t)0x672e6a43cb5206c3U, (uint64_t)0xc37c7dd0c55c4496U,
+    (uint64_t)0xa6a9635725bbabd2U, (uint64_t)0x5b7e63f2add7f363U, (uint64_t)0x9dce37822e73f1dfU,
+    (uint64_t)0xe1e5a16ab2b91f71U, (uint64_t)0xe44898235ba0163cU, (uint64_t)0xf2759c32f6e515adU,
+    (uint64_t)0xa5e2f1f88615eecfU, (uint64_t)0xcacce2c847c64367U, (uint64_t)0x6a496b9f45af4ec0U,
+    (uint64_t)0x2a0836f36034042cU, (uint64_t)0x14a1f3900b6c62eaU, (uint64_t)0xe7fa93633ef1f540U,
+    (uint64_t)0xd323b30a72a76d93U, (uint64_t)0xffeec8b50feae451U, (uint64_t)0x4eafc172bd04ef87U,
+    (uint64_t)0x74519be7abded551U, (uint64_t)0x03d358b8c8b74410U, (uint64_t)0x4d00b10b0e10d9a9U,
+    (uint64_t)0x6392b0b128da52b7U, (uint64_t)0x6744a2980b75c904U, (uint64_t)0xc305b0aea8f7f96cU,
+    (uint64_t)0x042e421d182cf932U, (uint64_t)0xf6fc5d509e4636caU, (uint64_t)0xe4435a51b3e59b89U,
+    (uint64_t)0x136139554133a1c9U, (uint64_t)0x87f46973440bee59U, (uint64_t)0x714710f800c401e4U,
+    (uint64_t)0xc0cf4bced6c446c9U, (uint64_t)0xe0aa7fd66c4d5368U, (uint64_t)0xde5d811afc68fc37U,
+    (uint64_t)0x61febd72b7c2a057U, (uint64_t)0x795847c9d64cc78cU, (uint64_t)0x6c50621b9b6cb27bU,
+    (uint64_t)0x07099bf8df8022abU, (uint64_t)0x48f862ebc04eda1dU, (uint64_t)0xd12732ede1603c16U,
+    (uint64_t)0x19a80e0f5c9a9450U, (uint64_t)0xe2257f54b429b4fcU, (uint64_t)0x66d3b2c645460515U,
+    (uint64_t)0x8de2b7bc453cadd6U, (uint64_t)0x203900a7bc0bc1f8U, (uint64_t)0xbcd86e47a6abd3afU,
+    (uint64_t)0x911cac128502effbU, (uint64_t)0x2d550242ec965469U, (uint64_t)0x0e9f769229e0017eU,
+    (uint64_t)0x633f078f65979885U, (uint64_t)0xfb87d4494cf751efU, (uint64_t)0x6066e2a2d551ee10U,
+    (uint64_t)0x87a8f1d8727e09a6U, (uint64_t)0x00d08bab2c01148dU, (uint64_t)0x6da8e4f1424f33feU,
+    (uint64_t)0x466d17f0cf9a4e71U, (uint64_t)0xff5020103bf5cb19U, (uint64_t)0xdccf97d8d062ecc0U,
+    (uint64_t)0x80c0d9af81d80ac4U, (uint64_t)0x1a0445ff1d7aadabU, (uint64_t)0x65d38260d5f6a67cU,
+    (uint64_t)0x6e62fb0891cfb26fU, (uint64_t)0xef1e0fa55c7d91d6U, (uint64_t)0x47e7c7ba33db72cdU,
+    (uint64_t)0x017cbc09fa7c74b2U, (uint64_t)0x3c931590f50a503cU, (uint64_t)0xcac54f60616baa42U,
+    (uint64_t)0x98857ceb1bf4581cU, (uint64_t)0xe635e186aca7b166U, (uint64_t)0x278ddd22659722acU,
+    (uint64_t)0xa0903c4c1db68007U, (uint64_t)0x366e458948f21402U, (uint64_t)0x31b49c14b96abda2U,
+    (uint64_t)0x329c4b09e0403190U, (uint64_t)0x97197ca3d29f43feU, (uint64_t)0x7173dd5d4b07e2b1U,
+    (uint64_t)0xd144c4cb8d9ea221U, (uint64_t)0xe8b04ea41105ab14U, (uint64_t)0x92dda542fe80d8f1U,
+    (uint64_t)0xe9982fa8cf03dce6U, (uint64_t)0x8b5ea9651a22cffcU, (uint64_t)0xf7f4ea7f3fad88c4U,
+    (uint64_t)0x62db773e6a5ba95cU, (uint64_t)0x18bd3fb4820357c7U, (uint64_t)0x992039ae6f1458adU,
+    (uint64_t)0x9a1df3c525b44aa1U, (uint64_t)0x2d780357ed3d5281U, (uint64_t)0x58cf7e4dc77ad4d4U,
+    (uint64_t)0xd49a7998f9df4fc4U, (uint64_t)0x4465a8b51d71205eU, (uint64_t)0xa0ee0ea6649254aaU,
+    (uint64_t)0x4baae6e89c92b235U, (uint64_t)0xa73bbd0e6b3993a1U, (uint64_t)0xd06d60ec693dd031U,
+    (uint64_t)0x03cab91b7156881cU, (uint64_t)0xd615862f1db3574bU, (uint64_t)0x485b018564bb061aU,
+    (uint64_t)0x27434988a0181e06U, (uint64_t)0x2cd61ad4c1c0c757U, (uint64_t)0x03e2de1cf3480d4aU,
+    (uint64_t)0xf0d8edc7bc8acf1aU, (uint64_t)0xf23e330368295a9cU, (uint64_t)0xfadd5f68c546a97dU,
+    (uint64_t)0x895597ad96f8acb1U, (uint64_t)0xbddd49d5671bdae2U, (uint64_t)0x16fcd52821dd43f4U,
+    (uint64_t)0xa5a454126619141aU, (uint64_t)0x8ce9b6bfc360e25aU, (uint64_t)0xe6425195075a1a78U,
+    (uint64_t)0x9dc756a8481732f4U, (uint64_t)0x83c0440f5432b57aU, (uint64_t)0xc670b3f1d720281fU,
+    (uint64_t)0x2205910ed135e051U, (uint64_t)0xded14b0edb052be7U, (uint64_t)0x697b3d27c568ea39U,
+    (uint64_t)0x2e599b9afb3ff9edU, (uint64_t)0x28c2e0ab17f6515cU, (uint64_t)0x1cbee4fd474da449U,
+    (uint64_t)0x071279a44f364452U, (uint64_t)0x97abff6601fbe855U, (uint64_t)0x3ee394e85fda51c4U,
+    (uint64_t)0x190385f667597c0bU, (uint64_t)0x6e9fccc6a27ee34bU, (uint64_t)0x0b89de9314092ebbU,
+    (uint64_t)0xf17256bd428e240cU, (uint64_t)0xcf89a7f393d2f064U, (uint64_t)0x4f57841ee1ed3b14U,
+    (uint64_t)0x4ee14405e708d855U, (uint64_t)0x856aae7203f1c3d0U, (uint64_t)0xc8e5424fbdd7eed5U,
+    (uint64_t)0x3333e4ef73ab4270U, (uint64_t)0x3bc77adedda492f8U, (uint64_t)0xc11a3aea78297205U,
+    (uint64_t)0x5e89a3e734931b4cU, (uint64_t)0x17512e2e9f5694bbU, (uint64_t)0x5dc349f3177bf8b6U,
+    (uint64_t)0x232ea4ba08c7ff3eU, (uint64_t)0x9c4f9d16f511145dU, (uint64_t)0xccf109a333b379c3U,
+    (uint64_t)0xe75e7a88a1f25897U, (uint64_t)0x7ac6961fa1b5d4d8U, (uint64_t)0xe3e1077308f3ed5cU,
+    (uint64_t)0x208a54ec0a892dfbU, (uint64_t)0xbe826e1978660710U, (uint64_t)0x0cf70a97237df2c8U,
+    (uint64_t)0x418a7340ed704da5U, (uint64_t)0xa3eeb9a908ca33fdU, (uint64_t)0x49d96233169bca96U,
+    (uint64_t)0x04d286d42da6aafbU, (uint64_t)0xc09606eca0c2fa94U, (uint64_t)0x8869d0d523ff0fb3U,
+    (uint64_t)0xa99937e5d0150d65U, (uint64_t)0xa92e2503240c14c9U, (uint64_t)0x656bf945108e2d49U,
+    (uint64_t)0x152a733aa2f59e2bU, (uint64_t)0xb4323d588434a920U, (uint64_t)0xc0af8e93622103c5U,
+    (uint64_t)0x667518ef938dbf9aU, (uint64_t)0xa184307383a9cdf2U, (uint64_t)0x350a94aa5447ab80U,
+    (uint64_t)0xe5e5a325c75a3d61U, (uint64_t)0x74ba507f68411a9eU, (uint64_t)0x10581fc1594f70c5U,
+    (uint64_t)0x60e2857080eb24a9U, (uint64_t)0x7bedfb4d488e0cfdU, (uint64_t)0x721ebbd7c259cdb8U,
+    (uint64_t)0x0b0da855bc6390a9U, (uint64_t)0x2b4d04dbde314c70U, (uint64_t)0xcdbf1fbc6c32e846U,
+    (uint64_t)0x33833eabb162fc9eU, (uint64_t)0x9939b48bb0dd3ab7U, (uint64_t)0x96892c1f711b0eb9U,
+    (uint64_t)0xb905f2c8780ab954U, (uint64_t)0xace26309a20792dbU, (uint64_t)0xec8ac9b30684e126U,
+    (uint64_t)0x486ad8b6b40a2447U, (uint64_t)0x60121fc19fe3fb24U, (uint64_t)0x5626fccf1a8e3b3fU,
+    (uint64_t)0x4e5686226ad1f394U, (uint64_t)0x5a4b46c64a8a3d62U, (uint64_t)0x8469c4d0247743d2U,
+    (uint64_t)0x2bb3a13d88f7e433U, (uint64_t)0x62b23a1001be5849U, (uint64_t)0xe83596b4a63d1a4cU,
+    (uint64_t)0x454e7fea7d183f3eU, (uint64_t)0x643fce6117afb01cU, (uint64_t)0x4e65e5e61c4c3638U,
+    (uint64_t)0xe5db77176add8545U, (uint64_t)0x1b71cb6672c49b66U, (uint64_t)0xd856073968421d77U,
+    (uint64_t)0x03840fe883e3afeaU, (uint64_t)0xb391dad51ec69977U, (uint64_t)0xae243fb9307f6726U,
+    (uint64_t)0xc88ac87be8ca160cU, (uint64_t)0x5174cced4ce355f4U, (uint64_t)0xc1e17eb6cbc613e5U,
+    (uint64_t)0x33131d55497ea61cU, (uint64_t)0x2f69d39eaf7eded5U, (uint64_t)0x73c2f434de6af11bU,
+    (uint64_t)0x4ca52493a4a375faU, (uint64_t)0x5f06787cb833c5c2U, (uint64_t)0x814e091f3e6e71cfU,
+    (uint64_t)0x76451f578b746666U, (uint64_t)0x5ee6ab8495fe1347U, (uint64_t)0xab0f6c396f24503cU,
+    (uint64_t)0x807e3ffb4486dd6bU, (uint64_t)0xf00b6c748002fef5U, (uint64_t)0x48bff9a6a7862999U,
+    (uint64_t)0x85e5a06cbed89e26U, (uint64_t)0x86d311af3d8419ebU, (uint64_t)0x24f3ad7834733f16U,
+    (uint64_t)0x5e3e03fc6c68d687U, (uint64_t)0x3e732c3d1ff052c7U, (uint64_t)0xf2d0efa66ed16e7aU,
+    (uint64_t)0x63d92b26b65bb746U, (uint64_t)0xffcd82badd44867cU, (uint64_t)0xa71b4a9ef8c081b8U,
+    (uint64_t)0x6c1676a7736c8785U, (uint64_t)0xbe2c06169d8932d0U, (uint64_t)0x53376d282bcffbc4U,
+    (uint64_t)0x708817a706eadb7aU, (uint64_t)0x6ff50e05cd35ae69U, (uint64_t)0x63b5fb7574bc7fdeU,
+    (uint64_t)0x71c9e953e7fe08c4U, (uint64_t)0xb4d8bfd4f583ca18U, (uint64_t)0xde8d788245e81c5cU,
+    (uint64_t)0xa5f5e93ce0474138U, (uint64_t)0x80f9bdef694db7e0U, (uint64_t)0xedca8787b9fcddc6U,
+    (uint64_t)0x51981c3403b8dce1U, (uint64_t)0x4274dcf170e10ba1U, (uint64_t)0xf72743b86def6d1aU,
+    (uint64_t)0xd25b1670ebdb1866U, (uint64_t)0xc4491e8c050c6f58U, (uint64_t)0x2be2b2ab87fbd7f5U,
+    (uint64_t)0x3e0e5c9dd111f8ecU, (uint64_t)0xbcc33f8db7c4e760U, (uint64_t)0x702f9a91bd392a51U,
+    (uint64_t)0x7da4a795c132e92dU, (uint64_t)0x1a0b0ae30bb1151bU, (uint64_t)0x54febac802e32251U,
+    (uint64_t)0xea3a5082694e9e78U, (uint64_t)0xe58ffec1e4fe40b8U, (uint64_t)0xfbb8349d29c4120bU,
+    (uint64_t)0x9f94391fc0d0d915U, (uint64_t)0xc4074fa75410ba51U, (uint64_t)0xa66adbf6150a5911U,
+    (uint64_t)0xc164543c34bfca38U, (uint64_t)0xe0f27560b9e1ccfcU, (uint64_t)0x99da0f53e820219cU,
+    (uint64_t)0xe8234498c6b4997aU, (uint64_t)0x7b23c513516e19e4U, (uint64_t)0x56e2e847c5c4d593U,
+    (uint64_t)0x9f727d735ce71ef6U, (uint64_t)0x5b6304a6f79a44c5U, (uint64_t)0x6638a7363ab7e433U,
+    (uint64_t)0x1adea470fe742f83U, (uint64_t)0xe054b8545b7fc19fU, (uint64_t)0xf935381aba1d0698U,
+    (uint64_t)0xb5504f9d918e4936U, (uint64_t)0x65035ef6b2513982U, (uint64_t)0x0553a0c26f4d9cb9U,
+    (uint64_t)0x6cb10d56bea85509U, (uint64_t)0x48d957b7a242da11U, (uint64_t)0x16a4d3dd672b7268U,
+    (uint64_t)0x3d7e637c8502a96bU, (uint64_t)0x27c7032b730d463bU, (uint64_t)0x55366b7d5846426fU,
+    (uint64_t)0xe7d09e89247d441dU, (uint64_t)0x510b404d736fbf48U, (uint64_t)0x7fa003d0e784bd7dU,
+    (uint64_t)0x25f7614f17fd9596U, (uint64_t)0x49e0e0a135cb98dbU, (uint64_t)0x2c65957b2e83a76aU,
+    (uint64_t)0x5d40da8dcddbe0f8U, (uint64_t)0x37f68bb4a595939dU, (uint64_t)0x0355647928740217U,
+    (uint64_t)0x8e740e7c84ad7612U, (uint64_t)0xd89bc8439044695fU, (uint64_t)0xf7f3da5d85a9184dU,
+    (uint64_t)0x562563bb9fc0b074U, (uint64_t)0x06d2e6aaf88a888eU, (uint64_t)0x612d8643161fbe7cU,
+    (uint64_t)0x9fb3bba354530bb2U, (uint64_t)0xbde3ef77cb0869eaU, (uint64_t)0x89bc90460b431163U,
+    (uint64_t)0x4d03d7d2e4819a35U, (uint64_t)0x33ae4f9e43b6a782U, (uint64_t)0x216db3079c88a686U,
+    (uint64_t)0x91dd88e000ffedd9U, (uint64_t)0xb280da9f12bd4840U, (uint64_t)0x458f86913e538cd7U,
+    (uint64_t)0xa7001f6c8e08ad53U, (uint64_t)0x52b8c6e6bf5d15ffU, (uint64_t)0x548234a4011215ddU,
+    (uint64_t)0xff5a9d2d3d5b4045U, (uint64_t)0xb0ffeeb64a904190U, (uint64_t)0x55a3aca448607f8bU,
+    (uint64_t)0x8cbd665c30a0672aU, (uint64_t)0xc7f3a8f833f6746cU, (uint64_t)0x21e46f65fea990caU,
+    (uint64_t)0x915fd5c5caddb0a9U, (uint64_t)0xbd41f01678614555U, (uint64_t)0x346f4434426ffb58U,
+    (uint64_t)0x8055943614dbc204U, (uint64_t)0xf3dd20fe5a969b7fU, (uint64_t)0x9d59e956e899a39aU,
+    (uint64_t)0x3c2f0ba9b733aa5fU, (uint64_t)0xdece47cbf05af235U, (uint64_t)0xf8e3f715a2ac82a5U,
+    (uint64_t)0xc97ba6412203f18aU, (uint64_t)0xc3af550409c11060U, (uint64_t)0x56ea2c0546af512dU,
+    (uint64_t)0xfac28daff3f28146U, (uint64_t)0x87fab43a959ef494U, (uint64_t)0xef4f115c775d6eceU,
+    (uint64_t)0x69d2e3bbe8c0e78dU, (uint64_t)0xb0264ef1145cfc81U, (uint64_t)0x0a41e9fa1b69788bU,
+    (uint64_t)0x0d9233be909a1f0bU, (uint64_t)0x150a84520ae76b30U, (uint64_t)0xea3375370632bb69U,
+    (uint64_t)0x15f7b3cfaa25584aU, (uint64_t)0x09891641d4c5105fU, (uint64_t)0x1ae80f8e6d7fbd65U,
+    (uint64_t)0x9d67225fbee6bdb0U, (uint64_t)0x3b433b597fc4d860U, (uint64_t)0x44e66db693e85638U,
+    (uint64_t)0xf7b59252e3e9862fU, (uint64_t)0xdb785157665c32ecU, (uint64_t)0x702fefd7ae362f50U,
+    (uint64_t)0x6eb4a9141339609aU, (uint64_t)0x2b627dee3e37eabdU, (uint64_t)0xea4083d1728c8d9cU,
+    (uint64_t)0xe70814d4518f21e4U, (uint64_t)0x4cb05b5717398d14U, (uint64_t)0x9d37d2558003f6c9U,
+    (uint64_t)0x70577af760829275U, (uint64_t)0xcb4a9a9ac67d7e4fU, (uint64_t)0xfe756a5c97290293U,
+    (uint64_t)0xbf04a19cd388acbfU, (uint64_t)0xfbbbb9cf5e916bdaU, (uint64_t)0xf489527391f93becU,
+    (uint64_t)0xdee07ec32a5923d7U, (uint64_t)0xc7bc949bfde0c370U, (uint64_t)0xbd5121750419d8fcU,
+    (uint64_t)0x54f5d4763fdcc93fU, (uint64_t)0xc20f05f7d13fb27dU, (uint64_t)0xc05b30d36c7195c0U,
+    (uint64_t)0xa335cf1832fc56c5U, (uint64_t)0xae65bcd362b3a82bU, (uint64_t)0xcbf6aab8630d99eaU,
+    (uint64_t)0x164be816e62cec6cU, (uint64_t)0x6d41819d2feed2f1U, (uint64_t)0xfcdc59070b91bd0dU,
+    (uint64_t)0x3754475d0fefb0c3U, (uint64_t)0xd48fb56b46d7c35dU, (uint64_t)0xa070b633363798a4U,
+    (uint64_t)0xae89f3d28fdb98e6U, (uint64_t)0x970b89c86363d14cU, (uint64_t)0x8981752167abd27dU,
+    (uint64_t)0x9bf7d47444d5a021U, (uint64_t)0xb3083bafcac72aeeU, (uint64_t)0x62a8c244bfe20925U,
+    (uint64_t)0x91c19ac38fdce867U, (uint64_t)0x5a96a5d5dd387063U, (uint64_t)0x61d587d421d324f6U,
+    (uint64_t)0xe87673a2a37173eaU, (uint64_t)0x2384800853778b65U, (uint64_t)0x10f8441e05bab43eU,
+    (uint64_t)0xfa11fe124621efbeU, (uint64_t)0x23f949feb8a24a20U, (uint64_t)0x17ebfed1f52ca53fU,
+    (uint64_t)0x9b691bbebcfb4853U, (uint64_t)0x5617ff6b6278a05dU, (uint64_t)0x241b34c5e3c99ebdU,
+    (uint64_t)0xfc64242e1784156aU, (uint64_t)0x4206482f695d67dfU, (uint64_t)0xb967ce0eee27c011U,
+    (uint64_t)0xc0f734a3b2335834U, (uint64_t)0x9526205a90ef6860U, (uint64_t)0xcb8be71704e2bb0dU,
+    (uint64_t)0x2418871e02f383faU, (uint64_t)0xd71776814082c157U, (uint64_t)0xcc914ad029c20073U,
+    (uint64_t)0xf186c1ebe587e728U, (uint64_t)0x6fdb3c2261bcd5fdU, (uint64_t)0xb4480f0441c23fa3U,
+    (uint64_t)0xb4712eb0c1989a2eU, (uint64_t)0x3ccbba0f93a29ca7U, (uint64_t)0x6e205c14d619428cU,
+    (uint64_t)0x90db7957b3641686U, (uint64_t)0x0432691d45ac8b4eU, (uint64_t)0x07a759acf64e0350U,
+    (uint64_t)0x0514d89c9c972517U, (uint64_t)0xcc7c4c1c2cf9d7c1U, (uint64_t)0x1320886aee95e5abU,
+    (uint64_t)0xbb7b9056beae170cU, (uint64_t)0xc8a5b250dbc0d662U, (uint64_t)0x4ed81432c11d2303U,
+    (uint64_t)0x7da669121f03769fU, (uint64_t)0x3ac7a5fd84539828U, (uint64_t)0x14dada943bccdd02U,
+    (uint64_t)0x7bb4f7aaf0dcbc49U, (uint64_t)0x7de551f970bbb45bU, (uint64_t)0xcfd0f3e49f2ca2e5U,
+    (uint64_t)0xece587091f5c76efU, (uint64_t)0x32920edd167d79aeU, (uint64_t)0x039df8a2fa7d7ec1U,
+    (uint64_t)0xf46206c0bb30af91U, (uint64_t)0x1ff5e2f522676b59U, (uint64_t)0x51b90651cbae2f70U,
+    (uint64_t)0xefc4bc0593aaa8ebU, (uint64_t)0x8ecd8689dd1df499U, (uint64_t)0x1aee99a822f367a5U,
+    (uint64_t)0x95d485b9ae8274c5U, (uint64_t)0x6c14d4457d30b39cU, (uint64_t)0xbafea90bbcc1ef81U,
+    (uint64_t)0x7c5f317aa459a2edU, (uint64_t)0xe3b22c6bc4fe3c39U, (uint64_t)0xba4a81536c7bebdfU,
+    (uint64_t)0xf23ab6b725693459U, (uint64_t)0x53bc377014922b11U, (uint64_t)0x4645c8ab5afc60dbU,
+    (uint64_t)0xaa02235520b9f2a3U, (uint64_t)0x52a2954cce0fc507U, (uint64_t)0x8c2731bb7ce1c2e7U,
+    (uint64_t)0x6a7091c2e48fb889U, (uint64_t)0x26882c137b8a9d06U, (uint64_t)0xa24986631b82a0e2U,
+    (uint64_t)0x844ed7363518152dU, (uint64_t)0x282f476fd86e27c7U, (uint64_t)0xa04edaca04afefdcU,
+    (uint64_t)0x8b256ebc6119e34dU, (uint64_t)0x56a413e90787d78bU, (uint64_t)0x82ee061d5a74be50U,
+    (uint64_t)0xe41781c4dea16ff5U, (uint64_t)0xe0b0c81e99bfc8a2U, (uint64_t)0x624f4d690b547e2dU,
+    (uint64_t)0x3a83545dbdcc9ae4U, (uint64_t)0x2573dbb6409b1e8eU, (uint64_t)0x482960c4a6c93539U,
+    (uint64_t)0xf01059ad5ae18798U, (uint64_t)0x38151e274d559d96U, (uint64_t)0x4f18c0d3b8db6c01U,
+    (uint64_t)0x49a3aa836f9921afU, (uint64_t)0xdbeab27b8c046029U, (uint64_t)0x242b9eaa7040bf3bU,
+    (uint64_t)0x39c479e51614b091U, (uint64_t)0x338ede2b0e4baf5dU, (uint64_t)0x5bb192b7f0a53945U,
+    (uint64_t)0x715c9f973112795fU, (uint64_t)0xe8244437984e6ee1U, (uint64_t)0x55cb4858ecb66bcdU,
+    (uint64_t)0x7c136735abaffbeeU, (uint64_t)0x546615955dbec38eU, (uint64_t)0x51c0782c388ad153U,
+    (uint64_t)0x9ba4c53ac6e0952fU, (uint64_t)0x27e6782a1b21dfa8U, (uint64_t)0x7d89c251ec5d7f65U,
+    (uint64_t)0x0c8f561690394087U, (uint64_t)0x609e1cfcf0691ab3U, (uint64_t)0x2a0300bfe9b20b21U,
+    (uint64_t)0xbf532fadb114faf4U, (uint64_t)0x328fc0b9521bf5d1U, (uint64_t)0xbd51f93c3bfc36deU,
+    (uint64_t)0xd989050e7a4e5f60U, (uint64_t)0x682f903d4ed2dbc2U, (uint64_t)0x0eba59c87c3b2d83U,
+    (uint64_t)0x8e9dc84d9c7e9335U, (uint64_t)0x5f9b21b00eb226d7U, (uint64_t)0xe33bd394af267baeU,
+    (uint64_t)0xaa86cc25be2e15aeU, (uint64_t)0x4f0bf67d6a8ec500U, (uint64_t)0x5846aa44f9630658U,
+    (uint64_t)0x6786ba38e7e0c278U, (uint64_t)0x09bf87ce588b2e6fU, (uint64_t)0x723b7022465fee3aU,
+    (uint64_t)0x08b8411464682394U, (uint64_t)0x0eb52ce029e64629U, (uint64_t)0xadb60e8fcca78e43U,
+    (uint64_t)0x20dd7062b654a991U, (uint64_t)0x4281d428c69a6fe5U, (uint64_t)0xfeb09740e2c2bf15U,
+    (uint64_t)0x627a2205a9e99704U, (uint64_t)0xec8d73d0c2fbc565U, (uint64_t)0x223eed8fc20c8de8U,
+    (uint64_t)0x1ee32583a8363b49U, (uint64_t)0x1a0b6cb9c9c2b0a6U, (uint64_t)0x49f7c3d290dbc85cU,
+    (uint64_t)0xa8dfbb971ef4c1acU, (uint64_t)0xc16c236e846e364fU, (uint64_t)0x7f33527cdea50ca0U,
+    (uint64_t)0xc48107750926b86dU, (uint64_t)0x6c2a36090598e70cU, (uint64_t)0xa6755e52f024e924U,
+    (uint64_t)0xe0fa07a49db4afcaU, (uint64_t)0x15c3ce7d66831790U, (uint64_t)0x5b4ef350a6cbb0d6U,
+    (uint64_t)0x05214c050f15dde9U, (uint64_t)0xa47a76a80d5f2b82U, (uint64_t)0xbb254d3062e82b62U,
+    (uint64_t)0x11a05fe03ec955eeU, (uint64_t)0x7eaff46e9d529b36U, (uint64_t)0x55ab13018f9e3df6U,
+    (uint64_t)0xc463e37199317698U, (uint64_t)0xfd251438ccda47adU, (uint64_t)0xe2a37598a9d82abfU,
+    (uint64_t)0x5f188ccbe6c170f5U, (uint64_t)0x816822005066b087U, (uint64_t)0xda22c212c7155adaU,
+    (uint64_t)0x151e5d3afbddb479U, (uint64_t)0x4b606b846d715b99U, (uint64_t)0x4a73b54bf997cb2eU,
+    (uint64_t)0x9a1bfe433ecd8b66U, (uint64_t)0xe13122f3dbfb894eU, (uint64_t)0xbe9b79f6ce274b18U,
+    (uint64_t)0x85a49de5ca58aadfU, (uint64_t)0x2495775811487351U, (uint64_t)0x111def61bb939099U,
+    (uint64_t)0x1d6a974a26d13694U, (uint64_t)0x4474b4ced3fc253bU, (uint64_t)0x3a1485e64c5db15eU,
+    (uint64_t)0x5afddab61430c9abU, (uint64_t)0x0bdd41d32238e997U, (uint64_t)0xf0947430418042aeU,
+    (uint64_t)0x71f9addacdddc4cbU, (uint64_t)0x7090c016c52dd907U, (uint64_t)0xd9bdf44d29e2047fU,
+    (uint64_t)0xe6f1fe801b1011a6U, (uint64_t)0xb63accbcd9acdc78U, (uint64_t)0x7817acab4baef62eU,
+    (uint64_t)0x9f5a2202a85b91e8U, (uint64_t)0x9666ebe66ce57610U, (uint64_t)0x32ad31f3f73bfe03U,
+    (uint64_t)0x628330a425bcf4d6U, (uint64_t)0xea950593515056e6U, (uint64_t)0x59811c89e1332156U,
+    (uint64_t)0xc89cf1fe8c11b2d7U, (uint64_t)0x0ad7337ac0b7eff3U, (uint64_t)0x8552225ec5e48b3cU,
+    (uint64_t)0xe6f78b0c73f13a5fU, (uint64_t)0x5e70062e82349cbeU, (uint64_t)0x6b8d5048e7073969U,
+    (uint64_t)0x392d2a29c33cb3d2U, (uint64_t)0xee4f727c4ecaa20fU, (uint64_t)0xa068c99e2ccde707U,
+    (uint64_t)0xebde86ec1ed66f18U, (uint64_t)0x225d906bd61fce43U, (uint64_t)0x5cab07d6e8bed74dU,
+    (uint64_t)0x16e4617f27855ab7U, (uint64_t)0x6568aaddb2fbc3ddU, (uint64_t)0xedb5484f8aeddf5bU,
+    (uint64_t)0x878f20e86dcf2fadU, (uint64_t)0x3516497c615f5699U, (uint64_t)0xef0a3fecfa181e69U,
+    (uint64_t)0x9ea02f8130d69a98U, (uint64_t)0xb2e9cf8e66eab95dU, (uint64_t)0x520f2beb24720021U,
+    (uint64_t)0x621c540a1df84361U, (uint64_t)0x1203772171fa6d5dU, (uint64_t)0x6e3c7b510ff5f6ffU,
+    (uint64_t)0x817a069babb2bef3U, (uint64_t)0x83572fb6b294cda6U, (uint64_t)0x6ce9bf75b9039f34U,
+    (uint64_t)0x20e012f0095cbb21U, (uint64_t)0xa0aecc1bd063f0daU, (uint64_t)0x57c21c3af02909e5U,
+    (uint64_t)0xc7d59ecf48ce9cdcU, (uint64_t)0x2732b8448ae336f8U, (uint64_t)0x056e37233f4f85f4U,
+    (uint64_t)0x8a10b53189e800caU, (uint64_t)0x50fe0c17145208fdU, (uint64_t)0x9e43c0d3b714ba37U,
+    (uint64_t)0x427d200e34189accU, (uint64_t)0x05dee24fe616e2c0U, (uint64_t)0x9c25f4c8ee1854c1U,
+    (uint64_t)0x4d3222a58f342a73U, (uint64_t)0x0807804fa027c952U, (uint64_t)0xc222653a4f0d56f3U,
+    (uint64_t)0x961e4047ca28b805U, (uint64_t)0x2c03f8b04a73434bU, (uint64_t)0x4c966787ab712a19U,
+    (uint64_t)0xcc196c42864fee42U, (uint64_t)0xc1be93da5b0ece5cU, (uint64_t)0xa87d9f22c131c159U,
+    (uint64_t)0x2bb6d593dce45655U, (uint64_t)0x22c49ec9b809b7ceU, (uint64_t)0x8a41486be2c72c2cU,
+    (uint64_t)0x813b9420fea0bf36U, (uint64_t)0xb3d36ee9a66dac69U, (uint64_t)0x6fddc08a328cc987U,
+    (uint64_t)0x0a3bcd2c3a326461U, (uint64_t)0x7103c49dd810dbbaU, (uint64_t)0xf9d81a284b78a4c4U,
+    (uint64_t)0x3de865ade4d55941U, (uint64_t)0xdedafa5e30384087U, (uint64_t)0x6f414abb4ef18b9bU,
+    (uint64_t)0x9ee9ea42faee5268U, (uint64_t)0x260faa1637a55a4aU, (uint64_t)0xeb19a514015f93b9U,
+    (uint64_t)0x51d7ebd29e9c3598U, (uint64_t)0x523fc56d1932178eU, (uint64_t)0x501d070cb98fe684U,
+    (uint64_t)0xd60fbe9a124a1458U, (uint64_t)0xa45761c892bc6b3fU, (uint64_t)0xf5384858fe6f27cbU,
+    (uint64_t)0x4b0271f7b59e763bU, (uint64_t)0x3d4606a95b5a8e5eU, (uint64_t)0x1eda5d9b05a48292U,
+    (uint64_t)0xda7731d0e6fec446U, (uint64_t)0xa3e3369390d45871U, (uint64_t)0xe976404006166d8dU,
+    (uint64_t)0xb5c3368289a90403U, (uint64_t)0x4bd1798372f1d637U, (uint64_t)0xa616679ed5d2c53aU,
+    (uint64_t)0x5ec4bcd8fdcf3b87U, (uint64_t)0xae6d7613b66a694eU, (uint64_t)0x7460fc76e3fc27e5U,
+    (uint64_t)0x80531fe1c63c4962U, (uint64_t)0x50541e89981fdb25U, (uint64_t)0xdc1291a1fd4c2b6bU,
+    (uint64_t)0xc0693a17a6df4fcaU, (uint64_t)0xb2c4604e0117f203U, (uint64_t)0x245f19630a99b8d0U,
+    (uint64_t)0xaedc20aac6212c44U, (uint64_t)0xb1ed4e56520f52a8U, (uint64_t)0xb5560fb6700a1acdU,
+    (uint64_t)0xe823fd73fd999681U, (uint64_t)0xda915d1f6cb4e1baU, (uint64_t)0x0d0301186ebe00a3U,
+    (uint64_t)0x744fb0c989fca8cdU, (uint64_t)0x970d01dbf9da0e0bU, (uint64_t)0x0ad8c5647931d76fU,
+    (uint64_t)0xb15737bff659b96aU, (uint64_t)0x18f37a9c6bdf22daU, (uint64_t)0xefbc432f90dc82dfU,
+    (uint64_t)0xc52cef8e5d703651U, (uint64_t)0x82887ba0d99881a5U, (uint64_t)0x7cec9ddab920ec1dU,
+    (uint64_t)0xd0d7e8c3ec3e8d3bU, (uint64_t)0x445bc3954ca88747U, (uint64_t)0xedeaa2e09fd53535U,
+    (uint64_t)0xa12b384ece53c2d0U, (uint64_t)0x779d897d5e4606daU, (uint64_t)0xa53e47b073ec12b0U,
+    (uint64_t)0x462dbbba5756f1adU, (uint64_t)0x69fe09f2cafe37b6U, (uint64_t)0x273d1ebfecce2e17U,
+    (uint64_t)0x8ac1d5383cf607fdU, (uint64_t)0x8035f7ff12e10c25U, (uint64_t)0xb7d4cc0f296c9005U,
+    (uint64_t)0x4b9094fa7b0aebdbU, (uint64_t)0xe1bf10f1c00ec8d4U, (uint64_t)0xd807b1c4d667c101U,
+    (uint64_t)0xa9412cdfbe713383U, (uint64_t)0x435e063e81142ba1U, (uint64_t)0x984c15ecaf0a6bdcU,
+    (uint64_t)0x592c246092a3dab9U, (uint64_t)0xca442d5a2093c22aU, (uint64_t)0xebd0bd31d5703aedU,
+    (uint64_t)0x308f2afd653287b6U, (uint64_t)0x9bb88bac0d1bc8baU, (uint64_t)0xfbaf853875c1e3b2U,
+    (uint64_t)0xbd2ac950ca11447cU, (uint64_t)0x286d816cea5c4c8dU, (uint64_t)0xdc3aa80028dc3208U,
+    (uint64_t)0x9365690016e23e9dU, (uint64_t)0xcb220c6ba7cc41e1U, (uint64_t)0xb36b20c369d6245cU,
+    (uint64_t)0x2d63c348b62e9a6aU, (uint64_t)0xa3473e19cdc0bcb5U, (uint64_t)0x70f18b3f8f601b98U,
+    (uint64_t)0x8ad7a2c7cde346e4U, (uint64_t)0xae9f6ec3bd3aaa64U, (uint64_t)0x854d34c77e6c5520U,
+    (uint64_t)0xc27df9efdcb9ea58U, (uint64_t)0x405f2369d686666dU, (uint64_t)0x29d1febf0417aa85U,
+    (uint64_t)0x9846819e93470afeU, (uint64_t)0x3e6a9669e2a27f9eU, (uint64_t)0x24d008a2e31e6504U,
+    (uint64_t)0xdba7cecf9cb7680aU, (uint64_t)0xecaff541338d6e43U, (uint64_t)0x56f7dd734541d5ccU,
+    (uint64_t)0xb5d426de96bc88caU, (uint64_t)0x48d94f6b9ed3a2c3U, (uint64_t)0x6354a3bb2ef8279cU,
+    (uint64_t)0xd575465b0b1867f2U, (uint64_t)0xef99b0ff95225151U, (uint64_t)0xf3e19d88f94500d8U,
+    (uint64_t)0x0d0df6ce51efb310U, (uint64_t)0xcb5b2eb4958df5beU, (uint64_t)0xd6459e2936158e59U,
+    (uint64_t)0x82aae2b91466e336U, (uint64_t)0xfb658a39411aa636U, (uint64_t)0x7152ecc5d4c0a933U,
+    (uint64_t)0xf10c758a49f026b7U, (uint64_t)0xf4837f97cb09311fU, (uint64_t)0x7807f364b71698f5U,
+    (uint64_t)0x6ba418d29f7b605eU, (uint64_t)0xfd20b00fa03b2cbbU, (uint64_t)0x883eca37da54386fU,
+    (uint64_t)0xff0be43ff3437f24U, (uint64_t)0xe910b432a48bb33cU, (uint64_t)0x4963a128329df765U,
+    (uint64_t)0xac1dd556be2fe6f7U, (uint64_t)0x994f523a626332d5U, (uint64_t)0x7bc388335561bb44U,
+    (uint64_t)0x005ed4b03d845ea2U, (uint64_t)0xd39d3ee1c2a1f08aU, (uint64_t)0x6561fdd3e7676b0dU,
+    (uint64_t)0x620e35fffb706017U, (uint64_t)0x36ce424ff264f9a8U, (uint64_t)0xc4c3419fda2681f7U,
+    (uint64_t)0x1c30861cf405ff06U, (uint64_t)0xebac86bd486e828bU, (uint64_t)0xe791a971636933fcU,
+    (uint64_t)0x50e7c2be7aeee947U, (uint64_t)0xc3d4a095fa90d767U, (uint64_t)0xae60eb7be670ab7bU,
+    (uint64_t)0x17633a64397b056dU, (uint64_t)0x93a21f33105012aaU, (uint64_t)0x857c1f22369b87adU,
+    (uint64_t)0x3c00e5d932fca556U, (uint64_t)0x1ad74cab90b06466U, (uint64_t)0xa7112386550faaf2U,
+    (uint64_t)0x7435e1986d9bd5f5U, (uint64_t)0x2dcc7e3859c3463fU, (uint64_t)0xdc7df748ca7bd4b2U,
+    (uint64_t)0x13cd4c089dec2f31U, (uint64_t)0x5936e46022caf46bU, (uint64_t)0x6a45dd8f9a96fe4fU,
+    (uint64_t)0xf7925434b98f474eU, (uint64_t)0x414104120053ef15U, (uint64_t)0x71cf8d1241de97bfU,
+    (uint64_t)0xb8547b61bd80bef4U, (uint64_t)0xb47d3970c4db0037U, (uint64_t)0xf1bcd328fef20dffU,
+    (uint64_t)0x00f831769bb81648U, (uint64_t)0xd69eb485653120d0U, (uint64_t)0xd17d75f44ccabc62U,
+    (uint64_t)0x34a07f82b749fcb1U, (uint64_t)0x2c3af787bbfb5554U, (uint64_t)0xb06ed4d062e283f8U,
+    (uint64_t)0x5722889fa19213a0U, (uint64_t)0x162b085edcf3c7b4U, (uint64_t)0x32670d2f7189e71fU,
+    (uint64_t)0xc64387485ecf91e7U, (uint64_t)0x15758e57db757a21U, (uint64_t)0x427d09f8290a9ce5U,
+    (uint64_t)0x846a308f38384a7aU, (uint64_t)0xaac3acb4b0732b99U, (uint64_t)0x9e94100917845819U,
+    (uint64_t)0x95cba111a7ce5e03U, (uint64_t)0x97b7851aaaca5e9bU, (uint64_t)0x518aa52156713b97U,
+    (uint64_t)0x3357e8c7150a61f6U, (uint64_t)0x7842e7e2ec2c2b69U, (uint64_t)0x8dffaf656868a548U,
+    (uint64_t)0xd963bd82e068fc81U, (uint64_t)0x64da5c8b65917733U, (uint64_t)0x927090ff7b247328U,
+    (uint64_t)0x37a01e48a105fc8eU, (uint64_t)0x769d754a289ba48cU, (uint64_t)0xc08c6fe1d51c2180U,
+    (uint64_t)0xb032dd33b7bd1387U, (uint64_t)0x953826db020b0aa6U, (uint64_t)0x05137e800664c73cU,
+    (uint64_t)0xc66302c4660cf95dU, (uint64_t)0x99004e11b2cef28aU, (uint64_t)0x214bc9a7d298c241U,
+    (uint64_t)0xe3b697ba56807cfdU, (uint64_t)0xef1c78024564eadbU, (uint64_t)0xdde8cdcfb48149c5U,
+    (uint64_t)0x946bf0a75a4d2604U, (uint64_t)0x27154d7f6c1538afU, (uint64_t)0x95cc9230de5b1fccU,
+    (uint64_t)0xd88519e966864f82U, (uint64_t)0x1013e4f796ea6ca1U, (uint64_t)0x567cdc2a1f792871U,
+    (uint64_t)0xadb728705c658d45U, (uint64_t)0xf7c1ff4ace600e98U, (uint64_t)0xa1ba86574b6cad39U,
+    (uint64_t)0x3d58d634ba20b428U, (uint64_t)0xc0011cdea2e6fdfbU, (uint64_t)0xa832367a7b18960dU,
+    (uint64_t)0x47618c9f0e4938f7U, (uint64_t)0x58d47d69dc83719eU, (uint64_t)0xd74c1a23f41a64ccU,
+    (uint64_t)0x5d28e068b5829f66U, (uint64_t)0xd8d37529210466f6U, (uint64_t)0x2af1152fc6a64ef8U,
+    (uint64_t)0x55d4485c19ce6a7aU, (uint64_t)0x6d0bd2f5f648e2d7U, (uint64_t)0x1ecc032af416448dU,
+    (uint64_t)0x4a7e8c10ec76d971U, (uint64_t)0x854f9805b90b6eaeU, (uint64_t)0xfd0b15324bed0594U,
+    (uint64_t)0x89f71848d98b5ca3U, (uint64_t)0xd01fe5fcf039b3efU, (uint64_t)0x4481332e627bda2eU,
+    (uint64_t)0xe67cecd7a5073e41U, (uint64_t)0xb828dd1a7cb1282cU, (uint64_t)0xa08d7626be46973aU,
+    (uint64_t)0x6baf8d40e708d6b2U, (uint64_t)0x72571fa14daeb3f3U, (uint64_t)0x85b1732ff22dfd98U,
+    (uint64_t)0x87ab01a70087108dU, (uint64_t)0xaaaafea85988207aU, (uint64_t)0xccc832f869f00755U,
+    (uint64_t)0x488f1185ca8d9d1aU, (uint64_t)0xadf2c77dd987ded2U, (uint64_t)0x5f3039f060c46124U,
+    (uint64_t)0xe5d70b7571e095f4U, (uint64_t)0x82d586506260e70fU, (uint64_t)0x39d75ea7f750d105U,
+    (uint64_t)0x8cf3d0b175bac364U, (uint64_t)0xf3a7564d21d01329U, (uint64_t)0xb24aa43e3fcd3efcU,
+    (uint64_t)0xdd26c034b8088e9aU, (uint64_t)0xa5ef4dc9bd3d46eaU, (uint64_t)0xa2f99d588a4c6a6fU,
+    (uint64_t)0xddabd3552f1da46cU, (uint64_t)0x72c3f8ce1afacdd1U, (uint64_t)0xd90c4eee92d40578U,
+    (uint64_t)0xd28bb41fca623b94U, (uint64_t)0x242792d2e7417ce1U, (uint64_t)0xff42bc71970ee7f5U,
+    (uint64_t)0x1ff4dc6d5c67a41eU, (uint64_t)0x77709b7b20882a58U, (uint64_t)0x3554731dbe217f2cU,
+    (uint64_t)0x2af2a8cd5bb72177U, (uint64_t)0x58eee769591dd059U, (uint64_t)0xbb2930c94bba6477U,
+    (uint64_t)0x1e6adddaf176f2c0U, (uint64_t)0x01ca4604e2572658U, (uint64_t)0x0a404ded85342ffbU,
+    (uint64_t)0x8cf60f96441838d6U, (uint64_t)0x9bbc691cc9071c4aU, (uint64_t)0xfd58874434442803U,
+    (uint64_t)0x97101c85809c0d81U, (uint64_t)0xa7fb754c8c456f7fU, (uint64_t)0x6af7a1d5af71013fU,
+    (uint64_t)0xe68216e50bedc946U, (uint64_t)0xf4cba30bd27370a0U, (uint64_t)0x7981afbf870421ccU,
+    (uint64_t)0x02496a679449f0e1U, (uint64_t)0x86cfc4be0a47edaeU, (uint64_t)0x3073c936b1feca22U,
+    (uint64_t)0xf569461203f8f8fbU, (uint64_t)0xbcadd6715bde48f8U, (uint64_t)0xc97038732189bc7dU,
+    (uint64_t)0x5d45299ec709ee8aU, (uint64_t)0xd1287ee2845aaff8U, (uint64_t)0x7d1f8874db1dbf1fU,
+    (uint64_t)0xea46588b990c88d6U, (uint64_t)0x60ba649a84368313U, (uint64_t)0xd5fdcbce60d543aeU,
+    (uint64_t)0xcf3de9959890272dU, (uint64_t)0x75f3432a3e713a10U, (uint64_t)0x5e13479fe28227b8U,
+    (uint64_t)0xb8561ea9fefacdc8U, (uint64_t)0xa6a297a08332aafdU, (uint64_t)0x9b0d8bb573809b62U,
+    (uint64_t)0xd2fa1cfd0c63036fU, (uint64_t)0x7a16eb55bd64bda8U, (uint64_t)0xf7e48e8a2ac13e27U,
+    (uint64_t)0x4494f6df4eb1a9f5U, (uint64_t)0xedbf84eb981f0a62U, (uint64_t)0x49badc32536438f0U,
+    (uint64_t)0x50bea541004f7571U, (uint64_t)0xbac67d10df1c94eeU, (uint64_t)0x253d73a1b727bc31U,
+    (uint64_t)0xb3d01cf230686e28U, (uint64_t)0xd433e50f6d3549cfU, (uint64_t)0x6f33696ffacd665eU,
+    (uint64_t)0x695bfdacce11fcb4U, (uint64_t)0x810ee252af7c9860U, (uint64_t)0x65450fe17159bb2cU,
+    (uint64_t)0xf7dfbebe758b357bU, (uint64_t)0x2b057e74d69fea72U, (uint64_t)0xd485717a92731745U,
+    (uint64_t)0x896c42e8ee36860cU, (uint64_t)0xdaf04dfd4113c22dU, (uint64_t)0x1adbb7b744104213U,
+    (uint64_t)0xe5fd5fa11fd394eaU, (uint64_t)0x68235d941a4e0551U, (uint64_t)0x6772cfbe18d10151U,
+    (uint64_t)0x276071e309984523U, (uint64_t)0xe4e879de5a56ba98U, (uint64_t)0x6c8d0aa9b898fd52U,
+    (uint64_t)0x2fb38a57be9af1a7U, (uint64_t)0xe1f2b9a93b4f03f8U, (uint64_t)0x2b1aad44c3f0cc6fU,
+    (uint64_t)0x58b5332e7cf2c084U, (uint64_t)0x1c57d96f0367d26dU, (uint64_t)0x2297eabdfa6e4a8dU,
+    (uint64_t)0x65a947ee4a0e2b6aU, (uint64_t)0xaaafafb0285b9491U, (uint64_t)0x01a0be881e4c705eU,
+    (uint64_t)0xff1d4f5d2ad9caabU, (uint64_t)0x6e349a4ac37a233fU, (uint64_t)0xcf1c12464a1c6a16U,
+    (uint64_t)0xd99e6b6629383260U, (uint64_t)0xea3d43665f6d5471U, (uint64_t)0x36974d04ff8cc89bU,
+    (uint64_t)0xf535b616fdd5b854U, (uint64_t)0x592549c85728719fU, (uint64_t)0xe231468606921cadU,
+    (uint64_t)0x98c8ce34311b1ef8U, (uint64_t)0x28b937e7e9090b36U, (uint64_t)0x67fc3ab90bf7bbb7U,
+    (uint64_t)0x12337097a9d87974U, (uint64_t)0x3e5adca1f970e3feU, (uint64_t)0xc26c49a1cfe89d80U,
+    (uint64_t)0xb42c026dda9c8371U, (uint64_t)0xca6c013adad066d2U, (uint64_t)0xfb8f722856a4f3eeU,
+    (uint64_t)0x08b579ecd850935bU, (uint64_t)0x34c1a74cd631e1b3U, (uint64_t)0xcb5fe596ac198534U,
+    (uint64_t)0x39ff21f6e1f24f25U, (uint64_t)0xcdcc68a7b3f85ff0U, (uint64_t)0xacd21cdd1a888044U,
+    (uint64_t)0xb6719b2e05dbe894U, (uint64_t)0xfae1d3d88b8260d4U, (uint64_t)0xedfedece8a1c5d92U,
+    (uint64_t)0xbca01a94dc52077eU, (uint64_t)0xc085549c16dd13edU, (uint64_t)0xdc5c3bae495ebaadU,
+    (uint64_t)0x27f29e148f929057U, (uint64_t)0x7a64ae06c0c853dfU, (uint64_t)0x256cd18358e9c5ceU,
+    (uint64_t)0x9d9cce82ded092a5U, (uint64_t)0xcc6e59796e93b7c7U, (uint64_t)0xe1e4709231bb9e27U,
+    (uint64_t)0xb70b3083aa9e29a0U, (uint64_t)0xbf181a753785e644U, (uint64_t)0xd3b3a13f1402b9d0U,
+    (uint64_t)0x573441c32c7bc863U, (uint64_t)0x4b301ec4578c3e6eU, (uint64_t)0xc26fc9c40adaf57eU,
+    (uint64_t)0x96e71bfd7493cea3U, (uint64_t)0xd05d4b3f1af81456U, (uint64_t)0xdaca2a8a6a8c608fU,
+    (uint64_t)0x53ef07f60725b276U, (uint64_t)0xa6b5c9d646ac49d2U, (uint64_t)0x42c77c0b83137aa9U,
+    (uint64_t)0x24d000fc68225a38U, (uint64_t)0x0f63cfc82fe1e907U, (uint64_t)0x22d1b01bc6441f95U,
+    (uint64_t)0x7d38f719ec8e448fU, (uint64_t)0x9b33fa5f787fb1baU, (uint64_t)0x94dcfda1190158dfU,
+    (uint64_t)0x057fed45526f09fdU, (uint64_t)0xe8a4f10c8128240aU, (uint64_t)0x9332efc4ff2bfd8dU,
+    (uint64_t)0x214e77a0bd35aa31U, (uint64_t)0x32896d7314faa40eU, (uint64_t)0x767867ec01e5f186U,
+    (uint64_t)0xc9adf8f117a1813eU, (uint64_t)0xcb6cda7854741795U, (uint64_t)0x211cde10296c36efU,
+    (uint64_t)0x7ee8967282c4da77U, (uint64_t)0xb617d270a57836daU, (uint64_t)0xf0cd9c319cb7560bU,
+    (uint64_t)0x01fdcbf7e455fe90U, (uint64_t)0x3fb53cbb7e7334f3U, (uint64_t)0x781e2ea44e7de4ecU,
+    (uint64_t)0x8adab3ad0b384fd0U, (uint64_t)0x1c6bd47d53b618c0U, (uint64_t)0xc424f46c6a227923U,
+    (uint64_t)0x7303ffdedd92d964U, (uint64_t)0xe971287871b5abf2U, (uint64_t)0x8f48a632f815561dU,
+    (uint64_t)0x85f48ff5d3c055d1U, (uint64_t)0x222a14277525684fU, (uint64_t)0xd0d841a067360cc3U,
+    (uint64_t)0x01778a2b599ff0f9U, (uint64_t)0x68a923d78104fc6bU, (uint64_t)0x5bfa44dfda694ff3U,
+    (uint64_t)0x4f7199dbf7667f12U, (uint64_t)0xc06d8ff6e46f2a79U, (uint64_t)0x08b5deade9f8131dU,
+    (uint64_t)0x02519a59abb4ce7cU, (uint64_t)0xc4f710bcb42aec3eU, (uint64_t)0xb228a90f0e0b040dU,
+    (uint64_t)0xbaf02d8245ff897fU, (uint64_t)0x2aac79e600fa6122U, (uint64_t)0x248288178e36f557U,
+    (uint64_t)0xb9521d31113ec356U, (uint64_t)0x9e48861e15eff1f8U, (uint64_t)0x2aa1d412e0d41715U,
+    (uint64_t)0x71f8620353f131b8U, (uint64_t)0x3014368b4ed80940U, (uint64_t)0x67e6d0567a6fceddU,
+    (uint64_t)0x7c208c49ca97579fU, (uint64_t)0xfe3d7a81a23597f6U, (uint64_t)0x5e2032027e096ae2U,
+    (uint64_t)0xb1f3e1e724b39366U, (uint64_t)0x26da26f32fdcdffcU, (uint64_t)0x79422f1d6097be83U,
+    (uint64_t)0x263a2cfb9db3b381U, (uint64_t)0x9c3a2deed4df0a4bU, (uint64_t)0x728d06e97d04e61fU,
+    (uint64_t)0x8b1adfbc42449325U, (uint64_t)0x6ec1d9397e053a1bU, (uint64_t)0xee2be5c766daf707U,
+    (uint64_t)0x80ba1e14810ac7abU, (uint64_t)0xdd2ae778f530f174U, (uint64_t)0x0435d97a205b9d8bU,
+    (uint64_t)0x6eb8f064056756d4U, (uint64_t)0xd5e88a8bb6f8210eU, (uint64_t)0x070ef12dec9fd9eaU,
+    (uint64_t)0x4d8495053bcc876aU, (uint64_t)0x12a75338a7404ce3U, (uint64_t)0xd22b49e1b8a1db5eU,
+    (uint64_t)0xec1f205114bfa5adU, (uint64_t)0xadbaeb79b6828f36U, (uint64_t)0x9d7a025801bd5b9eU,
+    (uint64_t)0xeda01e0d1e844b0cU, (uint64_t)0x4b625175887edfc9U, (uint64_t)0x14109fdd9669b621U,
+    (uint64_t)0x88a2ca56f6f87b98U, (uint64_t)0xfe2eb788170df6bcU, (uint64_t)0x0cea06f4ffa473f9U,
+    (uint64_t)0x43ed81b5c4e83d33U, (uint64_t)0xd9f358795efd488bU, (uint64_t)0x164a620f9deb4d0fU,
+    (uint64_t)0xc6927bdbac6a7394U, (uint64_t)0x45c28df79f9e0f03U, (uint64_t)0x2868661efcd7e1a9U,
+    (uint64_t)0x7cf4e8d0ffa348f1U, (uint64_t)0x6bd4c284398538e0U, (uint64_t)0x2618a091289a8619U,
+    (uint64_t)0xef796e606671b173U, (uint64_t)0x664e46e59090c632U, (uint64_t)0xa38062d41e66f8fbU,
+    (uint64_t)0x6c744a200573274eU, (uint64_t)0xd07b67e4a9271394U, (uint64_t)0x391223b26bdc0e20U,
+    (uint64_t)0xbe2d93f1eb0a05a7U, (uint64_t)0xf23e2e533f36d141U, (uint64_t)0xe84bb3d44dfca442U,
+    (uint64_t)0xb804a48d6b7c023aU, (uint64_t)0x1e16a8fa76431c3bU, (uint64_t)0x1b5452adddd472e0U,
+    (uint64_t)0x7d405ee70d1ee127U, (uint64_t)0x50fc6f1dffa27599U, (uint64_t)0x351ac53cbf391b35U,
+    (uint64_t)0x7efa14b84444896bU, (uint64_t)0x64974d2ff94027fbU, (uint64_t)0xefdcd0e8de84487dU,
+    (uint64_t)0x8c45b2602b48989bU, (uint64_t)0xa8fcbbc2d8463487U, (uint64_t)0xd1b2b3f73fbc476cU,
+    (uint64_t)0x21d005b7c8f443c0U, (uint64_t)0x518f2e6740c0139cU, (uint64_t)0x56036e8c06d75fc1U,
+    (uint64_t)0x2dcf7bb73249a89fU, (uint64_t)0x81dd1d3de245e7ddU, (uint64_t)0xf578dc4bebd6e2a7U,
+    (uint64_t)0x4c028903df2ce7a0U, (uint64_t)0xaee362889c39afacU, (uint64_t)0xdc847c31146404abU,
+    (uint64_t)0x6304c0d8a4e97818U, (uint64_t)0xe4ac8b33070d3aabU, (uint64_t)0x2643672b9a2cd5e5U,
+    (uint64_t)0x52eff79b1cfc9173U, (uint64_t)0x665ca49b90a7c13fU, (uint64_t)0x5a8dda59b3efb998U,
+    (uint64_t)0x8a5b922d052f1341U, (uint64_t)0xae9ebbab3cf9a530U, (uint64_t)0x35986e7bf56da4d7U,
+    (uint64_t)0x534acf4fda79e5acU, (uint64_t)0x68b83b3a8630215fU, (uint64_t)0x5c748b2ed085756eU,
+    (uint64_t)0xb0317258e5d37cb2U, (uint64_t)0x6735841ac5ccc2c4U, (uint64_t)0x7d7dc96b3d9d5069U,
+    (uint64_t)0xa147e410fd1754bdU, (uint64_t)0x65296e94d399ddd5U, (uint64_t)0x831ab3edf0290a8fU,
+    (uint64_t)0xcae81966cb47c387U, (uint64_t)0xaad7dece184efb4fU, (uint64_t)0xdcfc53b34749110eU,
+    (uint64_t)0x6698f23c4cb632f9U, (uint64_t)0xc42a1ad6b91f8067U, (uint64_t)0xb116a81d6284180aU,
+    (uint64_t)0xebedf5f8e901326fU, (uint64_t)0xd7e0c4cdb30cfb3aU, (uint64_t)0x6d09b8c16c9db4c8U,
+    (uint64_t)0x40ba1a4207c8d9dfU, (uint64_t)0x6fd495f71c52c66dU, (uint64_t)0xfb0e169f275264daU,
+    (uint64_t)0x80c2b746e57d8362U, (uint64_t)0xedd987f749ad7222U, (uint64_t)0xfdc229af4398ec7bU,
+    (uint64_t)0x54a6fe5a59b0ff62U, (uint64_t)0x25ec81a34094d0d4U, (uint64_t)0xfcfd834e33437f1dU,
+    (uint64_t)0x8e98378ba67604dcU, (uint64_t)0x53137dd6f4848598U, (uint64_t)0x87f2c5bf62fda36aU,
+    (uint64_t)0x70dc1c27ef74df46U, (uint64_t)0x3ebf428f0a86a056U, (uint64_t)0x6713ac7ad0d350a3U,
+    (uint64_t)0x84f6ebf9105a1f2fU, (uint64_t)0x17a1495816254046U, (uint64_t)0xafa5e9a4aef406f7U,
+    (uint64_t)0xf97baf7c1cdd69b6U, (uint64_t)0x64081a305ee86474U, (uint64_t)0xeb9f7f091227f62aU,
+    (uint64_t)0x3e47f1dc3485652cU, (uint64_t)0x6f975e7fb7f01d83U, (uint64_t)0x5f1f860b45ccf5cbU,
+    (uint64_t)0x22702eba8b70930fU, (uint64_t)0xd8186df72b5cc879U, (uint64_t)0x8c065da01720468fU,
+    (uint64_t)0x4247726100464c80U, (uint64_t)0xd8c4bbbec277e1caU, (uint64_t)0x04aaea1766ba642fU,
+    (uint64_t)0xb0d1ed8452666a58U, (uint64_t)0x4bcb6e00e6a9c3c2U, (uint64_t)0x3c57411c26906408U,
+    (uint64_t)0xcfc2075513556400U, (uint64_t)0xa08b1c505294dba3U, (uint64_t)0xa30ba2868b7dd31eU,
+    (uint64_t)0xd70ba90e991eca74U, (uint64_t)0x094e142ce762c2b9U, (uint64_t)0xb81d783e979f3925U,
+    (uint64_t)0x1efd130aaf4c89a7U, (uint64_t)0x525c2144fd1bf7faU, (uint64_t)0x4b2969041b265a9eU,
+    (uint64_t)0xed8e9634b9db65b6U, (uint64_t)0x35c82e3203599d8aU, (uint64_t)0xdaa7a54f403563f3U,
+    (uint64_t)0x9df088ad022c38abU, (uint64_t)0x8d084f124237b64bU, (uint64_t)0x688ebe99e3ecfd07U,
+    (uint64_t)0x57b8a70cf6845dd8U, (uint64_t)0x808fc59c5da4a325U, (uint64_t)0xa9032b2ba3585862U,
+    (uint64_t)0xb66825d5edf29386U, (uint64_t)0xb5a5a8db431ec29bU, (uint64_t)0xbb143a983a1e8dc8U,
+    (uint64_t)0x9e93ba24f111661eU, (uint64_t)0xedced484b105eb04U, (uint64_t)0x96dc9ba1f424b578U,
+    (uint64_t)0xbf8f66b7e83e9069U, (uint64_t)0x872d4df4d7ed8216U, (uint64_t)0xbf07f3778e2cbecfU,
+    (uint64_t)0x4281d89998e73754U, (uint64_t)0xfec85fbb8aab8708U, (uint64_t)0x13b5bf22765fa7d0U,
+    (uint64_t)0x59805bf01d6a5370U, (uint64_t)0x67a5e29d4280db98U, (uint64_t)0x4f53916f776b1ce3U,
+    (uint64_t)0x714ff61f33ddf626U, (uint64_t)0x4206238ea085d103U, (uint64_t)0x1c50d4b7e5809ee3U,
+    (uint64_t)0x999f450d85f8eb1dU, (uint64_t)0x82eebe731a3a93bcU, (uint64_t)0x42bbf465a21adc1aU,
+    (uint64_t)0xc10b6fa4ef030efdU, (uint64_t)0x247aa4c787b097bbU, (uint64_t)0x8b8dc632f60c77daU,
+    (uint64_t)0x6ffbc26ac223523eU, (uint64_t)0xa4f6ff11344579cfU, (uint64_t)0x5825653c980250f6U,
+    (uint64_t)0x4bf367ba4a493b31U, (uint64_t)0x54f20a529bf7f026U, (uint64_t)0xb696e0629795914bU,
+    (uint64_t)0xcddab96d8bf236acU, (uint64_t)0x4ff2c70aed25ea13U, (uint64_t)0xfa1d09eb81cbbbe7U,
+    (uint64_t)0x88fc8c87468544c5U, (uint64_t)0x847a670d696b3317U, (uint64_t)0xeda6c595d314e7bcU,
+    (uint64_t)0x2ee7464b467899edU, (uint64_t)0x1cef423c0a1ed5d3U, (uint64_t)0x217e76ea69cc7613U,
+    (uint64_t)0x27ccce1fe7cda917U, (uint64_t)0x12d8016b8a893f16U, (uint64_t)0xbcd6de849fc74f6bU,
+    (uint64_t)0xfa5817e2f3144e61U, (uint64_t)0xb79d4cc5ac751e7bU, (uint64_t)0x93f96472fd4211bdU,
+    (uint64_t)0x8c72d3d2c8de4fc6U, (uint64_t)0x7b69cbf5df44f064U, (uint64_t)0x3da90ca2f4bf94e1U,
+    (uint64_t)0x1a5325f8f12894e2U, (uint64_t)0x0a437f6c7917d60bU, (uint64_t)0x9be7048696c9cb5dU,
+    (uint64_t)0x949c9976e1337c26U, (uint64_t)0x6faadebdd73d68e5U, (uint64_t)0x9e158614f1b768d9U,
+    (uint64_t)0x22dfa5579cc4f069U, (uint64_t)0xccd6da17be93c6d6U, (uint64_t)0x24866c61a504f5b9U,
+    (uint64_t)0x2121353c8d694da1U, (uint64_t)0x1c6ca5800140b8c6U, (uint64_t)0xf1604a7dd4b79bb8U,
+    (uint64_t)0xaee806fb52c878c8U, (uint64_t)0x34144f118d47b8e8U, (uint64_t)0x72edf52b949f9054U,
+    (uint64_t)0xebfca84e2127015aU, (uint64_t)0x9051d0c09cb7cef3U, (uint64_t)0x86e8fe58296deec8U,
+    (uint64_t)0x33b2818841010d74U, (uint64_t)0xbd5660ed9aed9f40U, (uint64_t)0x70ca6ad1532a8c99U,
+    (uint64_t)0xc4978bfb95c371eaU, (uint64_t)0xe5464d0d7003109dU, (uint64_t)0x1af32fdfd9e535efU,
+    (uint64_t)0xabf57ea798c9185bU, (uint64_t)0xed7a741712b42488U, (uint64_t)0x8e0296a7e97286faU,
+    (uint64_t)0x01079383171b445fU, (uint64_t)0x9bcf21e38131ad4cU, (uint64_t)0x8cdfe205c93987e8U,
+    (uint64_t)0xe63f4152c92e8c8fU, (uint64_t)0x729462a930add43dU, (uint64_t)0x62ebb143c980f05aU,
+    (uint64_t)0x4f3954e53b06e968U, (uint64_t)0xfe1d75ad242cf6b1U, (uint64_t)0x8b57416e1f017d5eU,
+    (uint64_t)0x375333967674e99bU, (uint64_t)0x6e6d94c0e8f488a0U, (uint64_t)0xb93a787adc16f95eU,
+    (uint64_t)0xc3ac51a2dcc99cccU, (uint64_t)0xc134b4139aa47c1dU, (uint64_t)0xf28fcdafafdfd8d5U,
+    (uint64_t)0x0d57bd8e10b831edU, (uint64_t)0x9276fbccf0bcfc46U, (uint64_t)0x3a822aceb5cffee6U,
+    (uint64_t)0x328ed2fec75d915bU, (uint64_t)0xa145c113c359476cU, (uint64_t)0xf61a81538be17bcdU,
+    (uint64_t)0x01e867c3aa6c3d8fU, (uint64_t)0x5634e15d6516c82fU, (uint64_t)0xc1437bd26948b9b0U,
+    (uint64_t)0xd2fcd2006c19d4c7U, (uint64_t)0xa0f3c437e1b1e976U, (uint64_t)0xf0545ff694f237e8U,
+    (uint64_t)0xdd10ec3fc0bf8bb1U, (uint64_t)0x4f89696cac7cd3e1U, (uint64_t)0xed3714ec5f24bfe6U,
+    (uint64_t)0x363eb1d85faf7706U, (uint64_t)0xfcbd604dc027cc32U, (uint64_t)0x5f95c6c7af8685c8U,
+    (uint64_t)0xd4c1c8ce2f8f01aaU, (uint64_t)0xc44bbe322574692aU, (uint64_t)0xb8003478d4a4a068U,
+    (uint64_t)0x7c8fc6e52eca3cdbU, (uint64_t)0xea1db16bec04d399U, (uint64_t)0xb05bc82e8f2bc5cfU,
+    (uint64_t)0x763d517ff44793d2U, (uint64_t)0xf3b7963f4c830320U, (uint64_t)0x842c7aa0903203e3U,
+    (uint64_t)0xaf22ca0ae7327afbU, (uint64_t)0x38e13092967609b6U, (uint64_t)0x73b8fb62757558f1U,
+    (uint64_t)0x3cc3e831f7eca8c1U, (uint64_t)0xe4174474f6331627U, (uint64_t)0xa77989cac3c40234U,
+    (uint64_t)0xae8317f4b0166f7aU, (uint64_t)0xfbd3e3f7ceec74e6U, (uint64_t)0xfdb516ace0874bfdU,
+    (uint64_t)0x3d846019c681f3a3U, (uint64_t)0x0b12ee5c7c1620b0U, (uint64_t)0xba68b4dd2b63c501U,
+    (uint64_t)0xac03cd326668c51eU, (uint64_t)0x2a6279f74e0bcb5bU, (uint64_t)0xb32cb8b0b796d219U,
+    (uint64_t)0xc3e95f4f34741dd9U, (uint64_t)0x8721212568edf6f5U, (uint64_t)0x7a03aee4a2b9cb8eU,
+    (uint64_t)0x0cd3c376f53a89aaU, (uint64_t)0x0d8af9b1948a28dcU, (uint64_t)0xcf86a3f4902ab04fU,
+    (uint64_t)0x8aacb62a7f42002dU, (uint64_t)0xfd8e139f8f5fcda8U, (uint64_t)0xf3e558c4bdee5bfdU,
+    (uint64_t)0xd76cbaf4e33f9f77U, (uint64_t)0x3a4c97a471771969U, (uint64_t)0xda27e84bf6dce6a7U,
+    (uint64_t)0xff373d9613e6c2d1U, (uint64_t)0xf115193cd759a6e9U, (uint64_t)0x3f9b702563d2262cU,
+    (uint64_t)0x9cb0ae6c252bd479U, (uint64_t)0x05e0f88a12b5848fU, (uint64_t)0x78f6d2b2a5c97663U,
+    (uint64_t)0x6f6e149bc162225cU, (uint64_t)0xe602235cde601a89U, (uint64_t)0xd17bbe98f373be1fU,
+    (uint64_t)0xcaf49a5ba8471827U, (uint64_t)0x7e1a0a8518aaa116U, (uint64_t)0x12536fea87baa627U,
+    (uint64_t)0x58c1fec1f72aa680U, (uint64_t)0x6c29b637601e5dc9U, (uint64_t)0x9e3c3c1cde9e01b9U,
+    (uint64_t)0xefc8127b2bcfe0b0U, (uint64_t)0x351071022a12f50dU, (uint64_t)0x6ccd6cb14879b397U,
+    (uint64_t)0xf792f804f8a82f21U, (uint64_t)0x8b1e572235e6fc06U, (uint64_t)0x3477728f0b3e13d5U,
+    (uint64_t)0x150c294daa8a7372U, (uint64_t)0xc0291d433bfa528aU, (uint64_t)0xc6c8bc67cec5a196U,
+    (uint64_t)0xdeeb31e45c2e8a7cU, (uint64_t)0xba93e244fb6e1c51U, (uint64_t)0xb9f8b71b2e28e156U,
+    (uint64_t)0x8c3184911a335cc8U, (uint64_t)0x563459ba6a5913e4U, (uint64_t)0x1b920d61c7b32919U,
+    (uint64_t)0x805ab8b6a02425adU, (uint64_t)0x2ac512da8d006086U, (uint64_t)0x6ca4846abcf5c0fdU,
+    (uint64_t)0xafea51d8ac2138d7U, (uint64_t)0xcb647545344cd443U, (uint64_t)0x511053e453544774U,
+    (uint64_t)0x834d0ecc3adba2bcU, (uint64_t)0x4215d7f7bae371f5U, (uint64_t)0xfcfd57bf6c8663bcU,
+    (uint64_t)0xded2383dd6901b1dU, (uint64_t)0x3b49fbb4b5587dc3U, (uint64_t)0xfd44a08d07625f62U,
+    (uint64_t)0x3ee4d65b9de9b762U, (uint64_t)0x64e5137d0d63d1faU, (uint64_t)0x658fc05202a9d89fU,
+    (uint64_t)0x4889487450436309U, (uint64_t)0xe9ae30f8d598da61U, (uint64_t)0x2ed710d1818baf91U,
+    (uint64_t)0xe27e9e068b6a0c20U, (uint64_t)0x1e28dcfb1c1a6b44U, (uint64_t)0x883acb64d6ac57dcU,
+    (uint64_t)0xed7f2e774e6daae2U, (uint64_t)0x7b3ae0e39e0a19bcU, (uint64_t)0xd3293f8a91ae677eU,
+    (uint64_t)0xd363b0cb45c8611fU, (uint64_t)0xbe1d1ccf309ae93bU, (uint64_t)0xa3f80be73920cae1U,
+    (uint64_t)0xaaacba74498edf01U, (uint64_t)0x1e6d2a4ab2f5ac90U, (uint64_t)0x8735728dc2c6ff70U,
+    (uint64_t)0x79d6122fc5dc2235U, (uint64_t)0x23f5d00319e277f9U, (uint64_t)0x7ee84e25dded8cc7U,
+    (uint64_t)0x91a8afb063cd880aU, (uint64_t)0x3f3ea7c63574af60U, (uint64_t)0x0cfcdc8402de7f42U,
+    (uint64_t)0x62d0792fb31aa152U, (uint64_t)0x40fdf5aabeccefb5U, (uint64_t)0xcf56ede93621d7c7U,
+    (uint64_t)0xb632a9ce52b576c1U, (uint64_t)0xd3403ae89a6f6027U, (uint64_t)0x660a050de8785a64U,
+    (uint64_t)0x10f3d6479682652eU, (uint64_t)0x78b25edf4fbcbe02U, (uint64_t)0xc9710fdeb4f9315dU,
+    (uint64_t)0x8e1b4e438a5807ceU, (uint64_t)0xad283893e4109a7eU, (uint64_t)0xc30cc9cbafd59ddaU,
+    (uint64_t)0xf65f36c63d8d8093U, (uint64_t)0xdf31469ea60d32b2U, (uint64_t)0xee93df4b3e8191c8U,
+    (uint64_t)0x9c1017c5355bdeb5U, (uint64_t)0xd26231858616aa28U, (uint64_t)0xd655ade73245980eU,
+    (uint64_t)0xa6f5965781067200U, (uint64_t)0xe4fc23bedb136be1U, (uint64_t)0x9f246cdcaf13d879U,
+    (uint64_t)0xc2b93117f961ac0eU, (uint64_t)0xc8a741b5ebdb9e1aU, (uint64_t)0x82ede2466c693bd1U,
+    (uint64_t)0xfcde6b4f3dd1701eU, (uint64_t)0xb02c83f9dec31a21U, (uint64_t)0x988c8b236ad9d573U,
+    (uint64_t)0x53e983aea57be365U, (uint64_t)0xe968734d646f834eU, (uint64_t)0x9137ea8f5da6309bU,
+    (uint64_t)0x10f3a624c1f1ce16U, (uint64_t)0x782a9ea2ca440921U, (uint64_t)0xdf94739e5b46f1b5U,
+    (uint64_t)0x56f8410ef4f8b16aU, (uint64_t)0x97241afec47b266aU, (uint64_t)0x0a406b8e6d9c87c1U,
+    (uint64_t)0x803f3e02cd42ab1bU, (uint64_t)0x7f0309a804dbec69U, (uint64_t)0xa83b85f73bbad05fU,
+    (uint64_t)0xc6097273ad8e197fU, (uint64_t)0xc097440e5067adc1U, (uint64_t)0x3f747fa0b311898cU,
+    (uint64_t)0xe2a272e4cd0eac65U, (uint64_t)0x4bba5851f914d0bcU, (uint64_t)0x7a1a9660c4a43ee3U,
+    (uint64_t)0xe5a367cea1c8cde9U, (uint64_t)0x9d958ba97271abe3U, (uint64_t)0xf3ff7eb63d1615cdU,
+    (uint64_t)0xa2280dcef5ae20b0U, (uint64_t)0x266344a43794f8dcU, (uint64_t)0xdcca923a483c5c36U,
+    (uint64_t)0x2d6b6bbf3f9d10a0U, (uint64_t)0xb320c5ca81d9bdf3U, (uint64_t)0x620e28ff47b50a95U,
+    (uint64_t)0x933e3b01cef03371U, (uint64_t)0xf081bf8599100153U, (uint64_t)0x183be9a0c3a8c8d6U,
+    (uint64_t)0xb6c185c341dca566U, (uint64_t)0x7de7fedad8622aa3U, (uint64_t)0x99e84d92901b6dfbU,
+    (uint64_t)0x30a02b0e7c4ad288U, (uint64_t)0xc7c81daa2fd3cf36U, (uint64_t)0xd1319547df89e59fU,
+    (uint64_t)0xb2be8184cd496733U, (uint64_t)0xd5f449eb93d3412bU, (uint64_t)0x25470fabe085116bU,
+    (uint64_t)0x04a4337587285310U, (uint64_t)0x4e39187ee2bfd52fU, (uint64_t)0x36166b447d9ebc74U,
+    (uint64_t)0x92ad433cfd4b322cU, (uint64_t)0x726aa817ba79ab51U, (uint64_t)0xf96eacd8c1db15ebU,
+    (uint64_t)0xfaf71e910476be63U, (uint64_t)0xd74e9bdac97e6516U, (uint64_t)0x88779360c230f49eU,
+    (uint64_t)0xa6ec1de31e74ea49U, (uint64_t)0x581dcee53fb645a2U, (uint64_t)0xbaef23918f483f14U,
+    (uint64_t)0x6d2dddfcd137d13bU, (uint64_t)0x54cde50ed2743a42U, (uint64_t)0x89a34fc5e4d97e67U,
+    (uint64_t)0x72cfd2e949dee168U, (uint64_t)0x1ae052233e2af239U, (uint64_t)0x009e75be1d94066aU,
+    (uint64_t)0x6cca31c738abf413U, (uint64_t)0xb50bd61d9bc49908U, (uint64_t)0x4a9b4a8cf5e2bc1eU,
+    (uint64_t)0xeb6cc5f7946f83acU, (uint64_t)0x27da93fcebffab28U, (uint64_t)0xc492ec644cd8f64cU,
+    (uint64_t)0x58a2d790279d7b51U, (uint64_t)0x0ced1fc51fc75256U, (uint64_t)0x3e658aed8f433017U,
+    (uint64_t)0x0b61942e05da59ebU, (uint64_t)0xba3d60a30ddc3722U, (uint64_t)0x7c311cd1742e7f87U,
+    (uint64_t)0x6473ffeef6b01b6eU, (uint64_t)0x8303604f692ac542U, (uint64_t)0xf079ffe1227b91d3U,
+    (uint64_t)0x19f63e6315aaf9bdU, (uint64_t)0xf99ee565f1f344fbU, (uint64_t)0x8a1d661fd6219199U,
+    (uint64_t)0x8c883bc6d48ce41cU, (uint64_t)0x1065118f3c74d904U, (uint64_t)0x713889ee0faf8b1bU,
+    (uint64_t)0x972b3f8f81a1b3beU, (uint64_t)0x4f3ce145ce2764a0U, (uint64_t)0xe2d0f1cc28c4f5f7U,
+    (uint64_t)0xdeee0c0dc7f3985bU, (uint64_t)0x7df4adc0d39e25c3U, (uint64_t)0x40619820c467a080U,
+    (uint64_t)0x440ebc9361cf5a58U, (uint64_t)0x527729a6422ad600U, (uint64_t)0xca6c0937b1b76ba6U,
+    (uint64_t)0x1a2eab854d2026dcU, (uint64_t)0xb1715e1519d9ae0aU, (uint64_t)0xf1ad9199bac4a026U,
+    (uint64_t)0x35b3dfb807ea7b0eU, (uint64_t)0xedf5496f3ed9eb89U, (uint64_t)0x8932e5ff2d6d08abU,
+    (uint64_t)0xf314874e25bd2731U, (uint64_t)0xefb26a753f73f449U, (uint64_t)0x1d1c94f88d44fc79U,
+    (uint64_t)0x49f0fbc53bc0dc4dU, (uint64_t)0xb747ea0b3698a0d0U, (uint64_t)0x5218c3fe228d291eU,
+    (uint64_t)0x35b804b543c129d6U, (uint64_t)0xfac859b8d1acc516U, (uint64_t)0x6c10697d95d6e668U,
+    (uint64_t)0xc38e438f0876fd4eU, (uint64_t)0x45f0c30783d2f383U, (uint64_t)0x203cc2ecb10934cbU,
+    (uint64_t)0x6a8f24392c9d46eeU, (uint64_t)0xf16b431b65ccde7bU, (uint64_t)0x41e2cd1827e76a6fU,
+    (uint64_t)0xb9c8cf8f4e3484d7U, (uint64_t)0x64426efd8315244aU, (uint64_t)0x1c0a8e44fc94dea3U,
+    (uint64_t)0x34c8cdbfdad6a0b0U, (uint64_t)0x919c384004113cefU, (uint64_t)0xfd32fba415490ffaU,
+    (uint64_t)0x58d190f6795dcfb7U, (uint64_t)0xfef01b0383588bafU, (uint64_t)0x9e6d1d63ca1fc1c0U,
+    (uint64_t)0x53173f96f0a41ac9U, (uint64_t)0x2b1d402aba16f73bU, (uint64_t)0x2fb310148cf9b9fcU,
+    (uint64_t)0x2d51e60e446ef7bfU, (uint64_t)0xc731021bb91e1745U, (uint64_t)0x9d3b47244fee99d4U,
+    (uint64_t)0x4bca48b6fac5c1eaU, (uint64_t)0x70f5f514bbea9af7U, (uint64_t)0x751f55a5974c283aU,
+    (uint64_t)0x6e30251acb452fdbU, (uint64_t)0x31ee696550f30650U, (uint64_t)0xb0b3e508933548d9U,
+    (uint64_t)0xb8949a4ff4b0ef5bU, (uint64_t)0x208b83263c88f3bdU, (uint64_t)0xab147c30db1d9989U,
+    (uint64_t)0xed6515fd44d4df03U, (uint64_t)0x17a12f75e72eb0c5U, (uint64_t)0x25914f7881fdad90U,
+    (uint64_t)0xcf638f560d2cf6abU, (uint64_t)0xb90bc03fcc054de5U, (uint64_t)0x932811a718b06350U,
+    (uint64_t)0x2f00b3309bbd11ffU, (uint64_t)0x76108a6fb4044974U, (uint64_t)0x801bb9e0a851d266U,
+    (uint64_t)0x0dd099bebf8990c1U, (uint64_t)0x14c6dd8a58d6cd46U, (uint64_t)0x9cb633b58e6634d2U,
+    (uint64_t)0xc1305047f81bc328U, (uint64_t)0x12ede0e226a177e5U, (uint64_t)0x332cca62065a6f4fU,
+    (uint64_t)0xc3a47ecd67be487bU, (uint64_t)0x741eb1870f47ed1cU, (uint64_t)0x99e66e58e7598b14U,
+    (uint64_t)0xebd6a6777b0ac93dU, (uint64_t)0xa6e37b0d78f5e0d7U, (uint64_t)0x2516c09676f5492bU,
+    (uint64_t)0x1e4bf8889ac05f3aU, (uint64_t)0xcdb42ce04df0ba2bU, (uint64_t)0x935d5cfd5062341bU,
+    (uint64_t)0x8a30333382acac20U, (uint64_t)0x429438c45198b00eU, (uint64_t)0xfb2838be67e573e0U,
+    (uint64_t)0x05891db94084c44bU, (uint64_t)0x9131137396c1c2c5U, (uint64_t)0x6aebfa3fd958444bU,
+    (uint64_t)0xac9cdce9e56e55c1U, (uint64_t)0x7148ced32caa46d0U, (uint64_t)0x2e10c7efb61fe8ebU,
+    (uint64_t)0x9fd835daff97cf4dU, (uint64_t)0x6c626f56c1770616U, (uint64_t)0x5351909e09da9a2dU,
+    (uint64_t)0xe58e6825a3730e45U, (uint64_t)0x9d8c8bc003ef0a79U, (uint64_t)0x543f78b6056becfdU,
+    (uint64_t)0x33f13253a090b36dU, (uint64_t)0x82ad4997794432f9U, (uint64_t)0x1386493c4721f502U,
+    (uint64_t)0x3794eefa5abea82aU, (uint64_t)0x8dc611b993fe62d4U, (uint64_t)0x69f1af37281ef606U,
+    (uint64_t)0x6af546c839839e69U, (uint64_t)0x625578c7c977ec23U, (uint64_t)0xa8de294cbd5c0576U,
+    (uint64_t)0xe2ddaf0f7cd1a4c0U, (uint64_t)0x8243fc704f95f4d4U, (uint64_t)0xe566f400b008733aU,
+    (uint64_t)0xcba0697d512e1f57U, (uint64_t)0x9537c2b240509cd0U, (uint64_t)0x5f989c6957353d8cU,
+    (uint64_t)0x7dbec9724c3c2b2fU, (uint64_t)0x90e02fa8ff031fa8U, (uint64_t)0xf4d15c53cfd5d11fU,
+    (uint64_t)0xb3404fae48314dfcU, (uint64_t)0xa36da109081e9387U, (uint64_t)0xfb9780d78c935828U,
+    (uint64_t)0xd5940332e540b015U, (uint64_t)0xc9d7b51be0f466faU, (uint64_t)0xfaadcd41d6d9f671U,
+    (uint64_t)0xba6c1e28b1a2ac17U, (uint64_t)0x066a7833ed201e5fU, (uint64_t)0x19d99719f90f462bU,
+    (uint64_t)0xf431f462060b5f61U, (uint64_t)0xa56f46b47bd057c2U, (uint64_t)0x348dca6c47e1bf65U,
+    (uint64_t)0x9a38783e41bcf1ffU, (uint64_t)0x7a5d33a9da710718U, (uint64_t)0x5a7799872e0aeaf6U,
+    (uint64_t)0xca87314d2d29d187U, (uint64_t)0xfa0edc3ec687d733U, (uint64_t)0x1c894849cb198ac7U,
+    (uint64_t)0xa884a93d0f264665U, (uint64_t)0x2da964ef9b200678U, (uint64_t)0x3c351b87009834e6U,
+    (uint64_t)0xafb2ef9fe2c4b44bU, (uint64_t)0x580f6c473326790cU, (uint64_t)0xb84805210b02264aU,
+    (uint64_t)0x8ba6f9e242a194e2U, (uint64_t)0x499b6ab65eb03c0eU, (uint64_t)0xf19b795472bc3fdeU,
+    (uint64_t)0xa86b5b9c6e3a80d2U, (uint64_t)0xe43775086d42819fU, (uint64_t)0xc1663650bb3ee8a3U,
+    (uint64_t)0x75eb14fcb132075fU, (uint64_t)0xa8ccc9067ad834f6U, (uint64_t)0xea6a2474e6e92ffdU,
+    (uint64_t)0x39d934abd3c095f1U, (uint64_t)0x04b261bee4b76d71U, (uint64_t)0x1d2e6970e73e6984U,
+    (uint64_t)0x879fb23b5e5fcb11U, (uint64_t)0x11506c72dfd75490U, (uint64_t)0x3a97d08561bcf1c1U,
+    (uint64_t)0x43201d82bf5e7007U, (uint64_t)0x7f0ac52f798232a7U, (uint64_t)0xcb4d20ee4b049136U,
+    (uint64_t)0x8b63bf12356a4613U, (uint64_t)0x1221aef670e08128U, (uint64_t)0xe62d8c514acb6b16U,
+    (uint64_t)0x71f64a67379e7896U, (uint64_t)0xb25237a2cafd7fa5U, (uint64_t)0xf077bd983841ba6aU,
+    (uint64_t)0xc4ac02443cd16e7eU, (uint64_t)0xb25101fb319d7682U, (uint64_t)0xb02931290a982feeU,
+    (uint64_t)0x51c1c9b90261b344U, (uint64_t)0x0e008c5bbfd371faU, (uint64_t)0xd866dd1c0278ca33U,
+    (uint64_t)0x666f76a6e5aa53b1U, (uint64_t)0xe5cfb7796013a2cfU, (uint64_t)0x1d3a1aada3521836U,
+    (uint64_t)0x3c5604ff50f75f9cU, (uint64_t)0x1d8eddf37e752b22U, (uint64_t)0x0ef074dd3c9a1118U,
+    (uint64_t)0xd0ffc172ccb86d7bU, (uint64_t)0xabd1ece3037d90f2U, (uint64_t)0xe3f307d66055856cU,
+    (uint64_t)0x422f93287e4c6dafU, (uint64_t)0x902aac66334879a0U, (uint64_t)0x76b4131a567193ecU,
+    (uint64_t)0xaf3c305ae5f6e70bU, (uint64_t)0x9587bd39031eebddU, (uint64_t)0x5709def871bbe831U,
+    (uint64_t)0x570599830eb2b669U, (uint64_t)0x4d80ce1b875b7029U, (uint64_t)0x838a7da80364ac16U,
+    (uint64_t)0x2f431d23be1c83abU, (uint64_t)0x75d9bc15adf7cccfU, (uint64_t)0x81a3e5d6dfa1e1b0U,
+    (uint64_t)0x8c39e444249bc17eU, (uint64_t)0xf37dccb28ea7fd43U, (uint64_t)0xda654873907fba12U,
+    (uint64_t)0x35daa6da4a372904U, (uint64_t)0x0564cfc66283a6c5U, (uint64_t)0xd09fa4f64a9395bfU,
+    (uint64_t)0x832d7080eb6b242dU, (uint64_t)0xd30bd0233b71e246U, (uint64_t)0x7027991bbe31139dU,
+    (uint64_t)0x68797e91462e4e53U, (uint64_t)0x423fe20a6b4e185aU, (uint64_t)0x82f2c67e42d9b707U,
+    (uint64_t)0x25c817684cf7811bU, (uint64_t)0xbd53005e045bb95dU, (uint64_t)0xc51aa29e5cfe5c48U,
+    (uint64_t)0x82c020ae815ee096U, (uint64_t)0x7848ad827549a68aU, (uint64_t)0x7933d48960471355U,
+    (uint64_t)0x04998d2e67c51e57U, (uint64_t)0x0f64020ad9944afcU, (uint64_t)0x7a299fe1a7fadac6U,
+    (uint64_t)0x40c73ff45aefe92cU, (uint64_t)0xe5f649be9d8e68fdU, (uint64_t)0xdb0f05331b044320U,
+    (uint64_t)0xf6fde9b3e0c33398U, (uint64_t)0x92f4209b66c8cfaeU, (uint64_t)0xe9d1afcc1a739d4bU,
+    (uint64_t)0x09aea75fa28ab8deU, (uint64_t)0x14375fb5eac6f1d0U, (uint64_t)0x6420b560708f7aa5U,
+    (uint64_t)0xbf44ffc75488771aU, (uint64_t)0xcb76e3f17f2f2191U, (uint64_t)0x4197bde394f86a42U,
+    (uint64_t)0x45c25bb970641d9aU, (uint64_t)0xd8a29e31f88ce6dcU, (uint64_t)0xbe2becfd4bb7ac7dU,
+    (uint64_t)0x13094214b5670cc7U, (uint64_t)0xe90a8fd560af8433U, (uint64_t)0x2d1afd5696f37750U,
+    (uint64_t)0x25dda55791507ff2U, (uint64_t)0x2b95fd4c006543edU, (uint64_t)0xf3c778d9a23c3911U,
+    (uint64_t)0x84ccf4463b04938dU, (uint64_t)0x3d9dded67eef947bU, (uint64_t)0xbed83735dae325b5U,
+    (uint64_t)0x5ba0f75cf921455dU, (uint64_t)0x0ecf9b8b4ebd3f02U, (uint64_t)0xa47acd9d86b770eaU,
+    (uint64_t)0x93b84a6a2da213ceU, (uint64_t)0xd760871b53e7c8cfU, (uint64_t)0x7a5f58e536e530d7U,
+    (uint64_t)0x7abc52a51912ad51U, (uint64_t)0x7ad43db02ea0252aU, (uint64_t)0x498b00ecc176b742U,
+    (uint64_t)0x9eae499c6254dc41U, (uint64_t)0x7e2939247a837e7eU, (uint64_t)0x74aec08c090524a7U,
+    (uint64_t)0xf82b92198d6f55f2U, (uint64_t)0x493c962e1402cec5U, (uint64_t)0x9f17ca17fa2f30e7U,
+    (uint64_t)0xbcd783e8e9b879cbU, (uint64_t)0xea3d8c145a6f145fU, (uint64_t)0x103c46e60ebcf726U,
+    (uint64_t)0x4482b8316231470eU, (uint64_t)0x6f6dfaca487c2109U, (uint64_t)0x2e0ace9762e666efU,
+    (uint64_t)0x3246a9d31f8d1f42U, (uint64_t)0x1b1e83f1574944d2U, (uint64_t)0x13dfa63aa57f334bU,
+    (uint64_t)0x0cf8daed9f025d81U, (uint64_t)0x85de1f0d1e935abbU, (uint64_t)0xdefd10b4154de37aU,
+    (uint64_t)0xb8d9e392369cebb5U, (uint64_t)0x54d5ef9b761324beU, (uint64_t)0x4d6341ba74f17e26U,
+    (uint64_t)0xc0a0e3c878c1dde4U, (uint64_t)0xa6d7758187d918fdU, (uint64_t)0x6687601502ca3a13U,
+    (uint64_t)0xbc19180c207674f1U, (uint64_t)0x112e09a733ae8fdbU, (uint64_t)0x996675546aaeb71eU,
+    (uint64_t)0x79432af1e101b1c7U, (uint64_t)0xd5eb558fde2ddec6U, (uint64_t)0x81392d1f5357753fU,
+    (uint64_t)0xa7a76b973ae1158aU, (uint64_t)0x416fbbff4a899991U, (uint64_t)0xee7332c7904fc3faU,
+    (uint64_t)0x14a23f45c7e3636aU, (uint64_t)0xc38659c3f091d9aaU, (uint64_t)0x4a995e5db12d8540U,
+    (uint64_t)0x20a53becf3a5598aU, (uint64_t)0x56534b17b1eaa995U, (uint64_t)0x9ed3dca4bf04e03cU,
+    (uint64_t)0x716c563ad8d56268U, (uint64_t)0x6d956e892f3b26e7U, (uint64_t)0xf4709860da875247U,
+    (uint64_t)0x3ad151792482dda3U, (uint64_t)0xd64110e3017d82f0U, (uint64_t)0x14928d2cfad414e4U,
+    (uint64_t)0x2b155f582ed02b24U, (uint64_t)0x481a141bcb821bf1U, (uint64_t)0x12e3c7704f81f5daU,
+    (uint64_t)0xdd5944ea308780f2U, (uint64_t)0xdc8de7613845f5e4U, (uint64_t)0x6beaba7d7624d7a3U,
+    (uint64_t)0x1e709afd304df11eU, (uint64_t)0x9536437602170456U, (uint64_t)0xbf204b3ac8f94b64U,
+    (uint64_t)0x4e53af7c5680ca68U, (uint64_t)0x0526074ae0c67574U, (uint64_t)0xe29fa63e7882f14fU,
+    (uint64_t)0xc9f6dc3507c6cadcU, (uint64_t)0x46f22d6fb882bed0U, (uint64_t)0x1a45755bd118e52cU,
+    (uint64_t)0x9f2c7c277c4608cfU, (uint64_t)0x7ccbdf32568012c2U, (uint64_t)0xfcb0aedd61729b0eU,
+    (uint64_t)0x7ca2ca9ef7d75dbfU, (uint64_t)0x5043dea7e0f222c2U, (uint64_t)0x309d42ac72e65142U,
+    (uint64_t)0x94fe9ddd9216cd30U, (uint64_t)0xd6539c7d0f87feecU, (uint64_t)0x03c5a57c432ac7d7U,
+    (uint64_t)0x72692cf0327fda10U, (uint64_t)0xec28c85f280698deU, (uint64_t)0x2331fb467ec283b1U,
+    (uint64_t)0xa0158eeae457a477U, (uint64_t)0xd19857dbee6ddc05U, (uint64_t)0xb326522418c41671U,
+    (uint64_t)0x3ffdfc7e3c2c0d58U, (uint64_t)0x3a3a525426ee7cdaU, (uint64_t)0x341b0869df02c3a8U,
+    (uint64_t)0xa023bf42723bbfc8U, (uint64_t)0x3d15002a14452691U, (uint64_t)0x5ef7324c85edfa30U,
+    (uint64_t)0x2597655487d4f3daU, (uint64_t)0x352f5bc0dcb50c86U, (uint64_t)0x8f6927b04832a96cU,
+    (uint64_t)0xd08ee1ba55f2f94cU, (uint64_t)0x6a996f99344b45faU, (uint64_t)0xe133cb8da8aa455dU,
+    (uint64_t)0x5d0721ec758dc1f7U, (uint64_t)0xf3cae7e9262a3539U, (uint64_t)0x78a49d1d6670d59eU,
+    (uint64_t)0x37de0f63c1c5e1b9U, (uint64_t)0x3072c30c69cb7c1cU, (uint64_t)0x1d278a5277c850e6U,
+    (uint64_t)0x84f15f8f1f6a3de6U, (uint64_t)0x46a8bb45592ca7adU, (uint64_t)0x1912e3eee4d424b8U,
+    (uint64_t)0x6ba7a92079e5fb67U, (uint64_t)0xe1331feb70aa725eU, (uint64_t)0x5080ccf57df5d837U,
+    (uint64_t)0xe4cae01d7ff72e21U, (uint64_t)0xd9243ee60412a77dU, (uint64_t)0x06ff7cacdf449025U,
+    (uint64_t)0xbe75f7cd23ef5a31U, (uint64_t)0xbc9578220ddef7a8U, (uint64_t)0xdc988086365e668bU,
+    (uint64_t)0xada8dcdaaabda5fbU, (uint64_t)0xbc146b4c255f1fbeU, (uint64_t)0x9cfcde29cf34cfc3U,
+    (uint64_t)0xacbb453e7e85d1e4U, (uint64_t)0x9ca09679f92358b5U, (uint64_t)0x15fc2d96240823ffU,
+    (uint64_t)0x8d65adf70c11d11eU, (uint64_t)0x8cf7230cb0ce1c55U, (uint64_t)0x5b534d050bbfb607U,
+    (uint64_t)0xee1ef1130e16363bU, (uint64_t)0x27e0aa7ab4999e82U, (uint64_t)0xce1dac2d79362c41U,
+    (uint64_t)0x67920c9091bb6cb0U, (uint64_t)0x1e648d632223df24U, (uint64_t)0x0f7d9eefe32e8f28U,
+    (uint64_t)0x775557f10296f4fdU, (uint64_t)0x1dca76a3ea51b436U, (uint64_t)0xf3e98f60fb950805U,
+    (uint64_t)0x31ff32ea831cf7f1U, (uint64_t)0x643e7bf18d2c714bU, (uint64_t)0x64b5c3392e9d2acaU,
+    (uint64_t)0xa9fd9ccc6adc2d23U, (uint64_t)0xfc2397eccc721b9bU, (uint64_t)0x6943f39afa833834U,
+    (uint64_t)0x22951722a6328562U, (uint64_t)0x81d63dd54170fc10U, (uint64_t)0x9f5fa58faecc2e6dU,
+    (uint64_t)0xb66c8725e77d9a3bU, (uint64_t)0x11235cea6384ebe0U, (uint64_t)0x06a8c1185845e24aU,
+    (uint64_t)0x0137b286ebd093b1U, (uint64_t)0xdb567d6ac42bd6d2U, (uint64_t)0x6df86468bb1f96aeU,
+    (uint64_t)0x0efe5b1a4843b28eU, (uint64_t)0x961bbb056379b240U, (uint64_t)0xb6caf5f070a6a26bU,
+    (uint64_t)0x70686c0d328e6e39U, (uint64_t)0x80da06cf895fc8d3U, (uint64_t)0x804d8810b363fdc9U,
+    (uint64_t)0x63b99ce74462007dU, (uint64_t)0xb8ab48a54cb5f5b7U, (uint64_t)0x9ec673d2f55edde7U,
+    (uint64_t)0xd1567f748cfaefdaU, (uint64_t)0x46381b6b0887bcecU, (uint64_t)0x694497cee178f3c2U,
+    (uint64_t)0x5e6525e31e6266cbU, (uint64_t)0x5931de26697d6413U, (uint64_t)0x14e49da11f17a34cU,
+    (uint64_t)0x5420ab39235a1456U, (uint64_t)0xb76372412f50363bU, (uint64_t)0x7b15d623c3fabb6eU,
+    (uint64_t)0xa0ef40b1e274e49cU, (uint64_t)0x5cf5074496b1860aU, (uint64_t)0xd6583fbf66afe5a4U,
+    (uint64_t)0x44240510f47e3e9aU, (uint64_t)0x142b55021a93507aU, (uint64_t)0xb4cd11878d3c06cfU,
+    (uint64_t)0xdf70e76a91ec3f40U, (uint64_t)0x484e81ad4e7553c2U, (uint64_t)0x830f87b5272e9d6eU,
+    (uint64_t)0xea1c93e5c6ff514aU, (uint64_t)0x67cc2adcc4192a8eU, (uint64_t)0xc77e27e242f4535aU,
+    (uint64_t)0xb5358b1e48ac2840U, (uint64_t)0x18311294ecba9477U, (uint64_t)0xda58f990a6946b43U,
+    (uint64_t)0x3098baf99ab41819U, (uint64_t)0x66c4c1584198da52U, (uint64_t)0xab4fc17c146bfd1bU,
+    (uint64_t)0x2f0a4c3cbf36a908U, (uint64_t)0x2ae9e34b58cf7838U, (uint64_t)0x45eb40ec0ccced58U,
+    (uint64_t)0x25cd4b9c0da44f98U, (uint64_t)0x43e06458871812c6U, (uint64_t)0x99f80d5516cef651U,
+    (uint64_t)0x571340c9ce6dc153U, (uint64_t)0x138d5117d8665521U, (uint64_t)0xacdb45bc4e07014dU,
+    (uint64_t)0x2f34bb3884b60b91U, (uint64_t)0x417499e84a34f239U, (uint64_t)0x15fdb83cb90402d5U,
+    (uint64_t)0xb75f46bf433aa832U, (uint64_t)0xb61e15af63215db1U, (uint64_t)0xaabe59d4a127f89aU,
+    (uint64_t)0x5d541e0c07e816daU, (uint64_t)0xaaba0659a618b692U, (uint64_t)0x5532773317266026U,
+    (uint64_t)0x8cda9cf2d0c05199U, (uint64_t)0x502fbc22fae78454U, (uint64_t)0xc0bda9dff572a182U,
+    (uint64_t)0x5f9b71b86158b372U, (uint64_t)0xe0f33a592b82dd07U, (uint64_t)0x763027359523032eU,
+    (uint64_t)0x7fe1a721c4505a32U, (uint64_t)0x7b6e3e82f796409fU, (uint64_t)0xe3417bc035d0b34aU,
+    (uint64_t)0x440b386b8327c0a7U, (uint64_t)0x8fb7262dac0362d1U, (uint64_t)0x2c41114ce0cdf943U,
+    (uint64_t)0x2ba5cef1ad95a0b1U, (uint64_t)0xc09b37a867d54362U, (uint64_t)0x26d6cdd201e486c9U,
+    (uint64_t)0x20477abf42ff9297U, (uint64_t)0xa004dcb3292a9287U, (uint64_t)0xddc15cf677b092c7U,
+    (uint64_t)0x083a8464806c0605U, (uint64_t)0x4a68df703db997b0U, (uint64_t)0x9c134e4505bf7dd0U,
+    (uint64_t)0xa4e63d398ccf7f8cU, (uint64_t)0xa6e6517f41b5f8afU, (uint64_t)0xaa8b9342ad7bc1ccU,
+    (uint64_t)0x126f35b51e706ad9U, (uint64_t)0xb99cebb4c3a9ebdfU, (uint64_t)0xa75389afbf608d90U,
+    (uint64_t)0x76113c4fc6c89858U, (uint64_t)0x80de8eb097e2b5aaU, (uint64_t)0x7e1022cc63b91304U,
+    (uint64_t)0x3bdab6056ccc066cU, (uint64_t)0x33cbb144b2edf900U, (uint64_t)0xc41764717af715d2U,
+    (uint64_t)0xe2f7f594d0134a96U, (uint64_t)0x2c1873efa41ec956U, (uint64_t)0xe4e7b4f677821304U,
+    (uint64_t)0xe5c8ff9788d5374aU, (uint64_t)0x2b915e6380823d5bU, (uint64_t)0xea6bc755b2ee8fe2U,
+    (uint64_t)0x6657624ce7112651U, (uint64_t)0x157af101dace5acaU, (uint64_t)0xc4fdbcf211a6a267U,
+    (uint64_t)0xdaddf340c49c8609U, (uint64_t)0x97e49f52e9604a65U, (uint64_t)0x9be8e790937e2ad5U,
+    (uint64_t)0x846e2508326e17f1U, (uint64_t)0x3f38007a0bbbc0dcU, (uint64_t)0xcf03603fb11e16d6U,
+    (uint64_t)0xd6f800e07442f1d5U, (uint64_t)0x475607d166e0e3abU, (uint64_t)0x82807f16b7c64047U,
+    (uint64_t)0x8858e1e3a749883dU, (uint64_t)0x5859120b8231ee10U, (uint64_t)0x1b80e7eb638a1eceU,
+    (uint64_t)0xcb72525ac6aa73a4U, (uint64_t)0xa7cdea3d844423acU, (uint64_t)0x5ed0c007f8ae7c38U,
+    (uint64_t)0x6db07a5c3d740192U, (uint64_t)0xbe5e9c2a5fe36db3U, (uint64_t)0xd5b9d57a76e95046U,
+    (uint64_t)0x54ac32e78eba20f2U, (uint64_t)0xef11ca8f71b9a352U, (uint64_t)0x305e373eff98a658U,
+    (uint64_t)0xffe5a100823eb667U, (uint64_t)0x57477b11e51732d2U, (uint64_t)0xdfd6eb282538fc0eU,
+    (uint64_t)0x5c43b0cc3b39eec5U, (uint64_t)0x6af12778cb36cc57U, (uint64_t)0x70b0852d06c425aeU,
+    (uint64_t)0x6df92f8c5c221b9bU, (uint64_t)0x6c8d4f9ece826d9cU, (uint64_t)0xf59aba7bb49359c3U,
+    (uint64_t)0xc37e2c2e421d3aa4U, (uint64_t)0xf926407ce84fa840U, (uint64_t)0x18abc03d1454e41cU,
+    (uint64_t)0x26605ecd3f7af644U, (uint64_t)0x242341a6d6a5eabfU, (uint64_t)0x1edb84f4216b668eU,
+    (uint64_t)0xd836edb804010102U, (uint64_t)0x5b337ce7945e1d8cU, (uint64_t)0x4c076b86d23ddc82U,
+    (uint64_t)0x03fd344c7e0143f0U, (uint64_t)0xa95362ff317af2c5U, (uint64_t)0x0add3db7e18b7a4fU,
+    (uint64_t)0x9c673e3f8260e01bU, (uint64_t)0xfbeb49e554a1cc91U, (uint64_t)0x91351bf292f2e433U,
+    (uint64_t)0xc755e7ec851141ebU, (uint64_t)0x349ae368da9f3804U, (uint64_t)0x470f07fea164349cU,
+    (uint64_t)0xd52f4cc98562baa5U, (uint64_t)0xc74a9e862b290df3U, (uint64_t)0xd3a1aa3543471a24U,
+    (uint64_t)0x239446beb8194511U, (uint64_t)0xbec2dd0081dcd44dU, (uint64_t)0xca3d7f0fc42ac82dU,
+    (uint64_t)0x2bf5db47f23206d5U, (uint64_t)0x2f6d34201d260152U, (uint64_t)0x17b876533f8ff89aU,
+    (uint64_t)0x5157c30c378fa458U, (uint64_t)0x7517c5c52d4fb936U, (uint64_t)0xef22f7ace6518cdcU,
+    (uint64_t)0xdeb483e6bf847a64U, (uint64_t)0xf508455892e0fa89U, (uint64_t)0xb418c2a69b583160U,
+    (uint64_t)0xbe74fcd4b4e59194U, (uint64_t)0xf178eeaa3c83e3ffU, (uint64_t)0xe051f895e296f29bU,
+    (uint64_t)0xd023523806ceb84aU, (uint64_t)0x5ace48cee111fe6bU, (uint64_t)0x40e43a491c045545U,
+    (uint64_t)0xf3fa86dddd522146U, (uint64_t)0x959616fa908ec5b5U, (uint64_t)0x882d661da01ab12dU,
+    (uint64_t)0xc49f60824382ae8aU, (uint64_t)0x5cdf92eb5d133f5eU, (uint64_t)0x98cecc425ef6c9c1U,
+    (uint64_t)0xb52d6682664d84eeU, (uint64_t)0x9e285ed86f25b8c4U, (uint64_t)0xeb80cdc748debe88U,
+    (uint64_t)0x2d9794c1ec222ba0U, (uint64_t)0xc3dff42f523e5d48U, (uint64_t)0x4a7cd5700fe4846bU,
+    (uint64_t)0xefc5b113ff135174U, (uint64_t)0x2630b25bc6b05e85U, (uint64_t)0x0a6d3029654cd077U,
+    (uint64_t)0xb4f1f54f32d8b89dU, (uint64_t)0xde3baff21627fc27U, (uint64_t)0xab9659d8df7304d4U,
+    (uint64_t)0xb71bcf1bff210e8eU, (uint64_t)0xa9a2438bd73fbd60U, (uint64_t)0x4595cd1f5d11b4deU,
+    (uint64_t)0x9c0d329a4835859dU, (uint64_t)0x4a0f0d2d7dbb6e56U, (uint64_t)0xc6038e5edf928a4eU,
+    (uint64_t)0xc94296218f5ad154U, (uint64_t)0x91213462f23f2d92U, (uint64_t)0x6cab71bd60b94078U,
+    (uint64_t)0x6bdd0a63176cde20U, (uint64_t)0x54c9b20cee4d54bcU, (uint64_t)0x3cd2d8aa9f2ac02fU,
+    (uint64_t)0x03f8e617206eedb0U, (uint64_t)0xc7f68e1693086434U, (uint64_t)0x831469c592dd3db9U,
+    (uint64_t)0x7aa7a1583ae9c1bdU, (uint64_t)0xe0af6d98e37ce240U, (uint64_t)0xe54342d928ab38b4U,
+    (uint64_t)0xe8b750070a1c98caU, (uint64_t)0xefce86afe02358f2U, (uint64_t)0x31b8b856ea921228U,
+    (uint64_t)0x052a19120a1c67fcU, (uint64_t)0xb4069ea4e3aead59U, (uint64_t)0x4a9090cde36d0757U,
+    (uint64_t)0xf722d7b1d9a29382U, (uint64_t)0xfb7fb04c04b48ddfU, (uint64_t)0x628ad2a7ebe16f43U,
+    (uint64_t)0xcd3fbfb520226040U, (uint64_t)0x6c34ecb15104b6c4U, (uint64_t)0x30c0754ec903c188U,
+    (uint64_t)0xec336b082d23cab0U, (uint64_t)0x9f51439e558df019U, (uint64_t)0x230da4baac712b27U,
+    (uint64_t)0x518919e355185a24U, (uint64_t)0x4dcefcdd84b78f50U, (uint64_t)0xa7d90fb2a47d4c5aU,
+    (uint64_t)0x55ac9abfb30e009eU, (uint64_t)0xfd2fc35974eed273U, (uint64_t)0xb72d824cdbea8fafU,
+    (uint64_t)0xd213f923cbb13d1bU, (uint64_t)0x98799f425bfb9bfeU, (uint64_t)0x1ae8ddc9701144a9U,
+    (uint64_t)0x0b8b3bb64c5595eeU, (uint64_t)0x0ea9ef2e3ecebb21U, (uint64_t)0x17cb6c4b3671f9a7U,
+    (uint64_t)0x47ef464f726f1d1fU, (uint64_t)0x171b94846943a276U, (uint64_t)0x779b8552de7e5c19U,
+    (uint64_t)0xfab28609c1c0256cU, (uint64_t)0x64f58eeeabd4743dU, (uint64_t)0x4e8ef8387b6cc93bU,
+    (uint64_t)0xee650d264cb1bf3dU, (uint64_t)0x4c1f9d0973dedf61U, (uint64_t)0xaef7c9d7bfb70cedU,
+    (uint64_t)0x1ec0507e1641de1eU, (uint64_t)0xc9941109a607419dU, (uint64_t)0xfaa71e62bb6bca80U,
+    (uint64_t)0x34158c1307c431f3U, (uint64_t)0x594abebc992bc47aU, (uint64_t)0x6dfea691eb78399fU,
+    (uint64_t)0x48aafb353f42cba4U, (uint64_t)0xedcd65af077c04f0U, (uint64_t)0x1a29a366e884491aU,
+    (uint64_t)0x549db2b5ef7d9289U, (uint64_t)0x2480d4a8197f015aU, (uint64_t)0x61d5590bc40493b6U,
+    (uint64_t)0x3a55b52e6f780331U, (uint64_t)0x40eb8115309eadb0U, (uint64_t)0xdea7de5a92e5c625U,
+    (uint64_t)0x64d631f0cc6a3d5aU, (uint64_t)0x9d5e9d7c93e8dd61U, (uint64_t)0x196860411e84e0e5U,
+    (uint64_t)0xa5db84d3aea34c93U, (uint64_t)0xf9d5bb197073a732U, (uint64_t)0xb8d2fe566bcfd7c0U,
+    (uint64_t)0x45775f36f3eb82faU, (uint64_t)0x8cb20cccfdff8b58U, (uint64_t)0x1659b65f8374c110U,
+    (uint64_t)0xb8b4a422330c789aU, (uint64_t)0xc4f4cda3af2ebc2fU, (uint64_t)0xa0af843dcb4efe24U,
+    (uint64_t)0x53b857c19ccd10b1U, (uint64_t)0xddc9d1eb914d3e04U, (uint64_t)0x7bdec8bb62771debU,
+    (uint64_t)0x829277aa91c5aa81U, (uint64_t)0x7af18dd6832391aeU, (uint64_t)0x1740f316c71a84caU,
+    (uint64_t)0x2d500910cab91f1eU, (uint64_t)0xbedd9e444d1cd216U, (uint64_t)0xd634b74fedd02252U,
+    (uint64_t)0xbd60f8e11258617aU, (uint64_t)0xd8c7537b9e05614aU, (uint64_t)0xfd26c766e7af5fc5U,
+    (uint64_t)0x0660b581582bd926U, (uint64_t)0x87019244acf07fc8U, (uint64_t)0x8928e99aeeaf8c49U,
+    (uint64_t)0xee7aa73d6e24d728U, (uint64_t)0x4c5007c2e72b156cU, (uint64_t)0x5fcf57c5ed408a1dU,
+    (uint64_t)0x9f719e39b6057604U, (uint64_t)0x7d343c01c2868bbfU, (uint64_t)0x2cca254b7e103e2dU,
+    (uint64_t)0xe6eb38a9f131bea2U, (uint64_t)0x0ba4e3520a981b0dU, (uint64_t)0x1c354cb3bd1a41a4U,
+    (uint64_t)0x1aabaa3adf9fab9cU, (uint64_t)0x0701a7d153c418d5U, (uint64_t)0xdd1a7cefdcf2b921U,
+    (uint64_t)0x6ceef0b3bcf48061U, (uint64_t)0x1083b598de25cce6U, (uint64_t)0x890a54c7e90a5e34U,
+    (uint64_t)0x405718db4f6d01b1U, (uint64_t)0xe73c6bc28f11e8a0U, (uint64_t)0xac11bb8ca0591a3bU,
+    (uint64_t)0x12d09a5a0acc4531U, (uint64_t)0xcbf174eee7de13f4U, (uint64_t)0x177e2be6044fd682U,
+    (uint64_t)0x65f574cb1c48af70U, (uint64_t)0xce5966929961cb7cU, (uint64_t)0xc59eed6c048752a1U,
+    (uint64_t)0x41f2702ea01341b4U, (uint64_t)0x6e35903b9dc6b092U, (uint64_t)0x4291aba81f5b5b23U,
+    (uint64_t)0x8173aa70a653d61dU, (uint64_t)0xd1b648d44f2eb51eU, (uint64_t)0x31b7ce065ab93f8fU,
+    (uint64_t)0xa55408ee99e2f4feU, (uint64_t)0xb33e624f8be762b4U, (uint64_t)0x2a9ee4d1058e3413U,
+    (uint64_t)0x968e636967d805faU, (uint64_t)0x9848949b7db8bfd7U, (uint64_t)0x5308d7e5d23a8417U,
+    (uint64_t)0x892f3b1df3e29da5U, (uint64_t)0xc95c139e3dee471fU, (uint64_t)0x8631594dd757e089U,
+    (uint64_t)0x1083e2ea1f095615U, (uint64_t)0x0a28ad7714e68c33U, (uint64_t)0x6bfc02523d8818beU,
+    (uint64_t)0xb585113af35850cdU, (uint64_t)0x7d935f0b30df8aa1U, (uint64_t)0xaddda07c4ab7e3acU,
+    (uint64_t)0x92c34299552f00cbU, (uint64_t)0xc33ed1de2909df6cU, (uint64_t)0x2dc40d483e07113cU,
+    (uint64_t)0x6e4a5d397d8b63aeU, (uint64_t)0x5582a94b79684c2bU, (uint64_t)0x932b33d4622da26cU,
+    (uint64_t)0xf534f6510dbbf08dU, (uint64_t)0x211d07c964c23a52U, (uint64_t)0x0eeece0fee5bdc9bU,
+    (uint64_t)0xdf178168f7015558U, (uint64_t)0xabe7905a83cdd60eU, (uint64_t)0x50602fb5a1170184U,
+    (uint64_t)0x689886cdb023642aU, (uint64_t)0xd568d090a6e1fb00U, (uint64_t)0x5b1922c70259217fU,
+    (uint64_t)0x93831cd9c43141e4U, (uint64_t)0xdfca35870c95f86eU, (uint64_t)0xdec2057a568ae828U,
+    (uint64_t)0x568f8925913cc16dU, (uint64_t)0x18bc5b6de1a26f5aU, (uint64_t)0xdfa413bef5f499aeU,
+    (uint64_t)0xf8835decc3f0ae84U, (uint64_t)0xb6e60bd865a40ab0U, (uint64_t)0x65596439194b377eU,
+    (uint64_t)0xbcd8562592084a69U, (uint64_t)0x5ce433b94f23ede0U, (uint64_t)0x860d523d42e06189U,
+    (uint64_t)0xbf0779414e3aff13U, (uint64_t)0x0b616dcac1b20650U, (uint64_t)0xe66dd6d12131300dU,
+    (uint64_t)0xd4a0fd67ff99abdeU, (uint64_t)0xc9903550c7aac50dU, (uint64_t)0x022ecf8b7c46b2d7U,
+    (uint64_t)0x3333b1e83abf92afU, (uint64_t)0xc0da65e784d6365dU, (uint64_t)0xbcb7443f8f759fb8U,
+    (uint64_t)0x35c712b17ae81930U, (uint64_t)0x80428dff4c6e08abU, (uint64_t)0xf19dafefa4faf843U,
+    (uint64_t)0xced8538dffa9855fU, (uint64_t)0x20ac409cbe3ac7ceU, (uint64_t)0x358c1fb6882da71eU,
+    (uint64_t)0xefecdef7be42a582U, (uint64_t)0xd3fc608065046be6U, (uint64_t)0xc9af13c809e8dba9U,
+    (uint64_t)0x1e6c9847641491ffU, (uint64_t)0x3b574925d30c31f7U, (uint64_t)0xb7eb72baac2a2122U,
+    (uint64_t)0x776a0dacef0859e7U, (uint64_t)0x06fec31421900942U, (uint64_t)0x324794b07e50122bU,
+    (uint64_t)0xdd744f8b4af07ca5U, (uint64_t)0x30a12f08d63fc97bU, (uint64_t)0x39650f1a76626d9dU,
+    (uint64_t)0x101b47f71fa38477U, (uint64_t)0x3d815f19d4dc124fU, (uint64_t)0x1569ae95b26eb58aU,
+    (uint64_t)0xc3cde18895fb1887U, (uint64_t)0x02b37a952f41deffU, (uint64_t)0x0e44a59ae63b89b7U,
+    (uint64_t)0x673257dc143ff951U, (uint64_t)0x19c02205d752baf4U, (uint64_t)0x46c23069c4b7d692U,
+    (uint64_t)0x2e6392c3fd1502acU, (uint64_t)0x6057b1a21b220846U, (uint64_t)0xe51ff9460c1b5b63U,
+    (uint64_t)0x6e85cb51566c5c43U, (uint64_t)0xcff9c9193597f046U, (uint64_t)0x9354e90c4994d94aU,
+    (uint64_t)0xe0a393322147927dU, (uint64_t)0x8427fac10dc1eb2bU, (uint64_t)0x88cfd8c22ff319faU,
+    (uint64_t)0xe2d4e68401965274U, (uint64_t)0xfa2e067d67aaa746U, (uint64_t)0xb9dc857c5b0f7bd4U,
+    (uint64_t)0x6990c2c9108ea1cdU, (uint64_t)0x84730b83b984c7a9U, (uint64_t)0x552723d2eab18a78U,
+    (uint64_t)0x9752c2e2919ba0f9U, (uint64_t)0x075a3bd94bf40890U, (uint64_t)0x71e52a04a6d98212U,
+    (uint64_t)0x3fb6607a9f18a4c8U, (uint64_t)0xb6d92a7f3e5f9f11U, (uint64_t)0x9afe153ad6cb3b8eU,
+    (uint64_t)0x4d1a6dd7ddf800bdU, (uint64_t)0xf6c13cc0caf17e19U, (uint64_t)0x15f6c58e325fc3eeU,
+    (uint64_t)0x71095400a31dc3b2U, (uint64_t)0x168e7c07afa3d3e7U, (uint64_t)0x3f8417a194c7ae2dU,
+    (uint64_t)0xf47b75216ce400bbU, (uint64_t)0xf72919f7caf07d99U, (uint64_t)0x95b86e0600ce62e0U,
+    (uint64_t)0x11872baf8fcfd00eU, (uint64_t)0x049b21eb211f7dc6U, (uint64_t)0xb8900e5654ebd6f6U,
+    (uint64_t)0x7c38cea4162d78daU, (uint64_t)0x9a586c9e0bfa3da0U, (uint64_t)0xec234772813b230dU,
+    (uint64_t)0x634d0f5f17344427U, (uint64_t)0x11548ab1d77fc56aU, (uint64_t)0x7fab1750ce06af77U,
+    (uint64_t)0xb62c10a74f7c4f83U, (uint64_t)0xa7d2edc4220a67d9U, (uint64_t)0x1c404170921209a0U,
+    (uint64_t)0x0b9815a0face59f0U, (uint64_t)0xad3883e151c3ebe5U, (uint64_t)0xdb14d5c7d25d7be8U,
+    (uint64_t)0x23e44911558ea8c9U, (uint64_t)0x3a68529f3f45c6abU, (uint64_t)0xeb18a1dc149f75b8U,
+    (uint64_t)0x9b8946a1079c7cb2U, (uint64_t)0x27ad2a191157a94eU, (uint64_t)0x84b14f461106f85aU,
+    (uint64_t)0x2842589b319540c3U, (uint64_t)0x18490f59a283d6f8U, (uint64_t)0xa2731f84daae9fcbU,
+    (uint64_t)0x3db6d960c3683ba0U, (uint64_t)0xc85c63bb14611069U, (uint64_t)0xb19436af0788bf05U,
+    (uint64_t)0x905459df347460d2U, (uint64_t)0x73f6e094e11a7db1U, (uint64_t)0xf306a3c8ee3c76cbU,
+    (uint64_t)0x3cf11623d32a1f6eU, (uint64_t)0xe6d5ab646863e956U, (uint64_t)0x3b8a4cbe5c005c26U,
+    (uint64_t)0xdcd529a59ce6bb27U, (uint64_t)0xc4afaa5204d4b16fU, (uint64_t)0xb0624a267923798dU,
+    (uint64_t)0x85e56df66b307fabU, (uint64_t)0xb2330fef4e4ca463U, (uint64_t)0xbcef72873566cc63U,
+    (uint64_t)0xd161d2cacf780900U, (uint64_t)0x135dc5395b54827dU, (uint64_t)0x638f052e27bf1bc6U,
+    (uint64_t)0x10a224f007dfa06cU, (uint64_t)0xe973586d6d3321daU, (uint64_t)0x8b0c573826152c8fU,
+    (uint64_t)0x896895959884aaf7U, (uint64_t)0xb1959be307b348a6U, (uint64_t)0x96250e573c147c87U,
+    (uint64_t)0xae0efb3add0c61f8U, (uint64_t)0xed00745eca8c325eU, (uint64_t)0x3c911696ecff3f70U,
+    (uint64_t)0x73acbc65319ad41dU, (uint64_t)0x7b01a020f0b1c7efU, (uint64_t)0x9910ba6b23a5d896U,
+    (uint64_t)0x1fe19e357fe4364eU, (uint64_t)0x6e1da8c39a33c677U, (uint64_t)0x15b4488b29fd9fd0U,
+    (uint64_t)0x1f4392541a1f22bfU, (uint64_t)0x920a8a70ab8163e8U, (uint64_t)0x3fd1b24907e5658eU,
+    (uint64_t)0xf2c4f79cb6ec839bU, (uint64_t)0x262143b5224c08dcU, (uint64_t)0x2bbb09b481b50c91U,
+    (uint64_t)0xc16ed709aca8c84fU, (uint64_t)0xa6210d9db2850ca8U, (uint64_t)0x6d8df67a09cb54d6U,
+    (uint64_t)0x91eef6e0500919a4U, (uint64_t)0x90f613810f132857U, (uint64_t)0x9acede47f8d5028bU,
+    (uint64_t)0x84cea0691416a6a5U, (uint64_t)0x8f860c7943ef881cU, (uint64_t)0x41311f8a38038a5dU,
+    (uint64_t)0xe78c2ec0fc612067U, (uint64_t)0x494d2e815ad73581U, (uint64_t)0xb4cc9e0059604097U,
+    (uint64_t)0xff558aecf3612cbaU, (uint64_t)0x35beef7a9e36c39eU, (uint64_t)0x45e21446de673629U,
+    (uint64_t)0x57f7aa1e703c2d21U, (uint64_t)0xa0e99b7f98c868c7U, (uint64_t)0x4e42f66d8b641676U,
+    (uint64_t)0x602884dc91077896U, (uint64_t)0xa0d690cfc2c9885bU, (uint64_t)0xfeb4da333b9a5187U,
+    (uint64_t)0x5f789598153c87eeU, (uint64_t)0x8b5c619c76497ee8U, (uint64_t)0x5d2b0ac6c717370eU,
+    (uint64_t)0x98204cb64fcf68e1U, (uint64_t)0x0bdec21162bc6792U, (uint64_t)0x6973ccefa63b1011U,
+    (uint64_t)0xf9e3fa97e0de1ac5U, (uint64_t)0x5efb693e3d0e0c8bU, (uint64_t)0x037248e9d2d4fcb4U,
+    (uint64_t)0x80802dc91ec34f9eU, (uint64_t)0xd8772d3533810603U, (uint64_t)0x3f06d66c530cb4f3U,
+    (uint64_t)0x7be5ed0dc475c129U, (uint64_t)0xcb9e3c1931e82b10U, (uint64_t)0xc63d2857c9ff6b4cU,
+    (uint64_t)0xb92118c692a1b45eU, (uint64_t)0x0aec44147285bbcaU, (uint64_t)0xfc189ae71e29a3efU,
+    (uint64_t)0xcbe906f04c93302eU, (uint64_t)0xd0107914ceaae10eU, (uint64_t)0xb7a23f34b68e19f8U,
+    (uint64_t)0xe9d875c2efd2119dU, (uint64_t)0x03198c6efcadc9c8U, (uint64_t)0x65591bf64da17113U,
+    (uint64_t)0x3cf0bbf83d443038U, (uint64_t)0xae485bb72b724759U, (uint64_t)0x945353e1b2d4c63aU,
+    (uint64_t)0x82159d07de7d6f2cU, (uint64_t)0x389caef34ec5b109U, (uint64_t)0x4a8ebb53db65ef14U,
+    (uint64_t)0x2dc2cb7edd99de43U, (uint64_t)0x816fa3ed83f2405fU, (uint64_t)0x73429bb9c14208a3U,
+    (uint64_t)0xb618d590b01e6e27U, (uint64_t)0x047e2ccde180b2dcU, (uint64_t)0xd1b299b504aea4a9U,
+    (uint64_t)0x412c9e1e9fa403a4U, (uint64_t)0x88d28a3679407552U, (uint64_t)0x49c50136f332b8e3U,
+    (uint64_t)0x3a1b6fcce668de19U, (uint64_t)0x178851bc75122b97U, (uint64_t)0xb1e13752fb85fa4cU,
+    (uint64_t)0xd61257ce383c8ce9U, (uint64_t)0xd43da670d2f74daeU, (uint64_t)0xa35aa23fbf846bbbU,
+    (uint64_t)0x5e74235d4421fc83U, (uint64_t)0xf6df8ee0c363473bU, (uint64_t)0x34d7f52a3c4aa158U,
+    (uint64_t)0x50d05aab9bc6d22eU, (uint64_t)0x8c56e735a64785f4U, (uint64_t)0xbc56637b5f29cd07U,
+    (uint64_t)0x53b2bb803ee35067U, (uint64_t)0x50235a0fdc919270U, (uint64_t)0x191ab6d8f2c4aa65U,
+    (uint64_t)0xc34758318396023bU, (uint64_t)0x80400ba5f0f805baU, (uint64_t)0x8881065b5ec0f80fU,
+    (uint64_t)0xc370e522cc1b5e83U, (uint64_t)0xde2d4ad1860b8bfbU, (uint64_t)0xad364df067b256dfU,
+    (uint64_t)0x8f12502ee0138997U, (uint64_t)0x503fa0dc7783920aU, (uint64_t)0xe80014adc0bc866aU,
+    (uint64_t)0x3f89b744d3064ba6U, (uint64_t)0x03511dcdcba5dba5U, (uint64_t)0x197dd46d95a7b1a2U,
+    (uint64_t)0x9c4e7ad63c6341fbU, (uint64_t)0x426eca29484c2eceU, (uint64_t)0x9211e489de7f4f8aU,
+    (uint64_t)0x14997f6ec78ef1f4U, (uint64_t)0x2b2c091006574586U, (uint64_t)0x17286a6e1c3eede8U,
+    (uint64_t)0x25f92e470f60e018U, (uint64_t)0xb4e370af3aeac968U, (uint64_t)0xe4f7fee9c4b63266U,
+    (uint64_t)0xb4acd4c2e3ac5664U, (uint64_t)0xf8910bd2ceb38cbfU, (uint64_t)0x1c3ae50cc9c0726eU,
+    (uint64_t)0x15309569d97b40bfU, (uint64_t)0x70884b7ffd5a5a1bU, (uint64_t)0x3890896aef8314cdU,
+    (uint64_t)0x5ced3c9f82e4c634U, (uint64_t)0x8efb83143a4464f8U, (uint64_t)0xe706381b7a1dca25U,
+    (uint64_t)0x6cd15a3c5a2a412bU, (uint64_t)0x9347a8fdbfcd8fb5U, (uint64_t)0x31db2eef6e54cd22U,
+    (uint64_t)0xc4aeb11ef8d8932fU, (uint64_t)0x11e7c1ed344411afU, (uint64_t)0x996884f5903fa271U,
+    (uint64_t)0xe6da0fd2b9da921eU, (uint64_t)0xa6f2f2695db01e54U, (uint64_t)0x1ee3e9bd6876214eU,
+    (uint64_t)0xa26e181ce27a9497U, (uint64_t)0x36d254e48e215e04U, (uint64_t)0x42f32a6c252cabcaU,
+    (uint64_t)0x9948148780b57614U, (uint64_t)0xab41b43a43228d83U, (uint64_t)0x24ae1c304ad63f99U,
+    (uint64_t)0x8e525f1a46a51229U, (uint64_t)0x14af860fcd26d2b4U, (uint64_t)0xd6baef613f714aa1U,
+    (uint64_t)0xf51865adeb78795eU, (uint64_t)0xd3e21fcee6a9d694U, (uint64_t)0x82ceb1dd8a37b527U,
+    (uint64_t)0x4a665bfd2f9fd51aU, (uint64_t)0x7f2f1fe2481b97f7U, (uint64_t)0xcad05d69ad36ce50U,
+    (uint64_t)0x314fc2a4844f4dedU, (uint64_t)0xd5593d8cb55fc5c6U, (uint64_t)0xe3510ce8bfb1e23dU,
+    (uint64_t)0xf9b7be6937453cceU, (uint64_t)0xd3541b7969fae631U, (uint64_t)0x99296525eca445dfU,
+    (uint64_t)0xf1af24f22cdfa4c6U, (uint64_t)0xf5b4eb61eba6d3bcU, (uint64_t)0x4560910c98972cc7U,
+    (uint64_t)0x54751c32093eaa32U, (uint64_t)0x018313497d3c67bbU, (uint64_t)0x3bd90ce62d871110U,
+    (uint64_t)0x75fc863a538baa7eU, (uint64_t)0x711b8a4176a9f05dU, (uint64_t)0x06ca4e4b9011d488U,
+    (uint64_t)0x543bc62ba248a65eU, (uint64_t)0x017535ffc9290894U, (uint64_t)0x840b84ce406851d7U,
+    (uint64_t)0xafa3acdf90e960b4U, (uint64_t)0xac3394af7128fd34U, (uint64_t)0x54eb4d5b2ac0f92cU,
+    (uint64_t)0xdb09e87355dbd4b3U, (uint64_t)0x1f8799286639bbb1U, (uint64_t)0xb83e47e51c651962U,
+    (uint64_t)0xd4ef0fb6c43fb574U, (uint64_t)0x27d3b9d8f1bfb12aU, (uint64_t)0x6ab877e86e5e8b72U,
+    (uint64_t)0x8eebdc9d157b9014U, (uint64_t)0x4c2110053aa5cb64U
+  };
+
+/*
+  [2j + 1]G for j = 0..31, the odd multiples used by the width-7 NAF in
+  verification, in the same format.
+*/
+static const
+uint64_t
+Hacl_P256_PrecompTable_precomp_basepoint_table_odd_w7[256U] =
+  {
+    (uint64_t)0x79e730d418a9143cU, (uint64_t)0x75ba95fc5fedb601U, (uint64_t)0x79fb732b77622510U,
+    (uint64_t)0x18905f76a53755c6U, (uint64_t)0xddf25357ce95560aU, (uint64_t)0x8b4ab8e4ba19e45cU,
+    (uint64_t)0xd2e88688dd21f325U, (uint64_t)0x8571ff1825885d85U, (uint64_t)0xffac3f904eebc127U,
+    (uint64_t)0xb027f84a087d81fbU, (uint64_t)0x66ad77dd87cbbc98U, (uint64_t)0x26936a3fb6ff747eU,
+    (uint64_t)0xb04c5c1fc983a7ebU, (uint64_t)0x583e47ad0861fe1aU, (uint64_t)0x788208311a2ee98eU,
+    (uint64_t)0xd5f06a29e587cc07U, (uint64_t)0xbe1b8aaec45c61f5U, (uint64_t)0x90ec649a94b9537dU,
+    (uint64_t)0x941cb5aad076c20cU, (uint64_t)0xc9079605890523c8U, (uint64_t)0xeb309b4ae7ba4f10U,
+    (uint64_t)0x73c568efe5eb882bU, (uint64_t)0x3540a9877e7a1f68U, (uint64_t)0x73a076bb2dd1e916U,
+    (uint64_t)0x0746354ea0173b4fU, (uint64_t)0x2bd20213d23c00f7U, (uint64_t)0xf43eaab50c23bb08U,
+    (uint64_t)0x13ba5119c3123e03U, (uint64_t)0x2847d0303f5b9d4dU, (uint64_t)0x6742f2f25da67bddU,
+    (uint64_t)0xef933bdc77c94195U, (uint64_t)0xeaedd9156e240867U, (uint64_t)0x75c96e8f264e20e8U,
+    (uint64_t)0xabe6bfed59a7a841U, (uint64_t)0x2cc09c0444c8eb00U, (uint64_t)0xe05b3080f0c4e16bU,
+    (uint64_t)0x1eb7777aa45f3314U, (uint64_t)0x56af7bedce5d45e3U, (uint64_t)0x2b6e019a88b12f1aU,
+    (uint64_t)0x086659cdfd835f9bU, (uint64_t)0xea7d260a6245e404U, (uint64_t)0x9de407956e7fdfe0U,
+    (uint64_t)0x1ff3a4158dac1ab5U, (uint64_t)0x3e7090f1649c9073U, (uint64_t)0x1a7685612b944e88U,
+    (uint64_t)0x250f939ee57f61c8U, (uint64_t)0x0c0daa891ead643dU, (uint64_t)0x68930023e125b88eU,
+    (uint64_t)0xccc425634b2ed709U, (uint64_t)0x0e356769856fd30dU, (uint64_t)0xbcbcd43f559e9811U,
+    (uint64_t)0x738477ac5395b759U, (uint64_t)0x35752b90c00ee17fU, (uint64_t)0x68748390742ed2e3U,
+    (uint64_t)0x7cd06422bd1f5bc1U, (uint64_t)0xfbc08769c9e7b797U, (uint64_t)0x72bcd8b7bc60055bU,
+    (uint64_t)0x03cc23ee56e27e4bU, (uint64_t)0xee337424e4819370U, (uint64_t)0xe2aa0e430ad3da09U,
+    (uint64_t)0x40b8524f6383c45dU, (uint64_t)0xd766355442a41b25U, (uint64_t)0x64efa6de778a4797U,
+    (uint64_t)0x2042170a7079adf4U, (uint64_t)0x97091dcbd53c5c9dU, (uint64_t)0xf17624b6ac0a177bU,
+    (uint64_t)0xb0f139752cfe2dffU, (uint64_t)0xc1a35c0a6c7a574eU, (uint64_t)0x227d314693e79987U,
+    (uint64_t)0x0575bf30e89cb80eU, (uint64_t)0x2f4e247f0d1883bbU, (uint64_t)0xebd512263274c3d0U,
+    (uint64_t)0xfea912baa5659ae8U, (uint64_t)0x68363aba25e1a16eU, (uint64_t)0xb8842277752c41acU,
+    (uint64_t)0xfe545c282897c3fcU, (uint64_t)0x2d36e9e7dc4c696bU, (uint64_t)0x5806244afba977c5U,
+    (uint64_t)0x85665e9be39508c1U, (uint64_t)0xf720ee256d12597bU, (uint64_t)0x562e4cecc135b208U,
+    (uint64_t)0x74e1b2654783f47dU, (uint64_t)0x6d2a506c5a3f3b30U, (uint64_t)0xecead9f4c16762fcU,
+    (uint64_t)0xf29dd4b2e286e5b9U, (uint64_t)0x1b0fadc083bb3c61U, (uint64_t)0x7a75023e7fac29a4U,
+    (uint64_t)0xc086d5f1c9477fa3U, (uint64_t)0xf4f876532de45068U, (uint64_t)0x37c7a7e89e2e1f6eU,
+    (uint64_t)0xd0825fa2a3584069U, (uint64_t)0xaf2cea7c1727bf42U, (uint64_t)0x0360a4fb9e4785a9U,
+    (uint64_t)0xe5fda49c27299f4aU, (uint64_t)0x48068e1371ac2f71U, (uint64_t)0x83d0687b9077666fU,
+    (uint64_t)0xa4a319acd837879fU, (uint64_t)0x6fc1b49eed6b67b0U, (uint64_t)0xe395993332f1f3afU,
+    (uint64_t)0x966742eb65432a2eU, (uint64_t)0x4b8dc9feb4966228U, (uint64_t)0x96cc631243f43950U,
+    (uint64_t)0x12068859c9b731eeU, (uint64_t)0x7b948dc356f79968U, (uint64_t)0x042c2af497e2feb4U,
+    (uint64_t)0xd36a42d7aebf7313U, (uint64_t)0x49d2c9eb084ffdd7U, (uint64_t)0x9f8aa54b2ef7c76aU,
+    (uint64_t)0x9200b7ba09895e70U, (uint64_t)0x3bd0c66fddb7fb58U, (uint64_t)0x2d97d10878eb4cbbU,
+    (uint64_t)0x2d431068d84bde31U, (uint64_t)0x5e5db46acb66e132U, (uint64_t)0xf1be963a0d925880U,
+    (uint64_t)0x944a70270317b9e2U, (uint64_t)0xe266f95948603d48U, (uint64_t)0x98db66735c208899U,
+    (uint64_t)0x90472447a2fb18a3U, (uint64_t)0x8a966939777c619fU, (uint64_t)0x3798142a2a3be21bU,
+    (uint64_t)0xe2f73c696755ff89U, (uint64_t)0xdd3cf7e7473017e6U, (uint64_t)0x8ef5689d3cf7600dU,
+    (uint64_t)0x948dc4f8b1fc87b4U, (uint64_t)0xd9e9fe814ea53299U, (uint64_t)0x2d921ca298eb6028U,
+    (uint64_t)0xfaecedfd0c9803fcU, (uint64_t)0xf38ae8914d7b4745U, (uint64_t)0x871514560f664534U,
+    (uint64_t)0x85ceae7c4b68f103U, (uint64_t)0xac09c4ae65578ab9U, (uint64_t)0x33ec6868f044b10cU,
+    (uint64_t)0x6ac4832b3a8ec1f1U, (uint64_t)0x5509d1285847d5efU, (uint64_t)0xf909604f763f1574U,
+    (uint64_t)0xb16c4303c32f63c4U, (uint64_t)0xfd16847fdec67ef5U, (uint64_t)0x742ee464233e76b7U,
+    (uint64_t)0x0b8e4134efc2b4c8U, (uint64_t)0xca640b8642a3e521U, (uint64_t)0x653a01908ceb6aa9U,
+    (uint64_t)0x313c300c547852d5U, (uint64_t)0x24e4ab126b237af7U, (uint64_t)0x2ba901628bb47af8U,
+    (uint64_t)0x00467bc58cce08b5U, (uint64_t)0xb636458c7f178d55U, (uint64_t)0xc5748baea677d806U,
+    (uint64_t)0x2763a387dfa394ebU, (uint64_t)0xa12b448a7d3cebb6U, (uint64_t)0xe7adda3e6f20d850U,
+    (uint64_t)0xf63ebce51558462cU, (uint64_t)0x58b36143620088a8U, (uint64_t)0xa9d89488a059c142U,
+    (uint64_t)0x6f5ae714ff0b9346U, (uint64_t)0x068f237d16fb3664U, (uint64_t)0x5853e4c4363186acU,
+    (uint64_t)0xe2d87d2363c52f98U, (uint64_t)0x2ec4a76681828876U, (uint64_t)0x47b864fae14e7b1cU,
+    (uint64_t)0x0c0bc0e569192408U, (uint64_t)0x624d60492ed22e91U, (uint64_t)0x6fdfe0b56f072822U,
+    (uint64_t)0xeeca111539ce2271U, (uint64_t)0x98100a4fdb01614fU, (uint64_t)0xb6b0daa2a35c628fU,
+    (uint64_t)0xb6f94d2ec87e9a47U, (uint64_t)0xc67732591d57d9ceU, (uint64_t)0xf70bfeec03884a7bU,
+    (uint64_t)0x4ff23ffd248a7d06U, (uint64_t)0x80c5bfb4878873faU, (uint64_t)0xb7d9ad9005745981U,
+    (uint64_t)0x179c85db3db01994U, (uint64_t)0xba41b06261a6966cU, (uint64_t)0x4d82d052eadce5a8U,
+    (uint64_t)0x9e91cd3ba5e6a318U, (uint64_t)0x47795f4f95b2dda0U, (uint64_t)0x1ee426ccd5cd79bfU,
+    (uint64_t)0x0032940b946c6e18U, (uint64_t)0x1b1e8ae057477f58U, (uint64_t)0xe94f7d346d823278U,
+    (uint64_t)0xc747cb96782ba21aU, (uint64_t)0xc5254469f72b33a5U, (uint64_t)0x772ef6dec7f80c81U,
+    (uint64_t)0xd73acbfe2cd9e6b5U, (uint64_t)0x283c7513caa76097U, (uint64_t)0x0a624fa936c83906U,
+    (uint64_t)0x6b20afec715af2c7U, (uint64_t)0x4b969974eba78bfdU, (uint64_t)0x220755ccd921d60eU,
+    (uint64_t)0x9b944e107baeca13U, (uint64_t)0x04819d515ded93d4U, (uint64_t)0x9bbff86e6dddfd27U,
+    (uint64_t)0x21950b421ff6acd3U, (uint64_t)0xffe7048453dc6909U, (uint64_t)0xff4cd0b228766127U,
+    (uint64_t)0xabdbe6084fb7db2bU, (uint64_t)0x837c92285e1109e8U, (uint64_t)0x26147d27f4645b5aU,
+    (uint64_t)0x4d78f592f7818ed8U, (uint64_t)0xd394077ef247fa36U, (uint64_t)0x508cec1c3b3f64c9U,
+    (uint64_t)0xe20bc0ba1e5edf3fU, (uint64_t)0xda1deb852f4318d4U, (uint64_t)0xd20ebe0d5c3fa443U,
+    (uint64_t)0x370b4ea773241ea3U, (uint64_t)0x61f1511c5e1a5f65U, (uint64_t)0x99a5e23d82681c62U,
+    (uint64_t)0xd731e383a2f54c2dU, (uint64_t)0x97359638546c4d8dU, (uint64_t)0x5f9c3fc492f24679U,
+    (uint64_t)0x912e8beda8c8acd9U, (uint64_t)0xec3a318d306634b0U, (uint64_t)0x80167f41c31cb264U,
+    (uint64_t)0x3db82f6f522113f2U, (uint64_t)0xb155bcd2dcafe197U, (uint64_t)0xfba1da5943465283U,
+    (uint64_t)0x258bbbf9e7305683U, (uint64_t)0x31eea5bf07ef5be6U, (uint64_t)0x0deb0e4a46c814c1U,
+    (uint64_t)0x5cee8449a7b730ddU, (uint64_t)0xeab495c5a0182bdeU, (uint64_t)0xee759f879e27a6b4U,
+    (uint64_t)0xc2cf6a6880e518caU, (uint64_t)0x25e8013ff14cf3f4U, (uint64_t)0x3ec832e77acaca28U,
+    (uint64_t)0x1bfeea57c7385b29U, (uint64_t)0x068212e3fd1eaf38U, (uint64_t)0xc13298306acf8cccU,
+    (uint64_t)0xb909f2db2aac9e59U, (uint64_t)0x5748060db661782aU, (uint64_t)0xc5ab2632c79b7a01U,
+    (uint64_t)0xda44c6c600017626U, (uint64_t)0x69d44ed65c46aa8eU, (uint64_t)0x2100d5d3a8d063d1U,
+    (uint64_t)0xcb9727eaa2d17c36U, (uint64_t)0x4c2bab1b8add53b7U, (uint64_t)0xa084e90c15426704U,
+    (uint64_t)0x778afcd3a837ebeaU, (uint64_t)0x6651f7017ce477f8U, (uint64_t)0xa062499846fb7a8bU,
+    (uint64_t)0x3667eb1a7f4c04ccU, (uint64_t)0x59556621a9404f84U, (uint64_t)0x71cdf6537eceb50aU,
+    (uint64_t)0x994a44a69b8335faU, (uint64_t)0xd7faf819dbeb9b69U, (uint64_t)0x473c5680eed4350dU,
+    (uint64_t)0xb6658466da44bba2U, (uint64_t)0x0d1bc780872bdbf3U, (uint64_t)0xb8d3d9319ff91fe5U,
+    (uint64_t)0x039c4800f0518eedU, (uint64_t)0x95c376329182cb26U, (uint64_t)0x0763a43482fc568dU,
+    (uint64_t)0x707c04d5383e76baU, (uint64_t)0xac98b930824e8197U, (uint64_t)0x92bf7c8f91230de0U,
+    (uint64_t)0x90876a0140959b70U
+  };
+
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_P256_PrecompTable_H_DEFINED
+#endif
@@ -0,0 +1,335 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_Poly1305_512.h"
+
+/*
+  Eight-lane Poly1305 over 5 x 26-bit limbs. The context holds, as vec512:
+  acc[5] | r[5] | r5[5] | r8[5] | r8_5[5] | rp[5] | rp_5[5]
+  where r8 = r^8 in every lane and rp holds, in lane j, the power of r that the
+  j-th lane of the last group of eight blocks must be multiplied by. Between
+  calls, the accumulator lives in lane 0, all other lanes being zero.
+*/
+
+static inline void
+fmul_r_512(Lib_IntVector_Intrinsics_vec512 *out, Lib_IntVector_Intrinsics_vec512 *f1, Lib_IntVector_Intrinsics_vec512 *r, Lib_IntVector_Intrinsics_vec512 *r5)
+{
+  Lib_IntVector_Intrinsics_vec512 r0 = r[0U];
+  Lib_IntVector_Intrinsics_vec512 r1 = r[1U];
+  Lib_IntVector_Intrinsics_vec512 r2 = r[2U];
+  Lib_IntVector_Intrinsics_vec512 r3 = r[3U];
+  Lib_IntVector_Intrinsics_vec512 r4 = r[4U];
+  Lib_IntVector_Intrinsics_vec512 r51 = r5[1U];
+  Lib_IntVector_Intrinsics_vec512 r52 = r5[2U];
+  Lib_IntVector_Intrinsics_vec512 r53 = r5[3U];
+  Lib_IntVector_Intrinsics_vec512 r54 = r5[4U];
+  Lib_IntVector_Intrinsics_vec512 f10 = f1[0U];
+  Lib_IntVector_Intrinsics_vec512 f11 = f1[1U];
+  Lib_IntVector_Intrinsics_vec512 f12 = f1[2U];
+  Lib_IntVector_Intrinsics_vec512 f13 = f1[3U];
+  Lib_IntVector_Intrinsics_vec512 f14 = f1[4U];
+  Lib_IntVector_Intrinsics_vec512 a0 = Lib_IntVector_Intrinsics_vec512_mul64(r0, f10);
+  Lib_IntVector_Intrinsics_vec512 a1 = Lib_IntVector_Intrinsics_vec512_mul64(r1, f10);
+  Lib_IntVector_Intrinsics_vec512 a2 = Lib_IntVector_Intrinsics_vec512_mul64(r2, f10);
+  Lib_IntVector_Intrinsics_vec512 a3 = Lib_IntVector_Intrinsics_vec512_mul64(r3, f10);
+  Lib_IntVector_Intrinsics_vec512 a4 = Lib_IntVector_Intrinsics_vec512_mul64(r4, f10);
+  a0 = Lib_IntVector_Intrinsics_vec512_add64(a0, Lib_IntVector_Intrinsics_vec512_mul64(r54, f11));
+  a1 = Lib_IntVector_Intrinsics_vec512_add64(a1, Lib_IntVector_Intrinsics_vec512_mul64(r0, f11));
+  a2 = Lib_IntVector_Intrinsics_vec512_add64(a2, Lib_IntVector_Intrinsics_vec512_mul64(r1, f11));
+  a3 = Lib_IntVector_Intrinsics_vec512_add64(a3, Lib_IntVector_Intrinsics_vec512_mul64(r2, f11));
+  a4 = Lib_IntVector_Intrinsics_vec512_add64(a4, Lib_IntVector_Intrinsics_vec512_mul64(r3, f11));
+  a0 = Lib_IntVector_Intrinsics_vec512_add64(a0, Lib_IntVector_Intrinsics_vec512_mul64(r53, f12));
+  a1 = Lib_IntVector_Intrinsics_vec512_add64(a1, Lib_IntVector_Intrinsics_vec512_mul64(r54, f12));
+  a2 = Lib_IntVector_Intrinsics_vec512_add64(a2, Lib_IntVector_Intrinsics_vec512_mul64(r0, f12));
+  a3 = Lib_IntVector_Intrinsics_vec512_add64(a3, Lib_IntVector_Intrinsics_vec512_mul64(r1, f12));
+  a4 = Lib_IntVector_Intrinsics_vec512_add64(a4, Lib_IntVector_Intrinsics_vec512_mul64(r2, f12));
+  a0 = Lib_IntVector_Intrinsics_vec512_add64(a0, Lib_IntVector_Intrinsics_vec512_mul64(r52, f13));
+  a1 = Lib_IntVector_Intrinsics_vec512_add64(a1, Lib_IntVector_Intrinsics_vec512_mul64(r53, f13));
+  a2 = Lib_IntVector_Intrinsics_vec512_add64(a2, Lib_IntVector_Intrinsics_vec512_mul64(r54, f13));
+  a3 = Lib_IntVector_Intrinsics_vec512_add64(a3, Lib_IntVector_Intrinsics_vec512_mul64(r0, f13));
+  a4 = Lib_IntVector_Intrinsics_vec512_add64(a4, Lib_IntVector_Intrinsics_vec512_mul64(r1, f13));
+  a0 = Lib_IntVector_Intrinsics_vec512_add64(a0, Lib_IntVector_Intrinsics_vec512_mul64(r51, f14));
+  a1 = Lib_IntVector_Intrinsics_vec512_add64(a1, Lib_IntVector_Intrinsics_vec512_mul64(r52, f14));
+  a2 = Lib_IntVector_Intrinsics_vec512_add64(a2, Lib_IntVector_Intrinsics_vec512_mul64(r53, f14));
+  a3 = Lib_IntVector_Intrinsics_vec512_add64(a3, Lib_IntVector_Intrinsics_vec512_mul64(r54, f14));
+  a4 = Lib_IntVector_Intrinsics_vec512_add64(a4, Lib_IntVector_Intrinsics_vec512_mul64(r0, f14));
+  out[0U] = a0;
+  out[1U] = a1;
+  out[2U] = a2;
+  out[3U] = a3;
+  out[4U] = a4;
+}
+
+static inline void carry_reduce_512(Lib_IntVector_Intrinsics_vec512 *t)
+{
+  Lib_IntVector_Intrinsics_vec512 mask26 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  Lib_IntVector_Intrinsics_vec512 z0 = Lib_IntVector_Intrinsics_vec512_shift_right64(t[0U], (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 z1 = Lib_IntVector_Intrinsics_vec512_shift_right64(t[3U], (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x0 = Lib_IntVector_Intrinsics_vec512_and(t[0U], mask26);
+  Lib_IntVector_Intrinsics_vec512 x3 = Lib_IntVector_Intrinsics_vec512_and(t[3U], mask26);
+  Lib_IntVector_Intrinsics_vec512 x1 = Lib_IntVector_Intrinsics_vec512_add64(t[1U], z0);
+  Lib_IntVector_Intrinsics_vec512 x4 = Lib_IntVector_Intrinsics_vec512_add64(t[4U], z1);
+  Lib_IntVector_Intrinsics_vec512 z01 = Lib_IntVector_Intrinsics_vec512_shift_right64(x1, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 z11 = Lib_IntVector_Intrinsics_vec512_shift_right64(x4, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 t1 = Lib_IntVector_Intrinsics_vec512_shift_left64(z11, (uint32_t)2U);
+  Lib_IntVector_Intrinsics_vec512 z12 = Lib_IntVector_Intrinsics_vec512_add64(z11, t1);
+  Lib_IntVector_Intrinsics_vec512 x11 = Lib_IntVector_Intrinsics_vec512_and(x1, mask26);
+  Lib_IntVector_Intrinsics_vec512 x41 = Lib_IntVector_Intrinsics_vec512_and(x4, mask26);
+  Lib_IntVector_Intrinsics_vec512 x2 = Lib_IntVector_Intrinsics_vec512_add64(t[2U], z01);
+  Lib_IntVector_Intrinsics_vec512 x01 = Lib_IntVector_Intrinsics_vec512_add64(x0, z12);
+  Lib_IntVector_Intrinsics_vec512 z02 = Lib_IntVector_Intrinsics_vec512_shift_right64(x2, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 z13 = Lib_IntVector_Intrinsics_vec512_shift_right64(x01, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x21 = Lib_IntVector_Intrinsics_vec512_and(x2, mask26);
+  Lib_IntVector_Intrinsics_vec512 x02 = Lib_IntVector_Intrinsics_vec512_and(x01, mask26);
+  Lib_IntVector_Intrinsics_vec512 x31 = Lib_IntVector_Intrinsics_vec512_add64(x3, z02);
+  Lib_IntVector_Intrinsics_vec512 x12 = Lib_IntVector_Intrinsics_vec512_add64(x11, z13);
+  Lib_IntVector_Intrinsics_vec512 z03 = Lib_IntVector_Intrinsics_vec512_shift_right64(x31, (uint32_t)26U);
+  Lib_IntVector_Intrinsics_vec512 x32 = Lib_IntVector_Intrinsics_vec512_and(x31, mask26);
+  Lib_IntVector_Intrinsics_vec512 x42 = Lib_IntVector_Intrinsics_vec512_add64(x41, z03);
+  t[0U] = x02;
+  t[1U] = x12;
+  t[2U] = x21;
+  t[3U] = x32;
+  t[4U] = x42;
+}
+
+static inline void
+load_felem_512(Lib_IntVector_Intrinsics_vec512 *e, Lib_IntVector_Intrinsics_vec512 lo, Lib_IntVector_Intrinsics_vec512 hi, uint64_t top)
+{
+  Lib_IntVector_Intrinsics_vec512 mask26 = Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3ffffffU);
+  e[0U] = Lib_IntVector_Intrinsics_vec512_and(lo, mask26);
+  e[1U] = Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(lo, (uint32_t)26U), mask26);
+  e[2U] =
+    Lib_IntVector_Intrinsics_vec512_or(Lib_IntVector_Intrinsics_vec512_shift_right64(lo, (uint32_t)52U),
+      Lib_IntVector_Intrinsics_vec512_shift_left64(Lib_IntVector_Intrinsics_vec512_and(hi, Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x3fffU)), (uint32_t)12U));
+  e[3U] = Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_shift_right64(hi, (uint32_t)14U), mask26);
+  e[4U] = Lib_IntVector_Intrinsics_vec512_or(Lib_IntVector_Intrinsics_vec512_shift_right64(hi, (uint32_t)40U), Lib_IntVector_Intrinsics_vec512_load64(top));
+}
+
+/*
+  Loads eight 16-byte blocks. Lane j holds block [0; 4; 1; 5; 2; 6; 3; 7][j],
+  which avoids any cross-lane shuffle.
+*/
+static inline void load_blocks8_512(Lib_IntVector_Intrinsics_vec512 *e, uint8_t *b)
+{
+  Lib_IntVector_Intrinsics_vec512 b0 = Lib_IntVector_Intrinsics_vec512_load_le(b);
+  Lib_IntVector_Intrinsics_vec512 b1 = Lib_IntVector_Intrinsics_vec512_load_le(b + (uint32_t)64U);
+  Lib_IntVector_Intrinsics_vec512 lo = Lib_IntVector_Intrinsics_vec512_interleave_low64(b0, b1);
+  Lib_IntVector_Intrinsics_vec512 hi = Lib_IntVector_Intrinsics_vec512_interleave_high64(b0, b1);
+  load_felem_512(e, lo, hi, (uint64_t)0x1000000U);
+}
+
+/* acc = (acc + e) * r, with r and r5 taken from the given rows of the context */
+static inline void
+fadd_mul_r_512(Lib_IntVector_Intrinsics_vec512 *acc, Lib_IntVector_Intrinsics_vec512 *e, Lib_IntVector_Intrinsics_vec512 *r, Lib_IntVector_Intrinsics_vec512 *r5)
+{
+  Lib_IntVector_Intrinsics_vec512 t[5U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    t[i] = Lib_IntVector_Intrinsics_vec512_add64(acc[i], e[i]);
+  }
+  fmul_r_512(acc, t, r, r5);
+  carry_reduce_512(acc);
+}
+
+static inline uint64_t lane0_512(Lib_IntVector_Intrinsics_vec512 x)
+{
+  uint8_t b[64U] = { 0U };
+  Lib_IntVector_Intrinsics_vec512_store_le(b, x);
+  return load64_le(b);
+}
+
+/*
+  Multiplies lane j of the accumulator by the matching power of r and sums all
+  the lanes into lane 0.
+*/
+static inline void fmul_rp_normalize_512(Lib_IntVector_Intrinsics_vec512 *ctx)
+{
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec512 *rp = ctx + (uint32_t)25U;
+  Lib_IntVector_Intrinsics_vec512 *rp5 = ctx + (uint32_t)30U;
+  Lib_IntVector_Intrinsics_vec512 t[5U];
+  fmul_r_512(t, acc, rp, rp5);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    uint8_t b[64U] = { 0U };
+    Lib_IntVector_Intrinsics_vec512_store_le(b, t[i]);
+    uint64_t s = (uint64_t)0U;
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      s = s + load64_le(b + j * (uint32_t)8U);
+    }
+    acc[i] =
+      Lib_IntVector_Intrinsics_vec512_load64s(s,
+        (uint64_t)0U,
+        (uint64_t)0U,
+        (uint64_t)0U,
+        (uint64_t)0U,
+        (uint64_t)0U,
+        (uint64_t)0U,
+        (uint64_t)0U);
+  }
+  carry_reduce_512(acc);
+}
+
+uint32_t Hacl_Poly1305_512_blocklen = (uint32_t)16U;
+
+void Hacl_Poly1305_512_poly1305_init(Lib_IntVector_Intrinsics_vec512 *ctx, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec512 *r = ctx + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec512 *r5 = ctx + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec512 *r8 = ctx + (uint32_t)15U;
+  Lib_IntVector_Intrinsics_vec512 *r85 = ctx + (uint32_t)20U;
+  Lib_IntVector_Intrinsics_vec512 *rp = ctx + (uint32_t)25U;
+  Lib_IntVector_Intrinsics_vec512 *rp5 = ctx + (uint32_t)30U;
+  uint64_t lo = load64_le(key) & (uint64_t)0x0ffffffc0fffffffU;
+  uint64_t hi = load64_le(key + (uint32_t)8U) & (uint64_t)0x0ffffffc0ffffffcU;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    acc[i] = Lib_IntVector_Intrinsics_vec512_zero;
+  }
+  load_felem_512(r, Lib_IntVector_Intrinsics_vec512_load64(lo), Lib_IntVector_Intrinsics_vec512_load64(hi), (uint64_t)0U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    r5[i] = Lib_IntVector_Intrinsics_vec512_smul64(r[i], (uint64_t)5U);
+  }
+  /* pw[k - 1] = r^k, k = 1..8, identical in every lane */
+  Lib_IntVector_Intrinsics_vec512 pw[40U];
+  for (uint32_t _i = 0U; _i < (uint32_t)40U; ++_i)
+    pw[_i] = Lib_IntVector_Intrinsics_vec512_zero;
+  memcpy(pw, r, (uint32_t)5U * sizeof (Lib_IntVector_Intrinsics_vec512));
+  for (uint32_t k = (uint32_t)1U; k < (uint32_t)8U; k++)
+  {
+    fmul_r_512(pw + k * (uint32_t)5U, pw + (k - (uint32_t)1U) * (uint32_t)5U, r, r5);
+    carry_reduce_512(pw + k * (uint32_t)5U);
+  }
+  memcpy(r8, pw + (uint32_t)35U, (uint32_t)5U * sizeof (Lib_IntVector_Intrinsics_vec512));
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    r85[i] = Lib_IntVector_Intrinsics_vec512_smul64(r8[i], (uint64_t)5U);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    rp[i] =
+      Lib_IntVector_Intrinsics_vec512_load64s(lane0_512(pw[(uint32_t)35U + i]),
+        lane0_512(pw[(uint32_t)15U + i]),
+        lane0_512(pw[(uint32_t)30U + i]),
+        lane0_512(pw[(uint32_t)10U + i]),
+        lane0_512(pw[(uint32_t)25U + i]),
+        lane0_512(pw[(uint32_t)5U + i]),
+        lane0_512(pw[(uint32_t)20U + i]),
+        lane0_512(pw[i]));
+    rp5[i] = Lib_IntVector_Intrinsics_vec512_smul64(rp[i], (uint64_t)5U);
+  }
+}
+
+void
+Hacl_Poly1305_512_poly1305_update(Lib_IntVector_Intrinsics_vec512 *ctx, uint32_t len, uint8_t *text)
+{
+  Lib_IntVector_Intrinsics_vec512 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec512 *r = ctx + (uint32_t)5U;
+  Lib_IntVector_Intrinsics_vec512 *r5 = ctx + (uint32_t)10U;
+  Lib_IntVector_Intrinsics_vec512 *r8 = ctx + (uint32_t)15U;
+  Lib_IntVector_Intrinsics_vec512 *r85 = ctx + (uint32_t)20U;
+  uint32_t len0 = len / (uint32_t)128U * (uint32_t)128U;
+  if (len0 > (uint32_t)0U)
+  {
+    Lib_IntVector_Intrinsics_vec512 e[5U];
+    load_blocks8_512(e, text);
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+    {
+      acc[i] = Lib_IntVector_Intrinsics_vec512_add64(acc[i], e[i]);
+    }
+    uint32_t nb = len0 / (uint32_t)128U - (uint32_t)1U;
+    for (uint32_t i = (uint32_t)0U; i < nb; i++)
+    {
+      uint8_t *block = text + (i + (uint32_t)1U) * (uint32_t)128U;
+      Lib_IntVector_Intrinsics_vec512 t[5U];
+      fmul_r_512(t, acc, r8, r85);
+      load_blocks8_512(e, block);
+      for (uint32_t j = (uint32_t)0U; j < (uint32_t)5U; j++)
+      {
+        acc[j] = Lib_IntVector_Intrinsics_vec512_add64(t[j], e[j]);
+      }
+      carry_reduce_512(acc);
+    }
+    fmul_rp_normalize_512(ctx);
+  }
+  Lib_IntVector_Intrinsics_vec512
+  lane0 =
+    Lib_IntVector_Intrinsics_vec512_load64s((uint64_t)0xffffffffffffffffU,
+      (uint64_t)0U,
+      (uint64_t)0U,
+      (uint64_t)0U,
+      (uint64_t)0U,
+      (uint64_t)0U,
+      (uint64_t)0U,
+      (uint64_t)0U);
+  uint32_t len1 = len - len0;
+  uint8_t *t1 = text + len0;
+  uint32_t nb = len1 / (uint32_t)16U;
+  uint32_t rem = len1 % (uint32_t)16U;
+  for (uint32_t i = (uint32_t)0U; i < nb; i++)
+  {
+    uint8_t *block = t1 + i * (uint32_t)16U;
+    Lib_IntVector_Intrinsics_vec512 e[5U];
+    Lib_IntVector_Intrinsics_vec512 lo = Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_load64(load64_le(block)), lane0);
+    Lib_IntVector_Intrinsics_vec512 hi = Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_load64(load64_le(block + (uint32_t)8U)), lane0);
+    load_felem_512(e, lo, hi, (uint64_t)0U);
+    e[4U] = Lib_IntVector_Intrinsics_vec512_or(e[4U], Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_load64((uint64_t)0x1000000U), lane0));
+    fadd_mul_r_512(acc, e, r, r5);
+  }
+  if (rem > (uint32_t)0U)
+  {
+    uint8_t tmp[16U] = { 0U };
+    memcpy(tmp, t1 + nb * (uint32_t)16U, rem * sizeof (uint8_t));
+    tmp[rem] = (uint8_t)1U;
+    Lib_IntVector_Intrinsics_vec512 e[5U];
+    Lib_IntVector_Intrinsics_vec512 lo = Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_load64(load64_le(tmp)), lane0);
+    Lib_IntVector_Intrinsics_vec512 hi = Lib_IntVector_Intrinsics_vec512_and(Lib_IntVector_Intrinsics_vec512_load64(load64_le(tmp + (uint32_t)8U)), lane0);
+    load_felem_512(e, lo, hi, (uint64_t)0U);
+    fadd_mul_r_512(acc, e, r, r5);
+  }
+}
+
+void Hacl_Poly1305_512_poly1305_finish(uint8_t *tag, uint8_t *key, Lib_IntVector_Intrinsics_vec512 *ctx)
+{
+  uint64_t ctx1[25U] = { 0U };
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)5U; i++)
+  {
+    ctx1[i] = lane0_512(ctx[i]);
+  }
+  Hacl_Poly1305_32_poly1305_finish(tag, key, ctx1);
+}
+
+void Hacl_Poly1305_512_poly1305_mac(uint8_t *tag, uint32_t len, uint8_t *text, uint8_t *key)
+{
+  Lib_IntVector_Intrinsics_vec512 ctx[35U];
+  for (uint32_t _i = 0U; _i < (uint32_t)35U; ++_i)
+    ctx[_i] = Lib_IntVector_Intrinsics_vec512_zero;
+  Hacl_Poly1305_512_poly1305_init(ctx, key);
+  Hacl_Poly1305_512_poly1305_update(ctx, len, text);
+  Hacl_Poly1305_512_poly1305_finish(tag, key, ctx);
+}
@@ -0,0 +1,260 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_SHA2_Vec128.h"
+
+static uint32_t
+h256[8U] =
+  {
+    (uint32_t)0x6a09e667U, (uint32_t)0xbb67ae85U, (uint32_t)0x3c6ef372U, (uint32_t)0xa54ff53aU,
+    (uint32_t)0x510e527fU, (uint32_t)0x9b05688cU, (uint32_t)0x1f83d9abU, (uint32_t)0x5be0cd19U
+  };
+
+static uint32_t
+k224_256[64U] =
+  {
+    (uint32_t)0x428a2f98U, (uint32_t)0x71374491U, (uint32_t)0xb5c0fbcfU, (uint32_t)0xe9b5dba5U,
+    (uint32_t)0x3956c25bU, (uint32_t)0x59f111f1U, (uint32_t)0x923f82a4U, (uint32_t)0xab1c5ed5U,
+    (uint32_t)0xd807aa98U, (uint32_t)0x12835b01U, (uint32_t)0x243185beU, (uint32_t)0x550c7dc3U,
+    (uint32_t)0x72be5d74U, (uint32_t)0x80deb1feU, (uint32_t)0x9bdc06a7U, (uint32_t)0xc19bf174U,
+    (uint32_t)0xe49b69c1U, (uint32_t)0xefbe4786U, (uint32_t)0x0fc19dc6U, (uint32_t)0x240ca1ccU,
+    (uint32_t)0x2de92c6fU, (uint32_t)0x4a7484aaU, (uint32_t)0x5cb0a9dcU, (uint32_t)0x76f988daU,
+    (uint32_t)0x983e5152U, (uint32_t)0xa831c66dU, (uint32_t)0xb00327c8U, (uint32_t)0xbf597fc7U,
+    (uint32_t)0xc6e00bf3U, (uint32_t)0xd5a79147U, (uint32_t)0x06ca6351U, (uint32_t)0x14292967U,
+    (uint32_t)0x27b70a85U, (uint32_t)0x2e1b2138U, (uint32_t)0x4d2c6dfcU, (uint32_t)0x53380d13U,
+    (uint32_t)0x650a7354U, (uint32_t)0x766a0abbU, (uint32_t)0x81c2c92eU, (uint32_t)0x92722c85U,
+    (uint32_t)0xa2bfe8a1U, (uint32_t)0xa81a664bU, (uint32_t)0xc24b8b70U, (uint32_t)0xc76c51a3U,
+    (uint32_t)0xd192e819U, (uint32_t)0xd6990624U, (uint32_t)0xf40e3585U, (uint32_t)0x106aa070U,
+    (uint32_t)0x19a4c116U, (uint32_t)0x1e376c08U, (uint32_t)0x2748774cU, (uint32_t)0x34b0bcb5U,
+    (uint32_t)0x391c0cb3U, (uint32_t)0x4ed8aa4aU, (uint32_t)0x5b9cca4fU, (uint32_t)0x682e6ff3U,
+    (uint32_t)0x748f82eeU, (uint32_t)0x78a5636fU, (uint32_t)0x84c87814U, (uint32_t)0x8cc70208U,
+    (uint32_t)0x90befffaU, (uint32_t)0xa4506cebU, (uint32_t)0xbef9a3f7U, (uint32_t)0xc67178f2U
+  };
+
+static inline void transpose4x4(Lib_IntVector_Intrinsics_vec128 *v)
+{
+  Lib_IntVector_Intrinsics_vec128 v00 = v[0U];
+  Lib_IntVector_Intrinsics_vec128 v10 = v[1U];
+  Lib_IntVector_Intrinsics_vec128 v20 = v[2U];
+  Lib_IntVector_Intrinsics_vec128 v30 = v[3U];
+  Lib_IntVector_Intrinsics_vec128
+  v0_ = Lib_IntVector_Intrinsics_vec128_interleave_low32(v00, v10);
+  Lib_IntVector_Intrinsics_vec128
+  v1_ = Lib_IntVector_Intrinsics_vec128_interleave_high32(v00, v10);
+  Lib_IntVector_Intrinsics_vec128
+  v2_ = Lib_IntVector_Intrinsics_vec128_interleave_low32(v20, v30);
+  Lib_IntVector_Intrinsics_vec128
+  v3_ = Lib_IntVector_Intrinsics_vec128_interleave_high32(v20, v30);
+  v[0U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_, v2_);
+  v[1U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_, v2_);
+  v[2U] = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_, v3_);
+  v[3U] = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_, v3_);
+}
+
+static inline void load_state4(uint32_t **st, Lib_IntVector_Intrinsics_vec128 *hash)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] = Lib_IntVector_Intrinsics_vec128_load32s(st[0U][i], st[1U][i], st[2U][i], st[3U][i]);
+  }
+}
+
+static inline void store_state4(Lib_IntVector_Intrinsics_vec128 *hash, uint32_t **st)
+{
+  transpose4x4(hash);
+  transpose4x4(hash + (uint32_t)4U);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t tmp[32U] = { 0U };
+    Lib_IntVector_Intrinsics_vec128_store_le(tmp, hash[i]);
+    Lib_IntVector_Intrinsics_vec128_store_le(tmp + (uint32_t)16U, hash[i + (uint32_t)4U]);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      st[i][j] = load32_le(tmp + j * (uint32_t)4U);
+    }
+  }
+}
+
+static inline void
+update4(Lib_IntVector_Intrinsics_vec128 *hash, uint8_t **blocks, uint32_t off)
+{
+  Lib_IntVector_Intrinsics_vec128 hash_old[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    hash_old[_i] = hash[_i];
+  Lib_IntVector_Intrinsics_vec128 ws[16U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t *b = blocks[i] + off;
+    ws[i] = Lib_IntVector_Intrinsics_vec128_load32_be(b);
+    ws[i + (uint32_t)4U] = Lib_IntVector_Intrinsics_vec128_load32_be(b + (uint32_t)16U);
+    ws[i + (uint32_t)8U] = Lib_IntVector_Intrinsics_vec128_load32_be(b + (uint32_t)32U);
+    ws[i + (uint32_t)12U] = Lib_IntVector_Intrinsics_vec128_load32_be(b + (uint32_t)48U);
+  }
+  transpose4x4(ws);
+  transpose4x4(ws + (uint32_t)4U);
+  transpose4x4(ws + (uint32_t)8U);
+  transpose4x4(ws + (uint32_t)12U);
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint32_t k_t = k224_256[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec128 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec128 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec128 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec128 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec128 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec128 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec128 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec128 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec128 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec128
+      sigma1 =
+        Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(e0,
+            (uint32_t)6U),
+          Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(e0,
+              (uint32_t)11U),
+            Lib_IntVector_Intrinsics_vec128_rotate_right32(e0, (uint32_t)25U)));
+      Lib_IntVector_Intrinsics_vec128
+      ch =
+        Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_and(e0, f0),
+          Lib_IntVector_Intrinsics_vec128_and(Lib_IntVector_Intrinsics_vec128_lognot(e0), g0));
+      Lib_IntVector_Intrinsics_vec128
+      t1 =
+        Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(h02,
+                sigma1),
+              ch),
+            Lib_IntVector_Intrinsics_vec128_load32(k_t)),
+          ws_t);
+      Lib_IntVector_Intrinsics_vec128
+      sigma0 =
+        Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(a0,
+            (uint32_t)2U),
+          Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(a0,
+              (uint32_t)13U),
+            Lib_IntVector_Intrinsics_vec128_rotate_right32(a0, (uint32_t)22U)));
+      Lib_IntVector_Intrinsics_vec128
+      maj =
+        Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_and(a0, b0),
+          Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_and(a0, c0),
+            Lib_IntVector_Intrinsics_vec128_and(b0, c0)));
+      Lib_IntVector_Intrinsics_vec128 t2 = Lib_IntVector_Intrinsics_vec128_add32(sigma0, maj);
+      hash[0U] = Lib_IntVector_Intrinsics_vec128_add32(t1, t2);
+      hash[1U] = a0;
+      hash[2U] = b0;
+      hash[3U] = c0;
+      hash[4U] = Lib_IntVector_Intrinsics_vec128_add32(d0, t1);
+      hash[5U] = e0;
+      hash[6U] = f0;
+      hash[7U] = g0;
+    }
+    if (i0 < (uint32_t)3U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        Lib_IntVector_Intrinsics_vec128 t16 = ws[i];
+        Lib_IntVector_Intrinsics_vec128 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec128 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec128 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec128
+        s1 =
+          Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(t2,
+              (uint32_t)17U),
+            Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(t2,
+                (uint32_t)19U),
+              Lib_IntVector_Intrinsics_vec128_shift_right32(t2, (uint32_t)10U)));
+        Lib_IntVector_Intrinsics_vec128
+        s0 =
+          Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(t15,
+              (uint32_t)7U),
+            Lib_IntVector_Intrinsics_vec128_xor(Lib_IntVector_Intrinsics_vec128_rotate_right32(t15,
+                (uint32_t)18U),
+              Lib_IntVector_Intrinsics_vec128_shift_right32(t15, (uint32_t)3U)));
+        ws[i] =
+          Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(Lib_IntVector_Intrinsics_vec128_add32(s1,
+                t7),
+              s0),
+            t16);
+      }
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] = Lib_IntVector_Intrinsics_vec128_add32(hash[i], hash_old[i]);
+  }
+}
+
+void
+Hacl_SHA2_Vec128_update_multi_256_4(uint32_t **st, uint8_t **blocks, uint32_t n_blocks)
+{
+  Lib_IntVector_Intrinsics_vec128 hash[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    hash[_i] = Lib_IntVector_Intrinsics_vec128_zero;
+  load_state4(st, hash);
+  for (uint32_t i = (uint32_t)0U; i < n_blocks; i++)
+  {
+    update4(hash, blocks, i * (uint32_t)64U);
+  }
+  store_state4(hash, st);
+}
+
+void Hacl_SHA2_Vec128_sha256_4(uint8_t **dst, uint32_t input_len, uint8_t **input)
+{
+  uint32_t st[32U] = { 0U };
+  uint32_t *st_p[4U] = { 0U };
+  uint8_t last[512U] = { 0U };
+  uint8_t *last_p[4U] = { 0U };
+  uint32_t blocks_n = input_len / (uint32_t)64U;
+  uint32_t blocks_len = blocks_n * (uint32_t)64U;
+  uint32_t rem = input_len - blocks_len;
+  uint32_t last_n;
+  if (rem + (uint32_t)9U <= (uint32_t)64U)
+  {
+    last_n = (uint32_t)1U;
+  }
+  else
+  {
+    last_n = (uint32_t)2U;
+  }
+  uint64_t total_len_bits = (uint64_t)input_len << (uint32_t)3U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    st_p[i] = st + i * (uint32_t)8U;
+    memcpy(st_p[i], h256, (uint32_t)8U * sizeof (uint32_t));
+    last_p[i] = last + i * (uint32_t)128U;
+    memcpy(last_p[i], input[i] + blocks_len, rem * sizeof (uint8_t));
+    last_p[i][rem] = (uint8_t)0x80U;
+    store64_be(last_p[i] + last_n * (uint32_t)64U - (uint32_t)8U, total_len_bits);
+  }
+  Hacl_SHA2_Vec128_update_multi_256_4(st_p, input, blocks_n);
+  Hacl_SHA2_Vec128_update_multi_256_4(st_p, last_p, last_n);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      store32_be(dst[i] + j * (uint32_t)4U, st_p[i][j]);
+    }
+  }
+}
+
@@ -0,0 +1,645 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2020 INRIA, CMU and Microsoft Corporation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "Hacl_SHA2_Vec256.h"
+
+static uint32_t
+h256[8U] =
+  {
+    (uint32_t)0x6a09e667U, (uint32_t)0xbb67ae85U, (uint32_t)0x3c6ef372U, (uint32_t)0xa54ff53aU,
+    (uint32_t)0x510e527fU, (uint32_t)0x9b05688cU, (uint32_t)0x1f83d9abU, (uint32_t)0x5be0cd19U
+  };
+
+static uint32_t
+k224_256[64U] =
+  {
+    (uint32_t)0x428a2f98U, (uint32_t)0x71374491U, (uint32_t)0xb5c0fbcfU, (uint32_t)0xe9b5dba5U,
+    (uint32_t)0x3956c25bU, (uint32_t)0x59f111f1U, (uint32_t)0x923f82a4U, (uint32_t)0xab1c5ed5U,
+    (uint32_t)0xd807aa98U, (uint32_t)0x12835b01U, (uint32_t)0x243185beU, (uint32_t)0x550c7dc3U,
+    (uint32_t)0x72be5d74U, (uint32_t)0x80deb1feU, (uint32_t)0x9bdc06a7U, (uint32_t)0xc19bf174U,
+    (uint32_t)0xe49b69c1U, (uint32_t)0xefbe4786U, (uint32_t)0x0fc19dc6U, (uint32_t)0x240ca1ccU,
+    (uint32_t)0x2de92c6fU, (uint32_t)0x4a7484aaU, (uint32_t)0x5cb0a9dcU, (uint32_t)0x76f988daU,
+    (uint32_t)0x983e5152U, (uint32_t)0xa831c66dU, (uint32_t)0xb00327c8U, (uint32_t)0xbf597fc7U,
+    (uint32_t)0xc6e00bf3U, (uint32_t)0xd5a79147U, (uint32_t)0x06ca6351U, (uint32_t)0x14292967U,
+    (uint32_t)0x27b70a85U, (uint32_t)0x2e1b2138U, (uint32_t)0x4d2c6dfcU, (uint32_t)0x53380d13U,
+    (uint32_t)0x650a7354U, (uint32_t)0x766a0abbU, (uint32_t)0x81c2c92eU, (uint32_t)0x92722c85U,
+    (uint32_t)0xa2bfe8a1U, (uint32_t)0xa81a664bU, (uint32_t)0xc24b8b70U, (uint32_t)0xc76c51a3U,
+    (uint32_t)0xd192e819U, (uint32_t)0xd6990624U, (uint32_t)0xf40e3585U, (uint32_t)0x106aa070U,
+    (uint32_t)0x19a4c116U, (uint32_t)0x1e376c08U, (uint32_t)0x2748774cU, (uint32_t)0x34b0bcb5U,
+    (uint32_t)0x391c0cb3U, (uint32_t)0x4ed8aa4aU, (uint32_t)0x5b9cca4fU, (uint32_t)0x682e6ff3U,
+    (uint32_t)0x748f82eeU, (uint32_t)0x78a5636fU, (uint32_t)0x84c87814U, (uint32_t)0x8cc70208U,
+    (uint32_t)0x90befffaU, (uint32_t)0xa4506cebU, (uint32_t)0xbef9a3f7U, (uint32_t)0xc67178f2U
+  };
+
+static inline void transpose8x8(Lib_IntVector_Intrinsics_vec256 *v)
+{
+  Lib_IntVector_Intrinsics_vec256 v00 = v[0U];
+  Lib_IntVector_Intrinsics_vec256 v10 = v[1U];
+  Lib_IntVector_Intrinsics_vec256 v20 = v[2U];
+  Lib_IntVector_Intrinsics_vec256 v30 = v[3U];
+  Lib_IntVector_Intrinsics_vec256 v40 = v[4U];
+  Lib_IntVector_Intrinsics_vec256 v50 = v[5U];
+  Lib_IntVector_Intrinsics_vec256 v60 = v[6U];
+  Lib_IntVector_Intrinsics_vec256 v70 = v[7U];
+  Lib_IntVector_Intrinsics_vec256
+  v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v00, v10);
+  Lib_IntVector_Intrinsics_vec256
+  v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v00, v10);
+  Lib_IntVector_Intrinsics_vec256
+  v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v20, v30);
+  Lib_IntVector_Intrinsics_vec256
+  v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v20, v30);
+  Lib_IntVector_Intrinsics_vec256
+  v4_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v40, v50);
+  Lib_IntVector_Intrinsics_vec256
+  v5_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v40, v50);
+  Lib_IntVector_Intrinsics_vec256
+  v6_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(v60, v70);
+  Lib_IntVector_Intrinsics_vec256
+  v7_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(v60, v70);
+  Lib_IntVector_Intrinsics_vec256
+  v0__ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v2_);
+  Lib_IntVector_Intrinsics_vec256
+  v1__ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v2_);
+  Lib_IntVector_Intrinsics_vec256
+  v2__ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_, v3_);
+  Lib_IntVector_Intrinsics_vec256
+  v3__ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_, v3_);
+  Lib_IntVector_Intrinsics_vec256
+  v4__ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_, v6_);
+  Lib_IntVector_Intrinsics_vec256
+  v5__ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_, v6_);
+  Lib_IntVector_Intrinsics_vec256
+  v6__ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_, v7_);
+  Lib_IntVector_Intrinsics_vec256
+  v7__ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_, v7_);
+  v[0U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0__, v4__);
+  v[4U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0__, v4__);
+  v[1U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1__, v5__);
+  v[5U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1__, v5__);
+  v[2U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v2__, v6__);
+  v[6U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v2__, v6__);
+  v[3U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v3__, v7__);
+  v[7U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v3__, v7__);
+}
+
+static inline void load_state8(uint32_t **st, Lib_IntVector_Intrinsics_vec256 *hash)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] =
+      Lib_IntVector_Intrinsics_vec256_load32s(st[0U][i],
+        st[1U][i],
+        st[2U][i],
+        st[3U][i],
+        st[4U][i],
+        st[5U][i],
+        st[6U][i],
+        st[7U][i]);
+  }
+}
+
+static inline void store_state8(Lib_IntVector_Intrinsics_vec256 *hash, uint32_t **st)
+{
+  transpose8x8(hash);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint8_t tmp[32U] = { 0U };
+    Lib_IntVector_Intrinsics_vec256_store_le(tmp, hash[i]);
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      st[i][j] = load32_le(tmp + j * (uint32_t)4U);
+    }
+  }
+}
+
+static inline void
+update8(Lib_IntVector_Intrinsics_vec256 *hash, uint8_t **blocks, uint32_t off)
+{
+  Lib_IntVector_Intrinsics_vec256 hash_old[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    hash_old[_i] = hash[_i];
+  Lib_IntVector_Intrinsics_vec256 ws[16U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    uint8_t *b = blocks[i] + off;
+    ws[i] = Lib_IntVector_Intrinsics_vec256_load32_be(b);
+    ws[i + (uint32_t)8U] = Lib_IntVector_Intrinsics_vec256_load32_be(b + (uint32_t)32U);
+  }
+  transpose8x8(ws);
+  transpose8x8(ws + (uint32_t)8U);
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)4U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint32_t k_t = k224_256[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec256 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec256 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec256 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec256 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec256 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec256 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec256 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec256 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec256 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec256
+      sigma1 =
+        Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0,
+            (uint32_t)6U),
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(e0,
+              (uint32_t)11U),
+            Lib_IntVector_Intrinsics_vec256_rotate_right32(e0, (uint32_t)25U)));
+      Lib_IntVector_Intrinsics_vec256
+      ch =
+        Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(e0, f0),
+          Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(e0), g0));
+      Lib_IntVector_Intrinsics_vec256
+      t1 =
+        Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(h02,
+                sigma1),
+              ch),
+            Lib_IntVector_Intrinsics_vec256_load32(k_t)),
+          ws_t);
+      Lib_IntVector_Intrinsics_vec256
+      sigma0 =
+        Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0,
+            (uint32_t)2U),
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(a0,
+              (uint32_t)13U),
+            Lib_IntVector_Intrinsics_vec256_rotate_right32(a0, (uint32_t)22U)));
+      Lib_IntVector_Intrinsics_vec256
+      maj =
+        Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, b0),
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, c0),
+            Lib_IntVector_Intrinsics_vec256_and(b0, c0)));
+      Lib_IntVector_Intrinsics_vec256 t2 = Lib_IntVector_Intrinsics_vec256_add32(sigma0, maj);
+      hash[0U] = Lib_IntVector_Intrinsics_vec256_add32(t1, t2);
+      hash[1U] = a0;
+      hash[2U] = b0;
+      hash[3U] = c0;
+      hash[4U] = Lib_IntVector_Intrinsics_vec256_add32(d0, t1);
+      hash[5U] = e0;
+      hash[6U] = f0;
+      hash[7U] = g0;
+    }
+    if (i0 < (uint32_t)3U)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        Lib_IntVector_Intrinsics_vec256 t16 = ws[i];
+        Lib_IntVector_Intrinsics_vec256 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+        Lib_IntVector_Intrinsics_vec256
+        s1 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2,
+              (uint32_t)17U),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t2,
+                (uint32_t)19U),
+              Lib_IntVector_Intrinsics_vec256_shift_right32(t2, (uint32_t)10U)));
+        Lib_IntVector_Intrinsics_vec256
+        s0 =
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15,
+              (uint32_t)7U),
+            Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right32(t15,
+                (uint32_t)18U),
+              Lib_IntVector_Intrinsics_vec256_shift_right32(t15, (uint32_t)3U)));
+        ws[i] =
+          Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(Lib_IntVector_Intrinsics_vec256_add32(s1,
+                t7),
+              s0),
+            t16);
+      }
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] = Lib_IntVector_Intrinsics_vec256_add32(hash[i], hash_old[i]);
+  }
+}
+
+void
+Hacl_SHA2_Vec256_update_multi_256_8(uint32_t **st, uint8_t **blocks, uint32_t n_blocks)
+{
+  Lib_IntVector_Intrinsics_vec256 hash[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    hash[_i] = Lib_IntVector_Intrinsics_vec256_zero;
+  load_state8(st, hash);
+  for (uint32_t i = (uint32_t)0U; i < n_blocks; i++)
+  {
+    update8(hash, blocks, i * (uint32_t)64U);
+  }
+  store_state8(hash, st);
+}
+
+void Hacl_SHA2_Vec256_sha256_8(uint8_t **dst, uint32_t input_len, uint8_t **input)
+{
+  uint32_t st[64U] = { 0U };
+  uint32_t *st_p[8U] = { 0U };
+  uint8_t last[1024U] = { 0U };
+  uint8_t *last_p[8U] = { 0U };
+  uint32_t blocks_n = input_len / (uint32_t)64U;
+  uint32_t blocks_len = blocks_n * (uint32_t)64U;
+  uint32_t rem = input_len - blocks_len;
+  uint32_t last_n;
+  if (rem + (uint32_t)9U <= (uint32_t)64U)
+  {
+    last_n = (uint32_t)1U;
+  }
+  else
+  {
+    last_n = (uint32_t)2U;
+  }
+  uint64_t total_len_bits = (uint64_t)input_len << (uint32_t)3U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    st_p[i] = st + i * (uint32_t)8U;
+    memcpy(st_p[i], h256, (uint32_t)8U * sizeof (uint32_t));
+    last_p[i] = last + i * (uint32_t)128U;
+    memcpy(last_p[i], input[i] + blocks_len, rem * sizeof (uint8_t));
+    last_p[i][rem] = (uint8_t)0x80U;
+    store64_be(last_p[i] + last_n * (uint32_t)64U - (uint32_t)8U, total_len_bits);
+  }
+  Hacl_SHA2_Vec256_update_multi_256_8(st_p, input, blocks_n);
+  Hacl_SHA2_Vec256_update_multi_256_8(st_p, last_p, last_n);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      store32_be(dst[i] + j * (uint32_t)4U, st_p[i][j]);
+    }
+  }
+}
+
+
+static uint64_t
+h384[8U] =
+  {
+    (uint64_t)0xcbbb9d5dc1059ed8U, (uint64_t)0x629a292a367cd507U, (uint64_t)0x9159015a3070dd17U,
+    (uint64_t)0x152fecd8f70e5939U, (uint64_t)0x67332667ffc00b31U, (uint64_t)0x8eb44a8768581511U,
+    (uint64_t)0xdb0c2e0d64f98fa7U, (uint64_t)0x47b5481dbefa4fa4U
+  };
+
+static uint64_t
+h512[8U] =
+  {
+    (uint64_t)0x6a09e667f3bcc908U, (uint64_t)0xbb67ae8584caa73bU, (uint64_t)0x3c6ef372fe94f82bU,
+    (uint64_t)0xa54ff53a5f1d36f1U, (uint64_t)0x510e527fade682d1U, (uint64_t)0x9b05688c2b3e6c1fU,
+    (uint64_t)0x1f83d9abfb41bd6bU, (uint64_t)0x5be0cd19137e2179U
+  };
+
+static uint64_t
+k384_512[80U] =
+  {
+    (uint64_t)0x428a2f98d728ae22U, (uint64_t)0x7137449123ef65cdU, (uint64_t)0xb5c0fbcfec4d3b2fU,
+    (uint64_t)0xe9b5dba58189dbbcU, (uint64_t)0x3956c25bf348b538U, (uint64_t)0x59f111f1b605d019U,
+    (uint64_t)0x923f82a4af194f9bU, (uint64_t)0xab1c5ed5da6d8118U, (uint64_t)0xd807aa98a3030242U,
+    (uint64_t)0x12835b0145706fbeU, (uint64_t)0x243185be4ee4b28cU, (uint64_t)0x550c7dc3d5ffb4e2U,
+    (uint64_t)0x72be5d74f27b896fU, (uint64_t)0x80deb1fe3b1696b1U, (uint64_t)0x9bdc06a725c71235U,
+    (uint64_t)0xc19bf174cf692694U, (uint64_t)0xe49b69c19ef14ad2U, (uint64_t)0xefbe4786384f25e3U,
+    (uint64_t)0x0fc19dc68b8cd5b5U, (uint64_t)0x240ca1cc77ac9c65U, (uint64_t)0x2de92c6f592b0275U,
+    (uint64_t)0x4a7484aa6ea6e483U, (uint64_t)0x5cb0a9dcbd41fbd4U, (uint64_t)0x76f988da831153b5U,
+    (uint64_t)0x983e5152ee66dfabU, (uint64_t)0xa831c66d2db43210U, (uint64_t)0xb00327c898fb213fU,
+    (uint64_t)0xbf597fc7beef0ee4U, (uint64_t)0xc6e00bf33da88fc2U, (uint64_t)0xd5a79147930aa725U,
+    (uint64_t)0x06ca6351e003826fU, (uint64_t)0x142929670a0e6e70U, (uint64_t)0x27b70a8546d22ffcU,
+    (uint64_t)0x2e1b21385c26c926U, (uint64_t)0x4d2c6dfc5ac42aedU, (uint64_t)0x53380d139d95b3dfU,
+    (uint64_t)0x650a73548baf63deU, (uint64_t)0x766a0abb3c77b2a8U, (uint64_t)0x81c2c92e47edaee6U,
+    (uint64_t)0x92722c851482353bU, (uint64_t)0xa2bfe8a14cf10364U, (uint64_t)0xa81a664bbc423001U,
+    (uint64_t)0xc24b8b70d0f89791U, (uint64_t)0xc76c51a30654be30U, (uint64_t)0xd192e819d6ef5218U,
+    (uint64_t)0xd69906245565a910U, (uint64_t)0xf40e35855771202aU, (uint64_t)0x106aa07032bbd1b8U,
+    (uint64_t)0x19a4c116b8d2d0c8U, (uint64_t)0x1e376c085141ab53U, (uint64_t)0x2748774cdf8eeb99U,
+    (uint64_t)0x34b0bcb5e19b48a8U, (uint64_t)0x391c0cb3c5c95a63U, (uint64_t)0x4ed8aa4ae3418acbU,
+    (uint64_t)0x5b9cca4f7763e373U, (uint64_t)0x682e6ff3d6b2b8a3U, (uint64_t)0x748f82ee5defb2fcU,
+    (uint64_t)0x78a5636f43172f60U, (uint64_t)0x84c87814a1f0ab72U, (uint64_t)0x8cc702081a6439ecU,
+    (uint64_t)0x90befffa23631e28U, (uint64_t)0xa4506cebde82bde9U, (uint64_t)0xbef9a3f7b2c67915U,
+    (uint64_t)0xc67178f2e372532bU, (uint64_t)0xca273eceea26619cU, (uint64_t)0xd186b8c721c0c207U,
+    (uint64_t)0xeada7dd6cde0eb1eU, (uint64_t)0xf57d4f7fee6ed178U, (uint64_t)0x06f067aa72176fbaU,
+    (uint64_t)0x0a637dc5a2c898a6U, (uint64_t)0x113f9804bef90daeU, (uint64_t)0x1b710b35131c471bU,
+    (uint64_t)0x28db77f523047d84U, (uint64_t)0x32caab7b40c72493U, (uint64_t)0x3c9ebe0a15c9bebcU,
+    (uint64_t)0x431d67c49c100d4cU, (uint64_t)0x4cc5d4becb3e42b6U, (uint64_t)0x597f299cfc657e2aU,
+    (uint64_t)0x5fcb6fab3ad6faecU, (uint64_t)0x6c44198c4a475817U
+  };
+
+static inline void transpose4x4_64(Lib_IntVector_Intrinsics_vec256 *v)
+{
+  Lib_IntVector_Intrinsics_vec256 v0 = v[0U];
+  Lib_IntVector_Intrinsics_vec256 v1 = v[1U];
+  Lib_IntVector_Intrinsics_vec256 v2 = v[2U];
+  Lib_IntVector_Intrinsics_vec256 v3 = v[3U];
+  Lib_IntVector_Intrinsics_vec256 v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0, v1);
+  Lib_IntVector_Intrinsics_vec256 v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0, v1);
+  Lib_IntVector_Intrinsics_vec256 v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low64(v2, v3);
+  Lib_IntVector_Intrinsics_vec256 v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high64(v2, v3);
+  v[0U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_, v2_);
+  v[1U] = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_, v3_);
+  v[2U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_, v2_);
+  v[3U] = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_, v3_);
+}
+
+/* Loads word i of the 128-byte block at blocks[l] + off into lane l of ws[i]. */
+static inline void
+load_ws4(Lib_IntVector_Intrinsics_vec256 *ws, uint8_t **blocks, uint32_t off)
+{
+  Lib_IntVector_Intrinsics_vec256 tmp[16U];
+  for (uint32_t l = (uint32_t)0U; l < (uint32_t)4U; l++)
+  {
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+    {
+      tmp[j * (uint32_t)4U + l] =
+        Lib_IntVector_Intrinsics_vec256_load64_be(blocks[l] + off + j * (uint32_t)32U);
+    }
+  }
+  for (uint32_t j = (uint32_t)0U; j < (uint32_t)4U; j++)
+  {
+    transpose4x4_64(tmp + j * (uint32_t)4U);
+    ws[j * (uint32_t)4U] = tmp[j * (uint32_t)4U];
+    ws[j * (uint32_t)4U + (uint32_t)1U] = tmp[j * (uint32_t)4U + (uint32_t)1U];
+    ws[j * (uint32_t)4U + (uint32_t)2U] = tmp[j * (uint32_t)4U + (uint32_t)2U];
+    ws[j * (uint32_t)4U + (uint32_t)3U] = tmp[j * (uint32_t)4U + (uint32_t)3U];
+  }
+}
+
+/* Replaces the 16 schedule words in ws with the next 16. */
+static inline void next_ws4(Lib_IntVector_Intrinsics_vec256 *ws)
+{
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+  {
+    Lib_IntVector_Intrinsics_vec256 t16 = ws[i];
+    Lib_IntVector_Intrinsics_vec256 t15 = ws[(i + (uint32_t)1U) % (uint32_t)16U];
+    Lib_IntVector_Intrinsics_vec256 t7 = ws[(i + (uint32_t)9U) % (uint32_t)16U];
+    Lib_IntVector_Intrinsics_vec256 t2 = ws[(i + (uint32_t)14U) % (uint32_t)16U];
+    Lib_IntVector_Intrinsics_vec256
+    s1 =
+      Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t2,
+          (uint32_t)19U),
+        Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t2,
+            (uint32_t)61U),
+          Lib_IntVector_Intrinsics_vec256_shift_right64(t2, (uint32_t)6U)));
+    Lib_IntVector_Intrinsics_vec256
+    s0 =
+      Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t15,
+          (uint32_t)1U),
+        Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(t15,
+            (uint32_t)8U),
+          Lib_IntVector_Intrinsics_vec256_shift_right64(t15, (uint32_t)7U)));
+    ws[i] =
+      Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(s1,
+            t7),
+          s0),
+        t16);
+  }
+}
+
+static inline void
+update4_512(Lib_IntVector_Intrinsics_vec256 *hash, uint8_t **blocks, uint32_t off)
+{
+  Lib_IntVector_Intrinsics_vec256 hash_old[8U];
+  for (uint32_t _i = 0U; _i < (uint32_t)8U; ++_i)
+    hash_old[_i] = hash[_i];
+  Lib_IntVector_Intrinsics_vec256 ws[16U];
+  load_ws4(ws, blocks, off);
+  for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)5U; i0++)
+  {
+    for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+    {
+      uint64_t k_t = k384_512[(uint32_t)16U * i0 + i];
+      Lib_IntVector_Intrinsics_vec256 ws_t = ws[i];
+      Lib_IntVector_Intrinsics_vec256 a0 = hash[0U];
+      Lib_IntVector_Intrinsics_vec256 b0 = hash[1U];
+      Lib_IntVector_Intrinsics_vec256 c0 = hash[2U];
+      Lib_IntVector_Intrinsics_vec256 d0 = hash[3U];
+      Lib_IntVector_Intrinsics_vec256 e0 = hash[4U];
+      Lib_IntVector_Intrinsics_vec256 f0 = hash[5U];
+      Lib_IntVector_Intrinsics_vec256 g0 = hash[6U];
+      Lib_IntVector_Intrinsics_vec256 h02 = hash[7U];
+      Lib_IntVector_Intrinsics_vec256
+      sigma1 =
+        Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(e0,
+            (uint32_t)14U),
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(e0,
+              (uint32_t)18U),
+            Lib_IntVector_Intrinsics_vec256_rotate_right64(e0, (uint32_t)41U)));
+      Lib_IntVector_Intrinsics_vec256
+      ch =
+        Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(e0, f0),
+          Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_lognot(e0), g0));
+      Lib_IntVector_Intrinsics_vec256
+      t1 =
+        Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(Lib_IntVector_Intrinsics_vec256_add64(h02,
+                sigma1),
+              ch),
+            Lib_IntVector_Intrinsics_vec256_load64(k_t)),
+          ws_t);
+      Lib_IntVector_Intrinsics_vec256
+      sigma0 =
+        Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(a0,
+            (uint32_t)28U),
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_rotate_right64(a0,
+              (uint32_t)34U),
+            Lib_IntVector_Intrinsics_vec256_rotate_right64(a0, (uint32_t)39U)));
+      Lib_IntVector_Intrinsics_vec256
+      maj =
+        Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, b0),
+          Lib_IntVector_Intrinsics_vec256_xor(Lib_IntVector_Intrinsics_vec256_and(a0, c0),
+            Lib_IntVector_Intrinsics_vec256_and(b0, c0)));
+      Lib_IntVector_Intrinsics_vec256 t2 = Lib_IntVector_Intrinsics_vec256_add64(sigma0, maj);
+      hash[0U] = Lib_IntVector_Intrinsics_vec256_add64(t1, t2);
+      hash[1U] = a0;
+      hash[2U] = b0;
+      hash[3U] = c0;
+      hash[4U] = Lib_IntVector_Intrinsics_vec256_add64(d0, t1);
+      hash[5U] = e0;
+      hash[6U] = f0;
+      hash[7U] = g0;
+    }
+    if (i0 < (uint32_t)4U)
+    {
+      next_ws4(ws);
+    }
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] = Lib_IntVector_Intrinsics_vec256_add64(hash[i], hash_old[i]);
+  }
+}
+
+void
+Hacl_SHA2_Vec256_update_multi_512_4(uint64_t **st, uint8_t **blocks, uint32_t n_blocks)
+{
+  Lib_IntVector_Intrinsics_vec256 hash[8U];
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    hash[i] = Lib_IntVector_Intrinsics_vec256_load64s(st[0U][i], st[1U][i], st[2U][i], st[3U][i]);
+  }
+  for (uint32_t i = (uint32_t)0U; i < n_blocks; i++)
+  {
+    update4_512(hash, blocks, i * (uint32_t)128U);
+  }
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)8U; i++)
+  {
+    st[0U][i] = Lib_IntVector_Intrinsics_vec256_extract64(hash[i], (uint32_t)0U);
+    st[1U][i] = Lib_IntVector_Intrinsics_vec256_extract64(hash[i], (uint32_t)1U);
+    st[2U][i] = Lib_IntVector_Intrinsics_vec256_extract64(hash[i], (uint32_t)2U);
+    st[3U][i] = Lib_IntVector_Intrinsics_vec256_extract64(hash[i], (uint32_t)3U);
+  }
+}
+
+static void
+sha512_4(uint64_t *iv, uint32_t hash_len, uint8_t **dst, uint32_t input_len, uint8_t **input)
+{
+  uint64_t st[32U] = { 0U };
+  uint64_t *st_p[4U] = { 0U };
+  uint8_t last[1024U] = { 0U };
+  uint8_t *last_p[4U] = { 0U };
+  uint32_t blocks_n = input_len / (uint32_t)128U;
+  uint32_t blocks_len = blocks_n * (uint32_t)128U;
+  uint32_t rem = input_len - blocks_len;
+  uint32_t last_n;
+  if (rem + (uint32_t)17U <= (uint32_t)128U)
+  {
+    last_n = (uint32_t)1U;
+  }
+  else
+  {
+    last_n = (uint32_t)2U;
+  }
+  uint64_t total_len_bits = (uint64_t)input_len << (uint32_t)3U;
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    st_p[i] = st + i * (uint32_t)8U;
+    memcpy(st_p[i], iv, (uint32_t)8U * sizeof (uint64_t));
+    last_p[i] = last + i * (uint32_t)256U;
+    memcpy(last_p[i], input[i] + blocks_len, rem * sizeof (uint8_t));
+    last_p[i][rem] = (uint8_t)0x80U;
+    store64_be(last_p[i] + last_n * (uint32_t)128U - (uint32_t)8U, total_len_bits);
+  }
+  Hacl_SHA2_Vec256_update_multi_512_4(st_p, input, blocks_n);
+  Hacl_SHA2_Vec256_update_multi_512_4(st_p, last_p, last_n);
+  for (uint32_t i = (uint32_t)0U; i < (uint32_t)4U; i++)
+  {
+    uint8_t out[64U] = { 0U };
+    for (uint32_t j = (uint32_t)0U; j < (uint32_t)8U; j++)
+    {
+      store64_be(out + j * (uint32_t)8U, st_p[i][j]);
+    }
+    memcpy(dst[i], out, hash_len * sizeof (uint8_t));
+  }
+}
+
+void Hacl_SHA2_Vec256_sha384_4(uint8_t **dst, uint32_t input_len, uint8_t **input)
+{
+  sha512_4(h384, (uint32_t)48U, dst, input_len, input);
+}
+
+void Hacl_SHA2_Vec256_sha512_4(uint8_t **dst, uint32_t input_len, uint8_t **input)
+{
+  sha512_4(h512, (uint32_t)64U, dst, input_len, input);
+}
+
+/*
+  Single message: the schedule (plus round constants) of four consecutive
+  blocks is computed in the four vector lanes, and the rounds, which are
+  serial within a message, run on scalar registers.
+*/
+
+void Hacl_SHA2_Vec256_update_multi_512(uint64_t *s, uint8_t *blocks, uint32_t n_blocks)
+{
+  uint64_t wk[320U];
+  for (uint32_t b = (uint32_t)0U; b < n_blocks; b = b + (uint32_t)4U)
+  {
+    uint32_t lanes = n_blocks - b;
+    if (lanes > (uint32_t)4U)
+    {
+      lanes = (uint32_t)4U;
+    }
+    uint8_t *bs[4U];
+    for (uint32_t l = (uint32_t)0U; l < (uint32_t)4U; l++)
+    {
+      uint32_t l1 = l;
+      if (l1 >= lanes)
+      {
+        l1 = lanes - (uint32_t)1U;
+      }
+      bs[l] = blocks + (b + l1) * (uint32_t)128U;
+    }
+    Lib_IntVector_Intrinsics_vec256 ws[16U];
+    load_ws4(ws, bs, (uint32_t)0U);
+    for (uint32_t i0 = (uint32_t)0U; i0 < (uint32_t)5U; i0++)
+    {
+      for (uint32_t i = (uint32_t)0U; i < (uint32_t)16U; i++)
+      {
+        uint32_t t = (uint32_t)16U * i0 + i;
+        Lib_IntVector_Intrinsics_vec256_store_le((uint8_t *)(wk + t * (uint32_t)4U),
+          Lib_IntVector_Intrinsics_vec256_add64(ws[i],
+            Lib_IntVector_Intrinsics_vec256_load64(k384_512[t])));
+      }
+      if (i0 < (uint32_t)4U)
+      {
+        next_ws4(ws);
+      }
+    }
+    for (uint32_t l = (uint32_t)0U; l < lanes; l++)
+    {
+      uint64_t a0 = s[0U];
+      uint64_t b0 = s[1U];
+      uint64_t c0 = s[2U];
+      uint64_t d0 = s[3U];
+      uint64_t e0 = s[4U];
+      uint64_t f0 = s[5U];
+      uint64_t g0 = s[6U];
+      uint64_t h0 = s[7U];
+      for (uint32_t t = (uint32_t)0U; t < (uint32_t)80U; t++)
+      {
+        uint64_t
+        sigma1 =
+          (e0 << (uint32_t)50U | e0 >> (uint32_t)14U)
+          ^ ((e0 << (uint32_t)46U | e0 >> (uint32_t)18U) ^ (e0 << (uint32_t)23U | e0 >> (uint32_t)41U));
+        uint64_t ch = (e0 & f0) ^ (~e0 & g0);
+        uint64_t t1 = h0 + sigma1 + ch + wk[t * (uint32_t)4U + l];
+        uint64_t
+        sigma0 =
+          (a0 << (uint32_t)36U | a0 >> (uint32_t)28U)
+          ^ ((a0 << (uint32_t)30U | a0 >> (uint32_t)34U) ^ (a0 << (uint32_t)25U | a0 >> (uint32_t)39U));
+        uint64_t maj = (a0 & b0) ^ ((a0 & c0) ^ (b0 & c0));
+        uint64_t t2 = sigma0 + maj;
+        h0 = g0;
+        g0 = f0;
+        f0 = e0;
+        e0 = d0 + t1;
+        d0 = c0;
+        c0 = b0;
+        b0 = a0;
+        a0 = t1 + t2;
+      }
+      s[0U] = s[0U] + a0;
+      s[1U] = s[1U] + b0;
+      s[2U] = s[2U] + c0;
+      s[3U] = s[3U] + d0;
+      s[4U] = s[4U] + e0;
+      s[5U] = s[5U] + f0;
+      s[6U] = s[6U] + g0;
+      s[7U] = s[7U] + h0;
+    }
+  }
+}
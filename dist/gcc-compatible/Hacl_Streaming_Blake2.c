@@ -713,6 +713,60 @@ Hacl_Streaming_Functor_state_s__K____uint32_t___uint32_t____
   return p;
 }
 
+#define BLAKE2S_IN_PLACE_BUF ((uint32_t)32U)
+
+#define BLAKE2S_IN_PLACE_BUF_LEN ((uint32_t)64U)
+
+#define BLAKE2S_IN_PLACE_WV ((uint32_t)96U)
+
+#define BLAKE2S_IN_PLACE_B ((uint32_t)160U)
+
+#define BLAKE2S_IN_PLACE_STATE_LEN ((uint32_t)16U)
+
+_Static_assert(sizeof (Hacl_Streaming_Functor_state_s__K____uint32_t___uint32_t____) <= BLAKE2S_IN_PLACE_BUF,
+  "Blake2s state header");
+
+_Static_assert(BLAKE2S_IN_PLACE_BUF + BLAKE2S_IN_PLACE_BUF_LEN <= BLAKE2S_IN_PLACE_WV,
+  "Blake2s buffer in place");
+
+_Static_assert(BLAKE2S_IN_PLACE_WV % sizeof (uint32_t) == 0U && BLAKE2S_IN_PLACE_B % sizeof (uint32_t) == 0U,
+  "Blake2s block state alignment");
+
+_Static_assert(BLAKE2S_IN_PLACE_WV + BLAKE2S_IN_PLACE_STATE_LEN * (uint32_t)sizeof (uint32_t)
+  <= BLAKE2S_IN_PLACE_B,
+  "Blake2s working vector in place");
+
+_Static_assert(BLAKE2S_IN_PLACE_B + BLAKE2S_IN_PLACE_STATE_LEN * (uint32_t)sizeof (uint32_t)
+  <= Hacl_Streaming_Blake2_blake2s_32_state_len,
+  "Blake2s hash state in place");
+
+Hacl_Streaming_Functor_state_s__K____uint32_t___uint32_t____
+*Hacl_Streaming_Blake2_blake2s_32_with_key_init_in_place(
+  uint8_t *mem,
+  uint32_t key_size,
+  uint8_t *k1
+)
+{
+  uint8_t *buf = mem + BLAKE2S_IN_PLACE_BUF;
+  uint32_t *wv = (uint32_t *)(mem + BLAKE2S_IN_PLACE_WV);
+  uint32_t *b = (uint32_t *)(mem + BLAKE2S_IN_PLACE_B);
+  memset(buf, 0U, BLAKE2S_IN_PLACE_BUF_LEN * sizeof (uint8_t));
+  memset(wv, 0U, BLAKE2S_IN_PLACE_STATE_LEN * sizeof (uint32_t));
+  memset(b, 0U, BLAKE2S_IN_PLACE_STATE_LEN * sizeof (uint32_t));
+  K____uint32_t___uint32_t_ block_state = { .fst = wv, .snd = b };
+  Hacl_Streaming_Functor_state_s__K____uint32_t___uint32_t____
+  *p = (Hacl_Streaming_Functor_state_s__K____uint32_t___uint32_t____ *)mem;
+  p[0U] = ((Hacl_Streaming_Functor_state_s__K____uint32_t___uint32_t____){ .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U });
+  Hacl_Blake2s_32_blake2s_init(block_state.fst, block_state.snd, key_size, k1, (uint32_t)32U);
+  return p;
+}
+
+Hacl_Streaming_Functor_state_s__K____uint32_t___uint32_t____
+*Hacl_Streaming_Blake2_blake2s_32_no_key_init_in_place(uint8_t *mem)
+{
+  return Hacl_Streaming_Blake2_blake2s_32_with_key_init_in_place(mem, (uint32_t)0U, NULL);
+}
+
 /*
   Update function when using a (potentially null) key
 */
@@ -1046,6 +1100,60 @@ Hacl_Streaming_Functor_state_s__K____uint64_t___uint64_t____
   return p;
 }
 
+#define BLAKE2B_IN_PLACE_BUF ((uint32_t)32U)
+
+#define BLAKE2B_IN_PLACE_BUF_LEN ((uint32_t)128U)
+
+#define BLAKE2B_IN_PLACE_WV ((uint32_t)160U)
+
+#define BLAKE2B_IN_PLACE_B ((uint32_t)288U)
+
+#define BLAKE2B_IN_PLACE_STATE_LEN ((uint32_t)16U)
+
+_Static_assert(sizeof (Hacl_Streaming_Functor_state_s__K____uint64_t___uint64_t____) <= BLAKE2B_IN_PLACE_BUF,
+  "Blake2b state header");
+
+_Static_assert(BLAKE2B_IN_PLACE_BUF + BLAKE2B_IN_PLACE_BUF_LEN <= BLAKE2B_IN_PLACE_WV,
+  "Blake2b buffer in place");
+
+_Static_assert(BLAKE2B_IN_PLACE_WV % sizeof (uint64_t) == 0U && BLAKE2B_IN_PLACE_B % sizeof (uint64_t) == 0U,
+  "Blake2b block state alignment");
+
+_Static_assert(BLAKE2B_IN_PLACE_WV + BLAKE2B_IN_PLACE_STATE_LEN * (uint32_t)sizeof (uint64_t)
+  <= BLAKE2B_IN_PLACE_B,
+  "Blake2b working vector in place");
+
+_Static_assert(BLAKE2B_IN_PLACE_B + BLAKE2B_IN_PLACE_STATE_LEN * (uint32_t)sizeof (uint64_t)
+  <= Hacl_Streaming_Blake2_blake2b_32_state_len,
+  "Blake2b hash state in place");
+
+Hacl_Streaming_Functor_state_s__K____uint64_t___uint64_t____
+*Hacl_Streaming_Blake2_blake2b_32_with_key_init_in_place(
+  uint8_t *mem,
+  uint32_t key_size,
+  uint8_t *k1
+)
+{
+  uint8_t *buf = mem + BLAKE2B_IN_PLACE_BUF;
+  uint64_t *wv = (uint64_t *)(mem + BLAKE2B_IN_PLACE_WV);
+  uint64_t *b = (uint64_t *)(mem + BLAKE2B_IN_PLACE_B);
+  memset(buf, 0U, BLAKE2B_IN_PLACE_BUF_LEN * sizeof (uint8_t));
+  memset(wv, 0U, BLAKE2B_IN_PLACE_STATE_LEN * sizeof (uint64_t));
+  memset(b, 0U, BLAKE2B_IN_PLACE_STATE_LEN * sizeof (uint64_t));
+  K____uint64_t___uint64_t_ block_state = { .fst = wv, .snd = b };
+  Hacl_Streaming_Functor_state_s__K____uint64_t___uint64_t____
+  *p = (Hacl_Streaming_Functor_state_s__K____uint64_t___uint64_t____ *)mem;
+  p[0U] = ((Hacl_Streaming_Functor_state_s__K____uint64_t___uint64_t____){ .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U });
+  Hacl_Blake2b_32_blake2b_init(block_state.fst, block_state.snd, key_size, k1, (uint32_t)64U);
+  return p;
+}
+
+Hacl_Streaming_Functor_state_s__K____uint64_t___uint64_t____
+*Hacl_Streaming_Blake2_blake2b_32_no_key_init_in_place(uint8_t *mem)
+{
+  return Hacl_Streaming_Blake2_blake2b_32_with_key_init_in_place(mem, (uint32_t)0U, NULL);
+}
+
 /*
   Update function when using a (potentially null) key
 */
@@ -143,6 +143,27 @@ Hacl_Streaming_Blake2_blake2b_32_no_key_free(
 Hacl_Streaming_Functor_state_s__K____uint32_t___uint32_t____
 *Hacl_Streaming_Blake2_blake2s_32_with_key_create_in(uint32_t key_size, uint8_t *k1);
 
+
+/*
+  Size and alignment of the caller-provided storage for
+  Hacl_Streaming_Blake2_blake2s_32_with_key_init_in_place and its no_key
+  counterpart: the streaming state, a block buffer and the two hash state
+  buffers. The resulting states must not be passed to free.
+*/
+#define Hacl_Streaming_Blake2_blake2s_32_state_len ((uint32_t)224U)
+
+#define Hacl_Streaming_Blake2_blake2s_32_state_align ((uint32_t)8U)
+
+Hacl_Streaming_Functor_state_s__K____uint32_t___uint32_t____
+*Hacl_Streaming_Blake2_blake2s_32_with_key_init_in_place(
+  uint8_t *mem,
+  uint32_t key_size,
+  uint8_t *k1
+);
+
+Hacl_Streaming_Functor_state_s__K____uint32_t___uint32_t____
+*Hacl_Streaming_Blake2_blake2s_32_no_key_init_in_place(uint8_t *mem);
+
 /*
   Update function when using a (potentially null) key
 */
@@ -179,6 +200,27 @@ Hacl_Streaming_Blake2_blake2s_32_with_key_free(
 Hacl_Streaming_Functor_state_s__K____uint64_t___uint64_t____
 *Hacl_Streaming_Blake2_blake2b_32_with_key_create_in(uint32_t key_size, uint8_t *k1);
 
+
+/*
+  Size and alignment of the caller-provided storage for
+  Hacl_Streaming_Blake2_blake2b_32_with_key_init_in_place and its no_key
+  counterpart: the streaming state, a block buffer and the two hash state
+  buffers. The resulting states must not be passed to free.
+*/
+#define Hacl_Streaming_Blake2_blake2b_32_state_len ((uint32_t)416U)
+
+#define Hacl_Streaming_Blake2_blake2b_32_state_align ((uint32_t)8U)
+
+Hacl_Streaming_Functor_state_s__K____uint64_t___uint64_t____
+*Hacl_Streaming_Blake2_blake2b_32_with_key_init_in_place(
+  uint8_t *mem,
+  uint32_t key_size,
+  uint8_t *k1
+);
+
+Hacl_Streaming_Functor_state_s__K____uint64_t___uint64_t____
+*Hacl_Streaming_Blake2_blake2b_32_no_key_init_in_place(uint8_t *mem);
+
 /*
   Update function when using a (potentially null) key
 */
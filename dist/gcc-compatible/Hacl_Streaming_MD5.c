@@ -38,6 +38,47 @@ Hacl_Streaming_Functor_state_s___uint32_t____ *Hacl_Streaming_MD5_legacy_create_
   return p;
 }
 
+#define MD5_IN_PLACE_BUF ((uint32_t)32U)
+
+#define MD5_IN_PLACE_BUF_LEN ((uint32_t)64U)
+
+#define MD5_IN_PLACE_BLOCK_STATE ((uint32_t)96U)
+
+#define MD5_IN_PLACE_BLOCK_STATE_LEN ((uint32_t)4U)
+
+_Static_assert(sizeof (Hacl_Streaming_Functor_state_s___uint32_t____) <= MD5_IN_PLACE_BUF,
+  "MD5 state header");
+
+_Static_assert(MD5_IN_PLACE_BUF + MD5_IN_PLACE_BUF_LEN <= MD5_IN_PLACE_BLOCK_STATE,
+  "MD5 buffer in place");
+
+_Static_assert(MD5_IN_PLACE_BLOCK_STATE % sizeof (uint32_t) == 0U, "MD5 block state alignment");
+
+_Static_assert(MD5_IN_PLACE_BLOCK_STATE
+  + MD5_IN_PLACE_BLOCK_STATE_LEN * (uint32_t)sizeof (uint32_t)
+  <= Hacl_Streaming_MD5_state_len,
+  "MD5 block state in place");
+
+Hacl_Streaming_Functor_state_s___uint32_t____
+*Hacl_Streaming_MD5_legacy_init_in_place_md5(uint8_t *mem)
+{
+  uint8_t *buf = mem + MD5_IN_PLACE_BUF;
+  uint32_t *block_state = (uint32_t *)(mem + MD5_IN_PLACE_BLOCK_STATE);
+  memset(buf, 0U, MD5_IN_PLACE_BUF_LEN * sizeof (uint8_t));
+  Hacl_Streaming_Functor_state_s___uint32_t____
+  *p = (Hacl_Streaming_Functor_state_s___uint32_t____ *)mem;
+  p[0U] =
+    (
+      (Hacl_Streaming_Functor_state_s___uint32_t____){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+  Hacl_Hash_Core_MD5_legacy_init(block_state);
+  return p;
+}
+
 void Hacl_Streaming_MD5_legacy_init_md5(Hacl_Streaming_Functor_state_s___uint32_t____ *s)
 {
   Hacl_Streaming_Functor_state_s___uint32_t____ scrut = *s;
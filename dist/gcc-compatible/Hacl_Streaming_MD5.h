@@ -42,6 +42,19 @@ extern "C" {
 
 Hacl_Streaming_Functor_state_s___uint32_t____ *Hacl_Streaming_MD5_legacy_create_in_md5();
 
+
+/*
+  Size and alignment of the caller-provided storage for
+  Hacl_Streaming_MD5_legacy_init_in_place_md5: the streaming state, a block
+  buffer and the hash state. The resulting state must not be passed to free.
+*/
+#define Hacl_Streaming_MD5_state_len ((uint32_t)112U)
+
+#define Hacl_Streaming_MD5_state_align ((uint32_t)8U)
+
+Hacl_Streaming_Functor_state_s___uint32_t____
+*Hacl_Streaming_MD5_legacy_init_in_place_md5(uint8_t *mem);
+
 void Hacl_Streaming_MD5_legacy_init_md5(Hacl_Streaming_Functor_state_s___uint32_t____ *s);
 
 void
@@ -43,6 +43,60 @@ Hacl_Streaming_Functor_state_s___uint64_t___uint8_t_
   return p;
 }
 
+#define POLY1305_IN_PLACE_BUF ((uint32_t)32U)
+
+#define POLY1305_IN_PLACE_BUF_LEN ((uint32_t)16U)
+
+#define POLY1305_IN_PLACE_BLOCK_STATE ((uint32_t)48U)
+
+#define POLY1305_IN_PLACE_BLOCK_STATE_LEN ((uint32_t)25U)
+
+#define POLY1305_IN_PLACE_KEY ((uint32_t)248U)
+
+#define POLY1305_IN_PLACE_KEY_LEN ((uint32_t)32U)
+
+_Static_assert(sizeof (Hacl_Streaming_Functor_state_s___uint64_t___uint8_t_) <= POLY1305_IN_PLACE_BUF,
+  "Poly1305 state header");
+
+_Static_assert(POLY1305_IN_PLACE_BUF + POLY1305_IN_PLACE_BUF_LEN <= POLY1305_IN_PLACE_BLOCK_STATE,
+  "Poly1305 buffer in place");
+
+_Static_assert(POLY1305_IN_PLACE_BLOCK_STATE % sizeof (uint64_t) == 0U,
+  "Poly1305 block state alignment");
+
+_Static_assert(POLY1305_IN_PLACE_BLOCK_STATE
+  + POLY1305_IN_PLACE_BLOCK_STATE_LEN * (uint32_t)sizeof (uint64_t)
+  <= POLY1305_IN_PLACE_KEY,
+  "Poly1305 block state in place");
+
+_Static_assert(POLY1305_IN_PLACE_KEY + POLY1305_IN_PLACE_KEY_LEN
+  <= Hacl_Streaming_Poly1305_32_state_len,
+  "Poly1305 key in place");
+
+Hacl_Streaming_Functor_state_s___uint64_t___uint8_t_
+*Hacl_Streaming_Poly1305_32_init_in_place(uint8_t *mem, uint8_t *k)
+{
+  uint8_t *buf = mem + POLY1305_IN_PLACE_BUF;
+  uint64_t *block_state = (uint64_t *)(mem + POLY1305_IN_PLACE_BLOCK_STATE);
+  uint8_t *k_ = mem + POLY1305_IN_PLACE_KEY;
+  memset(buf, 0U, POLY1305_IN_PLACE_BUF_LEN * sizeof (uint8_t));
+  memset(block_state, 0U, POLY1305_IN_PLACE_BLOCK_STATE_LEN * sizeof (uint64_t));
+  memcpy(k_, k, POLY1305_IN_PLACE_KEY_LEN * sizeof (uint8_t));
+  Hacl_Streaming_Functor_state_s___uint64_t___uint8_t_
+  *p = (Hacl_Streaming_Functor_state_s___uint64_t___uint8_t_ *)mem;
+  p[0U] =
+    (
+      (Hacl_Streaming_Functor_state_s___uint64_t___uint8_t_){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U,
+        .p_key = k_
+      }
+    );
+  Hacl_Poly1305_32_poly1305_init(block_state, k);
+  return p;
+}
+
 void
 Hacl_Streaming_Poly1305_32_init(
   uint8_t *k,
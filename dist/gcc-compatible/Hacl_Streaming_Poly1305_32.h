@@ -51,6 +51,20 @@ Hacl_Streaming_Functor_state_s___uint64_t___uint8_t_;
 Hacl_Streaming_Functor_state_s___uint64_t___uint8_t_
 *Hacl_Streaming_Poly1305_32_create_in(uint8_t *k);
 
+
+/*
+  Size and alignment of the caller-provided storage for
+  Hacl_Streaming_Poly1305_32_init_in_place: the streaming state, a block
+  buffer, the Poly1305 state and a copy of the key. The resulting state must
+  not be passed to free.
+*/
+#define Hacl_Streaming_Poly1305_32_state_len ((uint32_t)280U)
+
+#define Hacl_Streaming_Poly1305_32_state_align ((uint32_t)8U)
+
+Hacl_Streaming_Functor_state_s___uint64_t___uint8_t_
+*Hacl_Streaming_Poly1305_32_init_in_place(uint8_t *mem, uint8_t *k);
+
 void
 Hacl_Streaming_Poly1305_32_init(
   uint8_t *k,
@@ -38,6 +38,47 @@ Hacl_Streaming_Functor_state_s___uint32_t____ *Hacl_Streaming_SHA1_legacy_create
   return p;
 }
 
+#define SHA1_IN_PLACE_BUF ((uint32_t)32U)
+
+#define SHA1_IN_PLACE_BUF_LEN ((uint32_t)64U)
+
+#define SHA1_IN_PLACE_BLOCK_STATE ((uint32_t)96U)
+
+#define SHA1_IN_PLACE_BLOCK_STATE_LEN ((uint32_t)5U)
+
+_Static_assert(sizeof (Hacl_Streaming_Functor_state_s___uint32_t____) <= SHA1_IN_PLACE_BUF,
+  "SHA1 state header");
+
+_Static_assert(SHA1_IN_PLACE_BUF + SHA1_IN_PLACE_BUF_LEN <= SHA1_IN_PLACE_BLOCK_STATE,
+  "SHA1 buffer in place");
+
+_Static_assert(SHA1_IN_PLACE_BLOCK_STATE % sizeof (uint32_t) == 0U, "SHA1 block state alignment");
+
+_Static_assert(SHA1_IN_PLACE_BLOCK_STATE
+  + SHA1_IN_PLACE_BLOCK_STATE_LEN * (uint32_t)sizeof (uint32_t)
+  <= Hacl_Streaming_SHA1_state_len,
+  "SHA1 block state in place");
+
+Hacl_Streaming_Functor_state_s___uint32_t____
+*Hacl_Streaming_SHA1_legacy_init_in_place_sha1(uint8_t *mem)
+{
+  uint8_t *buf = mem + SHA1_IN_PLACE_BUF;
+  uint32_t *block_state = (uint32_t *)(mem + SHA1_IN_PLACE_BLOCK_STATE);
+  memset(buf, 0U, SHA1_IN_PLACE_BUF_LEN * sizeof (uint8_t));
+  Hacl_Streaming_Functor_state_s___uint32_t____
+  *p = (Hacl_Streaming_Functor_state_s___uint32_t____ *)mem;
+  p[0U] =
+    (
+      (Hacl_Streaming_Functor_state_s___uint32_t____){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+  Hacl_Hash_Core_SHA1_legacy_init(block_state);
+  return p;
+}
+
 void Hacl_Streaming_SHA1_legacy_init_sha1(Hacl_Streaming_Functor_state_s___uint32_t____ *s)
 {
   Hacl_Streaming_Functor_state_s___uint32_t____ scrut = *s;
@@ -42,6 +42,19 @@ extern "C" {
 
 Hacl_Streaming_Functor_state_s___uint32_t____ *Hacl_Streaming_SHA1_legacy_create_in_sha1();
 
+
+/*
+  Size and alignment of the caller-provided storage for
+  Hacl_Streaming_SHA1_legacy_init_in_place_sha1: the streaming state, a block
+  buffer and the hash state. The resulting state must not be passed to free.
+*/
+#define Hacl_Streaming_SHA1_state_len ((uint32_t)120U)
+
+#define Hacl_Streaming_SHA1_state_align ((uint32_t)8U)
+
+Hacl_Streaming_Functor_state_s___uint32_t____
+*Hacl_Streaming_SHA1_legacy_init_in_place_sha1(uint8_t *mem);
+
 void Hacl_Streaming_SHA1_legacy_init_sha1(Hacl_Streaming_Functor_state_s___uint32_t____ *s);
 
 void
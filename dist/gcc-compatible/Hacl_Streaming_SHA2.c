@@ -38,6 +38,47 @@ Hacl_Streaming_Functor_state_s___uint32_t____ *Hacl_Streaming_SHA2_create_in_224
   return p;
 }
 
+#define SHA2_256_IN_PLACE_BUF ((uint32_t)32U)
+
+#define SHA2_256_IN_PLACE_BUF_LEN ((uint32_t)64U)
+
+#define SHA2_256_IN_PLACE_BLOCK_STATE ((uint32_t)96U)
+
+#define SHA2_256_IN_PLACE_BLOCK_STATE_LEN ((uint32_t)8U)
+
+_Static_assert(sizeof (Hacl_Streaming_Functor_state_s___uint32_t____) <= SHA2_256_IN_PLACE_BUF,
+  "SHA2-256 state header");
+
+_Static_assert(SHA2_256_IN_PLACE_BUF + SHA2_256_IN_PLACE_BUF_LEN <= SHA2_256_IN_PLACE_BLOCK_STATE,
+  "SHA2-256 buffer in place");
+
+_Static_assert(SHA2_256_IN_PLACE_BLOCK_STATE % sizeof (uint32_t) == 0U, "SHA2-256 block state alignment");
+
+_Static_assert(SHA2_256_IN_PLACE_BLOCK_STATE
+  + SHA2_256_IN_PLACE_BLOCK_STATE_LEN * (uint32_t)sizeof (uint32_t)
+  <= Hacl_Streaming_SHA2_state_len_256,
+  "SHA2-256 block state in place");
+
+Hacl_Streaming_Functor_state_s___uint32_t____
+*Hacl_Streaming_SHA2_init_in_place_224(uint8_t *mem)
+{
+  uint8_t *buf = mem + SHA2_256_IN_PLACE_BUF;
+  uint32_t *block_state = (uint32_t *)(mem + SHA2_256_IN_PLACE_BLOCK_STATE);
+  memset(buf, 0U, SHA2_256_IN_PLACE_BUF_LEN * sizeof (uint8_t));
+  Hacl_Streaming_Functor_state_s___uint32_t____
+  *p = (Hacl_Streaming_Functor_state_s___uint32_t____ *)mem;
+  p[0U] =
+    (
+      (Hacl_Streaming_Functor_state_s___uint32_t____){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+  Hacl_Hash_Core_SHA2_init_224(block_state);
+  return p;
+}
+
 void Hacl_Streaming_SHA2_init_224(Hacl_Streaming_Functor_state_s___uint32_t____ *s)
 {
   Hacl_Streaming_Functor_state_s___uint32_t____ scrut = *s;
@@ -275,6 +316,26 @@ Hacl_Streaming_Functor_state_s___uint32_t____ *Hacl_Streaming_SHA2_create_in_256
   return p;
 }
 
+Hacl_Streaming_Functor_state_s___uint32_t____
+*Hacl_Streaming_SHA2_init_in_place_256(uint8_t *mem)
+{
+  uint8_t *buf = mem + SHA2_256_IN_PLACE_BUF;
+  uint32_t *block_state = (uint32_t *)(mem + SHA2_256_IN_PLACE_BLOCK_STATE);
+  memset(buf, 0U, SHA2_256_IN_PLACE_BUF_LEN * sizeof (uint8_t));
+  Hacl_Streaming_Functor_state_s___uint32_t____
+  *p = (Hacl_Streaming_Functor_state_s___uint32_t____ *)mem;
+  p[0U] =
+    (
+      (Hacl_Streaming_Functor_state_s___uint32_t____){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+  Hacl_Hash_Core_SHA2_init_256(block_state);
+  return p;
+}
+
 void Hacl_Streaming_SHA2_init_256(Hacl_Streaming_Functor_state_s___uint32_t____ *s)
 {
   Hacl_Streaming_Functor_state_s___uint32_t____ scrut = *s;
@@ -512,6 +573,47 @@ Hacl_Streaming_Functor_state_s___uint64_t____ *Hacl_Streaming_SHA2_create_in_384
   return p;
 }
 
+#define SHA2_512_IN_PLACE_BUF ((uint32_t)32U)
+
+#define SHA2_512_IN_PLACE_BUF_LEN ((uint32_t)128U)
+
+#define SHA2_512_IN_PLACE_BLOCK_STATE ((uint32_t)160U)
+
+#define SHA2_512_IN_PLACE_BLOCK_STATE_LEN ((uint32_t)8U)
+
+_Static_assert(sizeof (Hacl_Streaming_Functor_state_s___uint64_t____) <= SHA2_512_IN_PLACE_BUF,
+  "SHA2-512 state header");
+
+_Static_assert(SHA2_512_IN_PLACE_BUF + SHA2_512_IN_PLACE_BUF_LEN <= SHA2_512_IN_PLACE_BLOCK_STATE,
+  "SHA2-512 buffer in place");
+
+_Static_assert(SHA2_512_IN_PLACE_BLOCK_STATE % sizeof (uint64_t) == 0U, "SHA2-512 block state alignment");
+
+_Static_assert(SHA2_512_IN_PLACE_BLOCK_STATE
+  + SHA2_512_IN_PLACE_BLOCK_STATE_LEN * (uint32_t)sizeof (uint64_t)
+  <= Hacl_Streaming_SHA2_state_len_512,
+  "SHA2-512 block state in place");
+
+Hacl_Streaming_Functor_state_s___uint64_t____
+*Hacl_Streaming_SHA2_init_in_place_384(uint8_t *mem)
+{
+  uint8_t *buf = mem + SHA2_512_IN_PLACE_BUF;
+  uint64_t *block_state = (uint64_t *)(mem + SHA2_512_IN_PLACE_BLOCK_STATE);
+  memset(buf, 0U, SHA2_512_IN_PLACE_BUF_LEN * sizeof (uint8_t));
+  Hacl_Streaming_Functor_state_s___uint64_t____
+  *p = (Hacl_Streaming_Functor_state_s___uint64_t____ *)mem;
+  p[0U] =
+    (
+      (Hacl_Streaming_Functor_state_s___uint64_t____){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+  Hacl_Hash_Core_SHA2_init_384(block_state);
+  return p;
+}
+
 void Hacl_Streaming_SHA2_init_384(Hacl_Streaming_Functor_state_s___uint64_t____ *s)
 {
   Hacl_Streaming_Functor_state_s___uint64_t____ scrut = *s;
@@ -752,6 +854,26 @@ Hacl_Streaming_Functor_state_s___uint64_t____ *Hacl_Streaming_SHA2_create_in_512
   return p;
 }
 
+Hacl_Streaming_Functor_state_s___uint64_t____
+*Hacl_Streaming_SHA2_init_in_place_512(uint8_t *mem)
+{
+  uint8_t *buf = mem + SHA2_512_IN_PLACE_BUF;
+  uint64_t *block_state = (uint64_t *)(mem + SHA2_512_IN_PLACE_BLOCK_STATE);
+  memset(buf, 0U, SHA2_512_IN_PLACE_BUF_LEN * sizeof (uint8_t));
+  Hacl_Streaming_Functor_state_s___uint64_t____
+  *p = (Hacl_Streaming_Functor_state_s___uint64_t____ *)mem;
+  p[0U] =
+    (
+      (Hacl_Streaming_Functor_state_s___uint64_t____){
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = (uint64_t)0U
+      }
+    );
+  Hacl_Hash_Core_SHA2_init_512(block_state);
+  return p;
+}
+
 void Hacl_Streaming_SHA2_init_512(Hacl_Streaming_Functor_state_s___uint64_t____ *s)
 {
   Hacl_Streaming_Functor_state_s___uint64_t____ scrut = *s;
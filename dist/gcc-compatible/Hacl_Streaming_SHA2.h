@@ -50,6 +50,22 @@ Hacl_Streaming_Functor_state_s___uint32_t____;
 
 Hacl_Streaming_Functor_state_s___uint32_t____ *Hacl_Streaming_SHA2_create_in_224();
 
+/*
+  Size and alignment of the caller-provided storage for the
+  Hacl_Streaming_SHA2_init_in_place_* functions: the streaming state, a block
+  buffer and the hash state. The 256 size also serves SHA2-224, and the 512 size
+  SHA2-384. The resulting states work with the update/finish functions of this
+  file (and of EverCrypt_Streaming_SHA2) but must not be passed to free.
+*/
+#define Hacl_Streaming_SHA2_state_len_256 ((uint32_t)128U)
+
+#define Hacl_Streaming_SHA2_state_len_512 ((uint32_t)224U)
+
+#define Hacl_Streaming_SHA2_state_align ((uint32_t)8U)
+
+Hacl_Streaming_Functor_state_s___uint32_t____
+*Hacl_Streaming_SHA2_init_in_place_224(uint8_t *mem);
+
 void Hacl_Streaming_SHA2_init_224(Hacl_Streaming_Functor_state_s___uint32_t____ *s);
 
 void
@@ -66,6 +82,9 @@ void Hacl_Streaming_SHA2_free_224(Hacl_Streaming_Functor_state_s___uint32_t____
 
 Hacl_Streaming_Functor_state_s___uint32_t____ *Hacl_Streaming_SHA2_create_in_256();
 
+Hacl_Streaming_Functor_state_s___uint32_t____
+*Hacl_Streaming_SHA2_init_in_place_256(uint8_t *mem);
+
 void Hacl_Streaming_SHA2_init_256(Hacl_Streaming_Functor_state_s___uint32_t____ *s);
 
 void
@@ -90,6 +109,9 @@ Hacl_Streaming_Functor_state_s___uint64_t____;
 
 Hacl_Streaming_Functor_state_s___uint64_t____ *Hacl_Streaming_SHA2_create_in_384();
 
+Hacl_Streaming_Functor_state_s___uint64_t____
+*Hacl_Streaming_SHA2_init_in_place_384(uint8_t *mem);
+
 void Hacl_Streaming_SHA2_init_384(Hacl_Streaming_Functor_state_s___uint64_t____ *s);
 
 void
@@ -106,6 +128,9 @@ void Hacl_Streaming_SHA2_free_384(Hacl_Streaming_Functor_state_s___uint64_t____
 
 Hacl_Streaming_Functor_state_s___uint64_t____ *Hacl_Streaming_SHA2_create_in_512();
 
+Hacl_Streaming_Functor_state_s___uint64_t____
+*Hacl_Streaming_SHA2_init_in_place_512(uint8_t *mem);
+
 void Hacl_Streaming_SHA2_init_512(Hacl_Streaming_Functor_state_s___uint64_t____ *s);
 
 void
@@ -240,6 +240,30 @@ inline MerkleTree_Low_merkle_tree
   return MerkleTree_Low_mt_create_custom(hash_size, i, hash_fun);
 }
 
+/*
+  Construction with custom hash functions and contiguous level storage
+
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree
+
+  Note: each level of the tree is kept in one growable buffer of hash_size-strided
+  hashes rather than one allocation per hash. Paths returned by mt_get_path
+  point into these buffers and are only valid until the tree is next modified.
+  Both storage modes serialize to the same bytes; mt_deserialize always returns
+  a tree with per-hash storage.
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_create_custom_arena(
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  return MerkleTree_Low_mt_create_custom_arena(hash_size, i, hash_fun);
+}
+
 /*
   Destruction
 
@@ -271,6 +295,31 @@ inline bool mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v)
   return MerkleTree_Low_mt_insert_pre(mt, v);
 }
 
+/*
+  Batch insertion
+
+  @param[in]  mt     The Merkle tree
+  @param[in]  leaves n hashes of hash_size bytes, back to back
+  @param[in]  n      The number of hashes to insert
+
+  Same result as inserting the n hashes in order with mt_insert, but the
+  interior nodes are computed level by level and, with the default hash
+  function, on multi-buffer SHA2-256. The tree makes copies of the hashes and
+  leaves is not modified.
+*/
+inline void mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint8_t *leaves, uint32_t n)
+{
+  MerkleTree_Low_mt_insert_batch(mt, leaves, n);
+}
+
+/*
+  Precondition predicate for mt_insert_batch
+*/
+inline bool mt_insert_batch_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *leaves, uint32_t n)
+{
+  return MerkleTree_Low_mt_insert_batch_pre(mt, leaves, n);
+}
+
 /*
   Getting the Merkle root
 
@@ -509,6 +558,125 @@ inline MerkleTree_Low_path *mt_deserialize_path(const uint8_t *buf, uint64_t len
   return MerkleTree_Low_Serialization_mt_deserialize_path(buf, len);
 }
 
+/*
+  Size of a tree image
+
+  @param[in]  mt     The Merkle tree
+  @param[in]  slack  Room to reserve for this many more leaves
+
+  return the number of bytes mt_image_write needs for mt; a tree image can be
+  larger than 4 GiB
+*/
+inline uint64_t mt_image_size(const MerkleTree_Low_merkle_tree *mt, uint32_t slack)
+{
+  return MerkleTree_Low_Serialization_mt_image_size(mt, slack);
+}
+
+/*
+  Writing a tree image
+
+  @param[in]  mt     The Merkle tree
+  @param[in]  slack  Room to reserve for this many more leaves
+  @param[out] buf    The buffer to write the image into
+  @param[in]  len    Length of buf
+
+  return the number of bytes written, or 0 if len is less than
+  mt_image_size(mt, slack)
+
+  An image is a versioned layout of the tree, meant to be written to a file
+  and mapped back in memory: each level is stored as its hashes back to back,
+  followed by room for the level to grow by the slack.
+*/
+inline uint64_t
+mt_image_write(const MerkleTree_Low_merkle_tree *mt, uint32_t slack, uint8_t *buf, uint64_t len)
+{
+  return MerkleTree_Low_Serialization_mt_image_write(mt, slack, buf, len);
+}
+
+/*
+  Opening a tree image in place
+
+  @param[in]  buf       The image, e.g. a mapped file written by mt_image_write
+  @param[in]  len       Length of buf
+  @param[in]  writable  Whether buf may be written to
+  @param[in]  hash_fun  Hash function
+
+  return pointer to the new tree if the image is valid, NULL otherwise
+
+  Only the header of the image is read: the tree uses the levels of buf as its
+  contiguous level storage, without copying them, so buf must outlive the
+  tree; mt_free does not release it. A level is copied to the heap the first
+  time it grows past the room it has in buf. If writable is true, new nodes
+  are written in buf as long as they fit, which with a private writable
+  mapping copies only the pages that change; otherwise buf is never written
+  to and can be a read-only mapping.
+*/
+inline MerkleTree_Low_merkle_tree
+*mt_image_open(
+  uint8_t *buf,
+  uint64_t len,
+  bool writable,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  return MerkleTree_Low_Serialization_mt_image_open(buf, len, writable, hash_fun);
+}
+
+/*
+  Size of a tree delta
+
+  @param[in]  mt     The Merkle tree
+  @param[in]  since  The number of leaves of mt, offset included, at the checkpoint
+
+  return the number of bytes mt_delta_write needs, or 0 if the leaves of the
+  checkpoint are no longer all in mt (since is not between offset + i and
+  offset + j)
+*/
+inline uint64_t mt_delta_size(const MerkleTree_Low_merkle_tree *mt, uint64_t since)
+{
+  return MerkleTree_Low_Serialization_mt_delta_size(mt, since);
+}
+
+/*
+  Writing a tree delta
+
+  @param[in]  mt     The Merkle tree
+  @param[in]  since  The number of leaves of mt, offset included, at the checkpoint
+  @param[out] buf    The buffer to write the delta into
+  @param[in]  len    Length of buf
+
+  return the number of bytes written, or 0 on failure
+
+  The delta holds the leaves and interior nodes of mt added since the
+  checkpoint, so its size grows with the number of leaves inserted, not with
+  the size of the tree. If mt was retracted since the checkpoint, since must
+  be the smallest number of leaves it had in between.
+*/
+inline uint64_t
+mt_delta_write(const MerkleTree_Low_merkle_tree *mt, uint64_t since, uint8_t *buf, uint64_t len)
+{
+  return MerkleTree_Low_Serialization_mt_delta_write(mt, since, buf, len);
+}
+
+/*
+  Applying a tree delta
+
+  @param[in]  mt   The Merkle tree, as it was at the checkpoint of the delta
+  @param[in]  buf  The delta
+  @param[in]  len  Length of buf
+
+  return true if the delta was applied, false if it does not fit mt
+
+  mt is first retracted to the checkpoint, then gets the nodes of the delta
+  without hashing them, and is flushed as the tree the delta was written from.
+  The leaves of mt up to the checkpoint are not checked: compare the new root
+  of mt with a trusted one if needed.
+*/
+inline bool mt_delta_apply(MerkleTree_Low_merkle_tree *mt, const uint8_t *buf, uint64_t len)
+{
+  return MerkleTree_Low_Serialization_mt_delta_apply(mt, buf, len);
+}
+
 /*
   Default hash function
 */
@@ -657,6 +825,17 @@ inline MerkleTree_Low_merkle_tree *mt_create(uint8_t *init)
   return MerkleTree_Low_mt_create_custom((uint32_t)32U, init, mt_sha256_compress);
 }
 
+/*
+  Construction wired to sha256 from EverCrypt, with contiguous level storage
+  (see mt_create_custom_arena)
+
+  @param[in]  init   The initial hash
+*/
+inline MerkleTree_Low_merkle_tree *mt_create_arena(uint8_t *init)
+{
+  return MerkleTree_Low_mt_create_custom_arena((uint32_t)32U, init, mt_sha256_compress);
+}
+
 uint32_t MerkleTree_Low_uint32_32_max = (uint32_t)4294967295U;
 
 uint64_t MerkleTree_Low_uint32_max = (uint64_t)4294967295U;
@@ -896,7 +1075,8 @@ static MerkleTree_Low_merkle_tree
         .rhs_ok = false,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .ha = NULL
       }
     );
   return mt;
@@ -911,6 +1091,103 @@ index__LowStar_Vector_vector_str__uint8_t_(
   return vec.vs[i];
 }
 
+/*
+  Contiguous level storage: when mt->ha is not NULL, level lv holds ha[lv].sz
+  hashes back to back in ha[lv].hs, and the hash vectors in mt->hs stay empty.
+  A borrowed level points into a tree image (see mt_image_open): it is never
+  freed, and is copied to the heap before it grows past its capacity.
+*/
+static uint8_t
+*arena_index(uint32_t hsz, MerkleTree_Low_Datastructures_hash_arena a, uint32_t i)
+{
+  return a.hs + (size_t)i * (size_t)hsz;
+}
+
+/*
+  Grows a so that n more hashes fit after its sz current ones; requires
+  a.sz + n <= 2^32 - 1.
+*/
+static MerkleTree_Low_Datastructures_hash_arena
+arena_reserve(uint32_t hsz, MerkleTree_Low_Datastructures_hash_arena a, uint32_t n)
+{
+  uint32_t sz = a.sz;
+  uint32_t cap = a.cap;
+  if (cap - sz >= n)
+  {
+    return a;
+  }
+  uint32_t ncap = cap;
+  while (ncap - sz < n)
+  {
+    ncap = LowStar_Vector_new_capacity(ncap);
+  }
+  KRML_CHECK_SIZE((size_t)hsz, ncap);
+  uint8_t *nhs = KRML_HOST_MALLOC((size_t)ncap * (size_t)hsz);
+  if (sz > (uint32_t)0U)
+  {
+    memcpy(nhs, a.hs, (size_t)sz * (size_t)hsz);
+  }
+  if (!a.borrowed)
+  {
+    KRML_HOST_FREE(a.hs);
+  }
+  return
+    (
+      (MerkleTree_Low_Datastructures_hash_arena){
+        .sz = sz,
+        .cap = ncap,
+        .hs = nhs,
+        .borrowed = false
+      }
+    );
+}
+
+static MerkleTree_Low_Datastructures_hash_arena
+arena_insert_copy(uint32_t hsz, MerkleTree_Low_Datastructures_hash_arena a, uint8_t *v)
+{
+  MerkleTree_Low_Datastructures_hash_arena a1 = arena_reserve(hsz, a, (uint32_t)1U);
+  memcpy(arena_index(hsz, a1, a1.sz), v, hsz * sizeof (uint8_t));
+  return
+    (
+      (MerkleTree_Low_Datastructures_hash_arena){
+        .sz = a1.sz + (uint32_t)1U,
+        .cap = a1.cap,
+        .hs = a1.hs,
+        .borrowed = a1.borrowed
+      }
+    );
+}
+
+static uint32_t
+level_size(
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  MerkleTree_Low_Datastructures_hash_arena *ha,
+  uint32_t lv
+)
+{
+  if (ha != NULL)
+  {
+    return ha[lv].sz;
+  }
+  return index__LowStar_Vector_vector_str__uint8_t_(hs, lv).sz;
+}
+
+static uint8_t
+*level_index(
+  uint32_t hsz,
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  MerkleTree_Low_Datastructures_hash_arena *ha,
+  uint32_t lv,
+  uint32_t i
+)
+{
+  if (ha != NULL)
+  {
+    return arena_index(hsz, ha[lv], i);
+  }
+  return index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv), i);
+}
+
 static void
 free_elems__LowStar_Vector_vector_str__uint8_t__uint32_t(
   regional__uint32_t_MerkleTree_Low_Datastructures_hash_vec rg,
@@ -973,6 +1250,17 @@ void MerkleTree_Low_mt_free(MerkleTree_Low_merkle_tree *mt)
   regional__uint32_t__uint8_t_
   x0 = { .state = mtv.hash_size, .dummy = NULL, .r_alloc = hash_r_alloc, .r_free = hash_r_free };
   x00.r_free(x0.state, mtv.mroot);
+  if (mtv.ha != NULL)
+  {
+    for (uint32_t lv = (uint32_t)0U; lv < mtv.hs.sz; lv++)
+    {
+      if (!mtv.ha[lv].borrowed)
+      {
+        KRML_HOST_FREE(mtv.ha[lv].hs);
+      }
+    }
+    KRML_HOST_FREE(mtv.ha);
+  }
   KRML_HOST_FREE(mt);
 }
 
@@ -1018,32 +1306,39 @@ insert_(
   uint32_t lv,
   uint32_t j,
   MerkleTree_Low_Datastructures_hash_vv hs,
+  MerkleTree_Low_Datastructures_hash_arena *ha,
   uint8_t *acc,
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 )
 {
-  MerkleTree_Low_Datastructures_hash_vec
-  uu____0 = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
-  MerkleTree_Low_Datastructures_hash_vec
-  ihv =
-    insert_copy___uint8_t__uint32_t((
-        (regional__uint32_t__uint8_t_){
-          .state = hsz,
-          .dummy = NULL,
-          .r_alloc = hash_r_alloc,
-          .r_free = hash_r_free
-        }
-      ),
-      hash_copy,
-      uu____0,
-      acc);
-  assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, ihv);
-  if (j % (uint32_t)2U == (uint32_t)1U)
+  if (ha != NULL)
+  {
+    ha[lv] = arena_insert_copy(hsz, ha[lv], acc);
+  }
+  else
   {
     MerkleTree_Low_Datastructures_hash_vec
-    lvhs = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
-    hash_fun(index___uint8_t_(lvhs, lvhs.sz - (uint32_t)2U), acc, acc);
-    insert_(hsz, lv + (uint32_t)1U, j / (uint32_t)2U, hs, acc, hash_fun);
+    uu____0 = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
+    MerkleTree_Low_Datastructures_hash_vec
+    ihv =
+      insert_copy___uint8_t__uint32_t((
+          (regional__uint32_t__uint8_t_){
+            .state = hsz,
+            .dummy = NULL,
+            .r_alloc = hash_r_alloc,
+            .r_free = hash_r_free
+          }
+        ),
+        hash_copy,
+        uu____0,
+        acc);
+    assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, ihv);
+  }
+  if (j % (uint32_t)2U == (uint32_t)1U)
+  {
+    uint32_t lvsz = level_size(hs, ha, lv);
+    hash_fun(level_index(hsz, hs, ha, lv, lvsz - (uint32_t)2U), acc, acc);
+    insert_(hsz, lv + (uint32_t)1U, j / (uint32_t)2U, hs, ha, acc, hash_fun);
     return;
   }
 }
@@ -1062,7 +1357,7 @@ void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
   MerkleTree_Low_merkle_tree mtv = *mt;
   MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
   uint32_t hsz1 = mtv.hash_size;
-  insert_(hsz1, (uint32_t)0U, mtv.j, hs, v, mtv.hash_fun);
+  insert_(hsz1, (uint32_t)0U, mtv.j, hs, mtv.ha, v, mtv.hash_fun);
   *mt
   =
     (
@@ -1075,7 +1370,178 @@ void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v)
         .rhs_ok = false,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .ha = mtv.ha
+      }
+    );
+}
+
+/*
+  dst[k] = hash_fun(src[2k], src[2k + 1]) for k < n, over hsz-strided hashes.
+  Pairs for the default hash function are compressed by groups of eight on the
+  multi-buffer SHA2-256 kernels.
+*/
+static void
+hash_pairs(
+  uint32_t hsz,
+  uint32_t n,
+  uint8_t *src,
+  uint8_t *dst,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  if (hash_fun == mt_sha256_compress && hsz == (uint32_t)32U)
+  {
+    uint32_t st[64U] = { 0U };
+    uint32_t *sts[8U];
+    uint8_t *blocks[8U];
+    for (uint32_t k = (uint32_t)0U; k < n; k = k + (uint32_t)8U)
+    {
+      uint32_t c = n - k < (uint32_t)8U ? n - k : (uint32_t)8U;
+      for (uint32_t l = (uint32_t)0U; l < c; l++)
+      {
+        sts[l] = st + (uint32_t)8U * l;
+        Hacl_Hash_Core_SHA2_init_256(sts[l]);
+        blocks[l] = src + (size_t)(k + l) * (size_t)64U;
+      }
+      EverCrypt_Hash_update_multi_256_many(c, sts, blocks, (uint32_t)1U);
+      for (uint32_t l = (uint32_t)0U; l < c; l++)
+      {
+        uint8_t *o = dst + (size_t)(k + l) * (size_t)32U;
+        for (uint32_t w = (uint32_t)0U; w < (uint32_t)8U; w++)
+        {
+          store32_be(o + (uint32_t)4U * w, sts[l][w]);
+        }
+      }
+    }
+    return;
+  }
+  for (uint32_t k = (uint32_t)0U; k < n; k++)
+  {
+    uint8_t *left = src + (size_t)(uint32_t)2U * (size_t)k * (size_t)hsz;
+    hash_fun(left, left + hsz, dst + (size_t)k * (size_t)hsz);
+  }
+}
+
+/*
+  Appends n hsz-strided hashes to level lv.
+*/
+static void
+level_append(
+  uint32_t hsz,
+  MerkleTree_Low_Datastructures_hash_vv hs,
+  MerkleTree_Low_Datastructures_hash_arena *ha,
+  uint32_t lv,
+  uint8_t *v,
+  uint32_t n
+)
+{
+  if (ha != NULL)
+  {
+    MerkleTree_Low_Datastructures_hash_arena a = arena_reserve(hsz, ha[lv], n);
+    memcpy(arena_index(hsz, a, a.sz), v, (size_t)n * (size_t)hsz);
+    a.sz = a.sz + n;
+    ha[lv] = a;
+    return;
+  }
+  regional__uint32_t__uint8_t_
+  rg = { .state = hsz, .dummy = NULL, .r_alloc = hash_r_alloc, .r_free = hash_r_free };
+  MerkleTree_Low_Datastructures_hash_vec hv = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
+  for (uint32_t k = (uint32_t)0U; k < n; k++)
+  {
+    hv = insert_copy___uint8_t__uint32_t(rg, hash_copy, hv, v + (size_t)k * (size_t)hsz);
+  }
+  assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, hv);
+}
+
+bool
+MerkleTree_Low_mt_insert_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint8_t *leaves,
+  uint32_t n
+)
+{
+  MerkleTree_Low_merkle_tree mt1 = *(MerkleTree_Low_merkle_tree *)mt;
+  return
+    n
+    <= MerkleTree_Low_uint32_32_max - mt1.j
+    && MerkleTree_Low_uint64_max - mt1.offset >= (uint64_t)mt1.j + (uint64_t)n;
+}
+
+/*
+  Same as n calls to mt_insert, one level at a time: the leaves are appended
+  first, then the new nodes of each level are hashed as one batch of pairs of
+  the level below. With contiguous level storage the pairs are hashed in place
+  and the results written directly into the parent level.
+*/
+void MerkleTree_Low_mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint8_t *leaves, uint32_t n)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  uint32_t hsz = mtv.hash_size;
+  MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
+  MerkleTree_Low_Datastructures_hash_arena *ha = mtv.ha;
+  uint32_t j0 = mtv.j;
+  uint32_t j1 = mtv.j + n;
+  level_append(hsz, hs, ha, (uint32_t)0U, leaves, n);
+  uint8_t *src = NULL;
+  uint8_t *dst = NULL;
+  if (ha == NULL && n > (uint32_t)0U)
+  {
+    KRML_CHECK_SIZE((size_t)hsz, (size_t)n + (size_t)1U);
+    src = KRML_HOST_MALLOC(((size_t)n + (size_t)1U) * (size_t)hsz);
+    dst = KRML_HOST_MALLOC(((size_t)n / (size_t)2U + (size_t)1U) * (size_t)hsz);
+  }
+  for (uint32_t lv = (uint32_t)0U; lv + (uint32_t)1U < hs.sz; lv++)
+  {
+    uint32_t k0 = (j0 >> lv) / (uint32_t)2U;
+    uint32_t k1 = (j1 >> lv) / (uint32_t)2U;
+    if (k0 == k1)
+    {
+      break;
+    }
+    uint32_t cnt = k1 - k0;
+    uint32_t first = (uint32_t)2U * k0 - MerkleTree_Low_offset_of(mtv.i >> lv);
+    if (ha != NULL)
+    {
+      MerkleTree_Low_Datastructures_hash_arena
+      a = arena_reserve(hsz, ha[lv + (uint32_t)1U], cnt);
+      hash_pairs(hsz,
+        cnt,
+        arena_index(hsz, ha[lv], first),
+        arena_index(hsz, a, a.sz),
+        mtv.hash_fun);
+      a.sz = a.sz + cnt;
+      ha[lv + (uint32_t)1U] = a;
+    }
+    else
+    {
+      for (uint32_t k = (uint32_t)0U; k < (uint32_t)2U * cnt; k++)
+      {
+        hash_copy(hsz, level_index(hsz, hs, ha, lv, first + k), src + (size_t)k * (size_t)hsz);
+      }
+      hash_pairs(hsz, cnt, src, dst, mtv.hash_fun);
+      level_append(hsz, hs, ha, lv + (uint32_t)1U, dst, cnt);
+    }
+  }
+  if (src != NULL)
+  {
+    KRML_HOST_FREE(src);
+    KRML_HOST_FREE(dst);
+  }
+  *mt
+  =
+    (
+      (MerkleTree_Low_merkle_tree){
+        .hash_size = mtv.hash_size,
+        .offset = mtv.offset,
+        .i = mtv.i,
+        .j = j1,
+        .hs = mtv.hs,
+        .rhs_ok = false,
+        .rhs = mtv.rhs,
+        .mroot = mtv.mroot,
+        .hash_fun = mtv.hash_fun,
+        .ha = mtv.ha
       }
     );
 }
@@ -1092,6 +1558,20 @@ MerkleTree_Low_merkle_tree
   return mt;
 }
 
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_custom_arena(
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun);
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_Datastructures_hash_arena), mt->hs.sz);
+  mt->ha = KRML_HOST_CALLOC(mt->hs.sz, sizeof (MerkleTree_Low_Datastructures_hash_arena));
+  MerkleTree_Low_mt_insert(mt, init);
+  return mt;
+}
+
 bool MerkleTree_Low_uu___is_Path(MerkleTree_Low_path projectee)
 {
   return true;
@@ -1171,6 +1651,7 @@ construct_rhs(
   uint32_t hsz,
   uint32_t lv,
   MerkleTree_Low_Datastructures_hash_vv hs,
+  MerkleTree_Low_Datastructures_hash_arena *ha,
   MerkleTree_Low_Datastructures_hash_vec rhs,
   uint32_t i,
   uint32_t j,
@@ -1187,6 +1668,7 @@ construct_rhs(
       construct_rhs(hsz,
         lv + (uint32_t)1U,
         hs,
+        ha,
         rhs,
         i / (uint32_t)2U,
         j / (uint32_t)2U,
@@ -1209,20 +1691,16 @@ construct_rhs(
         rhs,
         lv,
         acc);
-      hash_fun(index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
-          j - (uint32_t)1U - ofs),
-        acc,
-        acc);
+      hash_fun(level_index(hsz, hs, ha, lv, j - (uint32_t)1U - ofs), acc, acc);
     }
     else
     {
-      hash_copy(hsz,
-        index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv), j - (uint32_t)1U - ofs),
-        acc);
+      hash_copy(hsz, level_index(hsz, hs, ha, lv, j - (uint32_t)1U - ofs), acc);
     }
     construct_rhs(hsz,
       lv + (uint32_t)1U,
       hs,
+      ha,
       rhs,
       i / (uint32_t)2U,
       j / (uint32_t)2U,
@@ -1257,7 +1735,7 @@ void MerkleTree_Low_mt_get_root(const MerkleTree_Low_merkle_tree *mt, uint8_t *r
     hash_copy(hash_size, mroot, rt);
     return;
   }
-  construct_rhs(hash_size, (uint32_t)0U, hs, rhs, i, j, rt, false, hash_fun);
+  construct_rhs(hash_size, (uint32_t)0U, hs, mtv.ha, rhs, i, j, rt, false, hash_fun);
   hash_copy(hash_size, rt, mroot);
   *mt1
   =
@@ -1271,7 +1749,8 @@ void MerkleTree_Low_mt_get_root(const MerkleTree_Low_merkle_tree *mt, uint8_t *r
         .rhs_ok = true,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .ha = mtv.ha
       }
     );
 }
@@ -1340,6 +1819,7 @@ mt_get_path_(
   uint32_t hsz,
   uint32_t lv,
   MerkleTree_Low_Datastructures_hash_vv hs,
+  MerkleTree_Low_Datastructures_hash_arena *ha,
   MerkleTree_Low_Datastructures_hash_vec rhs,
   uint32_t i,
   uint32_t j,
@@ -1355,10 +1835,7 @@ mt_get_path_(
     uint32_t ofs1 = MerkleTree_Low_offset_of(i);
     if (k % (uint32_t)2U == (uint32_t)1U)
     {
-      uint8_t
-      *uu____0 =
-        index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
-          k - (uint32_t)1U - ofs1);
+      uint8_t *uu____0 = level_index(hsz, hs, ha, lv, k - (uint32_t)1U - ofs1);
       MerkleTree_Low_path pth1 = *p;
       MerkleTree_Low_Datastructures_hash_vec pv = pth1.hashes;
       MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pv, uu____0);
@@ -1379,10 +1856,7 @@ mt_get_path_(
       }
       else
       {
-        uint8_t
-        *uu____2 =
-          index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, lv),
-            k + (uint32_t)1U - ofs1);
+        uint8_t *uu____2 = level_index(hsz, hs, ha, lv, k + (uint32_t)1U - ofs1);
         MerkleTree_Low_path pth1 = *p;
         MerkleTree_Low_Datastructures_hash_vec pv = pth1.hashes;
         MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pv, uu____2);
@@ -1401,6 +1875,7 @@ mt_get_path_(
     mt_get_path_(hsz,
       lv + (uint32_t)1U,
       hs,
+      ha,
       rhs,
       i / (uint32_t)2U,
       j / (uint32_t)2U,
@@ -1453,15 +1928,12 @@ MerkleTree_Low_mt_get_path(
   uint32_t j = mtv.j;
   MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
   MerkleTree_Low_Datastructures_hash_vec rhs = mtv.rhs;
-  uint8_t
-  *ih =
-    index___uint8_t_(index__LowStar_Vector_vector_str__uint8_t_(hs, (uint32_t)0U),
-      idx1 - ofs);
+  uint8_t *ih = level_index(hsz1, hs, mtv.ha, (uint32_t)0U, idx1 - ofs);
   MerkleTree_Low_path pth = *p;
   MerkleTree_Low_Datastructures_hash_vec pv = pth.hashes;
   MerkleTree_Low_Datastructures_hash_vec ipv = insert___uint8_t_(pv, ih);
   *p = ((MerkleTree_Low_path){ .hash_size = hsz1, .hashes = ipv });
-  mt_get_path_(mtv.hash_size, (uint32_t)0U, hs, rhs, i, j, idx1, p, false);
+  mt_get_path_(mtv.hash_size, (uint32_t)0U, hs, mtv.ha, rhs, i, j, idx1, p, false);
   return j;
 }
 
@@ -1470,6 +1942,7 @@ mt_flush_to_(
   uint32_t hsz,
   uint32_t lv,
   MerkleTree_Low_Datastructures_hash_vv hs,
+  MerkleTree_Low_Datastructures_hash_arena *ha,
   uint32_t pi,
   uint32_t i
 )
@@ -1479,6 +1952,33 @@ mt_flush_to_(
   if (!(oi == opi))
   {
     uint32_t ofs = oi - opi;
+    if (ha != NULL)
+    {
+      MerkleTree_Low_Datastructures_hash_arena a = ha[lv];
+      if (ofs >= a.sz)
+      {
+        a.sz = (uint32_t)0U;
+        if (a.borrowed)
+        {
+          a.cap = (uint32_t)0U;
+        }
+      }
+      else if (a.borrowed)
+      {
+        a.hs = arena_index(hsz, a, ofs);
+        a.sz = a.sz - ofs;
+        a.cap = a.cap - ofs;
+      }
+      else
+      {
+        uint32_t n_shifted = a.sz - ofs;
+        memmove(a.hs, arena_index(hsz, a, ofs), (size_t)n_shifted * (size_t)hsz);
+        a.sz = n_shifted;
+      }
+      ha[lv] = a;
+      mt_flush_to_(hsz, lv + (uint32_t)1U, hs, ha, pi / (uint32_t)2U, i / (uint32_t)2U);
+      return;
+    }
     MerkleTree_Low_Datastructures_hash_vec
     hvec = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
     if (!(ofs == (uint32_t)0U))
@@ -1529,7 +2029,7 @@ mt_flush_to_(
     }
     MerkleTree_Low_Datastructures_hash_vec flushed = frv;
     assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, flushed);
-    mt_flush_to_(hsz, lv + (uint32_t)1U, hs, pi / (uint32_t)2U, i / (uint32_t)2U);
+    mt_flush_to_(hsz, lv + (uint32_t)1U, hs, ha, pi / (uint32_t)2U, i / (uint32_t)2U);
     return;
   }
 }
@@ -1552,7 +2052,7 @@ void MerkleTree_Low_mt_flush_to(MerkleTree_Low_merkle_tree *mt, uint64_t idx)
   uint32_t hsz = mtv.hash_size;
   uint32_t idx1 = (uint32_t)(idx - offset);
   MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
-  mt_flush_to_(hsz, (uint32_t)0U, hs, mtv.i, idx1);
+  mt_flush_to_(hsz, (uint32_t)0U, hs, mtv.ha, mtv.i, idx1);
   *mt
   =
     (
@@ -1565,7 +2065,8 @@ void MerkleTree_Low_mt_flush_to(MerkleTree_Low_merkle_tree *mt, uint64_t idx)
         .rhs_ok = mtv.rhs_ok,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .ha = mtv.ha
       }
     );
 }
@@ -1630,6 +2131,7 @@ static void
 mt_retract_to_(
   uint32_t hsz,
   MerkleTree_Low_Datastructures_hash_vv hs,
+  MerkleTree_Low_Datastructures_hash_arena *ha,
   uint32_t lv,
   uint32_t i,
   uint32_t s,
@@ -1638,27 +2140,43 @@ mt_retract_to_(
 {
   if (!(lv >= hs.sz))
   {
-    MerkleTree_Low_Datastructures_hash_vec
-    hvec = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
     uint32_t old_len = j - MerkleTree_Low_offset_of(i);
     uint32_t new_len = s - MerkleTree_Low_offset_of(i);
-    MerkleTree_Low_Datastructures_hash_vec
-    retracted =
-      shrink___uint8_t__uint32_t((
-          (regional__uint32_t__uint8_t_){
-            .state = hsz,
-            .dummy = NULL,
-            .r_alloc = hash_r_alloc,
-            .r_free = hash_r_free
-          }
-        ),
-        hvec,
-        new_len);
-    assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, retracted);
+    if (ha != NULL)
+    {
+      if (new_len < ha[lv].sz)
+      {
+        ha[lv].sz = new_len;
+        if (ha[lv].borrowed)
+        {
+          /* The image may be read-only: only hashes past its end are written. */
+          ha[lv].cap = new_len;
+        }
+      }
+    }
+    else
+    {
+      MerkleTree_Low_Datastructures_hash_vec
+      hvec = index__LowStar_Vector_vector_str__uint8_t_(hs, lv);
+      MerkleTree_Low_Datastructures_hash_vec
+      retracted =
+        shrink___uint8_t__uint32_t((
+            (regional__uint32_t__uint8_t_){
+              .state = hsz,
+              .dummy = NULL,
+              .r_alloc = hash_r_alloc,
+              .r_free = hash_r_free
+            }
+          ),
+          hvec,
+          new_len);
+      assign__LowStar_Vector_vector_str__uint8_t__uint32_t(hs, lv, retracted);
+    }
     if (lv + (uint32_t)1U < hs.sz)
     {
       mt_retract_to_(hsz,
         hs,
+        ha,
         lv + (uint32_t)1U,
         i / (uint32_t)2U,
         s / (uint32_t)2U,
@@ -1686,7 +2204,7 @@ void MerkleTree_Low_mt_retract_to(MerkleTree_Low_merkle_tree *mt, uint64_t r)
   uint64_t offset = mtv.offset;
   uint32_t r1 = (uint32_t)(r - offset);
   MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
-  mt_retract_to_(mtv.hash_size, hs, (uint32_t)0U, mtv.i, r1 + (uint32_t)1U, mtv.j);
+  mt_retract_to_(mtv.hash_size, hs, mtv.ha, (uint32_t)0U, mtv.i, r1 + (uint32_t)1U, mtv.j);
   *mt
   =
     (
@@ -1699,7 +2217,8 @@ void MerkleTree_Low_mt_retract_to(MerkleTree_Low_merkle_tree *mt, uint64_t r)
         .rhs_ok = false,
         .rhs = mtv.rhs,
         .mroot = mtv.mroot,
-        .hash_fun = mtv.hash_fun
+        .hash_fun = mtv.hash_fun,
+        .ha = mtv.ha
       }
     );
 }
@@ -1983,14 +2502,18 @@ serialize_hash_vec(
 }
 
 static uint64_t
-hash_vv_bytes_i(uint32_t hash_size, MerkleTree_Low_Datastructures_hash_vv vv, uint32_t i)
+hash_vv_bytes_i(
+  uint32_t hash_size,
+  MerkleTree_Low_Datastructures_hash_vv vv,
+  MerkleTree_Low_Datastructures_hash_arena *ha,
+  uint32_t i
+)
 {
   if (i >= vv.sz)
   {
     return (uint64_t)4U;
   }
-  MerkleTree_Low_Datastructures_hash_vec vvi = index__LowStar_Vector_vector_str__uint8_t_(vv, i);
-  uint64_t vs_hs = (uint64_t)vvi.sz * (uint64_t)hash_size;
+  uint64_t vs_hs = (uint64_t)level_size(vv, ha, i) * (uint64_t)hash_size;
   uint64_t r;
   if (MerkleTree_Low_uint64_max - vs_hs >= (uint64_t)4U)
   {
@@ -2000,7 +2523,7 @@ hash_vv_bytes_i(uint32_t hash_size, MerkleTree_Low_Datastructures_hash_vv vv, ui
   {
     r = MerkleTree_Low_uint64_max;
   }
-  uint64_t rest = hash_vv_bytes_i(hash_size, vv, i + (uint32_t)1U);
+  uint64_t rest = hash_vv_bytes_i(hash_size, vv, ha, i + (uint32_t)1U);
   if (MerkleTree_Low_uint64_max - r >= rest)
   {
     return r + rest;
@@ -2008,11 +2531,45 @@ hash_vv_bytes_i(uint32_t hash_size, MerkleTree_Low_Datastructures_hash_vv vv, ui
   return MerkleTree_Low_uint64_max;
 }
 
+/*
+  Same encoding as serialize_hash_vec, from a contiguous level.
+*/
+static __bool_uint32_t
+serialize_hash_arena(
+  uint32_t hash_size,
+  bool ok,
+  MerkleTree_Low_Datastructures_hash_arena x,
+  uint8_t *buf,
+  uint32_t sz,
+  uint32_t pos
+)
+{
+  if (!ok || pos >= sz)
+  {
+    return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+  }
+  __bool_uint32_t scrut = serialize_uint32_t(ok, x.sz, buf, sz, pos);
+  bool ok1 = scrut.fst;
+  uint32_t pos1 = scrut.snd;
+  if (ok1 && x.sz > (uint32_t)0U)
+  {
+    uint64_t len = (uint64_t)x.sz * (uint64_t)hash_size;
+    if (pos1 >= sz || (uint64_t)(sz - pos1) < len)
+    {
+      return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
+    }
+    memcpy(buf + pos1, x.hs, (size_t)len);
+    return ((__bool_uint32_t){ .fst = true, .snd = pos1 + (uint32_t)len });
+  }
+  return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
+}
+
 static __bool_uint32_t
 serialize_hash_vv_i(
   uint32_t hash_size,
   bool ok,
   MerkleTree_Low_Datastructures_hash_vv x,
+  MerkleTree_Low_Datastructures_hash_arena *ha,
   uint8_t *buf,
   uint32_t sz,
   uint32_t pos,
@@ -2023,14 +2580,22 @@ serialize_hash_vv_i(
   {
     return ((__bool_uint32_t){ .fst = false, .snd = (uint32_t)0U });
   }
-  MerkleTree_Low_Datastructures_hash_vec vi = index__LowStar_Vector_vector_str__uint8_t_(x, i);
-  __bool_uint32_t scrut = serialize_hash_vec(hash_size, ok, vi, buf, sz, pos);
+  __bool_uint32_t scrut;
+  if (ha != NULL)
+  {
+    scrut = serialize_hash_arena(hash_size, ok, ha[i], buf, sz, pos);
+  }
+  else
+  {
+    MerkleTree_Low_Datastructures_hash_vec vi = index__LowStar_Vector_vector_str__uint8_t_(x, i);
+    scrut = serialize_hash_vec(hash_size, ok, vi, buf, sz, pos);
+  }
   bool ok1 = scrut.fst;
   uint32_t pos1 = scrut.snd;
   uint32_t j = i + (uint32_t)1U;
   if (j < x.sz)
   {
-    return serialize_hash_vv_i(hash_size, ok1, x, buf, sz, pos1, j);
+    return serialize_hash_vv_i(hash_size, ok1, x, ha, buf, sz, pos1, j);
   }
   return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
 }
@@ -2040,6 +2605,7 @@ serialize_hash_vv(
   uint32_t hash_size,
   bool ok,
   MerkleTree_Low_Datastructures_hash_vv x,
+  MerkleTree_Low_Datastructures_hash_arena *ha,
   uint8_t *buf,
   uint32_t sz,
   uint32_t pos
@@ -2054,7 +2620,7 @@ serialize_hash_vv(
   uint32_t pos1 = scrut.snd;
   if (x.sz > (uint32_t)0U)
   {
-    return serialize_hash_vv_i(hash_size, ok1, x, buf, sz, pos1, (uint32_t)0U);
+    return serialize_hash_vv_i(hash_size, ok1, x, ha, buf, sz, pos1, (uint32_t)0U);
   }
   return ((__bool_uint32_t){ .fst = ok1, .snd = pos1 });
 }
@@ -2472,7 +3038,7 @@ uint64_t MerkleTree_Low_Serialization_mt_serialize_size(const MerkleTree_Low_mer
   MerkleTree_Low_merkle_tree mtv = *(MerkleTree_Low_merkle_tree *)mt;
   MerkleTree_Low_Datastructures_hash_vv hs = mtv.hs;
   MerkleTree_Low_Datastructures_hash_vec rhs = mtv.rhs;
-  uint64_t hs_sz = hash_vv_bytes_i(mtv.hash_size, hs, (uint32_t)0U);
+  uint64_t hs_sz = hash_vv_bytes_i(mtv.hash_size, hs, mtv.ha, (uint32_t)0U);
   if (hs_sz < (uint64_t)4294967295U)
   {
     uint64_t vs_hs = (uint64_t)rhs.sz * (uint64_t)mtv.hash_size;
@@ -2515,7 +3081,8 @@ MerkleTree_Low_Serialization_mt_serialize(
   __bool_uint32_t scrut3 = serialize_uint32_t(ok3, mtv.j, output, sz1, pos3);
   bool ok4 = scrut3.fst;
   uint32_t pos4 = scrut3.snd;
-  __bool_uint32_t scrut4 = serialize_hash_vv(mtv.hash_size, ok4, mtv.hs, output, sz1, pos4);
+  __bool_uint32_t
+  scrut4 = serialize_hash_vv(mtv.hash_size, ok4, mtv.hs, mtv.ha, output, sz1, pos4);
   bool ok5 = scrut4.fst;
   uint32_t pos5 = scrut4.snd;
   __bool_uint32_t scrut5 = serialize_bool(ok5, mtv.rhs_ok, output, sz1, pos5);
@@ -2611,7 +3178,8 @@ MerkleTree_Low_merkle_tree
         .rhs_ok = rhs_ok,
         .rhs = rhs,
         .mroot = mroot,
-        .hash_fun = hash_fun
+        .hash_fun = hash_fun,
+        .ha = NULL
       }
     );
   return buf;
@@ -2668,6 +3236,391 @@ MerkleTree_Low_path
   return buf;
 }
 
+/*
+  Tree images, version 1: a fixed header of little-endian integers, then the
+  32 rhs hashes and the root, then each level as hashes back to back starting
+  at a multiple of 64 bytes, followed by room for its capacity.
+
+    0   magic "HACL-MT" 0         36  rhs_ok (0 or 1)
+    8   format version (1)        40  position of rhs and root
+    12  hash size                 48  per level, 32 times:
+    16  offset                          position, size, capacity
+    24  i                               (8, 4 and 4 bytes)
+    28  j                         560 end of the header
+    32  number of levels (32)
+*/
+static const uint8_t mt_image_magic[8U] = { 0x48U, 0x41U, 0x43U, 0x4cU, 0x2dU, 0x4dU, 0x54U, 0x00U };
+
+static const uint32_t mt_image_version = (uint32_t)1U;
+
+static const uint32_t mt_image_levels = (uint32_t)32U;
+
+static const uint64_t mt_image_header_size = (uint64_t)560U;
+
+static uint64_t mt_image_align(uint64_t pos)
+{
+  return (pos + (uint64_t)63U) & ~(uint64_t)63U;
+}
+
+/*
+  Room for slack more leaves: at most (slack >> lv) + 1 more nodes at level lv.
+*/
+static uint32_t mt_image_level_cap(uint32_t sz, uint32_t lv, uint32_t slack)
+{
+  if (slack == (uint32_t)0U)
+  {
+    return sz;
+  }
+  uint64_t cap = (uint64_t)sz + (uint64_t)(slack >> lv) + (uint64_t)1U;
+  if (cap > MerkleTree_Low_uint32_max)
+  {
+    return (uint32_t)MerkleTree_Low_uint32_max;
+  }
+  return (uint32_t)cap;
+}
+
+uint64_t
+MerkleTree_Low_Serialization_mt_image_size(const MerkleTree_Low_merkle_tree *mt, uint32_t slack)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  uint64_t hsz = (uint64_t)mtv.hash_size;
+  uint64_t pos = mt_image_align(mt_image_header_size + (uint64_t)33U * hsz);
+  for (uint32_t lv = (uint32_t)0U; lv < mt_image_levels; lv++)
+  {
+    uint32_t sz = level_size(mtv.hs, mtv.ha, lv);
+    pos = mt_image_align(pos + (uint64_t)mt_image_level_cap(sz, lv, slack) * hsz);
+  }
+  return pos;
+}
+
+uint64_t
+MerkleTree_Low_Serialization_mt_image_write(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t slack,
+  uint8_t *buf,
+  uint64_t len
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  uint32_t hsz = mtv.hash_size;
+  uint64_t size = MerkleTree_Low_Serialization_mt_image_size(mt, slack);
+  if (len < size || mtv.hs.sz != mt_image_levels)
+  {
+    return (uint64_t)0U;
+  }
+  uint64_t rpos = mt_image_header_size;
+  uint64_t pos = mt_image_align(rpos + (uint64_t)33U * (uint64_t)hsz);
+  memset(buf, 0U, (size_t)pos);
+  memcpy(buf, mt_image_magic, (uint32_t)8U * sizeof (uint8_t));
+  store32_le(buf + (uint32_t)8U, mt_image_version);
+  store32_le(buf + (uint32_t)12U, hsz);
+  store64_le(buf + (uint32_t)16U, mtv.offset);
+  store32_le(buf + (uint32_t)24U, mtv.i);
+  store32_le(buf + (uint32_t)28U, mtv.j);
+  store32_le(buf + (uint32_t)32U, mt_image_levels);
+  store32_le(buf + (uint32_t)36U, (uint32_t)mtv.rhs_ok);
+  store64_le(buf + (uint32_t)40U, rpos);
+  for (uint32_t k = (uint32_t)0U; k < mt_image_levels; k++)
+  {
+    memcpy(buf + (size_t)rpos + (size_t)k * (size_t)hsz,
+      index___uint8_t_(mtv.rhs, k),
+      hsz * sizeof (uint8_t));
+  }
+  memcpy(buf + (size_t)rpos + (size_t)32U * (size_t)hsz, mtv.mroot, hsz * sizeof (uint8_t));
+  for (uint32_t lv = (uint32_t)0U; lv < mt_image_levels; lv++)
+  {
+    uint32_t sz = level_size(mtv.hs, mtv.ha, lv);
+    uint32_t cap = mt_image_level_cap(sz, lv, slack);
+    uint8_t *ent = buf + (uint32_t)48U + (uint32_t)16U * lv;
+    store64_le(ent, pos);
+    store32_le(ent + (uint32_t)8U, sz);
+    store32_le(ent + (uint32_t)12U, cap);
+    uint8_t *dst = buf + (size_t)pos;
+    if (mtv.ha != NULL)
+    {
+      if (sz > (uint32_t)0U)
+      {
+        memcpy(dst, mtv.ha[lv].hs, (size_t)sz * (size_t)hsz);
+      }
+    }
+    else
+    {
+      for (uint32_t k = (uint32_t)0U; k < sz; k++)
+      {
+        memcpy(dst + (size_t)k * (size_t)hsz,
+          level_index(hsz, mtv.hs, mtv.ha, lv, k),
+          hsz * sizeof (uint8_t));
+      }
+    }
+    uint64_t end = mt_image_align(pos + (uint64_t)cap * (uint64_t)hsz);
+    uint64_t used = pos + (uint64_t)sz * (uint64_t)hsz;
+    memset(buf + (size_t)used, 0U, (size_t)(end - used));
+    pos = end;
+  }
+  return size;
+}
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_Serialization_mt_image_open(
+  uint8_t *buf,
+  uint64_t len,
+  bool writable,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+)
+{
+  if
+  (
+    len
+    < mt_image_header_size
+    || len > (uint64_t)SIZE_MAX
+    || memcmp(buf, mt_image_magic, (uint32_t)8U * sizeof (uint8_t)) != 0
+    || load32_le(buf + (uint32_t)8U) != mt_image_version
+    || load32_le(buf + (uint32_t)32U) != mt_image_levels
+  )
+  {
+    return NULL;
+  }
+  uint32_t hsz = load32_le(buf + (uint32_t)12U);
+  uint64_t offset = load64_le(buf + (uint32_t)16U);
+  uint32_t i = load32_le(buf + (uint32_t)24U);
+  uint32_t j = load32_le(buf + (uint32_t)28U);
+  uint32_t rhs_ok = load32_le(buf + (uint32_t)36U);
+  uint64_t rpos = load64_le(buf + (uint32_t)40U);
+  if
+  (
+    hsz
+    == (uint32_t)0U
+    || !(j >= i && MerkleTree_Low_uint64_max - offset >= (uint64_t)j)
+    || rhs_ok > (uint32_t)1U
+    || rpos > len
+    || (uint64_t)33U * (uint64_t)hsz > len - rpos
+  )
+  {
+    return NULL;
+  }
+  /* Each level must be in the buffer and hold the nodes from i to j. */
+  for (uint32_t lv = (uint32_t)0U; lv < mt_image_levels; lv++)
+  {
+    uint8_t *ent = buf + (uint32_t)48U + (uint32_t)16U * lv;
+    uint64_t pos = load64_le(ent);
+    uint32_t sz = load32_le(ent + (uint32_t)8U);
+    uint32_t cap = load32_le(ent + (uint32_t)12U);
+    if
+    (
+      sz
+      != (j >> lv) - MerkleTree_Low_offset_of(i >> lv)
+      || cap < sz
+      || pos > len
+      || (uint64_t)cap * (uint64_t)hsz > len - pos
+    )
+    {
+      return NULL;
+    }
+  }
+  MerkleTree_Low_merkle_tree *mt = create_empty_mt(hsz, hash_fun);
+  KRML_CHECK_SIZE(sizeof (MerkleTree_Low_Datastructures_hash_arena), mt->hs.sz);
+  MerkleTree_Low_Datastructures_hash_arena
+  *ha = KRML_HOST_CALLOC(mt->hs.sz, sizeof (MerkleTree_Low_Datastructures_hash_arena));
+  for (uint32_t lv = (uint32_t)0U; lv < mt_image_levels; lv++)
+  {
+    uint8_t *ent = buf + (uint32_t)48U + (uint32_t)16U * lv;
+    uint32_t sz = load32_le(ent + (uint32_t)8U);
+    ha[lv]
+    =
+      (
+        (MerkleTree_Low_Datastructures_hash_arena){
+          .sz = sz,
+          .cap = writable ? load32_le(ent + (uint32_t)12U) : sz,
+          .hs = buf + (size_t)load64_le(ent),
+          .borrowed = true
+        }
+      );
+  }
+  for (uint32_t k = (uint32_t)0U; k < mt_image_levels; k++)
+  {
+    memcpy(index___uint8_t_(mt->rhs, k),
+      buf + (size_t)rpos + (size_t)k * (size_t)hsz,
+      hsz * sizeof (uint8_t));
+  }
+  memcpy(mt->mroot, buf + (size_t)rpos + (size_t)32U * (size_t)hsz, hsz * sizeof (uint8_t));
+  mt->offset = offset;
+  mt->i = i;
+  mt->j = j;
+  mt->rhs_ok = rhs_ok == (uint32_t)1U;
+  mt->ha = ha;
+  return mt;
+}
+
+/*
+  Tree deltas, version 1: a header of little-endian integers, then for each
+  level lv, the nodes from (from >> lv) to (j >> lv) - 1 back to back.
+
+    0   magic "HACL-MTD"          24  from: the number of leaves at the checkpoint
+    8   format version (1)        28  i
+    12  hash size                 32  j
+    16  offset
+*/
+static const uint8_t mt_delta_magic[8U] = { 0x48U, 0x41U, 0x43U, 0x4cU, 0x2dU, 0x4dU, 0x54U, 0x44U };
+
+static const uint32_t mt_delta_version = (uint32_t)1U;
+
+static const uint64_t mt_delta_header_size = (uint64_t)36U;
+
+static uint64_t mt_delta_nodes(uint32_t from, uint32_t j)
+{
+  uint64_t n = (uint64_t)0U;
+  for (uint32_t lv = (uint32_t)0U; lv < mt_image_levels; lv++)
+  {
+    n = n + (uint64_t)((j >> lv) - (from >> lv));
+  }
+  return n;
+}
+
+/*
+  The checkpoint since, as a number of leaves from the offset of mt, must
+  still have its leaves in mt: i <= since <= j.
+*/
+static bool mt_delta_since_ok(MerkleTree_Low_merkle_tree mtv, uint64_t since)
+{
+  return
+    since
+    >= mtv.offset
+    && since - mtv.offset <= MerkleTree_Low_offset_range_limit
+    && mtv.i <= (uint32_t)(since - mtv.offset) && (uint32_t)(since - mtv.offset) <= mtv.j;
+}
+
+uint64_t
+MerkleTree_Low_Serialization_mt_delta_size(const MerkleTree_Low_merkle_tree *mt, uint64_t since)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  if (!mt_delta_since_ok(mtv, since))
+  {
+    return (uint64_t)0U;
+  }
+  uint32_t from = (uint32_t)(since - mtv.offset);
+  return mt_delta_header_size + mt_delta_nodes(from, mtv.j) * (uint64_t)mtv.hash_size;
+}
+
+uint64_t
+MerkleTree_Low_Serialization_mt_delta_write(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t since,
+  uint8_t *buf,
+  uint64_t len
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  uint64_t size = MerkleTree_Low_Serialization_mt_delta_size(mt, since);
+  if (size == (uint64_t)0U || len < size)
+  {
+    return (uint64_t)0U;
+  }
+  uint32_t hsz = mtv.hash_size;
+  uint32_t from = (uint32_t)(since - mtv.offset);
+  memcpy(buf, mt_delta_magic, (uint32_t)8U * sizeof (uint8_t));
+  store32_le(buf + (uint32_t)8U, mt_delta_version);
+  store32_le(buf + (uint32_t)12U, hsz);
+  store64_le(buf + (uint32_t)16U, mtv.offset);
+  store32_le(buf + (uint32_t)24U, from);
+  store32_le(buf + (uint32_t)28U, mtv.i);
+  store32_le(buf + (uint32_t)32U, mtv.j);
+  uint8_t *dst = buf + (size_t)mt_delta_header_size;
+  for (uint32_t lv = (uint32_t)0U; lv < mt_image_levels; lv++)
+  {
+    uint32_t cnt = (mtv.j >> lv) - (from >> lv);
+    uint32_t first = (from >> lv) - MerkleTree_Low_offset_of(mtv.i >> lv);
+    if (mtv.ha != NULL)
+    {
+      if (cnt > (uint32_t)0U)
+      {
+        memcpy(dst, arena_index(hsz, mtv.ha[lv], first), (size_t)cnt * (size_t)hsz);
+      }
+    }
+    else
+    {
+      for (uint32_t k = (uint32_t)0U; k < cnt; k++)
+      {
+        memcpy(dst + (size_t)k * (size_t)hsz,
+          level_index(hsz, mtv.hs, mtv.ha, lv, first + k),
+          hsz * sizeof (uint8_t));
+      }
+    }
+    dst = dst + (size_t)cnt * (size_t)hsz;
+  }
+  return size;
+}
+
+bool
+MerkleTree_Low_Serialization_mt_delta_apply(
+  MerkleTree_Low_merkle_tree *mt,
+  const uint8_t *buf,
+  uint64_t len
+)
+{
+  MerkleTree_Low_merkle_tree mtv = *mt;
+  uint8_t *hdr = (uint8_t *)buf;
+  if
+  (
+    len
+    < mt_delta_header_size
+    || memcmp(buf, mt_delta_magic, (uint32_t)8U * sizeof (uint8_t)) != 0
+    || load32_le(hdr + (uint32_t)8U) != mt_delta_version
+    || load32_le(hdr + (uint32_t)12U) != mtv.hash_size
+    || load64_le(hdr + (uint32_t)16U) != mtv.offset
+  )
+  {
+    return false;
+  }
+  uint32_t hsz = mtv.hash_size;
+  uint32_t from = load32_le(hdr + (uint32_t)24U);
+  uint32_t i = load32_le(hdr + (uint32_t)28U);
+  uint32_t j = load32_le(hdr + (uint32_t)32U);
+  if
+  (
+    !(i <= from && from <= j && i < j && MerkleTree_Low_uint64_max - mtv.offset >= (uint64_t)j)
+    || !(mtv.i <= from && from <= mtv.j)
+    || len - mt_delta_header_size != mt_delta_nodes(from, j) * (uint64_t)hsz
+  )
+  {
+    return false;
+  }
+  /* Nodes past the checkpoint are replaced, and the levels then grow from it. */
+  mt_retract_to_(hsz, mtv.hs, mtv.ha, (uint32_t)0U, mtv.i, from, mtv.j);
+  const uint8_t *src = buf + (size_t)mt_delta_header_size;
+  for (uint32_t lv = (uint32_t)0U; lv < mt_image_levels; lv++)
+  {
+    uint32_t cnt = (j >> lv) - (from >> lv);
+    if (cnt > (uint32_t)0U)
+    {
+      level_append(hsz, mtv.hs, mtv.ha, lv, (uint8_t *)src, cnt);
+    }
+    src = src + (size_t)cnt * (size_t)hsz;
+  }
+  uint32_t i1 = mtv.i;
+  if (i > mtv.i)
+  {
+    mt_flush_to_(hsz, (uint32_t)0U, mtv.hs, mtv.ha, mtv.i, i);
+    i1 = i;
+  }
+  *mt
+  =
+    (
+      (MerkleTree_Low_merkle_tree){
+        .hash_size = mtv.hash_size,
+        .offset = mtv.offset,
+        .i = i1,
+        .j = j,
+        .hs = mtv.hs,
+        .rhs_ok = false,
+        .rhs = mtv.rhs,
+        .mroot = mtv.mroot,
+        .hash_fun = mtv.hash_fun,
+        .ha = mtv.ha
+      }
+    );
+  return true;
+}
+
 uint8_t *MerkleTree_Low_Hashfunctions_init_hash(uint32_t hsz)
 {
   regional__uint32_t__uint8_t_
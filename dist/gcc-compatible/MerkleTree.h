@@ -76,6 +76,15 @@ typedef struct MerkleTree_Low_Datastructures_hash_vv_s
 }
 MerkleTree_Low_Datastructures_hash_vv;
 
+typedef struct MerkleTree_Low_Datastructures_hash_arena_s
+{
+  uint32_t sz;
+  uint32_t cap;
+  uint8_t *hs;
+  bool borrowed;
+}
+MerkleTree_Low_Datastructures_hash_arena;
+
 typedef struct MerkleTree_Low_merkle_tree_s
 {
   uint32_t hash_size;
@@ -87,6 +96,7 @@ typedef struct MerkleTree_Low_merkle_tree_s
   MerkleTree_Low_Datastructures_hash_vec rhs;
   uint8_t *mroot;
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+  MerkleTree_Low_Datastructures_hash_arena *ha;
 }
 MerkleTree_Low_merkle_tree;
 
@@ -163,6 +173,27 @@ MerkleTree_Low_merkle_tree
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 );
 
+/*
+  Construction with custom hash functions and contiguous level storage
+
+  @param[in]  hash_size Hash size (in bytes)
+  @param[in]  i         The initial hash
+
+  return The new Merkle tree
+
+  Note: each level of the tree is kept in one growable buffer of hash_size-strided
+  hashes rather than one allocation per hash. Paths returned by mt_get_path
+  point into these buffers and are only valid until the tree is next modified.
+  Both storage modes serialize to the same bytes; mt_deserialize always returns
+  a tree with per-hash storage.
+*/
+MerkleTree_Low_merkle_tree
+*mt_create_custom_arena(
+  uint32_t hash_size,
+  uint8_t *i,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
 /*
   Destruction
 
@@ -185,6 +216,25 @@ void mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 */
 bool mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 
+/*
+  Batch insertion
+
+  @param[in]  mt     The Merkle tree
+  @param[in]  leaves n hashes of hash_size bytes, back to back
+  @param[in]  n      The number of hashes to insert
+
+  Same result as inserting the n hashes in order with mt_insert, but the
+  interior nodes are computed level by level and, with the default hash
+  function, on multi-buffer SHA2-256. The tree makes copies of the hashes and
+  leaves is not modified.
+*/
+void mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint8_t *leaves, uint32_t n);
+
+/*
+  Precondition predicate for mt_insert_batch
+*/
+bool mt_insert_batch_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t *leaves, uint32_t n);
+
 /*
   Getting the Merkle root
 
@@ -372,6 +422,107 @@ uint64_t mt_serialize_path(const MerkleTree_Low_path *path1, uint8_t *buf, uint6
 */
 MerkleTree_Low_path *mt_deserialize_path(const uint8_t *buf, uint64_t len);
 
+/*
+  Size of a tree image
+
+  @param[in]  mt     The Merkle tree
+  @param[in]  slack  Room to reserve for this many more leaves
+
+  return the number of bytes mt_image_write needs for mt; a tree image can be
+  larger than 4 GiB
+*/
+uint64_t mt_image_size(const MerkleTree_Low_merkle_tree *mt, uint32_t slack);
+
+/*
+  Writing a tree image
+
+  @param[in]  mt     The Merkle tree
+  @param[in]  slack  Room to reserve for this many more leaves
+  @param[out] buf    The buffer to write the image into
+  @param[in]  len    Length of buf
+
+  return the number of bytes written, or 0 if len is less than
+  mt_image_size(mt, slack)
+
+  An image is a versioned layout of the tree, meant to be written to a file
+  and mapped back in memory: each level is stored as its hashes back to back,
+  followed by room for the level to grow by the slack.
+*/
+uint64_t
+mt_image_write(const MerkleTree_Low_merkle_tree *mt, uint32_t slack, uint8_t *buf, uint64_t len);
+
+/*
+  Opening a tree image in place
+
+  @param[in]  buf       The image, e.g. a mapped file written by mt_image_write
+  @param[in]  len       Length of buf
+  @param[in]  writable  Whether buf may be written to
+  @param[in]  hash_fun  Hash function
+
+  return pointer to the new tree if the image is valid, NULL otherwise
+
+  Only the header of the image is read: the tree uses the levels of buf as its
+  contiguous level storage, without copying them, so buf must outlive the
+  tree; mt_free does not release it. A level is copied to the heap the first
+  time it grows past the room it has in buf. If writable is true, new nodes
+  are written in buf as long as they fit, which with a private writable
+  mapping copies only the pages that change; otherwise buf is never written
+  to and can be a read-only mapping.
+*/
+MerkleTree_Low_merkle_tree
+*mt_image_open(
+  uint8_t *buf,
+  uint64_t len,
+  bool writable,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+/*
+  Size of a tree delta
+
+  @param[in]  mt     The Merkle tree
+  @param[in]  since  The number of leaves of mt, offset included, at the checkpoint
+
+  return the number of bytes mt_delta_write needs, or 0 if the leaves of the
+  checkpoint are no longer all in mt (since is not between offset + i and
+  offset + j)
+*/
+uint64_t mt_delta_size(const MerkleTree_Low_merkle_tree *mt, uint64_t since);
+
+/*
+  Writing a tree delta
+
+  @param[in]  mt     The Merkle tree
+  @param[in]  since  The number of leaves of mt, offset included, at the checkpoint
+  @param[out] buf    The buffer to write the delta into
+  @param[in]  len    Length of buf
+
+  return the number of bytes written, or 0 on failure
+
+  The delta holds the leaves and interior nodes of mt added since the
+  checkpoint, so its size grows with the number of leaves inserted, not with
+  the size of the tree. If mt was retracted since the checkpoint, since must
+  be the smallest number of leaves it had in between.
+*/
+uint64_t
+mt_delta_write(const MerkleTree_Low_merkle_tree *mt, uint64_t since, uint8_t *buf, uint64_t len);
+
+/*
+  Applying a tree delta
+
+  @param[in]  mt   The Merkle tree, as it was at the checkpoint of the delta
+  @param[in]  buf  The delta
+  @param[in]  len  Length of buf
+
+  return true if the delta was applied, false if it does not fit mt
+
+  mt is first retracted to the checkpoint, then gets the nodes of the delta
+  without hashing them, and is flushed as the tree the delta was written from.
+  The leaves of mt up to the checkpoint are not checked: compare the new root
+  of mt with a trusted one if needed.
+*/
+bool mt_delta_apply(MerkleTree_Low_merkle_tree *mt, const uint8_t *buf, uint64_t len);
+
 typedef MerkleTree_Low_merkle_tree *mt_p0;
 
 /*
@@ -386,6 +537,14 @@ void mt_sha256_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst);
 */
 MerkleTree_Low_merkle_tree *mt_create(uint8_t *init);
 
+/*
+  Construction wired to sha256 from EverCrypt, with contiguous level storage
+  (see mt_create_custom_arena)
+
+  @param[in]  init   The initial hash
+*/
+MerkleTree_Low_merkle_tree *mt_create_arena(uint8_t *init);
+
 typedef uint32_t MerkleTree_Low_index_t;
 
 extern uint32_t MerkleTree_Low_uint32_32_max;
@@ -450,6 +609,15 @@ bool MerkleTree_Low_mt_insert_pre(const MerkleTree_Low_merkle_tree *mt, uint8_t
 
 void MerkleTree_Low_mt_insert(MerkleTree_Low_merkle_tree *mt, uint8_t *v);
 
+bool
+MerkleTree_Low_mt_insert_batch_pre(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint8_t *leaves,
+  uint32_t n
+);
+
+void MerkleTree_Low_mt_insert_batch(MerkleTree_Low_merkle_tree *mt, uint8_t *leaves, uint32_t n);
+
 MerkleTree_Low_merkle_tree
 *MerkleTree_Low_mt_create_custom(
   uint32_t hsz,
@@ -457,6 +625,13 @@ MerkleTree_Low_merkle_tree
   void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
 );
 
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_mt_create_custom_arena(
+  uint32_t hsz,
+  uint8_t *init,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
 bool MerkleTree_Low_uu___is_Path(MerkleTree_Low_path projectee);
 
 uint32_t MerkleTree_Low___proj__Path__item__hash_size(MerkleTree_Low_path projectee);
@@ -570,6 +745,43 @@ MerkleTree_Low_Serialization_mt_serialize_path(
 MerkleTree_Low_path
 *MerkleTree_Low_Serialization_mt_deserialize_path(const uint8_t *input, uint64_t sz);
 
+uint64_t
+MerkleTree_Low_Serialization_mt_image_size(const MerkleTree_Low_merkle_tree *mt, uint32_t slack);
+
+uint64_t
+MerkleTree_Low_Serialization_mt_image_write(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint32_t slack,
+  uint8_t *buf,
+  uint64_t len
+);
+
+MerkleTree_Low_merkle_tree
+*MerkleTree_Low_Serialization_mt_image_open(
+  uint8_t *buf,
+  uint64_t len,
+  bool writable,
+  void (*hash_fun)(uint8_t *x0, uint8_t *x1, uint8_t *x2)
+);
+
+uint64_t
+MerkleTree_Low_Serialization_mt_delta_size(const MerkleTree_Low_merkle_tree *mt, uint64_t since);
+
+uint64_t
+MerkleTree_Low_Serialization_mt_delta_write(
+  const MerkleTree_Low_merkle_tree *mt,
+  uint64_t since,
+  uint8_t *buf,
+  uint64_t len
+);
+
+bool
+MerkleTree_Low_Serialization_mt_delta_apply(
+  MerkleTree_Low_merkle_tree *mt,
+  const uint8_t *buf,
+  uint64_t len
+);
+
 uint8_t *MerkleTree_Low_Hashfunctions_init_hash(uint32_t hsz);
 
 void MerkleTree_Low_Hashfunctions_free_hash(uint8_t *h);
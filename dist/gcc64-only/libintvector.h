@@ -418,6 +418,134 @@ typedef __m256i Lib_IntVector_Intrinsics_vec256;
 #define Lib_IntVector_Intrinsics_vec256_interleave_high128(x1, x2) \
   (_mm256_permute2x128_si256(x1, x2, 0x31))
 
+// The following functions are only available on machines that support Intel AVX512
+// (AVX512F, AVX512DQ, AVX512BW and AVX512VL, as checked by EverCrypt_AutoConfig2_has_avx512)
+
+typedef __m512i Lib_IntVector_Intrinsics_vec512;
+
+#define Lib_IntVector_Intrinsics_vec512_eq64(x0, x1) \
+  (_mm512_movm_epi64(_mm512_cmpeq_epi64_mask(x0, x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_eq32(x0, x1) \
+  (_mm512_movm_epi32(_mm512_cmpeq_epi32_mask(x0, x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_gt64(x0, x1) \
+  (_mm512_movm_epi64(_mm512_cmpgt_epi64_mask(x0, x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_gt32(x0, x1) \
+  (_mm512_movm_epi32(_mm512_cmpgt_epi32_mask(x0, x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_xor(x0, x1) \
+  (_mm512_xor_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_or(x0, x1) \
+  (_mm512_or_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_and(x0, x1) \
+  (_mm512_and_si512(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_lognot(x0) \
+  (_mm512_xor_si512(x0, _mm512_set1_epi32(-1)))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_left64(x0, x1) \
+  (_mm512_slli_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_right64(x0, x1) \
+  (_mm512_srli_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_left32(x0, x1) \
+  (_mm512_slli_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_shift_right32(x0, x1) \
+  (_mm512_srli_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_left32(x0,x1)	\
+  (_mm512_rol_epi32(x0,x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_right32(x0,x1)	\
+  (_mm512_ror_epi32(x0,x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_right64(x0,x1)	\
+  (_mm512_ror_epi64(x0,x1))
+
+#define Lib_IntVector_Intrinsics_vec512_rotate_left64(x0,x1)	\
+  (_mm512_rol_epi64(x0,x1))
+
+// Rotates the 64-bit lanes within each 256-bit half, as vec256_rotate_right_lanes64
+#define Lib_IntVector_Intrinsics_vec512_rotate_right_lanes64(x0, x1)	\
+  (_mm512_permutex_epi64(x0, _MM_SHUFFLE((x1+3)%4,(x1+2)%4,(x1+1)%4,x1%4)))
+
+#define Lib_IntVector_Intrinsics_vec512_load_le(x0) \
+  (_mm512_loadu_si512((__m512i*)(x0)))
+
+#define Lib_IntVector_Intrinsics_vec512_store_le(x0, x1) \
+  (_mm512_storeu_si512((__m512i*)(x0), x1))
+
+#define Lib_IntVector_Intrinsics_vec512_zero  \
+  (_mm512_setzero_si512())
+
+#define Lib_IntVector_Intrinsics_vec512_add64(x0, x1) \
+  (_mm512_add_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_sub64(x0, x1)		\
+  (_mm512_sub_epi64(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_mul64(x0, x1) \
+  (_mm512_mul_epu32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_smul64(x0, x1) \
+  (_mm512_mul_epu32(x0, _mm512_set1_epi64(x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_add32(x0, x1) \
+  (_mm512_add_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_sub32(x0, x1)		\
+  (_mm512_sub_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_mul32(x0, x1) \
+  (_mm512_mullo_epi32(x0, x1))
+
+#define Lib_IntVector_Intrinsics_vec512_smul32(x0, x1) \
+  (_mm512_mullo_epi32(x0, _mm512_set1_epi32(x1)))
+
+#define Lib_IntVector_Intrinsics_vec512_load64(x1) \
+  (_mm512_set1_epi64(x1)) /* hi lo */
+
+#define Lib_IntVector_Intrinsics_vec512_load64s(x0, x1, x2, x3, x4, x5, x6, x7) \
+  (_mm512_set_epi64(x7, x6, x5, x4, x3, x2, x1, x0)) /* hi lo */
+
+#define Lib_IntVector_Intrinsics_vec512_load32(x) \
+  (_mm512_set1_epi32(x))
+
+#define Lib_IntVector_Intrinsics_vec512_load32s(x0,x1,x2,x3,x4,x5,x6,x7,x8,x9,x10,x11,x12,x13,x14,x15) \
+  (_mm512_set_epi32(x15, x14, x13, x12, x11, x10, x9, x8, x7, x6, x5, x4, x3, x2, x1, x0)) /* hi lo */
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low32(x1, x2) \
+  (_mm512_unpacklo_epi32(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high32(x1, x2) \
+  (_mm512_unpackhi_epi32(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low64(x1, x2) \
+  (_mm512_unpacklo_epi64(x1, x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high64(x1, x2) \
+  (_mm512_unpackhi_epi64(x1, x2))
+
+// The 128-bit interleavings work within each 256-bit half, as vec256_interleave_low128
+#define Lib_IntVector_Intrinsics_vec512_interleave_low128(x1, x2) \
+  (_mm512_permutex2var_epi64(x1, _mm512_set_epi64(13,12,5,4,9,8,1,0), x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high128(x1, x2) \
+  (_mm512_permutex2var_epi64(x1, _mm512_set_epi64(15,14,7,6,11,10,3,2), x2))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_low256(x1, x2) \
+  (_mm512_shuffle_i64x2(x1, x2, 0x44))
+
+#define Lib_IntVector_Intrinsics_vec512_interleave_high256(x1, x2) \
+  (_mm512_shuffle_i64x2(x1, x2, 0xee))
+
+
 
 #elif (defined(__aarch64__) || defined(_M_ARM64) || defined(__arm__) || defined(_M_ARM)) \
       && !defined(__ARM_32BIT_STATE)
@@ -0,0 +1,23 @@
+#ifndef __QUIC_HP
+#define __QUIC_HP
+
+#include <stdint.h>
+
+// Internal header protection kernels of the QUIC provider, only built on
+// x86-64 hosts (QUIC_HP_X64). The AES kernels (quic_hp_aes.c) are compiled
+// with -maes and must only be called when EverCrypt_AutoConfig2_has_aesni()
+// holds; the ChaCha20 kernel (quic_hp_chacha20.c) is compiled with -mavx2
+// and must only be called when EverCrypt_AutoConfig2_has_avx2() holds.
+
+// Size of the expanded AES-256 key; AES-128 uses the first 176 bytes
+#define QUIC_HP_AES_ROUND_KEYS 240
+
+// Expands a 16 or 32-byte AES key into round_keys
+void quic_hp_aes_expand(unsigned char *round_keys, const unsigned char *key, uint32_t key_len);
+
+// Each of the following writes the 5-byte mask of samples[i] (16 bytes)
+// to masks + 5*i, for i < n.
+void quic_hp_aes_masks(const unsigned char *round_keys, uint32_t key_len, uint32_t n, const unsigned char **samples, unsigned char *masks);
+void quic_hp_chacha20_masks(const unsigned char *key, uint32_t n, const unsigned char **samples, unsigned char *masks);
+
+#endif /* end of include guard:  */
@@ -0,0 +1,79 @@
+#include <stdint.h>
+#include <string.h>
+#include <wmmintrin.h>
+
+#include "quic_hp.h"
+
+// AES: samples are independent blocks, so eight of them are kept in
+// flight to hide the latency of aesenc.
+
+#define EXPAND_STEP(k, t, shuf) \
+  do { \
+    __m128i t_ = _mm_shuffle_epi32(t, shuf); \
+    k = _mm_xor_si128(k, _mm_slli_si128(k, 4)); \
+    k = _mm_xor_si128(k, _mm_slli_si128(k, 4)); \
+    k = _mm_xor_si128(k, _mm_slli_si128(k, 4)); \
+    k = _mm_xor_si128(k, t_); \
+  } while (0)
+
+#define EXPAND128(i, rcon) \
+  do { \
+    __m128i t = _mm_aeskeygenassist_si128(k0, rcon); \
+    EXPAND_STEP(k0, t, 0xff); \
+    _mm_storeu_si128((__m128i *)(round_keys + 16 * (i)), k0); \
+  } while (0)
+
+#define EXPAND256(i, rcon) \
+  do { \
+    __m128i t = _mm_aeskeygenassist_si128(k1, rcon); \
+    EXPAND_STEP(k0, t, 0xff); \
+    _mm_storeu_si128((__m128i *)(round_keys + 32 * (i)), k0); \
+    if ((i) < 7) { \
+      t = _mm_aeskeygenassist_si128(k0, 0); \
+      EXPAND_STEP(k1, t, 0xaa); \
+      _mm_storeu_si128((__m128i *)(round_keys + 32 * (i) + 16), k1); \
+    } \
+  } while (0)
+
+void quic_hp_aes_expand(unsigned char *round_keys, const unsigned char *key, uint32_t key_len)
+{
+  __m128i k0 = _mm_loadu_si128((const __m128i *)key);
+  _mm_storeu_si128((__m128i *)round_keys, k0);
+  if (key_len == 16)
+  {
+    EXPAND128(1, 0x01); EXPAND128(2, 0x02); EXPAND128(3, 0x04); EXPAND128(4, 0x08);
+    EXPAND128(5, 0x10); EXPAND128(6, 0x20); EXPAND128(7, 0x40); EXPAND128(8, 0x80);
+    EXPAND128(9, 0x1b); EXPAND128(10, 0x36);
+  }
+  else
+  {
+    __m128i k1 = _mm_loadu_si128((const __m128i *)(key + 16));
+    _mm_storeu_si128((__m128i *)(round_keys + 16), k1);
+    EXPAND256(1, 0x01); EXPAND256(2, 0x02); EXPAND256(3, 0x04); EXPAND256(4, 0x08);
+    EXPAND256(5, 0x10); EXPAND256(6, 0x20); EXPAND256(7, 0x40);
+  }
+}
+
+void quic_hp_aes_masks(const unsigned char *round_keys, uint32_t key_len, uint32_t n, const unsigned char **samples, unsigned char *masks)
+{
+  uint32_t rounds = key_len == 16 ? 10 : 14;
+  __m128i rk[15];
+  for (uint32_t r = 0; r <= rounds; r++)
+    rk[r] = _mm_loadu_si128((const __m128i *)(round_keys + 16 * r));
+
+  for (uint32_t i = 0; i < n; i += 8)
+  {
+    uint32_t lanes = n - i < 8 ? n - i : 8;
+    __m128i b[8];
+    unsigned char out[8][16];
+    for (uint32_t j = 0; j < 8; j++)
+      b[j] = _mm_xor_si128(_mm_loadu_si128((const __m128i *)samples[i + (j < lanes ? j : 0)]), rk[0]);
+    for (uint32_t r = 1; r < rounds; r++)
+      for (uint32_t j = 0; j < 8; j++)
+        b[j] = _mm_aesenc_si128(b[j], rk[r]);
+    for (uint32_t j = 0; j < 8; j++)
+      _mm_storeu_si128((__m128i *)out[j], _mm_aesenclast_si128(b[j], rk[rounds]));
+    for (uint32_t j = 0; j < lanes; j++)
+      memcpy(masks + 5 * (i + j), out[j], 5);
+  }
+}
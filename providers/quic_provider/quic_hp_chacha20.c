@@ -0,0 +1,82 @@
+#include <stdint.h>
+#include <immintrin.h>
+
+#include "quic_hp.h"
+
+// ChaCha20: every sample has its own counter and nonce, so the eight
+// lanes of each vector hold the same state word of eight different
+// samples. Only the first five keystream bytes (words 0 and 1) are kept.
+
+static inline uint32_t load32_le(const unsigned char *b)
+{
+  return (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+}
+
+#define ROTL(x, n) _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32 - (n)))
+
+#define QUARTER_ROUND(a, b, c, d) \
+  do { \
+    x[a] = _mm256_add_epi32(x[a], x[b]); x[d] = _mm256_shuffle_epi8(_mm256_xor_si256(x[d], x[a]), rot16); \
+    x[c] = _mm256_add_epi32(x[c], x[d]); x[b] = ROTL(_mm256_xor_si256(x[b], x[c]), 12); \
+    x[a] = _mm256_add_epi32(x[a], x[b]); x[d] = _mm256_shuffle_epi8(_mm256_xor_si256(x[d], x[a]), rot8); \
+    x[c] = _mm256_add_epi32(x[c], x[d]); x[b] = ROTL(_mm256_xor_si256(x[b], x[c]), 7); \
+  } while (0)
+
+void quic_hp_chacha20_masks(const unsigned char *key, uint32_t n, const unsigned char **samples, unsigned char *masks)
+{
+  const __m256i rot16 = _mm256_set_epi8(
+    13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2,
+    13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
+  const __m256i rot8 = _mm256_set_epi8(
+    14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3,
+    14, 13, 12, 15, 10, 9, 8, 11, 6, 5, 4, 7, 2, 1, 0, 3);
+  __m256i init[12];
+  init[0] = _mm256_set1_epi32(0x61707865);
+  init[1] = _mm256_set1_epi32(0x3320646e);
+  init[2] = _mm256_set1_epi32(0x79622d32);
+  init[3] = _mm256_set1_epi32(0x6b206574);
+  for (int k = 0; k < 8; k++)
+    init[4 + k] = _mm256_set1_epi32((int)load32_le(key + 4 * k));
+
+  for (uint32_t i = 0; i < n; i += 8)
+  {
+    uint32_t lanes = n - i < 8 ? n - i : 8;
+    uint32_t w[4][8];
+    __m256i x[16];
+    for (uint32_t j = 0; j < 8; j++)
+    {
+      const unsigned char *s = samples[i + (j < lanes ? j : 0)];
+      for (int k = 0; k < 4; k++)
+        w[k][j] = load32_le(s + 4 * k);
+    }
+    for (int k = 0; k < 12; k++)
+      x[k] = init[k];
+    for (int k = 0; k < 4; k++)
+      x[12 + k] = _mm256_loadu_si256((const __m256i *)w[k]);
+
+    for (int r = 0; r < 10; r++)
+    {
+      QUARTER_ROUND(0, 4, 8, 12);
+      QUARTER_ROUND(1, 5, 9, 13);
+      QUARTER_ROUND(2, 6, 10, 14);
+      QUARTER_ROUND(3, 7, 11, 15);
+      QUARTER_ROUND(0, 5, 10, 15);
+      QUARTER_ROUND(1, 6, 11, 12);
+      QUARTER_ROUND(2, 7, 8, 13);
+      QUARTER_ROUND(3, 4, 9, 14);
+    }
+
+    uint32_t k0[8], k1[8];
+    _mm256_storeu_si256((__m256i *)k0, _mm256_add_epi32(x[0], init[0]));
+    _mm256_storeu_si256((__m256i *)k1, _mm256_add_epi32(x[1], init[1]));
+    for (uint32_t j = 0; j < lanes; j++)
+    {
+      unsigned char *m = masks + 5 * (i + j);
+      m[0] = (unsigned char)k0[j];
+      m[1] = (unsigned char)(k0[j] >> 8);
+      m[2] = (unsigned char)(k0[j] >> 16);
+      m[3] = (unsigned char)(k0[j] >> 24);
+      m[4] = (unsigned char)k1[j];
+    }
+  }
+}
@@ -12,16 +12,25 @@
 #include "kremlib.h"
 #include "EverCrypt.h"
 #include "quic_provider.h"
+#include "quic_hp.h"
 
 typedef struct quic_key {
   mitls_aead alg;
   unsigned char key[32];
   unsigned char static_iv[12];
+  // Expanded AEAD key (round keys, GHASH table, or the ChaCha20 key).
+  // EverCrypt_AEAD has a portable implementation of each of the three
+  // algorithms, so this is set for every key that was created.
+  EverCrypt_AEAD_state_s *aead;
   union {
     unsigned char case_chacha20[32];
     EverCrypt_aes128_key case_aes128;
     EverCrypt_aes256_key case_aes256;
   } pne;
+  // AES-NI round keys of the header protection key, used to compute
+  // several masks at once; hp_aesni is 0 when they are not available.
+  int hp_aesni;
+  unsigned char hp_round_keys[QUIC_HP_AES_ROUND_KEYS];
 } quic_key;
 
 #if DEBUG
@@ -205,6 +214,29 @@ int MITLS_CALLCONV quic_derive_initial_secrets(quic_secret *client_in, quic_secr
   return 1;
 }
 
+static int create_aead_state(quic_key *key)
+{
+  Spec_Agile_AEAD_alg a =
+    key->alg == TLS_aead_AES_128_GCM ? Spec_Agile_AEAD_AES128_GCM :
+      (key->alg == TLS_aead_AES_256_GCM ? Spec_Agile_AEAD_AES256_GCM : Spec_Agile_AEAD_CHACHA20_POLY1305);
+
+  key->aead = NULL;
+  if(EverCrypt_AEAD_create_in(a, &key->aead, key->key) != EverCrypt_Error_Success)
+    key->aead = NULL;
+  return key->aead != NULL;
+}
+
+static void create_hp_round_keys(quic_key *key, const unsigned char *pne_key, uint32_t klen)
+{
+#ifdef QUIC_HP_X64
+  key->hp_aesni = key->alg != TLS_aead_CHACHA20_POLY1305 && EverCrypt_AutoConfig2_has_aesni();
+  if(key->hp_aesni)
+    quic_hp_aes_expand(key->hp_round_keys, pne_key, klen);
+#else
+  key->hp_aesni = 0;
+#endif
+}
+
 int MITLS_CALLCONV quic_crypto_derive_key(quic_key **k, const quic_secret *secret)
 {
   quic_key *key = KRML_HOST_MALLOC(sizeof(quic_key));
@@ -252,6 +284,12 @@ int MITLS_CALLCONV quic_crypto_derive_key(quic_key **k, const quic_secret *secre
      memcpy(key->pne.case_chacha20, pnkey, 32);
    }
 
+  if(!create_aead_state(key))
+  {
+    quic_crypto_free_key(key);
+    return 0;
+  }
+  create_hp_round_keys(key, pnkey, klen);
   *k = key;
   return 1;
 }
@@ -279,6 +317,12 @@ int MITLS_CALLCONV quic_crypto_create(quic_key **key, mitls_aead alg, const unsi
   else if(alg == TLS_aead_CHACHA20_POLY1305)
     memcpy(k->pne.case_chacha20, pne_key, 32);
 
+  if(!create_aead_state(k))
+  {
+    quic_crypto_free_key(k);
+    return 0;
+  }
+  create_hp_round_keys(k, pne_key, klen);
   *key = k;
   return 1;
 }
@@ -290,19 +334,8 @@ int MITLS_CALLCONV quic_crypto_encrypt(quic_key *key, unsigned char *cipher, uin
   memcpy(iv, key->static_iv, 12);
   sn_to_iv(iv, sn);
 
-  if(key->alg == TLS_aead_AES_128_GCM)
-  {
-    EverCrypt_aes128_gcm_encrypt(key->key, iv, (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, (cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_AES_256_GCM)
-  {
-    EverCrypt_aes256_gcm_encrypt(key->key, iv, (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, (cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_CHACHA20_POLY1305)
-  {
-    EverCrypt_Chacha20Poly1305_aead_encrypt(key->key, iv, ad_len, (uint8_t*)ad,
-        plain_len, (uint8_t*)plain, cipher, cipher + plain_len);
-  }
+  if(EverCrypt_AEAD_encrypt(key->aead, iv, 12, (uint8_t*)ad, ad_len, (uint8_t*)plain, plain_len, cipher, cipher+plain_len) != EverCrypt_Error_Success)
+    return 0;
 
 #if DEBUG
   printf("ENCRYPT %s\n", key->alg == TLS_aead_AES_128_GCM ? "AES128-GCM" : (key->alg == TLS_aead_AES_256_GCM ? "AES256-GCM" : "CHACHA20-POLY1305"));
@@ -329,19 +362,7 @@ int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, unsigned char *plain, uint
 
   uint32_t r = 0, plain_len = cipher_len - quic_crypto_tag_length(key);
 
-  if(key->alg == TLS_aead_AES_128_GCM)
-  {
-    r = EverCrypt_aes128_gcm_decrypt(key->key, iv, (uint8_t*)ad, ad_len, plain, plain_len, (uint8_t*)cipher, (uint8_t*)(cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_AES_256_GCM)
-  {
-    r = EverCrypt_aes256_gcm_decrypt(key->key, iv, (uint8_t*)ad, ad_len, plain, plain_len, (uint8_t*)cipher, (uint8_t*)(cipher+plain_len));
-  }
-  else if(key->alg == TLS_aead_CHACHA20_POLY1305)
-  {
-    r = 1 - EverCrypt_Chacha20Poly1305_aead_decrypt(key->key, iv, ad_len, (uint8_t*)ad,
-        plain_len, (uint8_t*)plain, cipher, (uint8_t*)(cipher+plain_len));
-  }
+  r = EverCrypt_AEAD_decrypt(key->aead, iv, 12, (uint8_t*)ad, ad_len, (uint8_t*)cipher, plain_len, (uint8_t*)(cipher+plain_len), plain) == EverCrypt_Error_Success;
 
 #if DEBUG
   printf("DECRYPT %X->%X %s\n", cipher, plain, r?"OK":"BAD");
@@ -356,6 +377,41 @@ int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, unsigned char *plain, uint
   return r;
 }
 
+int MITLS_CALLCONV quic_crypto_encrypt_batch(quic_key *key, uint32_t n, unsigned char **cipher, const uint64_t *sn,
+  const unsigned char **ad, const uint32_t *ad_len, const unsigned char **plain, const uint32_t *plain_len,
+  const uint32_t *sample_offset, unsigned char *masks)
+{
+  int r = 1;
+  for(uint32_t i = 0; i < n; i++)
+    r &= quic_crypto_encrypt(key, cipher[i], sn[i], ad[i], ad_len[i], plain[i], plain_len[i]);
+
+  if(masks != NULL)
+  {
+    const unsigned char *samples[64];
+    for(uint32_t i = 0; i < n; i += 64)
+    {
+      uint32_t m = n - i < 64 ? n - i : 64;
+      for(uint32_t j = 0; j < m; j++)
+        samples[j] = cipher[i + j] + sample_offset[i + j];
+      r &= quic_crypto_hp_mask_many(key, m, samples, masks + 5 * i);
+    }
+  }
+  return r;
+}
+
+int MITLS_CALLCONV quic_crypto_decrypt_batch(quic_key *key, uint32_t n, unsigned char **plain, const uint64_t *sn,
+  const unsigned char **ad, const uint32_t *ad_len, const unsigned char **cipher, const uint32_t *cipher_len,
+  int *valid)
+{
+  int r = 1;
+  for(uint32_t i = 0; i < n; i++)
+  {
+    valid[i] = quic_crypto_decrypt(key, plain[i], sn[i], ad[i], ad_len[i], cipher[i], cipher_len[i]);
+    r &= valid[i];
+  }
+  return r;
+}
+
 int MITLS_CALLCONV quic_crypto_hp_mask(quic_key *key, const unsigned char *sample, unsigned char *mask)
 {
   unsigned char block[16];
@@ -386,6 +442,30 @@ int MITLS_CALLCONV quic_crypto_hp_mask(quic_key *key, const unsigned char *sampl
   return 0;
 }
 
+int MITLS_CALLCONV quic_crypto_hp_mask_many(quic_key *key, uint32_t n, const unsigned char **samples, unsigned char *masks)
+{
+#ifdef QUIC_HP_X64
+  if(key->hp_aesni)
+  {
+    quic_hp_aes_masks(key->hp_round_keys, key->alg == TLS_aead_AES_128_GCM ? 16 : 32, n, samples, masks);
+    return 1;
+  }
+
+  if(key->alg == TLS_aead_CHACHA20_POLY1305 && EverCrypt_AutoConfig2_has_avx2())
+  {
+    quic_hp_chacha20_masks(key->pne.case_chacha20, n, samples, masks);
+    return 1;
+  }
+#endif
+
+  for(uint32_t i = 0; i < n; i++)
+  {
+    if(!quic_crypto_hp_mask(key, samples[i], masks + 5 * i))
+      return 0;
+  }
+  return 1;
+}
+
 int MITLS_CALLCONV quic_crypto_free_key(quic_key *key)
 {
   if(key != NULL)
@@ -394,6 +474,8 @@ int MITLS_CALLCONV quic_crypto_free_key(quic_key *key)
       EverCrypt_aes128_free(key->pne.case_aes128);
     if(key->alg == TLS_aead_AES_256_GCM)
       EverCrypt_aes256_free(key->pne.case_aes256);
+    if(key->aead != NULL)
+      EverCrypt_AEAD_free(key->aead);
     KRML_HOST_FREE(key);
   }
   return 1;
@@ -68,11 +68,32 @@ int MITLS_CALLCONV quic_crypto_encrypt(quic_key *key, /*out*/ unsigned char *cip
 // output plain. The input and output buffers must not overlap.
 int MITLS_CALLCONV quic_crypto_decrypt(quic_key *key, /*out*/ unsigned char *plain, uint64_t sn, const unsigned char *ad, uint32_t ad_len, const unsigned char *cipher, uint32_t cipher_len);
 
+// Batched forms of quic_crypto_encrypt and quic_crypto_decrypt for a
+// train of n packets (e.g. one GSO send or one recvmmsg call), all
+// protected with the same key; packet i uses sn[i], ad[i], ad_len[i]
+// and the buffers at index i, with the same lengths and overlap rules
+// as the single-packet functions. The expanded key is shared by the
+// whole train.
+//
+// When masks is not NULL, encrypt_batch also writes the 5-byte header
+// protection mask of packet i to masks + 5*i, computed from the sample
+// at cipher[i] + sample_offset[i]. Both functions return 1 only if
+// every packet succeeded; decrypt_batch reports each packet in valid[i].
+// Header protection must be removed before calling decrypt_batch, since
+// the packet number and the header are inputs of the decryption.
+int MITLS_CALLCONV quic_crypto_encrypt_batch(quic_key *key, uint32_t n, /*out*/ unsigned char **cipher, const uint64_t *sn, const unsigned char **ad, const uint32_t *ad_len, const unsigned char **plain, const uint32_t *plain_len, const uint32_t *sample_offset, /*out*/ unsigned char *masks);
+int MITLS_CALLCONV quic_crypto_decrypt_batch(quic_key *key, uint32_t n, /*out*/ unsigned char **plain, const uint64_t *sn, const unsigned char **ad, const uint32_t *ad_len, const unsigned char **cipher, const uint32_t *cipher_len, /*out*/ int *valid);
+
 // Compute a one time pad to obfuscate the packet number from the encrypted packet contents
 // *sample must point to the start of the encrypted packet payload
 // 5 bytes will be written to *mask
 int MITLS_CALLCONV quic_crypto_hp_mask(quic_key *key, const unsigned char *sample, unsigned char *mask);
 
+// Computes the masks of n samples at once, e.g. for a burst of received
+// packets, writing the 5-byte mask of samples[i] to masks + 5*i. The
+// samples are processed 8 at a time with AES-NI or AVX2 when available.
+int MITLS_CALLCONV quic_crypto_hp_mask_many(quic_key *key, uint32_t n, const unsigned char **samples, /*out*/ unsigned char *masks);
+
 // Keys allocated by quic_crypto_derive_key and quic_crypto_create must be freed
 int MITLS_CALLCONV quic_crypto_free_key(quic_key *key);
 
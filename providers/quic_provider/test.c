@@ -481,6 +481,72 @@ void test_crypto(const quic_secret *secret, const unsigned char *expected_cipher
     printf("PASS\n");
 }
 
+// Encrypts a train of packets of varying lengths with the batch API and
+// checks it against the single-packet functions, including header
+// protection masks and a tampered packet on the receive side.
+#define BATCH 7
+void test_batch(const quic_secret *secret)
+{
+    quic_key *key;
+    unsigned char plain_b[BATCH][96], cipher_b[BATCH][112], single[112], decrypted_b[BATCH][96];
+    unsigned char *cipher_p[BATCH], *decrypted_p[BATCH];
+    const unsigned char *plain_p[BATCH], *ad_p[BATCH], *cipher_cp[BATCH];
+    uint64_t sns[BATCH];
+    uint32_t ad_lens[BATCH], plain_lens[BATCH], cipher_lens[BATCH], sample_offsets[BATCH];
+    unsigned char masks[5 * BATCH], mask[5];
+    int valid[BATCH];
+
+    printf("==== test_batch(%s,%s) ====\n",
+        hash_to_name[secret->hash], aead_to_name[secret->ae]);
+
+    if (!quic_crypto_derive_key(&key, secret)) {
+        printf("FAIL: quic_crypto_derive_key failed\n");
+        exit(1);
+    }
+
+    for (int i = 0; i < BATCH; i++) {
+        memset(plain_b[i], 'a' + i, sizeof(plain_b[i]));
+        plain_p[i] = plain_b[i];
+        cipher_p[i] = cipher_b[i];
+        cipher_cp[i] = cipher_b[i];
+        decrypted_p[i] = decrypted_b[i];
+        ad_p[i] = ad;
+        ad_lens[i] = ad_len - i;
+        plain_lens[i] = 20 + 11 * i;
+        cipher_lens[i] = plain_lens[i] + 16;
+        sample_offsets[i] = 4;
+        sns[i] = sn + i;
+    }
+
+    if (!quic_crypto_encrypt_batch(key, BATCH, cipher_p, sns, ad_p, ad_lens, plain_p, plain_lens, sample_offsets, masks)) {
+        printf("FAIL: quic_crypto_encrypt_batch failed\n");
+        exit(1);
+    }
+    for (int i = 0; i < BATCH; i++) {
+        quic_crypto_encrypt(key, single, sns[i], ad_p[i], ad_lens[i], plain_p[i], plain_lens[i]);
+        check_result("quic_crypto_encrypt_batch", cipher_b[i], single, cipher_lens[i]);
+        quic_crypto_hp_mask(key, single + sample_offsets[i], mask);
+        check_result("quic_crypto_encrypt_batch mask", masks + 5 * i, mask, 5);
+    }
+
+    cipher_b[3][0] ^= 1;
+    if (quic_crypto_decrypt_batch(key, BATCH, decrypted_p, sns, ad_p, ad_lens, cipher_cp, cipher_lens, valid)) {
+        printf("FAIL: quic_crypto_decrypt_batch accepted a tampered packet\n");
+        exit(1);
+    }
+    for (int i = 0; i < BATCH; i++) {
+        if (valid[i] != (i != 3)) {
+            printf("FAIL: quic_crypto_decrypt_batch result %d for packet %d\n", valid[i], i);
+            exit(1);
+        }
+        if (valid[i])
+            check_result("quic_crypto_decrypt_batch", decrypted_b[i], plain_b[i], plain_lens[i]);
+    }
+
+    quic_crypto_free_key(key);
+    printf("PASS\n");
+}
+
 const uint8_t expected_client_hs[] =  { // client_hs (draft 19)
 0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xf5,0x2b,0x9b,0x3a,0xe4,0x67,0x7a,
 0x63,0x67,0xa7,0x74,0x12,0xb1,0x9d,0xdb,0xf1,0x54,0xc9,0xa2,0x55,0xea,0xf8,0x77,
@@ -542,6 +608,50 @@ void test_pn_encrypt()
   }
 }
 
+// Compares the multi-sample mask computation with quic_crypto_hp_mask
+// for each algorithm, on a number of samples that is not a multiple of
+// the vector width.
+void test_hp_mask_many()
+{
+  printf("==== test_hp_mask_many() ====\n");
+
+  unsigned char raw_key[32], iv[12] = {0}, pne_key[32];
+  unsigned char samples_b[37][16], masks[5 * 37], mask[5];
+  const unsigned char *samples[37];
+  mitls_aead algs[3] = { TLS_aead_AES_128_GCM, TLS_aead_AES_256_GCM, TLS_aead_CHACHA20_POLY1305 };
+
+  for (int i = 0; i < 32; i++) {
+    raw_key[i] = (unsigned char)(3 * i);
+    pne_key[i] = (unsigned char)(7 * i + 1);
+  }
+  for (int i = 0; i < 37; i++) {
+    for (int j = 0; j < 16; j++)
+      samples_b[i][j] = (unsigned char)(i * 16 + j * 29);
+    samples[i] = samples_b[i];
+  }
+
+  for (int a = 0; a < 3; a++) {
+    quic_key *key;
+    if (!quic_crypto_create(&key, algs[a], raw_key, iv, pne_key)) {
+      printf("FAIL: quic_crypto_create failed\n");
+      exit(1);
+    }
+    for (uint32_t n = 1; n <= 37; n += 12) {
+      memset(masks, 0, sizeof(masks));
+      if (!quic_crypto_hp_mask_many(key, n, samples, masks)) {
+        printf("FAIL: quic_crypto_hp_mask_many failed\n");
+        exit(1);
+      }
+      for (uint32_t i = 0; i < n; i++) {
+        quic_crypto_hp_mask(key, samples[i], mask);
+        check_result("quic_crypto_hp_mask_many", masks + 5 * i, mask, 5);
+      }
+    }
+    quic_crypto_free_key(key);
+  }
+  printf("PASS\n");
+}
+
 void test_initial_secrets()
 {
     int result;
@@ -592,9 +702,11 @@ void exhaustive(void)
         secret.ae = testcombinations[i].ae;
 
         test_crypto(&secret, testcombinations[i].expected_cipher);
+        test_batch(&secret);
     }
 
     test_pn_encrypt();
+    test_hp_mask_many();
     test_initial_secrets();
 }
 
@@ -0,0 +1,247 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdbool.h>
+#include <openssl/evp.h>
+
+#include "Hacl_AES_Bitsliced.h"
+#include "EverCrypt_AEAD.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 4096
+#define SIZE   16384
+
+// Test cases 1, 2, 13 and 14 of the original GCM specification.
+static uint8_t zero[32] = { 0 };
+
+static uint8_t tc2_cipher[16] = {
+  0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92, 0xf3, 0x28, 0xc2, 0xb9, 0x71, 0xb2, 0xfe, 0x78
+};
+static uint8_t tc1_tag[16] = {
+  0x58, 0xe2, 0xfc, 0xce, 0xfa, 0x7e, 0x30, 0x61, 0x36, 0x7f, 0x1d, 0x57, 0xa4, 0xe7, 0x45, 0x5a
+};
+static uint8_t tc2_tag[16] = {
+  0xab, 0x6e, 0x47, 0xd4, 0x2c, 0xec, 0x13, 0xbd, 0xf5, 0x3a, 0x67, 0xb2, 0x12, 0x57, 0xbd, 0xdf
+};
+static uint8_t tc14_cipher[16] = {
+  0xce, 0xa7, 0x40, 0x3d, 0x4d, 0x60, 0x6b, 0x6e, 0x07, 0x4e, 0xc5, 0xd3, 0xba, 0xf3, 0x9d, 0x18
+};
+static uint8_t tc13_tag[16] = {
+  0x53, 0x0f, 0x8a, 0xfb, 0xc7, 0x45, 0x36, 0xb9, 0xa9, 0x63, 0xb4, 0xf1, 0xc4, 0xcb, 0x73, 0x8b
+};
+static uint8_t tc14_tag[16] = {
+  0xd0, 0xd1, 0xc8, 0xa7, 0x99, 0x99, 0x6b, 0xf0, 0x26, 0x5b, 0x98, 0xb5, 0xd4, 0x8a, 0xb9, 0x19
+};
+
+static uint64_t seed = 0x2545f4914f6cdd1dULL;
+
+static void fill(uint8_t *b, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    b[i] = (uint8_t)(seed >> 56);
+  }
+}
+
+bool test_vectors() {
+  uint64_t ctx[Hacl_AES_Bitsliced_ctx_len];
+  uint8_t cipher[16];
+  uint8_t tag[16];
+  bool ok = true;
+
+  printf("AES-128-GCM (bitsliced) test cases 1 and 2:\n");
+  Hacl_AES_Bitsliced_aes128_gcm_init(ctx, zero);
+  Hacl_AES_Bitsliced_aes_gcm_encrypt(ctx, 12, zero, 0, NULL, 0, NULL, cipher, tag);
+  ok = compare_and_print(16, tag, tc1_tag) && ok;
+  Hacl_AES_Bitsliced_aes_gcm_encrypt(ctx, 12, zero, 0, NULL, 16, zero, cipher, tag);
+  ok = compare_and_print(16, cipher, tc2_cipher) && ok;
+  ok = compare_and_print(16, tag, tc2_tag) && ok;
+
+  printf("AES-256-GCM (bitsliced) test cases 13 and 14:\n");
+  Hacl_AES_Bitsliced_aes256_gcm_init(ctx, zero);
+  Hacl_AES_Bitsliced_aes_gcm_encrypt(ctx, 12, zero, 0, NULL, 0, NULL, cipher, tag);
+  ok = compare_and_print(16, tag, tc13_tag) && ok;
+  Hacl_AES_Bitsliced_aes_gcm_encrypt(ctx, 12, zero, 0, NULL, 16, zero, cipher, tag);
+  ok = compare_and_print(16, cipher, tc14_cipher) && ok;
+  ok = compare_and_print(16, tag, tc14_tag) && ok;
+  return ok;
+}
+
+static void openssl_encrypt(
+  int key_len, uint8_t *key, int iv_len, uint8_t *iv, int ad_len, uint8_t *ad,
+  int len, uint8_t *plain, uint8_t *cipher, uint8_t *tag)
+{
+  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  int out_len;
+  EVP_EncryptInit_ex(ctx, key_len == 16 ? EVP_aes_128_gcm() : EVP_aes_256_gcm(), NULL, NULL, NULL);
+  EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_IVLEN, iv_len, NULL);
+  EVP_EncryptInit_ex(ctx, NULL, NULL, key, iv);
+  if (ad_len > 0)
+    EVP_EncryptUpdate(ctx, NULL, &out_len, ad, ad_len);
+  if (len > 0)
+    EVP_EncryptUpdate(ctx, cipher, &out_len, plain, len);
+  EVP_EncryptFinal_ex(ctx, cipher + len, &out_len);
+  EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, 16, tag);
+  EVP_CIPHER_CTX_free(ctx);
+}
+
+// Random keys, nonces of several lengths, and lengths around the 4-block
+// bitsliced stride, checked against OpenSSL; every tag is then tampered with.
+bool test_random(uint32_t key_len) {
+  uint8_t key[32], iv[64], ad[80];
+  uint8_t plain[300], cipher[300], exp_cipher[300], decrypted[300];
+  uint8_t tag[16], exp_tag[16];
+  uint32_t iv_lens[] = { 12, 1, 8, 16, 60 };
+  uint32_t ad_lens[] = { 0, 13, 16, 80 };
+  uint64_t ctx[Hacl_AES_Bitsliced_ctx_len];
+  bool ok = true;
+
+  for (uint32_t len = 0; len < 300; len += 7) {
+    uint32_t iv_len = iv_lens[len % 5];
+    uint32_t ad_len = ad_lens[len % 4];
+    fill(key, key_len);
+    fill(iv, iv_len);
+    fill(ad, ad_len);
+    fill(plain, len);
+    if (key_len == 16)
+      Hacl_AES_Bitsliced_aes128_gcm_init(ctx, key);
+    else
+      Hacl_AES_Bitsliced_aes256_gcm_init(ctx, key);
+    Hacl_AES_Bitsliced_aes_gcm_encrypt(ctx, iv_len, iv, ad_len, ad, len, plain, cipher, tag);
+    openssl_encrypt(key_len, key, iv_len, iv, ad_len, ad, len, plain, exp_cipher, exp_tag);
+    ok = ok && memcmp(cipher, exp_cipher, len) == 0 && memcmp(tag, exp_tag, 16) == 0;
+
+    memset(decrypted, 0, len);
+    bool valid = Hacl_AES_Bitsliced_aes_gcm_decrypt(ctx, iv_len, iv, ad_len, ad, len, decrypted, cipher, tag);
+    ok = ok && valid && memcmp(decrypted, plain, len) == 0;
+
+    tag[len % 16] ^= 0x10;
+    memset(decrypted, 0, len);
+    valid = Hacl_AES_Bitsliced_aes_gcm_decrypt(ctx, iv_len, iv, ad_len, ad, len, decrypted, cipher, tag);
+    for (uint32_t i = 0; i < len; i++)
+      ok = ok && decrypted[i] == 0;
+    ok = ok && !valid;
+  }
+  printf("AES-%u-GCM (bitsliced) against OpenSSL: %s\n", key_len * 8, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// With AES-NI and PCLMULQDQ disabled, EverCrypt_AEAD picks the bitsliced
+// implementation rather than failing with UnsupportedAlgorithm.
+bool test_evercrypt(Spec_Agile_AEAD_alg alg, uint32_t key_len) {
+  uint8_t key[32], iv[12], ad[20], plain[100], cipher[100], decrypted[100];
+  uint8_t tag[16], exp_cipher[100], exp_tag[16];
+  EverCrypt_AEAD_state_s *s = NULL;
+  bool ok = true;
+
+  fill(key, key_len);
+  fill(iv, 12);
+  fill(ad, 20);
+  fill(plain, 100);
+  openssl_encrypt(key_len, key, 12, iv, 20, ad, 100, plain, exp_cipher, exp_tag);
+
+  ok = EverCrypt_AEAD_create_in(alg, &s, key) == EverCrypt_Error_Success;
+  if (!ok) {
+    printf("EverCrypt AES-%u-GCM fallback: **FAILED** (create_in)\n", key_len * 8);
+    return false;
+  }
+  ok = ok && EverCrypt_AEAD_encrypt(s, iv, 12, ad, 20, plain, 100, cipher, tag) == EverCrypt_Error_Success;
+  ok = ok && memcmp(cipher, exp_cipher, 100) == 0 && memcmp(tag, exp_tag, 16) == 0;
+  ok = ok && EverCrypt_AEAD_decrypt(s, iv, 12, ad, 20, cipher, 100, tag, decrypted) == EverCrypt_Error_Success;
+  ok = ok && memcmp(decrypted, plain, 100) == 0;
+  tag[0] ^= 1;
+  ok = ok && EverCrypt_AEAD_decrypt(s, iv, 12, ad, 20, cipher, 100, tag, decrypted) == EverCrypt_Error_AuthenticationFailure;
+  EverCrypt_AEAD_free(s);
+
+  memset(cipher, 0, 100);
+  if (key_len == 16)
+    ok = ok && EverCrypt_AEAD_encrypt_expand_aes128_gcm(key, iv, 12, ad, 20, plain, 100, cipher, tag) == EverCrypt_Error_Success;
+  else
+    ok = ok && EverCrypt_AEAD_encrypt_expand_aes256_gcm(key, iv, 12, ad, 20, plain, 100, cipher, tag) == EverCrypt_Error_Success;
+  ok = ok && memcmp(cipher, exp_cipher, 100) == 0 && memcmp(tag, exp_tag, 16) == 0;
+
+  printf("EverCrypt AES-%u-GCM fallback: %s\n", key_len * 8, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// The in-place state matches a heap-allocated one, whichever implementation
+// is picked.
+bool test_in_place(Spec_Agile_AEAD_alg alg, const char *name) {
+  _Alignas(EverCrypt_AEAD_state_align) uint8_t mem[EverCrypt_AEAD_state_len];
+  uint8_t key[32], iv[12], ad[20], plain[100], cipher[100], decrypted[100];
+  uint8_t tag[16], exp_cipher[100], exp_tag[16];
+  EverCrypt_AEAD_state_s *s = NULL;
+  bool ok = true;
+
+  fill(key, 32);
+  fill(iv, 12);
+  fill(ad, 20);
+  fill(plain, 100);
+  ok = ok && EverCrypt_AEAD_create_in(alg, &s, key) == EverCrypt_Error_Success;
+  ok = ok && EverCrypt_AEAD_encrypt(s, iv, 12, ad, 20, plain, 100, exp_cipher, exp_tag) == EverCrypt_Error_Success;
+  EverCrypt_AEAD_free(s);
+
+  ok = ok && EverCrypt_AEAD_init_in_place(alg, &s, mem, key) == EverCrypt_Error_Success;
+  ok = ok && (uint8_t *)s == mem;
+  ok = ok && EverCrypt_AEAD_alg_of_state(s) == alg;
+  ok = ok && EverCrypt_AEAD_encrypt(s, iv, 12, ad, 20, plain, 100, cipher, tag) == EverCrypt_Error_Success;
+  ok = ok && memcmp(cipher, exp_cipher, 100) == 0 && memcmp(tag, exp_tag, 16) == 0;
+  ok = ok && EverCrypt_AEAD_decrypt(s, iv, 12, ad, 20, cipher, 100, tag, decrypted) == EverCrypt_Error_Success;
+  ok = ok && memcmp(decrypted, plain, 100) == 0;
+
+  printf("EverCrypt_AEAD_init_in_place (%s): %s\n", name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool ok = test_vectors();
+  ok = test_random(16) && ok;
+  ok = test_random(32) && ok;
+
+  ok = test_in_place(Spec_Agile_AEAD_AES128_GCM, "AES-128-GCM") && ok;
+  ok = test_in_place(Spec_Agile_AEAD_AES256_GCM, "AES-256-GCM") && ok;
+  ok = test_in_place(Spec_Agile_AEAD_CHACHA20_POLY1305, "ChaCha20-Poly1305") && ok;
+
+  EverCrypt_AutoConfig2_disable_aesni();
+  EverCrypt_AutoConfig2_disable_pclmulqdq();
+  ok = test_evercrypt(Spec_Agile_AEAD_AES128_GCM, 16) && ok;
+  ok = test_evercrypt(Spec_Agile_AEAD_AES256_GCM, 32) && ok;
+  ok = test_in_place(Spec_Agile_AEAD_AES128_GCM, "AES-128-GCM, bitsliced") && ok;
+  ok = test_in_place(Spec_Agile_AEAD_AES256_GCM, "AES-256-GCM, bitsliced") && ok;
+
+  uint8_t *plain = malloc(SIZE);
+  uint8_t key[16], iv[12], tag[16];
+  uint64_t ctx[Hacl_AES_Bitsliced_ctx_len];
+  fill(key, 16);
+  fill(iv, 12);
+  memset(plain, 'P', SIZE);
+  Hacl_AES_Bitsliced_aes128_gcm_init(ctx, key);
+  cycles a, b;
+  clock_t t1, t2;
+
+  for (int j = 0; j < ROUNDS / 16; j++)
+    Hacl_AES_Bitsliced_aes_gcm_encrypt(ctx, 12, iv, 0, NULL, SIZE, plain, plain, tag);
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS / 16; j++)
+    Hacl_AES_Bitsliced_aes_gcm_encrypt(ctx, 12, iv, 0, NULL, SIZE, plain, plain, tag);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff = b - a;
+  double tdiff = t2 - t1;
+
+  uint64_t count = ROUNDS / 16 * SIZE;
+  printf("AES-128-GCM (bitsliced) PERF: %d\n", (int)tag[0]); print_time(count, tdiff, cdiff);
+
+  free(plain);
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
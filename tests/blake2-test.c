@@ -13,6 +13,8 @@
 #include "Hacl_Blake2b_32.h"
 #include "Hacl_Blake2s_128.h"
 #include "Hacl_Blake2b_256.h"
+#include "Hacl_Blake2b_512.h"
+#include "Hacl_Streaming_Blake2.h"
 #include "EverCrypt_AutoConfig2.h"
 
 #include "test_helpers.h"
@@ -34,11 +36,60 @@ bool print_test2b(int in_len, uint8_t* in, int key_len, uint8_t* key, int exp_le
   printf("testing blake2b vec-32:\n");
   bool ok = print_result(exp_len,comp,exp);
 
+  if (exp_len == 64) {
+    _Alignas(Hacl_Streaming_Blake2_blake2b_32_state_align)
+      uint8_t mem[Hacl_Streaming_Blake2_blake2b_32_state_len];
+    Hacl_Streaming_Functor_state_s__K____uint64_t___uint64_t____ *s =
+      Hacl_Streaming_Blake2_blake2b_32_with_key_init_in_place(mem, key_len, key);
+    Hacl_Streaming_Blake2_blake2b_32_with_key_update(key_len, s, in, in_len / 2);
+    Hacl_Streaming_Blake2_blake2b_32_with_key_update(key_len, s, in + in_len / 2, in_len - in_len / 2);
+    Hacl_Streaming_Blake2_blake2b_32_with_key_finish(key_len, s, comp);
+    printf("testing blake2b streaming, in place:\n");
+    ok = ok && print_result(exp_len,comp,exp);
+  }
+
   if (EverCrypt_AutoConfig2_has_avx2()) {
     Hacl_Blake2b_256_blake2b(exp_len,comp,in_len,in,key_len,key);
     printf("testing blake2b vec-256:\n");
     ok = ok && print_result(exp_len,comp,exp);
   }
+
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    uint8_t comp2[exp_len];
+    uint8_t *out[2] = { comp, comp2 };
+    uint8_t *input[2] = { in, in };
+    Hacl_Blake2b_512_blake2b_2(exp_len,out,in_len,input,key_len,key);
+    printf("testing blake2b vec-512 (2 messages):\n");
+    ok = ok && print_result(exp_len,comp,exp);
+    ok = ok && print_result(exp_len,comp2,exp);
+  }
+  return ok;
+}
+
+// Two different messages per call, so that a mix-up between the two halves of
+// the vectors is caught, with and without a key.
+bool test_blake2b_2() {
+  uint8_t msg[2][600];
+  uint8_t key[64];
+  for (int i = 0; i < 600; i++) {
+    msg[0][i] = (uint8_t)(i * 3 + 1);
+    msg[1][i] = (uint8_t)(i * 5 + 7);
+  }
+  for (int i = 0; i < 64; i++)
+    key[i] = (uint8_t)i;
+  bool ok = true;
+  for (uint32_t len = 0; len <= 600; len++) {
+    uint32_t kk = len % 3 == 0 ? 0 : len % 65;
+    uint32_t nn = len % 64 + 1;
+    uint8_t exp0[64], exp1[64], comp0[64], comp1[64];
+    uint8_t *out[2] = { comp0, comp1 };
+    uint8_t *input[2] = { msg[0], msg[1] };
+    Hacl_Blake2b_32_blake2b(nn,exp0,len,msg[0],kk,key);
+    Hacl_Blake2b_32_blake2b(nn,exp1,len,msg[1],kk,key);
+    Hacl_Blake2b_512_blake2b_2(nn,out,len,input,kk,key);
+    ok = ok && memcmp(exp0,comp0,nn) == 0 && memcmp(exp1,comp1,nn) == 0;
+  }
+  printf("Blake2B (Vec 512-bit, 2 messages) vs 32-bit: %s\n", ok ? "Success!" : "**FAILED**");
   return ok;
 }
 
@@ -51,6 +102,18 @@ bool print_test2s(int in_len, uint8_t* in, int key_len, uint8_t* key, int exp_le
   printf("testing blake2s vec-32:\n");
   bool ok = print_result(exp_len,comp,exp);
 
+  if (exp_len == 32) {
+    _Alignas(Hacl_Streaming_Blake2_blake2s_32_state_align)
+      uint8_t mem[Hacl_Streaming_Blake2_blake2s_32_state_len];
+    Hacl_Streaming_Functor_state_s__K____uint32_t___uint32_t____ *s =
+      Hacl_Streaming_Blake2_blake2s_32_with_key_init_in_place(mem, key_len, key);
+    Hacl_Streaming_Blake2_blake2s_32_with_key_update(key_len, s, in, in_len / 2);
+    Hacl_Streaming_Blake2_blake2s_32_with_key_update(key_len, s, in + in_len / 2, in_len - in_len / 2);
+    Hacl_Streaming_Blake2_blake2s_32_with_key_finish(key_len, s, comp);
+    printf("testing blake2s streaming, in place:\n");
+    ok = ok && print_result(exp_len,comp,exp);
+  }
+
   Hacl_Blake2s_128_blake2s(exp_len,comp,in_len,in,key_len,key);
   printf("testing blake2s vec-128:\n");
   ok = ok && print_result(exp_len,comp,exp);
@@ -70,6 +133,9 @@ int main()
     ok &= print_test2s(vectors2s[i].input_len,vectors2s[i].input,vectors2s[i].key_len,vectors2s[i].key,vectors2s[i].expected_len,vectors2s[i].expected);
   }
 
+  if (EverCrypt_AutoConfig2_has_avx512())
+    ok &= test_blake2b_2();
+
   uint64_t len = SIZE;
   uint8_t plain[SIZE];
   cycles a,b;
@@ -133,6 +199,26 @@ int main()
   uint64_t cdiff4 = b - a;
   double tdiff4 = t2 - t1;
 
+
+  uint8_t plain2[SIZE];
+  memset(plain2,'Q',SIZE);
+  uint8_t *out[2] = { plain, plain2 };
+  uint8_t *input[2] = { plain, plain2 };
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    for (int j = 0; j < ROUNDS / 2; j++) {
+      Hacl_Blake2b_512_blake2b_2(64,out,SIZE,input,0,NULL);
+    }
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS / 2; j++) {
+      Hacl_Blake2b_512_blake2b_2(64,out,SIZE,input,0,NULL);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+  }
+  uint64_t cdiff5 = b - a;
+  double tdiff5 = t2 - t1;
+
   uint64_t count = ROUNDS * SIZE;
   printf("Blake2S (Vec 32-bit):\n"); print_time(count,tdiff1,cdiff1);
   printf("Blake2B (Vec 64-bit):\n"); print_time(count,tdiff2,cdiff2);
@@ -141,6 +227,9 @@ int main()
   if (EverCrypt_AutoConfig2_has_avx2()) {
     printf("Blake2B (Vec 256-bit):\n"); print_time(count,tdiff4,cdiff4);
   }
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    printf("Blake2B (Vec 512-bit, 2 messages):\n"); print_time(count,tdiff5,cdiff5);
+  }
 
   if (ok) return EXIT_SUCCESS;
   else return EXIT_FAILURE;
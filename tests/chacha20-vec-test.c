@@ -12,6 +12,7 @@
 #include "Hacl_Chacha20_Vec32.h"
 #include "Hacl_Chacha20_Vec128.h"
 #include "Hacl_Chacha20_Vec256.h"
+#include "Hacl_Chacha20_Vec512.h"
 #include "EverCrypt_AutoConfig2.h"
 
 #include "test_helpers.h"
@@ -42,6 +43,34 @@ bool print_test(int in_len, uint8_t* in, uint8_t* key, uint8_t* nonce, uint8_t*
     printf("Chacha20 (256-bit) Result:\n");
     ok = ok && print_result(in_len,comp,exp);
   }
+
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    Hacl_Chacha20_Vec512_chacha20_encrypt_512(in_len,comp,in,key,nonce,1);
+    printf("Chacha20 (512-bit) Result:\n");
+    ok = ok && print_result(in_len,comp,exp);
+  }
+  return ok;
+}
+
+// Sixteen lanes: check every length around the 1024-byte block against the
+// 32-bit code, with a counter that is not 1.
+bool test_lengths_512() {
+  uint8_t text[2100];
+  uint8_t exp[2100];
+  uint8_t comp[2100];
+  uint8_t key[32];
+  uint8_t nonce[12];
+  for (int i = 0; i < sizeof(text); i++)
+    text[i] = (uint8_t)(i * 13 + 1);
+  memset(key,'k',32);
+  memset(nonce,'n',12);
+  bool ok = true;
+  for (uint32_t len = 0; len <= sizeof(text); len++) {
+    Hacl_Chacha20_Vec32_chacha20_encrypt_32(len,exp,text,key,nonce,7);
+    Hacl_Chacha20_Vec512_chacha20_encrypt_512(len,comp,text,key,nonce,7);
+    ok = ok && memcmp(exp,comp,len) == 0;
+  }
+  printf("Chacha20 (512-bit) vs 32-bit, all lengths: %s\n", ok ? "Success!" : "**FAILED**");
   return ok;
 }
 
@@ -52,6 +81,8 @@ int main() {
   for (int i = 0; i < sizeof(vectors)/sizeof(chacha20_test_vector); ++i) {
     ok &= print_test(vectors[i].input_len,vectors[i].input,vectors[i].key,vectors[i].nonce,vectors[i].cipher);
   }
+  if (EverCrypt_AutoConfig2_has_avx512())
+    ok &= test_lengths_512();
 
   uint64_t len = SIZE;
   uint8_t plain[SIZE];
@@ -118,12 +149,36 @@ int main() {
   double diff3 = t2 - t1;
   uint64_t cyc3 = b - a;
 
+
+  memset(plain,'P',SIZE);
+  memset(key,'K',16);
+  memset(nonce,'N',12);
+
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20_Vec512_chacha20_encrypt_512(SIZE,plain,plain,key,nonce,1);
+    }
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20_Vec512_chacha20_encrypt_512(SIZE,plain,plain,key,nonce,1);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+  }
+  double diff4 = t2 - t1;
+  uint64_t cyc4 = b - a;
+
   uint64_t count = ROUNDS * SIZE;
   printf("32-bit Chacha20\n"); print_time(count,diff1,cyc1);
   printf("128-bit Chacha20\n"); print_time(count,diff2,cyc2);
   if (EverCrypt_AutoConfig2_has_avx2()) {
     printf("256-bit Chacha20\n"); print_time(count,diff3,cyc3);
   }
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    printf("512-bit Chacha20\n"); print_time(count,diff4,cyc4);
+  }
 
   if (ok) return EXIT_SUCCESS;
   else return EXIT_FAILURE;
@@ -12,6 +12,8 @@
 #include "Hacl_Chacha20Poly1305_32.h"
 #include "Hacl_Chacha20Poly1305_128.h"
 #include "Hacl_Chacha20Poly1305_256.h"
+#include "Hacl_Chacha20Poly1305_512.h"
+#include "EverCrypt_Chacha20Poly1305.h"
 #include "EverCrypt_AutoConfig2.h"
 
 #include "test_helpers.h"
@@ -66,11 +68,133 @@ bool print_test(int in_len, uint8_t* in, uint8_t* key, uint8_t* nonce, int aad_l
     if (res != 0) printf("AEAD Decrypt (Chacha20/Poly1305) failed \n.");
     ok = ok && (res == 0);
     ok = ok && print_result(in_len,plaintext,in);
+
+    Hacl_Chacha20Poly1305_256_aead_encrypt_stitched(key, nonce, aad_len, aad, in_len, in, ciphertext, mac);
+    printf("Chacha20Poly1305 (256-bit, stitched) Result (chacha20):\n");
+    ok = ok && print_result(in_len,ciphertext,exp_cipher);
+    printf("(poly1305):\n");
+    ok = ok && print_result(16,mac,exp_mac);
+
+    res = Hacl_Chacha20Poly1305_256_aead_decrypt_stitched(key, nonce, aad_len, aad, in_len, plaintext, exp_cipher, exp_mac);
+    if (res != 0) printf("AEAD Decrypt (Chacha20/Poly1305) failed \n.");
+    ok = ok && (res == 0);
+    ok = ok && print_result(in_len,plaintext,in);
+  }
+
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    Hacl_Chacha20Poly1305_512_aead_encrypt(key, nonce, aad_len, aad, in_len, in, ciphertext, mac);
+    printf("Chacha20Poly1305 (512-bit) Result (chacha20):\n");
+    ok = ok && print_result(in_len,ciphertext,exp_cipher);
+    printf("(poly1305):\n");
+    ok = ok && print_result(16,mac,exp_mac);
+
+    res = Hacl_Chacha20Poly1305_512_aead_decrypt(key, nonce, aad_len, aad, in_len, plaintext, exp_cipher, exp_mac);
+    if (res != 0) printf("AEAD Decrypt (Chacha20/Poly1305) failed \n.");
+    ok = ok && (res == 0);
+    ok = ok && print_result(in_len,plaintext,in);
   }
 
   return ok;
 }
 
+// The stitched engine switches between 512-byte chunks and the generic tail,
+// so compare it with the two-pass implementation around chunk boundaries,
+// in place, and with a corrupted tag.
+bool test_stitched(uint32_t len){
+  uint8_t key[32], nonce[12], aad[13];
+  uint8_t *in = malloc(len + 1);
+  uint8_t *exp = malloc(len + 1);
+  uint8_t *comp = malloc(len + 1);
+  uint8_t exp_mac[16], mac[16];
+  for (uint32_t i = 0; i < 32; i++) key[i] = (uint8_t)(i * 7 + 1);
+  for (uint32_t i = 0; i < 12; i++) nonce[i] = (uint8_t)(i + 3);
+  for (uint32_t i = 0; i < 13; i++) aad[i] = (uint8_t)(i * 5);
+  for (uint32_t i = 0; i < len; i++) in[i] = (uint8_t)(i * 13 + 11);
+
+  Hacl_Chacha20Poly1305_32_aead_encrypt(key, nonce, 13, aad, len, in, exp, exp_mac);
+  Hacl_Chacha20Poly1305_256_aead_encrypt_stitched(key, nonce, 13, aad, len, in, comp, mac);
+  bool ok = memcmp(exp, comp, len) == 0 && memcmp(exp_mac, mac, 16) == 0;
+
+  uint32_t res = Hacl_Chacha20Poly1305_256_aead_decrypt_stitched(key, nonce, 13, aad, len, comp, comp, mac);
+  ok = ok && res == 0 && memcmp(in, comp, len) == 0;
+
+  memcpy(comp, in, len);
+  Hacl_Chacha20Poly1305_256_aead_encrypt_stitched(key, nonce, 13, aad, len, comp, comp, mac);
+  ok = ok && memcmp(exp, comp, len) == 0 && memcmp(exp_mac, mac, 16) == 0;
+
+  mac[len % 16] ^= 1;
+  res = Hacl_Chacha20Poly1305_256_aead_decrypt_stitched(key, nonce, 13, aad, len, comp, exp, mac);
+  ok = ok && res == 1;
+  for (uint32_t i = 0; i < len; i++)
+    ok = ok && comp[i] == 0;
+
+  if (!ok) printf("Chacha20Poly1305 (256-bit, stitched) %u bytes: **FAILED**\n", len);
+  free(comp);
+  free(exp);
+  free(in);
+  return ok;
+}
+
+// Same lengths for the 512-bit code, and for the EverCrypt entry points, which
+// pick the widest implementation available.
+bool test_512(uint32_t len){
+  uint8_t key[32], nonce[12], aad[37];
+  uint8_t *in = malloc(len + 1);
+  uint8_t *exp = malloc(len + 1);
+  uint8_t *comp = malloc(len + 1);
+  uint8_t exp_mac[16], mac[16];
+  for (uint32_t i = 0; i < 32; i++) key[i] = (uint8_t)(i * 3 + 5);
+  for (uint32_t i = 0; i < 12; i++) nonce[i] = (uint8_t)(i * 9);
+  for (uint32_t i = 0; i < 37; i++) aad[i] = (uint8_t)(i + 100);
+  for (uint32_t i = 0; i < len; i++) in[i] = (uint8_t)(i * 17 + 2);
+
+  Hacl_Chacha20Poly1305_32_aead_encrypt(key, nonce, len % 38, aad, len, in, exp, exp_mac);
+  Hacl_Chacha20Poly1305_512_aead_encrypt(key, nonce, len % 38, aad, len, in, comp, mac);
+  bool ok = memcmp(exp, comp, len) == 0 && memcmp(exp_mac, mac, 16) == 0;
+  uint32_t res = Hacl_Chacha20Poly1305_512_aead_decrypt(key, nonce, len % 38, aad, len, comp, exp, mac);
+  ok = ok && res == 0 && memcmp(in, comp, len) == 0;
+
+  EverCrypt_Chacha20Poly1305_aead_encrypt(key, nonce, len % 38, aad, len, in, comp, mac);
+  ok = ok && memcmp(exp, comp, len) == 0 && memcmp(exp_mac, mac, 16) == 0;
+
+  mac[0] ^= 0x80;
+  res = Hacl_Chacha20Poly1305_512_aead_decrypt(key, nonce, len % 38, aad, len, comp, exp, mac);
+  ok = ok && res == 1;
+
+  if (!ok) printf("Chacha20Poly1305 (512-bit) %u bytes: **FAILED**\n", len);
+  free(comp);
+  free(exp);
+  free(in);
+  return ok;
+}
+
+// EverCrypt decryption with a bad tag, on every backend the machine has: the
+// result is 1 and m is zeroed.
+bool test_failure(uint32_t len){
+  uint8_t key[32] = { 7 }, nonce[12] = { 1 }, aad[13] = { 2 }, mac[16];
+  uint8_t *in = malloc(len + 1), *cipher = malloc(len + 1), *m = malloc(len + 1);
+  for (uint32_t i = 0; i < len; i++) in[i] = (uint8_t)(i * 5 + 1);
+  bool ok = true;
+  for (int level = 0; level < 4; level++) {
+    if (level == 1) EverCrypt_AutoConfig2_disable_avx512();
+    if (level == 2) EverCrypt_AutoConfig2_disable_avx2();
+    if (level == 3) EverCrypt_AutoConfig2_disable_avx();
+    EverCrypt_Chacha20Poly1305_aead_encrypt(key, nonce, 13, aad, len, in, cipher, mac);
+    mac[15] ^= 1;
+    memset(m, 0xAA, len);
+    ok = ok && EverCrypt_Chacha20Poly1305_aead_decrypt(key, nonce, 13, aad, len, m, cipher, mac) == 1;
+    for (uint32_t i = 0; i < len; i++) ok = ok && m[i] == 0;
+    mac[15] ^= 1;
+    ok = ok && EverCrypt_Chacha20Poly1305_aead_decrypt(key, nonce, 13, aad, len, m, cipher, mac) == 0;
+    ok = ok && memcmp(m, in, len) == 0;
+  }
+  EverCrypt_AutoConfig2_init();
+  free(in);
+  free(cipher);
+  free(m);
+  return ok;
+}
+
 int main(){
   EverCrypt_AutoConfig2_init();
 
@@ -79,6 +203,29 @@ int main(){
     ok &= print_test(vectors[i].input_len,vectors[i].input,vectors[i].key,vectors[i].nonce,vectors[i].aad_len,vectors[i].aad,vectors[i].tag,vectors[i].cipher);
   }
 
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    bool ok_stitched = true;
+    uint32_t lens[] = { 0, 1, 63, 64, 65, 511, 512, 513, 1023, 1024, 1025, 1535, 1536, 1537,
+                        2047, 2048, 2049, 3000, 16383, 16384, 16385, 16397 };
+    for (int i = 0; i < sizeof(lens)/sizeof(lens[0]); ++i)
+      ok_stitched = test_stitched(lens[i]) && ok_stitched;
+    printf("Chacha20Poly1305 (256-bit, stitched) vs two-pass: %s\n", ok_stitched ? "Success!" : "**FAILED**");
+    ok = ok && ok_stitched;
+  }
+
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    bool ok_512 = true;
+    for (uint32_t len = 0; len <= 2200; len++)
+      ok_512 = test_512(len) && ok_512;
+    ok_512 = test_512(16397) && ok_512;
+    printf("Chacha20Poly1305 (512-bit) vs 32-bit: %s\n", ok_512 ? "Success!" : "**FAILED**");
+    ok = ok && ok_512;
+  }
+
+  bool ok_failure = test_failure(0) && test_failure(100) && test_failure(5000);
+  printf("Chacha20Poly1305 decryption failure zeroes m: %s\n", ok_failure ? "Success!" : "**FAILED**");
+  ok = ok && ok_failure;
+
   uint8_t plain[SIZE];
   uint8_t cipher[SIZE];
   uint8_t aead_key[32];
@@ -147,6 +294,42 @@ int main(){
   cycles cdiff3 = b - a;
 
 
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20Poly1305_256_aead_encrypt_stitched(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+    }
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20Poly1305_256_aead_encrypt_stitched(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+      res ^= tag[0] ^ tag[15];
+    }
+    b = cpucycles_end();
+    t2 = clock();
+  }
+  clock_t tdiff7 = t2 - t1;
+  cycles cdiff7 = b - a;
+
+
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20Poly1305_512_aead_encrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+    }
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20Poly1305_512_aead_encrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+      res ^= tag[0] ^ tag[15];
+    }
+    b = cpucycles_end();
+    t2 = clock();
+  }
+  clock_t tdiff9 = t2 - t1;
+  cycles cdiff9 = b - a;
+
+
   int res1 = 0;
   for (int j = 0; j < ROUNDS; j++) {
     res1 = Hacl_Chacha20Poly1305_32_aead_decrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
@@ -205,6 +388,40 @@ int main(){
   clock_t tdiff6 = t2 - t1;
   cycles cdiff6 = b - a;
 
+
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20Poly1305_256_aead_decrypt_stitched(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+    }
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      res1 ^= Hacl_Chacha20Poly1305_256_aead_decrypt_stitched(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+  }
+  clock_t tdiff8 = t2 - t1;
+  cycles cdiff8 = b - a;
+
+
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_Chacha20Poly1305_512_aead_decrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+    }
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      res1 ^= Hacl_Chacha20Poly1305_512_aead_decrypt(aead_key, aead_nonce, aad_len, aead_aad, SIZE, plain, cipher, tag);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+  }
+  clock_t tdiff10 = t2 - t1;
+  cycles cdiff10 = b - a;
+
   // JP: I don't understand what this does since this variable is almost always
   // zeroed-out.
   printf ("\n res1: %i \n", res1);
@@ -215,11 +432,19 @@ int main(){
   printf("Chacha20Poly1305 Encrypt (128-bit) PERF:\n"); print_time(count,tdiff2,cdiff2);
   if (EverCrypt_AutoConfig2_has_avx2()) {
     printf("Chacha20Poly1305 Encrypt (256-bit) PERF:\n"); print_time(count,tdiff3,cdiff3);
+    printf("Chacha20Poly1305 Encrypt (256-bit, stitched) PERF:\n"); print_time(count,tdiff7,cdiff7);
+  }
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    printf("Chacha20Poly1305 Encrypt (512-bit) PERF:\n"); print_time(count,tdiff9,cdiff9);
   }
   printf("Chacha20Poly1305 Decrypt (32-bit) PERF:\n");  print_time(count,tdiff4,cdiff4);
   printf("Chacha20Poly1305 Decrypt (128-bit) PERF:\n"); print_time(count,tdiff5,cdiff5);
   if (EverCrypt_AutoConfig2_has_avx2()) {
     printf("Chacha20Poly1305 Decrypt (256-bit) PERF:\n"); print_time(count,tdiff6,cdiff6);
+    printf("Chacha20Poly1305 Decrypt (256-bit, stitched) PERF:\n"); print_time(count,tdiff8,cdiff8);
+  }
+  if (EverCrypt_AutoConfig2_has_avx512()) {
+    printf("Chacha20Poly1305 Decrypt (512-bit) PERF:\n"); print_time(count,tdiff10,cdiff10);
   }
 
   if (ok) return EXIT_SUCCESS;
@@ -0,0 +1,176 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdbool.h>
+#include <openssl/evp.h>
+
+#include "EverCrypt_CTR.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS  2048
+#define SECTOR  4096
+#define MAX_LEN 5000
+
+static uint64_t seed = 0x8f1bbcdcca62c1d6ULL;
+
+static void fill(uint8_t *b, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    b[i] = (uint8_t)(seed >> 56);
+  }
+}
+
+// OpenSSL's AES-CTR increments the whole 128-bit block, and its ChaCha20 takes
+// the 32-bit little-endian block counter followed by the nonce as IV.
+static void openssl_ctr(Spec_Agile_Cipher_cipher_alg a, uint8_t *key, uint8_t *iv,
+                        uint32_t len, uint8_t *plain, uint8_t *cipher)
+{
+  const EVP_CIPHER *c = a == Spec_Agile_Cipher_AES128 ? EVP_aes_128_ctr()
+                      : a == Spec_Agile_Cipher_AES256 ? EVP_aes_256_ctr()
+                      : EVP_chacha20();
+  EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+  int out_len;
+  EVP_EncryptInit_ex(ctx, c, NULL, key, iv);
+  EVP_EncryptUpdate(ctx, cipher, &out_len, plain, len);
+  EVP_EncryptFinal_ex(ctx, cipher + out_len, &out_len);
+  EVP_CIPHER_CTX_free(ctx);
+}
+
+// Encrypts in one call, in block-multiple chunks, and in place, starting from a
+// counter that makes the AES runs wrap the low 32 bits of the counter block.
+bool test_alg(Spec_Agile_Cipher_cipher_alg a, const char *name) {
+  uint32_t block = a == Spec_Agile_Cipher_CHACHA20 ? 64 : 16;
+  uint32_t key_len = a == Spec_Agile_Cipher_AES128 ? 16 : 32;
+  uint8_t key[32], iv[16], ossl_iv[16];
+  uint8_t *plain = malloc(MAX_LEN), *cipher = malloc(MAX_LEN), *expected = malloc(MAX_LEN);
+  uint32_t lens[] = { 0, 1, 15, 16, 17, 63, 64, 65, 255, 256, 511, 512, 1023, 1024, 1500, 4096, MAX_LEN };
+  bool ok = true;
+
+  for (int t = 0; t < sizeof(lens)/sizeof(lens[0]); t++) {
+    uint32_t len = lens[t];
+    uint32_t c = 3;
+    EverCrypt_CTR_state_s *s = NULL;
+    fill(key, key_len);
+    fill(plain, len);
+    if (a == Spec_Agile_Cipher_CHACHA20) {
+      fill(iv, 12);
+      ossl_iv[0] = (uint8_t)c; ossl_iv[1] = 0; ossl_iv[2] = 0; ossl_iv[3] = 0;
+      memcpy(ossl_iv + 4, iv, 12);
+    } else {
+      fill(iv, 16);
+      memset(iv + 12, 0xff, 4);
+      iv[15] = 0xf0;
+      memcpy(ossl_iv, iv, 16);
+      // Add the initial counter to the last byte; it carries into the nonce
+      // part only after the wrap, which the lengths above exercise.
+      ossl_iv[15] += (uint8_t)c;
+    }
+    openssl_ctr(a, key, ossl_iv, len, plain, expected);
+
+    if (EverCrypt_CTR_create_in(a, &s, key, iv, a == Spec_Agile_Cipher_CHACHA20 ? 12 : 16, c) != EverCrypt_Error_Success) {
+      printf("%s: create_in failed\n", name);
+      return false;
+    }
+    EverCrypt_CTR_update_blocks(s, cipher, plain, len);
+    ok = ok && memcmp(cipher, expected, len) == 0;
+
+    EverCrypt_CTR_init(s, key, iv, a == Spec_Agile_Cipher_CHACHA20 ? 12 : 16, c);
+    memset(cipher, 0, len);
+    uint32_t chunk = 3 * block, off = 0;
+    while (len - off > chunk) {
+      EverCrypt_CTR_update_blocks(s, cipher + off, plain + off, chunk);
+      off += chunk;
+    }
+    EverCrypt_CTR_update_blocks(s, cipher + off, plain + off, len - off);
+    ok = ok && memcmp(cipher, expected, len) == 0;
+
+    EverCrypt_CTR_init(s, key, iv, a == Spec_Agile_Cipher_CHACHA20 ? 12 : 16, c);
+    memcpy(cipher, plain, len);
+    EverCrypt_CTR_update_blocks(s, cipher, cipher, len);
+    ok = ok && memcmp(cipher, expected, len) == 0;
+
+    // The single-block function agrees on full blocks.
+    if (a != Spec_Agile_Cipher_CHACHA20) {
+      EverCrypt_CTR_init(s, key, iv, 16, c);
+      for (uint32_t j = 0; j + 16 <= len; j += 16) {
+        EverCrypt_CTR_update_block(s, cipher + j, plain + j);
+      }
+      ok = ok && memcmp(cipher, expected, len / 16 * 16) == 0;
+    }
+    EverCrypt_CTR_free(s);
+
+    // Same stream from caller-provided storage.
+    _Alignas(EverCrypt_CTR_state_align) uint8_t mem[EverCrypt_CTR_state_len];
+    uint32_t iv_len = a == Spec_Agile_Cipher_CHACHA20 ? 12 : 16;
+    ok = ok && EverCrypt_CTR_init_in_place(a, &s, mem, key, iv, iv_len, c) == EverCrypt_Error_Success;
+    memset(cipher, 0, len);
+    EverCrypt_CTR_update_blocks(s, cipher, plain, len);
+    ok = ok && memcmp(cipher, expected, len) == 0;
+    ok = ok && EverCrypt_CTR_init_in_place(a, &s, mem, key, iv, 17, c) == EverCrypt_Error_InvalidIVLength;
+  }
+  printf("EverCrypt_CTR_update_blocks (%s): %s\n", name, ok ? "Success!" : "**FAILED**");
+  free(plain);
+  free(cipher);
+  free(expected);
+  return ok;
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  bool aes = EverCrypt_AutoConfig2_has_aesni() && EverCrypt_AutoConfig2_has_pclmulqdq() &&
+             EverCrypt_AutoConfig2_has_avx() && EverCrypt_AutoConfig2_has_sse();
+  if (aes) {
+    ok = test_alg(Spec_Agile_Cipher_AES128, "AES-128") && ok;
+    ok = test_alg(Spec_Agile_Cipher_AES256, "AES-256") && ok;
+  }
+  ok = test_alg(Spec_Agile_Cipher_CHACHA20, "ChaCha20") && ok;
+
+  if (aes) {
+    uint8_t key[16], iv[16];
+    uint8_t *sector = malloc(SECTOR);
+    EverCrypt_CTR_state_s *s = NULL;
+    fill(key, 16);
+    fill(iv, 12);
+    memset(sector, 'P', SECTOR);
+    EverCrypt_CTR_create_in(Spec_Agile_Cipher_AES128, &s, key, iv, 12, 0);
+    cycles a, b;
+    clock_t t1, t2;
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++)
+      for (int i = 0; i < SECTOR; i += 16)
+        EverCrypt_CTR_update_block(s, sector + i, sector + i);
+    b = cpucycles_end();
+    t2 = clock();
+    double cdiff1 = b - a;
+    double tdiff1 = t2 - t1;
+
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++)
+      EverCrypt_CTR_update_blocks(s, sector, sector, SECTOR);
+    b = cpucycles_end();
+    t2 = clock();
+    double cdiff2 = b - a;
+    double tdiff2 = t2 - t1;
+
+    uint64_t count = ROUNDS * SECTOR;
+    printf("AES-128-CTR (one block per call) PERF: %d\n", (int)sector[0]); print_time(count, tdiff1, cdiff1);
+    printf("AES-128-CTR (4 KiB per call) PERF: %d\n", (int)sector[0]); print_time(count, tdiff2, cdiff2);
+    EverCrypt_CTR_free(s);
+    free(sector);
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,216 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "Hacl_Ed25519.h"
+#include "EverCrypt_Ed25519.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define N      53
+#define MSGLEN 200
+#define ROUNDS 20
+
+static uint8_t priv[N][32];
+static uint8_t pub[N][32];
+static uint8_t sigs[N][64];
+static uint8_t msgs[N][MSGLEN];
+static uint32_t lens[N];
+
+static uint8_t *pub_p[N];
+static uint8_t *sig_p[N];
+static uint8_t *msg_p[N];
+
+static void setup(){
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < 32; j++)
+      priv[i][j] = (uint8_t)(i * 37 + j * 11 + 1);
+    for (int j = 0; j < MSGLEN; j++)
+      msgs[i][j] = (uint8_t)(i + j * 7);
+    lens[i] = (uint32_t)(i * 13 % MSGLEN);
+    Hacl_Ed25519_secret_to_public(pub[i], priv[i]);
+    Hacl_Ed25519_sign(sigs[i], priv[i], lens[i], msgs[i]);
+    pub_p[i] = pub[i];
+    sig_p[i] = sigs[i];
+    msg_p[i] = msgs[i];
+  }
+}
+
+// Runs the batch over the first n entries and checks every verdict against
+// the one-at-a-time API.
+static bool check(const char *name, uint32_t n){
+  bool valid[N];
+  bool all = EverCrypt_Ed25519_verify_batch(n, pub_p, lens, msg_p, sig_p, valid);
+  bool exp_all = true;
+  bool ok = true;
+  for (uint32_t i = 0; i < n; i++) {
+    bool exp = Hacl_Ed25519_verify(pub_p[i], lens[i], msg_p[i], sig_p[i]);
+    exp_all = exp_all && exp;
+    ok = ok && exp == valid[i];
+  }
+  ok = ok && all == exp_all;
+  printf("Ed25519 batch (%s, %u signatures): %s\n", name, n, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Small-order points: the identity and a point of order 8.
+static uint8_t identity[32] = { 1 };
+static uint8_t order8[32] = {
+  0x26, 0xe8, 0x95, 0x8f, 0xc2, 0xb2, 0x27, 0xb0, 0x45, 0xc3, 0xf4, 0x89, 0xf2, 0xef, 0x98, 0xf0,
+  0xd5, 0xdf, 0xac, 0x05, 0xd3, 0xc6, 0x33, 0x39, 0xb1, 0x38, 0x02, 0x88, 0x6d, 0x53, 0xfc, 0x05
+};
+
+// Pins down the documented divergence on small-order inputs: the batch
+// (cofactored) accepts every signature below, inside a group of honest ones;
+// Hacl_Ed25519_verify (cofactorless) only accepts those whose residual
+// [S]B - R - [k]A is the identity.
+static bool check_small_order(){
+  uint8_t sig[4][64] = {{ 0 }};
+  uint8_t *pk[N], *sp[N], *mp[N];
+  uint8_t ks[96] = { 0 };
+  uint8_t msg[4][1] = {{ 0 }};
+  uint32_t len[N];
+  bool single[4], valid[N];
+  bool ok = true;
+
+  // A = R = identity, S = 0: the residual is the identity for any message.
+  memcpy(sig[0], identity, 32);
+  // A = identity, R of order 8, S = 0: the residual is -R.
+  memcpy(sig[1], order8, 32);
+  // A of order 8 and S = r for R = [r]B (a zero secret scalar): the residual
+  // is -[k]A, which is the identity iff 8 divides k. Pick one message of each kind.
+  memcpy(ks, order8, 32);
+  memset(ks + 64, 0x42, 32);
+  bool found[2] = { false, false };
+  for (int m = 0; m < 256 && !(found[0] && found[1]); m++) {
+    uint8_t t[64], b = (uint8_t)m;
+    Hacl_Ed25519_sign_expanded(t, ks, 1, &b);
+    int kind = Hacl_Ed25519_verify(order8, 1, &b, t) ? 0 : 1;
+    if (!found[kind]) {
+      memcpy(sig[2 + kind], t, 64);
+      msg[2 + kind][0] = b;
+      found[kind] = true;
+    }
+  }
+  ok = ok && found[0] && found[1];
+
+  for (int i = 0; i < N; i++) {
+    pk[i] = pub[i];
+    sp[i] = sigs[i];
+    mp[i] = msgs[i];
+    len[i] = lens[i];
+  }
+  for (int j = 0; j < 4; j++) {
+    int i = 5 + 11 * j;
+    pk[i] = j < 2 ? identity : order8;
+    sp[i] = sig[j];
+    mp[i] = msg[j];
+    len[i] = 1;
+    single[j] = Hacl_Ed25519_verify(pk[i], len[i], mp[i], sp[i]);
+  }
+  ok = ok && single[0] && !single[1] && single[2] && !single[3];
+  bool all = EverCrypt_Ed25519_verify_batch(N, pk, len, mp, sp, valid);
+  ok = ok && all;
+  for (int i = 0; i < N; i++)
+    ok = ok && valid[i];
+
+  // Alone in its group, and next to an invalid signature, which sends the
+  // group to the one-by-one fallback: the verdicts must not change.
+  for (int j = 0; j < 4; j++) {
+    int i = 5 + 11 * j;
+    ok = ok && EverCrypt_Ed25519_verify_batch(1, pk + i, len + i, mp + i, sp + i, valid);
+  }
+  sigs[6][40] ^= 1;
+  all = EverCrypt_Ed25519_verify_batch(16, pk + 6, len + 6, mp + 6, sp + 6, valid);
+  ok = ok && !all && !valid[0] && valid[16 - 6];
+  sigs[6][40] ^= 1;
+
+  printf("Ed25519 batch (small-order points): %s\n", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+int main(){
+  EverCrypt_AutoConfig2_init();
+  setup();
+  bool ok = true;
+
+  ok &= check("valid", 0);
+  ok &= check("valid", 1);
+  ok &= check("valid", 16);
+  ok &= check("valid", N);
+
+  // A bad S
+  sigs[3][40] ^= 1;
+  ok &= check("bad S", N);
+  sigs[3][40] ^= 1;
+
+  // S >= q
+  uint8_t s_save[32];
+  memcpy(s_save, sigs[20] + 32, 32);
+  memset(sigs[20] + 32, 0xff, 31);
+  sigs[20][63] = 0x1f;
+  ok &= check("S out of range", N);
+  memcpy(sigs[20] + 32, s_save, 32);
+
+  // A modified message and a signature under the wrong key, in separate groups
+  msgs[17][0] ^= 0x80;
+  if (lens[17] == 0) lens[17] = 1;
+  pub_p[40] = pub[41];
+  ok &= check("bad message, wrong key", N);
+  pub_p[40] = pub[40];
+  msgs[17][0] ^= 0x80;
+  Hacl_Ed25519_sign(sigs[17], priv[17], lens[17], msgs[17]);
+
+  // R that does not decode to a point
+  uint8_t r_save[32];
+  memcpy(r_save, sigs[33], 32);
+  memset(sigs[33], 0xff, 31);
+  sigs[33][31] = 0x7f;
+  sigs[33][0] = 0xfe;
+  ok &= check("bad R", N);
+  memcpy(sigs[33], r_save, 32);
+
+  // Swapped signatures: each is well formed but verifies under the other key
+  sig_p[5] = sigs[6];
+  sig_p[6] = sigs[5];
+  ok &= check("swapped", N);
+  sig_p[5] = sigs[5];
+  sig_p[6] = sigs[6];
+
+  ok &= check("valid again", N);
+  ok &= check_small_order();
+
+  bool valid[N];
+  cycles a,b;
+  clock_t t1,t2;
+  bool r = true;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    for (int i = 0; i < N; i++)
+      r = Hacl_Ed25519_verify(pub[i], lens[i], msgs[i], sigs[i]) && r;
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    r = Hacl_Ed25519_verify_batch(N, pub_p, lens, msg_p, sig_p, valid) && r;
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  uint64_t count = ROUNDS * N;
+  printf("Ed25519 verify (one at a time) PERF: %d\n", (int)r); print_time(count,tdiff1,cdiff1);
+  printf("Ed25519 verify (batch) PERF: %d\n", (int)r); print_time(count,tdiff2,cdiff2);
+
+  if (ok && r) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,121 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include <openssl/evp.h>
+
+#include "Hacl_Ed25519.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define KEYS   64
+#define MSGLEN 300
+#define ROUNDS 2000
+
+// Public key and signature as computed by OpenSSL, for comparison.
+static bool openssl_sign(uint8_t *pub, uint8_t *sig, uint8_t *priv, uint32_t len, uint8_t *msg){
+  EVP_PKEY *k = EVP_PKEY_new_raw_private_key(EVP_PKEY_ED25519, NULL, priv, 32);
+  if (k == NULL) return false;
+  size_t pub_len = 32;
+  size_t sig_len = 64;
+  EVP_MD_CTX *ctx = EVP_MD_CTX_new();
+  bool ok = EVP_PKEY_get_raw_public_key(k, pub, &pub_len) == 1
+    && EVP_DigestSignInit(ctx, NULL, NULL, NULL, k) == 1
+    && EVP_DigestSign(ctx, sig, &sig_len, msg, len) == 1;
+  EVP_MD_CTX_free(ctx);
+  EVP_PKEY_free(k);
+  return ok;
+}
+
+static bool test_key(uint8_t *priv, uint32_t len, uint8_t *msg){
+  uint8_t pub[32], exp_pub[32];
+  uint8_t sig[64], exp_sig[64];
+  uint8_t ks[96];
+  if (!openssl_sign(exp_pub, exp_sig, priv, len, msg)) return false;
+
+  Hacl_Ed25519_secret_to_public(pub, priv);
+  bool ok = memcmp(pub, exp_pub, 32) == 0;
+  Hacl_Ed25519_sign(sig, priv, len, msg);
+  ok = ok && memcmp(sig, exp_sig, 64) == 0;
+  Hacl_Ed25519_expand_keys(ks, priv);
+  memset(sig, 0, 64);
+  Hacl_Ed25519_sign_expanded(sig, ks, len, msg);
+  ok = ok && memcmp(sig, exp_sig, 64) == 0;
+  ok = ok && Hacl_Ed25519_verify(pub, len, msg, sig);
+  sig[63] ^= 0x01;
+  ok = ok && !Hacl_Ed25519_verify(pub, len, msg, sig);
+  sig[63] ^= 0x01;
+  sig[0] ^= 0x01;
+  ok = ok && !Hacl_Ed25519_verify(pub, len, msg, sig);
+  return ok;
+}
+
+int main(){
+  EverCrypt_AutoConfig2_init();
+  uint8_t priv[32];
+  uint8_t msg[MSGLEN];
+  bool ok = true;
+  for (int i = 0; i < MSGLEN; i++)
+    msg[i] = (uint8_t)(i * 3 + 1);
+
+  memset(priv, 0, 32);
+  ok &= test_key(priv, 0, msg);
+  memset(priv, 0xff, 32);
+  ok &= test_key(priv, 1, msg);
+  for (int k = 0; k < KEYS; k++) {
+    for (int j = 0; j < 32; j++)
+      priv[j] = (uint8_t)(k * 89 + j * 47 + (k >> 2) * j);
+    ok &= test_key(priv, (uint32_t)(k * 17 % MSGLEN), msg);
+  }
+  printf("Ed25519 keygen/sign/verify against OpenSSL: %s\n", ok ? "Success!" : "**FAILED**");
+
+  uint8_t pub[32];
+  uint8_t sig[64];
+  cycles a,b;
+  clock_t t1,t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Ed25519_secret_to_public(pub, priv);
+    priv[0] ^= pub[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_Ed25519_sign(sig, priv, 64, msg);
+    msg[0] ^= sig[0];
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  Hacl_Ed25519_secret_to_public(pub, priv);
+  Hacl_Ed25519_sign(sig, priv, 64, msg);
+  bool r = true;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    r = Hacl_Ed25519_verify(pub, 64, msg, sig) && r;
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff3 = b - a;
+  double tdiff3 = t2 - t1;
+
+  printf("Ed25519 secret_to_public PERF:\n"); print_time(ROUNDS,tdiff1,cdiff1);
+  printf("Ed25519 sign PERF:\n"); print_time(ROUNDS,tdiff2,cdiff2);
+  printf("Ed25519 verify PERF: %d\n", (int)r); print_time(ROUNDS,tdiff3,cdiff3);
+
+  if (ok && r) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -0,0 +1,337 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stdbool.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+#include "EverCrypt_HMAC.h"
+#include "EverCrypt_HKDF.h"
+#include "EverCrypt_DRBG.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "Hacl_HMAC_DRBG.h"
+
+#include "test_helpers.h"
+
+#define ROUNDS 100000
+#define MAX_LEN 1024
+
+static uint64_t seed = 0x6a09e667f3bcc908ULL;
+
+static void fill(uint8_t *b, uint32_t len) {
+  for (uint32_t i = 0; i < len; i++) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    b[i] = (uint8_t)(seed >> 56);
+  }
+}
+
+typedef struct {
+  Spec_Hash_Definitions_hash_alg alg;
+  const char *name;
+  const EVP_MD *(*md)(void);
+} alg_t;
+
+static const alg_t algs[] = {
+  { Spec_Hash_Definitions_SHA1, "SHA1", EVP_sha1 },
+  { Spec_Hash_Definitions_SHA2_256, "SHA2_256", EVP_sha256 },
+  { Spec_Hash_Definitions_SHA2_384, "SHA2_384", EVP_sha384 },
+  { Spec_Hash_Definitions_SHA2_512, "SHA2_512", EVP_sha512 },
+  { Spec_Hash_Definitions_Blake2S, "Blake2S", EVP_blake2s256 },
+  { Spec_Hash_Definitions_Blake2B, "Blake2B", EVP_blake2b512 },
+};
+
+// Key and data lengths around the 64 and 128-byte block sizes, including the
+// empty message, which Blake2 handles separately.
+bool test_key_state(const alg_t *a) {
+  uint32_t key_lens[] = { 0, 1, 20, 32, 63, 64, 65, 127, 128, 129, 200 };
+  uint32_t data_lens[] = { 0, 1, 55, 56, 63, 64, 65, 111, 112, 127, 128, 129, 300, MAX_LEN };
+  uint8_t key[200], data[MAX_LEN], tag[64], expected[64], ossl[64];
+  uint32_t hash_len = Hacl_Hash_Definitions_hash_len(a->alg);
+  bool ok = true;
+
+  for (int i = 0; i < sizeof(key_lens)/sizeof(key_lens[0]); i++) {
+    EverCrypt_HMAC_key_state st;
+    fill(key, key_lens[i]);
+    EverCrypt_HMAC_key_state_init(&st, a->alg, key, key_lens[i]);
+    for (int j = 0; j < sizeof(data_lens)/sizeof(data_lens[0]); j++) {
+      unsigned int ossl_len;
+      fill(data, data_lens[j]);
+      EverCrypt_HMAC_compute(a->alg, expected, key, key_lens[i], data, data_lens[j]);
+      HMAC(a->md(), key, key_lens[i], data, data_lens[j], ossl, &ossl_len);
+      EverCrypt_HMAC_key_state_compute(&st, tag, data, data_lens[j]);
+      if (memcmp(tag, expected, hash_len) != 0 || memcmp(tag, ossl, hash_len) != 0) {
+        printf("%s: key_len %" PRIu32 ", data_len %" PRIu32 " differs\n", a->name, key_lens[i], data_lens[j]);
+        ok = false;
+      }
+    }
+  }
+  printf("EverCrypt_HMAC_key_state (%s): %s\n", a->name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Feeds the message in uneven chunks, including empty ones, and takes an
+// intermediate tag halfway through.
+bool test_streaming(const alg_t *a) {
+  uint32_t key_lens[] = { 0, 32, 64, 129 };
+  uint32_t chunks[] = { 0, 1, 7, 64, 0, 63, 128, 200, 3, 500 };
+  uint8_t key[129], data[MAX_LEN], tag[64], expected[64];
+  uint32_t hash_len = Hacl_Hash_Definitions_hash_len(a->alg);
+  bool ok = true;
+  fill(key, 129);
+  EverCrypt_HMAC_state *st = EverCrypt_HMAC_create_in(a->alg, key, 0);
+  for (int i = 0; i < sizeof(key_lens)/sizeof(key_lens[0]); i++) {
+    uint32_t len = 0;
+    fill(key, key_lens[i]);
+    fill(data, MAX_LEN);
+    EverCrypt_HMAC_init(st, key, key_lens[i]);
+    EverCrypt_HMAC_finish(st, tag);
+    EverCrypt_HMAC_compute(a->alg, expected, key, key_lens[i], data, 0);
+    ok = ok && memcmp(tag, expected, hash_len) == 0;
+    for (int j = 0; j < sizeof(chunks)/sizeof(chunks[0]); j++) {
+      EverCrypt_HMAC_update(st, data + len, chunks[j]);
+      len += chunks[j];
+      if (j == 5) {
+        EverCrypt_HMAC_finish(st, tag);
+        EverCrypt_HMAC_compute(a->alg, expected, key, key_lens[i], data, len);
+        ok = ok && memcmp(tag, expected, hash_len) == 0;
+      }
+    }
+    EverCrypt_HMAC_finish(st, tag);
+    EverCrypt_HMAC_compute(a->alg, expected, key, key_lens[i], data, len);
+    ok = ok && memcmp(tag, expected, hash_len) == 0;
+  }
+  EverCrypt_HMAC_free(st);
+  printf("EverCrypt_HMAC_update (%s): %s\n", a->name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// HKDF-Expand spelled out with the one-shot HMAC.
+static void hkdf_expand_ref(const alg_t *a, uint8_t *okm, uint8_t *prk, uint32_t prk_len,
+                            uint8_t *info, uint32_t info_len, uint32_t len) {
+  uint32_t hash_len = Hacl_Hash_Definitions_hash_len(a->alg);
+  uint8_t *text = malloc(hash_len + info_len + 1);
+  uint8_t t[64];
+  uint32_t t_len = 0;
+  for (uint32_t i = 0; i * hash_len < len; i++) {
+    memcpy(text, t, t_len);
+    memcpy(text + t_len, info, info_len);
+    text[t_len + info_len] = (uint8_t)(i + 1);
+    EverCrypt_HMAC_compute(a->alg, t, prk, prk_len, text, t_len + info_len + 1);
+    t_len = hash_len;
+    uint32_t n = len - i * hash_len < hash_len ? len - i * hash_len : hash_len;
+    memcpy(okm + i * hash_len, t, n);
+  }
+  free(text);
+}
+
+bool test_hkdf(const alg_t *a) {
+  uint32_t lens[] = { 1, 20, 32, 42, 64, 100, 255 };
+  uint8_t prk[64], info[80], okm[255], expected[255];
+  uint32_t hash_len = Hacl_Hash_Definitions_hash_len(a->alg);
+  bool ok = true;
+  for (int i = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+    fill(prk, hash_len);
+    fill(info, 80);
+    hkdf_expand_ref(a, expected, prk, hash_len, info, i * 10, lens[i]);
+    EverCrypt_HKDF_expand(a->alg, okm, prk, hash_len, info, i * 10, lens[i]);
+    ok = ok && memcmp(okm, expected, lens[i]) == 0;
+  }
+  printf("EverCrypt_HKDF_expand (%s): %s\n", a->name, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// EverCrypt_DRBG draws fresh entropy on every call; this definition takes the
+// place of the system one so that the draws can be replayed.
+static uint8_t entropy[64];
+
+bool Lib_RandomBuffer_System_randombytes(uint8_t *buf, uint32_t len) {
+  fill(buf, len);
+  memcpy(entropy, buf, len);
+  return true;
+}
+
+// Batches of 1, 8 and 13 derivations against the single-derivation functions.
+// The last case has a salt longer than a SHA2-384/512 block and an IKM whose
+// padding spills into a second block with either block size.
+bool test_hkdf_many(const alg_t *a, const char *variant) {
+  uint32_t counts[] = { 1, 8, 13 };
+  uint32_t lens[] = { 16, 32, 42, 100, 64 };
+  uint32_t ikm_lens[] = { 40, 0, 56, 130, 240 };
+  uint32_t salt_lens[] = { 0, 16, 32, 80, 144 };
+  uint32_t hash_len = Hacl_Hash_Definitions_hash_len(a->alg);
+  uint8_t prk_buf[13][64], salt_buf[13][144], ikm_buf[13][240], info_buf[13][20];
+  uint8_t okm_buf[13][100], prk_out[13][64], expected[100];
+  uint8_t *prk[13], *salt[13], *ikm[13], *info[13], *okm[13], *prk_o[13];
+  bool ok = true;
+  for (int i = 0; i < 13; i++) {
+    prk[i] = prk_buf[i]; salt[i] = salt_buf[i]; ikm[i] = ikm_buf[i];
+    info[i] = info_buf[i]; okm[i] = okm_buf[i]; prk_o[i] = prk_out[i];
+  }
+  for (int c = 0; c < sizeof(counts)/sizeof(counts[0]); c++) {
+    uint32_t n = counts[c];
+    for (int t = 0; t < sizeof(lens)/sizeof(lens[0]); t++) {
+      uint32_t salt_len = salt_lens[t];
+      for (uint32_t i = 0; i < n; i++) {
+        fill(prk[i], hash_len); fill(salt[i], salt_len); fill(ikm[i], ikm_lens[t]); fill(info[i], 20);
+      }
+      EverCrypt_HKDF_expand_many(a->alg, n, okm, prk, hash_len, info, t * 5, lens[t]);
+      EverCrypt_HKDF_extract_many(a->alg, n, prk_o, salt, salt_len, ikm, ikm_lens[t]);
+      for (uint32_t i = 0; i < n; i++) {
+        EverCrypt_HKDF_expand(a->alg, expected, prk[i], hash_len, info[i], t * 5, lens[t]);
+        ok = ok && memcmp(okm[i], expected, lens[t]) == 0;
+        EverCrypt_HKDF_extract(a->alg, expected, salt[i], salt_len, ikm[i], ikm_lens[t]);
+        ok = ok && memcmp(prk_o[i], expected, hash_len) == 0;
+      }
+    }
+  }
+
+  // Eight lanes of 1 MiB of input keying material, which are not copied.
+  uint32_t big_len = 1 << 20;
+  uint8_t *big[8];
+  for (int i = 0; i < 8; i++) {
+    big[i] = malloc(big_len);
+    fill(big[i], big_len);
+  }
+  EverCrypt_HKDF_extract_many(a->alg, 8, prk_o, salt, 16, big, big_len);
+  for (int i = 0; i < 8; i++) {
+    EverCrypt_HKDF_extract(a->alg, expected, salt[i], 16, big[i], big_len);
+    ok = ok && memcmp(prk_o[i], expected, hash_len) == 0;
+    free(big[i]);
+  }
+  printf("EverCrypt_HKDF_expand_many/extract_many (%s%s): %s\n", a->name, variant, ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Runs EverCrypt_DRBG alongside Hacl_HMAC_DRBG, which uses the one-shot HMAC,
+// on the same entropy; in_place puts the EverCrypt state in caller storage.
+bool test_drbg(const alg_t *a, bool in_place) {
+  uint32_t entropy_len = Hacl_HMAC_DRBG_min_length(a->alg);
+  uint32_t nonce_len = entropy_len / 2;
+  uint8_t out[1000], expected[1000], additional[32];
+  bool ok = true;
+  _Alignas(EverCrypt_DRBG_state_align) uint8_t mem[EverCrypt_DRBG_state_len];
+  EverCrypt_DRBG_state_s *st =
+    in_place ? EverCrypt_DRBG_init_in_place(a->alg, mem) : EverCrypt_DRBG_create(a->alg);
+  Hacl_HMAC_DRBG_state ref = Hacl_HMAC_DRBG_create_in(a->alg);
+  ok = EverCrypt_DRBG_instantiate(st, (uint8_t *)"hmac-test", 9);
+  Hacl_HMAC_DRBG_instantiate(a->alg, ref, entropy_len, entropy, nonce_len, entropy + entropy_len,
+                             9, (uint8_t *)"hmac-test");
+
+  uint32_t lens[] = { 1, Hacl_Hash_Definitions_hash_len(a->alg), 3 * Hacl_Hash_Definitions_hash_len(a->alg) + 1, 1000 };
+  for (int i = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+    uint32_t additional_len = i % 2 == 0 ? 0 : 32;
+    fill(additional, 32);
+    ok = ok && EverCrypt_DRBG_generate(out, st, lens[i], additional, additional_len);
+    Hacl_HMAC_DRBG_reseed(a->alg, ref, entropy_len, entropy, additional_len, additional);
+    ok = ok && Hacl_HMAC_DRBG_generate(a->alg, expected, ref, lens[i], additional_len, additional);
+    ok = ok && memcmp(out, expected, lens[i]) == 0;
+  }
+  if (in_place) {
+    EverCrypt_DRBG_uninstantiate_in_place(st);
+    // Key, value and reseed counter follow the 32-byte header.
+    for (uint32_t i = 32; i < 164; i++)
+      ok = ok && mem[i] == 0;
+  } else
+    EverCrypt_DRBG_uninstantiate(st);
+  free(ref.k);
+  free(ref.v);
+  free(ref.reseed_counter);
+  printf("EverCrypt_DRBG_generate (%s%s): %s\n", a->name, in_place ? ", in place" : "", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Ticket-style derivations: 32 bytes from each of 64 PRKs.
+void bench_hkdf_many(const char *variant) {
+  uint8_t prk_buf[64][32], okm_buf[64][32], info_buf[64][16];
+  uint8_t *prk[64], *okm[64], *info[64];
+  for (int i = 0; i < 64; i++) {
+    prk[i] = prk_buf[i]; okm[i] = okm_buf[i]; info[i] = info_buf[i];
+    fill(prk[i], 32);
+    fill(info[i], 16);
+  }
+  cycles a, b;
+  clock_t t1, t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS / 64; j++)
+    for (int i = 0; i < 64; i++)
+      EverCrypt_HKDF_expand_sha2_256(okm[i], prk[i], 32, info[i], 16, 32);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS / 64; j++)
+    EverCrypt_HKDF_expand_many(Spec_Hash_Definitions_SHA2_256, 64, okm, prk, 32, info, 16, 32);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+  uint64_t count = ROUNDS / 64 * 64 * 32;
+  printf("HKDF-Expand-SHA2-256 (one at a time%s) PERF: %d\n", variant, (int)okm[0][0]); print_time(count, tdiff1, cdiff1);
+  printf("HKDF-Expand-SHA2-256 (expand_many%s) PERF: %d\n", variant, (int)okm[0][0]); print_time(count, tdiff2, cdiff2);
+}
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  for (int i = 0; i < sizeof(algs)/sizeof(algs[0]); i++) {
+    ok = test_key_state(&algs[i]) && ok;
+    ok = test_streaming(&algs[i]) && ok;
+    ok = test_hkdf(&algs[i]) && ok;
+    ok = test_hkdf_many(&algs[i], "") && ok;
+    if (i < 4) {
+      ok = test_drbg(&algs[i], false) && ok;
+      ok = test_drbg(&algs[i], true) && ok;
+    }
+  }
+
+  // Short messages, where the two pad blocks dominate the cost.
+  uint8_t key[32], data[64];
+  fill(key, 32);
+  fill(data, 64);
+  EverCrypt_HMAC_key_state st;
+  EverCrypt_HMAC_key_state_init(&st, Spec_Hash_Definitions_SHA2_256, key, 32);
+  cycles a, b;
+  clock_t t1, t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_HMAC_compute_sha2_256(data, key, 32, data, 64);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    EverCrypt_HMAC_key_state_compute(&st, data, data, 64);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  uint64_t count = ROUNDS * 64;
+  printf("HMAC-SHA2-256 (64 bytes, one-shot) PERF: %d\n", (int)data[0]); print_time(count, tdiff1, cdiff1);
+  printf("HMAC-SHA2-256 (64 bytes, key state) PERF: %d\n", (int)data[0]); print_time(count, tdiff2, cdiff2);
+
+  bench_hkdf_many("");
+
+  // Without SHA extensions, the SHA2-256 batches run in AVX2/AVX lanes.
+  EverCrypt_AutoConfig2_disable_shaext();
+  ok = test_hkdf_many(&algs[1], ", vector lanes") && ok;
+  bench_hkdf_many(", vector lanes");
+
+  // Without AVX2, the SHA2-384/512 batches hash one lane after the other.
+  EverCrypt_AutoConfig2_disable_avx2();
+  ok = test_hkdf_many(&algs[2], ", no AVX2") && ok;
+  ok = test_hkdf_many(&algs[3], ", no AVX2") && ok;
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
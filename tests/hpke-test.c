@@ -0,0 +1,244 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "Hacl_Curve25519_51.h"
+#include "Hacl_P256.h"
+#include "Hacl_HPKE_Curve51_CP32_SHA256.h"
+#include "Hacl_HPKE_Curve51_CP32_SHA512.h"
+#include "Hacl_HPKE_Curve51_CP128_SHA256.h"
+#include "Hacl_HPKE_Curve51_CP128_SHA512.h"
+#include "Hacl_HPKE_Curve51_CP256_SHA256.h"
+#include "Hacl_HPKE_Curve51_CP256_SHA512.h"
+#include "Hacl_HPKE_Curve64_CP32_SHA256.h"
+#include "Hacl_HPKE_Curve64_CP32_SHA512.h"
+#include "Hacl_HPKE_Curve64_CP128_SHA256.h"
+#include "Hacl_HPKE_Curve64_CP128_SHA512.h"
+#include "Hacl_HPKE_Curve64_CP256_SHA256.h"
+#include "Hacl_HPKE_Curve64_CP256_SHA512.h"
+#include "Hacl_HPKE_P256_CP32_SHA256.h"
+#include "Hacl_HPKE_P256_CP128_SHA256.h"
+#include "Hacl_HPKE_P256_CP256_SHA256.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+
+#define MLEN   100
+#define ROUNDS 2000
+#define SIZE   64
+
+static void fill(uint8_t *b, uint32_t len, uint8_t seed) {
+  for (uint32_t i = 0; i < len; i++)
+    b[i] = (uint8_t)(seed + i * 13);
+}
+
+static void keypair_25519(uint8_t *pk, uint8_t *sk) {
+  Hacl_Curve25519_51_secret_to_public(pk, sk);
+}
+
+static void keypair_p256(uint8_t *pk, uint8_t *sk) {
+  pk[0] = 4;
+  Hacl_P256_ecp256dh_i(pk + 1, sk);
+}
+
+// Receiver setup with a cached pkR, alone and batched, against setupBaseR;
+// the second encapsulated key of the batch comes from another sender.
+#define TEST_CACHED(M, PKLEN, KEYPAIR)                                        \
+bool test_cached_##M(uint8_t *pkE, uint8_t *skR, uint8_t *pkR,                \
+  uint8_t *info, uint8_t *single) {                                           \
+  uint8_t skE2[32], pkE2[PKLEN], pt[MLEN], pt2[MLEN];                         \
+  uint8_t *pkEs[2] = { pkE, pkE2 };                                           \
+  uint32_t res[2];                                                            \
+  M##_context ctx, ctx2, many[2];                                             \
+  bool ok = true;                                                             \
+  memset(&ctx, 0, sizeof(ctx));                                               \
+  memset(&ctx2, 0, sizeof(ctx));                                              \
+  memset(many, 0, sizeof(many));                                              \
+  fill(skE2, 32, 5);                                                          \
+  KEYPAIR(pkE2, skE2);                                                        \
+  ok = ok && M##_setupBaseR_context(&ctx, pkE, skR, 7, info) == 0;            \
+  ok = ok && M##_setupBaseR_context(&ctx2, pkE2, skR, 7, info) == 0;          \
+  ok = ok && M##_setupBaseR_many(2, many, res, pkEs, skR, pkR, 7, info) == 0; \
+  ok = ok && res[0] == 0 && res[1] == 0;                                      \
+  ok = ok && memcmp(&ctx, &many[0], sizeof(ctx)) == 0;                        \
+  ok = ok && memcmp(&ctx2, &many[1], sizeof(ctx)) == 0;                       \
+  ok = ok && M##_setupBaseR_context_pk(&many[1], pkE, skR, pkR, 7, info) == 0;\
+  ok = ok && memcmp(&ctx, &many[1], sizeof(ctx)) == 0;                        \
+  ok = ok && M##_setupBaseR_pk(many[0].key, many[0].nonce, pkE2, skR, pkR, 7, \
+    info) == 0;                                                               \
+  ok = ok && memcmp(ctx2.key, many[0].key, 32) == 0;                          \
+  ok = ok && memcmp(ctx2.nonce, many[0].nonce, 12) == 0;                      \
+  ok = ok && M##_openBase(pkE, skR, PKLEN + MLEN + 16, single, 7, info, pt) == 0;\
+  ok = ok && M##_openBase_pk(pkE, skR, pkR, PKLEN + MLEN + 16, single, 7,     \
+    info, pt2) == 0;                                                          \
+  ok = ok && memcmp(pt, pt2, MLEN) == 0;                                      \
+  return ok;                                                                  \
+}
+
+// For each ciphersuite: the first message sealed by a context is the one
+// sealBase produces (sealBase uses info as the additional data), later
+// messages round-trip under fresh nonces, a forged message is rejected
+// without consuming a sequence number, both sides export the same
+// secrets, oversized exports are refused and wiping zeroes the context.
+#define TEST_SUITE(M, PKLEN, KEYPAIR)                                         \
+TEST_CACHED(M, PKLEN, KEYPAIR)                                                \
+bool test_##M(void) {                                                         \
+  uint8_t skE[32], skR[32], pkR[PKLEN], pkE[PKLEN], info[7];                  \
+  uint8_t msg[MLEN], single[PKLEN + MLEN + 16], ct[MLEN + 16], pt[MLEN];      \
+  uint8_t expI[80], expR[80];                                                 \
+  M##_context ctxI, ctxR;                                                     \
+  bool ok = true;                                                             \
+  fill(skE, 32, 1);                                                           \
+  fill(skR, 32, 2);                                                           \
+  fill(info, 7, 3);                                                           \
+  fill(msg, MLEN, 4);                                                         \
+  KEYPAIR(pkR, skR);                                                          \
+  ok = ok && M##_sealBase(skE, pkR, MLEN, msg, 7, info, single) == 0;         \
+  ok = ok && M##_setupBaseI_context(&ctxI, pkE, skE, pkR, 7, info) == 0;      \
+  ok = ok && memcmp(pkE, single, PKLEN) == 0;                                 \
+  ok = ok && M##_setupBaseR_context(&ctxR, pkE, skR, 7, info) == 0;           \
+  for (int i = 0; i < 3; i++) {                                               \
+    ok = ok && M##_context_seal(&ctxI, 7, info, MLEN, msg, ct) == 0;          \
+    if (i == 0)                                                               \
+      ok = ok && memcmp(ct, single + PKLEN, MLEN + 16) == 0;                  \
+    else                                                                      \
+      ok = ok && memcmp(ct, single + PKLEN, MLEN + 16) != 0;                  \
+    ct[i] ^= 1;                                                               \
+    ok = ok && M##_context_open(&ctxR, 7, info, MLEN + 16, ct, pt) != 0;      \
+    ct[i] ^= 1;                                                               \
+    ok = ok && M##_context_open(&ctxR, 7, info, MLEN + 16, ct, pt) == 0;      \
+    ok = ok && memcmp(pt, msg, MLEN) == 0;                                    \
+  }                                                                           \
+  ok = ok && ctxI.seq == 3 && ctxR.seq == 3;                                  \
+  ok = ok && M##_context_export(&ctxI, 7, info, 80, expI) == 0;               \
+  ok = ok && M##_context_export(&ctxR, 7, info, 80, expR) == 0;               \
+  ok = ok && memcmp(expI, expR, 80) == 0;                                     \
+  ok = ok && M##_context_export(&ctxR, 6, info, 80, expR) == 0;               \
+  ok = ok && memcmp(expI, expR, 80) != 0;                                     \
+  ok = ok && M##_context_export(&ctxR, 7, info,                               \
+    255 * sizeof(ctxR.exporter_secret) + 1, NULL) != 0;                       \
+  ok = ok && test_cached_##M(pkE, skR, pkR, info, single);                    \
+  M##_context_wipe(&ctxI);                                                    \
+  memset(&ctxR, 0, sizeof(ctxR));                                             \
+  ok = ok && memcmp(&ctxI, &ctxR, sizeof(ctxI)) == 0;                         \
+  printf("%s context: %s\n", #M, ok ? "Success!" : "**FAILED**");             \
+  return ok;                                                                  \
+}
+
+TEST_SUITE(Hacl_HPKE_Curve51_CP32_SHA256, 32, keypair_25519)
+TEST_SUITE(Hacl_HPKE_Curve51_CP32_SHA512, 32, keypair_25519)
+TEST_SUITE(Hacl_HPKE_Curve51_CP128_SHA256, 32, keypair_25519)
+TEST_SUITE(Hacl_HPKE_Curve51_CP128_SHA512, 32, keypair_25519)
+TEST_SUITE(Hacl_HPKE_Curve51_CP256_SHA256, 32, keypair_25519)
+TEST_SUITE(Hacl_HPKE_Curve51_CP256_SHA512, 32, keypair_25519)
+TEST_SUITE(Hacl_HPKE_Curve64_CP32_SHA256, 32, keypair_25519)
+TEST_SUITE(Hacl_HPKE_Curve64_CP32_SHA512, 32, keypair_25519)
+TEST_SUITE(Hacl_HPKE_Curve64_CP128_SHA256, 32, keypair_25519)
+TEST_SUITE(Hacl_HPKE_Curve64_CP128_SHA512, 32, keypair_25519)
+TEST_SUITE(Hacl_HPKE_Curve64_CP256_SHA256, 32, keypair_25519)
+TEST_SUITE(Hacl_HPKE_Curve64_CP256_SHA512, 32, keypair_25519)
+TEST_SUITE(Hacl_HPKE_P256_CP32_SHA256, 65, keypair_p256)
+TEST_SUITE(Hacl_HPKE_P256_CP128_SHA256, 65, keypair_p256)
+TEST_SUITE(Hacl_HPKE_P256_CP256_SHA256, 65, keypair_p256)
+
+int main() {
+  EverCrypt_AutoConfig2_init();
+  bool vec128 = EverCrypt_AutoConfig2_has_avx();
+  bool vec256 = EverCrypt_AutoConfig2_has_avx2();
+  bool curve64 = EverCrypt_AutoConfig2_has_bmi2() && EverCrypt_AutoConfig2_has_adx();
+  bool ok = true;
+
+  ok = test_Hacl_HPKE_Curve51_CP32_SHA256() && ok;
+  ok = test_Hacl_HPKE_Curve51_CP32_SHA512() && ok;
+  ok = test_Hacl_HPKE_P256_CP32_SHA256() && ok;
+  if (vec128) {
+    ok = test_Hacl_HPKE_Curve51_CP128_SHA256() && ok;
+    ok = test_Hacl_HPKE_Curve51_CP128_SHA512() && ok;
+    ok = test_Hacl_HPKE_P256_CP128_SHA256() && ok;
+  }
+  if (vec256) {
+    ok = test_Hacl_HPKE_Curve51_CP256_SHA256() && ok;
+    ok = test_Hacl_HPKE_Curve51_CP256_SHA512() && ok;
+    ok = test_Hacl_HPKE_P256_CP256_SHA256() && ok;
+  }
+  if (curve64) {
+    ok = test_Hacl_HPKE_Curve64_CP32_SHA256() && ok;
+    ok = test_Hacl_HPKE_Curve64_CP32_SHA512() && ok;
+    if (vec128) {
+      ok = test_Hacl_HPKE_Curve64_CP128_SHA256() && ok;
+      ok = test_Hacl_HPKE_Curve64_CP128_SHA512() && ok;
+    }
+    if (vec256) {
+      ok = test_Hacl_HPKE_Curve64_CP256_SHA256() && ok;
+      ok = test_Hacl_HPKE_Curve64_CP256_SHA512() && ok;
+    }
+  }
+
+  // A session of small messages: one sealBase per message, against one
+  // context setup followed by context_seal.
+  uint8_t skE[32], skR[32], pkR[32], pkE[32], info[7];
+  uint8_t msg[SIZE], out[32 + SIZE + 16];
+  Hacl_HPKE_Curve51_CP32_SHA256_context ctx;
+  fill(skE, 32, 1);
+  fill(skR, 32, 2);
+  fill(info, 7, 3);
+  fill(msg, SIZE, 4);
+  keypair_25519(pkR, skR);
+  cycles a, b;
+  clock_t t1, t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_HPKE_Curve51_CP32_SHA256_sealBase(skE, pkR, SIZE, msg, 7, info, out);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  Hacl_HPKE_Curve51_CP32_SHA256_setupBaseI_context(&ctx, pkE, skE, pkR, 7, info);
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_HPKE_Curve51_CP32_SHA256_context_seal(&ctx, 7, info, SIZE, msg, out);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  // Receiver setup per message, re-deriving pkR each time or reusing it.
+  Hacl_HPKE_Curve51_CP32_SHA256_setupBaseI_context(&ctx, pkE, skE, pkR, 7, info);
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_HPKE_Curve51_CP32_SHA256_setupBaseR_context(&ctx, pkE, skR, 7, info);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff3 = b - a;
+  double tdiff3 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_HPKE_Curve51_CP32_SHA256_setupBaseR_context_pk(&ctx, pkE, skR, pkR, 7, info);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff4 = b - a;
+  double tdiff4 = t2 - t1;
+
+  uint64_t count = ROUNDS * SIZE;
+  printf("HPKE Curve51_CP32_SHA256 sealBase per message PERF: %d\n", (int)out[0]); print_time(count, tdiff1, cdiff1);
+  printf("HPKE Curve51_CP32_SHA256 context_seal PERF: %d\n", (int)out[0]); print_time(count, tdiff2, cdiff2);
+  printf("HPKE Curve51_CP32_SHA256 setupBaseR_context PERF: %d\n", (int)ctx.key[0]); print_time(ROUNDS, tdiff3, cdiff3);
+  printf("HPKE Curve51_CP32_SHA256 setupBaseR_context_pk PERF: %d\n", (int)ctx.key[0]); print_time(ROUNDS, tdiff4, cdiff4);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
@@ -1,6 +1,11 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <assert.h>
+#include <stdbool.h>
+#include <time.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/mman.h>
 
 #include "EverCrypt_AutoConfig2.h"
 #include "MerkleTree.h"
@@ -32,6 +37,415 @@ void print_tree(const mt_p mt, size_t num_elts) {
   }
 }
 
+static void fill_leaf(uint8_t *h, uint32_t i) {
+  memset(h, 0, hash_size);
+  h[0] = (uint8_t)i;
+  h[1] = (uint8_t)(i >> 8);
+  h[2] = (uint8_t)(i >> 16);
+}
+
+// The same inserts, flushes and retractions on a tree with per-hash storage
+// and on one with contiguous level storage: roots, paths and serializations
+// must agree.
+bool test_arena(uint32_t n) {
+  bool ok = true;
+  uint8_t *h = mt_init_hash(hash_size);
+  uint8_t *r = mt_init_hash(hash_size);
+  uint8_t *ra = mt_init_hash(hash_size);
+  fill_leaf(h, 0);
+  mt_p mt = mt_create(h);
+  fill_leaf(h, 0);
+  mt_p mta = mt_create_arena(h);
+  uint64_t flushed = 0;
+  for (uint32_t i = 1; i < n; i++) {
+    fill_leaf(h, i);
+    mt_insert(mt, h);
+    fill_leaf(h, i);
+    mt_insert(mta, h);
+    if (i % 97 == 0) {
+      mt_get_root(mt, r);
+      mt_get_root(mta, ra);
+      ok = ok && memcmp(r, ra, hash_size) == 0;
+    }
+    if (i == n / 3) {
+      flushed = i / 2;
+      mt_flush_to(mt, flushed);
+      mt_flush_to(mta, flushed);
+    }
+  }
+  for (uint64_t k = flushed; k < n; k++) {
+    MerkleTree_Low_path *p = mt_init_path(hash_size);
+    MerkleTree_Low_path *pa = mt_init_path(hash_size);
+    uint32_t j = mt_get_path(mt, k, p, r);
+    uint32_t ja = mt_get_path(mta, k, pa, ra);
+    ok = ok && j == ja && memcmp(r, ra, hash_size) == 0;
+    ok = ok && mt_get_path_length(p) == mt_get_path_length(pa);
+    for (uint32_t l = 0; ok && l < mt_get_path_length(p); l++)
+      ok = memcmp(mt_get_path_step(p, l), mt_get_path_step(pa, l), hash_size) == 0;
+    ok = ok && mt_verify(mta, k, ja, pa, ra);
+    mt_free_path(p);
+    mt_free_path(pa);
+  }
+  uint64_t retract_to = flushed + (n - flushed) / 2;
+  mt_retract_to(mt, retract_to);
+  mt_retract_to(mta, retract_to);
+  for (uint32_t i = 0; i < 5; i++) {
+    fill_leaf(h, n + i);
+    mt_insert(mt, h);
+    fill_leaf(h, n + i);
+    mt_insert(mta, h);
+  }
+  mt_get_root(mt, r);
+  mt_get_root(mta, ra);
+  ok = ok && memcmp(r, ra, hash_size) == 0;
+
+  uint64_t len = mt_serialize_size(mt);
+  ok = ok && len == mt_serialize_size(mta);
+  uint8_t *buf = malloc(len), *bufa = malloc(len);
+  ok = ok && mt_serialize(mt, buf, len) == len;
+  ok = ok && mt_serialize(mta, bufa, len) == len;
+  ok = ok && memcmp(buf, bufa, len) == 0;
+  merkle_tree *mtd = mt_deserialize(bufa, len, mt_sha256_compress);
+  ok = ok && mtd != NULL;
+  if (mtd != NULL) {
+    mt_get_root(mtd, ra);
+    ok = ok && memcmp(r, ra, hash_size) == 0;
+    mt_free(mtd);
+  }
+  free(buf);
+  free(bufa);
+  mt_free(mt);
+  mt_free(mta);
+
+  // Insertion time in both storage modes.
+  clock_t t[3];
+  for (int mode = 0; mode < 2; mode++) {
+    fill_leaf(h, 0);
+    mt_p m = mode == 0 ? mt_create(h) : mt_create_arena(h);
+    t[mode] = clock();
+    for (uint32_t i = 1; i < 100 * n; i++) {
+      fill_leaf(h, i);
+      mt_insert(m, h);
+    }
+    mt_get_root(m, r);
+    t[mode] = clock() - t[mode];
+    mt_free(m);
+  }
+  printf("Insertion of %u leaves: %.2fms per-hash storage, %.2fms contiguous storage\n",
+    100 * n, (double)t[0] * 1000 / CLOCKS_PER_SEC, (double)t[1] * 1000 / CLOCKS_PER_SEC);
+
+  mt_free_hash(h);
+  mt_free_hash(r);
+  mt_free_hash(ra);
+  printf("Contiguous level storage: %s\n", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// Not mt_sha256_compress itself, to exercise the generic batch path.
+static void other_compress(uint8_t *src1, uint8_t *src2, uint8_t *dst) {
+  mt_sha256_compress(src1, src2, dst);
+}
+
+static mt_p create_mode(int mode, uint8_t *h) {
+  fill_leaf(h, 0);
+  switch (mode) {
+    case 0: return mt_create(h);
+    case 1: return mt_create_arena(h);
+    case 2: return mt_create_custom(hash_size, h, other_compress);
+    default: return mt_create_custom_arena(hash_size, h, other_compress);
+  }
+}
+
+// Batches of varying sizes, with a flush in the middle, against one
+// mt_insert per leaf, for both storage modes and both hash function paths.
+bool test_batch(uint32_t n) {
+  bool ok = true;
+  uint8_t *h = mt_init_hash(hash_size);
+  uint8_t *r = mt_init_hash(hash_size);
+  uint8_t *rb = mt_init_hash(hash_size);
+  uint8_t *leaves = malloc((size_t)n * hash_size);
+  for (uint32_t i = 0; i < n; i++)
+    fill_leaf(leaves + i * hash_size, i + 1);
+  for (int mode = 0; mode < 4; mode++) {
+    mt_p mt = create_mode(mode, h);
+    mt_p mtb = create_mode(mode, h);
+    uint32_t done = 0, b = 0;
+    while (done < n) {
+      uint32_t len = n - done < b ? n - done : b;
+      ok = ok && mt_insert_batch_pre(mtb, leaves + done * hash_size, len);
+      mt_insert_batch(mtb, leaves + done * hash_size, len);
+      for (uint32_t i = done; i < done + len; i++) {
+        memcpy(h, leaves + i * hash_size, hash_size);
+        mt_insert(mt, h);
+      }
+      done += len;
+      b = b * 2 + 1 + done % 5;
+      mt_get_root(mt, r);
+      mt_get_root(mtb, rb);
+      ok = ok && memcmp(r, rb, hash_size) == 0;
+      if (done > n / 2 && mtb->i == 0) {
+        mt_flush_to(mt, done - 3);
+        mt_flush_to(mtb, done - 3);
+      }
+    }
+    uint64_t len = mt_serialize_size(mt);
+    ok = ok && len == mt_serialize_size(mtb);
+    uint8_t *buf = malloc(len), *bufb = malloc(len);
+    ok = ok && mt_serialize(mt, buf, len) == len && mt_serialize(mtb, bufb, len) == len;
+    ok = ok && memcmp(buf, bufb, len) == 0;
+    free(buf);
+    free(bufb);
+    mt_free(mt);
+    mt_free(mtb);
+  }
+
+  // Insertion time, one leaf at a time against batches of 4096.
+  uint32_t rounds = 100;
+  clock_t t[4];
+  for (int mode = 0; mode < 4; mode++) {
+    mt_p m = create_mode(mode % 2, h);
+    t[mode] = clock();
+    for (uint32_t k = 0; k < rounds; k++) {
+      if (mode < 2) {
+        for (uint32_t i = 0; i < n; i++) {
+          memcpy(h, leaves + i * hash_size, hash_size);
+          mt_insert(m, h);
+        }
+      } else {
+        for (uint32_t i = 0; i < n; i += 4096)
+          mt_insert_batch(m, leaves + i * hash_size, n - i < 4096 ? n - i : 4096);
+      }
+    }
+    mt_get_root(m, r);
+    t[mode] = clock() - t[mode];
+    mt_free(m);
+  }
+  printf("Insertion of %u leaves: %.2fms mt_insert, %.2fms mt_insert_batch (per-hash storage)\n",
+    rounds * n, (double)t[0] * 1000 / CLOCKS_PER_SEC, (double)t[2] * 1000 / CLOCKS_PER_SEC);
+  printf("Insertion of %u leaves: %.2fms mt_insert, %.2fms mt_insert_batch (contiguous storage)\n",
+    rounds * n, (double)t[1] * 1000 / CLOCKS_PER_SEC, (double)t[3] * 1000 / CLOCKS_PER_SEC);
+
+  free(leaves);
+  mt_free_hash(h);
+  mt_free_hash(r);
+  mt_free_hash(rb);
+  printf("Batch insertion: %s\n", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+static bool same_tree(mt_p a, mt_p b) {
+  uint8_t *ra = mt_init_hash(hash_size), *rb = mt_init_hash(hash_size);
+  mt_get_root(a, ra);
+  mt_get_root(b, rb);
+  bool ok = memcmp(ra, rb, hash_size) == 0;
+  uint64_t len = mt_serialize_size(a);
+  ok = ok && len == mt_serialize_size(b);
+  uint8_t *buf = malloc(len), *bufb = malloc(len);
+  ok = ok && mt_serialize(a, buf, len) == len && mt_serialize(b, bufb, len) == len;
+  ok = ok && memcmp(buf, bufb, len) == 0;
+  free(buf);
+  free(bufb);
+  mt_free_hash(ra);
+  mt_free_hash(rb);
+  return ok;
+}
+
+// Images of trees in both storage modes, opened from a heap buffer and from a
+// mapped file, with paths, appends past the slack, flushes and retractions,
+// against the tree they were written from.
+bool test_image(uint32_t n) {
+  bool ok = true;
+  uint8_t *h = mt_init_hash(hash_size);
+  uint8_t *leaves = malloc((size_t)3 * n * hash_size);
+  for (uint32_t i = 0; i < 3 * n; i++)
+    fill_leaf(leaves + i * hash_size, i + 1);
+  mt_p mt = create_mode(0, h), mta = create_mode(1, h);
+  mt_insert_batch(mt, leaves, n);
+  mt_insert_batch(mta, leaves, n);
+  mt_flush_to(mt, n / 3);
+  mt_flush_to(mta, n / 3);
+  uint8_t *r = mt_init_hash(hash_size);
+  mt_get_root(mt, r);
+  mt_get_root(mta, r);
+
+  uint32_t slack = n / 2;
+  uint64_t len = mt_image_size(mt, slack);
+  ok = ok && len == mt_image_size(mta, slack);
+  uint8_t *img = malloc(len), *imga = malloc(len), *copy = malloc(len);
+  ok = ok && mt_image_write(mt, slack, img, len) == len;
+  ok = ok && mt_image_write(mta, slack, imga, len) == len;
+  ok = ok && mt_image_write(mta, slack, imga, len - 1) == 0;
+  ok = ok && memcmp(img, imga, len) == 0;
+  memcpy(copy, img, len);
+
+  // Corrupted or truncated images are rejected.
+  ok = ok && mt_image_open(img, 100, false, mt_sha256_compress) == NULL;
+  img[8]++;
+  ok = ok && mt_image_open(img, len, false, mt_sha256_compress) == NULL;
+  img[8]--;
+  img[28]++;
+  ok = ok && mt_image_open(img, len, false, mt_sha256_compress) == NULL;
+  img[28]--;
+  ok = ok && mt_image_open(img, len - 64, false, mt_sha256_compress) == NULL;
+
+  // Read-only: paths and appends, with the image left untouched.
+  mt_p mti = mt_image_open(img, len, false, mt_sha256_compress);
+  ok = ok && mti != NULL;
+  if (mti != NULL) {
+    ok = ok && same_tree(mti, mta);
+    uint8_t *ri = mt_init_hash(hash_size);
+    MerkleTree_Low_path *p = mt_init_path(hash_size);
+    uint32_t jj = mt_get_path(mti, n - 2, p, ri);
+    ok = ok && mt_verify(mti, n - 2, jj, p, ri);
+    ok = ok && memcmp(ri, r, hash_size) == 0;
+    mt_free_path(p);
+    mt_free_hash(ri);
+    mt_retract_to(mti, n - 7);
+    mt_retract_to(mta, n - 7);
+    mt_insert_batch(mti, leaves + n * hash_size, n);
+    mt_insert_batch(mta, leaves + n * hash_size, n);
+    mt_flush_to(mti, n);
+    mt_flush_to(mta, n);
+    ok = ok && same_tree(mti, mta);
+    ok = ok && memcmp(img, copy, len) == 0;
+    mt_free(mti);
+  }
+
+  // Writable private mapping of a file: appends within the slack land in the
+  // mapping, and the file keeps the image as written.
+  FILE *f = tmpfile();
+  bool written = f != NULL && fwrite(copy, 1, len, f) == len && fflush(f) == 0;
+  ok = ok && written;
+  uint8_t *map = !written ? MAP_FAILED :
+    mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(f), 0);
+  ok = ok && map != MAP_FAILED;
+  if (map != MAP_FAILED) {
+    mt_p mtm = mt_image_open(map, len, true, mt_sha256_compress);
+    ok = ok && mtm != NULL;
+    if (mtm != NULL) {
+      mt_insert_batch(mtm, leaves + 2 * n * hash_size, slack);
+      mt_insert_batch(mt, leaves + 2 * n * hash_size, slack);
+      ok = ok && mtm->ha[0].borrowed && same_tree(mtm, mt);
+      mt_insert_batch(mtm, leaves + (2 * n + slack) * hash_size, n - slack);
+      mt_insert_batch(mt, leaves + (2 * n + slack) * hash_size, n - slack);
+      ok = ok && !mtm->ha[0].borrowed && same_tree(mtm, mt);
+      mt_free(mtm);
+    }
+    munmap(map, len);
+    uint8_t *back = malloc(len);
+    ok = ok && fseek(f, 0, SEEK_SET) == 0 && fread(back, 1, len, f) == len;
+    ok = ok && memcmp(back, copy, len) == 0;
+    free(back);
+  }
+  if (f != NULL)
+    fclose(f);
+
+  // Loading time, against mt_deserialize.
+  mt_p big = create_mode(1, h);
+  for (int k = 0; k < 3; k++)
+    mt_insert_batch(big, leaves, 3 * n);
+  uint64_t blen = mt_image_size(big, 0), slen = mt_serialize_size(big);
+  uint8_t *bimg = malloc(blen), *sbuf = malloc(slen);
+  mt_image_write(big, 0, bimg, blen);
+  mt_serialize(big, sbuf, slen);
+  clock_t t1 = clock();
+  mt_p d = mt_deserialize(sbuf, slen, mt_sha256_compress);
+  t1 = clock() - t1;
+  clock_t t2 = clock();
+  mt_p o = mt_image_open(bimg, blen, false, mt_sha256_compress);
+  t2 = clock() - t2;
+  ok = ok && d != NULL && o != NULL && same_tree(d, o);
+  printf("Loading a tree of %u leaves: %.3fms mt_deserialize, %.3fms mt_image_open\n",
+    9 * n, (double)t1 * 1000 / CLOCKS_PER_SEC, (double)t2 * 1000 / CLOCKS_PER_SEC);
+  if (d != NULL)
+    mt_free(d);
+  if (o != NULL)
+    mt_free(o);
+  mt_free(big);
+  free(bimg);
+  free(sbuf);
+
+  free(img);
+  free(imga);
+  free(copy);
+  free(leaves);
+  mt_free(mt);
+  mt_free(mta);
+  mt_free_hash(h);
+  mt_free_hash(r);
+  printf("Tree images: %s\n", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
+// A replica kept up to date with deltas from a tree with inserts, flushes up
+// to the checkpoint and retractions, in every pair of storage modes and from
+// an opened image.
+bool test_delta(uint32_t n) {
+  bool ok = true;
+  uint8_t *h = mt_init_hash(hash_size);
+  uint8_t *leaves = malloc((size_t)n * hash_size);
+  for (uint32_t i = 0; i < n; i++)
+    fill_leaf(leaves + i * hash_size, i + 1);
+  uint64_t delta_bytes = 0, full_bytes = 0;
+  for (int mode = 0; mode < 5; mode++) {
+    mt_p mt = create_mode(mode % 2, h);
+    mt_p replica = create_mode(mode / 2 % 2, h);
+    uint8_t *img = NULL;
+    if (mode == 4) {
+      uint64_t ilen = mt_image_size(replica, 0);
+      img = malloc(ilen);
+      mt_image_write(replica, 0, img, ilen);
+      mt_free(replica);
+      replica = mt_image_open(img, ilen, false, mt_sha256_compress);
+    }
+    uint64_t since = mt->offset + mt->j;
+    uint32_t done = 1, b = 20, round = 0;
+    while (done < n) {
+      uint32_t len = n - done < b ? n - done : b;
+      mt_insert_batch(mt, leaves + done * hash_size, len);
+      done += len;
+      b = 20 + round % 7 * 30;
+      if (round % 4 == 3 && mt->j - mt->i > 10) {
+        uint64_t r = mt->offset + mt->j - 9;
+        mt_retract_to(mt, r);
+        done = r + 1;
+        since = since < r + 1 ? since : r + 1;
+      }
+      if (round % 5 == 4 && since > mt->offset + mt->i)
+        mt_flush_to(mt, since);
+      round++;
+
+      uint64_t dlen = mt_delta_size(mt, since);
+      ok = ok && dlen > 0;
+      uint8_t *delta = malloc(dlen);
+      ok = ok && mt_delta_write(mt, since, delta, dlen) == dlen;
+      ok = ok && mt_delta_write(mt, since, delta, dlen - 1) == 0;
+      ok = ok && !mt_delta_apply(replica, delta, dlen - 1);
+      ok = ok && mt_delta_apply(replica, delta, dlen);
+      ok = ok && same_tree(mt, replica);
+      // Applying the same delta again leaves the replica unchanged.
+      ok = ok && mt_delta_apply(replica, delta, dlen);
+      ok = ok && same_tree(mt, replica);
+      delta_bytes += dlen;
+      full_bytes += mt_serialize_size(mt);
+      free(delta);
+      since = mt->offset + mt->j;
+    }
+    ok = ok && mt_delta_size(mt, mt->offset + mt->i - 1) == 0;
+    ok = ok && mt_delta_size(mt, mt->offset + mt->j + 1) == 0;
+    mt_free(mt);
+    mt_free(replica);
+    free(img);
+  }
+  printf("Checkpoints of %u leaves: %lu bytes of deltas, %lu bytes of mt_serialize\n",
+    n, (unsigned long)delta_bytes, (unsigned long)full_bytes);
+
+  free(leaves);
+  mt_free_hash(h);
+  printf("Tree deltas: %s\n", ok ? "Success!" : "**FAILED**");
+  return ok;
+}
+
 int main(int argc, char *argv[]) {
 
   uint64_t num_elts = 1;
@@ -209,5 +623,14 @@ int main(int argc, char *argv[]) {
 
   printf("The Merkle tree is freed\n");
 
+  if (!test_arena(1000))
+    return 1;
+  if (!test_batch(10000))
+    return 1;
+  if (!test_image(10000))
+    return 1;
+  if (!test_delta(20000))
+    return 1;
+
   return 0;
 }
@@ -0,0 +1,190 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdbool.h>
+#include "test_helpers.h"
+
+#include "Hacl_P256.h"
+
+#define N      37
+#define MLEN   48
+#define ROUNDS 20
+
+static uint64_t seed = 0x9e3779b97f4a7c15ULL;
+
+// Scalars and nonces only need to be in range, not random: the top byte is
+// kept below the one of the order.
+static void fill(uint8_t *b, int len) {
+  for (int i = 0; i < len; i++) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    b[i] = (uint8_t)(seed >> 56);
+  }
+  b[0] &= 0x7f;
+  b[len - 1] |= 1;
+}
+
+static uint8_t priv[N][32];
+static uint8_t pub[N][64];
+static uint8_t msg[N][MLEN];
+static uint8_t sig[N][64];
+static uint8_t peer[N][64];
+static uint8_t shared[N][64];
+
+int main() {
+  uint8_t *pk[N], *m[N], *r[N], *s[N], *sc[N], *pp[N], *out[N];
+  uint32_t mlen[N];
+  bool valid[N], success[N];
+  bool ok = true;
+
+  for (int i = 0; i < N; i++) {
+    uint8_t k[32];
+    uint8_t peer_priv[32];
+    fill(priv[i], 32);
+    fill(peer_priv, 32);
+    fill(k, 32);
+    fill(msg[i], MLEN);
+    ok = Hacl_P256_ecp256dh_i(pub[i], priv[i]) && ok;
+    ok = Hacl_P256_ecp256dh_i(peer[i], peer_priv) && ok;
+    ok = Hacl_P256_ecdsa_sign_p256_sha2(sig[i], MLEN, msg[i], priv[i], k) && ok;
+    pk[i] = pub[i];
+    m[i] = msg[i];
+    mlen[i] = MLEN;
+    r[i] = sig[i];
+    s[i] = sig[i] + 32;
+    sc[i] = priv[i];
+    pp[i] = peer[i];
+    out[i] = shared[i];
+  }
+
+  bool all = Hacl_P256_ecdsa_verif_p256_sha2_many(N, mlen, m, pk, r, s, valid);
+  for (int i = 0; i < N; i++)
+    ok = ok && valid[i];
+  ok = ok && all;
+  printf("P256 batch verification (all valid): %s\n", ok ? "Success!" : "**FAILED**");
+
+  // Corrupt a few entries across the chunk boundary and check that the batch
+  // agrees with the single-signature function everywhere.
+  sig[3][40] ^= 1;
+  msg[16][0] ^= 0x80;
+  memset(sig[17], 0, 32);
+  pub[30][63] ^= 1;
+  memcpy(sig[36] + 32, sig[35] + 32, 32);
+  all = Hacl_P256_ecdsa_verif_p256_sha2_many(N, mlen, m, pk, r, s, valid);
+  bool ok_corrupt = !all;
+  for (int i = 0; i < N; i++) {
+    bool single = Hacl_P256_ecdsa_verif_p256_sha2(mlen[i], m[i], pk[i], r[i], s[i]);
+    bool expected = !(i == 3 || i == 16 || i == 17 || i == 30 || i == 36);
+    ok_corrupt = ok_corrupt && valid[i] == single && single == expected;
+  }
+  printf("P256 batch verification (corrupted entries): %s\n", ok_corrupt ? "Success!" : "**FAILED**");
+  ok = ok && ok_corrupt;
+
+  // Without hashing, the first 32 bytes of each message are the digest.
+  for (int i = 0; i < N; i++) {
+    uint8_t k[32];
+    fill(k, 32);
+    ok = Hacl_P256_ecdsa_sign_p256_without_hash(sig[i], MLEN, msg[i], priv[i], k) && ok;
+  }
+  all = Hacl_P256_ecdsa_verif_without_hash_many(N, mlen, m, pk, r, s, valid);
+  bool ok_nohash = !all;
+  for (int i = 0; i < N; i++) {
+    bool single = Hacl_P256_ecdsa_verif_without_hash(mlen[i], m[i], pk[i], r[i], s[i]);
+    ok_nohash = ok_nohash && valid[i] == single && single == (i != 30);
+  }
+  printf("P256 batch verification (without hashing): %s\n", ok_nohash ? "Success!" : "**FAILED**");
+  ok = ok && ok_nohash;
+
+  // SHA-384 and SHA-512: every other signature uses the other hash, so the
+  // batch must reject exactly those and entry 30.
+  for (int i = 0; i < N; i++) {
+    uint8_t k[32];
+    fill(k, 32);
+    if (i % 2 == 0)
+      ok = Hacl_P256_ecdsa_sign_p256_sha384(sig[i], MLEN, msg[i], priv[i], k) && ok;
+    else
+      ok = Hacl_P256_ecdsa_sign_p256_sha512(sig[i], MLEN, msg[i], priv[i], k) && ok;
+  }
+  all = Hacl_P256_ecdsa_verif_p256_sha384_many(N, mlen, m, pk, r, s, valid);
+  bool ok_sha2 = !all;
+  for (int i = 0; i < N; i++) {
+    bool single = Hacl_P256_ecdsa_verif_p256_sha384(mlen[i], m[i], pk[i], r[i], s[i]);
+    ok_sha2 = ok_sha2 && valid[i] == single && single == (i % 2 == 0 && i != 30);
+  }
+  all = Hacl_P256_ecdsa_verif_p256_sha512_many(N, mlen, m, pk, r, s, valid);
+  for (int i = 0; i < N; i++) {
+    bool single = Hacl_P256_ecdsa_verif_p256_sha512(mlen[i], m[i], pk[i], r[i], s[i]);
+    ok_sha2 = ok_sha2 && !all && valid[i] == single && single == (i % 2 == 1);
+  }
+  printf("P256 batch verification (SHA-384/SHA-512): %s\n", ok_sha2 ? "Success!" : "**FAILED**");
+  ok = ok && ok_sha2;
+
+  // ECDH: pub[30] is now off the curve; using it as the peer key of entry 5
+  // catches index mix-ups between the valid and the invalid keys.
+  pp[5] = pub[30];
+  all = Hacl_P256_ecp256dh_r_many(N, out, pp, sc, success);
+  bool ok_dh = !all;
+  for (int i = 0; i < N; i++) {
+    uint8_t exp[64];
+    bool single = Hacl_P256_ecp256dh_r(exp, pp[i], sc[i]);
+    ok_dh = ok_dh && success[i] == single && single == (i != 5) && memcmp(exp, out[i], 64) == 0;
+  }
+  printf("P256 batch ECDH: %s\n", ok_dh ? "Success!" : "**FAILED**");
+  ok = ok && ok_dh;
+  pp[5] = peer[5];
+
+  cycles a, b;
+  clock_t t1, t2;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    for (int i = 0; i < N; i++)
+      valid[i] = Hacl_P256_ecdsa_verif_without_hash(mlen[i], m[i], pk[i], r[i], s[i]);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_P256_ecdsa_verif_without_hash_many(N, mlen, m, pk, r, s, valid);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    for (int i = 0; i < N; i++)
+      Hacl_P256_ecp256dh_r(out[i], pp[i], sc[i]);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff3 = b - a;
+  double tdiff3 = t2 - t1;
+
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++)
+    Hacl_P256_ecp256dh_r_many(N, out, pp, sc, success);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff4 = b - a;
+  double tdiff4 = t2 - t1;
+
+  uint64_t count = ROUNDS * N;
+  printf("Hacl ECDSA verification (without hashing, one at a time) PERF:\n"); print_time(count, tdiff1, cdiff1);
+  printf("Hacl ECDSA verification (without hashing, batched) PERF:\n"); print_time(count, tdiff2, cdiff2);
+  printf("Hacl ECDH (one at a time) PERF:\n"); print_time(count, tdiff3, cdiff3);
+  printf("Hacl ECDH (batched) PERF:\n"); print_time(count, tdiff4, cdiff4);
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
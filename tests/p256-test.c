@@ -141,6 +141,34 @@ int main()
 	cycles cdiff1 = b - a;
 
 
+	uint8_t sig[64];
+	uint8_t pubKey[64];
+	bool vr = true;
+	Hacl_P256_ecp256dh_i(pubKey, prKey);
+	Hacl_P256_ecdsa_sign_p256_without_hash(sig, 32, digest, prKey, nonce);
+
+	t1 = clock();
+	a = cpucycles_begin();
+
+	for (int j = 0; j < ROUNDS; j++)
+		vr = Hacl_P256_ecdsa_verif_without_hash(32, digest, pubKey, sig, sig + 32) && vr;
+
+	b = cpucycles_end();
+	t2 = clock();
+	clock_t tdiff2 = t2 - t1;
+	cycles cdiff2 = b - a;
+
+	t1 = clock();
+	a = cpucycles_begin();
+
+	for (int j = 0; j < ROUNDS; j++)
+		Hacl_P256_ecp256dh_i(plain, plain);
+
+	b = cpucycles_end();
+	t2 = clock();
+	clock_t tdiff4 = t2 - t1;
+	cycles cdiff4 = b - a;
+
 	uint8_t* pk = (uint8_t*) malloc (sizeof (uint8_t) * 64);
 	memcpy(pk, px0_0,  32);
 	memcpy(pk+32, py0_0,  32);
@@ -174,4 +202,13 @@ int main()
 
 	printf("Hacl ECDH PERF: %d\n"); 
 	print_time(count,tdiff3,cdiff3);  
+
+	printf("Hacl ECDSA verification (without hashing) PERF: %d\n", (int)vr);
+	print_time(count,tdiff2,cdiff2);
+
+	printf("Hacl ECDH key generation PERF:\n");
+	print_time(count,tdiff4,cdiff4);
+
+	if (!vr)
+		return -1;
 }
@@ -0,0 +1,295 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <stdbool.h>
+
+#include "Hacl_Hash.h"
+#include "Hacl_SHA2_Vec128.h"
+#include "Hacl_SHA2_Vec256.h"
+#include "EverCrypt_Hash.h"
+#include "EverCrypt_AutoConfig2.h"
+
+#include "test_helpers.h"
+#include "sha2_vectors.h"
+
+#define ROUNDS 200000
+#define SIZE   64
+#define LANES  8
+
+
+bool print_result(uint8_t* comp, uint8_t* exp, int len) {
+  return compare_and_print(len, comp, exp);
+}
+
+bool print_test(uint8_t* in, int in_len, uint8_t* exp256){
+  uint8_t comp[LANES][32] = {{0}};
+  uint8_t *dst[LANES];
+  uint8_t *input[LANES];
+  for (int i = 0; i < LANES; i++) {
+    dst[i] = comp[i];
+    input[i] = in;
+  }
+  bool ok = true;
+
+  Hacl_SHA2_Vec128_sha256_4(dst,in_len,input);
+  printf("SHA2-256 (4x128-bit) Result:\n");
+  for (int i = 0; i < 4; i++)
+    ok = print_result(comp[i],exp256,32) && ok;
+
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    Hacl_SHA2_Vec256_sha256_8(dst,in_len,input);
+    printf("SHA2-256 (8x256-bit) Result:\n");
+    for (int i = 0; i < LANES; i++)
+      ok = print_result(comp[i],exp256,32) && ok;
+  }
+
+  return ok;
+}
+
+// Every lane gets a different message, and the number of states is not a
+// multiple of the vector width, so that lane mix-ups and the scalar tail are
+// both caught.
+bool test_many(uint32_t n_states, uint32_t len){
+  uint8_t *msgs = malloc(n_states * len + 1);
+  uint8_t *digests = malloc(n_states * 32);
+  uint8_t **input = malloc(n_states * sizeof(uint8_t*));
+  uint8_t **dst = malloc(n_states * sizeof(uint8_t*));
+  for (uint32_t i = 0; i < n_states * len; i++)
+    msgs[i] = (uint8_t)(i * 31 + 7);
+  for (uint32_t i = 0; i < n_states; i++) {
+    input[i] = msgs + i * len;
+    dst[i] = digests + i * 32;
+  }
+
+  EverCrypt_Hash_hash_256_many(n_states,dst,input,len);
+
+  bool ok = true;
+  for (uint32_t i = 0; i < n_states; i++) {
+    uint8_t exp[32];
+    Hacl_Hash_SHA2_hash_256(input[i],len,exp);
+    ok = ok && memcmp(exp,dst[i],32) == 0;
+  }
+
+  // The streaming form: one block for each state, then the padding.
+  uint32_t *st = malloc(n_states * 8 * sizeof(uint32_t));
+  uint32_t **st_p = malloc(n_states * sizeof(uint32_t*));
+  for (uint32_t i = 0; i < n_states; i++) {
+    st_p[i] = st + i * 8;
+    Hacl_Hash_Core_SHA2_init_256(st_p[i]);
+  }
+  uint32_t blocks = len / 64;
+  EverCrypt_Hash_update_multi_256_many(n_states,st_p,input,blocks);
+  for (uint32_t i = 0; i < n_states; i++) {
+    uint8_t exp[32];
+    uint8_t comp[32];
+    EverCrypt_Hash_update_last_256(st_p[i],(uint64_t)(blocks * 64),input[i] + blocks * 64,len - blocks * 64);
+    Hacl_Hash_Core_SHA2_finish_256(st_p[i],comp);
+    Hacl_Hash_SHA2_hash_256(input[i],len,exp);
+    ok = ok && memcmp(exp,comp,32) == 0;
+  }
+
+  printf("SHA2-256 many (%u states, %u bytes): %s\n", n_states, len, ok ? "Success!" : "**FAILED**");
+  free(st_p);
+  free(st);
+  free(dst);
+  free(input);
+  free(digests);
+  free(msgs);
+  return ok;
+}
+
+// SHA2-384 and SHA2-512: the 4-lane and single-buffer AVX2 paths, with the
+// same checks against the portable code.
+bool test_many_512(uint32_t n_states, uint32_t len){
+  uint8_t *msgs = malloc(n_states * len + 1);
+  uint8_t *digests = malloc(n_states * 64);
+  uint8_t **input = malloc(n_states * sizeof(uint8_t*));
+  uint8_t **dst = malloc(n_states * sizeof(uint8_t*));
+  for (uint32_t i = 0; i < n_states * len; i++)
+    msgs[i] = (uint8_t)(i * 29 + 5);
+  for (uint32_t i = 0; i < n_states; i++) {
+    input[i] = msgs + i * len;
+    dst[i] = digests + i * 64;
+  }
+
+  bool ok = true;
+  EverCrypt_Hash_hash_512_many(n_states,dst,input,len);
+  for (uint32_t i = 0; i < n_states; i++) {
+    uint8_t exp[64];
+    Hacl_Hash_SHA2_hash_512(input[i],len,exp);
+    ok = ok && memcmp(exp,dst[i],64) == 0;
+    EverCrypt_Hash_hash(Spec_Hash_Definitions_SHA2_512,exp,input[i],len);
+    ok = ok && memcmp(exp,dst[i],64) == 0;
+  }
+  EverCrypt_Hash_hash_384_many(n_states,dst,input,len);
+  for (uint32_t i = 0; i < n_states; i++) {
+    uint8_t exp[48];
+    Hacl_Hash_SHA2_hash_384(input[i],len,exp);
+    ok = ok && memcmp(exp,dst[i],48) == 0;
+    EverCrypt_Hash_hash_384(input[i],len,exp);
+    ok = ok && memcmp(exp,dst[i],48) == 0;
+  }
+
+  uint64_t *st = malloc(n_states * 8 * sizeof(uint64_t));
+  uint64_t **st_p = malloc(n_states * sizeof(uint64_t*));
+  for (uint32_t i = 0; i < n_states; i++) {
+    st_p[i] = st + i * 8;
+    Hacl_Hash_Core_SHA2_init_512(st_p[i]);
+  }
+  uint32_t blocks = len / 128;
+  EverCrypt_Hash_update_multi_512_many(n_states,st_p,input,blocks);
+  for (uint32_t i = 0; i < n_states; i++) {
+    uint8_t exp[64];
+    uint8_t comp[64];
+    EverCrypt_Hash_update_last_512(st_p[i],FStar_UInt128_uint64_to_uint128((uint64_t)(blocks * 128)),input[i] + blocks * 128,len - blocks * 128);
+    Hacl_Hash_Core_SHA2_finish_512(st_p[i],comp);
+    Hacl_Hash_SHA2_hash_512(input[i],len,exp);
+    ok = ok && memcmp(exp,comp,64) == 0;
+  }
+
+  printf("SHA2-384/512 many (%u states, %u bytes): %s\n", n_states, len, ok ? "Success!" : "**FAILED**");
+  free(st_p);
+  free(st);
+  free(dst);
+  free(input);
+  free(digests);
+  free(msgs);
+  return ok;
+}
+
+// Single-buffer SHA2-512 over a long message.
+void bench_512(){
+  uint32_t len = 16384;
+  uint32_t rounds = 2000;
+  uint8_t *msg = malloc(len);
+  memset(msg,'Q',len);
+  uint64_t s[8];
+  Hacl_Hash_Core_SHA2_init_512(s);
+  cycles a,b;
+  clock_t t1,t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (uint32_t j = 0; j < rounds; j++)
+    Hacl_Hash_SHA2_update_multi_512(s,msg,len / 128);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (uint32_t j = 0; j < rounds; j++)
+    EverCrypt_Hash_update_multi_512(s,msg,len / 128);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+  uint64_t count = (uint64_t)rounds * len;
+  printf("SHA2-512 (64-bit) PERF: %d\n",(int)s[0]); print_time(count,tdiff1,cdiff1);
+  printf("SHA2-512 (EverCrypt) PERF:\n"); print_time(count,tdiff2,cdiff2);
+  free(msg);
+}
+
+int main(){
+  EverCrypt_AutoConfig2_init();
+  bool ok = true;
+  for (int i = 0; i < sizeof(vectors)/sizeof(sha2_test_vector); ++i) {
+    ok &= print_test(vectors[i].input,vectors[i].input_len,vectors[i].tag_256);
+  }
+
+  uint32_t lens[] = { 0, 1, 55, 56, 63, 64, 65, 119, 128, 1000 };
+  for (int i = 0; i < sizeof(lens)/sizeof(lens[0]); ++i) {
+    ok &= test_many(1, lens[i]);
+    ok &= test_many(13, lens[i]);
+  }
+  // Exercise the vector lanes even on machines with SHA extensions.
+  EverCrypt_AutoConfig2_disable_shaext();
+  for (int i = 0; i < sizeof(lens)/sizeof(lens[0]); ++i) {
+    ok &= test_many(13, lens[i]);
+    ok &= test_many(21, lens[i]);
+  }
+
+  uint32_t lens512[] = { 0, 1, 111, 112, 127, 128, 129, 239, 256, 1000 };
+  for (int i = 0; i < sizeof(lens512)/sizeof(lens512[0]); ++i) {
+    ok &= test_many_512(1, lens512[i]);
+    ok &= test_many_512(7, lens512[i]);
+  }
+  bench_512();
+  // And the portable fallback behind the same entry points.
+  EverCrypt_AutoConfig2_disable_avx2();
+  for (int i = 0; i < sizeof(lens512)/sizeof(lens512[0]); ++i)
+    ok &= test_many_512(7, lens512[i]);
+  EverCrypt_AutoConfig2_init();
+
+  uint8_t plain[LANES][SIZE];
+  uint8_t *input[LANES];
+  cycles a,b;
+  clock_t t1,t2;
+  for (int i = 0; i < LANES; i++) {
+    memset(plain[i],'P' + i,SIZE);
+    input[i] = plain[i];
+  }
+
+  for (int j = 0; j < ROUNDS; j++) {
+    for (int i = 0; i < LANES; i++)
+      Hacl_Hash_SHA2_hash_256(plain[i],SIZE,plain[i]);
+  }
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    for (int i = 0; i < LANES; i++)
+      Hacl_Hash_SHA2_hash_256(plain[i],SIZE,plain[i]);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA2_Vec128_sha256_4(input,SIZE,input);
+    Hacl_SHA2_Vec128_sha256_4(input + 4,SIZE,input + 4);
+  }
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int j = 0; j < ROUNDS; j++) {
+    Hacl_SHA2_Vec128_sha256_4(input,SIZE,input);
+    Hacl_SHA2_Vec128_sha256_4(input + 4,SIZE,input + 4);
+  }
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+
+  double cdiff3 = 0;
+  double tdiff3 = 0;
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_SHA2_Vec256_sha256_8(input,SIZE,input);
+    }
+    t1 = clock();
+    a = cpucycles_begin();
+    for (int j = 0; j < ROUNDS; j++) {
+      Hacl_SHA2_Vec256_sha256_8(input,SIZE,input);
+    }
+    b = cpucycles_end();
+    t2 = clock();
+    cdiff3 = b - a;
+    tdiff3 = t2 - t1;
+  }
+
+  uint8_t res = plain[0][0];
+  uint64_t count = ROUNDS * SIZE * LANES;
+  printf("SHA2-256 (32-bit, 8 messages) PERF: %d\n",(int)res); print_time(count,tdiff1,cdiff1);
+  printf("SHA2-256 (4x128-bit, 8 messages) PERF: %d\n",(int)res); print_time(count,tdiff2,cdiff2);
+  if (EverCrypt_AutoConfig2_has_avx2()) {
+    printf("SHA2-256 (8x256-bit, 8 messages) PERF: %d\n",(int)res); print_time(count,tdiff3,cdiff3);
+  }
+
+  if (ok) return EXIT_SUCCESS;
+  else return EXIT_FAILURE;
+}
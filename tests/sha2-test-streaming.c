@@ -10,13 +10,150 @@
 #include <time.h>
 
 #include "Hacl_Streaming_SHA2.h"
+#include "EverCrypt_Streaming_SHA2.h"
+#include "Hacl_Streaming_SHA1.h"
+#include "Hacl_Streaming_MD5.h"
+#include "EverCrypt_AutoConfig2.h"
 
 #include "test_helpers.h"
 #include "sha2_vectors.h"
 
 typedef Hacl_Streaming_Functor_state_s___uint32_t____ sha2_state;
 
+#define BIG_LEN 100000
+#define ROUNDS  200
+
+// Same chunking over every vector with the dispatching EverCrypt functions.
+bool test_evercrypt() {
+  bool ok = true;
+  uint8_t tag[32] = {};
+  sha2_state *s256 = EverCrypt_Streaming_SHA2_create_in_256();
+  sha2_state *s224 = EverCrypt_Streaming_SHA2_create_in_224();
+  for (int i = 0; i < sizeof(vectors)/sizeof(vectors[0]); i++) {
+    sha2_test_vector *v = &vectors[i];
+    size_t half = v->input_len / 2;
+    EverCrypt_Streaming_SHA2_init_256(s256);
+    EverCrypt_Streaming_SHA2_update_256(s256, v->input, half);
+    EverCrypt_Streaming_SHA2_update_256(s256, NULL, 0);
+    EverCrypt_Streaming_SHA2_update_256(s256, v->input + half, v->input_len - half);
+    EverCrypt_Streaming_SHA2_finish_256(s256, tag);
+    ok &= compare_and_print(32, tag, v->tag_256);
+    EverCrypt_Streaming_SHA2_init_224(s224);
+    EverCrypt_Streaming_SHA2_update_224(s224, v->input, half);
+    EverCrypt_Streaming_SHA2_update_224(s224, v->input + half, v->input_len - half);
+    EverCrypt_Streaming_SHA2_finish_224(s224, tag);
+    ok &= compare_and_print(28, tag, v->tag_224);
+  }
+
+  // Uneven chunks over a long input, alternating between the two modules on
+  // one state, against the portable code alone.
+  uint8_t *big = malloc(BIG_LEN);
+  uint8_t expected[32];
+  for (int i = 0; i < BIG_LEN; i++)
+    big[i] = (uint8_t)(i * 7 + 3);
+  sha2_state *h = Hacl_Streaming_SHA2_create_in_256();
+  Hacl_Streaming_SHA2_update_256(h, big, BIG_LEN);
+  Hacl_Streaming_SHA2_finish_256(h, expected);
+  EverCrypt_Streaming_SHA2_init_256(s256);
+  uint32_t off = 0, chunk = 1, j = 0;
+  while (off < BIG_LEN) {
+    uint32_t len = BIG_LEN - off < chunk ? BIG_LEN - off : chunk;
+    if (j++ % 3 == 0)
+      Hacl_Streaming_SHA2_update_256(s256, big + off, len);
+    else
+      EverCrypt_Streaming_SHA2_update_256(s256, big + off, len);
+    off += len;
+    chunk = chunk * 3 % 1031 + 1;
+  }
+  EverCrypt_Streaming_SHA2_finish_256(s256, tag);
+  ok &= compare_and_print(32, tag, expected);
+
+  cycles a, b;
+  clock_t t1, t2;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int r = 0; r < ROUNDS; r++)
+    Hacl_Streaming_SHA2_update_256(h, big, BIG_LEN);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff1 = b - a;
+  double tdiff1 = t2 - t1;
+  t1 = clock();
+  a = cpucycles_begin();
+  for (int r = 0; r < ROUNDS; r++)
+    EverCrypt_Streaming_SHA2_update_256(s256, big, BIG_LEN);
+  b = cpucycles_end();
+  t2 = clock();
+  double cdiff2 = b - a;
+  double tdiff2 = t2 - t1;
+  uint64_t count = (uint64_t)ROUNDS * BIG_LEN;
+  printf("Hacl_Streaming_SHA2_update_256 PERF:\n"); print_time(count, tdiff1, cdiff1);
+  printf("EverCrypt_Streaming_SHA2_update_256 PERF:\n"); print_time(count, tdiff2, cdiff2);
+
+  Hacl_Streaming_SHA2_free_256(h);
+  EverCrypt_Streaming_SHA2_free_256(s256);
+  EverCrypt_Streaming_SHA2_free_224(s224);
+  free(big);
+  return ok;
+}
+
+// Caller-provided storage: the Hacl and EverCrypt streaming states, and the
+// agile hash, against the heap-allocated versions.
+bool test_in_place() {
+  _Alignas(Hacl_Streaming_SHA2_state_align) uint8_t mem[Hacl_Streaming_SHA2_state_len_512];
+  _Alignas(EverCrypt_Hash_Incremental_state_align) uint8_t inc_mem[EverCrypt_Hash_Incremental_state_len];
+  bool ok = true;
+  uint8_t tag[64] = {}, expected[64] = {};
+  for (int i = 0; i < sizeof(vectors)/sizeof(vectors[0]); i++) {
+    sha2_test_vector *v = &vectors[i];
+    sha2_state *s256 = Hacl_Streaming_SHA2_init_in_place_256(mem);
+    Hacl_Streaming_SHA2_update_256(s256, v->input, v->input_len);
+    Hacl_Streaming_SHA2_finish_256(s256, tag);
+    ok &= compare_and_print(32, tag, v->tag_256);
+    s256 = Hacl_Streaming_SHA2_init_in_place_224(mem);
+    EverCrypt_Streaming_SHA2_update_224(s256, v->input, v->input_len);
+    EverCrypt_Streaming_SHA2_finish_224(s256, tag);
+    ok &= compare_and_print(28, tag, v->tag_224);
+    Hacl_Streaming_Functor_state_s___uint64_t____ *s512 = Hacl_Streaming_SHA2_init_in_place_512(mem);
+    Hacl_Streaming_SHA2_update_512(s512, v->input, v->input_len);
+    Hacl_Streaming_SHA2_finish_512(s512, tag);
+    ok &= compare_and_print(64, tag, v->tag_512);
+    s512 = Hacl_Streaming_SHA2_init_in_place_384(mem);
+    Hacl_Streaming_SHA2_update_384(s512, v->input, v->input_len);
+    Hacl_Streaming_SHA2_finish_384(s512, tag);
+    ok &= compare_and_print(48, tag, v->tag_384);
+
+    Spec_Hash_Definitions_hash_alg algs[] = {
+      Spec_Hash_Definitions_SHA2_256, Spec_Hash_Definitions_SHA2_512, Spec_Hash_Definitions_Blake2B
+    };
+    for (int j = 0; j < 3; j++) {
+      uint32_t len = EverCrypt_Hash_Incremental_hash_len(algs[j]);
+      EverCrypt_Hash_hash(algs[j], expected, v->input, v->input_len);
+      Hacl_Streaming_Functor_state_s___EverCrypt_Hash_state_s____ *h =
+        EverCrypt_Hash_Incremental_init_in_place(algs[j], inc_mem);
+      EverCrypt_Hash_Incremental_update(h, v->input, v->input_len);
+      EverCrypt_Hash_Incremental_finish(h, tag);
+      ok &= compare_and_print(len, tag, expected);
+    }
+
+    _Alignas(Hacl_Streaming_SHA1_state_align) uint8_t sha1_mem[Hacl_Streaming_SHA1_state_len];
+    _Alignas(Hacl_Streaming_MD5_state_align) uint8_t md5_mem[Hacl_Streaming_MD5_state_len];
+    sha2_state *l = Hacl_Streaming_SHA1_legacy_init_in_place_sha1(sha1_mem);
+    Hacl_Streaming_SHA1_legacy_update_sha1(l, v->input, v->input_len);
+    Hacl_Streaming_SHA1_legacy_finish_sha1(l, tag);
+    EverCrypt_Hash_hash(Spec_Hash_Definitions_SHA1, expected, v->input, v->input_len);
+    ok &= compare_and_print(20, tag, expected);
+    l = Hacl_Streaming_MD5_legacy_init_in_place_md5(md5_mem);
+    Hacl_Streaming_MD5_legacy_update_md5(l, v->input, v->input_len);
+    Hacl_Streaming_MD5_legacy_finish_md5(l, tag);
+    EverCrypt_Hash_hash(Spec_Hash_Definitions_MD5, expected, v->input, v->input_len);
+    ok &= compare_and_print(16, tag, expected);
+  }
+  return ok;
+}
+
 int main() {
+  EverCrypt_AutoConfig2_init();
   bool ok = true;
 
   // Here, I can't really loop over the vectors... because I want to exercise
@@ -49,6 +186,9 @@ int main() {
 
   Hacl_Streaming_SHA2_free_256(s);
 
+  ok &= test_evercrypt();
+  ok &= test_in_place();
+
   if (ok)
     return EXIT_SUCCESS;
   else